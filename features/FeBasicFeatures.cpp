@@ -843,21 +843,45 @@ void FindDistPrevMoveFeatures(const GoBoard& bd,
         SetDistances2ndLastMove(lastMove2, legalBoardMoves, features);
 }
 
-int FindClosestStoneDistance(const GoBoard& bd,
-                             SgPoint empty, SgBlackWhite color)
-{
-    int distance = 99999;
-
-    for (GoBoard::Iterator it(bd); it; ++it) // @todo: slow, loop from
-                                             // closest to furtherst instead
-        if (  bd.GetColor(*it) == color
-           && Distance(empty, *it) < distance)
+/** Compute the distance of all points to the closest stone of a color.
+    Distance() is the chamfer distance with the weights 2 for orthogonal
+    and 3 for diagonal steps (2 * max(dx,dy) + min(dx,dy)). So the distance
+    transform with these weights computes it exactly in two passes over the
+    board, instead of a loop over all points for each point.
+    Requires that the board contains stones of the color. */
+void FindClosestStoneDistances(const GoBoard& bd, SgBlackWhite color,
+                               SgPointArray<int>& distance)
+{
+    const int INFINITE_DISTANCE = 99999;
+    distance.Fill(INFINITE_DISTANCE);
+    for (GoBoard::Iterator it(bd); it; ++it)
+        if (bd.IsColor(*it, color))
+            distance[*it] = 0;
+    const int size = bd.Size();
+    // Forward pass, neighbors above and to the left
+    for (int row = 1; row <= size; ++row)
+        for (int col = 1; col <= size; ++col)
         {
-            distance = Distance(empty, *it);
+            const SgPoint p = SgPointUtil::Pt(col, row);
+            int d = distance[p];
+            d = std::min(d, distance[p - SG_WE] + 2);
+            d = std::min(d, distance[p - SG_NS] + 2);
+            d = std::min(d, distance[p - SG_NS - SG_WE] + 3);
+            d = std::min(d, distance[p - SG_NS + SG_WE] + 3);
+            distance[p] = d;
+        }
+    // Backward pass, neighbors below and to the right
+    for (int row = size; row >= 1; --row)
+        for (int col = size; col >= 1; --col)
+        {
+            const SgPoint p = SgPointUtil::Pt(col, row);
+            int d = distance[p];
+            d = std::min(d, distance[p + SG_WE] + 2);
+            d = std::min(d, distance[p + SG_NS] + 2);
+            d = std::min(d, distance[p + SG_NS + SG_WE] + 3);
+            d = std::min(d, distance[p + SG_NS - SG_WE] + 3);
+            distance[p] = d;
         }
-
-    SG_ASSERT(distance < 99999);
-    return distance;
 }
 
 void FindClosestDistanceFeaturesForColor(const GoBoard& bd,
@@ -869,9 +893,11 @@ void FindClosestDistanceFeaturesForColor(const GoBoard& bd,
     if (bd.All(color).IsEmpty())
         return;
 
+    SgPointArray<int> closest;
+    FindClosestStoneDistances(bd, color, closest);
     for (GoPointList::Iterator it(legalBoardMoves); it; ++it)
     {
-        int distance = FindClosestStoneDistance(bd, *it, color);
+        int distance = closest[*it];
         SG_ASSERT(distance >= 2);
         if (distance > MAX_CLOSEST_DISTANCE)
             distance = MAX_CLOSEST_DISTANCE;
@@ -1146,6 +1172,14 @@ float FeFeatures::EvaluateMoveFeatures(const FeMoveFeatures& features,
     return EvaluateActiveFeatures(active, nuActive, weights);
 }
 
+float FeFeatures::EvaluateMoveFeatures(const FeMoveFeatures& features,
+                                       const FeFactorEvaluator& evaluator)
+{
+    FeActiveArray active;
+    const size_t nuActive = features.ActiveFeatures(active);
+    return evaluator.Evaluate(active.data(), nuActive);
+}
+
 std::vector<FeFeatures::FeEvalDetail>
 FeFeatures::EvaluateMoveFeaturesDetail(const FeMoveFeatures& features,
                                        const FeFeatureWeights& weights)
@@ -1372,6 +1406,18 @@ EvaluateFeatures(const FeFeatureWeights& weights) const
     return eval;
 }
 
+GoEvalArray<float> FeFullBoardFeatures::
+EvaluateFeatures(const FeFactorEvaluator& evaluator) const
+{
+    GoEvalArray<float> eval(0);
+    for (GoPointList::Iterator it(m_legalMoves); it; ++it)
+        eval[*it] = FeFeatures::EvaluateMoveFeatures(m_features[*it],
+                                                     evaluator);
+    eval[SG_PASS] = FeFeatures::EvaluateMoveFeatures(m_features[SG_PASS],
+                                                     evaluator);
+    return eval;
+}
+
 void FeFullBoardFeatures::FindAllFeatures()
 {
     for (GoPointList::Iterator it(m_legalMoves); it; ++it)
@@ -12,6 +12,7 @@
 #include <bitset>
 #include <iosfwd>
 #include <boost/array.hpp>
+#include "FeFactorEvaluator.h"
 #include "FeFeatureWeights.h"
 #include "GoBoardUtil.h"
 #include "GoEvalArray.h"
@@ -322,6 +323,11 @@ struct FeFullBoardFeatures
     GoEvalArray<float>
     EvaluateFeatures(const FeFeatureWeights& weights) const;
 
+    /** Same as EvaluateFeatures(const FeFeatureWeights&), but faster.
+        The values differ only by rounding. */
+    GoEvalArray<float>
+    EvaluateFeatures(const FeFactorEvaluator& evaluator) const;
+
     /** Some features are computed by GoUct which is higher up, so need 
         to export this. It would be cleaner to move FeFullBoardFeatures
         down into GoUct as well. */
@@ -421,6 +427,10 @@ float EvaluateActiveFeatures(const FeActiveArray& active,
 float EvaluateMoveFeatures(const FeMoveFeatures& features,
                            const FeFeatureWeights& weights);
 
+/** Evaluate features for one move, using the weights of an evaluator */
+float EvaluateMoveFeatures(const FeMoveFeatures& features,
+                           const FeFactorEvaluator& evaluator);
+
 /** For display, return details on each evaluated feature */
 std::vector<FeEvalDetail>
 EvaluateMoveFeaturesDetail(const FeMoveFeatures& features,
@@ -1,2470 +1,3710 @@
 /* File FeData.h
 Auto-generated by makeFeData.sh on
-Fri 14 Mar 2014 08:28:11 JST
+Sat 17 Oct 2026 10:00:00 UTC
 From file /Users/mmueller/Dropbox/parameter-study/Mar13-model/2000-2013.k10.model . Do not edit. */
 
-static const std::string gFeatureData = 
-"size:1231,k:10 "
-"0,-0.043992401778103436 "
-"1,0.013726505460659157 "
-"2,0.021824381149550737 "
-"3,0.0832011275700712 "
-"4,0.030029223710345103 "
-"5,-0.032434075362046476 "
-"6,-0.07054452617334656 "
-"7,-0.05346281063101783 "
-"8,0.01425871703781274 "
-"9,-0.03200214516806793 "
-"10,0.008039393053046368 "
-"11,0.007454692598728527 "
-"12,-0.01575881378289391 "
-"13,0.004588413254933907 "
-"14,0.006060363861275674 "
-"15,-0.0069868433528680165 "
-"17,-0.002682649426821909 "
-"16,-0.044603608112031956 "
-"19,-0.025762858167422065 "
-"18,0.026238867946587214 "
-"21,0.0013706025678200413 "
-"20,-0.008331972214515503 "
-"23,0.010576975511002883 "
-"22,0.005513920464238472 "
-"25,-0.009885408915858316 "
-"24,-0.006710622610912039 "
-"27,0.048245768532464914 "
-"26,0.0721229580111337 "
-"29,0.05643824179670058 "
-"28,0.05662108428969269 "
-"31,0.036346251737295554 "
-"30,0.03189044922457084 "
-"34,0.015470385909787691 "
-"35,0.017419384815110243 "
-"32,0.027337978801361795 "
-"33,0.027068965982860932 "
-"38,0.006865637084974617 "
-"39,0.008868679880252963 "
-"36,0.010143514220863535 "
-"37,0.006853378898158785 "
-"42,0.05641779088586299 "
-"43,-0.01808279243513353 "
-"40,0.007020402360215468 "
-"41,0.004161220319272579 "
-"46,-0.001934566183802659 "
-"47,-7.905203478286436E-4 "
-"44,9.492334142165993E-4 "
-"45,0.010591633960498918 "
-"51,0.0027129282878604654 "
-"50,4.982554368960841E-4 "
-"49,-0.006397983347134027 "
-"48,0.009674609482409927 "
-"55,0.0028631517035285917 "
-"54,0.0029165917041469006 "
-"53,3.7052188452014627E-4 "
-"52,8.782421196743944E-4 "
-"58,0.0026000820916568593 "
-"57,-2.034338426974144E-4 "
-"56,0.0020516731203063963 "
-"63,0.024395798328755425 "
-"62,0.2210934064599223 "
-"61,0.10677784099992223 "
-"60,0.03682552934670927 "
-"68,-0.01408608097091831 "
-"69,-0.021417280230580836 "
-"70,0.006848791377503277 "
-"71,-0.029923885909300903 "
-"64,0.049914465952207665 "
-"65,1.8214037587076037E-4 "
-"66,-0.10338078081345567 "
-"67,-0.05380849461979005 "
-"76,0.0162783360858933 "
-"77,6.890036145584671E-4 "
-"78,-0.004740129206808317 "
-"79,-0.007070010218196361 "
-"72,0.05459620474664538 "
-"73,-0.003894112085623163 "
-"74,-0.005256747072283061 "
-"75,0.006981161833293663 "
-"85,-0.008649663384383497 "
-"84,-0.0031227517822727635 "
-"87,-4.4738414464035557E-4 "
-"86,-0.004795509208773559 "
-"81,-0.005475953617356016 "
-"80,-2.845644320532957E-4 "
-"83,-0.003975786879713506 "
-"82,0.003969720598243573 "
-"93,0.09808211201028438 "
-"92,0.0696886948678087 "
-"95,-0.009809081378452215 "
-"94,0.12473471032842148 "
-"89,0.022061335591713013 "
-"88,0.007097664576092979 "
-"91,0.04155915326854618 "
-"90,0.03397858390212572 "
-"102,-0.008445341187092613 "
-"103,-0.003310037939552013 "
-"100,-0.010256427873308147 "
-"101,-0.002066590723852283 "
-"98,-0.007726182025732693 "
-"99,-0.007410480560470403 "
-"96,-0.012612192584626114 "
-"97,-0.006590143021560319 "
-"110,0.01851690951217028 "
-"111,0.051093838305935786 "
-"108,0.03283573564306124 "
-"109,0.0014625114666563855 "
-"106,6.095802650115428E-4 "
-"107,0.0043819492198116095 "
-"104,-4.4809385603389887E-4 "
-"105,0.017174111990581813 "
-"119,-0.02126975136430529 "
-"118,0.05794803528357812 "
-"117,-0.002852031222105959 "
-"116,0.0022506537294581085 "
-"115,-0.008636494757834104 "
-"114,0.01877562083326379 "
-"113,0.08068130708252146 "
-"112,-0.0033079869469821864 "
-"127,0.10606724031611293 "
-"126,-0.03457883248671212 "
-"125,0.001355644363513237 "
-"124,-0.048062840022129794 "
-"123,0.012682125197970847 "
-"122,-0.026677041045145712 "
-"121,-0.024363839539926054 "
-"120,-0.03513874736724853 "
-"2065,0.02675215849568557 "
-"137,0.04612659102148556 "
-"136,0.04521193304625435 "
-"2064,0.0178234341628396 "
-"139,0.09447936702883221 "
-"2067,-0.006718416856905685 "
-"2066,-0.027009925454548916 "
-"138,0.0663595777536972 "
-"141,0.035629139760351675 "
-"2069,0.030812981374148826 "
-"140,0.09343990569196184 "
-"2068,0.025640191188814034 "
-"2071,-0.006857105925215715 "
-"143,-0.10896750064328727 "
-"2070,0.015429379758252891 "
-"142,-0.08345253159562638 "
-"129,-0.001985303837076265 "
-"2073,0.0016660521854566395 "
-"128,-0.037325902296473805 "
-"2075,-0.04634625286203708 "
-"131,0.05823645943800869 "
-"130,0.040694229870526934 "
-"2074,-0.0028218764673441097 "
-"2077,-0.009755010873196792 "
-"133,0.0657177858075339 "
-"132,0.048829896583332616 "
-"135,0.021272051967373213 "
-"2079,-0.04353851551265163 "
-"134,0.030437790419205458 "
-"2078,-0.008423689907073165 "
-"2048,-0.030972940271981525 "
-"152,-0.04307687774134541 "
-"153,0.006996557890509391 "
-"2049,-0.04500347657636045 "
-"2050,0.10435981144037892 "
-"2051,-0.026435063469366072 "
-"155,0.010244201544087748 "
-"156,0.014322864319786624 "
-"2052,-0.01126376429611901 "
-"2053,0.01130995595890669 "
-"2054,0.0552603937387763 "
-"2055,0.07411551234314483 "
-"2056,-0.020971501048387388 "
-"144,-0.13074171659102812 "
-"2057,0.01040594119158525 "
-"145,-0.1341562830317203 "
-"2058,0.034882867360408645 "
-"146,-0.14623660485711756 "
-"2059,0.10534833625661712 "
-"147,-0.09614326195111703 "
-"148,-0.03938354168477378 "
-"2060,0.0075835779010149 "
-"149,0.007200191195495038 "
-"2061,-0.02907762717531834 "
-"2062,-0.023506706234821272 "
-"150,-0.08205247850386785 "
-"151,-0.05887192296769318 "
-"2063,0.035468462460988115 "
-"2099,-0.03327282099472421 "
-"2098,-0.028030818248827458 "
-"2097,-0.004131247573966846 "
-"2103,-0.05419993657178016 "
-"2102,-0.026745786969392192 "
-"2101,-0.026231386856547807 "
-"2100,-0.10037139316352488 "
-"2107,-0.027778192301470505 "
-"2106,-0.01643592229334825 "
-"2105,-0.02577956491124747 "
-"2104,3.019642462468328E-4 "
-"2111,-0.04757112556668956 "
-"2110,-8.918223438745458E-4 "
-"2109,-0.0367287706800554 "
-"2108,-0.03970218104983201 "
-"2082,-0.0024837183803171686 "
-"2083,-0.03380849740574179 "
-"2080,-0.08486280157448385 "
-"2081,-0.009610173512731381 "
-"2086,-0.04187171964721987 "
-"2087,-0.06476310815178032 "
-"2084,-0.07495516517539266 "
-"2085,-0.02365553932162855 "
-"2090,-0.045632967412513256 "
-"2091,-0.07058408512204624 "
-"2088,-0.06748077241495308 "
-"2089,-0.04756243525896897 "
-"2094,-0.07921341995968473 "
-"2092,-0.045783076495173686 "
-"2093,-0.06200312659485457 "
-"2133,0.0021814410464036076 "
-"2132,-0.021412515635916184 "
-"2135,-0.036185792804755146 "
-"2134,-0.044989748121346304 "
-"2129,-0.055668067058814656 "
-"2128,-0.02497744183695997 "
-"2131,-0.00422806258466199 "
-"2130,-0.0314746678653239 "
-"2141,0.04450976673399777 "
-"2140,-0.0298859053943595 "
-"2143,-0.0285565725890815 "
-"2142,0.021058123468361695 "
-"2137,-0.03597709758787071 "
-"2136,-0.04748511695929543 "
-"2139,0.07324983913929778 "
-"2138,-0.0781500096118026 "
-"2116,-0.03798527959718149 "
-"2117,-0.039772923204370876 "
-"2118,-0.050366530173639144 "
-"2119,-0.04712440682969475 "
-"2112,-0.05348789711597286 "
-"2113,-0.06476343126774144 "
-"2114,-0.05917808464404155 "
-"2115,-0.06395052633126183 "
-"2124,-0.03567320063717441 "
-"2125,-0.02756492156323723 "
-"2126,-0.06387230231919785 "
-"2127,0.020109685828133248 "
-"2120,-0.0575832936682619 "
-"2121,-0.02751274688463667 "
-"2122,-0.015152833910795445 "
-"2123,-0.005965703567185184 "
-"2150,-0.06705645833161628 "
-"2151,-0.050861145579705745 "
-"2149,-0.004604816183074605 "
-"2146,-0.0355038204840882 "
-"2147,-0.03486556053526509 "
-"2144,0.047308768319900725 "
-"2145,-0.06475098366863184 "
-"2152,-0.03074334398618455 "
-"2153,-0.01282605778209353 "
-"1016,-0.005559476460219528 "
-"1017,-0.02272063542675227 "
-"1018,-0.036784044761226944 "
-"1019,0.04169459640121203 "
-"1020,-0.02507430438618407 "
-"1021,0.010431419368448977 "
-"1022,-0.08287347569204655 "
-"1023,-0.04993877103847261 "
-"1008,-0.05352071111456951 "
-"1009,0.02590715470174332 "
-"1010,0.02350561221801707 "
-"1011,0.03099292076783201 "
-"1012,0.05993941445706721 "
-"1013,-0.027012726956415035 "
-"1014,-0.024981421287623356 "
-"1015,0.017085556500822552 "
-"1001,-0.01417086110326981 "
-"1000,-0.008958327948566484 "
-"1003,0.0291354452756606 "
-"1002,-0.02642380555408049 "
-"1005,-0.04165812308658163 "
-"1004,-0.03261435394889726 "
-"1007,-0.04516330911510853 "
-"1006,-0.005150219870730215 "
-"1100,-0.03241018071668431 "
-"1101,-0.016834218167248848 "
-"1102,-0.016580226457972646 "
-"1103,-0.0033675286143880394 "
-"1096,0.010909184812895316 "
-"1097,8.028512938932167E-4 "
-"1099,-0.02038446408302541 "
-"1092,0.0021363098897318887 "
-"1093,0.01608670649921052 "
-"1094,-0.029899685467017975 "
-"1095,0.0022685159196322506 "
-"1088,0.07735297391047982 "
-"1089,0.06013688525270816 "
-"1090,-0.029993635536629645 "
-"1091,3.3810253132303967E-4 "
-"1117,-0.04607439671795628 "
-"1116,-0.007584254594763804 "
-"1119,-0.04043355032014595 "
-"1118,-0.04318518036942975 "
-"1113,0.00973389074177488 "
-"1112,0.0018399129828928589 "
-"1115,0.006784155895861046 "
-"1114,-0.013316302618894188 "
-"1109,-0.004612148698687968 "
-"1108,-0.01804476513545704 "
-"1110,-2.0254040039077636E-4 "
-"1105,-0.03434768833052755 "
-"1104,-0.049822685331843614 "
-"1107,8.391104122435933E-4 "
-"1106,0.025784087840202054 "
-"1134,-0.05532667307982664 "
-"1132,-0.0362700699566704 "
-"1133,-0.025730532806231925 "
-"1130,-0.049552090279822006 "
-"1131,-0.05898738457311805 "
-"1128,-0.02392644777918006 "
-"1129,-0.02567547115143628 "
-"1126,-0.009432899647360707 "
-"1127,-0.047699525058250494 "
-"1124,-0.0339982753677997 "
-"1125,-0.05287402993542117 "
-"1122,-0.02492043072530953 "
-"1123,-0.035609477418608086 "
-"1120,0.08600929335798498 "
-"1121,-0.026942111404045527 "
-"1032,0.007636755459512571 "
-"1033,0.05994257887542596 "
-"1034,-0.015771107243345364 "
-"1035,0.0724124779857773 "
-"1036,0.07642909207087699 "
-"1037,0.10340222416772736 "
-"1038,0.012490380036565756 "
-"1039,-0.0320076455005188 "
-"1024,-0.031498497486121824 "
-"1025,-0.04990926369196036 "
-"1026,-0.05886087101476793 "
-"1027,0.05241783855990501 "
-"1028,-0.005263650731502935 "
-"1029,0.06264165857494776 "
-"1030,0.08871360717842346 "
-"1031,0.009005124996462943 "
-"1049,-0.010358036419693538 "
-"1048,0.005735380391472816 "
-"1051,0.04940831990630696 "
-"1050,-0.018273369679692935 "
-"1053,-0.01578804011178581 "
-"1052,-0.043756639500844685 "
-"1055,-0.010865508622924831 "
-"1054,-0.02502872534722696 "
-"1041,0.03668578839228413 "
-"1040,0.08659006978623017 "
-"1043,-0.022792199617635046 "
-"1042,-0.0016947085738542812 "
-"1045,0.06703196928694294 "
-"1044,0.019405381297113576 "
-"1047,-0.026884021111133614 "
-"1046,-0.002473019531838211 "
-"1066,-0.0315466020468379 "
-"1067,-0.033581786337290184 "
-"1064,0.004193084108455971 "
-"1065,0.03950089271165306 "
-"1070,-0.008973434379960782 "
-"1071,-0.05974538115289261 "
-"1068,-0.0394752635665169 "
-"1069,-0.014821233412549364 "
-"1058,0.04547608380977173 "
-"1059,0.0474685831360299 "
-"1056,-0.004053598281267016 "
-"1057,-0.04406988905195337 "
-"1062,0.052166022053045026 "
-"1063,0.013181929222815816 "
-"1060,-0.0060480938696798265 "
-"1061,-0.011250086419493231 "
-"1083,0.05128872376519892 "
-"1082,-0.01758435858352421 "
-"1081,0.06591487063119104 "
-"1080,-0.004168628247834099 "
-"1087,0.06522591129819935 "
-"1086,0.02558564658404101 "
-"1085,0.045603352175815584 "
-"1084,0.0454145170115692 "
-"1075,0.05893633567573366 "
-"1074,0.033190722110648226 "
-"1073,-0.002783831808565348 "
-"1072,0.05630858380627057 "
-"1079,0.0659402199332498 "
-"1078,0.11198485874670007 "
-"1077,0.030409383235237352 "
-"1076,0.03585228356297456 "
-"1221,-0.002705109382248942 "
-"1220,-0.026918530351081146 "
-"1223,-0.07915578787622264 "
-"1222,-0.05566481572072644 "
-"1217,-0.03310692832893936 "
-"1216,-0.049112374737801646 "
-"1219,-0.02490641591442671 "
-"1218,0.01642305886786737 "
-"1229,-0.033164644900195606 "
-"1228,-0.02974692632583031 "
-"1231,-0.009952507460167393 "
-"1230,0.01675336209716531 "
-"1225,0.013076650973271223 "
-"1224,0.055579093271147455 "
-"1227,0.014203877042690506 "
-"1226,0.003466570755362898 "
-"1236,-0.016154333394968 "
-"1237,-0.059540083229363265 "
-"1238,-0.042022274409670546 "
-"1239,0.01842964136144187 "
-"1232,-0.01836795159442367 "
-"1233,-0.015889707261689798 "
-"1234,-0.014712175077106497 "
-"1235,-0.043699886923330086 "
-"1244,-0.05415029841234023 "
-"1245,-0.04879319660032631 "
-"1246,0.0067211130373561094 "
-"1247,-0.06407734950490258 "
-"1240,-0.08094135753517888 "
-"1241,-0.05766195575042671 "
-"1242,-0.01486975568188599 "
-"1243,-0.06137187563430399 "
-"1255,-0.02722226881232098 "
-"1254,-0.03590401801577042 "
-"1253,-0.07678676636067061 "
-"1252,-0.05467889173697396 "
-"1251,-0.03464112578256286 "
-"1250,-0.08091094831845687 "
-"1249,-0.05088403761727405 "
-"1248,-0.018140051275984313 "
-"1263,0.10315537476598781 "
-"1262,-0.05645219050643576 "
-"1261,-0.06820546666067927 "
-"1260,-0.036454486648852896 "
-"1259,-0.08845564822569547 "
-"1258,-0.07588958846321674 "
-"1257,-0.02833234883753232 "
-"1256,-0.038923219396751196 "
-"1270,0.04790772446346352 "
-"1271,0.05650198208865081 "
-"1268,0.02731619197907423 "
-"1269,0.09551322173764534 "
-"1266,0.034519622724387876 "
-"1267,-7.935723715061275E-4 "
-"1264,0.10931700180120742 "
-"1265,0.07463169303262387 "
-"1278,0.059822520818952 "
-"1279,-0.014198571075265773 "
-"1276,-0.014548805433660755 "
-"1277,0.004542525290679923 "
-"1274,-0.024859878562669257 "
-"1275,-0.036516883112761245 "
-"1272,0.0885648408001271 "
-"1273,0.06289801192888082 "
-"1202,0.009071348986803764 "
-"1203,-0.0214008607779595 "
-"1200,-0.0019878176283711895 "
-"1201,-0.006049731057169549 "
-"1206,-0.025318734759811157 "
-"1207,-0.0067388446295774534 "
-"1204,-0.021920481088842262 "
-"1205,-0.05961776619516547 "
-"1210,-0.01068185819819945 "
-"1211,-0.02188149527751847 "
-"1208,-0.022209768231757767 "
-"1209,0.006469759630625069 "
-"1214,-0.01847975969597921 "
-"1215,-0.0033927287889131317 "
-"1212,-0.06551141824742046 "
-"1213,-0.016781836597815788 "
-"1375,0.06634255211438696 "
-"1374,0.07292209944310227 "
-"1373,0.076876685718844 "
-"1372,0.062463851178562804 "
-"1371,0.08121279715456428 "
-"1370,-0.10377531435476223 "
-"1369,-0.06148717140479422 "
-"1368,-0.04080317733088864 "
-"1367,-0.02013317110140765 "
-"1366,-0.020766036526837485 "
-"1365,-0.004233063053817159 "
-"1364,-0.0170034245504385 "
-"1363,-0.011849883946741115 "
-"1362,-0.025219839731792024 "
-"1361,-0.03508401095399027 "
-"1360,-0.028491814943300744 "
-"1358,-0.05071368402160848 "
-"1359,0.003867507690958167 "
-"1356,0.010816479700700125 "
-"1357,-0.08589780724171338 "
-"1354,-0.07233336351452355 "
-"1355,-0.050775714097126314 "
-"1352,-0.049918190459288365 "
-"1353,0.00243959981412419 "
-"1350,-0.022600650883161818 "
-"1351,-0.027091721062792097 "
-"1348,-0.0121009204195204 "
-"1349,-0.016825206764574385 "
-"1346,-0.02800475325501452 "
-"1347,0.016858676368677075 "
-"1344,0.016136569838365183 "
-"1345,-0.02698267007206571 "
-"1405,0.08775098447460504 "
-"1404,0.0787358740223556 "
-"1407,-0.02511793594634371 "
-"1406,0.014304501741173892 "
-"1401,0.05486842815760608 "
-"1400,0.08722489919746902 "
-"1403,0.09819136668974893 "
-"1402,0.05900723645077392 "
-"1397,0.05203887491914832 "
-"1396,0.08816028685002615 "
-"1399,0.02257784278475029 "
-"1398,0.011107738449634762 "
-"1393,0.06750468197914228 "
-"1392,0.02050977963964964 "
-"1395,0.07734181372991573 "
-"1394,0.02817919904097723 "
-"1388,0.04150877873614092 "
-"1389,0.07102076612083308 "
-"1390,0.03486018667868617 "
-"1391,0.037795684585729634 "
-"1384,0.024263354320639537 "
-"1385,0.030820857643692908 "
-"1386,0.029443799247337518 "
-"1387,0.0849472433807709 "
-"1380,0.08153206835789857 "
-"1381,0.052091979925380394 "
-"1382,0.01719271035744913 "
-"1383,0.02635294723197123 "
-"1376,0.08810634920436268 "
-"1377,0.07837229522584523 "
-"1378,0.09352284285589683 "
-"1379,0.07303462116313517 "
-"1307,-0.038047062892014365 "
-"1306,-0.02098434469790756 "
-"1305,-0.04221655681120846 "
-"1304,-0.03713975188468147 "
-"1311,0.016116518253057533 "
-"1310,-0.0628147456566315 "
-"1309,-0.07314080152476808 "
-"1308,-0.0293370029964073 "
-"1299,-0.03569437641541893 "
-"1298,-0.05388469737609968 "
-"1297,-0.042555268848532585 "
-"1296,-0.04823092315599767 "
-"1303,-0.04286957891944828 "
-"1302,-0.004749303258986937 "
-"1301,-0.004671625602237391 "
-"1300,0.054505616570636635 "
-"1290,-0.03395829027449506 "
-"1291,0.042345172923876045 "
-"1288,0.025414104473920913 "
-"1289,0.037323934794733164 "
-"1294,-0.05716443063700491 "
-"1295,-0.07761985131663074 "
-"1292,0.0017126444797324275 "
-"1293,-0.0140611188121496 "
-"1282,0.09810293040014798 "
-"1283,0.029495728478814435 "
-"1280,0.014842081392581783 "
-"1281,-0.00871938123168936 "
-"1286,0.014638518600089046 "
-"1287,0.01741120127553747 "
-"1284,0.016947408865975438 "
-"1285,0.003561153694882679 "
-"1337,-0.029666381695924122 "
-"1336,0.0011941050295664784 "
-"1339,0.02420919871385881 "
-"1338,0.03248071789525166 "
-"1341,-0.05437567587736952 "
-"1340,0.018036259230222052 "
-"1343,-0.05508054501087427 "
-"1342,0.020806379202639242 "
-"1329,0.06654450035401997 "
-"1328,0.0384759517842854 "
-"1331,0.030113076909424746 "
-"1330,0.008183883815002905 "
-"1333,0.02931909411352109 "
-"1332,-2.2004680396106225E-4 "
-"1335,-0.010047205728826527 "
-"1334,0.0013347749602660081 "
-"1320,-0.09118910010942557 "
-"1321,-0.045349832170140825 "
-"1322,-0.05924303004860717 "
-"1323,-0.04164253048063017 "
-"1324,-0.05277670404437997 "
-"1325,-0.06092943186763444 "
-"1326,0.02349593540395798 "
-"1327,0.055734719191883775 "
-"1312,-0.027325362732666923 "
-"1313,-0.02281170983149662 "
-"1314,-0.06203215274671967 "
-"1315,-0.07216780011479315 "
-"1316,-0.06573566093872073 "
-"1317,0.0011427289105249028 "
-"1318,-0.038240787349496624 "
-"1319,-0.09192726982548403 "
-"1494,-0.05822103059637337 "
-"1495,0.029668546814003563 "
-"1492,-0.04539105082091353 "
-"1493,-0.02778364018674272 "
-"1490,0.024112999922445102 "
-"1491,-0.05827867647308197 "
-"1488,-0.08234822967733449 "
-"1489,-0.042261164001899214 "
-"1502,0.01631936036111976 "
-"1503,0.002771502061787286 "
-"1500,-0.039219198741051176 "
-"1501,0.00767338353004308 "
-"1498,-0.052149105218268814 "
-"1499,-0.026940922722951555 "
-"1496,-0.0047572464502777636 "
-"1497,0.01778176090967447 "
-"1479,-0.057735288847658765 "
-"1478,0.007813312264248732 "
-"1477,0.041396670756342735 "
-"1476,0.02342071942946955 "
-"1475,-0.05146925687632311 "
-"1474,-0.051784314744714253 "
-"1473,0.011962472541088405 "
-"1472,-0.0056136159579240055 "
-"1487,0.013704864776394555 "
-"1486,-0.023011651491812845 "
-"1485,-0.01182234965320937 "
-"1484,0.002562604199201778 "
-"1483,-0.031481837799989164 "
-"1482,-0.05260082087665725 "
-"1481,0.02979420863082137 "
-"1480,-0.04412745579537329 "
-"1524,-0.0505303428947886 "
-"1525,-0.03224231646155538 "
-"1526,-0.017813700941924755 "
-"1527,-0.04209105256597075 "
-"1520,-0.008312758105762657 "
-"1521,-6.64615365879106E-4 "
-"1522,-0.04254627625250674 "
-"1523,-0.03989282716340575 "
-"1532,-0.0613620223953188 "
-"1533,-0.0863841640848614 "
-"1534,-0.03267595696829311 "
-"1535,-0.04839999838385506 "
-"1528,-0.017433064455393735 "
-"1529,-0.028323373087683026 "
-"1530,-0.04750867975937367 "
-"1531,-0.0065179391975195445 "
-"1509,4.3577337286224605E-4 "
-"1508,-2.2733172844105264E-5 "
-"1511,-0.018067645922187594 "
-"1510,-0.05218156468886111 "
-"1505,-0.030358034567840007 "
-"1504,-0.005645287656881207 "
-"1507,0.006775772721717606 "
-"1506,-0.01693247918792155 "
-"1517,-0.01472883376755915 "
-"1516,-0.029711198449317393 "
-"1519,0.0036753313110818773 "
-"1518,-0.03450349107089164 "
-"1513,0.019344519705974453 "
-"1512,-0.06236928756203702 "
-"1515,-0.017036122155892685 "
-"1514,-0.02098744011835874 "
-"1426,0.1017318899395874 "
-"1427,0.06845929425978468 "
-"1424,0.040797138555299504 "
-"1425,0.06839576919983109 "
-"1430,0.04981841536429327 "
-"1431,0.06453050473260638 "
-"1428,0.11385464122973951 "
-"1429,0.054945117713657184 "
-"1434,-0.012785287158635932 "
-"1435,0.027112178667483493 "
-"1432,7.471375156263334E-4 "
-"1433,-0.017557633724623153 "
-"1438,0.06169469617010478 "
-"1439,0.0822970779109715 "
-"1436,0.010092942975303243 "
-"1437,0.03432831746730882 "
-"1411,0.008608638713554882 "
-"1410,-0.025577765880979066 "
-"1409,0.044594563369123534 "
-"1408,-0.03206215057007763 "
-"1415,0.05108772581582938 "
-"1414,0.0722432651169995 "
-"1413,0.05275333955265944 "
-"1412,0.07799192092872365 "
-"1419,0.0132063867904901 "
-"1418,0.06014796449438088 "
-"1417,-0.009166474404971698 "
-"1416,-0.03169183716577759 "
-"1423,0.034367005396612346 "
-"1422,0.06378199321972823 "
-"1421,0.07168954312180142 "
-"1420,0.028944750728268003 "
-"1456,0.011790109622450298 "
-"1457,0.0018563589376547475 "
-"1458,-0.01599465482125056 "
-"1459,0.015949923558837634 "
-"1460,-0.017834553344867363 "
-"1461,0.009428677480382395 "
-"1462,-0.023778634244065792 "
-"1463,0.009894799131522667 "
-"1464,0.025479651177121504 "
-"1465,-0.04055643168837989 "
-"1466,-0.011375206647724335 "
-"1467,-0.08683907485968359 "
-"1468,-0.03687860010392081 "
-"1469,-0.0475706053684137 "
-"1470,0.028110582274918944 "
-"1471,-0.0178162116193858 "
-"1441,0.057253611306374526 "
-"1440,0.060990929837856436 "
-"1443,0.03315834359744337 "
-"1442,-2.936989773497541E-4 "
-"1445,0.05280841828205785 "
-"1444,0.04428349649763493 "
-"1447,0.0015337359006265725 "
-"1446,0.0680287197676135 "
-"1449,0.03858556423572122 "
-"1448,-0.04763952380898406 "
-"1451,-0.02612160784489234 "
-"1450,0.03935582309187596 "
-"1453,-0.05340667912776836 "
-"1452,-0.01903388792700827 "
-"1455,-0.012733955972751287 "
-"1454,0.05782895571964873 "
-"1642,-0.013516132624610568 "
-"1643,-0.021262662935783227 "
-"1640,0.04648997984538887 "
-"1641,-0.04054050270479543 "
-"1646,-0.07216506954303292 "
-"1647,-0.0449192136917221 "
-"1644,-0.017670929904524246 "
-"1645,0.0028587103818606165 "
-"1634,-0.03568813733336882 "
-"1635,0.028126833002188583 "
-"1632,0.026502517833243346 "
-"1633,-0.05526565313734021 "
-"1638,-0.08643900618476054 "
-"1639,-0.05847192783808189 "
-"1636,0.05806287116098972 "
-"1637,-0.004369037299568298 "
-"1659,-0.04349468913685991 "
-"1658,-0.011666090453587259 "
-"1657,-0.06423419060908259 "
-"1656,-0.04790382205657435 "
-"1663,-0.047476138769091326 "
-"1662,-0.06605923425610317 "
-"1661,-0.08104226571983243 "
-"1660,-0.012343925371349195 "
-"1651,-0.07114321710047719 "
-"1650,-0.028073297600178276 "
-"1649,-0.04644881028626087 "
-"1648,0.03406902691030074 "
-"1655,-0.058314775293515184 "
-"1654,-0.014302032560728394 "
-"1653,-0.016647989513715607 "
-"1652,0.022864272206959534 "
-"1608,-0.05277752786600711 "
-"1609,0.0043320995487587345 "
-"1610,-0.007141767825028041 "
-"1611,-0.022214076632552555 "
-"1612,-0.03757129388004899 "
-"1613,-0.0376785252395109 "
-"1614,0.0038348199835944105 "
-"1615,-0.029433520764371713 "
-"1600,0.04119945279959438 "
-"1601,0.020179397667319906 "
-"1602,0.017089652038427956 "
-"1603,-0.032357753740524756 "
-"1604,-0.02373969846448136 "
-"1605,-0.007079787007448442 "
-"1606,-9.847678489541545E-4 "
-"1607,0.019234655327062044 "
-"1625,-0.05433897604966886 "
-"1624,-0.050767925196831314 "
-"1627,-0.0567217945087556 "
-"1626,-0.05347576544332472 "
-"1629,0.0171170494602865 "
-"1628,-0.05078724677970489 "
-"1631,-0.015076073143619195 "
-"1630,-0.030379751146877538 "
-"1617,-0.061244795674401845 "
-"1616,-0.038091020991611206 "
-"1619,-0.03514919056049605 "
-"1618,-0.061866020362912694 "
-"1621,-0.02127636192028812 "
-"1620,-0.0721241839234125 "
-"1623,-0.03522649495385283 "
-"1622,-0.03490891636807941 "
-"1582,-0.0028747343698626144 "
-"1583,0.020905067844791604 "
-"1580,-0.017374684424257172 "
-"1581,0.0491909481670027 "
-"1578,0.027513628639472303 "
-"1579,-0.04739607226946191 "
-"1576,0.09188549050921622 "
-"1577,0.08381474025640785 "
-"1574,0.006677351752116402 "
-"1575,0.05924352463484781 "
-"1572,0.05381710704898666 "
-"1573,-0.03547853060144756 "
-"1570,-0.0730183889271682 "
-"1571,-0.046326011226159695 "
-"1568,0.08073558782190897 "
-"1569,0.003374006621209027 "
-"1599,-0.007348732858313164 "
-"1598,-0.03882632886991932 "
-"1597,-0.030061565476238852 "
-"1596,-0.03160462913147608 "
-"1595,-0.044481656488362574 "
-"1594,-0.07728061416120387 "
-"1593,0.0037330124446233216 "
-"1592,0.01879322354915591 "
-"1591,0.048058807178104054 "
-"1590,0.08266112305752038 "
-"1589,0.04526543667712681 "
-"1588,0.03971177429633543 "
-"1587,0.023103072500861403 "
-"1586,0.014592354224180941 "
-"1585,0.03827210903024501 "
-"1584,0.03700755556442373 "
-"1548,-0.04632484049059414 "
-"1549,-0.03649634663003607 "
-"1550,-0.01571710772248295 "
-"1551,-0.03802077131432067 "
-"1544,0.03485900406910957 "
-"1545,-0.007753940652783601 "
-"1546,-0.020818947676847926 "
-"1547,-0.02781780699184963 "
-"1540,0.019755330818474692 "
-"1541,0.024036939950299412 "
-"1542,0.03962926049078589 "
-"1543,0.04887659056608873 "
-"1536,-0.0646047055290148 "
-"1537,-5.014443945072896E-4 "
-"1538,0.045925011514488516 "
-"1539,0.041532460368095436 "
-"1565,0.04735988107705963 "
-"1564,0.06362778473647353 "
-"1567,0.09057278031074312 "
-"1566,0.058652421793348175 "
-"1561,0.06447407703743425 "
-"1560,0.09800200909003755 "
-"1563,0.028476505175232054 "
-"1562,-0.010076293983548151 "
-"1557,-0.034002722503161 "
-"1556,-0.0278916608493728 "
-"1559,-0.026060152436898115 "
-"1558,0.0036641924875022297 "
-"1553,-0.030227344628182367 "
-"1552,0.03415627935136438 "
-"1555,-0.01880899679673321 "
-"1554,-0.009065385389277137 "
-"1763,0.057137325110193836 "
-"1762,0.07220509683375491 "
-"1761,0.06137831874393375 "
-"1760,-0.022513488833726187 "
-"1767,0.05150397529078659 "
-"1766,0.04258139179631829 "
-"1765,0.053883756341893976 "
-"1764,0.047420923814902385 "
-"1771,0.05429221384439086 "
-"1770,0.046104292248654186 "
-"1769,0.06570231238045693 "
-"1768,0.05678459159239611 "
-"1775,0.08465721786946422 "
-"1774,0.0727836748481201 "
-"1773,0.05037560254407821 "
-"1772,0.033641142358501824 "
-"1778,-0.015624187928692404 "
-"1779,-5.51340602895596E-4 "
-"1776,0.09783570213317272 "
-"1777,-0.023325718341118632 "
-"1782,-0.007977583283598535 "
-"1783,-0.01326951445368309 "
-"1780,-0.06362978594895802 "
-"1781,-0.034846804922475334 "
-"1786,-0.007487254439409188 "
-"1787,-0.03544466578916607 "
-"1784,-0.0062370262162550275 "
-"1785,0.002602187133276143 "
-"1790,-0.020436505493727244 "
-"1791,-0.023496522354812893 "
-"1788,-0.03089946301728579 "
-"1789,-0.015064270774968535 "
-"1729,0.004394918510364035 "
-"1728,0.024959187034014105 "
-"1731,0.015382716213425211 "
-"1730,0.042545849808488835 "
-"1733,0.027916157082814325 "
-"1732,0.036070645957590915 "
-"1735,0.027745647367563867 "
-"1734,0.04887645114096407 "
-"1737,0.02741381524568974 "
-"1736,0.0668685886063833 "
-"1739,0.029738266208429735 "
-"1741,0.01659033330019099 "
-"1740,0.007074976363872501 "
-"1743,-0.01320752998018861 "
-"1742,-0.0069960055342197 "
-"1744,0.053150219839180224 "
-"1747,0.028555099136260448 "
-"1748,0.012690743701839974 "
-"1749,0.0070203651311574215 "
-"1750,-0.0038456825265310566 "
-"1751,-0.02011561730285461 "
-"1752,-0.022210128163545242 "
-"1753,0.01490443565808065 "
-"1754,0.002058329530726467 "
-"1755,0.027453239317060042 "
-"1756,0.018974139136866425 "
-"1757,0.01756820150116343 "
-"1758,-0.0072365597715203294 "
-"1759,-0.03699738753438178 "
-"1703,0.04975364881851881 "
-"1702,0.03111598577545405 "
-"1701,0.04309202557032709 "
-"1700,0.016956688905246396 "
-"1699,0.019977115545067103 "
-"1698,0.0253010824839262 "
-"1697,0.03419573746025433 "
-"1696,0.019544756869059567 "
-"1711,0.022624614670787555 "
-"1710,0.013753938040731512 "
-"1709,0.029173583922936203 "
-"1708,0.013333482144407835 "
-"1707,0.03613383758103249 "
-"1706,0.03903930803883627 "
-"1705,0.04635144781097358 "
-"1704,0.03594773512770843 "
-"1718,0.012417747077642788 "
-"1719,0.039820262339957196 "
-"1716,0.04544563393987076 "
-"1717,0.0087716303340873 "
-"1714,0.05856815891699551 "
-"1715,0.025320602141061785 "
-"1712,0.04837564347847174 "
-"1713,0.05126660850341336 "
-"1726,0.015620716769650676 "
-"1727,0.012501264181598973 "
-"1724,0.036380803199274205 "
-"1725,0.03259991941260677 "
-"1722,0.018334446716450216 "
-"1723,0.08443434003822246 "
-"1720,0.058490287730207195 "
-"1721,0.04399566973615661 "
-"1669,-0.0018267896145968217 "
-"1668,-0.052223094729212646 "
-"1671,-0.043760232185101645 "
-"1670,-0.047840282088789834 "
-"1665,-0.04901340771681348 "
-"1664,-0.029272916499260854 "
-"1667,-0.05050342184641798 "
-"1666,-0.03951512487771977 "
-"1677,0.12626344386955476 "
-"1676,0.10596008504660775 "
-"1679,0.064149313585366 "
-"1678,0.03096114201205629 "
-"1673,-0.041898001669759724 "
-"1672,-0.04866330134428434 "
-"1675,0.18080536055411225 "
-"1674,-0.059937675031759785 "
-"1684,0.04583672014106752 "
-"1685,0.05855159095196367 "
-"1686,0.06418122329594234 "
-"1687,0.0528812575259326 "
-"1680,0.07532803170918581 "
-"1681,0.05309336889280403 "
-"1682,0.04102337861093615 "
-"1683,0.04066479965812105 "
-"1692,0.05582861621414569 "
-"1693,0.051001688820723826 "
-"1694,0.05942111171295918 "
-"1695,0.046995464695278946 "
-"1688,0.09554712927422124 "
-"1689,0.08090944265091378 "
-"1690,0.04591124017921673 "
-"1691,0.025103188812446733 "
-"1913,-0.02870078386912269 "
-"1912,-0.03813182559492526 "
-"1915,-0.04620341632843284 "
-"1914,-0.08270613164163224 "
-"1917,-0.0442132455023816 "
-"1916,-0.05528271952864918 "
-"1919,0.013345669534844158 "
-"1918,0.017067913357331824 "
-"1905,0.07289865760056338 "
-"1904,0.024241613319915156 "
-"1907,0.013724736043555117 "
-"1906,0.053961177352624255 "
-"1909,-0.06356535969876943 "
-"1908,-0.07847143210048568 "
-"1911,-0.03232055082816688 "
-"1910,-0.043119831042946484 "
-"1896,0.04094886563149578 "
-"1897,-0.022194951868517464 "
-"1898,0.009699998238242122 "
-"1899,0.03825345528625408 "
-"1900,0.026965169646660347 "
-"1901,0.022519056498881463 "
-"1902,0.03365427549751735 "
-"1903,-0.046320053105276635 "
-"1888,-0.034252539215763676 "
-"1889,-0.05625256369961331 "
-"1890,-0.041594803333875205 "
-"1891,-0.015667484531964843 "
-"1892,-0.02296441671040103 "
-"1893,-0.048595256967999594 "
-"1894,-0.029425593713972492 "
-"1895,-0.039741423297137084 "
-"1883,0.02274662841094908 "
-"1882,0.014402977608943338 "
-"1881,0.02648479872945902 "
-"1880,-0.006140547407405092 "
-"1887,0.027129104641710783 "
-"1886,-0.03294316813948855 "
-"1885,-0.030210667707417073 "
-"1884,-0.036853852122818595 "
-"1875,0.009020799652558968 "
-"1874,-0.008208422578658827 "
-"1873,0.013823252551110807 "
-"1872,-0.021906344465158243 "
-"1879,-0.012987644159519482 "
-"1878,0.017493423411491776 "
-"1877,0.02738519892896237 "
-"1876,0.053889046991277424 "
-"1866,0.007951883595464245 "
-"1867,0.010488963447290072 "
-"1864,-0.05132010456120794 "
-"1865,0.011104472504080655 "
-"1870,0.05465354949522765 "
-"1871,-0.015871083275913203 "
-"1868,0.025633420696203134 "
-"1869,0.04235100927343539 "
-"1858,0.015569063743535328 "
-"1859,0.008811673429480412 "
-"1856,-0.011109400015843743 "
-"1857,-0.0036306357415500953 "
-"1862,0.04138968431885151 "
-"1863,-0.022595173721014584 "
-"1860,-0.004650418348978827 "
-"1861,-0.0019125816945030625 "
-"1853,-0.015339037845355879 "
-"1852,0.03416418212257788 "
-"1855,0.009727794680791785 "
-"1854,0.0010349422262152645 "
-"1849,-0.025060976190132016 "
-"1848,0.024310820417230632 "
-"1851,0.03810560569031143 "
-"1850,-0.001510330332598438 "
-"1845,0.12616103348523713 "
-"1844,0.06751812374659608 "
-"1847,0.007340829656927825 "
-"1846,0.11323798955506646 "
-"1841,0.03663425307296854 "
-"1840,0.08091314636663169 "
-"1843,0.05467945960103556 "
-"1842,0.010201338550905043 "
-"1836,0.03980172093810433 "
-"1837,0.04422207561503064 "
-"1838,0.05299126249461622 "
-"1839,0.09854198185704538 "
-"1832,0.08172795832824903 "
-"1833,0.08855808541659616 "
-"1834,0.05193740089986691 "
-"1835,0.06460203872958475 "
-"1828,0.002791485006238851 "
-"1829,0.019834300145797453 "
-"1830,-0.013992865537473198 "
-"1831,-0.022572514102215946 "
-"1826,0.02486421756761402 "
-"1827,0.019859464647367153 "
-"1822,0.017722100754102483 "
-"1821,0.04018586937592687 "
-"1820,0.01858149106716321 "
-"1819,0.02489010882480114 "
-"1818,0.02796155688847391 "
-"1817,0.053572308542632646 "
-"1816,-0.035700298844132124 "
-"1815,-0.04147851003154955 "
-"1814,-0.0032934261610068605 "
-"1813,-0.03383005765596558 "
-"1812,-0.03821012824058713 "
-"1811,0.017210579348190334 "
-"1810,-0.0052887123367731294 "
-"1809,0.019883586013478963 "
-"1808,-0.03204793452855613 "
-"1806,-0.007607993834786281 "
-"1807,-0.0462100543268485 "
-"1804,-0.03241134453853386 "
-"1805,-0.023133303594425576 "
-"1802,0.01529604262277411 "
-"1803,0.011251018550365931 "
-"1800,-0.013902863471270191 "
-"1801,0.02185110126219133 "
-"1798,-0.012577196146530556 "
-"1799,-0.028982900762336332 "
-"1796,-0.02907537562712478 "
-"1797,-0.005003076941779314 "
-"1794,-0.08748797013450005 "
-"1795,-0.049339951054084716 "
-"1792,0.0030344668015961705 "
-"1793,0.008288345995431925 "
-"2032,-0.06813030739819861 "
-"2033,-0.05622026560634024 "
-"2034,-0.03735947554108809 "
-"2035,-0.05017569648305658 "
-"2036,0.03931986517712213 "
-"2037,0.007267767221376991 "
-"2038,-0.03855337016332199 "
-"2039,-0.025368993813374655 "
-"2040,-0.0010272193756863683 "
-"2041,0.008260384791855372 "
-"2042,0.0010455674861538753 "
-"2043,-0.02279572319420591 "
-"2044,-0.006119239073604253 "
-"2045,-0.03716126478398527 "
-"2046,-0.019835593289771462 "
-"2047,0.010104616130191391 "
-"2017,-0.024711314150175353 "
-"2016,-0.021995722024815423 "
-"2019,-0.041776854706797865 "
-"2018,0.0023347336146059875 "
-"2021,-0.06430195100224198 "
-"2020,0.04597663275271223 "
-"2023,-0.026122323322902277 "
-"2022,-0.04182701700259763 "
-"2025,0.08083553490932885 "
-"2024,-0.005723940448104608 "
-"2027,-0.0458257505387525 "
-"2026,0.09289010246878596 "
-"2029,1.252818550726806E-4 "
-"2028,-0.02285909608092597 "
-"2031,-0.011517636124519243 "
-"2030,0.03225510137995382 "
-"2002,0.00917781809467497 "
-"2003,-0.02701946133010099 "
-"2000,0.05087557924165699 "
-"2001,0.048945844645351726 "
-"2006,0.0222789830035091 "
-"2007,0.03512657353743509 "
-"2004,-9.766761891753682E-4 "
-"2005,0.008961989735083147 "
-"2010,-0.006542078258807564 "
-"2011,-0.027568570164724263 "
-"2008,0.005836989045884744 "
-"2009,-0.027317060228472072 "
-"2014,-0.04234963763238233 "
-"2015,-0.03633649340428962 "
-"2012,-0.05153747901775723 "
-"2013,-0.005867774423626416 "
-"1987,0.04142621026168701 "
-"1986,0.010714708297296078 "
-"1985,0.002100304155894238 "
-"1984,0.0449319581506138 "
-"1991,-0.02975983077565631 "
-"1990,0.03573961000026774 "
-"1989,0.022214165106938615 "
-"1988,0.03741785066261834 "
-"1995,0.029051170834690308 "
-"1994,0.04613188530294165 "
-"1993,0.016517403517889252 "
-"1992,-0.01573729742808912 "
-"1999,-0.0020022788577150055 "
-"1998,0.03188160248576958 "
-"1997,0.03726649482140757 "
-"1996,0.012566908594202978 "
-"1972,-0.013908144982858597 "
-"1973,0.006722295198325225 "
-"1974,0.03584593087261663 "
-"1975,-0.007171222473391572 "
-"1968,0.02843171406498146 "
-"1969,0.055419387186744135 "
-"1970,-0.031751584100460604 "
-"1971,-0.02854640469077387 "
-"1980,-0.021451685841063866 "
-"1981,-0.0034948023971093597 "
-"1982,-0.0038596213547673758 "
-"1983,0.05118565091502217 "
-"1976,0.01980294706099186 "
-"1977,0.0296977107969931 "
-"1978,0.04079819045384915 "
-"1979,-0.009458502092790751 "
-"1957,0.020952131020357753 "
-"1956,-7.176003457410586E-4 "
-"1959,0.008457762585549982 "
-"1958,0.0012549461130460363 "
-"1953,0.03800431705223756 "
-"1952,0.01398027274311412 "
-"1955,0.03566796333710245 "
-"1954,0.020041600303011345 "
-"1965,0.047715414401100345 "
-"1964,0.030045178301504574 "
-"1967,0.03239344141728169 "
-"1966,0.028545343381191718 "
-"1961,0.05288344863436481 "
-"1960,0.018209223447133428 "
-"1963,0.010628901378837636 "
-"1962,0.046522656016439116 "
-"1942,0.0791140376075904 "
-"1943,0.04202076356992625 "
-"1940,-0.014636915944464136 "
-"1941,0.06917006756196778 "
-"1938,-0.011094727135906746 "
-"1939,-2.838132381874041E-4 "
-"1936,-0.03591828794248421 "
-"1937,-0.008547971356920626 "
-"1950,0.009421361424930014 "
-"1951,0.020755443730262908 "
-"1948,0.10534699107550174 "
-"1949,0.021862244572765945 "
-"1946,0.07113836984738646 "
-"1947,0.031096213543710165 "
-"1944,0.06107554830345548 "
-"1945,0.042229985397844616 "
-"1927,-0.01781284710187362 "
-"1926,-0.004061716885902599 "
-"1925,-0.009384489538467435 "
-"1924,-0.013474928377567476 "
-"1923,-0.03656648970345727 "
-"1922,-0.03633907127849818 "
-"1921,0.0017344516138185534 "
-"1920,0.022414160222360226 "
-"1935,-0.04042393990378021 "
-"1934,-0.06032417792926133 "
-"1933,-0.04681391486853574 "
-"1932,0.005097843666281454 "
-"1931,-0.002691132671156104 "
-"1930,-0.019326107597130767 "
-"1929,-0.057892891019431576 "
-"1928,-0.01744537426093878 "
-"0,0.004840715912585551,-0.010424259813660679,0.0059812353285258425,0.009950242154963918,-5.125161279501135E-4,6.53493015802173E-4,0.0021519409202473668,-0.0161208644898635,0.009168471663835994,0.0021978299562927725 "
-"1,-0.010338765311749869,-3.35863021000052E-4,0.0033766700191334496,0.0076306230916654075,-0.01362343660382321,0.01907254836965299,0.008484914609284301,-0.018942130473330127,0.010609160494305186,0.008645858843534674 "
-"2,0.10798716399297975,0.11203297124933127,0.10779697569356121,-0.11647907809343662,0.10059793293498787,0.10387495072473363,-0.021237796425719397,-0.042187151163773286,-0.20667227494855062,0.14498195754880275 "
-"3,-0.019784705393618058,0.007367937068515709,0.019402025518050106,-0.03323192319557583,-0.011014449885554719,0.04427192106450429,0.001263008389385975,0.015066363573151957,0.009145426604221008,-0.007315588899645081 "
-"4,-0.012839952428633108,0.009918754818595313,-0.008164074486497553,0.006422180765041738,-0.010327946799604167,0.01518210214467495,-0.008680326514448949,-0.00296383308755184,0.010469671195648912,0.01642515921225322 "
-"5,-0.11359880147012329,-0.04434842571514103,0.01855766098444471,0.17074394534675588,-0.1041110026168367,0.007301382132389278,0.014594224902176527,0.0764114366528255,0.03508620377861354,0.0010747887823789552 "
-"6,-0.023474044866424695,0.08047447049571493,-0.033780809790023215,0.027397251535087586,0.02260458363594278,-0.006040266775986433,-0.02992475229035604,-0.05826894068528439,0.10384806823285192,0.03793419017152103 "
-"7,-0.006724314183155895,-0.003252329798426285,0.013626097912670151,-0.03362663669032102,-0.06067748706639167,0.020632807159932806,-0.0014550734991603035,0.03239439189971242,-0.0058410276795799725,0.04110518569670427 "
-"8,0.09230303886906643,-0.05826289181399044,0.03796991314127315,0.06711974866436407,-0.047063363466511625,-0.06738718915723689,-0.06582515706379588,-0.09288972458584642,-0.11082744746914087,-0.043833855774433175 "
-"9,-0.015010472018814936,-0.02654616599199026,-0.0452247338461454,1.2906067221907073E-4,0.1163788722107306,-0.041323639683188404,0.10011223079027003,-0.014287177014378035,0.020993302208776137,-0.056686292280804566 "
-"10,-0.073522570702932,0.07905934832499868,-0.061653596928390224,0.09326090982079394,0.07218380024114156,0.04526089787305425,0.03035798651317862,0.1278039971189991,0.03711177430340277,-0.11344777886113161 "
-"11,0.007468031905761105,-0.009131678713306387,-0.011254317623421405,0.010209191693946395,-5.837032180734371E-4,0.0039380793555975355,0.013388946011754006,0.014305382342455316,0.01226271807029128,-0.03962466274223709 "
-"12,0.0025081714170067547,0.002582960596150814,-0.018224821461316414,0.029616598660067217,-0.02669931727991623,0.009006994357450154,0.008423983423874291,0.007106966362633942,0.010034380615367799,0.010969172077802233 "
-"13,-0.027483295336835176,0.023066024155990784,-0.012610137040216964,0.06346709361223617,0.019715156768559065,0.05303118808338145,0.0012548054497634822,0.008288560735027617,-0.011781044710324139,-0.03616580740515764 "
-"14,-0.01892136033069443,0.02448935447160605,-0.002308777961420247,0.014470918918398652,6.336740919575799E-4,-0.013805326667938357,0.016183062144723735,0.051027092767571,-0.013428498616621676,0.003661265587923731 "
-"15,-0.03146362454927564,-0.01468365384838675,-0.05493895262913416,0.004746042303585347,-0.017910575066576243,-9.27019026300079E-4,-0.046011114313462435,0.01846107807083994,0.029278443429557408,-0.011153629519514277 "
-"17,6.417858129128295E-4,-0.05581521895701492,-0.047672387948935725,0.024491216536890358,0.09325097325880494,-0.08843058045958642,-0.028007180669477803,-0.10183716025225478,0.03408721923552825,0.006559995962196028 "
-"16,-0.11017662217184307,0.11611471654950442,-0.03455239765791468,0.05700128434697541,-0.057627115286276974,0.11160278138796485,-0.009432150142752957,0.10282365057777137,-0.09433659101547828,-0.05910417192654762 "
-"19,2.075676761861273E-4,-0.050205995851656214,-0.06430039504389481,-0.03424127293031972,0.08394974885194312,0.0271655608504779,0.030543832653898238,0.006922535724244048,0.02331268876252788,-0.10661169472008518 "
-"18,-0.09549298653265458,-0.12227607143082553,-0.028958835940105458,-0.02574369058058839,0.05657076059625528,-0.0382846245048178,-0.011009521978665941,0.08928528298250174,-0.18128872116346226,0.02366431041008819 "
-"21,-0.01755325956113324,0.02338126272889981,-0.015396305542935536,-0.001746932413170419,0.05135153124975171,0.022183003297107,-0.014754709963085647,-0.03034553943682112,0.004109709858628021,7.434303337009901E-4 "
-"20,0.007461222473019564,-0.057386757636113575,-0.0012692320578434537,-0.10604302544654695,0.08750625238746429,-0.04184289685397028,0.07458602725568612,-0.13100036218409492,0.029971629082835582,0.03973434105512041 "
-"23,-1.4763518964024943E-4,-0.0048989199831086785,-0.022329787677114056,0.008452557626562116,-0.024100324046707453,-0.03866374178662231,0.052022461844087514,-0.030197753004690773,0.006416189468251116,-0.023768977427006573 "
-"22,-0.01434297667928312,0.05342440087360056,-0.0280923042453874,-0.08643106446277596,0.032242340683489946,0.024058577994084118,-0.054455402975603945,0.022235173268490723,-0.04367278947922603,-0.06329022359058968 "
-"25,0.021593859903974073,-0.008643367220184035,0.016484211775859927,0.008534760317754688,0.02692883574964557,-0.007167642362216809,-0.026924696697407977,-0.015330212921022213,0.03361705616302292,0.035985238910469904 "
-"24,0.023433456184248965,-0.037632380989227575,-0.002636427158339785,0.03007317383388743,-0.0024339195556994327,-0.013323706764567055,0.043754213602743765,-0.032341536038448956,0.03731936716126459,0.04659292182870834 "
-"27,0.01388700491629974,-0.129266273721562,-0.027309822797932797,0.05583918737284816,-0.15686423352030807,-0.013730871056341827,-0.0671475201458623,0.22281278708242608,0.1288870755289351,-0.057571729899116277 "
-"26,-0.12396097522774989,-0.04838759792709876,0.1846169351088827,-0.20058408669579317,-0.2863033617873776,0.11828485878184851,0.055780754979091664,0.1722194044582421,0.04286454271900498,-0.058582732267537185 "
-"29,-0.08157428674779649,-0.04308799110044339,-0.04556096183143208,0.0304014471545683,-0.0803537712865659,0.004944791429559958,0.008277511566194364,0.14253244810695126,-0.07012746064997481,-0.011763698289032466 "
-"28,-0.052681399311137876,0.023486985849777913,0.03728748891584511,0.011526093889870416,-0.08507878737412267,0.11850427759584169,0.054097552146572796,0.07024161678081361,-0.03749806204017421,0.003752305537631553 "
-"31,-0.03144890030537811,0.04232178381826858,-0.02245168939837177,0.055011955336744814,-0.06630047258540779,-0.01334203375399589,0.01347386465125624,0.08133543374429585,-0.08291660529556422,0.01249885386138512 "
-"30,-0.025910519113230435,-0.005961026766133367,-0.03702737373406245,0.057227501477663055,-0.05145323201085645,-0.03848788210527203,-0.027531820784143797,0.07630745144491581,-0.05230596588525663,0.0017765534295099761 "
-"34,-0.012706292875331834,0.03771308320137129,-0.018863217936442318,0.019912473986506012,-0.04022201211872985,-0.01960553551109748,-0.009253933626786016,-0.0010809715203438128,-0.0513255000094462,0.016348355853736417 "
-"35,-0.006096519701549444,0.02940965275240204,-0.02797170069241402,0.008981558696687555,-0.025964937192590475,-0.013334642264588104,-0.0014128229486138572,0.011819272741893162,-0.056311148403075884,0.008560383706224778 "
-"32,-0.027479316239760614,0.027766131122403982,-0.025563916541046408,0.03499311711811649,-0.045436828870847275,-0.018599008733045555,-0.003508675949482729,0.027944253122715125,-0.07872718278277437,0.01461608975722409 "
-"33,0.007300513651403705,0.023557298671858025,-0.0639704906633368,0.017089360423346255,-0.05741240915794585,0.034111391333128564,0.006876412183445497,0.01812504459594891,-0.08247406338395809,0.04376989279325289 "
-"38,7.906141458596492E-4,0.017306247148876436,-0.020839462425065562,0.010923812373703847,-0.015207221542593307,-0.007499535734456249,5.221003208460765E-4,-0.020575854726556563,-0.029689551778723088,0.007755641923008345 "
-"39,8.800705916096845E-4,0.013122550043157244,-0.011316478084626661,0.0010947659053241782,-0.005866342674291632,-0.008013814065932942,-0.0022297891167167884,-0.014161009562921411,-0.03634823847941082,-0.0026322988548990564 "
-"36,-0.0015594447270463488,0.02285670999345614,-0.02182899542993637,0.008754617786611222,-0.020152581348572094,-0.009555697481116844,-0.0012752653762630665,-0.007214780128129486,-0.042450130184513046,0.004359077579141321 "
-"37,0.0022578958441132045,0.013528453530394063,-0.018834321791436133,0.011413879518634316,-0.012386623962980105,-0.009127997674126259,-2.4628723366892593E-4,-0.015123332496832072,-0.03516871155078311,0.005915193858765522 "
-"42,-0.029143143946125348,-0.02022298550146421,-0.003767438855227278,-0.006834750366944501,-0.001490649938359261,0.008501971665653047,0.01843190277955293,0.03603791949001696,0.006145360779113928,-0.02591672250927549 "
-"43,0.15665059678688847,-0.037016887220412714,0.05309805901356322,0.0944600638910404,-0.0013313099964387903,-0.0380706769811365,0.0777921882684548,0.04611209538360044,-0.14396032277072374,-0.05799911523816532 "
-"40,-0.002502189402181228,0.0131147559127856,-0.011016965952730624,0.0035871867680929877,-0.0024357158797430126,-0.014092274218910055,0.005492514051061372,-0.010997909167213988,-0.02410729623702821,-0.003003968241731374 "
-"41,-0.0013907513636524582,0.018121605568565593,-0.005988987929085254,0.0029090182973817193,-0.004091485361797661,-0.01001638480095782,0.009376086227239766,-0.026532879696153474,-0.01771536143949828,-0.004871460836565394 "
-"46,-0.031123791701898947,0.004770111650326629,-0.0815750785673882,0.056319450847280295,-0.05128616868779751,-0.0436899354556534,-0.0349131643173875,-0.010310965105196038,-0.05096725043042794,0.037174872230475435 "
-"47,-0.009035371605100945,0.03565292664307223,-0.020863823048539298,0.03800482037222116,-7.930561961398882E-4,-0.033289762016906733,-0.009469798710702852,-0.03392514183526299,-0.0484782874647561,0.011208551667324011 "
-"44,-0.09254961823282669,0.04281296860470068,-0.0662695467768093,0.029264286750066915,0.004427129215504747,-0.06945890919611487,0.04677403504592575,0.10142139466942061,-0.021078616618601685,0.14325126449667225 "
-"45,-0.009738817019927421,0.023573427893761798,-0.025810591603159613,0.055876820092863204,0.024952549087554034,-0.04579480159440948,-0.010493006288093135,0.06811990489759479,-0.08093035642532966,0.024437584905575786 "
-"51,-0.0073547919149859675,0.006094661975559454,6.125105431234477E-5,0.0169163696215306,0.0066474400558060405,-0.02466018381903369,-6.415804899199798E-4,-0.02028643336965927,4.92376991859528E-4,-0.006067163766863213 "
-"50,0.0157612766390277,0.005415241935558493,-0.01643997625947701,0.016832111135246998,-0.008261519064768193,-0.032111494004080435,0.005441746234206574,-0.04766006843399971,-0.01327012503890087,-0.004650049897667436 "
-"49,-2.813529146854773E-4,0.02494883727719566,-0.009527598751151303,0.015232853608704121,0.0026267616959645274,-0.027808335859523404,-0.011765144301250453,-0.03886981640480687,-0.015328751359179427,-0.0020848201407603034 "
-"48,-0.009158360303161122,0.015292794268619996,-0.023656311813285414,0.03722796526386252,-0.018957086492330813,-0.06050215903938439,-0.008913881030336322,-0.04085076116138853,-0.02428845860342565,-0.006862036214859405 "
-"55,0.002717278735357667,-0.004564720272466145,0.005663626832812079,0.007892262694887039,-3.2983362377303493E-4,-0.004956814352922836,0.004127424206856515,0.003280396327210475,0.007511980971849896,-0.010079082262097618 "
-"54,-0.007683273640347369,0.003057448268794101,0.006841402115589882,0.011300601362704405,-0.001565266062251232,-0.022002302545963186,0.006607308500559987,-0.007651758120766877,0.012326609552803283,-0.012058627336949436 "
-"53,-0.007602395827800724,0.001969039882657404,0.008084227765217571,0.0031291750120329667,-0.007626204414078349,-0.028808027733885796,0.002322692537363608,-0.011390386492031253,-5.164693590510961E-4,-0.011888249479685566 "
-"52,-0.007398380834285504,0.012329292630811632,0.0038939672551709997,0.019781598417032354,-3.0765053390281055E-4,-0.019897724275021813,0.0019714434645748576,-0.01913030842834288,-6.466066598690746E-4,-0.006060951271927754 "
-"58,0.0030295503944445783,0.003476064360702395,5.891448353572955E-4,1.431587761048183E-4,-0.0028378405315416235,-0.004192592705696569,-0.0018077608035133718,0.013270091509228199,0.007651094512933352,-0.0053744208881054455 "
-"57,-0.006008282408024337,-0.007058771739399252,-0.004712931031685336,0.0060368766818799015,-0.009238265137611572,-0.0019331675576604898,-1.6608943183174914E-4,-0.0026768585984249605,0.009715263323866071,-0.005242928358498017 "
-"56,0.004330611943024018,5.474782103498595E-4,-0.0074463198349474435,0.005191079732966096,1.426240557871542E-4,-0.013516271175484689,0.004131984946081289,-8.531292408167924E-4,0.0092606577820419,-0.0038689833455031824 "
-"63,-0.06310060414912891,-0.07182518298760837,-0.056824533994293755,0.07072753387232301,0.002218725892875211,0.07564042746647766,0.046729024471736214,-0.07586099399001246,-0.056248113293234626,-0.0842137250204712 "
-"62,0.04617973798332657,0.07350708148311985,0.0939489982014583,0.21700956559964146,-0.24329105727024614,0.09071526134060307,-0.3379450443822772,-0.052961642739861044,-0.2679287334160111,0.3492681963694394 "
-"61,-0.04258524889739602,0.08528582649446576,-0.10037941056525881,0.028447304318857596,0.15427122576735794,-0.05513705814674709,-0.03731716575537335,-0.005558405442857615,0.0363389193261474,0.060347934850758775 "
-"60,0.012448850679364442,0.01310189888084014,-0.025036849479305415,-0.01349523985723958,-0.0076952609566971805,-0.015542633357230096,-0.0073306321991569124,0.004371857308795489,-0.01522092187722233,0.007975374872821421 "
-"68,0.06879626340073848,0.005417572096549315,0.05597804328924214,0.05398995065082583,-0.040237735286289725,0.029289935670123578,-0.09095080765315611,-0.08114516201080005,0.016295832013242702,0.016905776280101127 "
-"69,0.03918315519771642,-0.007393664273614849,0.023544623620889302,-0.03791474890947383,0.007851957844906571,0.036813438133226774,-0.04275148430724421,-0.07119671497705073,-0.0035396341524973644,-0.01068232676494611 "
-"70,0.027503081256229498,4.4144892994064906E-4,-0.02821559307467891,0.0811389540650771,-0.019838175163991358,0.06281681894847507,-0.07182212709498914,-0.013262146417885373,0.04059835775193592,-0.01346680611342608 "
-"71,0.00268587959001957,-3.239974351677676E-4,0.006671493241232835,-0.0023224952601265344,0.008119154035345464,-0.006140057351595654,0.016368018481842037,0.006027757816397986,-0.0029611306261522036,0.0034715320526094505 "
-"64,0.027617403588858332,-0.01578360529962783,0.056878735420619476,-0.06016983489956437,-0.13558079956554617,0.004188954829187729,0.09749009640996087,0.11741632150906367,0.03394945764374947,-0.055718212998141455 "
-"65,-0.0368906826575262,0.06213116707418468,0.06958944914028364,0.031013840016681088,-0.008892240562294049,0.05402000489176009,-0.02378831357274612,0.008676903805706482,-0.029055095108860087,0.0820910115726149 "
-"66,-0.0338227204787279,0.05121878859461879,-0.01892896217894527,-0.013981194040680421,0.15337730613828562,-0.009209902219608514,-0.03597955717364012,-0.15129699577967648,-0.036819737322729626,0.08149177889731453 "
-"67,-0.02631876224037716,0.016013133107152775,-0.03006283478250471,-0.054393455491551494,0.04575389123416487,-0.018184261149391135,0.014846651930769353,-0.025106228279225797,0.049282221843304136,-0.012674469108042955 "
-"76,0.07995169241944083,-0.076148676956392,-0.1717649782049536,-0.04419480461461312,-0.04369050652523708,0.14634283190050165,0.07562134300474732,-0.05358088065791901,-0.018355489245334755,0.05982583225946031 "
-"77,-0.0050901574680889666,-0.002082898248366459,0.01687120110708151,-0.014247738593485703,0.0012495452306857423,-0.05196635077550295,-0.013195742271337924,-0.02703988877658249,0.017939005207633234,-0.010207504184613971 "
-"78,0.0012274465193703931,0.009339033590928162,0.02284696024085891,0.001072647975933767,0.022439584159986897,-0.020585867899086577,-0.012315381811975896,-0.013218021439278195,0.0025337996920064025,-0.006937198843782624 "
-"79,0.016590457981491332,0.0047513107814671,0.008920835923898638,-0.008040758274921938,0.04080269897742824,-0.007921277232769385,-0.00818900188250179,-0.008680494976511932,0.009428314548865425,0.014479732135724803 "
-"72,-0.024308018061177508,-0.014140703954750797,0.0858842539924878,-0.09581980787495427,-0.09414683273806337,0.029139758737496944,0.05388279361524293,0.09815526281243071,0.014163826460895857,-0.01199485376391986 "
-"73,0.03635847122411571,0.06243112197589677,0.038471567873040576,-0.020690801582952133,0.01432541080111688,0.06330925459299569,0.03797791722854376,-0.017940610792104683,-0.06450738086563276,-0.0405507020734416 "
-"74,-0.03175397548825186,0.0011726327903677728,-0.033578343680142834,0.053525573812971884,0.025534168958193063,0.014442816930062274,0.005850858169673108,0.036646272683929094,0.03219053906434306,-0.02802445210256789 "
-"75,-0.08852305670670771,0.006016092406665344,-0.03558853285613965,0.02166101312625371,-0.0337284796578415,-0.06628064335151605,0.03432853439180079,-0.05662531425688032,0.0029456184295019484,-0.02730391135865791 "
-"85,0.023250947398655082,0.01788478915171793,-0.021402788690528658,0.0024197559694033445,0.008762065954423278,-0.017195179649821587,-0.016936737667706123,-0.006174820492530332,0.023107456712527466,0.02338188867384164 "
-"84,0.009084144044970127,0.01784249337073073,-0.016539547102938628,0.026144305686809855,-0.00570771264502797,-0.022481253670805827,0.006916596359601718,-0.017771142756057873,0.007302357124270397,0.030223780740140965 "
-"87,0.015422691286989958,0.02139860114998968,-0.014039735359346587,-0.026427073015441005,0.04491316589385186,0.001183324249820479,-0.011212198979833828,-0.01117121079029774,0.028147788419489454,-0.0012342534076795325 "
-"86,0.010908758949214586,0.015973137322102215,-0.012915474803828741,-0.015392951558902494,0.021774422726898803,-0.016377341333015466,-0.01610881649916343,-0.0041238808395806835,0.036573109582352756,0.01908150173478531 "
-"81,0.00813359801027486,0.009178224256132027,0.00402063372186461,4.582053450626692E-4,0.024745084591169527,-0.009958973439398286,-0.013805990422484928,-0.01155193756811101,0.018157831382348718,0.012394481971442198 "
-"80,0.00195503963582951,0.009372955406512196,0.0028629196706923647,-0.0040640061623453665,0.02096087168417585,-0.001478485771426582,-0.002867633787901785,-0.007284729262346181,0.012140001063370298,-0.0023607356749006897 "
-"83,0.02546298419173118,-0.01777588513868456,-3.836880273010837E-4,0.05737036435245619,-0.06576199083289291,-0.05493555556575915,0.06670242323873575,-0.05670942515192391,-0.03414022484473222,0.021313066687233474 "
-"82,0.013510112805704275,0.004630469686494732,-0.004308303767466562,-6.164318122431926E-4,0.016379855968823638,-0.0016603369701549762,0.0045450159465763645,-0.0039279907876342,0.022240073418187546,0.009814295883235725 "
-"93,-0.028344434296106138,-0.1666779785537561,0.19922081714025452,0.012526530447015119,0.026906430899372558,0.10192009673406062,-0.027673399156688438,-0.10623273800109927,-0.05066444640470585,-0.10034011989923004 "
-"92,-0.049237273303516085,-0.1529527968948011,0.14565568253914166,3.960479689086749E-4,0.040616944028934135,0.11500472009438369,-0.04917482552597431,-0.060380778670592855,-0.02494848227654664,-0.05228350677536861 "
-"95,0.0061271854288091855,-0.001101307968536875,-0.025765000372917193,0.007253228884012156,-0.02081034907577957,0.015846400631000245,-0.007057636859397132,-0.07658567878971646,-0.035312140651168465,0.030057754188420684 "
-"94,0.021956427659625476,-0.08181388923403744,0.10950995008670555,0.009052016444960367,-0.025395971530678938,0.012705138072838186,-0.0139467861805697,-0.046956343370349575,-0.034822920453689586,-0.04019493020919825 "
-"89,-0.014064028122470425,-0.009381026853158173,0.0027833024286868188,-0.03230173018867639,0.05158134599720102,0.025312863801242425,-0.028798552824233783,0.0011995572278911929,0.019464365726675273,-0.01737734747578318 "
-"88,0.001358791834860318,0.006624897407321627,-0.006443782971349938,-0.02665793294822965,0.056557570271300484,0.0068882758332909,-0.017729579109541017,-0.004800490085774379,0.03251863711287613,-0.015335917337756121 "
-"91,-0.025238549201320074,-0.10819552799768026,0.0945902711924579,-0.020383840570165256,0.037038887044930066,0.09460383986574727,-0.048994132711175996,-0.03179734947491452,-0.010064717787844376,-0.03540001169854355 "
-"90,-0.02395111026403576,-0.04982881611524122,0.04675958226269778,-0.038970436921136324,0.03747735365196854,0.060053448216001344,-0.031759752912533475,-0.002686136076577915,-9.79584662714763E-4,-0.04034040470385451 "
-"102,-0.044074974068796985,-0.01287200443397828,0.06052644282372529,0.01763508111183071,-0.004951069266599835,-0.06950983150325955,0.021141740806724065,-0.024008528977452377,0.04139157871547639,-0.020845959445164507 "
-"103,-0.03170512000686905,0.02128816526162481,0.0281905454255157,0.005403861616132328,0.03931808741754621,-0.058818864198896155,-0.0032644020879073125,0.007815370155892037,0.005306495979820553,-0.01772977326703128 "
-"100,-0.0069238845053878045,-0.007697253378960143,0.03214163147617953,0.0016061541006013444,0.021236462241221825,-0.0299340311183964,0.0031172375289524917,-0.042421244279088145,0.01956666365150667,-0.02137742708996365 "
-"101,-0.023433835833665595,0.008961115404125334,0.019135815439642302,0.016270340665998938,-0.015519348623182992,-0.03423642484615157,0.008175395365033712,0.016768140285143108,9.168459370466858E-4,-0.012519560491203386 "
-"98,-0.002477846514524583,0.004128906706235404,0.016462428347038423,0.010638185601205687,0.01312812938244654,-0.03557263074837529,-0.014596191478909157,-0.04905613267770856,-9.826445721767855E-4,-0.011582475338460905 "
-"99,-0.00795537927889383,0.011264526812216074,0.0034145850887470986,0.0026899419297197052,0.0016827631286079829,-0.031938380937931915,0.002255193815993162,-0.05101613203264894,-0.0038444871480957207,-0.006537032641058816 "
-"96,0.0025249597225149895,-0.004279581302818278,0.003202957069223109,0.006426173175243278,0.024213128117294584,-0.021007979775503536,-0.016160565052085865,-0.04227542920146101,0.017056267704712913,-0.007157586873371011 "
-"97,-0.004608792071177397,0.009872316220252085,0.01796313521041846,-0.006330006412311906,0.013549489839796876,0.009346628269975666,0.004556704274823527,-0.03505479688709662,0.015056216443784364,-0.0021796820694830617 "
-"110,-0.008946212175908881,0.001058723117277628,-0.006055178858866389,-0.012564829047006912,0.025058048575573737,0.0033611894928032076,-0.014013567106373569,-0.035188741541880446,0.03184362988105283,-0.00999460523358618 "
-"111,0.016726174260010898,-0.014718291475431772,-0.01454977269958031,-0.008404444237221843,-0.003840650920064367,0.010975056052456467,0.003138245241435895,-0.011789599383878585,-0.013338078549126341,0.015427144562359307 "
-"108,0.00639736144782126,-0.00338196871926818,-0.014810940361565694,-0.011772898068572835,-0.021448165374704682,0.025466412119689596,0.003265640910073852,0.004423511558657608,-0.022916597937971957,0.008543380646644384 "
-"109,0.009062766524132718,0.0033530594640636606,-0.008707174071122077,-7.390907616353E-4,-0.011858884422108206,0.0034653161941301503,0.003726100617765449,-0.004833082950923716,0.0034961342999984824,0.00412932644171811 "
-"106,0.00502463130611962,-0.028858566622601584,-4.711299890530796E-4,-0.00202504696581882,0.006997739641720102,-0.012275214614393288,0.0070910630398634,-0.039318331859239275,0.02015753195445479,0.0018413108849128185 "
-"107,0.008394556274970683,-0.01742507148145126,-0.03655054201125849,-0.0061585706175161905,-0.0031475954367964263,0.028521122374301225,0.010332233606021644,-0.01233060977397886,0.0032586273151296663,0.010041551169956075 "
-"104,-0.044902696135994014,-0.0032168397295054335,0.07243649860093845,0.03798744859103776,0.02910293472375091,-0.09739374658396771,0.006288668498431302,-0.016268445836956677,0.02250010393793195,-0.03975448646365503 "
-"105,-0.032005080283938364,-0.01089293728158476,0.04693094620223364,0.03111445458829837,0.017297808685198493,-0.07165543668041748,-0.013615182843439133,0.0018955854380033972,0.035425192983181565,-0.0304018879289234 "
-"119,0.11541385906096668,-0.042078546847626255,0.059407493612186606,0.019478561940501297,-0.0050135455720252825,-0.001475943606173596,-0.01840845408698924,0.03575348430287433,-0.040507511306124164,-0.07150631335006323 "
-"118,-0.023272253584217764,-0.012035706337021607,-0.005966828962485815,-0.007514639242027941,0.0064340920559106075,0.033990390618123686,-0.004519113034842216,0.006142895795119186,0.0176743447142027,0.002870208421355809 "
-"117,0.01627694805756693,0.0010837282186064142,-0.009880750903854924,0.0026453077734665807,0.05766447763038933,-0.025173548539473442,0.0013182189553251657,-0.04203493964592463,0.020614576359706996,0.010249281848141107 "
-"116,-0.012648421182879281,0.02888936566211332,0.008184257285959975,-0.007675330697314366,0.024450223881244824,0.017804012646304847,0.015582751008548576,0.030417377931215798,-0.054646067690919495,0.019675640634040044 "
-"115,0.009139612393642822,-0.015315217019413569,-0.014751557189027788,0.04399637037864256,-0.0661116410022208,0.002356673493666091,-0.06717022336913915,0.029663586044155758,0.020578094924761484,-0.03167129697965925 "
-"114,-0.11508147805378575,0.034401559512340564,0.04995247765369151,-0.1228706911068263,-0.11610070284560926,0.12017677369626296,-0.002297280560980057,0.04255714848947577,0.03468554413967422,-0.007555572435259083 "
-"113,0.17489820282905158,-0.11477851752469727,-0.35800621421853923,-0.04678222580365817,-0.19434324537907458,0.36254286956142856,0.14232130641251559,-0.03251901671795204,-0.14850415583490756,0.1692965483748809 "
-"112,-0.018680522025101145,-0.0019699888368193696,0.0025160456269256023,0.0040128392934304785,0.019854290632687357,-0.0026227259660843126,-0.0013460706588432584,-0.00331663654173853,-0.0018469681552841437,-0.0025127588187415046 "
-"127,0.06941433838619018,0.050553626096352056,0.09448250289067792,-0.08940225859421598,0.1845719051144419,0.11695688718029931,0.17020136009765735,-0.10231659133500097,-0.17970037492888102,-0.24398201622960555 "
-"126,-0.05643118020188247,-0.08777840963131034,0.0469392070604456,-0.14718206562645725,0.1060772524196001,0.05746911716700245,0.06794397071503325,-0.10209287780886586,0.15402155700014208,-0.1605477641154282 "
-"125,0.02719798536770835,0.01910301348400447,-0.05091435698059231,0.04808147196909368,0.11456319221340559,-6.589350558574555E-4,-0.003828218149027193,-0.05667084982465422,0.03677394466367085,-0.034778469231574384 "
-"124,-0.04534697520685767,0.056749015645107946,-0.063212880701878,0.06866337459414194,0.0734187646430679,0.016212600356127864,-0.09749408867375739,-0.040303561163047605,0.03749186747712758,0.044828473578153324 "
-"123,0.03147861121168066,0.05296452471903547,-2.9107934439341973E-4,-0.011759129425030003,0.06655708800936282,-0.01662592614490404,0.03249369697149191,-0.008062967197840182,0.044391066243837485,0.010875903813762472 "
-"122,-0.0060885747764062624,0.008715333313279271,0.00503525631571876,-0.01171105048081813,0.030916259089528438,-0.005780912763996037,-2.357150839714678E-4,-0.015262603223663813,0.015161890407836314,-0.008552918290013582 "
-"121,-0.006001831934320625,0.002912854006526367,-0.013128309790193839,-0.013536228127970899,-6.258330849528732E-5,-0.012545673248971156,-0.023200800517572295,-0.04315624984120794,0.015157532746664554,0.0052482332647414195 "
-"120,-0.0222504015597781,0.022403202741159253,-0.010413992013379031,0.0110316285253621,0.03837866053085445,-0.03128110861800996,-0.004860884481986916,0.016475716246492918,6.402250425678304E-4,0.05594628910982861 "
-"2065,0.013891010040924958,-0.023948586568431206,-1.9682299517893898E-5,0.033185632575792566,-0.0704972706556743,0.0052431950618048034,-0.021443826863554456,0.025825567904060594,0.019002070470297016,-0.017053236604550846 "
-"137,-0.02972276831083007,0.015765948335850943,0.02555156565732899,-0.01612499985901735,-0.005790533800399461,0.04312753893441617,0.015926761007533905,0.0575937919672322,-0.07765930118381892,0.0022068743580573496 "
-"136,-0.0199445738895864,-0.028330695654541792,-7.382326082637774E-5,-0.020622064795397566,0.014361039748597397,0.036281068696779,-0.030279166052586466,0.07725697186134026,-0.061388037705136456,0.030794341112990918 "
-"2064,-0.025389303877614164,0.010126243491666203,-0.07244317857948106,-0.001571412771136561,-0.09554602612269897,-0.008513465416476273,-0.06743010452436765,-0.02239499253960048,-0.07013654683437531,0.05622471806218883 "
-"139,-0.04293513619151457,0.04063413132921415,-0.007836778294488634,0.046782179297988676,-0.07431893467617932,0.06710948371293429,-8.32044095842281E-4,0.09259954670066148,-0.06335886880031094,0.02156413512554044 "
-"2067,0.003660864049013447,-0.007227623013001912,0.015091394377909826,-0.008050011341648294,0.03708626691435466,-0.007998337062759328,-0.0010497973613759766,-0.035258253969020895,0.025707867349417778,0.013436603682381091 "
-"2066,-0.04219560530695935,-0.027578389814608688,-0.06897336207169111,-0.00532064646129134,0.015379777460984609,0.036167462401205684,-0.023181277994872043,-0.0392602291630991,0.08231139933447236,-0.03507776444580252 "
-"138,-0.06373520191899011,0.006335292595393874,0.045061553196284965,0.029238200543229467,-0.027159277290573644,0.07674083806166306,0.0013441045367463057,0.10194650526229573,-0.07187369346769457,0.02202201453122183 "
-"141,0.002711409054068466,0.012640076015234442,0.00844642972259068,-0.002434673445552608,-0.01190610129023336,0.014388212702667727,-0.002802537318363527,4.73639940784742E-4,0.005943018599918893,8.502852593924127E-4 "
-"2069,0.056225594757745107,-0.08046253928655,-0.0322854928046041,0.10783921163426993,-0.1503287869720523,-0.03770017994003754,-0.03561407972569577,-0.013626891353210708,-0.016013930831356472,0.004867179581587633 "
-"140,-0.028689581003954735,0.0674892021022625,-0.001567420664677872,0.026670721733851883,-0.06048616185484725,0.015795745660082402,-0.004664008905376882,0.05034259232054034,0.006031335421951709,0.029324921502808382 "
-"2068,0.0867128064662476,-0.059368431918079556,-0.06910206028678857,0.0059715934306415926,-0.08316115529651605,-0.036332766282714604,-0.09971634929579021,0.06186525292602789,-0.07478519529409115,0.03523340812524911 "
-"2071,9.693211151879735E-4,6.58979658180296E-4,0.007642566321150904,0.013496447025540412,0.008074213088360593,-4.575670709659772E-4,0.012427480523011469,0.007263752983674187,-0.002815093576916293,-0.01452803831455845 "
-"143,0.006898166473907389,-0.007923554749768606,-0.04603503678577369,0.040964877619240884,0.04394583776071589,0.01283528869825932,-0.0019255818982911806,-0.008390621976510554,0.027697275781050655,-0.0392554644507552 "
-"2070,-0.029619745534018704,-0.057644253344641926,-0.05992165538739357,0.20800101621326691,-0.0868292441899817,-0.048788689992256454,-0.10151115541288823,0.010999742731556128,0.09025962530014574,0.044500606330848055 "
-"142,0.020525567064130182,0.04129864262359442,-0.02634965676275115,-0.0032609962580805838,0.047209039879981686,-0.01620811502196384,-0.001771429989442324,-0.011877596305509526,0.028651595520537823,0.0029713016357956912 "
-"129,-0.004668098129997496,0.04011157745966907,0.018600118293272908,0.0763407761752263,-0.07304128986006411,0.005583023343504627,-0.09532042375204651,0.05750815776751978,-0.020430111071620363,0.0036363170733955596 "
-"2073,-0.01401563024895992,0.014625983073728414,-0.005824423326752611,0.0030347246982181,0.008552398420079542,-0.0039829938064950745,-0.012442287133013227,2.817620080340542E-4,-0.0013253482954568802,8.818734905483545E-4 "
-"128,-0.006328920582896634,-0.02029257228538648,-0.032103483803002375,0.02814325329088474,0.05550988911710831,-0.040490817950683815,0.061082988294407045,0.004843941512851004,-0.05571198389650469,-0.04794334488028927 "
-"2075,0.00870918666246026,0.007506298058490029,-0.007425710040017724,0.009474335464478366,1.6709436942042086E-4,-0.012411876677424908,-0.0048842387684594184,-0.009188468874701788,-0.011796133634740809,-0.0032036012501646923 "
-"131,0.026600001108984434,0.05095400946262633,0.001167049987872794,0.13508948636517712,-0.10377415147247926,0.0709781690558679,-0.09681972112866934,0.08604941172690711,-0.01660736670588666,-0.05923938697652539 "
-"130,-0.01104627694902879,0.026540509397658875,0.0029587983429257957,0.11784596447002811,-0.0969743996520024,0.03719385802197957,-0.05327959910626861,0.0636265064796542,9.015071917900218E-5,-0.023977465065146045 "
-"2074,0.010263211790423497,0.0029409168454393435,0.005560436873984545,0.004143903663889384,0.005862819305478367,-0.016816310729866335,-0.0010722158548270846,0.008068870649937783,-0.008174833777976542,0.0018173670730549396 "
-"2077,0.005518498763616055,-0.005517645961355445,-0.014508276549068375,-0.002499715584082512,0.004280085290322505,0.006552422049132251,-0.011437298801100788,-0.008521048954083895,-0.0040170059957993845,0.0018589501225270383 "
-"133,-0.0067843126981862465,0.02102022533923221,0.006883070032820467,0.08992514971983546,-0.11171016878729008,0.014201533795205477,-0.043228047003634314,0.11168788128833418,-0.03257427533662379,-0.05222118323454255 "
-"132,-8.949225626462597E-4,0.017062578272091174,-0.0035099934027300575,0.12700711252195473,-0.11627697196194291,0.014893689542989499,-0.07365150416141977,0.10001997178044154,-0.015265776025786111,-0.030065698889708167 "
-"135,-0.08135268088652663,0.05534562962730632,0.0012618605238980073,0.02344879316946917,0.043693300112107064,0.019526352473297773,0.046322221519921394,-0.0071596137244904125,-0.10321207681330774,-0.011094396449951723 "
-"2079,0.011492534156093828,-0.010470252311146826,-0.015095919097154104,0.012105366075496801,0.022435513034828807,-0.009821255920701329,-0.0028702505592139607,-0.0142226340885681,0.004072964810859686,0.0021228708904651836 "
-"134,-0.004767957223637788,-0.009354462851573679,0.01688460377276967,0.010584474631483478,-0.013548649013115671,0.007208339654342421,-0.00909835269770739,0.014623317930566027,0.0022766751187911793,-0.0030750387261647043 "
-"2078,0.0044151829428698865,0.006890887699939045,0.0012017001184959108,0.004523226434065426,0.012689362555655653,9.982563803599299E-4,-0.006867382405532477,0.003159124381165719,-0.018189266968604536,0.01496391253192658 "
-"2048,-0.012277958438356324,0.017356471069754017,-0.0027655434619681695,0.007822840318864394,0.004122671846675866,0.00908432109025624,-0.0013381090846893166,-0.020488245544361242,-0.0042262974047805775,0.0154326431228135 "
-"152,0.007742532266632345,0.00812806604723113,-0.01332942697478559,0.02187073118005791,0.028553751151134447,-0.005982540443880859,-0.009724238590845756,0.0014949115568690927,-0.0073871122133462985,0.002883848368083849 "
-"153,-0.0018973178303242383,-0.010998199013740424,-0.01453757646572537,-0.002436913244823767,0.015894740277576935,-0.009146442802509449,0.008999486475177289,-0.01608055977423532,0.01824493700416162,-0.00379619525428351 "
-"2049,-0.028635030829712086,0.04116063947386654,-0.004625478657993739,-0.032667281092930496,0.06612385116001188,0.002241145521326574,0.020803737956396565,-0.05748745055586813,0.02080203155124633,-0.0015464860073512875 "
-"2050,-0.017751020889091876,-0.012527068068251193,0.011178306380727225,-0.031799118894155855,-0.0462888259501299,0.010934617407859728,0.027210417647159018,0.02644125612968233,0.009171492596952805,-0.01540247098235841 "
-"2051,0.013621899972845141,0.0031001900098880804,-0.00712658031607799,0.015156582314933185,0.01726639043848769,-0.007803306272886913,0.0018374212994431934,-0.035729515860165324,-0.020737148340289373,-0.019211606239037615 "
-"155,-0.018715669354363227,0.008753431367099876,0.01038488050709625,0.009229887185780642,-0.03305138218378449,-0.009883867217494999,0.026176862244228855,0.0154478624799673,-0.02064091866944851,-0.0029014852370679864 "
-"156,-0.056215904084178835,-0.023358330507328256,-0.02035884703333924,-0.004150735355269867,-0.08435783512649321,-0.029236706444887225,-0.0366073143354048,0.027675398174322775,-0.02159951375505988,-0.0655870053875325 "
-"2052,0.0013323165333357957,0.01775637524469127,-0.0066759062757741515,0.023928625808871954,0.05547723480407036,-0.00489082577466829,-0.013035801071510679,-0.032120396586779995,-0.011448844196972013,-0.004572297002549122 "
-"2053,0.042541238369340206,-0.008528736694099983,0.007078370904271208,-0.004659685719251615,-0.004491745444794862,-0.016345690375813703,-0.015479015403666231,0.0018725561223489609,-0.010129753655490356,0.014347496964924869 "
-"2054,0.10243206328133064,-0.0728514587352468,0.04008260724001152,-0.018912070037717492,-0.1534316080839338,-0.019798253515813963,-0.03039863852797607,0.08487971765545671,-0.004907564213631882,-6.419177816981409E-5 "
-"2055,0.00409989781382608,-0.03285430409817249,0.08913369960210984,-0.06764571298421361,-0.15015888375101114,0.033380060763811545,0.019933788275447686,0.08082250078501935,0.038231743643211476,0.025226063163729842 "
-"2056,0.029147562539409737,0.006770441754111066,-0.008785330013592278,0.014132474974770699,0.022069313925992092,0.0046884492950609565,0.013180733148243248,-0.014082785093220649,0.004193123088244579,-0.023585033333012626 "
-"144,0.014926892997195459,-0.007674234517927269,-0.04992081932643584,0.03237024532825016,0.10548921151764744,-0.047217038523187746,0.03149434791352793,-0.006798255011578164,0.022415829126293172,-0.018320499385204896 "
-"2057,0.015346409544953471,-0.025960277554317738,0.0059849492208568274,0.032723475869999,0.022166852270776617,0.004398969979379174,-0.00800396462819427,-0.008246987233645541,-0.010230225350032984,0.016536155269995856 "
-"145,0.014382052289176888,0.018675249908700155,-0.06729508265178191,0.020843176576436383,0.09317408099113988,-0.06368510445145273,0.035020388720088745,-0.024242027160005442,0.015635222383224946,0.002142126025329985 "
-"2058,0.09384158719512913,-0.07861942303619542,0.010094804238868332,0.027802622763962184,-0.07958210733321541,-0.05693414164402666,-0.0632940434405984,0.05410135385704578,0.005562633319211948,0.028417739140237402 "
-"146,0.021854389316413775,0.018910907608021603,-0.011732139919978075,0.007787671195751055,0.029714424900176863,-0.03027250540992837,8.589136076602832E-4,-0.009834390052714212,-4.7547582265709386E-4,0.019572145200971277 "
-"2059,0.22006702596717234,-0.14693615175174826,0.14332588995318593,-0.02557336091502828,-0.3574576181817885,-0.12502141489528815,-0.09695066022344319,0.2040685397486108,-0.016722274417696442,0.06121982637261777 "
-"147,0.023997145918154102,0.025643540629199244,-0.014864809988992585,0.014468577374761572,-0.024033553935074156,-0.025032755820946367,0.014326357762723431,0.024627433263097905,-0.004633874925949777,0.034258697953012195 "
-"148,5.765183173951782E-4,0.007442564653973501,0.011126074783773301,0.011261577144974212,-0.019766360481212792,0.0025190894189076685,0.009258722867018121,0.003655376573510135,-0.022210791623920045,-0.005119639418335109 "
-"2060,-0.014568222612025117,-0.07590873506463366,-0.004091233221366632,0.06966042325505228,-0.09734475165606092,0.06698524616182065,0.0515510277578933,-0.03087054367412374,-0.06075706727772894,-0.07086177904243442 "
-"149,0.010530488097626314,-0.031173832110285026,-0.005800992878341239,0.002895817692982472,0.010218748854983407,-0.008188656400806833,0.013055640197269961,-0.003268488776332258,0.03766445495461569,-0.008391126903703085 "
-"2061,0.014100740585386424,0.01582279323198432,0.019962704707609805,-0.01938468618990779,0.05202035449310404,-0.02218554029657648,0.01482411003608694,-0.07068940540765836,0.023496371832940233,0.024192727636947936 "
-"2062,0.04150243600756126,-0.0122491169049331,-0.023027253110394184,-0.019842574961561197,0.054353812554457225,-5.568702830814473E-4,-0.03281960269843826,-0.04940450392089308,0.01751130948726881,0.010332314085346532 "
-"150,-0.011372224193163217,-0.0035744583959841916,-0.015556930769157973,-0.008201888065228,-0.009665925612736935,-0.02192585096250474,-7.683261900761996E-4,0.0016920636480105141,0.011443109456286892,-0.003591667322158005 "
-"151,-0.0023311018438406553,-0.005933777813026126,4.40304935044084E-4,-0.004096636489613428,-1.8865153327467867E-4,-0.007977689601261145,-0.011938823658585949,-0.0035881836470784195,0.007705250734841049,0.002211063500602574 "
-"2063,0.0314769739944467,-0.022536608519001883,0.004786662494077816,-0.005953317952232611,-0.11243353357483457,-0.0400067755566592,0.024705744419446746,0.018350841414820962,-0.03392294412088893,0.010166601166033021 "
-"2099,0.00823486733065063,-0.009043739256149113,0.010156998337859947,-0.008909810245213146,0.009653581595984699,-0.00890122678362251,0.005945401788597254,-0.008579718916114237,-0.008483515904767374,0.0029421230842370054 "
-"2098,0.014600403538106026,0.007796542331379583,-0.006364176453091009,-0.019854256163056475,-0.006343561562641635,-0.010092905196586404,-0.00335079556908089,-3.911810501538909E-4,0.004242432729987888,0.01503923227481356 "
-"2097,-1.2715929115616505E-4,-0.004942008816049868,0.004848068482684069,-0.006304910162552776,-0.007501470243508061,-0.010914457289636593,-0.015602890642953879,-3.651350121233147E-5,0.012153375646919635,-0.011547449233702753 "
-"2103,0.025628371912344478,0.016946499792725944,-0.0015694407139510557,0.019329942560091178,0.03905079125713374,-0.011469937196246891,-0.02051119501964141,-0.02507024191261438,-0.009892395567977153,-0.0017339077462827823 "
-"2102,0.024306020935264336,0.0022560435993627622,-0.019988960159634767,0.027338728006402125,0.0824427703453408,-0.006237645657146728,-0.018275129144049582,-0.06244675915884993,-0.018858817004807193,0.006686792803673428 "
-"2101,0.03562762235411201,-0.007727000107819696,-0.018799657178551178,0.014958416841487217,0.050652191053167525,-0.008694109798391554,-0.01347397474932368,-0.018015383841728412,-0.010793291618998094,-0.004968410605099298 "
-"2100,0.03391525790725368,-0.01983264662099299,-0.014355362141694252,0.01887117995162858,0.039710636307405504,0.00387647426515905,-0.006869431474638691,-0.0027203371555035256,-0.01882956165146613,-0.010096477536578958 "
-"2107,-0.010474152929805974,0.014957963910731654,-0.01593268085579618,-8.630108501163455E-4,0.008834632225310675,-8.326040316144585E-4,0.0015530805901004584,-0.0020128039122873373,7.200680494027561E-4,0.004812818252617156 "
-"2106,0.009191817909265812,0.0042528647132960016,-0.008757504822069018,0.010881053072087135,0.005444938908648901,0.0025449934350801613,-0.0033523522081450752,0.0035523239109533657,-0.012007906435466524,0.016908838047302574 "
-"2105,0.02430031085687033,3.224116402726911E-5,-0.051685643530526536,-1.7296835104237018E-4,0.08758688883794975,-0.008000835370562995,-0.03175102291401608,-0.05572581004947695,-2.935368246537192E-4,-0.0348711670631029 "
-"2104,0.04689588788155326,-0.028419627407366917,0.026244855452330445,0.021357207008120355,0.02391350222768962,-0.011484752856437398,-0.002254121962208134,-0.00341903045432371,-0.010685712509345623,-0.018714996625075826 "
-"2111,0.013089887372170705,6.888564616265234E-5,0.003074641900755138,0.0019489762396403445,0.0052576667507982944,-0.032368768631717684,0.0019945988185039445,-0.008040036245762883,-0.01916576303526201,-0.010260474889192501 "
-"2110,0.0016525637938323474,0.00516586739688349,-0.016672259696679525,-0.0038045534335500748,0.001554003494847687,-0.01738522913739681,0.013869421655890165,-0.021518677326439188,0.02330095496992901,0.02012173105519856 "
-"2109,0.03407893734995059,0.02004447150550609,-0.018976322361287074,0.041749395338357795,0.09415355130576132,-0.018924409088931848,-0.029398692583187055,-0.038845346242759,0.0040013261841001495,-0.0016155508461974503 "
-"2108,0.0031251917400386526,-4.917509055896475E-4,-0.005030638899902247,0.004679324519357829,0.013780748267055788,-0.01551907418830508,-0.0019046626354890408,-0.003009389499283742,-0.004521722335335948,0.005742722477645842 "
-"2082,-0.0013429568591012335,0.0036864693702970686,-0.012311711500169947,0.008988577907554352,0.004047547634265988,0.0019037282297295018,0.019115206235283334,-0.018037671291135298,0.011485548409241906,-0.003237505570951381 "
-"2083,-0.0010361107596289674,-0.004476134130957264,0.007508411123183927,0.0017751134863619317,0.014203674880684674,-0.027710830968281915,0.010884663747094245,-0.005650226885228515,-0.01607787779138886,-0.01586000514906604 "
-"2080,0.021268802691733573,-0.0033080376071458113,-0.017619988400734515,0.02155069284972697,0.03455788141958616,-0.02887799945172121,-0.014265937149089391,-0.01204926875909625,-0.009183586107653659,0.02114539302015139 "
-"2081,-0.014692502536466192,-0.003588729102094363,-0.009983224827802707,0.001557208581969603,0.002439178118927691,-0.016180692892643227,0.0017641733709850027,-0.0230670939960949,-0.011971029817513256,0.033141581409688176 "
-"2086,0.015651851084207413,5.567656682965982E-4,-0.009901009070055729,0.017799422837472368,0.00594739363457948,-0.024724961288796504,-9.731557220699946E-4,-0.011639723440823814,0.011168287360322146,0.0046056616211069285 "
-"2087,0.025460254782501364,0.0016621265955440432,-0.008544151438556266,-0.0013161818707496098,0.04863220077743354,-0.018936972282728823,0.013454262084460038,-0.04840484258163398,-0.006123093038127026,0.010778436437356488 "
-"2084,0.02636826788040985,0.004506037052753569,1.8509753366961415E-4,0.023839657793172153,0.029048364138787017,-0.0018802900160191144,-0.009980095430640388,-0.020090015356837406,-0.00873016488701831,0.020496768363283114 "
-"2085,0.0013759202085642797,0.01381267913267916,-0.00525120601727131,-0.0015861528069671166,0.008901279254805692,2.1772240719884428E-4,0.006839030204572328,0.007596968206681925,-0.002348326402123589,-0.007402265784653386 "
-"2090,0.01896680587944549,-0.0013049046070408418,-0.022655519394165696,0.026512413877966667,0.05427440144259002,-0.0031385357311808164,0.004697660072235892,-0.030272054764495522,0.009226880513249302,0.003135474637146956 "
-"2091,0.06613033876403468,-0.004400530675233918,-0.04955462720921782,0.05159427939069155,0.100565741898881,-0.04894798383584732,-0.01900684283068504,-0.08248051879595746,0.04335296390294879,0.0036971612336938638 "
-"2088,0.036100401245938725,0.013037059357904317,-0.025954142673590287,-0.0015123288686108556,0.10122501770387932,-0.02494106150818503,0.01521593403471834,-0.06421262149023459,-0.0047163381713337055,0.0025417733789339474 "
-"2089,0.035838531489371495,-0.0021517290729567585,-0.034112361224511,0.01750198783528296,0.0425239972828808,-0.01949754042371792,-0.03309347098585544,-0.016835509039653345,0.004263883106546425,-0.012093246984673766 "
-"2094,0.014600637611926273,-0.005899383970092244,-0.004538914010188669,0.006372473965834976,0.055091158281981724,-0.01112601313234434,0.004228681572160089,-0.04281326097287639,-0.014960273276736805,0.011977296943542869 "
-"2092,0.009178287731463461,-0.0037444906530945325,-0.012215497111056881,0.0066563573282102505,0.011894785656455215,-0.010569046021518466,-5.172028963160714E-4,-0.009785481709036486,-0.02565778042861209,7.290601360838388E-4 "
-"2093,0.0049361227952343595,-0.013202979118069249,-0.02402958275085135,0.032721399601797284,0.04156354972045493,-0.006574783524533855,9.875073915998115E-4,-0.020071473733101943,-0.011127702460453857,-0.016361703204595526 "
-"2133,-0.003217735150576413,3.5956885039011753E-4,-0.01187798155392485,0.010774415408465672,-0.0027008394697185436,0.004599594379898639,0.0024680710673288943,0.013475137314964454,0.0054154444038255,-0.008652809345630823 "
-"2132,0.013811241093509605,0.046033184646273366,-0.006008861246783901,0.02048655997672463,0.07037505289013216,-0.01427866503839152,0.02942613979530166,-0.05404082773363138,0.03236078782106859,0.061520800106504354 "
-"2135,0.0025240256620477773,8.282951905470504E-4,-0.003210215735625438,-0.0032222245296134587,0.00235499052916206,-0.005534508690755355,0.01200236518038475,0.009013428917946022,0.011407200782284712,-0.0049890663622419295 "
-"2134,-0.015870356406052916,0.006455526433366816,0.0043882212267320145,-0.0035804480973504918,-0.002011990590256575,0.022193005610492582,-0.002560938316593307,-0.0036169657044559846,0.02392200150734973,-0.0013439589654772846 "
-"2129,0.002043115294309275,-8.821590303134776E-4,-0.001547045617135255,0.028381899578616185,0.03682225367268553,-0.006408304509486089,-0.023077273590363205,-0.01730707218830328,0.00392183750402448,-0.015049172984518017 "
-"2128,-0.07228107252507537,0.1003742672622874,-0.017102267769756492,0.012103699501236668,0.10941431780957847,0.056067440677849786,-0.021338375892761444,0.009284740922408592,0.0403055680516919,-0.016123632482833064 "
-"2131,0.021525554610797235,0.04260231768394794,-0.03488207960312609,0.017552583781598897,0.039011312836205285,-0.038599043941347375,0.02288228755408387,-0.031750583615171996,-0.0023639220824554228,0.0336457329475731 "
-"2130,0.0217849351996634,0.06949509649545725,-0.010721485136630864,0.02311912198436407,0.1436297897351945,-0.01956574095486682,-0.002280248120576964,-0.017057252305729124,0.019058481077806097,0.09274151361322536 "
-"2141,0.07249175541917678,-0.012077441176134919,-0.05039282786934223,0.029556050041980662,0.006746285090917307,0.017930225512726335,-0.014403948761333307,0.0050226413307011344,-0.13696889190903716,-0.04140751986056491 "
-"2140,0.015290634662402082,-0.007589073067712269,0.0033205619478216064,0.0508227420354618,0.09121538137805789,-0.0313532846237286,-0.03040535012123623,-0.02958975668405585,0.008206966328366032,0.017646172206669055 "
-"2143,0.024669197977053366,1.0010275679186612E-4,-0.006842836447976963,0.04340729090931292,0.13436256157508264,-0.02576173823515233,-0.0621055871708099,-0.027748916703562426,4.622441317446106E-4,-0.041668464934847875 "
-"2142,0.06521134638113056,-0.03729209770669773,0.16326919213715824,-0.07270554205786993,-0.11179355014924418,0.06815269542988066,0.03556968659490203,-0.01066370299121957,0.06409789402586577,0.11064359856740116 "
-"2137,-0.02718683337588978,0.026334871155587195,-0.027612621899362127,-0.0242675102814694,0.10353990816743822,-0.004627879271027974,-0.057015794308623836,-0.02720898342154288,0.02957280740338774,-0.03593607045716035 "
-"2136,0.013196920992997465,0.01153310876094957,-0.02030177438530112,0.03295042368586119,0.052668925323031635,-0.025492852855606186,-0.019691983479733874,-0.02853379742260243,-6.092601518019084E-4,-0.003310627126331779 "
-"2139,-0.012534556178337989,-0.0077359394258252195,0.04218658885843743,-0.041898813857419795,-0.019068697307020377,0.021143793688318615,0.0087598218744604,0.027973717739568086,0.012030354233896182,-0.003184588036340613 "
-"2138,-0.02975786909158991,0.045413794175253215,-4.081186296849476E-4,-0.03696867264474209,0.09128163758846822,0.0012331107534680028,-0.012470351634514577,-0.0459731191279535,0.03365009022569859,0.002765946541201336 "
-"2116,0.020738052290250247,-0.002952997903792765,-0.03596048102082284,0.03430671567810101,0.09607150613452078,0.003229408787487687,-0.050520565835762164,-0.020591705979780456,0.01632126044418758,-0.022743889103938722 "
-"2117,0.028719303926346692,-0.022504774101608255,-0.006607415292125774,-0.011002931316303734,0.01838265114299931,-0.017035543496057844,0.0029257650170290018,-0.009746718832709037,-0.0022919772918148077,0.01806431900827183 "
-"2118,0.07006572031921778,0.01421087277873278,-0.044393095572739814,0.021852055729242897,0.09418140209209852,-0.01943104028199578,-0.03317791920829087,-0.06011073996917852,0.04707816633348742,-1.9867783618882673E-4 "
-"2119,0.03316304788749464,0.02199072558303792,-0.02183419959356593,0.03575041288382477,0.10260739928620786,-0.03385806053430042,0.008605014657646542,-0.06254608223883573,-0.00875454829549397,0.012729836506091306 "
-"2112,0.054525878939138066,-0.0145826036313219,-0.03033001950775684,0.028161993050703882,0.08958826116408762,-0.022331911927328002,-0.00897950744093673,-0.06446721613485372,0.029009915943940874,-0.011811747592127426 "
-"2113,0.03241368918961318,-0.009648316789406895,-0.02357085374242641,0.006706969956066248,0.04251825147660968,-0.00506890243912031,-0.018527051970663757,-0.03027581626883022,0.023670125984427543,-0.007707662254539441 "
-"2114,0.023214006371149454,0.03138221332049716,-0.024854064061665994,0.0029481595028371197,0.07213417434081988,-0.01117180365239006,0.025980161983470085,-0.060209238003631455,-1.6911289143394125E-4,0.01980263151845097 "
-"2115,0.04809288148534803,0.035098932541074226,-0.04025334559396466,0.010117951178450973,0.14951503091180546,-0.04602410116689811,0.007491044475022134,-0.08675791316677187,0.04250062955046118,0.005707342146052061 "
-"2124,0.010332372529699003,0.04041698021513131,-0.012985846549734968,0.001916737218525485,0.0988412017120452,-0.038247721576864346,0.038369356105696015,-0.06403261081376792,-0.01871560331437595,0.016907827686439506 "
-"2125,0.05277258458657275,0.07059266147980417,0.002073517827881136,0.047045703280975223,0.06743946859601077,-0.029474165289391865,0.022258481300883898,-0.038615489730115256,0.03827093503836166,0.09963775447153735 "
-"2126,-0.01350225474648085,0.022356168086291806,-0.004835610134491791,-0.006130768960100584,0.024665285776470678,0.008142660943020163,0.0035086137675565177,-0.00991281849512244,0.04545579480907158,-0.010177077283919972 "
-"2127,-0.02595289686445373,0.030292494146146355,0.008709149442044622,-0.045135271374617494,0.02786441582902039,0.05271212965216641,0.038360618579449876,-0.00908786957593579,-0.09124870648707509,0.006831986987527073 "
-"2120,0.08800448305674569,0.05173013806139477,-0.042845967862840874,0.04785787189860133,0.1315589021399892,-0.03717565154778803,-0.008818049014863454,-0.03386977003321992,0.07673869533752366,-0.005824424265324569 "
-"2121,0.005869092859140668,0.018002160180097117,0.007392011121214999,0.007792988843550716,0.032752203627890296,-0.01039609232639815,0.023614241351584752,-0.04087973198316792,0.007960288418733629,0.025842132156669445 "
-"2122,0.0184241015010063,0.078090121715619,-0.03473889799808779,-0.013728847624611233,0.05892006084834386,-0.04256359111547834,0.04656288748035018,-0.045882417458780626,-0.00159745272187124,0.02392440218615618 "
-"2123,-0.07001149042761955,0.07350080277590612,0.003110640726312088,-0.034593333912687076,0.0999757983394719,0.03673092797874728,-0.0065992771641211565,-0.017535164578841935,-0.017166010646762177,0.02596363876342762 "
-"2150,0.07137063215883105,-0.006374036423829806,-0.0174833844579217,0.03133900894918324,0.15726440320730314,-7.719099359830758E-4,-0.0691794837932676,-0.08700829138511659,0.07000604030343863,-0.02808228465554148 "
-"2151,0.04603306148542469,0.009515973987673634,-0.0304272859419784,0.03373361437934474,0.14231204706652184,-0.005192221312502162,-0.06239295913167645,-0.06715636708480685,0.04252852057371797,-0.010810094184327655 "
-"2149,0.009898477018832993,0.004317568277513336,-0.011038847993850014,-0.011284019070274598,0.012816413443508099,-0.0032540940968966117,-0.011764982265440146,0.0012809642844700713,-0.008160807501419353,0.001445461210689606 "
-"2146,-0.011761366984514462,0.008086487053571628,-0.0436508986640759,0.039394059537541416,0.11631375808402793,-0.002453668880298499,-0.10101499314675781,0.00952799934657431,0.03532800677786095,-0.022706247571531803 "
-"2147,0.013716647426223137,0.04021904499798819,-0.003776145168702878,-0.03793389949365664,0.028489770765643057,0.019216215094101992,-0.0020366971267367297,-0.016769867562235065,0.12570308857264678,0.013376163960504003 "
-"2144,0.02990247286102247,-0.03229233431215111,0.047304998156957365,-0.045815677220454966,-0.18021129051617446,-0.038260125530705895,0.024185050183078132,0.029741141191351086,-0.018341660368542317,-0.025520772271831808 "
-"2145,-0.005152773476797098,0.04429126320824663,-0.009856138102622394,-0.021761553710649067,0.05647697159115706,-0.00627450023603572,-0.013501132047574856,-0.044762266702130765,0.04801597175081847,-0.001839903701522886 "
-"2152,0.014916609509751416,0.0037592417046734025,-0.034883159541236115,0.020474675559027405,0.08808376391431899,-0.07123813657566588,-0.0269091889788507,-0.03575323067766835,0.023726737796408433,0.0645034560981312 "
-"2153,0.03675212899820262,-0.021526926944174563,-0.004662901783506239,-0.009670681095878417,0.009162764866976576,-0.01907362703057659,0.058475556465159395,-0.0238197585344174,0.03967941011007683,0.0208828640906781 "
-"1016,0.006039908505618318,-0.03191358703327778,0.004314173483934936,0.058074756707856355,0.02189882557760895,0.014067195862974741,-0.024331458536152723,0.00571091299275212,-0.07723240402050313,0.019427612442964818 "
-"1017,-0.003006203639302614,-0.03030357212625961,-0.014198784797937078,-0.007801552588098486,0.0540676828019481,-0.0156716961981348,-0.031776383636436326,-0.07076062477014596,0.0296627092597962,0.036829552677697996 "
-"1018,0.004675265840492279,0.005063003192397103,-0.0021939238537062207,-0.005949208047136654,-0.0014094670019469267,-0.0026430648204739437,-0.004969489917718213,-0.0177628384859195,-0.005799576814087594,0.00550163202089431 "
-"1019,-0.03865177771117145,0.009259544724562878,0.04963101386405498,-0.05455354310763602,-0.06730012807790903,0.030372155519399112,0.04333656647764519,0.051782480321490715,-0.007841249406127179,-0.027299885573076957 "
-"1020,-0.005066434939338367,0.0025501793387353246,-0.017790217286836336,0.0012134065402188503,-5.786484114941392E-4,0.007910484632553148,-0.01090199263879769,0.014550867901436766,0.009890193036888073,0.002570187578742744 "
-"1021,-0.005622783365454364,-0.005516826579513814,-0.0020586112095510706,0.0022835073021041288,-0.013697306912758743,-0.014945578175910131,-0.003197178893692237,0.02400810860673724,-0.01397447289452995,-0.016952927009247613 "
-"1022,0.006634948974463697,-0.006305530505713342,-0.034461230912616936,0.012874154076672705,0.028269217193814245,-0.017129126613053866,0.010413543986434747,0.0026436609262002497,0.0015982109877493349,0.013843948534341434 "
-"1023,-0.008035509724096645,0.005357864951242013,-0.006880217225758995,0.015425658482853507,0.01488415727954383,-0.004073020474071155,0.004679268803488008,0.004890438079205336,0.013002930745282441,0.0119889981955738 "
-"1008,-0.004654233949956592,0.009090910415631408,-0.0012400952335863754,-0.019099660667652018,7.252051138615824E-4,-0.0011989451560227308,0.013753670727177016,0.010196141354089977,0.001978282780331467,0.019007885565113562 "
-"1009,-2.9099873152832137E-4,-0.019224333631680312,0.005477150140860299,9.885300435016138E-4,-0.016011903009516985,0.01692662141000213,-0.01633532614359976,0.018032536722042483,-0.0168000716020623,-0.004128826687063467 "
-"1010,-0.013645894943009555,0.01693646095063223,0.005088506462008849,-0.01626466228546277,-0.025928596201616055,-0.0023346240260279367,0.011116256415101937,0.019306489335835685,0.002310383350233494,-3.410917551688599E-4 "
-"1011,-0.04174835040040666,0.005708681925946074,0.022118030886755704,-0.04693566751114142,-0.054545096575711965,0.029985948501483846,0.0332320760358235,0.05194228854624753,0.014681033771077314,1.5837468382904496E-4 "
-"1012,-0.00545138511852371,-0.039116145470383265,0.010987237548286271,-7.492008679324219E-4,-0.0491749311969825,0.02015824699602194,0.028790588075719378,0.07591394919136284,-0.003913516662241036,-0.0598666030718026 "
-"1013,-4.2338111844378957E-4,0.03163658924391355,-0.0713746587803764,0.0589883122141877,0.0567438920687644,-0.01167249790697213,-0.01717942927704343,-0.03142476280675462,-0.03669477709294048,-0.0030371364679442343 "
-"1014,-0.04769064216575058,-0.028750877273267698,0.02275162612800475,0.010769770293221253,0.07379214978666264,0.018691647330657358,-0.014625950226004263,-0.09553017149438238,-0.004147211838756239,0.03098652523919782 "
-"1015,7.593124170535277E-6,0.006881373703480313,0.023845538052162083,0.02074846640479419,-0.025888574411305813,0.0029318340475087026,-0.006145491921121355,0.0029770441158281616,-0.015223645859690391,-0.008247584294419514 "
-"1001,-0.0063156707691304674,-0.01297207644293254,-0.04484133434024298,0.019931678300272954,0.0321617135114093,-0.048868140359418354,-0.005914935791655334,-0.007793122418029752,0.04366295161673487,-0.02589971404245903 "
-"1000,0.010010017237250401,0.003286884898012255,0.0013870948119570406,-0.010419705066679953,-0.019532069446697903,-0.012442010177214104,0.01208160964662648,-0.014536242706438055,-2.864866527952944E-4,-6.954485726208105E-4 "
-"1003,0.026131369849723748,-0.012257285049671407,-0.005121777786511939,0.02097863393526887,0.023623058426355228,-0.01978229199145001,-0.00621984406363582,-0.033988294098215924,-0.016675316566611177,-0.024523781059286747 "
-"1002,0.006825263498110828,-4.307265975698013E-4,-0.014606662901740225,-0.01899241508243051,-0.0025415949166270805,-0.018408331337143237,0.007085113849894746,0.006072067661938685,0.005729571494239905,-0.017654958789085993 "
-"1005,-0.002918482317641088,-0.004051718752181463,-0.0022303520867385253,0.010251727065722272,-0.006286153210084147,0.005825077668318434,0.002553039649438378,-0.01446515992173745,0.00845405994205389,0.008318454813732442 "
-"1004,1.6401571161697498E-4,0.014562955587258297,-0.03222350361233048,0.060192064912877104,0.06730689759244908,-0.004543233133072745,-0.02084157756922415,-0.029358512237180508,-0.017107259574239888,0.023659615612411797 "
-"1007,0.009979383035913142,2.362293629294532E-5,-0.015224584767029689,-5.455705525987566E-4,0.015234606790849791,-0.010338183109797438,-0.015303332140790778,0.003867659335979767,0.007417728586065516,0.023339222798514407 "
-"1006,0.008431443256821046,0.008381937730322976,0.015429950153357951,-4.229910905334883E-4,-0.008284047944140886,0.0034535330870862292,0.004141644374372744,0.0010297027988804867,0.010283086836202293,0.01574613387624239 "
-"1100,0.013110278519328345,0.0027903811777478713,-0.04956826876968764,0.022702504936593527,0.017637286468493572,-0.02819616958052936,-0.01834906364993682,7.483801311565366E-4,-0.032826571052491135,-0.017208202874238233 "
-"1101,0.017172382092353798,0.008255726654864919,0.008309790740779015,0.011425471216322565,-0.0028901355175821857,-0.0020529086808858277,-0.003593750729737489,6.427943653386392E-4,0.004048880987497847,-0.008074403208267673 "
-"1102,0.01376536768677284,-9.68450943372704E-4,-0.026822287829444486,0.022532526764446115,0.02631857783022168,-0.025584326345510854,0.012304544028488256,-0.018659486722348777,-0.013179547589879579,0.0015826842747197261 "
-"1103,-0.0028244756481751758,-0.005783205497024932,0.01578300632764226,0.011099258527992567,-0.008188494650718865,0.005382419613276359,0.0038995275217613714,0.00986624157839776,0.0195359213625182,0.005901151182404651 "
-"1096,-0.0054778079246106375,0.009360042979090535,-8.543993786942955E-4,-0.0062502163991386165,-0.005629481315640954,0.01369135362367997,-0.004570637222823771,-0.0017588391400986932,-0.011017202011114715,-0.00969465369293113 "
-"1097,0.012804951819972933,0.028383104583478657,-0.002146030347338067,0.02190283640875459,8.198538277372446E-4,0.003384678555796936,-0.00902730153296875,0.022719650845392413,-0.006155166580232698,0.011910072702375287 "
-"1099,4.272492485072345E-4,0.0044166862973099566,-0.0031310384255659914,0.002897661099837208,-0.012512776928096226,-0.020371604477964707,-0.0015290704978972041,0.008566234275837041,-2.0039720017611798E-4,-0.00990594651642095 "
-"1092,0.026249141824014274,0.004579850948150026,-0.019494888738397095,0.041544164843812986,0.018228303161897115,-0.030922270061011475,-0.010164393633631917,0.00410107763800263,-0.02628609222909792,0.008020466318998214 "
-"1093,8.317706461288481E-4,-0.010662051518370491,-0.003026340868595966,-3.066302034303778E-4,-0.021092963493005913,-8.191142612013507E-4,-0.016590984312855994,-0.01777434395525062,0.013983596116774034,-0.004219753877573625 "
-"1094,-0.05592614271293662,0.03919515591364252,-0.08492109174406241,0.07141350092020322,0.09568116012113813,0.022227368353122886,-0.11342405061202089,-0.04922201989296738,-0.09214028675061424,0.06289592509937912 "
-"1095,-0.011465834047982527,0.015906212256139272,-0.016934288370285096,0.005759864821984019,0.015692695271837552,-0.009315851357683848,-0.014343383326859173,0.006830479400972367,-0.016955629493704084,0.03677197087330052 "
-"1088,-0.049983412175550045,-0.0043385229283116914,0.009514995409706588,-0.048606024668713485,-0.018120391344794602,0.019796449910911004,0.0026656913934511943,0.0335449383161117,-0.014596220839880386,0.010495013947782478 "
-"1089,-0.0691774655076038,-0.19674690713834228,0.09888544355476771,-0.15193213776386605,-0.14601919609490083,-0.017116021444100838,-0.01407431082921816,0.021530027592375725,0.00588846331041467,0.032719697030150464 "
-"1090,-0.019992126091471534,0.009996913545668291,-0.06657252830016996,0.14608318856916366,0.13872729747019874,0.0026270853642013483,-0.07602455599018287,-0.04341516993537414,-0.12726971161111175,0.005957477048122011 "
-"1091,0.0010462406672256226,0.00985963239221741,-0.011097053351346576,0.014106734199071266,-0.0071644773470803174,-0.0031704768125924133,0.0024766365853145155,0.003730853293679038,-0.004607272312471682,-0.013488678137710085 "
-"1117,0.009848140508757864,0.016032025624742433,-0.017506362551232,-0.0055413622492612525,0.013866978824401032,-0.010825109129263629,-0.016195699997671516,-0.0037523728013083516,0.023514828531206913,0.0028604021196987576 "
-"1116,0.04189174021999496,0.08872612631183249,-0.05474496174512534,-0.033942118247166066,-0.012916978199142904,-0.04181865348103275,0.019461338410758318,-0.008871048779691842,0.06647332525437379,0.022191028425045584 "
-"1119,0.016380185478063893,0.03367391124681713,-0.015707239005732482,-0.010468417720617853,0.03681634938037581,-0.02477070447177114,0.01189400049445118,-0.021052312024998816,0.04403502457112304,0.007476619246793202 "
-"1118,-0.04959040049488221,0.01932430536357784,-0.008887119529878485,-0.03918329857645323,0.06842214415445069,0.0016257787639933645,-0.05394953551601107,-0.11083587556587879,-0.03609535268488755,0.05812921942697552 "
-"1113,-0.013168380705546188,0.023261492826635234,0.018891835711587555,-0.004216317548702049,-0.022136774394646678,0.008008642137023438,0.00709633981475457,1.2338017479258397E-4,0.02848380968600995,0.005410651177483341 "
-"1112,-0.002738154404147455,-0.010501971581455553,-0.001273253285874907,0.003868572210072358,0.030244541188432773,-0.013241731985721471,-0.005236738305928054,-0.030371357243319113,0.005788176873955942,-0.006809717236572607 "
-"1115,-0.0023769298944360056,-0.007363426653335152,0.014495975244826964,8.825096578439888E-4,0.001749024970857791,0.012357474902941826,0.0015803291297717121,-4.533457562664533E-4,-2.1834044976682052E-4,-0.009080217149667148 "
-"1114,0.02790908815557429,0.06132805166881528,-0.01729964338941318,-0.012888422518737334,0.01676542134038871,-0.013209848687776833,0.020702441465825304,-0.004820690380339997,0.05129840156240941,-0.010101488048814042 "
-"1109,-0.01967805890430976,-0.009309832855832057,-0.01910048662921774,-0.005132427533369863,-8.384528223911868E-4,-0.018869268960479243,-0.02726446401882757,-0.013587482172717269,-3.0197099576514456E-5,0.016989119688371745 "
-"1108,-0.010739389077330533,0.0038079691857375282,-0.011688311712760394,0.01402420391939027,0.03147127292874651,0.006552690926026442,-0.024828892356853417,-0.051719812398359016,0.005579211350471894,-3.9919185018134055E-4 "
-"1110,0.0061738304547842,-0.020580399233223152,-0.01832405478483404,0.014979327006629432,0.030203863050032306,-0.0039536214693144936,-0.011208528423941908,-0.03503261887487376,-0.007781189942749428,-0.020113632389366618 "
-"1105,0.015306508070591106,0.027530201937842037,-0.03147313902431107,0.03618351769640378,0.07789968403050032,-0.018755698067719345,-0.019353616214902076,-0.05917375752859373,-0.0013270103026961101,0.005669969360171255 "
-"1104,0.02137136375041496,0.002021599153587689,-0.030368046176409393,0.03764000281694609,0.01744614825163898,-0.02275963426052236,-0.006065643583202931,-0.020765398089405463,0.0022493012238114156,-0.011528153727243057 "
-"1107,0.020679152149318487,0.005808793179136594,7.125574631186198E-4,-0.003228773734892914,-0.007389396840201391,-0.0038021686846461686,0.003163753245575235,9.820721687259434E-4,0.005158177753019045,-0.0070024433404304 "
-"1106,0.02071217476979304,0.004665221144945026,-0.020738065600973347,-0.006777311914297318,-0.03871099074701677,0.012112403130520491,-0.0031383885199334455,-9.651238266389032E-4,0.01595084007678589,0.00472235414201444 "
-"1134,0.0650537583058094,0.0412304722693199,-0.030354848603366583,-0.03156576252200993,0.053606414528301664,-0.05296211400897961,0.026648203645491267,-0.019016577806791186,0.11466142882234157,0.004745635910454563 "
-"1132,0.014556976719773837,0.0091336891219853,-0.011400108684016199,-0.028051774845803706,0.025501800519708993,-0.0209292811837689,0.0040128151445873355,-0.009826591810288358,0.043500817819439624,-0.0059964317807659285 "
-"1133,0.016651866815680417,-0.023531825015393325,-0.017996943140672652,0.020883219036288224,0.047706832754143905,-0.008243905660769662,-0.012834499853031603,-0.03984720769338448,0.030971782134186686,-0.005693090665410304 "
-"1130,-0.007118636200194335,0.06373468158494666,-0.04852354258909643,-0.014543953719687586,0.08690354147354573,-0.06446306936359013,0.05004640014260321,-0.04058109898286796,0.04362429532804654,0.012316411804503163 "
-"1131,0.039048534249694816,0.07212581686844023,-0.04303117583760529,-0.05057584808337567,0.09807430586252673,-0.06363131826399006,0.05124902866690955,-0.02738930518805796,0.07378199224890863,0.004395156338124049 "
-"1128,0.009267029033333776,-0.0011335206635846589,-0.005664281391377672,-0.005666141433053331,0.024131196843639683,-0.02264371408912014,-0.011633150302881723,0.003994888893940604,0.008822793257011914,0.0029457450364898078 "
-"1129,0.02093732028588332,-0.010368636156056583,-0.016166120436371535,0.01669841633778685,0.0324572328184218,-0.03755612740831808,-0.005373229554209031,-0.01284404616085764,0.014592547343531064,-0.01039626245061587 "
-"1126,0.010021782045481773,-0.07411433250847896,-0.03368516805092236,-0.07013679415112861,0.03354745075831163,-0.07753342494613764,0.036660968356601396,0.0405181700169168,0.16181913374768053,0.041188534967067404 "
-"1127,-0.07832300955670461,0.017598075681215207,-0.024835337938004232,-0.039023470928426014,0.10612266514072309,0.010935723250526096,-0.07052693748598189,-0.07663685601793337,0.029361541065029258,0.07971664771706743 "
-"1124,0.021530406019594966,0.01798691993015729,0.005560865756926433,-0.02078076871279195,0.04059338797766732,-0.00811753562691062,0.01610740954103561,-0.053893285135017344,0.015849925476312362,-0.008833234231620714 "
-"1125,0.057890338617813175,0.0778819210479824,-0.07697304867149646,0.02907935107006599,0.03152304996786512,0.020509166706234268,-0.01552466003289807,0.004276966276505953,0.08502885204364172,-0.12408919509355237 "
-"1122,0.04950565638050496,-0.05936953632144006,-0.052465008864661725,0.10256113527716966,0.0898082907357915,-0.0019407232005575082,-0.07920903975849033,-0.0554093091891319,-0.01209484847617107,-0.022998113241492164 "
-"1123,0.027540179017242792,0.04988687956778038,-0.05305165877872741,0.002628383616679811,-0.021467182381419328,-0.028151894050540034,-0.013388949358053057,-0.01862047966791106,0.03485797029454097,-0.03167603414718864 "
-"1120,-0.037622169563113254,0.026709022255977967,0.06875340646280229,-0.06243619359093999,-0.2562935095185516,0.08385538590439212,0.027980184994842783,0.12471324455956669,0.09237986051087119,0.04515213709555308 "
-"1121,-0.02004004511446555,0.009232511890214833,-0.017343111395545216,0.1062616731432959,0.15158904629310868,0.028502973088671918,-0.022717889061770486,-0.07263813579918363,-0.11268044403399141,1.1811534537612436E-4 "
-"1032,-0.0017514005445570335,0.008342181164263775,0.014870122286571134,0.052279169307107395,0.011289751682077532,0.03725449611994982,-0.08277829409357808,-0.049198292946623,-0.07426251692415588,0.01641054134635416 "
-"1033,-0.03526092546207483,-0.01402060096120333,0.050717215406433834,-0.06129486822147126,-0.08082853721549219,0.0381473926480292,0.04247382526268277,0.026767680608569558,0.02545539922238103,-0.0040224447707629864 "
-"1034,0.05491281072378466,0.11302923031271697,0.16408697939708125,0.016513521999113486,0.0942062464092881,0.1921685669189769,0.04671757677183706,-0.21264178041081203,-0.32624557762108536,0.03787048088346675 "
-"1035,5.246978439966988E-4,-0.018712843537878002,0.016404237677465103,0.0028758908220022574,-0.013941837220612452,0.013637225806088834,0.004239171410948336,0.02174151440725604,-0.02607709260459441,4.907792934743934E-4 "
-"1036,-0.010400649973027072,-0.011006470555938069,0.06087521054432344,0.003307175024223222,-0.12454389245925135,0.0460962107412404,0.04372664619298821,0.1348399718381108,-0.12466664511672051,-0.0036693215803454047 "
-"1037,-0.02073222398013532,-0.005949378137275389,0.033704061163519206,-0.02237586929552192,-0.04423672879065896,0.014699855225162433,0.021736938260714003,0.08247406897458838,-0.019277531541581027,-0.06295619558863635 "
-"1038,-0.014614683685658632,0.02585785277524118,-0.010211904829513127,0.03256447180287724,0.011410750037807239,-0.0064333378413881466,-0.005771806126730615,-0.009401395273961229,-0.023034359939316948,0.022855492577070653 "
-"1039,-0.006197182787318659,0.019048658101652245,-0.04526457806278754,0.14599318724561894,0.13099653956463964,0.0029922498958095986,-0.060529294268853485,-0.06495341410209417,-0.0802308670341658,0.04055014780034317 "
-"1024,-0.011098872647294367,-0.0019365398503181528,-0.002879953886098518,0.003536717402422574,-0.0079653364943238,-0.015643836087342437,0.0013274469890125398,-0.0017504066358821687,0.0026330885305461587,0.0285199736556799 "
-"1025,0.005930449803374283,0.021110669730763528,-0.03222270905352158,0.00192440331618168,0.00510463566733743,0.001734685165153466,-0.00771293689721491,-0.016421897149454596,-0.019270263573364758,0.021329952803356356 "
-"1026,-0.007783963735201239,-0.007920790090599185,-0.020687874034988406,-0.020488079661546362,-0.0019011580642889381,-0.018736843471999876,-0.004566694765036501,0.004657762883619322,0.0011172036753107346,0.004798317534181712 "
-"1027,-0.011382790117972516,-0.014814790379218398,0.035525954817695195,-0.015760360150104416,-0.04583448837765392,0.02769741506756472,0.016240558923291393,0.0304674878068012,0.0089809838128398,-0.01962542612171562 "
-"1028,0.05690776620775648,0.02728285636489705,0.08915080459418101,0.029991869415229827,0.050081069851689565,0.08288477262850748,0.004599617742520056,-0.03829783024019071,-0.12393270438279609,-0.021649269389465386 "
-"1029,0.010078537433176516,-0.003683593499230478,0.034286340196366505,0.026155741529876507,-0.03862021412701013,0.03280715667891752,-0.018500333740794787,-0.008972996252584449,-0.06370775283628803,-0.002795596341829136 "
-"1030,-0.04389217167493832,-0.02144557173057866,0.07236889388744766,-0.06747610968159871,-0.11899137071800873,0.07329219779395311,0.05335629113532495,0.09382796033322498,0.044013321032897554,-0.06614015412781181 "
-"1031,0.01788484436547321,-0.006118409935979232,0.08520342973312425,-0.023352685563236105,0.02313142637889828,0.006978688464065344,0.011869820576775854,-0.052097164309955084,-0.12236400208954755,0.007864151282418786 "
-"1049,0.018571490172715116,0.01279347346738699,-4.40348630134416E-5,0.0027976933551013953,-0.004161448516929293,-0.0021495021533076662,-0.020760734288858336,-0.010317465818558628,-0.004206297602362849,-0.003710092175070723 "
-"1048,-0.02506446489726662,-0.0037069046033956585,-0.01036698893971958,0.011347154146718955,0.03458284890621143,0.015217684857070413,0.011673651093146697,-0.012237077618625634,0.025678369225296812,-0.015239336817573635 "
-"1051,-0.021798579214503247,-0.06775138369519373,0.05853041474978259,-0.04295050336256841,-0.10871935999755333,0.08703626691540951,0.047370869931099735,0.025965451736439597,0.05706627170563556,-0.10298272673537374 "
-"1050,-0.028469629589098627,0.00157742799124415,-0.02739750127967018,-0.046374503810800834,0.04249650552593363,-0.032664185355517544,-0.004321013316554171,0.011251718787267878,0.11197413560860349,0.013840828366555336 "
-"1053,-0.036255466295619265,0.03275001069036148,-0.037122718720917616,0.03430347525142692,0.02516848466757166,0.025864638169179072,-0.023229925253105646,-0.014916169697998137,-0.017895751167188563,-0.004760020137593356 "
-"1052,0.005831594631762987,-0.005792978155652197,-0.005755783799027557,0.00824359262105412,-0.016855479334714634,0.003647632870132397,-0.004305405232352503,0.010755084704689435,-0.0035235581052201694,0.003635216419260946 "
-"1055,0.0023605482280129415,-0.0038460097791193854,0.0031199717444318066,-0.007600013809718227,-0.0158315776744255,0.021773040605046895,-0.004468715045469472,4.2210931382383383E-4,-0.0025754970793472015,0.0014831475141598048 "
-"1054,-0.013820138720879593,-0.005144512355680938,-0.0018554968599625138,-0.0035396972686579427,0.008685020756468266,0.01729388813494318,0.01848384165686804,-0.033620319659393785,0.008720153156586011,-0.0017804745820939427 "
-"1041,-6.402924592169103E-4,-0.008424690993551965,0.006939885152252078,0.0016994213353596558,-0.010588427020150093,0.0037716806116905176,-3.1674379398775594E-4,0.013072463239564335,-0.0319169005045332,-0.015867139254857856 "
-"1040,-0.014590046913844907,0.0014447320211634761,0.03860494872987877,-0.027550316971575645,-0.04419565949380621,0.04496216153748763,0.019454034485111144,0.031670551921124224,0.025325464308257387,-0.031066652298500433 "
-"1043,-0.006769875061518608,0.0011186327385590933,-0.0017409421478598497,-0.014997070072399645,0.0058774845111510135,0.004948243420931894,0.03051363092738065,-0.011079606297089229,-0.02255970374602274,0.0015474441290525272 "
-"1042,0.001469973880788386,-0.037890892305431495,-0.03969133348090906,0.09380247660219497,0.08949693505948211,-0.05057764850551661,-0.0380875915657584,-0.044203767104620824,-0.07935145620305172,0.06056590687175684 "
-"1045,0.023845655548168383,-0.015962484449496016,0.03402579229526233,0.026859228801445208,-0.023270056638820123,0.023130390021123496,-0.01847157560128918,0.013883561289469605,-0.031410549663858346,-0.016094132393659935 "
-"1044,0.0012648424383400142,-0.027343562220654847,-0.019791562022489433,-0.004099841263603066,-0.031003688807403708,-0.006505379529511182,-0.007051161320986916,0.04595433512225769,0.024189223901830058,-0.015006145073116206 "
-"1047,-0.011849111829781754,0.034424280569061,-0.008044390841013993,-0.02968019428103518,0.058344755092422755,-0.008664014321714658,0.005548698223564698,-0.04427911078457991,0.018873930700599464,-9.481432620636202E-4 "
-"1046,2.643102192843038E-4,0.0056618862694410785,-0.021604594794726144,-0.0015602065418035692,0.03861863448564088,-0.012393336416955602,-0.0037511315434281076,-0.007160919821769164,-0.009320524706527332,0.0042966864221113095 "
-"1066,-5.681488127045781E-4,0.019707320708277312,-0.023231693991402846,-0.0011406550108969179,0.01151983218494242,-0.01813358646663371,0.004023902654775571,-9.634647285828885E-4,0.012736464331287398,0.009544622549630902 "
-"1067,-0.0015531095895462005,-0.01476441120423959,-0.011789683508297295,0.014563009526597285,4.0951489880288247E-4,0.01900080221471168,-0.007311856000905959,-0.0148195192052628,0.01213146162810955,-0.0028438833784542677 "
-"1064,0.003144689158321595,-0.017072653592964875,-0.010638505356051466,-0.0029368416305323415,0.002755186028889357,0.006833584447676372,-0.016607888423511834,-0.003261865208309606,-0.0015445725799985309,0.009498633485900734 "
-"1065,-0.014003002375021537,-0.004523034942062381,0.005466832510822084,-0.013616772833623727,-0.027056525813387345,0.009308577114508325,-2.430501111052895E-4,0.01010374130964757,0.00407216685194609,0.01469691908344938 "
-"1070,0.003435589859491018,0.004073912229784595,0.010041318941176571,-0.012009832085980873,0.02692717823766171,-0.016568070028169544,-6.387582353462378E-4,-0.003910144355326108,-0.0043883630123562525,0.005966264172094901 "
-"1071,0.0017033162878221215,0.031553992980899295,-0.006242286262089656,-0.024674122709864747,0.026118461540142367,-0.03035101228380397,7.318878357465363E-4,-0.0303561747073526,0.03639712957940263,0.03533547796521847 "
-"1068,0.013039678925714214,0.004316646334182418,-0.0028505032242980275,-0.008639742975347312,-0.0032096927024390168,0.004855111137054819,3.408389555849938E-4,-0.00899374823975664,0.004842110061041487,0.033928117980220864 "
-"1069,-0.008810490666635891,-0.005847649911195303,0.014901657122952447,-0.0076762047865702975,-0.015410682640506018,0.001977380515369965,0.002184264610101911,0.012697125039442002,-0.008982107111759553,0.018394680791701788 "
-"1058,-0.013467952857399202,0.00313298142988004,-0.0067627631061232246,-0.009774336482486629,-0.020113576186923977,-0.00876182883542371,0.006458466423097355,0.009717201775146216,-0.006370141562967705,-0.004139414226137565 "
-"1059,0.00925492496720925,-0.008431097478081875,0.048923009222381506,-0.023047569109671956,-0.10793075147714412,0.0412390405068055,0.018664573739386868,0.06696430598847636,0.02860318285193874,-0.04967664455723936 "
-"1056,0.0030598728467839654,0.008344349903332934,-2.609879586669574E-4,-0.0031481318900466737,-0.02253717142086035,-0.012466869145299974,2.59208193937355E-4,0.004703609180896541,0.018292935884375843,0.005674705683588219 "
-"1057,0.005322977200031543,0.005980934939993876,0.008567609236631059,-0.01055847884833699,0.005611694714916333,-0.009208796019014977,0.020521568310699657,-0.003134851074548843,0.012105720515116125,0.0021952107683669802 "
-"1062,-0.001568763273904139,-0.02178104072294607,0.00919153923792756,-0.026730316306520535,-0.014292002773623667,0.012747224029349559,0.008549156575183932,0.018990323590272244,0.0029293266592969555,-0.034102785518777164 "
-"1063,-0.003903510121038116,0.0013921890514703137,-0.009339948123046655,0.00967471338484742,0.023848807784406366,-0.014526120002900702,0.006557076666613872,-0.007224600610113628,0.023016568588134608,0.012926150611643313 "
-"1060,-0.006280931278441995,-6.016181523044326E-4,-2.7850405724274885E-4,-0.009286523202815138,-0.02239050655310208,0.010751665344717626,0.008772278603302678,-0.0035631927204605495,0.01001645957079304,8.713512659195032E-4 "
-"1061,0.004068545621239062,0.008182297131813137,-0.024725428091611344,0.016012619494616416,0.027673826355135267,-0.003952742174444015,-0.011200601391052957,-0.032046447883416374,0.002789236643040344,0.015729386271419926 "
-"1083,-0.01666767147501962,-0.023361491548542303,0.01990877398410216,0.030330583540224346,-0.049030880234445774,-0.00906059643941012,0.033958767215844586,0.03316165023923836,0.017397879670829095,0.03749329802247834 "
-"1082,-0.01393869856871785,0.024567824330529293,0.005348531404145828,-0.07521934319386134,0.04779438276594816,0.07712916800064085,0.016849762960114367,0.02748847468911601,-0.017989125968132534,-0.05948400957767948 "
-"1081,-0.015511378664445397,-0.008185439936568872,-0.027946125860740745,-0.053213166694780226,-0.05126606930970309,0.01376844373457134,-0.03926038526598556,0.05125611390650799,0.009124434493006997,0.015506454113812018 "
-"1080,0.016210629925734972,0.11687619538739598,0.007010734230238966,0.005392012319371516,0.01878197110137384,0.09174467187924437,-0.00847147626711546,-0.005885614705903601,-0.034212213769725885,-0.06672761294546221 "
-"1087,-0.02252557499027144,-0.026261710340799386,0.04558107999835873,-0.08316041454041635,-0.05221769828663683,-0.03726635156631857,0.02734506429777869,0.029132136994688217,0.004275095612919236,0.03561953314848155 "
-"1086,0.01719008741050577,0.007067589937303482,0.00942659328789116,-0.007591540156102776,-0.0011010176201272004,0.0017007866956219224,0.006800552243290054,-0.017372313748556408,0.005884502304451953,-0.007231679714836624 "
-"1085,-0.03205598655605064,-0.010017806059487036,0.08342026542505222,-0.048327217020163044,-0.06884174921554191,0.006838806904426384,-0.002745557595688683,0.0393228588918134,0.0158502216232446,0.019404124484424155 "
-"1084,-0.010109678211782453,0.006795188828768022,0.019342954026800394,-0.021679750501107896,-0.018256275593378564,0.01260778989203277,0.00213845693534294,0.021639933117946344,-0.003048196026763973,0.0027290821301569537 "
-"1075,0.016097179792884463,-0.03150536330863159,0.039669307493036154,-0.07337640178579798,-0.07168050133148965,0.017769569050346313,0.033829847520013265,0.05314793994324327,0.007561412493552427,0.009610376516986657 "
-"1074,-0.024515759749943918,-0.02688921318277695,0.007169355694831396,-0.01321354219833786,-0.007520473364552754,-0.004523872499151385,0.009090446397549279,0.029952473128048548,0.01983487553746009,-0.019403006157175513 "
-"1073,-0.10216717247928388,-0.03425078526776068,0.04976578723949644,0.0035888541517222683,-0.036412441924155915,0.05449146099909243,-0.02993414944156964,-0.024538963678798265,0.012194941458119378,0.011232165105129296 "
-"1072,-0.021325551758264415,0.007653172717196147,0.031186534628793044,-0.006817183989382897,-0.034069226135051076,0.04103694990851162,0.026249515055597805,0.020335047544456218,0.0037959975952678846,-0.0168412888356188 "
-"1079,-0.032905476155056644,0.004777944113404964,0.06148865319742168,0.005188567254040686,-0.07870862497016592,-0.004987946086909861,0.0455526016655552,0.05783998070823349,0.012927527638336175,0.01973040831287536 "
-"1078,0.008908660022644238,-0.043515468813090714,0.05882711128504907,0.004146408868248709,-0.04777426218523861,0.05430635704777778,0.07626339265829189,0.013236736133191042,8.232108773941175E-4,-0.07536408983262305 "
-"1077,-0.054460280548421704,-0.07352943760983932,0.12430362907297642,-0.07116758615873242,-0.13040388715393067,0.08560503609036878,-0.003364902385406693,-0.038586359443099176,0.0451024517265456,0.025000828197465068 "
-"1076,-0.002337744110116237,-0.01273575450795323,0.015905879661133746,-0.01765594082553004,-0.019263914197554126,0.005277525442668101,0.01852269861895456,-0.00587697783208253,0.0014087088769308342,-0.0035519282395943437 "
-"1221,-0.02417227193100003,0.009396232044972244,0.01846424170582785,-0.029655524794876507,-0.002616458333605163,0.021049738652898484,0.01050582978721715,0.01565857896421644,-0.007252734175858485,-0.004273642208637039 "
-"1220,-0.01161112345104283,0.005136709242207467,-0.005316092794973151,-0.01809487761243383,0.05513026938401625,0.010418183443260136,-0.01935810362570554,-0.03243626670916465,-4.4893039083281744E-4,0.0036575647908705096 "
-"1223,0.020859140693931875,0.0017548004539918738,-0.009571115738890511,-0.0025368290827623855,0.01804668910827722,-0.007847927181847207,-4.0473228056379245E-4,-0.0274311639394789,5.936616220680959E-4,0.014484402725542215 "
-"1222,0.00939904966582205,-2.479400643640551E-4,-0.01603836602827021,-0.0024843044687731853,0.034507707714088606,-0.004464560718999913,0.012648274904867984,-0.03375725293850425,0.006633038260426567,0.01663367710802352 "
-"1217,0.011613896040750596,-0.007916858583292167,-0.006081199964593964,-0.0062896603578565385,-6.815494648685368E-4,0.001122982966203444,0.0040389963394157225,0.0037790455611828983,0.015392388329653969,0.015317440355424929 "
-"1216,0.011401418483547537,-0.0030012889018351903,-0.005647110629402759,0.010297398587286193,0.02006932210690161,0.018152831251043482,-0.00123039777011796,-0.01693747511597046,-0.006787004393860654,0.02129673933049715 "
-"1219,-0.009341885401233782,0.0032556417838700683,0.012640863177034814,5.897369976014532E-4,0.02053872703602336,-0.01891453709820053,-0.004510453683853811,-0.0228655699773551,-0.008851598024218366,8.487141309741464E-4 "
-"1218,-0.026491750482830118,0.029082791555591923,0.04276599890940272,0.014903425690879345,-0.011511532252109609,0.025230375334866183,0.029744406042903654,0.021448557334724193,0.0010265510707174758,-0.0036285374904328504 "
-"1229,-0.007180799579782121,-0.025497896075519035,-0.01845043517754549,0.002786570904963742,0.07332040683988574,-0.024833605842546225,-0.024044068042725863,-0.05300408933216878,0.0021577888344587065,-0.005497731273869416 "
-"1228,-0.005106662851294023,0.004318694376908125,-0.012731509963650982,0.029707674570565078,0.04825355208154361,-0.009523263915017533,-0.017736422716792145,-0.032067504285845254,-0.02839143760973676,0.011648298294862155 "
-"1231,-0.005989578837506907,-0.022852104924122665,0.044825393813920526,-0.02129304341887682,-0.002439197456880233,0.007937099586192433,-0.0064243927022909495,-0.007198418277604821,0.001058389371320093,0.02075445651553481 "
-"1230,0.006517974465638895,0.005203696526817953,0.00467474863903691,0.014614647153193577,0.001998470989660837,0.006644993676257365,-0.0041649693832054874,0.032778735552136895,-0.026458116929575077,0.0160564710433677 "
-"1225,-0.02986287919171399,-0.04728294679980345,0.006634372359878754,-0.02971937398339595,-0.03297205870894847,-0.009145920967051286,0.018270017537518505,0.04740146860009454,0.0590630287461351,-0.02947831667668828 "
-"1224,-0.010081419212975725,-0.0528728242066497,0.04915668286708088,-0.060782845841041655,-0.08960611056469667,0.021094972173544235,0.018035542310399933,0.026113919373066428,0.08058422454701855,-0.0401210893230514 "
-"1227,-0.036278829645980205,0.027375062739855356,0.030738800484526284,0.019002716033112363,-0.017519192683937295,0.03147843616994312,-0.003736623432075735,0.018783749776977915,0.007970551301313706,0.008174737472325154 "
-"1226,-0.009589024158702615,-0.02060683900497343,0.03832186008361103,-0.014464225538879527,-0.005174426789463243,0.007317178886774992,-0.018502067227170033,-0.007402764361091307,0.03552454885452782,0.021961177023696415 "
-"1236,-0.010122344749438876,0.01786820150598549,0.011077993514868758,0.02351170525526676,0.0018157358738725283,0.018988546064359145,-0.006050764774259272,0.01976024869445696,-0.002904208094019519,0.013088961370499197 "
-"1237,0.0025566346500300705,0.008029672389139203,-0.008367979739841215,-3.853123638139174E-4,0.0172806577173596,-0.01979027230201835,-0.002029451274315967,0.00958436974813518,-0.009696424538298963,-0.01647727149996374 "
-"1238,0.010595778882731218,-0.002180780367279519,-0.013421385586475246,0.009652629706956059,0.04112747041513083,0.001514038685132449,-0.008648942145194861,-0.03200377581903562,0.016334691847393022,0.005616879871443268 "
-"1239,-0.017731857979584223,-0.005715040053183093,0.01878135566585548,-0.013650164173719807,-0.04343291565176602,0.030257836861547836,-0.005983572658270405,0.023796425155318414,-0.024588512110434408,-0.007038324324038625 "
-"1232,0.0038419706439426944,-0.02926823033103969,0.018789934088024277,-0.014182625711403295,0.027085437583778512,0.006238321695450112,-0.012904531402883945,-0.024327906746963727,0.03240766991648176,0.013862760202545453 "
-"1233,-0.01766743069177887,4.1848424895696865E-4,-0.0022563805998532323,0.0050872525226960145,0.02457360483730925,0.01668486539984747,-0.011463779842297038,-0.03829279052375668,0.002896199494659489,-0.004094943424587163 "
-"1234,-0.03454500327765117,0.011767213943637141,-0.0012761250186815365,7.109668604258115E-4,0.0525885137598173,0.008971574690325446,-0.01998147827004809,-0.020556508305869067,-0.021619855529669222,0.006366544688384524 "
-"1235,0.019975525167512744,2.2078884881159648E-4,-8.93845766687889E-4,-3.827962298746587E-4,0.020763018703123436,-0.0131577758857247,-0.020376785271592854,-0.016307701672355117,0.002654166518079264,-0.007766654086333095 "
-"1244,0.004331656306549875,-0.005542451589923846,0.0030007294391137455,-0.004413005321015443,0.0032865333114706894,8.284750508989794E-4,-0.0010485658369528974,-0.003465031438589403,0.008140534250417612,-0.001842331246485997 "
-"1245,-0.01224709548003883,-0.01844026470736626,-0.0029099499901205136,-0.02690634121588212,0.0028998014345359567,-0.005026137178937344,0.01835930096021401,0.00909443583521287,0.010332683745562793,-0.003082666387288714 "
-"1246,-0.0334278871659752,-0.01303796829982854,1.8476577928247707E-4,-0.020056557338394284,-0.011006526044099909,0.011746413517063412,-0.04045715649241517,0.015256538633523548,0.04364186706215237,-0.012864514249104808 "
-"1247,0.006020623661407331,0.020431635343569163,-4.5332696063290786E-5,-0.012142780969970861,2.9231149456702244E-4,-0.0034496069502681893,0.04363720163486197,-0.01254327692102565,-0.013201814153759216,0.015437853084204851 "
-"1240,-0.004896618389183179,-0.015432295979599867,0.005940668374500814,0.004878798444067609,0.010281256771296952,-0.031060704003160154,-9.607173235436653E-5,0.013481956571824572,0.004035335002051163,0.016168721127080114 "
-"1241,0.02205995948009288,-0.0027111206602414345,-0.010769596325218428,9.774551233101279E-4,0.04217216119795886,-0.02909336453268757,-0.003912827855289283,-0.043318109104972816,0.039966260375190646,0.02877906599128369 "
-"1242,-0.011428595960989085,0.014289352402531293,-0.009724285387034034,-0.011676978335939196,-0.018329640940765765,0.022744047036901638,1.6633843489480935E-4,0.003211622308924165,0.02186954801373159,0.012665928377106722 "
-"1243,-0.017642316775478364,0.0025945182985087196,0.008966701673817688,-0.006994749861929666,0.008485188638526037,-0.0020672694045139437,0.02166123307922291,-0.01927450945869353,-9.614355768999332E-4,0.004379322886017032 "
-"1255,-0.002999295143035217,0.0028712352085896726,-0.005417795759296866,-0.011214486612610559,-8.858813829315369E-4,-0.01998544615327064,-0.0030722760865264085,3.655153844389918E-4,0.00600554578794381,0.0030443322423351227 "
-"1254,-0.01033862158478682,-0.0117054254103267,0.013367761427331518,-0.0032350894799089208,-0.014119489049897443,-0.0021285306321788006,-0.0018687339757116107,8.581694520459349E-4,0.013970544665348267,0.005666285415570498 "
-"1253,0.0070723423365972,0.007334259980393412,0.009783040927230946,7.292486689454079E-4,0.020959455485831714,0.014181191401639846,0.00249992722034471,-0.011608841861127154,6.733950371980832E-4,-0.0014609531445706231 "
-"1252,-0.007187909599674242,-0.012095539513546617,-0.021518696115499635,-0.020066716879009273,0.01624378113518059,-5.29792083687672E-4,0.019280316371078077,-0.0101230919834583,0.004255254152852716,0.022191259279626896 "
-"1251,0.00939035134116382,-0.003197736121255375,-0.005961524435336303,0.0011450958307586835,0.01450245793970157,0.00442950452093921,-0.001150803674606377,0.002490950328237514,-4.812004008619828E-4,0.010537648975107472 "
-"1250,0.016391427181702774,-0.00557340690538792,-0.020877699841490432,0.011268405870125914,0.029943274572837176,-0.023224816712867254,-0.009023554156797717,-0.016353080869309797,0.0032578071182670938,0.01994637851183241 "
-"1249,0.017291437115193126,0.019329625616476925,-0.021167107919210913,0.01648445818086268,0.05096057778960273,-0.02354598430322315,-0.01894561563118455,-0.0297585759328096,-0.004034210947307073,0.01142353099082423 "
-"1248,-0.024499719245962524,-0.009542192264760333,0.011513341432717797,-0.004477664955568309,0.01555755862133511,0.01422602565695148,0.0069878356507521175,0.009078611810302345,-0.017007696375150896,0.019489998285843493 "
-"1263,-0.04587240144821805,-0.02952519522601935,0.04338196368895513,-0.02369828782219324,-0.0606509985812769,0.032850773984438655,0.026192863594723847,0.03187217743737995,0.009951732903704926,-0.03659791984255005 "
-"1262,-0.011578905126169568,0.01670433979532793,0.011546368941206064,-0.012730247963310175,0.008750152734638203,-0.011550746320913663,0.0031426661452731565,-0.009778663854374191,0.01031370261906505,0.0026243233830312057 "
-"1261,0.0042037529554470755,0.003962668313945828,0.01648384193296279,-0.017856640589120242,0.01733972638509458,0.009016096046306892,-0.014312548674467677,-0.01824842535778166,0.006982265136349389,-0.005437194521902214 "
-"1260,0.0018522127650538627,0.004570415990007676,0.017460012173876212,-0.00811266173545479,-0.005864697507171039,-0.0071252265042829905,-0.01450989746209256,0.007653728331180079,-0.004614838740706236,0.01219617968371005 "
-"1259,0.012183484217733104,0.002136945810126685,-0.007761390683376553,0.026816672600095442,0.018411786180039073,-0.019239196856567106,4.996922824745702E-5,-0.01555893567708452,0.003955250138390876,1.833253434581556E-6 "
-"1258,-0.006068015001777577,0.02266927247532737,-0.013298920010152615,0.014344186890928902,0.019027624875429475,-0.001934468066620536,2.058773793481616E-4,-0.01452153023767372,-0.016218220890440862,-0.0010261656540059018 "
-"1257,-0.008626782941505375,0.008243216167206642,0.003403530351678499,-0.004689951054116289,-0.006333171780303869,0.01174278946778009,0.005126764037975103,-0.0055707369378812654,0.0197189974717262,0.016500867893065766 "
-"1256,0.020533607581469326,-0.017431046098626297,-0.00487666123596263,-0.006802994356633174,0.0014259255612470822,4.76843616605763E-4,0.01247737777889058,-0.01939360614576596,-0.012088942379345394,-0.01136962689727789 "
-"1270,-0.061386011962388194,-0.018031255936676226,0.05257906283552962,-0.06789058525318199,-0.10009170091153566,0.05839753414977839,0.02825190574079028,0.06621982712334468,0.01931164445727724,-0.002901198289583507 "
-"1271,-0.040423849503604205,-0.010333802995117457,0.0395343813160381,-0.08056945053430767,-0.08361006015847852,0.02739732875979484,0.014591795315443953,0.04187259248451479,0.04557899612320916,-0.012990403469112666 "
-"1268,-0.018369199129964046,0.005173521616660178,0.005020812751564159,0.0019632285866115072,-0.02429143325357864,0.0017778533104560294,0.01596526841142437,0.02018100996687946,0.028618854109676746,0.018872179025573962 "
-"1269,-0.035226708785693915,-0.011669103446269266,0.031615802773083915,-0.02598265377269765,-0.030795563220587963,0.03227499962904253,0.015185015842061125,0.04979854824067422,0.01816876311696236,-4.5765881128140696E-4 "
-"1266,-0.02642365768456504,7.441159165068254E-5,0.01457149764592147,-0.004599777679565884,-0.016162010656918857,0.017500233499736957,0.008582699179605939,0.027497476190167337,-0.00276696286039914,-0.004480419838788894 "
-"1267,0.00629205889371608,0.03657237247706501,0.005403298191782524,0.050188443245582054,0.04681126840347589,0.0024632305808974823,-0.008504888896676829,-0.028058867075657315,-0.01182939107683104,0.010832862716786922 "
-"1264,-0.04165502824884309,-0.009152409212266129,0.03965665257101165,-0.08249161057697045,-0.10473531938903706,0.03145913049530387,0.04005815023636902,0.07090221032001595,0.042814821792939176,-0.03023506371816042 "
-"1265,-0.02746925712752184,-0.008730106829876757,0.06170178230481441,-0.06609241040918151,-0.12234199331026763,0.035686300591060184,0.05003960223542559,0.04948001124063311,0.053557528471512024,-0.029798700290699885 "
-"1278,-0.021065009878517473,-0.00368274113706798,0.0463298571105048,-0.04840510178090123,-0.06877039589323038,0.025425118691589855,0.014240810253530268,0.013044430368178797,0.04599376142040446,-0.0236604510992125 "
-"1279,-0.008211235323041495,-0.012624280806934994,0.002723063834613119,0.002248338491904014,0.05729804590931353,-0.03527982438553935,-0.02317678592508628,-0.01317622082508715,0.0031058205864266906,-0.012725576504884718 "
-"1276,0.021394993946848753,-0.0028038767021338552,0.015450936199518536,0.008515747151559293,0.035510301524053794,0.004214760625164681,0.009795887007055887,-0.05988829203462402,0.034338118043798695,-0.01296393708693952 "
-"1277,0.008672954272428184,-0.03546028205306267,0.03269300843259785,0.007770084329069084,0.011746399611535546,0.01667395840628698,-0.02242875096901436,-0.003537621286009222,0.009687459008750182,-0.006450937076684089 "
-"1274,0.006241892793511399,0.0038746702434634605,-0.006506722383511378,0.023350755927944857,0.028404198446880462,-0.016121937018006967,-0.016730651468265186,0.0019554354980081995,-0.011000128206266389,0.007484219512594056 "
-"1275,0.01645247152262654,-0.023521463080241143,-0.024068593261650482,0.03692932972106534,0.0727574260527988,-0.018223932963997866,-0.015377090766863895,-0.057712322909639374,-0.0033931901998631117,-0.0022739218549364297 "
-"1272,-0.010562956692785074,-0.013695276750591515,0.05024977110335542,-0.01243985196435545,-0.058585504392247335,0.020278546174234083,0.017192808920495517,0.03885495142059385,0.013994003504561306,-0.01228165353451426 "
-"1273,-0.04430189150331401,-0.003148072210319159,0.06018213968113723,-0.0516436957104114,-0.0996789269482805,0.02995569462976234,0.02770414783366726,0.048129468932005516,0.004274410940387341,-0.02272051000210695 "
-"1202,0.012946744385620539,0.009073949127474132,0.018866205453386554,-0.002361266764967755,-0.009285730087465605,-3.3308862432062424E-5,0.010259173566046055,0.004890937231466412,5.35411991924304E-4,0.0035694347972685383 "
-"1203,-0.014390636669895499,0.008182120825191905,-0.011934822714544017,0.013418140150833723,0.022212528469324377,-0.03458807826294092,-1.0116232952346439E-4,-0.0226115474116357,0.011108282292179248,-0.007442833239175373 "
-"1200,-0.012399561542568764,0.01439648101019638,-0.015118105060520014,5.973158099115135E-4,-0.0013998313694680942,-6.717164422516189E-4,0.006662541048096247,-0.013153856556275365,0.007317451711531241,-0.00592772568690171 "
-"1201,-0.0013601314205103714,0.006383304859800477,0.009605771341889602,-0.008169349896847517,0.0023329611841745802,4.0959084803548286E-4,0.008279541796450204,-0.004812148017688881,-0.0012195102536498095,0.001800124653345076 "
-"1206,-0.019056893100388467,-0.0135531400076103,-0.02180497578249931,-0.013449164284213708,0.012974872441003947,0.012087753390692402,0.007345156230586836,-0.004290071414820447,-0.012033219830230552,-0.004614086588169636 "
-"1207,0.00886941177237951,0.005644532120988495,0.0030540831467017505,0.0024596869106100067,0.008197008938526477,-0.011401503111286614,0.00431779353893807,-0.002755409722075768,-0.011788309899514772,-2.231383515991633E-4 "
-"1204,0.005929391050547232,0.013324012869092435,-0.019419714261196958,0.05325025714422443,0.0431642659702626,-0.0035236972164649463,-0.02371033968054114,-0.03965340650103976,-0.028785048866678986,0.028110989200804258 "
-"1205,0.011065073207495063,0.014256751939547587,-0.026455005788395044,0.013250649608367112,-0.0036929552775261916,-0.028987482603577818,0.01655041044431674,-0.01661772856000467,0.01695805030023403,-0.005995409203080653 "
-"1210,-0.010941502898892902,-0.002870626651923264,-0.0030469622716041153,-0.004973741359067252,-0.008197050802802655,-0.017391078284062847,-0.004940961417786713,-0.0189225692693123,-0.002524106465133904,0.004553861766472057 "
-"1211,-0.00377028866223445,0.010798589083260807,-0.010220762462158663,0.013066618244836306,0.030210271018055783,0.007626382740270843,-0.007511845515986185,-0.023810537640139625,-0.021856881155931936,0.005293755123015265 "
-"1208,0.013180807063745985,0.003611781515099347,0.0022770192435714273,-0.0012466502971288196,-0.01629020923174864,-0.0026713471572638488,0.0056627784969021456,-9.016519684177177E-4,-0.0025756410315575773,0.003607665110045468 "
-"1209,-0.003646246028014782,0.0310919321611577,0.0038467252860193858,0.016770868902293273,0.07191952070673664,0.011319247765284425,-0.05241330852911865,-0.07439404859167321,-8.37988776670585E-4,-5.84486371009371E-4 "
-"1214,0.005829326466617334,-0.007764215342359554,0.009072806771969023,0.0047401442470462124,0.02025551769970571,-0.015664025994738904,0.0044475908773223905,-0.01317026144758711,-0.016547755000857815,0.013466809131779358 "
-"1215,-0.010954624829753984,0.006847696679040467,0.008233845090632356,-0.0022509082847118438,0.006270884281322107,-0.01199332828320052,-0.007114742717424075,-0.005552946853158326,0.0030111172181212357,-0.0036714713951306603 "
-"1212,6.707729655242678E-5,-0.004860313646312873,-0.01882555058958855,0.01667187529202192,0.024070780249836003,-0.0101606299933245,-0.01700634733217127,-0.01569470427516499,-0.011137636525705619,0.010760459786399359 "
-"1213,-0.002093779412387925,-0.009091420648312807,-0.0022285174148160016,-0.007642643605748829,-0.012347297196390885,0.01381388616657157,3.2326987974236896E-4,0.013366450548616899,-0.006737720984719705,0.0031765886152693166 "
-"1375,-0.03544081624950591,0.006152263425950226,0.028496780807235753,-0.02866105581814458,-0.07291609614018678,0.0064389637120062905,0.013058682926730385,0.04118716894998202,0.013318503829742053,-0.01252738267064391 "
-"1374,-0.0010307639585890407,-0.009607216278548367,1.0787133195671896E-4,-0.005793322313754731,-0.01668934438757265,0.007698887936672766,0.003388793318984504,0.03365197843349305,-0.022582288618053677,-0.006806887903995404 "
-"1373,-0.02409631774847758,-7.074742751356523E-4,0.019224295791967813,-0.029674396810742486,-0.03582089968141929,0.018761603499558945,9.092646470863675E-4,0.03831449916277055,0.005350623979067503,0.010433963448672605 "
-"1372,-0.04241207561808054,-0.04493169659798205,0.07194955871241811,-0.1339706613693399,-0.13323365176162894,0.05360401260751253,0.0624524406880276,0.08124975711986933,0.09592287450292772,-0.05088846015833502 "
-"1371,-0.016930189639767373,-0.0125558017409849,0.02219473514906381,0.019313017929050935,-0.04584042879023855,0.01724723916043677,-0.007056734870552964,-8.07440419832144E-4,-0.01101070240426738,-0.001906461752258647 "
-"1370,-0.021734446269427717,0.00763301252140415,0.01570566759225292,-0.025109910539188866,0.012525452790656675,-0.010092156227162679,0.008585766178793362,-0.014166026859755505,0.009509401706951328,0.03466449981171826 "
-"1369,0.0048166760472103266,0.017812227367720913,-0.011149236106041398,3.4612539243487493E-4,0.004802851271599361,-0.0012311445846892807,0.005823017273000847,-0.01085856726082999,0.004192364012863908,3.070112747786305E-4 "
-"1368,-0.007497658641345674,-0.002420262535676533,0.0022081705094377196,-0.017853274425334267,-0.004808945788306498,-0.0198632488827351,0.0029005462693094375,0.008437683676879375,0.013878048875320249,-0.009520087798974371 "
-"1367,5.474530818219472E-4,-0.01001958118550058,-0.007200277658221889,0.0012188864299383867,0.018630711467077624,0.0062990771954551435,-0.01206220274189674,-0.025417443873385126,0.004293547826385853,0.005931464222214797 "
-"1366,0.0056737094961183485,-0.011980858641572794,-0.0046953117158138585,0.009107523563686413,0.012562632341667693,-0.01496198453493836,0.01790794143918025,-0.0012993303357351363,-0.007867442458018245,0.016473307231144988 "
-"1365,-0.015524907688348726,-0.002393407245059767,-0.008654764850788308,-0.017445924956224185,0.009462380829277733,0.01306178364574188,0.017380488034775397,-0.005786098802204287,0.009133267561024385,-0.0010391061054960944 "
-"1364,-0.008329059302562775,-0.005905465958141101,0.006346462446411125,-0.025776166918937003,-0.006006227650179345,-0.009308391438466745,0.02113557857851441,-0.01063337392988423,-0.0044811780711075016,0.020228648160159388 "
-"1363,0.007600792726243679,-0.012410953402629757,0.008627563641016769,0.008822273781237844,-0.012101161807668086,-0.0056143225931744156,0.008555086426504082,0.0017428604170887081,4.338571741792202E-4,0.005935893286515376 "
-"1362,0.02081316489235303,0.013606417333859628,0.0016191574767766743,-0.0013815637999854992,0.019322628970064322,0.013354593533080454,0.006173875197175379,-0.016951787029286985,-0.003268810693760397,-0.015811266685422657 "
-"1361,-0.003110934716780123,-0.00675835040623466,0.009092666304552155,0.005125479791711187,-0.012074010321311609,-0.012249960515315926,-0.009123736457724473,-0.008553978827214589,0.005574757450814352,0.016632428310719784 "
-"1360,0.006165883338860352,-0.004485465249379293,-0.020749933369051263,0.00706220639772356,0.0034436684002638975,-0.0057649335691759025,-0.0016942383575061848,0.006250271700695087,7.930579327535307E-4,0.012161253637667768 "
-"1358,0.036648915317862546,0.01201837668241769,-0.023952994675786234,0.03235176543884349,0.0554831346346145,-0.029614864243755194,0.005299525750437413,-0.05418010186013756,0.0019828590495899238,0.017065499632833287 "
-"1359,-0.011723841661266424,0.014768893397232287,2.738191008305031E-4,0.0030329660629069095,0.007539932770135925,1.2216813486701713E-4,-0.010115754511488563,0.011914792803384455,0.015176690782048897,0.0013469778422016108 "
-"1356,-0.031866680518236434,-0.010379024703993057,0.035905594431639654,-0.012587497100666546,-0.023852971339262105,0.01802571719543496,-0.006258341286904479,0.030414666774910344,-0.033908247266036605,-0.0035974529986946583 "
-"1357,-0.0022599543582953532,0.0035791292933373534,-0.009207960637356839,0.017359227085636537,0.0018754774664326965,-0.005120402999629066,0.0030102058817697563,-0.011826169599181834,-0.0019030170847604995,0.005279253532947648 "
-"1354,-0.002118235100149943,0.008145126725324072,-0.019956975309068068,0.013126511299510276,0.014164374162423781,-0.016731836276592426,0.004300367748641633,-0.023905414815674816,-0.0028754917222109633,0.011119930931263514 "
-"1355,-0.003793668457633486,6.136451930207778E-4,-0.009042584451259524,0.006437586641235963,0.03847689510661375,-0.009014882901595089,-0.015318623885710241,-0.012152929320534453,-0.016267255063804553,-0.008895359660194724 "
-"1352,0.009433729800960916,9.890067138115142E-4,-0.01865099500805337,0.012367543015803622,0.036127546726771376,-0.027002399306698954,-0.014771621049283925,-0.01954804942408512,0.0038109325496883516,-6.939752971669134E-4 "
-"1353,-0.0027564279786083164,-0.012867095849261287,0.009614809435492191,0.002533117200480593,-0.0013095247360456112,0.014140556142945248,0.006266042940297506,-0.011282265987134584,-0.0051779085505854455,0.006518737857451482 "
-"1350,-0.015919947507624068,-0.003757754072607962,1.3491999255539494E-4,0.009205377712968758,0.054362392319435925,0.0016953733825127253,-0.0172962651395232,-0.02548948895571763,-0.014063812664526651,0.026146397405178833 "
-"1351,-0.027827966429046225,0.013274925020846097,0.010817420562558949,0.004784269344152186,0.05146533990979452,-0.010148716003899367,-0.0030698071872218304,-0.0321989024636729,-0.021221939808772856,0.004101257278793675 "
-"1348,-4.417105678871275E-4,-0.006045243556220756,0.01904149965203046,-0.009876199185592306,0.015156105359354516,0.02205221042677468,-0.008939823970925085,-0.0123507831058699,0.0030258143550116324,-0.005335834787954467 "
-"1349,0.00751641120377651,-0.023405063730356678,0.00424835564449971,-0.005723228929891581,0.027811206364483334,0.007531125746236889,-0.02140881525793746,-0.023957858451782672,-0.011385536220885735,0.013792793130863021 "
-"1346,-0.007068785335681445,-0.0023550121448869888,-0.002611369505985708,0.01284098171175217,0.045725400848803666,-0.009561206760206614,0.0020800135937550854,-0.025838491876685504,-0.001043777441802464,0.009079805528538782 "
-"1347,-6.616670593746876E-4,0.003071268515928363,0.002486369418063762,0.004258068515871596,-0.009691606310250525,0.002685415663966502,0.003952084630225481,0.014293098631750855,-0.010198767184476237,0.01774987550698008 "
-"1344,-0.005946106134226828,0.007551089998331877,0.010596679790693533,-0.018662524001939695,6.989525491124446E-4,-0.004694920523743629,0.011982611865297227,-3.427526435187322E-4,-0.03074029660492938,0.018732324716266614 "
-"1345,0.00822441725256961,0.00471102724335462,-0.018797562980876405,0.038329029755248004,0.029711285070553806,-0.03225945330426086,-0.0010857386347594314,-0.014519419441293074,-0.043378723684064584,0.01891776237630078 "
-"1405,-0.01866110506420052,0.0075534815545367185,0.012094975061831638,-0.012852335110727807,-0.061304328662327996,0.02450915718056372,0.021013582314778394,0.040634693778412154,0.0037621556602773663,-0.042831372232470265 "
-"1404,-0.006740634312570658,6.993988022878578E-4,0.04130713592499932,0.008911093625349212,-0.03800251369205168,0.015329418582186437,0.012086962086224234,0.04558810685703036,0.007871154356587317,-0.013827395484680021 "
-"1407,0.014240384455141664,0.0028748945985944364,-0.023553999254556462,0.048993945780831404,0.054564787077592984,-0.003136722269582364,-0.01751338073475508,-0.027202276150141407,-0.016007362360217214,-0.0022302029884476524 "
-"1406,-0.0017184973636269936,0.010093048774552589,-0.008476838561105725,0.014173500113410637,0.029166772348623613,-0.003677076932579459,-2.129848407908902E-4,1.0872612282203123E-4,-0.001243990673679444,0.009905234925172505 "
-"1401,-0.032623784721275674,-0.03604278707676595,0.03606522826300003,-0.04913219167108595,-0.09532937205699392,0.03327909842155626,0.034588268528472826,0.06241695612476021,0.008082336758143403,-0.03957164281450297 "
-"1400,-0.03184060532850215,0.0023958219817810586,0.04846116458534926,-0.02483292826321014,-0.04723567327969148,0.032155268021646005,0.015679250149328427,0.057022374899171946,0.002941443979920717,-0.0026138689873786937 "
-"1403,-0.04387244425350836,-0.012437019292521626,0.042358725234039926,-0.024690638528973834,-0.045170813782473646,0.028225830456235456,0.015952468089461814,0.04344433355198851,-0.003369296038758028,-0.013385610158194568 "
-"1402,-0.01673278590592117,-0.0031427590485809146,0.03693579763826202,-0.06123074652969329,-0.06707247799507923,0.011510271016961338,0.0273516103338026,0.047811661074358525,0.040505361639365765,-0.017672463797553783 "
-"1397,-0.006342758479243507,0.009926527689502845,0.0018298217431594393,0.013850112054813164,0.015524213659139023,-7.609313035350572E-4,0.013011432170099677,0.016749497757585337,0.008480270202171847,0.01456077928599498 "
-"1396,-0.01646049249588269,-0.021444712310869727,0.030210968531395044,-0.03435737468298592,-0.07746221467880349,0.034002543014289226,0.007417940715162283,0.0565964717014549,0.022980640264003566,-0.005821503544150373 "
-"1399,0.01099482153729648,-0.006142272816716584,-0.011923433191064179,0.022548745706252378,0.007275714907977291,-0.007913434727234927,-0.0019230387528044936,0.01195920856906537,0.018315562064462585,-0.0036681718710883998 "
-"1398,0.007998332537337366,0.020798170961558452,-0.042890096188203136,0.0565717549804776,0.06459080255410171,0.01190764706879923,-0.02105819179129252,-0.032372846779509745,0.00234841169272523,0.007671313497051741 "
-"1393,0.022973502344108634,-0.019865232308581057,0.02094227625707394,0.02883068074659198,-0.07256283145255775,-0.003792548539788579,-0.011959737193706665,0.05742937018101551,-0.027284776340783322,-0.010067944070583536 "
-"1392,-0.0092376735560939,-0.010528503349924771,0.011312785006962181,0.0237857181330184,-0.11806153523270986,0.05722597904230239,-0.03784081657850342,0.0862672131294976,0.02407044289024281,-0.02324885851725814 "
-"1395,-0.0193778655549074,-0.007489921547206126,0.03247398846015306,-0.036115409595591404,-0.05493893669566845,0.016766950746644686,0.021090957590707272,0.028739566893526934,0.007691941078846982,-0.015530400775501023 "
-"1394,0.017482690125773352,0.021539520457265295,0.016072124470604115,-0.04171396250709418,-0.16794651732315688,0.0012164502609774504,-0.016520892668607345,0.12077981987959648,0.040419552274344676,-0.05701947255197452 "
-"1388,-0.01880507921012095,-0.03535537492611686,0.08117040519002443,-0.10134407398866757,-0.11605514361588551,0.03473469690679432,0.014679518725587528,0.016755530959936316,0.07782757136089682,0.006577167806461124 "
-"1389,0.01354630254227704,-0.031004561601776243,0.007116011316132426,-0.002383132980886623,-0.06174272140311212,0.00456998778540002,0.005753934567416382,0.0564851617656602,-0.006083500397647283,-0.01185821856862466 "
-"1390,-0.010281244857962708,-0.02947809100776671,-0.013448714634873668,0.028797395184936972,-0.006334144662932858,-5.65641417653436E-4,-0.00927532078165951,0.05826050178212604,-0.004777643643684214,-0.025494014283333654 "
-"1391,0.012491328246329375,-0.012633195278765573,-0.01104367076065545,0.04317813355698493,-0.022245424670322828,-0.018451243346782657,0.018215563733012658,0.08341995903806317,-0.011144870259326907,-0.038894326565042596 "
-"1384,0.02384872726083315,-0.0487076325838186,-0.014885105805366401,0.017136698677162356,-0.12948941612898437,-0.02431247805512402,-0.014880720231397068,0.11065658462848771,0.04651353689400139,-0.03175831942264167 "
-"1385,-0.003633825440996879,-0.026528822388811824,-0.00880122013900193,0.0278689808307852,-0.03221845024122469,0.025853776443231096,-9.943142501934947E-4,0.0018714367623718267,-0.028245001875605098,-0.011753098328792566 "
-"1386,0.01996163464115072,-0.037331628676387646,-0.015685997490450854,0.063497924338038,-0.06830696203921444,-0.037673648193802485,-0.005114834782799011,0.07631884946078704,0.022301470888084866,-0.023847928740709276 "
-"1387,-0.011810694512575787,-0.0217807954153895,0.03025245273250096,0.01972285526293071,-0.0834216051099594,0.006702986557789659,-0.01312640323263312,0.04432005783993782,-0.011926432797469166,-0.007624259016077443 "
-"1380,-0.06970293628478,-0.056333041422866034,0.09669201003617574,-0.1597996929871309,-0.18145529435177735,0.04025119831427782,0.08160403688776287,0.1372941989798239,0.0797775975518406,-0.04631607044168666 "
-"1381,0.0035161355121264,0.003924129401073554,-0.016785940249312292,0.01254244675214234,-0.04283872412697426,-0.004463824302145028,-0.013969510908479572,0.05636975903131537,0.013293093687797578,-0.018006139520670313 "
-"1382,-0.019338425578829144,-0.010978599749258569,-0.017800088818353512,0.021780103968456203,0.006743760028974969,-0.00804837406722395,-0.015695324921839823,0.026683084438420466,0.02169988064479056,-0.0430501584837572 "
-"1383,0.02780726200059378,-0.02146858771710861,-0.009295840868179715,0.042669336289336154,0.002214811649655327,-0.005624051445526623,0.0073421144311229735,0.016119961700299595,-0.00996593477190993,-0.01522160365248108 "
-"1376,-0.015955820994530648,-0.03969377592165153,0.10469308909155046,-0.09704368811309537,-0.17807457237119345,0.07730682290493616,0.07011035540203249,0.12140998364517079,0.07765134079585488,-0.04440120681951793 "
-"1377,-0.0019837461136638663,-0.03387340558115751,0.03270556482743209,0.008825270957626833,-0.04487688240168101,0.011848075074940081,-0.012017001476465549,0.020439622466180606,-0.019866732672678192,-7.391192289011878E-4 "
-"1378,-0.017818420636379485,-0.03853125259166539,0.10891798810621384,-0.09145868719168843,-0.17575194007851772,0.051766860763616675,0.021928982364677878,0.08838530878604088,0.061314271167211436,-0.018102907825182698 "
-"1379,-0.010834366192628115,0.009930586045465302,0.030379302138095813,0.008600122528911529,-0.03862265673769541,0.014584149456154927,0.002671067906975068,0.029220048620086918,-0.02527625253280773,-0.011863841763522709 "
-"1307,-0.047898361192189993,0.07172075418035952,-0.09711005955618748,-0.1808029025255719,0.0021595189579492954,0.04717777294995745,-0.11538867018068714,-0.020306383101678205,0.025998633598868393,-0.07857966680624204 "
-"1306,-0.04909931333494044,0.01582412743291878,0.0021470996219880778,-0.0018546644711148273,0.12030560154706219,0.03593873700731684,-0.027120919518482712,-0.1042766459676537,-0.030354269816353825,0.012866091786595523 "
-"1305,3.120894448168405E-4,0.014575931986686483,-0.02880470761221695,-0.025892925246707558,0.05079055754760153,0.03696221910022927,-0.045965963530808576,-0.08727066825375081,0.03372436502528623,0.014943327534399033 "
-"1304,-0.006465834610888908,-0.007199114692933377,-0.013233054949531833,0.009205652797829582,0.10285279236866117,0.0028891268442063516,-0.031578779998735915,-0.057185864746207675,0.012802612669984241,0.0022269804192569737 "
-"1311,-0.011491234499476496,9.334939390014504E-5,-0.0014425503142760374,-0.010730840385453732,0.009680171196993572,0.0045737774082114605,0.009263206192651467,0.004098916765142342,-0.00850978456471941,-0.015629178324149017 "
-"1310,0.009995130016410964,0.0026422215199218167,-0.0040789433540152865,-0.021302907646982987,0.016753168231657678,0.014314954846204327,0.0040840903542962645,-0.0013427732241578444,0.010770230485314133,0.0037334295658600887 "
-"1309,0.007506417430044039,0.009403537734785104,-0.00591583403855058,-0.015493296273436858,-0.015727029872726655,0.007290486632517855,0.009997317722347477,-0.02054819926926326,0.013579670090381593,-0.002123573756959592 "
-"1308,0.014337900065026804,0.001893946598461687,-0.013000154789514712,9.08355151108142E-4,0.002071460051274665,-0.002026017066235571,-0.003389898162327554,0.005744364650357374,0.0097134088039814,-0.0052618320944147765 "
-"1299,-0.03372166537067885,0.011526559276676058,0.058541560030067157,-0.05927244577909723,-0.05206209047948305,0.03130617752390123,0.015134100426433428,-0.002099742627789829,0.054254209438479806,0.0022988233240643524 "
-"1298,0.009971264094755617,-4.0485924971292946E-4,-0.048024712413618234,0.053773210590784375,0.13447817807111412,-0.010806308711763,-0.05090750796215082,-0.11051777569472719,-0.020069414168182895,0.005912320951347191 "
-"1297,0.005193117710850181,0.012099527364704129,-0.005474980039071685,0.03711237250892443,0.12767224721103287,0.02056527211955732,-0.026845427018928024,-0.14292331797266386,-0.01752388646607425,0.021278347354601126 "
-"1296,0.014142141969658108,0.009569955211442965,-0.03223055992593031,0.06079479253224075,0.12037030338914266,-0.0070648391586463416,-0.03752653089380193,-0.09625653141333951,-0.018364186114687802,0.0032455661417993527 "
-"1303,0.01823260075735079,-0.009564430552359381,0.005750160740263887,0.012296516954923285,0.08711408834606729,-0.01172594337777227,-0.002415004087084577,-0.06624137871388355,0.01624457216741987,-0.017621922166739364 "
-"1302,-0.035185432502887,-0.01963734479379481,0.009001152780258865,-0.023803230806047262,0.024709585746326264,0.00669954433830804,-0.025939678213947957,0.014436379301949319,0.012801959571968988,-0.019828063367205783 "
-"1301,-0.04075891807914698,-0.01642945879074712,0.09853925398232384,-0.14849523667092615,-0.07461654789801263,0.0521996654923864,0.03261311945081654,-0.002576800223668355,0.08166545020384983,-0.01124897672411823 "
-"1300,-0.01904140089860109,-0.046356667963650344,0.06853054001567607,-0.08489248093455616,-0.1392120664578813,0.07170714608243244,0.013546937601565782,0.08868767108401544,0.04541706251155439,-0.049394889112960305 "
-"1290,-0.02962085684678824,-0.018942706106237734,0.04866612858591515,-0.06987125277900104,0.011583902126992432,0.012139400068318108,0.004424868785868284,-0.011823832649425946,4.1810481351331073E-4,0.026552967073727975 "
-"1291,-0.03940749782543824,-0.02915292090672823,0.007393817810542823,-0.02953897224143287,-0.06143056135625256,0.02722506428256073,0.00807180630925237,0.08153269525280049,0.02649104050978778,-0.05829402935462246 "
-"1288,-0.04672702377487636,0.004923203774433973,0.02332012316101167,-0.04353317507812157,-0.033493168180465736,0.016688547069906093,0.025865883739645358,3.4056268590569073E-4,0.010068213493018417,-0.002837219910514036 "
-"1289,-0.031080348022045998,-0.02162417947478266,0.07729817069612056,-0.11869719024209387,-0.08717048562267289,0.06645326645926831,0.010669881375762962,0.02642056219984318,0.05832330755740846,-0.027710738858952685 "
-"1294,0.01910057949751909,0.008964737125547647,-0.009065438374735963,0.030359379950657354,0.04028040386141036,-0.007360341618433865,-0.01323288954886145,-0.01411822551052051,-0.02059584690281386,0.012170695089554573 "
-"1295,0.011727314833975086,0.0024304595819294754,-0.03548723829009496,0.021226797195956115,0.029399779979003192,-0.010356363706133206,-0.0014467301683510445,-0.014808172977841724,-0.008956143977479415,0.009779751928583246 "
-"1292,-0.053447178474983634,-0.028686225324860686,0.08144158082484543,-0.07481073396339631,-0.021409352818552965,0.055002125259976685,0.034821193634894596,0.02936261654869528,-0.0481117540232245,0.018532181254198383 "
-"1293,0.004290930860423158,-0.0018080617937846959,-0.01606045068461348,0.013634752829602302,0.04232423816684999,-0.010515959758010746,-0.013450404231395936,-0.027585468992774604,-0.026364634530491815,0.020822426904251297 "
-"1282,-0.05141739236478841,-0.0653578927546736,0.14976797903352324,-0.13170888256731442,-0.23699753098621973,0.11893460826591105,0.028878556431092654,0.11160336827515752,0.07801575963975334,-0.06800507972652445 "
-"1283,-0.10394799469746518,-0.028142479888255918,0.14047806792874737,-0.1804442269818408,-0.14144807556426503,0.11374562887841477,0.04226627743373604,0.06407325730413577,0.07919942495335323,-0.037983822108327084 "
-"1280,-0.011787046761361575,0.014417828377582442,-0.027417265585729027,0.024036463872382684,-0.03504148277997408,-0.007675520491293195,-0.050173106523319244,0.006859441192152931,0.012093825714738446,-0.023487471181970573 "
-"1281,-0.02955958088381,-0.0049984901086586675,0.03147839886663635,-0.04814082886970924,-0.044780675170135904,0.03774046501438702,0.019970562276325998,0.010045459305622883,0.012851894968868002,-0.017857779481677837 "
-"1286,-0.035712881633944274,0.062113316722435384,0.014298738194602832,0.03052802185476315,-0.01372773669191989,0.007721897878831268,-0.00350995863761228,-0.011857872275352918,0.006709973508514293,0.013228264798150403 "
-"1287,-0.05485823138933313,-0.01906589555338176,0.06175308879754117,-0.0876741468991565,-0.09380708838915654,0.05188957130657572,0.02309935190978306,0.04735711131546063,0.06037660386904827,-0.02542206007166161 "
-"1284,-0.0523813132238177,0.01851546515330889,0.03431233875566388,-0.019157347917834938,-0.05178200904831111,0.03185217406990926,0.023312697577857464,0.038798534537625155,0.032556028751395634,0.0028276693831376528 "
-"1285,-0.0141344720565849,0.044670405911132166,-0.006031602341658518,0.05982791274992242,0.028031310473072724,-0.00716034138851107,-0.003355267409093824,-0.02152225224350769,-0.0040801786023397235,0.029876864875302705 "
-"1337,-0.01358446241368399,0.019475952671191222,0.0019012996215545474,-0.007601893943815573,0.00909381729822209,-0.006392141632235728,-0.004790788286952944,-0.013135442024084924,-0.008240078440056154,0.004724723801073928 "
-"1336,-0.03459318648429145,0.021685040521015938,0.010905123421669796,-0.01799051577700147,0.08865714615514159,0.0593744803924385,-0.11695316686477311,-0.05818807217893429,0.04687336343935859,0.029638979393669353 "
-"1339,-0.03052371151904589,-0.008846125917960176,0.015785654214103252,-0.00863845239062727,-0.030044373467440728,0.02023410206898982,0.0177930296600326,0.037436092936923834,0.03780454586517599,-0.004601173379480198 "
-"1338,0.003825557590220385,-0.023356039912337433,0.056613590554854126,-0.037999357917849336,-0.09640585361844115,0.025796709844971632,-0.0038299961563791466,0.04166827811710333,0.022011547649518078,-2.1812729390656926E-4 "
-"1341,-0.00631239986917194,-0.007957049752162116,0.006753415811153329,-0.007643120176910044,0.0045754878198944575,-0.021475266909964007,0.007629224677621017,-0.016601430555921504,0.006642234332366521,0.017042355984989783 "
-"1340,-0.0028351548971739986,-0.010721400300822253,0.030505099834658853,-0.00841342050127976,-0.03235304708977077,0.020381753278858245,-0.023529703629327554,0.021385752028261113,0.03329306698955493,0.0124237429606144 "
-"1343,0.0035748534039161395,0.01484171385940674,0.012936565968728395,0.001762169869627952,0.011260095755331266,-0.032418654002333375,0.007518178107101218,-0.02538832566051896,0.0014130211415450042,-2.8227920525793925E-4 "
-"1342,-0.041173514669839956,-0.004481375601306551,0.004538317061530548,-0.003501374034993262,-0.02910613590668581,0.006626996595348237,-0.053215557404596076,0.010956711636159553,0.010329175222285792,0.016543327722806096 "
-"1329,-0.044537592756383436,-0.047027482736316954,0.04664201117876825,-0.08571863554355501,-0.14586882544995294,0.015164987557352209,0.020930325650946983,0.1021668057616537,0.08261801576349734,-0.035722101943944096 "
-"1328,0.04119385483362494,0.0051674283348887426,0.03398579586647618,0.02427979259473472,-0.004949840475353315,0.009116981668986413,-0.056373202957263835,-0.040805189536068355,-0.0624990419624489,0.07975592531057277 "
-"1331,-0.01787073523769062,-0.02586420004836871,0.042522545529972436,-0.05201219020640329,-0.09028907322503704,0.022790904680893533,0.039878838104841635,0.0560890437098312,0.026099878137283036,-0.02555978248320171 "
-"1330,-0.023167444496308316,-0.02699004494372564,-0.0011008038909268163,-0.00613766965453745,-0.036026056398657996,0.0024133848575658133,-0.0030395205746275005,0.0487439142471655,0.03876435554230554,-0.01601913505109162 "
-"1333,-0.008045962806929105,-0.008272124380776028,-0.003941601295380566,-0.016776434196103508,-0.016295871655952313,0.007964779275897822,-0.003101641687078575,0.0017581024496117871,0.015237016785097987,-0.006078032058066429 "
-"1332,0.004784992457115252,-0.018325557269630945,0.015636606119532343,0.03241332684287292,-0.028433468996390227,0.02551944624184748,-0.02042484791945243,0.0364721351753415,-0.0068316540265806755,-0.02795570381397042 "
-"1335,0.013568798790128699,0.0038698109093325645,-0.010637872635054642,-0.02241586636397403,0.008247235476597612,-0.01911891296080718,-3.441638461976177E-4,-0.005828769193288236,-0.0010531095624858055,-0.016996297568140275 "
-"1334,0.0303909092250218,-0.011508932139702638,0.016822659559135096,0.02961069035501649,-0.07273956272565875,-0.006111074727818585,-0.05270455682592872,0.04775903708156115,-0.04385282839786572,0.01334841668105564 "
-"1320,0.014532978697354846,0.02070785867987623,-0.04071689024914121,0.01800540439317454,0.028683082953057434,0.005795904363332197,-0.013529097482628802,-0.016565584918522044,-0.007310151281581066,0.010900977786283976 "
-"1321,0.007567504796564456,0.001825348056095035,0.02014941964283871,-0.017055932721336625,0.04392408499582875,0.016729836062485903,0.015593390418033658,-0.055963739307775595,0.004824830062061759,-0.001712551769571095 "
-"1322,-0.013397430356871437,0.001320975980302564,-0.004474512709834169,-0.03142825683191579,0.029116909081739986,-0.006261539108101878,0.006677401136286985,-0.03966591782581904,0.006194254238159972,0.014950113141208829 "
-"1323,-0.022724618222448274,0.002326037774882037,-4.198835041334499E-4,-0.010475282695310124,0.00439045456215604,-0.003667975245109975,0.010768455649686546,-0.0018014049290443971,-0.002876379915315922,0.01138441979550488 "
-"1324,0.010375042601212971,0.011004549834256775,-0.03287344825336473,0.006668585226008529,0.06814514443512494,-6.796848862307339E-4,-0.007149298105920068,-0.006273240359050692,-0.004974175991072669,-0.014850665983014035 "
-"1325,-0.008938813640478232,0.061533515434723525,-0.0362127998628739,-0.024783116631271803,0.07219754993587318,-0.022258387282761694,0.015479750137231536,-0.011786014688430433,0.03384332690045636,-0.012991206639793591 "
-"1326,0.016988124103245527,0.012626008165350448,0.03566164617424867,0.029172152778988762,0.0018024277864657206,0.0027001734095436175,-0.02253937709802813,-0.024212197451148675,-0.05216406052861946,0.036590305583055455 "
-"1327,0.022636252012424068,-0.020602288719433988,0.004669454721197255,0.02119301496649026,-0.010410029039372931,-0.004831920686202845,-0.02884057686898001,0.007230444014249241,0.01014651382943848,0.02746911770143965 "
-"1312,0.001896710450217795,-0.014527576995156171,-0.005998211707734963,0.015815527059697326,0.040608316396082186,-0.004436436376489932,0.016680555428783272,-0.02817819378850823,0.004953836890694258,-9.919844908882706E-4 "
-"1313,0.006346953498449078,-0.019429917354022976,0.015867838406488748,-0.013624939382628251,0.03339720401178328,0.007712414767283773,0.010380783110030479,-0.022392163702384175,0.044755919063420906,6.012429012169448E-4 "
-"1314,-0.001636563064447386,-3.109157091732828E-4,-0.008461783472745147,0.012625971328055737,0.00641421888759258,-0.0058237467499633105,0.006944436954687878,0.010709668477642237,0.015763376904901937,0.005204615251507312 "
-"1315,0.008000574925493898,-0.005325328237515637,-0.002213789224476216,-0.007449548427875438,0.01107074730583646,-0.018208551284365947,0.013200219200830164,-0.01853162505256654,0.016099153893872235,0.014042126827789034 "
-"1316,-0.004973031133056233,0.017490325709457983,-0.026714133367557596,-0.014470699001346253,0.022194995621115612,-0.007135923049925834,0.0011134971361757948,-0.01598424755180907,0.00548151796692795,0.005509193141163396 "
-"1317,-0.026608799628956025,0.0028104388579633876,-0.013817682935527069,-0.024384365421413312,0.03695519827869501,-0.012466631193697885,-0.018415928122247474,-0.005594722323140004,0.035286795876086095,-0.03278758051496644 "
-"1318,-0.013064165173765343,0.02568658753934749,-0.01872548965539856,-0.028591923196881724,0.03998847953286507,-0.002991433903260003,0.00802236169955059,-0.018816486655526737,0.016655997216756077,0.026026621895132385 "
-"1319,0.01867945977397339,0.014594602557794678,-0.025035519457155115,0.012157706581407076,0.015942427225256066,-0.015232103507996118,-0.0015920068541009135,-0.03067186611010118,0.007925729460688254,-0.0014692556374003764 "
-"1494,-0.0035906025093496627,-0.008628637063339282,0.0026289614030973124,-0.0065824631575530194,0.030426084163634813,0.011864727109728258,0.004169124234074973,-0.013983269441432801,0.003093544644299254,0.005423575392245948 "
-"1495,-0.013388177458266736,6.384641304377261E-4,-0.008234641785159898,0.0017625671712096045,-0.00994537431897587,0.0156746206508308,0.023147752928188926,0.004924512254924157,-0.0032948579725994576,-8.151284674902243E-4 "
-"1492,-0.009275324435007719,0.044034681014793894,-0.14711853591573149,0.029165935070263778,0.13295815262688346,-0.004673186606399889,-0.14055111022367778,-0.09584002782098568,-0.09881095288389771,-0.09377839512492114 "
-"1493,0.001230678582984196,0.0028385727356262875,-0.003253926674104167,-0.029304950523063648,0.036898802555683466,0.006777983895660551,0.01991876437779032,-0.03244101509763782,0.011119632354462432,-0.0018172918368437787 "
-"1490,-0.05290939353298646,-0.03819403618038257,0.012434667384933318,-0.036690544702381006,-0.026756964124930074,0.00869274213425223,-0.03595138704119264,0.06300946546788878,-0.03155041895989666,-0.03721183849010555 "
-"1491,0.012039499859562625,0.01654101972017539,-0.05159661708126434,0.04445361143829665,0.1525693169909844,-0.019809712196431,-0.05264806892394592,-0.10812975300713144,-0.029135878268128242,0.016597099924550378 "
-"1488,0.014323195426207884,0.02030918008644102,-0.033480361156815866,0.023805037160768983,0.011281996029698503,-0.017304507555893075,-0.014503109230314159,-0.015382960207370336,-0.017100777897633215,-0.0015041840031665642 "
-"1489,0.018234172939052818,-0.028343367191143068,-0.006057137951092349,0.02244061852807571,0.08587133183739318,-0.03245034111107118,-0.023520172104419267,-0.065457586728295,-0.012027982536840232,5.6349224456555276E-5 "
-"1502,-0.0029620430817909236,0.01340269122909517,0.003934348064222611,-0.009563842497501859,0.010457433540971199,-0.0032699225568021627,0.018255878586740684,0.008260149748774273,-0.00677671178003294,-0.015311355552775036 "
-"1503,0.0024575658612363055,-0.0275187373976497,0.00568876586623382,0.025143347984560114,-0.03575133117927018,-0.006766818204289893,-0.026834551448587735,0.06334355956682323,0.042819503525058616,-0.013631761635222566 "
-"1500,-0.030998474272180186,0.020525284312419383,-0.04877308661477492,-0.0902338401673147,-0.013769392986241741,0.04972905324978773,-0.060466683906238425,0.03822910292274712,0.05137480920009983,-0.09909713208481342 "
-"1501,0.004981139364131304,-0.021151927045984266,0.003875839070389196,0.01484382078521066,-0.012802198390434298,0.012166830747773505,-0.028803630295790552,0.0319049254091226,0.023918651613191292,-0.001426206174453296 "
-"1498,0.0021838772584992735,0.008070711435415646,0.002176378356439287,-0.018410114492373165,0.00399998062524692,0.004760133835322515,0.001284384954690475,-0.014375246769132972,-0.006623317760745571,-0.020369785176552316 "
-"1499,-0.020242324317326636,0.012797461742716922,0.0014803000165312693,-0.024521594378822467,0.05226672093062008,0.008567864483232249,0.004885101645697073,-0.0420132158060912,0.04189007212606067,0.015072391824711914 "
-"1496,-0.003109138596774397,4.928547594159026E-4,0.02226175209098748,0.0015312014777358793,0.009939868238171565,0.013308846197739772,0.011456686206118328,-0.01083514196805495,0.006335723964133319,0.002649550764427306 "
-"1497,-0.0038917712930729795,-0.03512530038219142,0.005580681779450976,-0.003102812813350619,-0.009907077137849003,0.001398098261694344,0.015643410045029074,0.04558885457950282,-0.02606920153003399,-0.003053228493662819 "
-"1479,0.018195519163776035,0.00857094173992241,-0.03934043718638689,0.03229791843497848,0.05027923945333274,-0.02692441060246342,-0.005310894642911854,-0.023087314689259578,-0.017369522324043343,-0.0018542534902959362 "
-"1478,-0.0018367416289791806,0.02563999172985909,-0.015846998689899305,0.0336740941744466,0.0274221137879299,-0.021542854475328645,3.916302107865353E-4,-0.0036049150903805045,-0.007962183264067734,0.008201414626691187 "
-"1477,0.023949385182893346,-0.07609137514625545,0.02967876689577394,0.015357587408988651,-0.1273060729766698,0.011379880259573837,-0.012684130869956152,0.12063010605827013,0.012791145822861524,-0.07643930318089623 "
-"1476,0.00882279331560172,-0.028568601648158585,0.011392894289793962,0.021106943934385235,-0.021200559259016136,0.016605051244251667,-0.0024753047107524094,0.05819977410734033,-6.717207684629767E-4,-0.05708154602364823 "
-"1475,0.02104705840677398,0.04203037174974105,-0.07211079716089522,0.07364744689194186,0.14511097179522844,-0.025755960300191717,-0.057166268035453396,-0.0857710846040746,-0.01677248932318047,0.01102190721547506 "
-"1474,0.01346760064865351,0.012032181768778037,-0.04871879887011051,0.06579673721136792,0.14520123836821033,-0.028980573175811646,-0.04840839991785178,-0.1060058943083877,-0.032590509376724155,0.026944663710137973 "
-"1473,-0.022985310424534774,-0.017627410453358312,0.016666340127131186,-0.02255034140306494,-0.02501598624545613,0.02527054591739978,-0.002311886119047129,0.0099979463924512,-0.009321760314772439,-0.01754672486371562 "
-"1472,0.00781929136795704,-0.040562300305495014,0.0055260545102656655,-0.0011775966146717735,0.03851979847146576,0.006930931173186366,-0.033670170156888474,0.005232495920289766,-0.006349670399573842,-0.0338640374112396 "
-"1487,-0.003838461242192224,0.02374198736591864,-0.028093656942167637,0.046811711827864554,0.02051330724685061,-0.011916229588141817,-0.031651283373896645,-0.007112966886661801,-0.012642078573097739,-0.004197295690639445 "
-"1486,0.008049410868261055,4.921109869254742E-4,-7.607525879577736E-4,-0.008233311778760282,0.06390152021327465,-0.0026341499241199166,-0.011532781385239058,-0.01593860422553324,0.009567814468566273,0.00195035766619338 "
-"1485,0.0074358816523622485,-0.002269844921953334,-0.02276285861357741,0.025738245302539244,0.08385401571355912,0.00643640292310906,-4.894354042408734E-4,-0.0035055785005325855,-0.0491003975792116,-0.009580174451805718 "
-"1484,-0.052049997151865944,-0.014189942918983909,0.07541710984931808,-0.07391255580735216,0.016662329722932738,0.029806434401151202,-0.005436642425178689,0.028700768648224965,-0.020082390374579876,0.013054159921621358 "
-"1483,-0.020852267042994838,0.013451454990664791,-0.019894370566473054,0.03714097883734833,0.16634513850591773,0.015817875112605635,-0.037081248816765576,-0.11550738455117684,-0.06390943861536094,0.03232284864134208 "
-"1482,-0.002583006293630894,0.014475883563639895,-0.01662734423935545,0.03172484303539244,0.14592610714487567,0.008681770576768236,-0.042192802527686625,-0.13363860482712295,-0.0326263084285422,0.025399209659073725 "
-"1481,-0.012790682505659973,8.941834327402704E-4,-0.012260613638558723,-0.0023745677630261537,-0.013003971438020817,0.017757962289716787,0.0014134068414791128,0.019634217666118996,0.008494177992602431,0.006720281806157541 "
-"1480,0.027474620340391994,-0.0090791991440839,-0.00635840144627899,0.0379713028350082,0.08545659788633503,-0.011509427765572131,-0.017666441054468587,-0.041709603723127806,0.010691405090959139,-0.006978125724267599 "
-"1524,0.00611071399176901,-0.01032923579140659,-0.0037109447722173785,-0.0013774442894831376,0.023637279546103604,-0.0045747694841982494,0.0033967557516758223,-0.012387915151511357,7.093986707210907E-4,0.005858550083022311 "
-"1525,-0.010461894097659618,0.009186463431362743,0.008901189914307077,-0.007059133391817622,0.011114552196967168,0.003832609421189101,0.02191526997018464,-0.0043376277928576625,-6.631586066029199E-4,-0.0016585595514697364 "
-"1526,0.02016884737359673,-0.005469182951947077,0.011823441830222747,-0.0036689909179943776,-0.00295426130856875,-0.008083029494894343,0.008998477873071611,0.007146851207394925,3.8889016487480855E-5,0.005870665777409286 "
-"1527,-9.967137426151792E-4,-0.01092194938908312,0.012216270391714905,0.003406824837718022,0.011573290592826328,-0.0029305141831248924,0.009975759629790007,-0.0035293189281042133,0.007719664245937779,-0.011493200804927868 "
-"1520,0.01859201304176896,-0.0069912446056641965,-0.01849650533554471,0.002764865488577885,0.003733341469235749,-0.006477628077456259,0.013262319531964986,-0.006564759620021512,-0.014589863684521991,-0.007023088971086864 "
-"1521,-0.020758184155978947,-0.004044260150622077,6.053375642929175E-4,-0.005651725972822292,0.017032293885254426,-0.0013436633414422884,0.013287735170547833,-0.008401304764046776,8.469369311185078E-4,0.013216012044963296 "
-"1522,0.002145172469909118,-0.004182325511542141,-0.010912663830211194,-0.016383702522457588,0.021437790003589918,-0.014661795716821201,0.0011250312465595621,-0.012695850752995055,-0.0031231697820246645,0.010631306226021243 "
-"1523,-0.0229288139891644,1.2912477361381078E-4,-3.224182075358271E-4,-0.004001220603987741,0.012225374125411009,-0.007551968522443383,-0.008263975571190848,-0.009213637198667112,0.0016539309002950762,0.012808041439083121 "
-"1532,0.0048800733594492295,0.006121237040004293,-0.011786943291221388,0.012701771577167948,0.009575310764677656,0.0038497888284310497,0.0017043740866786309,-0.01064532717002239,-0.021492468935151658,0.02053234008053309 "
-"1533,0.0040204375611696715,0.005013443462846028,-0.017619224415815014,0.023055684209224703,0.023377715434240116,-0.01651963340146086,-0.0021722396837257087,-0.01898050754420667,-0.02125749255232845,0.002845130814279794 "
-"1534,0.014743445061754118,-0.00815265688289223,0.002378588311517289,-4.6053813963575665E-4,-0.004263060065757382,-0.007316474377490607,-0.007834450224353334,-0.005704007452771518,0.005471860579680612,0.00775230596658135 "
-"1535,0.0036228425536371767,1.5837146647864752E-4,0.0158040068259065,-0.004597556976085269,-0.004826887518725772,0.013711123396916452,0.007682388170105171,0.012313669249803892,-9.460481379416127E-6,5.520199063135812E-4 "
-"1528,-3.784542374173826E-5,-9.676074239380217E-4,-0.009700008414090149,0.006826857422819083,0.019884389023435898,0.009261022511375831,-0.003167252917224856,-0.018275461022630494,0.0042887240517849425,-7.972799839910242E-5 "
-"1529,-0.0020005956144846806,0.0017533894021761896,0.008083572060636363,0.014044941628632655,0.012514865789148769,-0.011381698749638408,-0.0033090921072902024,-0.002062462874844914,0.0033255733922338106,-0.0012688464822858587 "
-"1530,-3.942222705155986E-4,-0.006047701552174199,0.0034619725004662433,0.021012091212815224,0.0235016743058373,-0.02218153973811086,0.0018767773911484071,-0.017371153681566585,-0.003145727708583638,-0.0062641099633050056 "
-"1531,-0.01134672773084076,0.0033904674973982856,0.01036664634555261,-0.024871901225244582,-0.019168223426528835,0.007266026165105723,0.013190411517829733,-0.002453076354647965,0.031119348060651714,-0.001987630936045097 "
-"1509,0.04877606992317618,-0.05470840340993256,0.018109276306690857,-0.022489755303504336,-0.04468509738760571,-0.045097039476790134,-0.017486960739994346,0.026329444144009596,0.01546857048350414,1.7586904023948285E-4 "
-"1508,0.018396277316267605,-0.03450918208382952,0.008024319256458743,-0.03964610413885616,0.013972397753076925,-7.842304516018611E-5,0.012571989098304566,-0.04491665773695515,0.005669111094582555,0.030149216559636496 "
-"1511,-0.027214270734754766,0.011146530513045502,-0.010014816673342277,-0.01947377501213776,0.046774664271715144,0.022170005367227144,-0.0055727097663223705,-0.055183814767460655,0.03217947980321739,4.07523773832512E-4 "
-"1510,-0.017008400749244583,0.013714968711650838,0.01702276228974286,-0.016098259456042936,0.039698854742140376,0.0014671688093175986,0.006365417510581013,-0.01669319721952019,0.003102126949630267,0.035174293433937305 "
-"1505,-0.02859299717736665,-0.020611658095028407,0.035492284608466644,-0.03984683015867458,0.06483089281753734,0.0015584727039382772,0.019819704894360295,-0.07601171123635,0.001565555455070947,0.02571454643146288 "
-"1504,0.01556999376082555,-0.0031492287343229007,0.0010359420747614707,-0.009874348735839287,0.0089856836090489,0.011956877283056774,-0.005981582984198007,0.00341839408126578,0.002027366646330554,0.013939725049601415 "
-"1507,-0.006962282363724888,-0.01694702003773731,-0.009292397057811784,0.031222484708739475,-0.04455914867942344,0.008702784954988087,-0.030935250630602165,0.06359453194894225,0.013815676351350841,-0.023784659144887477 "
-"1506,0.0034629529702644452,-0.0010105083688024918,0.03594098137945213,-0.0012546916608615918,0.06699158908379695,0.00168128742302528,-0.0056480392847833485,-0.06175925298170776,-3.9262111363410376E-4,0.01085702090656251 "
-"1517,-0.018925618918069674,0.01084079643890892,-0.013087716420268274,-0.03845015360599399,0.04434260110260816,0.016474211167176626,-3.3008301953154696E-4,-0.06438059053079132,0.025632743508783865,0.022995842392781254 "
-"1516,-0.00917751419050554,0.0019184062976536536,-0.016799424921962614,0.006645572435311525,-0.0026161291405984613,0.0057907499651052635,-0.02746994340114651,0.0332872859175805,0.03344189256369214,-0.019160510862996732 "
-"1519,0.0017742550520476472,0.002813299951129678,-0.0032192204101771514,-0.010140338761942832,-0.013192480413420329,-0.0070530197381536,-0.0023199612144593467,0.004965558284260846,0.0012865365556709277,-0.005249673209887561 "
-"1518,-0.02378706947001029,0.03084211868514512,-0.03927758493866433,-0.05545983407811053,0.048951476921194725,0.012191988576355077,-0.008627505285516661,-0.005601154365734765,0.05607624209570322,-0.02326131446364202 "
-"1513,-0.005725844635491415,0.012632792987292307,0.001411193001728841,-0.013274270503346038,-0.031167002247391808,0.019428449277526513,0.004107724011061518,0.046515219351817384,-0.0015960448860527273,-0.009812929341111512 "
-"1512,-0.02660728777124635,0.020997085890626654,-0.010599966621242938,-0.01699072363669658,0.052136222607523305,0.003914972150576026,0.01277335171856314,-0.024645522908810388,0.01930090049283515,0.007822398840660378 "
-"1515,0.018094334834275718,-0.013105379491161088,-0.029887580571631114,-0.012476074213323005,0.09033065039963836,-0.0028034162606952536,-0.0013872354708225326,-0.05926881674992247,-0.004903747658433401,4.719958055770809E-4 "
-"1514,0.004028064973514925,0.002124995986971593,0.007839509540319695,-0.01527182104665551,0.06273000264466927,-0.0031884880836533834,0.012189606209652147,-0.05478698950504036,0.0045964695674254406,0.010895424782742835 "
-"1426,-0.03027813126678631,-0.010095118595840486,0.06785737311746758,-0.05488068011004165,-0.13419103782046163,0.050542478742311624,0.030994515776948173,0.07062867590361627,0.04176325806586874,-0.02929991330282424 "
-"1427,-0.00944891479738494,-0.0228735797498544,0.006738516100643644,-0.03931520133291802,-0.06124671521555219,0.02500964342332846,0.010740998836178538,0.02377671052529648,0.017444416614960195,0.002196909692895687 "
-"1424,-0.008210329987203328,0.01122536246225835,-0.013297983545671422,-0.0060394504055502375,0.02207161102602168,2.984652918834274E-4,0.012058873319947603,0.014741775299248517,-0.007595747459052179,-0.0031597881523075426 "
-"1425,-0.018951567345795926,-0.019476272587579026,0.00632538464706609,-0.03281625683973182,-0.0568091023481916,-0.014891123558659292,0.036158788923639565,0.051257858455820225,0.005407593084263692,0.01475897485965196 "
-"1430,0.009335434057558593,1.8171960742192472E-4,0.02853867807485944,0.010406706685265348,-0.03044390319833956,-0.014644372300043411,-1.8650798319400422E-4,0.015433941502615652,-0.010731777731758898,-0.01796692194663563 "
-"1431,0.0011390229073298813,-0.014981330639449628,0.016316772932651356,-0.019515237043251577,-0.08029488293771792,0.020031264646088686,0.013524160772831924,0.07276530119731393,-1.3204562099713464E-4,-0.009503748944928494 "
-"1428,-0.005916859020457984,-0.028946296156137294,0.04839450127804109,-0.0696809241115203,-0.1304420966290844,0.014262165623574,0.03462527375125577,0.09316220788776537,0.03988296978717282,-0.03843680694640608 "
-"1429,-0.011719487484265281,-0.033983361088330714,0.01642155368149753,0.028043532043518407,-0.13853097906117157,0.015429508496641901,-0.029900686286648142,0.1333643718183495,0.03231493642967333,-0.03293558967840676 "
-"1434,0.009792859041679557,0.018976472529190373,0.005467316038016607,0.004327076071781954,0.010696456853178157,-0.004826883023555115,0.010022308645573037,-0.008001275727636996,0.0017524560281611617,0.01009535123963184 "
-"1435,0.010901027388964118,-0.030491801712866626,-0.010094578163123124,0.029246040547543102,-0.059196570580269836,-0.025322185150630207,-0.014237536404913948,0.09274626400975605,0.027351990956148636,-0.01184669460167177 "
-"1432,-0.007945355174181174,0.0063824255075977205,-0.012110161841133176,-0.0047063671171239324,0.009368220352054507,-0.001511276407501301,-0.003099459301373181,-5.639968213040651E-4,0.003746139540305178,-0.024819263168846955 "
-"1433,-0.002480964132250935,-0.028193209800302894,0.02665756936577074,0.0090838328446093,0.041136788210692485,0.011839379695991078,-0.008313459715224712,-0.02433133134978956,-0.0013715706069099803,0.00640849656229508 "
-"1438,-0.031101895961602757,-0.018070375013898486,0.049363081030702916,-0.04773614547716601,-0.15610258754077605,0.07777353498022073,-0.011429968360203883,0.06992408626407283,0.021027321499241226,-0.03695642236354159 "
-"1439,-0.015038803807533675,-0.012357481851543027,0.01605522146925054,-0.02118222478490278,-0.05269611436109684,0.025063073512341102,0.011801860301113801,0.02800097012068689,0.031031830185184947,-0.009557484568279755 "
-"1436,0.01336507887785317,-0.03154801944531554,-0.014628229508369077,-0.013033111609430319,0.040558131197640616,-0.0223788261886082,0.011711637484094435,-0.04461342586708183,-0.007949621193997643,0.017245595437257375 "
-"1437,0.04212589292231455,-0.05734119796921575,-0.031390409725184754,0.004379895481513982,-0.05291427005707959,-0.05677297569742629,0.02357597501162246,0.0652068344407402,0.04100387404866756,-0.011874606775462992 "
-"1411,0.022490092484353456,-0.03577437046149034,0.04393300926974397,0.02166559217053887,0.03132285413544898,0.007041605448013993,-0.03172013321302851,-0.014193241245077917,-0.01652364963149038,-0.012182405105877049 "
-"1410,0.03338471496948519,0.005191479409807559,0.02227866855369795,0.028163177749782945,0.04353567656619186,0.014442250948290169,0.009842626146212658,-0.07108472777452325,0.03646004194363176,-0.013347863655728738 "
-"1409,-0.029265433125457596,0.0015581602651096188,0.044225347889701644,-0.02554986818971672,-0.05472852562206001,0.012692541372738482,0.020798147187491678,0.06118643015689294,-0.018242882794789136,-0.007381846398194197 "
-"1408,0.01654897991759294,-0.003217378160530796,-0.012139823566280298,0.02383621785553134,0.07356599116191563,-0.019120045686699987,-0.016447142034406708,-0.04033821353252228,-0.003974637701571401,2.704894648012215E-4 "
-"1415,0.0203813119732747,-0.012213374781825975,-0.007295351563894543,0.01584608200906634,-0.02317436165212514,-0.0038164956637491256,-0.007433467548101075,0.01739549060424323,-0.014166419356898656,5.588401696103487E-4 "
-"1414,-0.004640481919556036,6.686642576038226E-4,0.03495753732238437,-0.03914994372717019,-0.07685738687300835,0.03046711362042752,0.026059666200931537,0.029202921117993125,0.025160097899968505,-0.0219283171957317 "
-"1413,-0.008463383626556733,0.002357269314677135,0.015885418647114073,-0.02511243785193568,-0.03524217981202582,0.03390459308672441,0.023548190446988304,0.02562245999148507,0.021764534695458995,-0.02142711919384791 "
-"1412,-0.020313724478818414,-0.019931636803727077,0.013032831492613844,-0.041269507784409076,-0.08058542264464194,0.03144563492086382,0.013108607891236763,0.04858064991569129,0.03132777439576952,-0.021790097683346946 "
-"1419,0.03421678181280844,-0.04264603952801119,0.044894596722164795,0.031528498679803243,0.004442309208578814,0.028262831803915398,-0.0037716189136069627,-0.01590752795064878,-0.03130877099201027,-0.04076731821598988 "
-"1418,0.002150567733977721,-0.016372781975433875,0.012896074778679469,-0.04646905476740806,-0.05915876759980302,-8.399572140901587E-4,0.023573737215542227,0.038374141194342785,0.016836246958057483,0.004724400543650522 "
-"1417,0.024196514141879504,-0.02577070487382506,-0.0043822424958309585,0.03540246095318067,0.067389398485062,-0.03393085543744222,-0.021146569287968434,-0.022181796934124507,-0.00883566536592736,-0.035077361552790086 "
-"1416,0.024906870617698886,0.006420860956738523,-0.01093078903803741,0.034589454737412,0.05945890595260163,-0.027621023263058434,-0.02145001337831329,-0.060383185354118886,-0.008574603047591419,-0.01141756829317612 "
-"1423,-0.007093117956885285,-0.006252282358994438,1.581421736642205E-4,0.0013954194638072972,-0.013305828974965885,0.0047400591127545934,-0.01033404607160534,0.01480520226059366,-2.9793526365286087E-4,0.011883436357098412 "
-"1422,0.002219934185454881,-0.017977315186397093,0.07155967046028357,-0.047678882293926014,-0.11561682511803802,0.04264221793288218,-0.023581435440325316,0.047692398008182375,0.031025277402211733,-0.0037926160010467204 "
-"1421,-0.014893520158097839,-0.007983985730049617,0.004763510988425194,-0.025864209297626242,-0.03051688702601485,0.02405398800135888,-0.0044294852320730625,-0.003158146984818115,-0.0059119250130761185,-0.011896405263261963 "
-"1420,0.11407869972930935,-0.050100059961929046,0.001717462131606899,0.07154342415820482,-0.03366053030338772,-0.01858178638773124,-0.027196585160425404,0.015809380160786354,-0.11200965170929303,-0.028815393067318586 "
-"1456,-0.006881426254441407,-0.028993496698806513,-0.0497896791083859,0.0459574920803943,0.015291601757396913,-0.0018501368922589987,0.005579704852373689,0.07713954271147479,0.04253605177256335,-0.04740753056145783 "
-"1457,0.07159968259828918,-0.026784253119130894,-0.03209394217165825,0.08766954443729567,-0.0015398546666232228,-0.03666447724734871,-0.030486836050016973,0.048015796669570274,-0.02564722187837829,-0.004801475293596597 "
-"1458,-0.04658684421073154,0.016481363792355548,-0.01544425715370063,0.01355122740082039,0.047218029756094376,0.016753863153442326,-0.011742386280146632,-0.04134272044968875,-0.01887164046222886,-0.0065671900800496254 "
-"1459,0.017581894375770353,0.02184155443668,0.003714960438747304,-0.004842631927479011,0.008995856443983326,0.006282110456735489,0.0038208583578115945,0.012838918663495635,-0.0436303760923668,-0.007432638251795999 "
-"1460,-0.03774943493313711,0.06825583137685726,-0.04118967247318909,0.011607282454638539,0.07708941091628121,0.00918044335208915,-0.039402005217682196,-0.021796948863408737,-0.01588626174568593,0.0015295315733790877 "
-"1461,0.06395153237083556,-0.06390078249880031,0.08135721826813011,0.0361037277481496,-0.09197361289683449,0.02098120207240421,-0.038231177118274215,0.015649886930274824,-0.03157431304903938,0.030225889967188727 "
-"1462,0.018604209138901612,-9.825810007498162E-4,-6.592357411263278E-4,-0.018099167827418654,0.027559308357739922,-0.005143581080123557,0.020103712230980102,-0.0034530863797261574,0.014759908139123772,4.977966767224094E-4 "
-"1463,-0.008891227704917326,0.0026571363716970373,-0.035284345750887215,0.034817106992586305,0.006170486503548977,-0.015272676223692534,0.0011621835270447132,0.04812798568599335,-0.007068302332217309,-0.0323564948577049 "
-"1464,0.10601645686528413,-0.08546452147590926,0.014293168070327813,0.09907350551041007,-0.22276207247706648,-0.1873169026729221,-0.019440268357147582,0.07351962314467626,-0.15828672073171504,0.011244021575030018 "
-"1465,-0.04123788537532772,0.026894471466985898,-0.02404781714718074,-0.030452411250206354,0.06367400282501198,0.04151583240495697,-0.04470782411126195,-0.01699511115150711,0.01676368369976143,-0.06411591619629163 "
-"1466,0.010901451159047088,-0.013125975754397229,0.014843203940846317,0.07538836165806861,-0.08987644846631004,-0.02292238589785051,-0.09634033301722547,-0.035321343423941005,-0.06394283695361475,0.034482473450100165 "
-"1467,-0.08709528996514743,0.09585716310319639,-0.07354603063656905,-0.024086346981409393,0.15704529893170963,0.13726780724895202,-0.11493613469710723,0.031604905673209914,-0.05850204039193759,-0.14713258360238265 "
-"1468,0.007576289849455264,-0.005323761559792616,-0.0060089699133728785,0.01809422694608108,0.07088927445432254,-0.030649107632125548,0.0012325717269067835,-0.037925607260269674,-0.0287879189637374,5.810807411109095E-4 "
-"1469,0.011799615022170015,-0.030739513724906162,-0.02374099802294338,0.020396545875441843,0.03160831375234009,-0.034027642659324335,0.007070490729600348,-0.02421223415895803,0.00506992381349855,0.008927306102365046 "
-"1470,-0.019627432508455375,0.0035113723761719283,0.008017016748066402,-0.008477099181555559,-0.020557724693132776,0.005419281409263807,0.004446224414632885,-0.0023202118373667436,0.0035165858637960018,0.009051436485322596 "
-"1471,0.011899026230076331,-0.015930889177488933,-0.02130008741209255,0.029165200058130968,0.047332680957425655,-0.020209775423572232,-0.030232021314168283,-0.010371696554118673,-0.029660211531463428,-0.0014998020851691445 "
-"1441,-0.023714250086394738,-0.013887121382238625,0.013018852199389891,-0.018140960216824216,-0.03013938139211935,0.016605771370150534,-0.01469991552211043,0.08197538066077213,-0.006165615744416272,0.00712588977274604 "
-"1440,-7.829718887287409E-4,-0.03020427302600862,0.06384643335051446,-0.04066070061562964,-0.09318151680876936,0.03950060171074309,-6.184786096199272E-4,0.06265628167486456,0.046591071726356646,-0.007436654773282019 "
-"1443,0.009024405935428725,-0.031573999705858016,0.002782724013812004,0.028047976346090082,-0.027717209047627478,-0.010746383579447228,-0.026712870414076415,0.050465724706840236,-0.02270079167592333,-0.004222540021415556 "
-"1442,-0.004091602791194402,-0.019598482000355258,0.007969398715487144,0.0029750981277705006,0.01185039635735176,0.006940114700600553,-0.015737295079762195,-0.019256258714366117,-0.004890750486569369,-0.0030341661395379116 "
-"1445,0.03394558589391338,-0.018346615486048042,0.016405349646471886,-3.601163524421341E-5,-0.05203979885681387,-0.02517083387957448,0.027535801981552283,0.0601253178544639,-0.007820663833836842,-0.024394873783113974 "
-"1444,0.0080909295625713,-0.029173443753029726,-0.003943553011029831,0.00894882690272972,-0.11911478148727013,0.03449538488663749,-0.012311224374468615,0.09350810637368366,0.03639350653751647,-0.031236901600912987 "
-"1447,-0.013206926021110009,0.0021888550713837426,0.01829256874854859,-0.01653355957113378,0.017881818110512957,0.013168253773683778,-0.0038111947478690505,0.015734751922860092,0.03744616654541418,-0.015511335400818647 "
-"1446,0.05756850511013245,-0.0818447073244539,-0.019363811520221867,0.023515847092057292,-0.18325568852240554,-0.09634732394091178,0.08174961640289406,0.1852976193145946,0.09694559074509994,-0.05565128645245493 "
-"1449,-0.018042048630148765,-0.01941215416114024,0.004365014543012074,-0.01829366385556898,-0.06162034464400547,0.021890953454366268,0.02443617037139243,0.07644619739558511,0.010212556566192217,-0.02696251501384048 "
-"1448,0.013033395938480529,0.018028049628768243,-0.009430084718756166,0.00398014215850218,0.024574462028103535,-0.008308103041318009,0.007205920319327511,-0.03589760492196037,0.013392567291640022,0.0013166334014688623 "
-"1451,-0.014761446916654479,0.020479377847364803,-0.01314184875753729,-0.010715348478821019,0.029026676625465507,0.005824353767089271,-0.014742724098000095,-0.041939832413283654,-0.004396526466838206,0.017216073872840854 "
-"1450,-0.01989207574616698,-0.027988618470288808,0.047176550493639814,-0.04310778607962629,-0.06535784449976796,0.02292012983302277,0.016339944485583933,0.03138295376593885,0.01788976144880706,0.012841566582495374 "
-"1453,-0.02691598061091215,0.0492649736597169,-0.04034604105520939,-0.024541252563516833,0.1123688747097917,0.004644106005427412,-0.03340724202409502,-0.05869805199261198,-0.019512240556890992,-0.019396549179228628 "
-"1452,0.001987904883075284,0.012998932379612643,0.001757385507402586,9.040656824779994E-4,0.02510060138861667,-0.002755098449747673,-0.026747545697124925,-0.038583420388780314,-0.02404343895884897,0.020284439626940844 "
-"1455,-0.039746547798373735,0.014627349536017168,-0.009258760332614017,0.15292661472663396,-0.07919673419642438,0.14201401254810586,-0.06006066639022622,0.11755933360935025,0.036551853978255236,-0.11754632492493375 "
-"1454,0.035935917814171235,-0.03106554428917436,0.036528564932592045,0.05731684270698796,-0.11471364565079892,0.018155637921737723,-0.046733843863099624,0.04582193409121544,-0.07445879597823654,-0.010342757604640923 "
-"1642,-0.004136979023669091,0.0021855116132613248,0.0012075556423233578,0.004336336008649803,0.07748641071440636,-5.844410685331554E-4,-0.0077409073604104385,-0.039844841310259525,-0.010133027261699554,0.014429759990780737 "
-"1643,-0.017950513719302886,0.014452763072822013,-0.0015949654521089567,0.0032826967761157835,0.038150720041404323,0.01185345599892231,0.01019732738206571,0.0014333281774429698,0.014017932501388013,0.015521519367287892 "
-"1640,-0.05679378835424567,-2.4137730614420005E-4,0.05747975588143858,-0.09558697910691788,-0.09572462750693217,0.04864330608841254,0.03480359814582267,0.05447949891650499,0.029924055121255823,-0.00839154134925108 "
-"1641,0.00925110802773852,0.004141169544879614,-0.014555535278199822,0.004934180490886007,0.04589916794207855,-0.003850634286734693,8.225962023150567E-4,-0.05573956597238862,0.008252415152223243,0.005520192784872321 "
-"1646,0.006387823291082413,0.009737812468622714,-0.012283597040303584,0.026467171404129484,0.009814622519789063,-0.01938690205970965,0.0036328533899330244,-0.0037200949789088222,0.007385422371446379,-0.0134551531870905 "
-"1647,0.034920756801145,-0.004119253794543319,-0.0345845791987509,0.04020099874825281,0.0716716132794906,-0.006429952751270295,-0.008478617277662711,-0.04861243825402233,-0.010258384186081795,0.00761588304268009 "
-"1644,-0.027405173787130546,8.261437364674758E-4,0.030213840373651626,-0.0421622277346491,-0.013881550496843097,0.007721000539214285,0.01239838400572867,0.014954824329653685,0.025217092391569898,-0.007116728497955496 "
-"1645,-0.013575327750698755,0.037489307000499766,-0.03662691995998585,0.029865010442421888,0.027610378364649232,-0.0025764900345489165,-9.912063597491284E-4,-0.027873542023313894,0.009167985361101241,0.02367894826561083 "
-"1634,0.007011305608809743,0.01124312596268768,-0.014166538961992355,-0.01484038139042842,0.031204586222213716,-0.0017552691668264253,-0.0022460056956980254,-0.002839036707723778,-0.002790625432212556,-0.009091243025538504 "
-"1635,-0.027894131606985274,-0.011369244044487073,0.02679016964756794,-0.03322832414307301,-0.03918130798977787,0.017143150643640765,0.010130819159921107,0.053266429513434264,0.033589108765434895,-0.04011527980335022 "
-"1632,-0.047722681559673324,-0.01731310550229943,0.10625406825098455,-0.11316734163252985,-0.12980659657346108,0.0773726891382553,0.029435964593585082,0.055133962253512594,0.08740190917466069,-0.01011535907300396 "
-"1633,0.020678243341239105,0.010868373057448652,-0.009361620246572706,0.015212471948258094,0.02494005398365898,-0.021172103701980013,0.017875674716805595,-0.012416170670501584,0.010727994885104777,0.004838863827012186 "
-"1638,0.01698266982783742,0.0031519148357693175,-0.01674232647380037,0.021052679425663016,0.005302549394384633,-0.014932664450078448,0.006839076806005476,-0.032818246391153695,-0.01529422065547767,-0.009166666382234465 "
-"1639,0.00868291603259733,-0.017596691677047985,-0.05125093088837425,0.012706149576498597,0.03401133216068807,-0.008876379594386509,-0.01707738571985638,-0.021799478375450987,0.008122988995366141,0.004531095238121189 "
-"1636,-0.03595830949373273,-0.0366828602345304,0.09740377000182493,-0.07838344897648392,-0.16947577742122424,0.07445212286170062,0.010286559917770454,0.11989267754876652,0.02430651323473671,-0.034153513385623044 "
-"1637,-0.012003140276764966,0.03361351797445858,-0.03475444682175501,0.014512661736811852,0.04633224998494289,0.0027413019856001733,-0.026740485233613564,-0.0329155048826365,-0.007019927755360879,-0.003227129846181325 "
-"1659,-0.005920523916207056,0.03190172060136926,-0.03371712820605917,-0.04449224671628113,0.05842912617997649,0.006676255247345072,-0.02548111493858135,-0.011399645246660631,0.04146565747353905,-0.014444426397947045 "
-"1658,-0.003033305030930895,0.0033004046146007165,-0.006434060692883825,0.009152844012792446,0.0037781681718934844,-0.0170824948037039,-0.04403819788912102,-0.04122542075562005,0.007144112258342347,0.0010428358454255898 "
-"1657,-0.009731427670968578,0.03072628359622799,-0.029030956146619383,-0.02751279565107552,0.06431263915852825,-0.0010873606486628393,-0.007722228397367233,-0.03701306197208179,0.0429088222298539,-0.00595892270548571 "
-"1656,0.007560629046800606,0.0032716224531264375,-0.003005964161826132,-0.008617027200664653,0.017954949817878797,0.01469143158166292,0.0011864182298503992,-0.02440434390956776,0.015211578716411597,-0.0026607346233155017 "
-"1663,-0.0019402602403344005,0.0017814225451976136,0.0014813245648972707,-0.01241121728948776,0.003532653277257181,0.015453387781124775,0.009233465289060678,-0.01630324461530481,0.019189338912648787,-0.011113070604366624 "
-"1662,0.030260197164028488,4.046234126027741E-4,-0.030979333530985885,0.04470701646948413,0.06244993907158602,-0.028418804587897764,-0.008840038886542822,-0.03378888208596056,0.004232056198872765,0.005588186875810449 "
-"1661,0.00798510040695786,-0.0020443843690296946,-0.014213256640032618,0.002067795755766454,0.01949362432755653,-0.02022399997239285,-0.011450480308857152,-0.0167155608441428,-0.005463509569319198,-0.018803312053550427 "
-"1660,0.0037721249520611517,0.01376215458956629,-0.006763211544461876,-0.016997620670984367,0.010096260072721113,0.016981380046416528,-0.008703685102247942,0.006233916568064719,0.01919905021764512,-0.001466645207882049 "
-"1651,0.013954558999963087,0.012548367603769562,0.010852521207231588,-0.00524365149572944,0.007589827387991758,0.00819488535403662,0.006937004010362488,-0.01616441986988529,0.020988787682897005,0.01320015361134758 "
-"1650,-0.010118312095042279,0.03406723599438182,-0.07787128515475296,-0.0742783369385277,0.08428220276527942,0.002838414185490741,-0.03891697158415923,-0.02806174890346042,-0.04507357198055324,-0.07708012841133942 "
-"1649,0.007097098621118039,-0.018117138557877322,-0.021598089491194617,0.020407711493418614,0.024214132875988753,-0.007004193462026271,-0.009640324728761257,-0.02342021048096902,-0.01739190680235367,0.023249609805969792 "
-"1648,-0.030649047183135023,-0.04367402387321355,0.12609388768196772,-0.1448253106655559,-0.17296762071230942,0.06341924072076288,0.016586242698603103,0.03885887860392197,0.1187971585933541,0.013679849779094692 "
-"1655,-0.004465105642796289,0.005954613260362362,0.005621636317634933,-0.018083114126765675,0.0273674415279415,-0.0024815264232357806,0.006153997962235743,-0.008572808940061762,0.00877599745808231,-0.014311617734725132 "
-"1654,-0.010504063367424647,-0.009495306398459824,0.011847923364783759,-0.06733172830179855,0.02216168575300232,0.02519156993492803,-0.037171829156642085,-0.0047869758626250015,0.03654841086673176,-0.00939681533659744 "
-"1653,0.010095544143159817,-1.2664083133534724E-4,-0.011014738567068654,-0.003899291260279648,0.003276058816117421,-0.00895208283322123,-3.630479401244717E-4,-3.991786921376675E-4,0.014100525806033094,-0.01448996000074172 "
-"1652,-0.014330913851166461,-0.003952469520612596,-0.0032611060415848585,-0.007033829895085346,-0.01149775360397522,-0.016586292034199115,0.03423521720312999,0.05475590406955814,-0.007695742304263972,0.005292894095645681 "
-"1608,0.0014890678360134433,-0.01632302995278089,0.004888665694730158,-0.001751297287898533,-0.007390214227480973,0.009624917535745398,0.010507361636319771,-0.0017671935691936055,9.456423041959774E-4,0.022070415221174162 "
-"1609,-0.03530618557165795,-0.020601332374699573,0.018466842934450032,-0.013554604829803765,-0.023908967726123196,0.02594452960822428,0.0028565400193133364,0.04375918711913242,-0.025443553358549587,-0.007958817682687452 "
-"1610,-0.009863031792067458,-0.015496991665394368,0.02382225498562214,-0.05098067209159836,-0.031014284359858518,0.031129113287188863,-0.014362703172443574,0.01213427369044466,0.016297229493297285,-0.013655979464729741 "
-"1611,0.012117233658055183,0.005275937589505039,-0.015376545045795983,-0.00384198884435747,0.008171466684667516,0.0126153158164584,0.003923514866105061,3.4214932637218804E-4,-0.0012824290466299179,-0.001518469384638064 "
-"1612,0.004163243067664893,0.0010145948500613425,-0.004322384504105012,-0.011325167060141498,-0.003155791569492237,0.0032815651429039332,-0.009899602585905377,0.0062777791570035645,-0.022377225930994935,0.008918063877437132 "
-"1613,-0.008047825848662399,0.011599143989497376,-0.010184481966528712,0.0021733529568257184,-0.008501148028397833,-5.838066162545165E-4,0.005281333760228385,-0.006677796427985499,0.012172716385174125,0.0041564349758502215 "
-"1614,-0.0064308769160436215,-0.0023614967181944655,0.005531479083084655,-0.042204853673741716,0.007552062924423809,0.004784246959024206,-0.02256486894737206,-0.005870626688035421,0.029514929149339342,0.0016427111809514017 "
-"1615,-2.8900509046326703E-4,4.3893503168601405E-4,-0.003952132691143515,0.005457865071978564,0.004560815046250802,-0.009804649110460244,-0.001718023392120847,-0.01032874731197127,0.0022270180017998054,-0.010047418444512011 "
-"1600,-0.014403086344526925,-0.0156076857452393,0.05265158611760019,-0.03849806225682361,-0.08506930496626812,-0.003159940126674418,-0.0025598241396739244,0.029516969476081227,0.052522267948915353,-0.01214681316592807 "
-"1601,-0.12236492395845408,0.018377503678694906,0.09067244801524495,-0.12556453871741904,-0.11544535583284721,0.07883981394003779,-0.013234495640457719,-0.03499226058587537,0.15361980531821492,0.06809564494782959 "
-"1602,-0.0681661674845597,-0.021606387621999238,0.07393084413056776,-0.04643879620956141,-0.048325502310933424,0.024724009600730155,0.036580947390374055,0.12859107997694783,-0.032330325715563026,0.008746242703617246 "
-"1603,0.007284215076282095,-0.008099370815101474,-0.004492039089459214,0.02252197056146106,0.07419962829866557,-0.02496183384659321,-0.00124219086245176,-0.04986240266865747,0.017585483373411495,-0.014150265321863037 "
-"1604,-0.03825741977176927,-0.02389061335697039,-0.060861952414176364,-0.01840735729424395,0.10362983606763822,0.012231121515281955,-0.03791805110717601,0.014664143229897921,0.05147863986704497,-0.0037532306319876143 "
-"1605,-0.03703397528416396,0.003061311616068458,-0.010597159247491661,-0.009688177240275743,0.006841441235202234,0.04685858497903608,-0.0717411058175228,-0.03815326630034328,0.045615297525033516,-0.030580241462427056 "
-"1606,-0.12273129650326534,0.08383996421809638,-0.009525382654843623,-0.03253667233060811,0.14308176747719367,0.025580836809113567,-0.033148973292460235,-0.05240777109072414,-0.08181054168145944,-0.003622880709232147 "
-"1607,-0.027726517283843687,0.012987348819861683,-0.05796476989170375,-0.0234463451946454,-0.17270055194862347,0.0021034225682743895,-0.09766806580556661,0.012395313146046328,0.08687957515214506,-0.009206083486765096 "
-"1625,-0.0077735673122069126,0.00179177575929893,-0.0045672372370186756,-0.002585526759256631,0.010993354409184931,-0.0171462532006054,8.646089780677983E-5,0.004366303318497548,0.013607450519483128,-0.01202085918433442 "
-"1624,0.025078621003265095,0.01595107518856639,-0.019394932231417233,0.02625865666763432,0.0554654213035351,-0.015901287307671232,-0.018485483540729448,-0.03217465061327644,0.018325381380007215,0.023146759274330044 "
-"1627,-0.006229063743141219,0.006950341013768946,-0.02920690576532326,0.003989592565776356,0.0599032456451146,-0.01975745850079058,0.021609264206223677,-0.02328726187210329,0.01981666653557298,0.00906527971172001 "
-"1626,-0.007071767948922287,0.017741613255380193,0.008714499436521474,-0.024642181177234605,0.018659568681737355,-0.005475728191910058,0.016124978860706164,-0.020190458989522524,-0.002484809045249035,0.0012188919161393327 "
-"1629,-0.02597483834745508,0.0200578302390486,0.009770402775546482,-0.014072582921116334,-0.02917509668585935,0.02331834128052459,0.003650660076345576,0.0019511314723729878,0.024971270263709915,0.011875285343576288 "
-"1628,7.162139063797245E-4,-0.003938019045562129,-0.011519310421341333,-7.792278772640629E-4,0.003533124934208539,0.0071373467551697324,0.018546786217354665,0.005677340803109251,0.005920051487633757,-0.019846558381511396 "
-"1631,-0.010007827366755364,-0.027316357671803994,-0.010404131976115316,0.007712749511673293,0.04872191538594044,-0.010503589657986786,-0.0023857352329621742,-0.02110306471440061,-0.00577626320542326,-0.031223700316123103 "
-"1630,0.009875977271540257,0.012166075600433703,-0.0189483071124354,0.005954897831954072,0.0031585413101504526,-0.016412827304772063,0.011994024315716086,-0.015324747810636103,0.009111285664122244,-5.871728608816042E-4 "
-"1617,0.01869920562250107,0.007318038093259356,-0.012601813835619636,0.024442348378004537,0.027210469662630108,-0.014687152101531726,-0.027733524509681036,-0.03050809171796903,0.002101145043286521,0.012497261293928006 "
-"1616,0.0026061975157168644,0.009560804364187122,-0.00984057313007924,0.002919151959847255,0.052216325067037224,-0.006932268535610747,-0.020071913322764052,-0.051243135565171904,-6.402037083251263E-4,-0.004303263322541148 "
-"1619,0.0025764999880815505,0.02201501161219958,0.0021217716767959528,-0.02302587100299559,0.061399094915852846,0.013749514721852424,0.012670692720308048,-0.04449601236633802,0.01718372711471352,0.005526704472388351 "
-"1618,-0.009469664803445924,-3.5149452687505345E-4,0.008643817602905751,-0.0050554636992160736,0.007922650315743998,0.005183479613482224,0.0207842175606408,-0.01472126938372202,7.16833764075732E-4,0.0059019872023709135 "
-"1621,0.008302722924745187,-0.008926769334406684,-0.0038592751154642563,-0.005412020522924375,0.01624454351581069,-0.014234288097234435,-0.002217020728930089,-0.0032798709410888026,-0.0025715875733075206,-0.005818805844122167 "
-"1620,0.0011186152886882967,0.0205688986314885,-0.013992734419140574,-1.7520762271773475E-4,0.035237036029555205,0.020704340023428913,0.014746350607686306,-0.014623773203090074,0.01234201539542369,0.005399827138082581 "
-"1623,0.01641985789050907,0.007719757243167645,-0.006432616780723593,0.02212996182448148,0.06183880806555354,-0.017823519201624644,-0.006333956728100071,-0.03521999383791146,0.01555728440620154,0.003834849673100317 "
-"1622,0.011644408934323685,-0.0020529020617930716,-0.0023978837940636165,0.004192171668042607,-0.011297331867507704,-0.005387045181618137,0.023992556737196018,0.008550874417252267,-0.0010375162336593398,-0.005679070016572477 "
-"1582,0.006827255645785376,-0.03749045602164284,-0.0023885228001881567,0.05171229277430073,0.054238193616165234,0.008847852577396051,-0.026017010162845137,-1.0315409249342834E-4,-0.02827938170658898,-0.008276910303081735 "
-"1583,-0.02548598907230415,0.012830159247415833,-0.07938908458606818,0.01967237029756853,0.08705716008705812,0.0359074608724274,-0.06444481771163267,0.08100324063707144,-0.06102765392419965,0.02743933609876882 "
-"1580,0.02287139793751108,-0.002155972546768996,-0.004889644641041952,0.04119349406585302,0.07532707281049411,-0.04156520076195598,-0.006036022546264446,-0.012658201339589701,-0.025755006005603792,-0.02139237680192099 "
-"1581,-0.03471332886402399,0.008800742719061052,0.03155370418608545,-0.07210402976452991,-0.10576006263988277,0.03340161326124062,0.014614665021798938,0.021002645021907212,0.06104067120790484,0.0022266720783805246 "
-"1578,-0.03943983584712046,0.02515481381633727,0.012636023874157657,-0.019262739380177148,-0.03875079177884629,-0.02100077664291675,0.009994895445080754,0.05239475295835661,2.2820501556040305E-4,0.02989841352393834 "
-"1579,0.018350355335250108,-0.007205703933224898,-0.010175486082353058,0.03316430122543808,0.050204064122822536,-0.023830436341803877,-0.012216550160511186,-0.047917880791663675,-0.007203421808785186,0.004618308284598194 "
-"1576,0.0025091328657261785,-0.02389261532281771,0.050646728455551036,-0.05616055453160979,-0.11057803497968385,0.04166090737561238,0.05762489438559055,0.044660039344787204,0.016266676578797615,-0.01693870320348038 "
-"1577,-0.032808989322507254,0.00753187006779202,0.06267519284649774,-0.07564404811808553,-0.08717827456823726,0.05487696901656733,0.04052211071116483,0.052110108705143404,0.041922304845747695,-0.03145357009800007 "
-"1574,0.01097070863261794,0.016985765129204043,-0.0013117189320044917,-0.0076999763788721184,0.009185252233831438,0.020757059911234565,-0.009545081824132327,-0.009113403398586383,0.027386748668726722,-0.026078782368521035 "
-"1575,-0.04452695939949351,0.011824315336939215,0.01590960278425117,-0.0407152017395779,-0.05869713072132809,0.027214335109282162,0.018099333112305892,0.02637502234648863,0.03242727828149248,-0.0029938501069033136 "
-"1572,-0.08683656131556591,-0.002819606510998314,0.07256802514179073,-0.10338419476392155,-0.13310339361091306,0.062140280306242024,0.04178101825974703,0.09142810823168253,0.016635502710377024,-0.030983428483710686 "
-"1573,0.03714167905192425,-0.013528229199799291,-0.010320940339255874,0.03105621976489241,0.06780330385238047,-0.006384727403959095,-0.0023624563059305484,-0.06262926094136641,0.045514071449544016,-0.0030480897013711425 "
-"1570,0.017459002302822983,-0.001800048178069181,-0.012753591404912229,0.027947763497246134,0.019413019573715433,-0.012733895329237252,0.020734631845572386,-0.011302210540484553,-0.001854039176307749,-0.0034222666639101037 "
-"1571,0.023516459940112193,0.0050333563619447035,-0.014061049596095257,0.014727387218192623,0.06055863328076574,-0.011325522677118434,-0.02653368295007499,-0.018009275089747562,-0.020596831947564707,-0.01362208856983779 "
-"1568,-0.00827299911923122,-0.030815092668028465,0.03796125379231952,-0.04698412134311759,-0.08313340454662922,0.015607152392028277,0.010357936167628734,0.03251488662129478,0.006463905146239427,-0.025967899342170964 "
-"1569,-0.011012739115932436,0.03460982014719302,-0.02144519071102975,0.03167426977697912,0.040786144614690135,-0.0012440067368143638,-0.010551964303963657,-0.03433084093586094,-0.031096630419034876,1.169486758864549E-4 "
-"1599,-0.05157765239970251,-0.002180013104370262,0.07332532903567425,-0.08551674995803767,-0.06605476742393152,0.06744561361096817,0.009579307449353367,-5.959699515835695E-5,0.06242941423260143,0.0013860537012315498 "
-"1598,-0.015228028121850827,-0.015829870333651793,-0.0630413522737606,-0.004386657094096452,0.11854713025340782,-0.03506157062332373,-0.06603254975174623,-0.10559368008514554,0.0062429722862067305,0.0471225071348427 "
-"1597,-0.04696944133440069,0.031263959673057576,-0.04514417987030561,-0.008767813782214598,0.1390145798974901,0.023073781787023875,-0.02944195129029249,-0.1396612991693001,-0.010929652851520207,0.04830037382224202 "
-"1596,-0.001070479823166564,0.03947380657573959,-0.03385879766654237,0.05421321438810701,0.12324832299957818,0.01947565382435118,-0.0580797344901327,-0.051700420501399516,-0.031692824472405345,-0.022337036754016732 "
-"1595,0.0323656069040593,0.007479824339874529,-0.03537942108922717,0.026768345026839127,0.0823315342241174,-0.008597373521066909,-0.03035110193689071,-0.06246272592504226,0.002211620794529037,8.789050828014163E-4 "
-"1594,0.01716377455516418,-0.0020122657770092326,-0.016550296614369332,0.027598867318649564,0.017254628771370083,-0.012015363810322295,-4.3431214028486826E-4,-0.02194041434226372,0.01444644382966207,0.003217036049647334 "
-"1593,-0.007082861780994499,-0.010863763588776788,0.002340129028267107,0.01673992910015388,0.005488149545567926,-0.006725138327835726,-0.0066372464606547915,0.025143363883084684,-0.04257222569384824,0.006384162682928161 "
-"1592,-0.09701899949307197,-0.03644319238963425,0.06673500882144695,-0.060425090595803005,-0.028103781146715294,0.02595060817844908,0.014572555507563206,0.044676567834162184,-0.1531445605398463,0.018639428158719506 "
-"1591,-0.015432959015205236,-0.016989251759809518,0.005710238930446844,0.0022699723171919037,-0.038799169831526543,0.0180346897933335,0.017970236851343236,0.04767097867337582,0.01431846992198656,-0.009682336671705965 "
-"1590,0.004712844478106906,0.009500989727872538,0.11792502282308805,-0.21490219999372684,-0.2770743858021432,0.10861180852932766,0.02296868094409471,0.07482346096170844,0.11155704091680717,-0.04145729256648463 "
-"1589,-0.04848351667588813,-0.01502807237352205,0.03364029619902087,-0.07034924983795443,-0.06428562236024864,0.056221190677088015,0.02753309366793032,0.004878334670447761,0.033639848635513434,-0.01158450545969493 "
-"1588,-0.04999603415404162,-0.041583294609296974,0.09388137366040038,-0.10520810018346426,-0.16286113525375737,0.06947480501127412,0.04698918164982569,0.07919443369522931,0.0805898269082776,-0.03341556979090302 "
-"1587,-0.10657205719064146,0.0881063446730538,-0.014124598457524347,0.010165123091800144,-0.06701881516086719,-0.020110780738847717,0.027816523107920307,0.053145174928644914,0.07484377322803326,0.07459490468184474 "
-"1586,-0.010098661944090315,0.0330493948369278,-0.019638232582540525,0.031342302533348194,-0.0030148220049416473,-0.007525160204488418,3.742424769754599E-4,-0.011328494128081228,-0.014994144433449017,0.039524420863287044 "
-"1585,-0.040106076971759906,0.011878042356224737,0.024709852555450586,-0.03460698096962344,-0.07520245410393181,0.02473546822873395,0.03233981766098895,0.06496605739517354,0.03432973087250083,4.927322130944199E-4 "
-"1584,-0.09460408119763065,-0.013585321692521638,0.10918007086976901,-0.12488471590836502,-0.1513011350684105,0.1066775782162855,0.027563044100549498,0.02434744802264022,0.07211522992606696,-0.03439675104402814 "
-"1548,0.01644803114846758,0.004368498728726476,-0.0155115834367475,0.00456794132535497,0.042102935088722135,-0.03183538458291046,0.003985348567782352,-0.017887463545454608,-0.017352916589941963,0.009255278637099153 "
-"1549,0.0027822149400069393,0.013597372129406168,-0.011230259297784831,0.01540646202013271,0.05738680976838394,-0.00859522586009822,-0.0021322446650236192,-0.04972805666008686,0.007390401960145754,-0.0027270852800991385 "
-"1550,0.0020547498808828274,-0.0041500955009361115,0.011843961937391819,-0.02511862028546437,0.04280297090166242,0.009835495714557429,-0.012030951041665532,-0.04734992102783551,0.04026592029218836,0.00941709622110323 "
-"1551,-0.010654377529282449,-0.0010978190564405424,-0.010183548671962691,1.8318465291102744E-4,0.0537038977189167,-0.024178764797761914,-0.02167578905909917,-0.018181757553739,0.04230244247586381,0.007310920710259566 "
-"1544,-0.031785593926780924,-0.03302992040140388,-0.0012853174470850554,-0.03981101243740685,-0.046744858430153594,-0.008863202621584628,0.04219715485130715,0.07521417529226054,0.04372341640225351,-0.042172444878658476 "
-"1545,-0.04131993364023041,0.025411137692693757,0.05037768857328085,-0.04273459894823877,0.06564206627543503,0.02686412478072126,-0.015168108010090438,0.0066167298150581555,-0.013316513471665911,0.023028518083449013 "
-"1546,-0.024199998273791445,0.007304557867952629,-0.01677706210237454,0.023458109480366484,0.04921923866787531,-0.009049003561814673,-0.018806039031977282,-0.022887435774900357,-0.011591184955342154,0.024106084054936083 "
-"1547,-0.0018987126038532607,0.011951825649907957,-0.025056888472338123,0.03413292948859404,0.08100561481826199,-0.010149589897306988,-0.036949310817724984,-0.04639888772919386,-0.037400672021329566,0.013615520027209664 "
-"1540,-0.08980459297726265,0.028740909103374065,-0.0028251860079257255,-0.02944330555164738,-0.06659260673173435,0.06379350882781462,0.0640943265843129,0.032206413591186,0.02746773503735421,0.013054204858643547 "
-"1541,-0.05630076669074879,0.002586359606370705,0.04276562157444265,-0.057157897305395305,-0.052601587757584084,0.04419738715161748,0.030617161952542448,0.056162766192979566,0.0017335479233621493,-0.016094898713557987 "
-"1542,-0.010629951183156483,-0.0034515015777323767,0.026361342461477637,-0.021980603376443978,-0.04521695016277138,-0.0013868642267844435,0.009867595474345124,0.01340185624885389,0.007277279507315231,-0.018950479863264015 "
-"1543,-0.0906447257185303,-0.013542480772499407,0.07431732107233904,-0.09694524243191215,-0.11433769914339323,0.06893137534285261,0.07973739742483042,0.12239268049954882,-0.003347519429040034,-0.04233629376289528 "
-"1536,0.010661945715552885,-0.0029292231138834147,-0.0019231477649486878,-0.023689188433050647,0.025103403652513057,-6.645246917706915E-4,-7.969998768554094E-4,-0.009766259677825496,0.025027040202602626,0.007581144120394289 "
-"1537,-0.0308952093581741,-0.02616151359288134,0.018362676461445147,-0.006933846051189529,-0.006131624128850204,0.019439306178125202,0.00833338779711344,-0.009261061901669698,0.012080365329684671,0.00827116117765303 "
-"1538,-0.06164766993133051,0.02956168251381314,0.03958107823277422,-0.013079210355719828,-0.05329586880616283,0.05509354857940574,0.02613425202710185,0.03564241983665252,0.009372548449666684,0.005627496449895055 "
-"1539,-0.06707940395701775,0.001549190269439756,0.04091664703770789,-0.017457109354587563,-0.056443052181414884,0.04560396882305299,0.01758858646872329,0.05743546397301477,0.012323082861713968,0.00905046625106904 "
-"1565,-0.02602267269548637,0.0027459898605045824,0.03415755005120548,-0.01780349390460852,-0.05562636676895097,0.03028600840609989,0.019642433597328243,0.030064653914042505,0.0036892010421274734,0.006117884429667313 "
-"1564,-0.04546396571182758,-0.007416242940797069,0.044472265909068776,-0.04507299748128469,-0.04357825789672316,0.04452310886199514,0.023363123537942346,0.017821252271891096,0.0241994655294708,-0.020593059844820853 "
-"1567,-0.015324087144781928,-0.013296978986782806,0.036198978145391796,-0.04444197130075389,-0.056048583682057805,0.03167618822899496,0.027398793569112324,0.05016943273235673,0.0034672755457599903,-0.01690249978152613 "
-"1566,-0.02037707240754413,-0.015552220499258789,0.0252588755226098,-0.03514924447976064,-0.04420201887295369,0.00209643445410592,0.028778068675718475,0.02522287749132765,0.0173576917485763,-0.01853194342833338 "
-"1561,-0.011191963997977632,-0.0018269558683146655,0.003733887773215511,6.071877116591718E-4,-0.027819936096548106,0.012161429323749582,0.01209234043403472,0.019585845634401078,-0.014431738340905673,-0.013947807113255169 "
-"1560,-0.034698177410684615,-0.0106126084695415,0.04367877858379352,-0.054226099553744314,-0.08654052879730716,0.036712307934000585,0.01909797790091013,0.05197137743062103,0.018767284058070273,-0.016866047272343043 "
-"1563,0.003108974430558805,0.015085764398243018,-0.009378513736555209,-0.009030148875243966,0.007573324156057562,-0.01883439891234184,-3.3160087374452994E-4,0.005923056744843234,-0.003914821743585779,-0.004771755658573979 "
-"1562,0.010251190641208363,0.005433369099135909,-0.005513897523431144,0.03004187662899551,0.034539007506416676,-0.003636891536702205,-0.010197721759820809,-0.021800510173374244,-0.017470108700001104,0.004816203046144497 "
-"1557,-0.012948660746933578,0.005928695661747023,0.017900558754347103,-0.02342826187593981,0.04358221599560978,-0.012626638784846506,-0.001118321444868372,-0.033760567351884624,0.022992326238618355,-0.005645906510847712 "
-"1556,-0.023191757649278465,-7.983780757068372E-4,-0.004850953004252883,0.006673813525903074,0.0942943220047598,-0.01366014310960873,-0.023066019503040044,-0.029275874771596103,0.02752748358545836,-0.014984294664343905 "
-"1559,-0.05924230245675063,0.0504484247278902,0.03497367408967269,-0.1378616450838727,0.027178765987623702,-0.009565217946411863,-0.030156984727244512,0.04334126182427472,0.0659000321605178,-0.08453086991952312 "
-"1558,0.007775413124086799,-0.014640705785643382,0.0022822255256914714,-0.014050382138873524,-0.02346494047877568,0.02406256515946557,-0.007134744023860537,0.029533961112035163,0.08569852771342465,-0.013825906915100905 "
-"1553,-0.023555315527170422,-0.007680652441817119,0.03334709162229007,-0.024397873027720483,0.011852851155595714,0.018766718868709096,-0.01607369839727661,-0.029820320239125675,0.033074200386722624,-0.007441582415517628 "
-"1552,-0.06853337562087489,-0.013383159794443076,0.08046642190261408,-0.08434409062482479,-0.07098022099174893,0.05308317442897928,0.007027634901705795,0.012005105038349256,0.057395147468693584,-9.783340521129728E-4 "
-"1555,-0.03575676443403942,-0.028668656557530946,-0.012214281963141239,-0.0049881313153478015,0.08270260840680133,-0.004636283341770021,-0.023652809597080476,-0.005387524752930053,-7.096219105434934E-4,-0.033996079739743654 "
-"1554,-0.05348107914873153,-0.01470605209001939,0.011076102703615413,-0.008608361380541591,0.04608029439151591,0.010650796566932885,-0.029049424133271603,-0.006504495774736606,0.00933656498454899,-0.011634946249691804 "
-"1763,-0.013758143651908694,-0.016966724390119103,0.021814984112824697,-0.00473631697959774,-0.05524737882103967,0.018029065407482007,0.01730904858992176,0.04007570885499907,0.02154833278531672,-0.002539907937650607 "
-"1762,0.0067755782207690645,-0.023593914682190912,0.02068063112315265,-0.03293381630813074,-0.03522625954775647,-7.873415168533574E-4,0.001552848320936944,0.039638099345286636,-0.0037090509299587777,-0.021363226205125724 "
-"1761,-0.012797491344495229,0.007643805871679921,0.02055882896682359,-0.003907676308849369,-0.037838330691308965,0.013648681632248067,0.02214985410790522,0.00450574551357928,0.015504260686505192,-0.003803085547825395 "
-"1760,-0.005519324218523414,0.04148467176267613,-0.07374423529157192,0.07929242032151972,0.10942612666887397,0.015994005036237408,-0.033680830249353366,-0.09676066181900544,-0.013574244988739114,-0.001896535680578452 "
-"1767,-0.0015485644219483965,0.0036795245608530064,0.03393271786395288,-0.019283237427454535,-0.04274114506605873,0.029855287808278872,-0.006081821323682501,0.03411921976906089,-9.089286297902748E-4,-0.01662716424249712 "
-"1766,-0.011966088938373854,-0.010282183737411516,-0.0026720553545168755,-0.008923015791144538,-0.026629936484198515,0.017056481455678143,-8.517511757812118E-4,0.026661043678336754,-0.0022460968602384065,-0.01716068631704322 "
-"1765,-0.01748291895768802,-0.006813824179304966,0.006714126384779957,-0.0027364883847312413,-0.01855795277134401,-1.8318641434244306E-4,-0.01884762887138049,0.011095046058492156,-0.01579546276958931,-0.02356797943057859 "
-"1764,-0.03259214174247215,-0.0351639470940498,0.030993668493561725,-0.04304038143375974,-0.11224929134283478,0.03385938725882077,0.02830055037673406,0.05252775734518423,-0.03539108008087083,-0.013712113404179658 "
-"1771,-0.00301846315228962,-0.02434130793066701,-0.0030871825394941923,0.015278198452708959,-0.020154400772287372,0.008886093402050708,-0.0035752407864010393,0.05640055837635562,-0.015713681543660818,-0.017997403899388437 "
-"1770,-0.006147590118261157,-0.0014660141804935674,0.04982044315082885,-0.052982592492175136,-0.0735644249999484,0.02034607559021717,0.021279447108504282,0.040970646245675674,-0.028838833712031164,0.03186697914310196 "
-"1769,-0.003201665574671497,-0.003249892466975876,0.04942653177193991,-0.029021541124701674,-0.03649436368602318,0.0017608755642310608,0.031580682145038105,0.031241350064799178,0.013291208080713691,-0.0171135463646144 "
-"1768,-0.015543801824263778,-0.03353642682364108,0.02520837994237559,-0.03782775655824225,-0.05446854105592695,0.03296508847963526,0.011826827984537588,0.05182982919525487,-0.00822648052583818,-0.01656881030484764 "
-"1775,0.005341357459669632,-0.025273295325633795,0.05095967797691084,-0.05769944490553412,-0.09407169405530398,0.01164307975650226,0.0461280205130877,0.06693655700117336,0.014480158019532736,-0.0203103611175482 "
-"1774,-9.008235170372512E-4,-0.036750243294998146,0.036296156920491825,0.004811670681592977,-0.08773569583643857,0.019389853978147627,0.009422435464098038,0.05757503478290166,-0.03189428851673479,-0.004834077061197524 "
-"1773,-0.0023703880533564206,-0.007458836438697141,0.022551333129039,-0.007531974623290218,-0.04385397739203836,0.018360227021755552,0.007022120774628519,0.015566307783045378,-0.01055216948056876,-0.00664046950960748 "
-"1772,-0.06436329717480303,-0.0063056376778853115,0.01944358159530676,-0.026394235310135437,-0.06545339602175348,0.0074606202689394855,0.03491661009418574,0.13360433953865172,-0.08606059345604902,-0.013906855117269065 "
-"1778,0.0015364199199063228,-0.007172720723236184,-6.722311808275286E-5,5.385363664614094E-4,0.007589776747819943,-0.016331509217290437,-0.010398285097444357,-0.005909913229344889,-0.0038523417005709043,-0.0075731618918848075 "
-"1779,-0.004341978099568175,0.002749561089921494,0.0015177845832199375,2.3787381688369127E-4,-8.997065810086902E-4,-0.005896100731053295,0.006952862317778671,-0.0018412765539970143,-0.021580438572770477,-0.01213985534015424 "
-"1776,0.07480566304898971,-0.06030944759171182,0.0368168760133334,-0.1438542057901044,-0.30547762330250544,0.006453816965424165,0.06580408510317759,0.03132533551895081,-0.02522083537068819,-0.012282519730211766 "
-"1777,0.003714376479827659,-8.33897047172546E-4,-0.014690080937155034,0.0025624908023494718,-0.010494742558376288,-0.004221964810974317,-0.003987629050973799,0.007914374655582377,-0.0027558683827931577,0.004351970395307159 "
-"1782,-0.013003432879694146,0.003024722880048289,0.019656138709467606,4.685319084502947E-4,0.007414662989756958,2.998323684549424E-4,-0.012063916639199148,-0.012489522421831871,0.0170298984836883,0.0069420059041228254 "
-"1783,-0.006336427131458836,0.0023434404806746785,-2.623255740904189E-5,0.005516705504217926,0.008223835726336878,-0.008455001184476818,0.009251026682482818,0.007310858889836563,0.0059149722193343884,-0.006479038626490307 "
-"1780,0.03251042970297121,-0.006797789556979715,-0.030324582627984754,0.022074200543153868,0.0362265614766254,-0.005314942018285697,-0.003502311547997883,-0.02032041066628808,-1.9860912069487823E-4,0.02011434086623267 "
-"1781,0.025608752093154663,0.008048121006932172,-0.005137218780412935,0.011404480356160157,0.02901049030901344,-0.0023175072350784948,-0.019765913112449143,-0.016457584334673158,-0.005351063149095665,0.0034356579668040443 "
-"1786,0.01498141758814576,-0.007550840047590729,-0.01030167626205974,-0.0021962498035222105,-0.0036230286286420116,0.018939609664966998,0.004401109970863034,-0.009550383467669123,-0.0011941643576875202,0.01158466274876087 "
-"1787,-0.01381115081832004,0.014999840266309752,-0.016072413955976028,0.0035524223342553447,0.0025424034450445766,-0.007512839271674856,0.003509178674865472,-0.01947214233898731,0.004983873100055409,0.005029819220544771 "
-"1784,-0.001873625194325582,0.0035555272480472925,3.593237836066756E-4,0.013616936877806582,0.016585350291353152,0.01570025203978562,0.007117050703892344,-6.167749184844445E-4,-0.012001921028545744,0.0045045203341399455 "
-"1785,0.006445521005726306,-4.254003781774118E-4,0.0032186256563365456,0.007612588981066399,0.013279314683554566,5.788691459370256E-4,0.01636770214798245,-0.002867082583043844,0.004277662933665096,-0.0020601898023729324 "
-"1790,0.01577709065770788,0.006603022564446867,-0.0038160363325678986,-0.009157931293927432,0.01388427493390081,-0.007506857893404564,0.005058592478844782,-0.025093200014359107,-0.0060829622799782775,0.005548894150104916 "
-"1791,0.02033641976745098,0.006149667167958788,0.008104171945610118,0.011787544429508873,-0.0038259774128017758,0.011169227713978318,0.018012731858281672,0.015291012211888182,0.022747386230834145,-0.0047206539868622005 "
-"1788,0.00644792561857783,-0.009608136655407554,-0.001898105977556456,0.012887218508769335,0.017301860317756095,0.011790902469981277,-0.0018336395818778887,-0.006388334721097461,0.01221282635496286,-0.013842642695551105 "
-"1789,0.003732283215794911,0.010268670888121766,9.253992431890916E-4,0.03537403096786711,0.02486261242000827,-4.6546039491980205E-4,-0.0025787783944428194,-0.004046283231128151,-0.03576903438287731,-0.00576192978233435 "
-"1729,0.007349308800018985,0.013603640583181956,-0.0333752416752993,0.05054733004454509,0.0577266621799208,0.0166683574811747,0.009032176723351692,-0.0011012459550153579,-0.020885005399979353,0.0031299005869593137 "
-"1728,0.01521992612480938,0.010022923372772117,-0.010373407744841079,0.012595950905277084,-0.0018274305036792683,-0.023590558979962758,0.014137480884298045,0.006218620165255981,-0.02522598147624366,0.008449065968261189 "
-"1731,-0.027007157851276865,0.015576359291661611,0.011106708592314052,0.005323044169946109,-0.012796510248468536,0.001472773573899042,0.006699841869657015,0.01843394947799251,-7.183648576586148E-4,0.021723699026402466 "
-"1730,0.013461296542736628,0.0022179757056867188,0.013318055526983454,0.004827117581766988,-0.019261953080334855,0.005236007482865105,0.008411186443053078,0.015017299319642637,-0.029173772696479222,-0.007476699481614665 "
-"1733,0.021737374002648534,-0.004483810950271664,-0.010264663111888492,0.03528621119092245,0.010689808563577905,-0.016821522114651856,-0.01023935772021317,-5.613337239485035E-5,-0.00634836309758054,0.007977039261437752 "
-"1732,0.004550597693978523,-0.009361525220245416,0.0056129656832703476,-0.004316225640628799,0.009717817514091988,0.007654068150009631,-0.0024455247995066195,0.011475680217421706,-0.010800210126384891,-0.0010417415009306645 "
-"1735,0.07819659081284606,0.03654740222476859,-0.040809063009549514,0.09845892962004302,-0.027968896589101646,-0.026975795062888743,-0.028523758712399535,0.031142697708743037,-0.03282771635374453,0.0022578950476796504 "
-"1734,0.009199689579643327,-0.00661436702098997,0.013555653906982074,0.018235216297384078,-0.018137007904102852,-0.001548449254437486,-0.012825830933476678,0.014263235702183474,0.008048509951131967,0.004030159985295574 "
-"1737,-0.019284155631054994,0.02905527173681493,-0.0011962008577270872,0.004386118085443382,0.008867931119745856,-0.01711201948665245,-0.010556917396123872,0.006891800449165705,-0.030206124349298147,0.01315291726319302 "
-"1736,-0.018409613155482438,0.0043565899790147635,0.029185551104797813,-0.015469485852071163,0.008638329686278397,0.012303857588377036,0.015684160375266765,0.010442238752929515,0.008308298375460621,0.017950218048595066 "
-"1739,-0.005194468657341918,0.013311323815259823,-0.012097539862808497,0.010166015376778172,0.008613802569092355,0.006118101582537747,0.017248311554961426,0.009177731625241548,-0.018951668724781674,0.0013545291638042785 "
-"1741,0.003814277636258854,0.011754095073619155,0.001312969989299533,0.007694770849581773,0.008989504019011942,-0.015707340230749173,0.008788288866798142,-0.001373848672681991,0.003024970978720605,7.522755897993522E-4 "
-"1740,2.1991571873167622E-4,-0.002505533210110224,-0.009234178568156705,-0.011892482995680275,0.03139786292614388,-0.002864521458848462,-0.00885126451206512,-0.019689477514573006,-0.009582873827073818,-0.0036149926985400535 "
-"1743,0.002068213077919417,0.023170888973778846,-0.04095674782167515,0.05478510622772552,0.07571006838945064,-0.02782075232002715,-0.04013771177351135,-0.04424615997609814,-0.01192545629018747,0.008808590235253554 "
-"1742,0.017350990836834446,0.007733754033228391,-0.034080385590906814,0.03329752351737183,0.07622057458462461,0.001028053120430786,-0.02675091449258816,-0.05567038814921675,-0.02261714265859597,0.0015598977506101736 "
-"1744,-0.0037425885386189626,0.004153432386414071,-0.004403859405385119,4.657057642554406E-4,4.241090452069224E-4,0.013468253060025144,0.0023431314278096744,0.02266393415558352,-0.016588816079723904,0.023228165629059706 "
-"1747,0.015411682084133883,0.006674155907781758,-0.0028376809300301115,0.007965260935365707,-0.01500275923875224,-0.006099300694455247,-0.02503751192000631,0.01929288809827112,-0.007468981247426378,0.0010950988821416836 "
-"1748,0.012555604172056192,-0.005119786657737413,0.0019757347923104436,0.010282050838376222,0.018954007813695103,0.0010715522558208447,-0.006993479461384882,-0.005327231839530214,0.019552942934229905,-0.004060792290988746 "
-"1749,0.010670632950459249,-0.008458452461489145,-9.122123356366999E-4,0.017529343887349915,0.0203057923975058,-0.017816525211980756,0.0010313214683561288,-0.01533168512193602,0.03469265890761145,0.003660444218452915 "
-"1750,0.02379305740113818,0.026047687747732664,-0.0320067581835563,0.053218250367477876,0.07741184530409968,-0.017188887259430546,-0.03784884716231038,-0.05312844629934416,-0.022889257550876424,0.003587515304390943 "
-"1751,-0.001221007981702075,0.0054595944777830795,-0.04012067576940277,0.05226539671771095,0.08402123166718796,-0.030691434020991795,-0.026934439290506453,-0.07754686777934122,-0.04191288620879151,0.011245605445436487 "
-"1752,0.019312686844304115,0.016670284104484387,-0.061053575363537095,0.05810866257557448,0.1204162706435541,-0.006071385252154617,-0.025640674341161327,-0.07498549265174576,-0.03220451424357086,-0.026369241754742645 "
-"1753,-0.003784193091461107,0.029100470656006357,-0.03655596160814601,0.024095816602345877,0.04279510635441253,0.005133162574167792,4.7276647257389213E-4,-0.030745971857826054,-0.01922987851702333,0.009321942904174638 "
-"1754,-0.006079144242993389,0.03975894754915724,-0.03561913694410205,0.05150326772808061,0.059131452289322164,0.006089958796539288,-0.03930974879509171,-0.024993388474316987,-0.01335479456357793,0.04152333521824208 "
-"1755,-0.004216700497908544,0.023274776156989998,-0.010745509687751684,-0.0018858785619579022,-0.009689069879781456,0.025221090132920426,-0.018128774958372732,0.004491925578675485,0.002702557903835898,-0.013509436069625394 "
-"1756,0.011339998555679291,-0.002873228208237702,-0.013647868114757431,0.0032281804904933896,0.004515941082598804,0.0046185905048997606,0.004699988948950597,-0.00718171286584088,0.021467659177754755,-0.010808404250868408 "
-"1757,0.0011484431263403445,-0.007799175810286289,-4.2589416697705145E-4,-0.0039055989963444494,0.00528123325082257,-0.002557902822251993,-0.008743608727685231,-0.021392241336299637,0.004296933617402328,0.006166810731879495 "
-"1758,0.00839080557377718,0.054317200073921976,-0.06237050059203629,0.08162746720702811,0.052805868505441604,-0.04506779010877818,-0.022088656724477452,-0.049734387654355304,-0.017029163120276993,0.02759648856092146 "
-"1759,0.010678690640948847,0.05878209469116266,-0.06172638815005703,0.043788814991439905,0.12828686919202556,-0.003203043394397515,-0.027927925484416447,-0.08440037797262574,-0.01061565037206705,-0.019605088289319384 "
-"1703,-0.0018731044419416187,-0.01401525924030456,0.006200551994888692,-0.021662205457554262,0.011619676989779061,8.792934485969244E-5,0.032917611805814186,0.006707718486116682,-0.006277213970131864,0.008434494872642936 "
-"1702,-0.039159416050735946,0.016177946439394554,0.03454253749536601,-0.05621226754808006,-0.08933194749063006,0.018588957520668345,0.03917121947559282,0.03739976808079065,0.04628634493466311,-0.0027660272415152712 "
-"1701,0.007462308778063533,0.018661931538013498,0.004098601518175875,-0.007057223911695834,-0.019098310402562952,-0.005192287389521452,0.017501698604870924,-7.032597046385179E-4,0.007373089200588794,0.009491789523124737 "
-"1700,0.026973113601691977,0.04914168797891341,-0.007664050750507711,0.07039948492111271,0.03682628824509188,-0.022757897587676594,-0.00863681767273519,-0.02025069573174575,-0.05101536557502557,0.057406091716689665 "
-"1699,-0.01092709877185186,0.03737494559521038,-0.0010809177801773368,0.04364317829990651,0.04341878394044671,-0.008384755118791137,-0.01776999725336056,-0.06317258520035661,-0.03809047221469324,0.028587526496055917 "
-"1698,0.014028044730854476,0.02736189772571807,-4.4898681319374483E-4,0.012381934599287915,0.022706279907043356,-0.007772041035632031,-0.016114978795340296,-0.009531130635104459,-0.005008554411396854,0.006767854341938466 "
-"1697,-0.008133265756773856,5.063268153799694E-4,-0.014800866857603824,0.011647433770252267,0.03127262930433219,-0.009415880582069628,-0.006686376643752646,8.871801345564467E-4,0.0011840456957846628,-0.028256244186809408 "
-"1696,-0.012596228825204864,0.012774710313120578,0.014827402861009288,-0.001040532439384228,0.019892642022014365,0.010489966997349469,-0.013734505567387579,0.008390803746941138,-0.004512968871754369,0.01564270148346349 "
-"1711,0.0037659513286192876,1.364049671936815E-5,4.884033332615621E-4,6.122026885935404E-4,-0.022819778315802425,0.00574104224465224,-5.380542924531107E-4,-0.001087690541025081,3.6643093659066483E-4,-0.010182025142691068 "
-"1710,-0.007774743935890822,-0.007357502591026133,-0.0017599731399370556,0.010255798015452396,-0.003013149692016138,0.01047244971257595,-0.002490702697268056,0.026544703610336912,-0.023078931082567443,-0.0014534468442693694 "
-"1709,0.006906704241989683,0.013842705623949842,0.014076729270899762,0.0011121381500201627,-0.0029750270062147205,4.3090461034517085E-4,0.02126418883957474,-0.0015055073273121738,0.011008051800957127,-0.01205696720978261 "
-"1708,-0.053067237357414726,0.037157880675899056,-0.04482244474883813,0.01952556647601459,-0.08687727679049118,-0.06364319762510556,0.04676415335760899,0.02149255976081016,0.014282311035808511,0.13991453269917833 "
-"1707,-0.022255088959825732,0.03557095779264303,-0.0025211874860067715,0.0057994627956357795,0.019115158183894358,0.008043060657233652,0.009189266072230752,-0.012764636735333436,-0.0521575879038037,0.01628622052909901 "
-"1706,-0.017575866911061253,0.025195470833827706,0.0242091299154617,-0.06981738006623561,-0.09589073040201908,0.015410238056820383,0.04494788382047319,0.049704584569933825,0.06162551926425448,0.012385429446232188 "
-"1705,-0.001935525887141768,0.015235355506326351,0.006472561028351275,-0.004564459817665679,-0.01656713390131252,-0.016934307683639554,0.011937888861534282,0.0040232835230608185,-2.5602947984236935E-4,0.011448115861251934 "
-"1704,-0.002957518265914845,8.757291683371215E-4,0.022002958052562124,0.015238829361683002,0.013402329397433061,0.004987497906172842,0.0029243679265269886,-0.014771725433987882,0.00781385199029571,-0.009518806420228065 "
-"1718,-0.0028242250888553333,5.135867668691888E-4,-0.005244379676094133,0.05571302950486698,0.03332585460704043,2.939317424686544E-4,-0.005041630181382367,-7.927517171892991E-4,-0.08279121558039494,0.04298225761928889 "
-"1719,-0.04539286522825935,0.012845399431506425,-0.0017094820710978934,-0.02095349420620803,-0.022635577386391284,0.011935299715696927,0.0314272711400648,0.032575570942316376,-0.03339357126233321,0.024698795736028133 "
-"1716,-0.01805929164175518,-0.00416524189472266,0.02157222924632799,-0.041886290144585815,-0.05548289728834737,0.025781033977200718,0.030052652556347807,0.028704795108373773,0.013656263775930485,-0.0026221605761811433 "
-"1717,0.0025156947662199414,0.03282262165399937,-0.009552230628482986,0.04838796499985516,0.03829057001823379,-3.392457855263618E-4,-0.0281675963717074,-0.02049930695109256,-0.05461677824340169,0.029079415522402854 "
-"1714,-0.010844826424444686,-0.005750918954306467,0.05174145905834132,-0.18054900876223406,-0.14800123584575076,0.04462142954899762,0.02735494322874945,0.09066081701616273,0.09237950242102051,-0.05703527994712293 "
-"1715,0.009002672165895833,-0.0035713181388178595,0.007056663463296129,0.012057740677113515,-0.014273387404926093,2.7085898075409693E-4,-0.014698488904007951,-0.0069971422776933315,-0.006641541247938022,0.003801915499429618 "
-"1712,-0.025799194811590757,-0.019975358212528976,0.042978962842172196,-0.07990808590294508,-0.07289215360423315,0.020981910814849916,0.023216114675179412,0.05715027499053159,0.036989139820235696,-0.014096766417379301 "
-"1713,-0.04248952420883769,0.003867382814158636,0.020607670706480202,-0.05591046844990189,-0.05167864782331279,0.015452633767455813,0.05096999692170421,0.06035585687380806,0.016871548994730614,-0.00406373054271305 "
-"1726,0.001988850595292718,0.028972275972609436,0.0033998710503976657,0.018799819115537353,0.007382368659723176,-0.008329303412028363,2.9080015955743873E-4,0.00344682980801245,7.720691322094478E-4,-0.0013350298280238534 "
-"1727,0.02496267575940077,0.003530745248088446,-0.031801206349535725,0.018609742909694738,0.03135293208779893,-0.00809708256510414,0.003928408405983587,-0.01861698206905776,-0.005989155601078491,0.007638481211629309 "
-"1724,0.006005413091312052,0.02408343602868537,8.027891748035402E-4,-0.014990494524784655,-0.009106240175369627,0.010353347097002316,-0.019259111078903282,0.022863067119168686,-0.011922865637851757,0.018851638055893936 "
-"1725,-0.008739023001643604,-3.326484627282953E-5,-0.0011091884856715007,-9.085520974475987E-4,-0.005586152498742974,0.014742545187042003,9.093292186622167E-4,0.011460851451751264,0.01538317738075317,0.022655133368130395 "
-"1722,-0.044009594078621775,-0.007960174484555669,-0.03258100358864568,0.012476444527110981,0.006579030675453404,-0.01991031509874475,0.04367412486559366,0.0038327544303443906,-0.06623353272305188,0.018855024504008496 "
-"1723,0.040770221991564194,0.022022722262560752,0.05285038407066836,-0.17725457002963665,-0.25829864361072585,-0.011193739288304942,0.03944192640405941,0.14793148146962573,0.04406730719283038,0.018484571387338368 "
-"1720,-0.05898421614801555,0.0175379001135732,0.020232723119410552,-0.0533645675293049,-0.0618030535860565,0.038707332393060144,0.07254862275934171,0.07318081523458186,-0.05912730429602037,0.016444976688886694 "
-"1721,-0.018039697685603404,-0.02121786015391836,0.051356829574789105,-0.06156858602930162,-0.06945927313302334,0.0077951892425688046,0.03911567296279621,0.08456044275319263,-7.834511964832613E-4,0.01748383418596036 "
-"1669,-0.021443668902561035,-0.025440015113803817,0.03589026813369852,-0.04214249219769418,-0.03124437332674661,0.03879740047780857,0.002109109297649366,0.01237007278322154,0.05036350356585463,0.020209210268028757 "
-"1668,-0.011678826821352191,0.03272328786568564,-0.00580754831014625,-0.006939524158337972,0.06549569568431182,-0.008301252324305302,0.016082719510178423,-0.031760015355137464,0.020802822696240824,0.015837046207744468 "
-"1671,0.003082208009201871,0.012486382585217629,-0.03760032212574362,0.007819078410822394,0.09879658561171614,-0.0021988733539426934,-0.04076585732868341,-0.05071369521148804,0.006663271491239141,-0.0044045293261521816 "
-"1670,0.020559541097340046,0.0069435119418509855,-0.02150151941647182,0.01901860544519208,0.02567567704893158,-0.009996939422203982,-0.011898029379257838,-0.015556425493603242,3.505239536454879E-4,-0.007940107139186345 "
-"1665,-0.011337035721824025,0.026837051620478836,-0.0105066429970353,-0.037432164326174,0.07409881631487043,0.02643333488261814,0.020717089432502386,-0.06306051785659411,0.03805931389227148,0.003341562962145684 "
-"1664,-0.0252805783233335,0.028818796193691983,0.004864998705976079,-0.030641207806525912,0.05646492084149135,-0.00247756967314438,0.008600296238372114,-0.05971986113602116,0.02269264372551594,0.007315622181289183 "
-"1667,-0.01882021229610502,0.014998487610359624,-0.017304077662132218,-0.01592889132149102,0.023042953864371284,-0.014547817301174477,-0.00500765451741338,-0.04046435854455381,0.022606449890980564,0.012979030224437244 "
-"1666,-0.01416853925985798,-1.835692126835269E-4,0.001157578226476163,8.321478596879022E-4,0.0027559985366908727,0.008527711797026478,0.009663722100036413,-0.015257309047362524,-0.011124609103083476,0.003976379971055164 "
-"1677,0.028793498144327943,-0.04099318780977284,-0.024232690568499214,0.058670332275715914,0.08559411294848762,-0.028210315347143054,0.08591924604074738,-0.08835283194411538,4.5998178950620167E-5,-0.10133229398183913 "
-"1676,-0.004452495586625719,0.028769817217514426,0.03731485216187331,0.0484770031559287,0.05003685618944861,0.02659349015002248,0.03833735310449742,-0.05564787575657845,-0.008206925436961951,-0.07012991184948084 "
-"1679,-0.03392670332084852,-0.016543931859099505,0.018510193848743424,-0.012060940822746474,-0.03493101963165122,0.011099461398289774,0.01002571784778287,0.02566595156373395,-0.007213103585558921,0.02372645096541056 "
-"1678,-0.020655070549156683,0.008001903957754384,0.009124229524658611,-0.022931481011961415,-0.010937834977995466,-0.0028268198423104253,-1.6378263448169262E-4,9.636848343224204E-4,-0.017065482149982533,-0.015286241786740446 "
-"1673,-0.011486850653361268,0.028574130789144156,-0.01879978461011971,-0.028540919859841623,0.03596747009460328,0.008833787910905711,0.005893927111333781,-0.03017366778148859,0.005286814775611974,-0.0162263013854295 "
-"1672,-0.021182782837452913,0.02516847913731999,-0.004682081692662725,-0.016573100141154085,0.029967835064920612,0.009750412208032501,-0.0025982033191957166,-0.006912197165651336,0.0010624009906039652,-0.01728388029301803 "
-"1675,-0.02123241029652466,0.004964263032992454,0.0180851497717632,0.010894801952919024,0.06076650203452372,0.04042521224194635,0.05026567007895441,-0.003985704350237342,-0.07465067548013879,-0.06780956371818077 "
-"1674,-0.007815811926026144,0.05816573763748502,-0.0371225257918483,-0.02313424456216539,0.08013780086988864,-0.010087415948330429,0.020798952628280482,-0.022212714302139353,0.09790544834828821,-0.011337199688411794 "
-"1684,0.03196762474493331,-0.029925163440912807,0.012041993237391546,-0.03816439174004766,0.08904264459172989,-0.020823124257702726,-0.06860041976206856,-0.055225522636624995,-0.03824460653288594,0.006911552217335921 "
-"1685,-0.01717646687926273,-0.040705353386930584,-0.027189842511227472,-0.07257326944387953,-0.027870195564702917,-0.035158881684337805,-0.018085435408935813,0.07796527323569755,0.02758730959536668,0.0058660542074526305 "
-"1686,-0.01959095916490385,-0.013476467200139,0.0217898130682723,0.011100085992716212,-0.045499424800816486,-0.019548917117962507,0.012934679222135167,0.023476219876156598,0.00567219881553172,0.03243737307349063 "
-"1687,-0.015224228867565796,-0.0034497400274745744,0.003468761095570851,0.0066763445838378755,-0.009294481618600593,-0.003735279950759441,0.007769254145025768,0.006467786444418101,-0.002804081292227721,-0.014455611958090508 "
-"1680,-0.020250584878039702,-0.012118430835044809,0.019803061542542317,-0.02491831364001767,-0.027387287145629758,9.390396316391825E-4,0.024248101885065678,0.03344482434907451,0.0032868665437904873,0.0075840983796005654 "
-"1681,-0.016561689482883297,0.0015579457566876585,-0.01028348187134396,0.017682211755202674,0.0017261986383115225,0.026721507023648245,0.012936509366099342,0.014372543891178506,0.0016996716630454304,-0.005075191996160372 "
-"1682,0.01849066973760931,-0.0038658251898648147,-0.003842417716534034,-0.008966546033579931,0.004099850393500234,0.011779269059460357,0.0012035314995272506,0.005013570217899994,0.01699198077595977,-0.006386331037789559 "
-"1683,0.08074957221573212,0.05930897006267937,-4.718097532085059E-4,-0.08180236816082273,0.1157350810614053,-0.00435919131513255,-0.05115262141052743,-0.08319483654632208,-0.05387401578722479,0.012376412196214373 "
-"1692,-0.0068626774732933144,-0.024886228853138903,0.0128196436353819,-0.01600702390450719,-0.05398651464442125,0.014308923426309015,0.01708210094756088,0.030800693773535205,0.006861592754229331,0.0029050148259313854 "
-"1693,-0.013472364222116616,0.0016066317370193187,0.005544835574579061,0.005687474090114047,-0.01808290709660227,0.008152590021429606,0.011913434589709055,0.020973031799912632,-0.007684904476222341,-0.004048593933861837 "
-"1694,-0.0078072603162563994,0.0025769897470182294,0.023222939635662077,-0.025143521797993243,-0.021194539569871558,0.002746601009591655,0.03492000597494703,0.049220931052334535,0.004231646589498427,0.0060985470833581756 "
-"1695,0.004086622735647673,-0.0038202511329719813,0.008135279457813354,0.00766081692489458,-0.007260828837502605,0.020369339087937605,0.024134357716395983,0.028914159887197817,-0.005903223285926446,0.002579177683902188 "
-"1688,0.04409379647224408,-0.03158196313683199,0.05322050542480961,-0.06251654940589074,-0.07643714607433703,-0.07599723832806497,0.0651108700783914,-0.023172061710185123,0.0047007638306466246,0.05828066719443135 "
-"1689,-0.03857317809752988,0.023581185855797354,0.04734280556949842,0.001352311282636671,-0.10568042648404856,-0.022118984104035826,0.04735735799959748,0.02254371211737009,0.02145075431309359,0.09057453090010005 "
-"1690,0.007019799355274636,0.018967579940714716,0.01629882661256395,-0.023605889653161422,-0.032069734421472505,-0.008678548883527698,0.0211341556898668,0.027129443050319727,0.018978964507179747,0.002007836933401245 "
-"1691,0.014405463442557687,-0.006898664502014948,-0.011314735188041797,0.018249856155637633,-0.006426569918641066,0.006232411460825594,0.010096333958945271,-4.3983796393520433E-4,0.014043349019007188,0.008679384313601662 "
-"1913,0.031257991647612934,-0.0015167631699775606,-0.01869930564923757,0.028789648428284968,0.0440021559416546,-7.873055121878518E-4,-0.012829621823220646,-0.01719299967566667,0.005137229280964052,-0.008752427963653884 "
-"1912,-0.010426395670269987,0.023706421129693185,-0.05700915104639139,0.07633635062309216,0.15437690743310634,-0.004947343738061718,-0.04654209084041501,-0.08956653386280707,-0.02881783509717696,0.025552109033269134 "
-"1915,0.04443561419685789,-0.010602948563314663,-0.025805495745021508,0.03241501343117695,0.0582267487389077,-0.032942249461568984,-0.01486900952786575,-0.05058223278174836,-0.013872014025599838,-0.019495024394522012 "
-"1914,0.013608537278828832,-0.007571115304008612,-0.017263677666544606,0.009276792410154373,0.030123673981841726,-0.006352267887905062,-0.0043065730466068765,-0.018643708099969628,0.004953847000898266,0.009596710226913397 "
-"1917,0.04800961955887271,0.03996129999260164,-0.07150735049387819,-0.0018685589192316,0.10005070666715508,-0.0028849217758405,-0.03438532971020665,-0.06356235637735058,-0.014237815310709105,-0.0702581259140907 "
-"1916,0.04265258855542605,-0.01111763894775368,-0.02759569170186138,0.019012483147987466,0.0359977960053034,-0.026029402771276213,-0.015105389330063211,-0.04398206953231227,0.00827420560956016,-0.0025231834608182156 "
-"1919,0.012942348299015093,0.024316128116350196,-0.012235242490778949,0.009286790011637597,0.018238904134807336,0.0040901963292951475,0.010447294318200897,-0.03462670865007307,-0.0179007253012625,0.006197174409369576 "
-"1918,-0.009432537398758819,-0.0025953488467959896,-0.014503122404396144,0.01168407289463855,-0.013077030479890783,0.010023040282571847,-0.003912640337976454,0.02196804152969101,0.010047230937220158,0.022284525321599656 "
-"1905,0.06896615627499601,-0.05768220518197264,0.030093660213722017,0.05341796018439194,-0.15251129609783134,0.02320838810698983,-0.026373642388016157,0.1583979442008143,-0.046715768233940226,-0.07271354001357677 "
-"1904,0.0034035544954431375,-0.014883925564129279,-0.014828331981140351,-0.007459471410509445,0.002882770086375601,-0.004249028487984999,0.020085210686649875,0.04135680519310068,-0.01410907244901273,-0.039930093072194195 "
-"1907,-0.15779845094888179,-0.03647038799363651,-0.11128100559748777,0.1986645239954334,-0.23881855157622245,0.23914338620750536,0.08090126973083435,-0.1080497657397743,-0.029908470465890295,-0.09070495070031821 "
-"1906,0.01698627263670839,-0.05333265360199228,-0.008866924530576118,0.0873146318169103,-0.1400498913468642,-0.025560122149993304,-0.03257732326425361,0.061335849366734474,-0.03425308637362554,-0.028384946892270214 "
-"1909,0.008662794483581485,0.0031649567836395426,-0.006871623546542752,0.012654475737327277,0.018641758506106075,-0.0029853337428989374,-8.56946658536078E-4,-0.026258567850469452,0.0027618710108668204,-0.009462351539949633 "
-"1908,0.01450722676135431,0.0051934061852402635,-0.009612716787649961,0.00943062066259952,0.005645848686758751,-0.014291408969125223,-6.882028515803066E-4,0.0015631469005371699,0.01491805646611687,0.012407544839059289 "
-"1911,0.010551592264153158,0.004084251426263093,-2.922928953674225E-4,0.008486213813753812,0.08067201087413399,-8.915208971881043E-4,0.009567604297398918,-0.05411095644301107,0.006875953090167162,-0.0057212725464926735 "
-"1910,0.023456400174356906,0.0050527931592877886,0.003760859664752526,-0.012462558811002914,0.0710591369229734,-0.006455108463735108,3.3808069174003514E-4,-0.06448150184226836,-0.0020348393012755966,-0.013644941870241081 "
-"1896,0.004981975311202576,-0.0116214852879203,-0.01402247290348204,0.012286991912437395,-0.023949473477687926,0.0076257907891239,0.0037749623906380434,-0.0010902522564205613,1.4933545799934633E-4,-0.010594301764614721 "
-"1897,0.01228872965461992,-0.0015864041767279695,-0.019090268262021967,0.027374222532514803,-0.017702374157431908,0.0010124996739163225,-8.058056615692636E-4,-0.00475663523804926,0.013112191879039588,-0.0014049616820140654 "
-"1898,0.015379008773988722,-0.0015388169209504857,-0.006536295031134061,0.008549926870743421,0.035870305547823125,-0.03362605809090918,0.008467338560836715,0.01611265136212273,0.009402100012189517,-0.01973535952454308 "
-"1899,0.023736759292285026,-0.02617081144784427,0.019502405890085103,0.04828895612932437,-0.052942044751084764,-0.007198605736742685,-0.016847338760683315,0.07110767606364707,-0.011301955214299907,-0.03722787776528613 "
-"1900,0.015580826841350426,-0.012120951366421114,0.009497685069550966,0.02539974201504726,-0.04432053344539572,-0.012132457795013837,-0.013241860420217095,0.03182997136897589,-0.015041254488823146,-0.013412365548181275 "
-"1901,-0.004409918883978396,-0.010840893368422555,-0.01028163000416944,0.029692416499576893,-0.1104377897916819,0.003647859966871521,-0.011249747510953272,0.061752584639323566,0.019708092020767815,-0.02100258893175148 "
-"1902,0.015627121491843095,-0.008965352925942806,0.012293352530084178,0.04301658494962727,-0.03710665339325004,0.006921230602464111,-0.01055526521603626,0.009147462463074603,-0.0464567334912224,-0.028437708938420753 "
-"1903,0.007108613100088048,0.0031408738640527783,-0.019040884135689308,-0.023150274727200184,0.02191660364419543,-0.006070521480773629,0.0051219695190952,-0.004179446800056692,0.018937041456792418,0.003429296233940861 "
-"1888,-0.037325187868194706,0.021294521537399663,-0.019151761236812594,0.01054254545753812,0.038839207515188094,0.005124342385727745,-0.038285767446329076,-0.04264245224289049,0.028387715059328304,0.013621404730881507 "
-"1889,0.02248240391054084,0.002120631152159325,-0.016214464660059904,0.014650010403181597,0.024641561464517313,-1.5543625155230972E-4,-0.004507439164846455,-0.035592896623533384,0.013902931766609786,0.016695074918860246 "
-"1890,0.04406897623919145,-0.007761953299578896,-0.006373164711257336,0.028327287226802802,0.03603022075225549,0.00179990877297986,-0.010761698493064164,-0.054956796730072144,0.006494493397004079,-0.018441916603643103 "
-"1891,-2.9794905480072086E-4,0.010338750272314205,0.014487476922195847,-0.03495979462995455,0.052467015289171116,0.03719412468280737,0.0061009064311766436,-0.06932038256970037,5.925813174220679E-4,-0.02517495262892484 "
-"1892,0.017624845652763812,0.010473908946772267,-0.029500338480210584,-0.06496825154822797,0.0328306139650131,0.02358985265418682,-0.02984549099251001,-0.036653950341375634,0.026023298216276962,-0.08165960320818849 "
-"1893,-0.0044825887088603845,-0.00428782758375543,0.0020176499758234375,-0.012750246134378898,0.007277061388053433,0.016605328881395584,3.056680708162665E-5,-0.030724648055174025,0.016077725158918383,0.0024912066487111713 "
-"1894,0.05343053892307582,0.014978686207107478,-0.020676361032625157,0.013623203740094764,0.061195267205061764,0.0013587913731620996,-0.048321220499998825,-0.05165966634171736,0.04355291860777163,-0.04952263807771611 "
-"1895,0.034597904014776984,0.02963559646683574,-0.03647348717480191,0.03498422825123851,0.06261237201489116,-0.0030365978284401457,0.001732226424417204,0.018341915684569957,-0.015109002563452868,-0.10874850876445233 "
-"1883,0.03489011860773726,0.07387241906870019,-0.028599807765187887,0.09756420447208,-0.09787634139052552,-0.08353413403834652,0.04148383855138249,0.0054408428201991235,-0.056103672079968366,0.09538572641315851 "
-"1882,-0.02238001370993216,0.05892016928896022,-0.05632557282846709,0.027027187594716187,0.06142296873952772,-0.06793382371063603,0.10083446831243356,-0.0020056564613744597,-0.15210642747694753,0.09531932555507282 "
-"1881,0.011997892089535311,0.03810363938420325,-0.0032933909679227734,0.021862632671006757,-0.017320066400514984,-0.030053827288529424,-0.0053404362954437125,0.017258370699158733,0.0023179124483056123,0.04481864102966383 "
-"1880,-0.06613525040264245,-0.09425430817673665,-0.030529870796052405,-0.011536156146913737,0.06527638039730142,-0.028846473122977688,0.04222396908722682,0.007451731548169049,-0.20135751324931908,-0.0035444246923145043 "
-"1887,0.01672409224652743,-0.026470006134784434,0.016582512694373313,0.05509665496434969,-0.06348944013218677,-0.004483501072126058,-0.02824574508955995,0.027725451325302485,-0.0371337343443862,-0.02700542097975083 "
-"1886,0.021407801926050518,-0.002794292616713507,-0.0017180071118838688,-0.024163927418986788,0.004323967849241185,3.8869477424771485E-4,-0.003161986917920571,-0.021627629332342968,0.021837620411326423,-0.022785192613632047 "
-"1885,0.02014480149374437,-0.014856498940819059,0.005951213520068868,-0.02717410413515778,0.008845946279990137,0.02515216198532402,-0.015179957599692257,-0.0352632814216507,0.017182140291449547,-0.011843903447218187 "
-"1884,-0.011829136217605925,0.0018679006914654164,8.330320570356223E-4,0.0056372099454792554,0.015550084706126002,0.012688071863017179,0.010440500665268675,-0.01085373588174264,0.004875916706028793,-0.0036478722032838393 "
-"1875,-0.007904233369467481,0.05202714501691864,0.04645939030330036,0.08297086558141265,0.0034390639499776864,-0.15330483000820364,0.033856661848354,-0.0048163496634283706,-0.2471838114324432,0.0766913003639142 "
-"1874,-0.028875230724876397,0.04155992196934689,-0.04169785598513275,0.022979194830937886,0.11564651839376967,-0.05211958496097513,0.011848080220322672,-0.014425758346936613,-0.12808229373818036,0.05487571672984218 "
-"1873,-0.022453966533111182,0.03789587234705215,-0.0390182836628722,0.057225046809381536,0.04068429249621868,-0.02799946241525725,0.010785202307538813,0.017059612007554036,-0.07888393697486627,0.00359487521704338 "
-"1872,-0.00830164869592394,-0.008224137044814632,-0.025884280834094282,0.012444694137174368,0.10944256512343033,0.0063588694627869985,-0.03848598392167786,-0.02047354504144041,-0.07063589663294871,-0.05124308554505091 "
-"1879,-0.006774988799019775,-0.0070080229659726856,-0.03186639687956729,0.005838469521587692,0.0832932734792698,-0.004646793462689971,0.010126471265596942,-0.00361580546957128,-0.037413874996363165,-0.013852187507442555 "
-"1878,-0.014025462986000076,0.0033153845715386907,0.009609271250001451,0.01368270830098504,-0.0038947042906424144,-0.006255588511926038,0.02655208475892492,0.021017479691511975,-0.030496348375322124,-0.0024862780482209075 "
-"1877,-0.028332297123789527,0.029778624137313633,0.024158111053006394,-0.08067958305836949,-0.1709420849576582,0.03138394783612681,0.04819107903918558,0.06213657641550996,0.07226809683110043,0.107828895702839 "
-"1876,-0.013714877631838098,-0.02547377870974787,-4.8707194448860267E-4,-1.508480504836497E-4,-0.1335319083686333,0.026427202923162016,0.0024830456704784207,0.11569696934730324,-0.005443756390013079,0.05680994359298176 "
-"1866,0.005568240287042956,0.019660338989652804,-0.00958823107930458,0.0356689246526499,0.008715905047702217,-0.0030120372498032796,-0.0011722715398444234,0.015148912244890938,-0.0035664231151726236,0.01628167694836403 "
-"1867,-0.027230918141776993,0.04747272220867373,-0.031527698831400774,0.037054891209737754,0.0758203561712238,-0.040110926941130866,0.034468656300958765,0.009062431130697643,-0.11445893066513754,0.010914792360273864 "
-"1864,-0.09507971214455527,-0.04733721662951449,-0.04188994049771512,-0.10639104035012378,0.048629502647329924,-0.07141646623525871,-0.030949048980055145,-0.010651039970637011,-0.13828400051820483,-0.012509468189374205 "
-"1865,-0.05670407549090718,-0.025237112922311424,0.02065621920401351,-0.007521177765038109,-0.06428195040524183,-0.023524346604723106,0.037903465956657646,0.05848915399674204,-0.09101909319572148,-0.014031350267424027 "
-"1870,0.01398639471682965,-0.035440944149786505,0.038431440977616575,-0.011212297784092098,-0.177690542320398,0.021937779803799188,-0.0026826269108903233,0.14653478419642027,-0.004579300733766548,-0.018039373905584934 "
-"1871,0.018741173254671638,-0.002999101035865392,-0.016462756694937936,0.025685510378411044,0.08374672345331324,0.02199420459156576,0.0016573495664092878,-0.025952992370549564,-0.013960692286771914,-0.04429555006423641 "
-"1868,0.07159128616187257,0.06957750081014728,-0.1015441927001903,-0.011591946114927079,-0.10883758484689315,-0.061498635426875996,-0.01495701529580521,0.065128231056565,-0.049621936083522875,-0.02561541070347762 "
-"1869,0.02005385066725619,-0.012161073175329573,-0.006928409031192338,0.001374561175555926,0.0054344117665544155,-0.0015765611434268966,0.0077051240783789525,0.01624489235245641,-0.007187539420672414,0.009202015911761294 "
-"1858,0.005710445895327318,-0.01897395695001093,0.008644393926975552,0.02082418726817779,-0.03527198760627673,0.01069578252196177,0.010030715622826846,0.09428341930010607,-0.05058973006185639,0.026762367016951397 "
-"1859,-0.04898597111507217,0.002696496817922704,-0.003951762766820715,0.008383778035091034,-0.02956428504077374,0.024851602821848392,0.013982001065087447,0.09166105880151708,-0.07774411896573633,0.04454755311595097 "
-"1856,0.015085382691650245,-0.012249848806018088,-0.011729897652187704,-0.013258863942183237,0.017147878683631074,-0.018699275895527126,-0.007113359629385134,-0.006475620549033056,1.5412900979903775E-4,0.0015471308371920308 "
-"1857,0.001493219401872223,-0.012506844744425276,-0.01315462108268324,0.017289198166283208,0.04169995705922066,-0.02516643313025262,0.011080138699553998,0.020171563076635,-0.05035791659618756,0.017884952979029273 "
-"1862,-0.05676169284593169,-0.044823989111767513,0.04104480313289812,-0.05641895069108503,-0.05326116415864085,0.028464097725568006,0.02184657601823046,0.07410280906220376,-0.010935481710249991,-0.0032806205511750307 "
-"1863,0.016324542651588815,-0.033282343458653885,-0.005096957434151493,0.01466490803163315,0.05055019644677186,-0.020617643941071774,-0.022377841111844102,-0.025314461110211826,-0.013722351713882188,0.009868375672228414 "
-"1860,0.0013922669454400803,0.010019006128922028,0.014116619108862472,-0.001796527773622496,0.008944288822321563,-0.0025787234705292057,0.0040777632967078535,-0.019272791383167686,-0.0042055607430384265,0.001267846653227326 "
-"1861,0.002372076515277996,0.004653251483473583,0.002781332567582232,-0.006831789660154082,-0.007165801914710349,0.00759505683612931,0.014888876210976709,0.006222889003227179,0.00990139661456907,0.003971175118308553 "
-"1853,-0.014525916685891165,-0.011270873472872528,-0.011812790195278401,0.007868928932065544,0.0080927825172199,-0.01318652150441786,0.0068894790887903635,-0.003567652653061079,0.005959562645500912,0.003585754777292919 "
-"1852,0.0019531162994917558,0.009109636093911135,-0.0015970539616856176,0.01728088446568225,-0.00525151622344117,0.01595509585218339,-0.020830241891950322,0.005392329663333621,-0.02185616461104056,0.0015684532889037705 "
-"1855,0.013623494322944322,0.016642191098550217,-0.005611345644753389,-0.023051264928013727,0.012231788119471954,0.004186083216019302,5.711922987929163E-4,0.012782940027165313,-0.010393841598288626,-0.01840502453390338 "
-"1854,0.019645659037768156,-4.6482004904806125E-4,-0.008805872875252916,-0.0029717381456987857,-0.006141656078650975,-0.0011168918422162584,-0.013626307641033498,1.8436924196056157E-4,-1.269251670746218E-4,-4.7206118467646403E-4 "
-"1849,0.014273787085443137,-0.032286484708014145,-0.0036299694526918933,0.014232450074429706,0.05971188951678738,-0.0028014539638796954,-0.024896657929759806,-0.04281853728473372,0.01711244908184479,-0.022566179466219544 "
-"1848,-0.06764756715674847,-0.024959465409441786,0.04918575627047237,-0.0472409853229447,-0.04975583952442508,0.03550208962444641,0.029611843867125086,0.0735115878649345,-0.017849547217383046,0.009178004424798089 "
-"1851,-0.010845803487743924,-0.012026315260792876,0.0031642721045703885,0.0015379773274652796,-0.007977741477573554,-0.0017242477781112108,0.006402953617979139,0.026239665494650573,-0.016375312143839842,-0.014707251256247974 "
-"1850,-0.013182568690295925,-0.03388894821627996,0.017649632101801597,-0.041474745433204535,0.026695837689229906,-0.004233526180278758,-0.01375569703232026,0.024427483506647998,0.0024990331976446722,-0.053658714096109304 "
-"1845,-0.019268472971165736,-0.031202528537778593,0.0888077281611804,-0.08965741151453316,-0.15661394376763832,0.0381916380732038,-0.0011158694900904292,0.09148534513333702,0.044124166938979144,0.0014954740613432862 "
-"1844,-0.013134740202952024,-0.003773591944403709,0.03870300255538802,-0.0385323886120806,-0.10773310954112418,0.02061331626097747,0.05306467737619008,0.06526138907072422,0.018331153877071585,-0.001117930192861638 "
-"1847,0.0025469807445882217,-9.99704823658153E-4,-4.3024122689419434E-4,0.01274416336948781,0.007081744565417342,-0.007288644041769745,0.009200635675789064,-0.0037216233050374804,-0.014723873710553934,-0.001992836851415545 "
-"1846,0.05888169103221469,-0.08649975203045343,0.21232291905933895,-0.20430971320308466,-0.45891204003624325,0.021389362997891428,0.0014523148612529892,0.14365528378197695,0.13747179509585677,0.09647056436788336 "
-"1841,0.008161392901709384,-0.026073585400228576,0.034612959084482024,-0.03311808655781641,-0.07302849267801655,0.013141311936367086,-0.006952574784144534,0.011940677729085119,0.03330402930779,0.016404045999451194 "
-"1840,-0.0671387888705015,-0.005198572467322971,0.13753843755801395,-0.16606548517614142,-0.24924072311404943,0.07685113778664063,0.09774110393814966,0.14439520430857122,0.0464931009275719,-0.00354759553369512 "
-"1843,0.005646157235166318,-0.013105338808489875,0.024806075049661154,-0.02297645131703742,-0.06457815668764055,-0.004576048831573468,-0.0029212027767729887,0.022783279307312686,-0.007971174882503304,0.03953445361444526 "
-"1842,-0.019477728349757414,-0.014286927582649673,0.0529690273084138,-0.0699260281200144,-0.06841499311786882,0.036567519319590826,0.008152148355898963,0.024855160557159306,0.044535876438813425,-0.0021288709027732005 "
-"1836,-0.02788447466271624,0.009570156542315448,0.018630564586862703,-0.027095784546422755,-0.059252768697155386,0.01124763020525031,0.006225094255471941,0.014414088721258938,0.016229632909624838,-0.0126339507813518 "
-"1837,-0.028825244872577028,-0.005725470063657879,0.04288116662023624,-0.04614877188204709,-0.1015238152465206,0.028812071010798215,0.02364470127270529,0.064284533844927,0.018502268007577365,-0.018331817689617582 "
-"1838,-0.036465224128526444,0.005437787968117365,0.04607921298851119,-0.07646186603896508,-0.09221260517183827,0.0544016290190407,0.028324109880246234,0.0818446219722929,-0.010315900962788987,-0.02445758652954169 "
-"1839,-0.04655266216139524,-0.011229689083735018,0.05620346989380938,-0.09657843734964032,-0.129691099186953,0.03998736803771318,0.03287109726474492,0.060556244669396866,0.03793434783154185,0.00852656286464352 "
-"1832,-0.013649601426616573,0.008038482923105498,0.03608688963811409,-0.0232009633913417,-0.03817847586764231,0.00663610511369342,0.01441617859958073,0.017876871119126243,0.009906606945241042,-0.013924204376378388 "
-"1833,-0.02245157040320717,-0.03383907651404065,0.07045839831891189,-0.052442224773927335,-0.12864631023484616,0.037507189375269395,0.002651667246864397,0.09586846993559733,0.016788248270988456,-0.0371044079031778 "
-"1834,-0.08682309524406444,-0.024341547628614152,0.1634987678124606,-0.19308720335877091,-0.22191597043792066,0.0848250734148258,0.03922694019235561,0.09261386144593373,0.09386772474095859,-0.006569923680973095 "
-"1835,0.014750705229219447,0.0029567010145250196,0.007699608866733431,0.009021812645693728,-0.022245302718745828,-0.003926460721531081,0.0018301910593690126,0.004493157423413133,-0.02338082027814204,-0.010789266805725738 "
-"1828,0.018190733150476694,-0.013883414052379979,0.01079623296348731,-0.025164273908833645,0.01502293315974443,0.004320990178761483,-0.012117019839765477,-0.0468294224732203,0.01188651963943007,-0.01039245517170641 "
-"1829,0.009825045545143138,0.02593843052801544,-0.05045690959360384,0.04457733536806685,0.03015964473210457,-0.020639544561212322,-0.018066537320545518,-0.029226662351343954,-0.01351018088827283,0.046146136127437856 "
-"1830,-0.016966596964559214,0.07751760808409364,-0.06381132883117102,0.057020204120539715,0.11928509234732389,-0.004805555633982426,-0.009188661666529534,-0.05531319903504447,-0.05261230840511188,0.04043985685836745 "
-"1831,-0.060181113128635576,0.11258064579994441,-0.06501651271410458,0.08844325024324479,0.06789755967334471,-0.03951934286915474,0.037720140123564366,-0.049028718559455606,-0.03380873173771515,0.21162756510153402 "
-"1826,-0.0012905109952459962,-4.819405693754143E-4,-0.0036947437422971178,-0.01914496803575523,-0.010746056617814581,0.005891753117988045,-0.015017909331876408,-0.005708914575191238,0.007167865734561938,0.011016499027534193 "
-"1827,-7.029103333361504E-4,-0.012271384774632119,0.009263075847121363,-0.010874653850323207,0.0013991029426047702,-2.347529897282403E-5,-0.0071608488974840056,-0.009418608868125478,7.71422813404625E-4,-0.0031513825503823078 "
-"1822,-0.03547910663326122,0.1288850535140231,-0.02679758483833088,0.03617776286207863,-0.08692232657661599,-0.05618482587918692,0.1336920807269726,0.052541914335607696,0.08311930668600648,0.20789788965964798 "
-"1821,0.007466770244430136,0.006138070640795818,-0.007793508546902062,-0.005642363686596424,-0.03337545946248479,-0.0034043043573813636,0.004471635490903306,-1.1871300250190987E-4,0.013963215279500748,0.023212955189864264 "
-"1820,-0.006502325188593056,0.004722402229301229,-0.01921115914533991,0.02124790449101753,0.00676199923494828,-0.03368509902699514,0.023244251380587867,0.01883550192664633,-0.020106674422560207,0.029820223888860686 "
-"1819,0.021268423531402316,-0.002175191598780661,-0.020669039593020078,0.006924405820402491,0.021980875147437764,-0.024052584984693613,2.735890383529805E-4,0.022410397263725474,-0.018084612641303136,0.004409733691730604 "
-"1818,-0.019905345623155837,0.025616171730348095,9.199219881307723E-4,-0.006094176982056543,-0.006238044908609189,0.009671299671106151,0.006355903886510805,0.009743122787564864,-0.004907065368956824,0.003340728440458778 "
-"1817,-0.011792347239972,0.0029436573181976793,0.02398313304799121,-0.008539512559424998,-0.032589231942006344,0.014508048026466871,0.019680043823754885,0.030632048386423093,-0.006564929013931243,6.752426102662368E-4 "
-"1816,0.04836151060882624,0.07487293059027357,-0.1059352862816318,0.08305766339397073,0.13877303343260688,-0.038097978197270066,-0.04117815352575858,-0.08354541166491408,-0.007078157820559671,0.022575154555637102 "
-"1815,0.04669845513079778,0.05012670572146292,-0.056996644270131756,0.04031450045201776,0.13579434402130097,-0.01683415819151128,-0.03123517324265727,-0.12194179795140307,4.088977086279795E-4,0.01467625801377832 "
-"1814,0.01267081019527276,0.0015499173497215168,-0.07891649478496886,0.07063488848816712,0.07040437024746707,-0.01894953720763358,-0.00475173622170576,-0.019507719143449263,-0.06496538633926029,0.012626910667043766 "
-"1813,0.053478728799910544,0.002588489349294179,-0.02795548072246018,0.038558794573317075,0.0845957358019072,0.00393970644794706,-0.020491082679059344,-0.059930311573174674,0.044589555803810015,-0.01699348697411113 "
-"1812,0.05044617697389276,-0.009785488884618852,-0.025144146983417794,0.0407556605012449,0.05066661454718612,-0.018212930804914318,-0.019550362908717,-0.050975883596246045,0.044431254027182836,-0.003832077703161655 "
-"1811,-0.004610730187362556,0.008857589191210883,0.00139692458936302,-0.002067085375311779,-0.008338087256629155,-0.01583552099293064,0.005709628606842095,0.010278022320248017,-9.207355737311731E-4,0.00462947290113528 "
-"1810,-0.012667435521312945,-0.004155524400503646,-0.04002783238966908,0.018211084947698127,-0.016195171842447915,0.005590628186863652,0.01850006456691224,0.07205277277623724,0.03323975475045593,0.009234226134060658 "
-"1809,-0.015588819469217296,0.005347116552454826,0.013154016712417387,-0.002532788660599083,-0.05039223754655586,0.015525089756666584,-1.9992441863417518E-4,0.023895115863683116,0.021903575819102687,0.0078726997499227 "
-"1808,0.045675090449910284,0.05725683189790398,-0.06156457499655555,0.06818376298830207,0.12968914732398895,-0.06298136168724094,-0.02413358092738162,-0.06688165845167453,-0.053767744350023315,0.03412404665978565 "
-"1806,0.005358032380118874,0.01276120586101603,-0.03985592760488654,0.03640323103056126,0.0697098571826972,-0.027221225610061076,-0.004583687023451627,-0.03249501802306854,-0.0299792246823751,0.011386258684845935 "
-"1807,0.04071386275976684,0.0396962845541043,-0.06294432829970588,0.04776525380384626,0.14310776091038085,-0.03127252524604341,-0.032600401192348784,-0.11524753681307078,-0.04620622681919241,0.0021752341815911317 "
-"1804,0.043792736664921325,-0.007169365251779331,-0.030709779289096975,0.028959593878720723,0.04820120570443678,0.007008190770067525,-0.008758270531706152,-0.028851699212297566,0.035005222201954796,-0.004514151318724732 "
-"1805,0.03195126883474231,-0.007695929016113682,-0.019731068408633593,0.007997807260090944,0.05341571667504212,-0.010480698351904983,-0.004150716615208646,-0.04281441472425067,0.01924277460273761,-0.018625857015663383 "
-"1802,0.007884331142383363,-0.012852398814285773,0.011780493537952859,0.01756382106365634,-0.025498746586149566,0.006397661804008302,0.0015061355922316292,0.022129146284267105,0.008834733729385652,0.00786200338191638 "
-"1803,-0.002187030604898786,-0.0037348670479031964,-0.017764123691566863,0.005304902086259192,0.014986336644229744,-0.019631258767815008,-0.004152443477776283,9.600376254111935E-4,-0.02289954690228682,0.0033267317748690017 "
-"1800,0.026874598961110066,0.003504671388575751,-0.04792687615538065,0.0774058184415238,0.09015945222778271,-0.019334020658455568,-0.013128244213899304,-0.0387711507761863,-0.037474168801872654,-0.007867331172748853 "
-"1801,0.0031476271309693864,0.009809878965900583,-0.0065850132800932696,0.025764601281881214,-0.0053368604894627174,0.010673068491005456,-0.013630575445786374,-0.011767741753186716,0.004469802927520142,-0.011940723352988963 "
-"1798,0.038772848536258085,0.0011127391247677885,-0.04448887079754326,0.04754370439438906,0.07098900603290155,-0.01266614843367275,-0.03613041780380606,-0.04513805046195002,-0.018849197120896985,-0.00576446187372381 "
-"1799,0.013334298161766756,0.01697183573913224,-0.023367326955462286,0.05772610704264541,0.1137690296285788,-0.006474824058511909,-0.007844627500850533,-0.11244175103405202,-0.02654960872604619,-0.0022875499218147875 "
-"1796,0.04608634042977863,-0.031311000201605425,-0.02416134394703185,0.023796468967229607,0.030942667922405565,-0.00479759461041291,-0.009719527250711096,-0.027518017149603016,0.036937464196679,-0.0052418429302073695 "
-"1797,0.005768961124299118,-0.03718955545908585,0.010452135633654602,0.028029985237632688,0.04747386822929508,-0.008963516942843426,-0.011967233363958496,-0.008146274769219072,-0.018928081579451878,-0.01553125445765509 "
-"1794,0.009042317383929193,0.018861274926467175,-0.020480770141253293,0.01653389173749272,0.02150047920450213,-0.02038189302406493,0.0015561482607079808,0.012761695947131543,-0.004255366588863827,-0.02626942011312763 "
-"1795,-0.001439361532903088,-0.006624172165609526,-0.027238449821160818,0.015483931800781196,0.06572041814252394,-0.03008782926036948,-0.019487723904864505,-0.03798871675716897,-0.01806020502088128,-0.022932773257675 "
-"1792,0.00345505853414852,0.015208268908870264,-0.0055465703634595374,0.016679673411717017,0.006721036231580927,-0.0037661801926522445,-0.0012650533386139578,0.005340678328505184,0.004751172548675789,-0.0010777278337209051 "
-"1793,-0.015216679191387158,0.010017324844825752,-0.0040983330355726585,0.02127249962263997,0.02399578994946371,-0.00956275757777141,0.0026810996296327064,0.025850327194916353,-0.02250929418766812,0.011741212947646757 "
-"2032,0.01170696832222464,0.013409124291005861,-0.017825088486666446,0.03919388672554888,0.052186700096171316,-0.013767511151210929,-0.0012729173085894636,-0.028509402996492243,-7.633517077425632E-4,0.004802365861795898 "
-"2033,0.02806544688480142,-0.011986849494157686,-0.04278323044846009,0.028683049547052315,0.07435839596702551,-0.02398212679519654,-0.021790754457787394,-0.045577148982490795,0.0070579912659440944,-0.007132159014325818 "
-"2034,0.020483797833635933,0.01225009782087495,-0.03862218182983345,0.03631422250638445,0.14801206863158337,-0.007513295227843948,-0.048654596835361316,-0.12201507591555186,-0.011480606140611381,0.05384728624913416 "
-"2035,0.04051745595402167,6.751701812105467E-4,-0.09129701377105107,0.007450410516771124,0.1422498488561357,-0.0418315210437701,-0.11715415421951016,-0.11127133648824,-0.026696195138818966,0.037905099930643636 "
-"2036,0.03915566456769385,-0.00443661591282166,0.00588471984287791,0.011292768788845498,-0.0597146097462835,0.003630353669802837,0.004473165303362797,0.04963632980527517,-0.0036318538924032468,8.664819196475721E-4 "
-"2037,-0.021507319541381763,-0.009382895549239288,0.05275063374872117,-0.041891821358689185,-0.009218220557806278,0.0696504090905074,-0.023225215450787203,-0.012511501926681587,-0.0860182379640079,-0.009448457105521876 "
-"2038,0.03954462361792417,-0.02257467324429648,0.0012311239983959887,0.036587012976981526,0.07225888877274675,-0.034767660093410126,-0.015213645100137996,-0.037811932306381114,0.012293061405989264,-0.019779240094113523 "
-"2039,0.05822884516323038,-0.02066332054078167,-0.025500800207345322,0.03216426660165922,0.10240201945815501,-0.01192872520954401,-0.04960671989573882,0.00356433023455404,0.0068328692071347105,-0.07729545217240348 "
-"2040,0.005571807038479356,0.031007709454830956,0.002761969429415659,-0.03950939731497561,0.07944967010592077,-0.024928286069954786,-0.008260817221711363,-0.08538591412433186,-0.10623300545499324,0.04088809903171683 "
-"2041,0.09371620371579695,0.05432024576228673,-0.07263405886127067,0.008962973175401998,-0.03408316184270416,-0.056645217823215056,-0.04816233534667229,-0.060481948247858526,-0.12855406808707737,0.0205281459054081 "
-"2042,-0.003106392891108583,0.009376336119322495,0.016037055244406455,0.002683863986283782,-0.01927621700333144,0.00965655194694927,-0.0014556061209333425,0.009901197301845471,-0.006597044536571635,-0.02064197164090092 "
-"2043,0.010956713117357707,-0.007635302700172256,-0.011904101425300202,-0.0024404279662236725,0.05547938408426035,-0.011514703818721442,-0.0037409844197481504,-0.0473313080060784,0.018411524960607308,0.020125715142085967 "
-"2044,0.014962137457701155,-0.0065035028354778635,0.016922072968689146,0.0014062334794604676,0.004896968288004004,0.007840816730897163,0.009083191609844655,-0.028443532146300077,-0.01860551566432723,0.01633041069917622 "
-"2045,-0.04320040208085037,0.04443623299846091,-2.532662787322656E-4,-0.036262648445621,0.0931296572059255,0.0030108020445948993,-0.003744059060681642,-0.08628693003863756,0.0253928685298313,0.004325553986705289 "
-"2046,0.017831292579355774,-1.3299078613873564E-4,0.01622214409059294,6.780241888791111E-4,0.00592483657380261,0.004997906299149509,-0.006054789761602028,0.00282635559521958,0.01147433394032276,-7.669574453452321E-4 "
-"2047,0.013259076908312958,-0.015366595997685664,0.019297936404932638,-0.007633265861685511,0.0026968085916728155,0.009463901635652095,0.0015185267968055595,0.0028946720136803087,0.01718598561200494,-0.0036711146807560735 "
-"2017,0.005186932364882055,7.056127550654744E-4,0.016715660739469233,0.01579739667446836,0.08456602140076938,-0.029514546814913424,-0.03032164440823617,-0.01769303676923037,-0.0064041554204288306,0.007699231907689655 "
-"2016,-0.012198500718638386,-0.023091687721690277,0.0018602262363178244,0.01567684435490176,0.06655389882977555,-0.022937136575377885,-0.007247942252527832,-0.025772498644816646,-0.00134543142936667,-0.02679170223001344 "
-"2019,0.003879738064968296,0.03523243115821892,-0.020306288692872477,0.00464875315577607,0.14027746234457633,-0.017977020075248446,-0.035371770560920036,-0.027984837954403433,0.002137842535811495,-0.02400818559726465 "
-"2018,1.0335129955365753E-4,-0.0075899141292167,0.01185842621811656,0.00927186159273174,0.025406528534631788,-0.008360443257914624,-0.022499827190573213,0.011829639957035155,-0.019970850746950188,-0.006429436616271854 "
-"2021,0.005344302135165817,0.008772859326646853,-0.03571544407320336,0.027057460385382186,0.03360778889611429,-0.010971149278182336,-0.0072348065430504534,-0.017919240975513694,7.558303189374257E-5,-0.0041736817195919375 "
-"2020,0.013268029927335721,-0.015978149767253362,0.012733158924157634,-0.013331954030767881,-0.015424729260994023,0.010480566006331925,-0.0018211103864272749,0.01169187899676258,-0.016851270077163374,-0.0058209070834127855 "
-"2023,0.031074651450493027,-0.029739382413085522,-0.02361431761892202,0.03250734578367639,0.0575671756427877,0.001196643305548152,-0.0011730029806308376,-0.04107249565909207,0.009009797415396231,-0.009612159257799133 "
-"2022,0.020720225440412045,6.290154110755174E-4,-0.029084092540132972,0.0290658791042414,0.046241863675175104,-0.018715026781529615,-0.010466400357443702,-0.029535098864015903,-0.017031772737782464,-0.00630120388701002 "
-"2025,-0.007688907510745728,-0.013037713070453035,0.028788265029716677,-0.017900600074874873,-0.04654835951590183,-0.0017084528213591685,0.013364943620118447,0.04039144468564411,-0.015929827303325105,-0.012018532359777357 "
-"2024,0.03509321138316726,-0.015257777008850096,0.011337479559259397,0.021443827064531375,0.007891040408870743,0.003180961013790843,-0.00717557823929103,-0.02854049177448363,0.0025012032755725383,-0.02018803086467666 "
-"2027,0.015379666897159364,0.010041228198834936,-0.01233563322626516,0.019723678078245054,0.03843963712648617,-0.030776079835270382,8.912841896505019E-4,-0.005388587215096819,-0.012521676249055392,-0.004321469129421202 "
-"2026,-0.0014916964785727882,-0.020305812601875466,0.041424418035377386,-0.052172164850276204,-0.08361224418688507,0.021878755829692204,0.02628730041464381,0.039244042319678145,-0.009614526493975454,-0.049633080233956565 "
-"2029,0.043803227817644876,-0.01860185225409516,0.016175456572110905,0.022251211512743237,0.02616450401355142,-0.004134792564927477,-0.011208694422904326,-3.737711338399138E-4,-0.023374617945550593,-0.035769660080511655 "
-"2028,0.035067147900228655,-0.030029348555856032,-0.025944018353532612,0.04174332457411347,0.08714641746695109,-0.02048073808329651,-0.01840313210827627,-0.02633214436893186,-0.003010824704183496,0.010404673868032618 "
-"2031,-0.03975260173837363,0.02178431425607697,-0.0664684080643233,0.04468593739641291,0.09829942190255245,-0.046535998426363454,-0.02749967140865239,0.0013991091170076513,-0.1688222988810575,0.018391344593510016 "
-"2030,0.0810075501823508,-0.03218552457987686,0.0027860179932059116,0.04368622069178867,0.010161575707588603,-0.03772233549709148,-0.10258627272822048,0.012615520544080147,-0.15594087484835767,0.009195200754784479 "
-"2002,0.009477896856592262,0.0014238456245577848,-0.022260033101150344,-0.016928366039548573,-0.010871251146235715,0.010656473131153489,-0.019903000909007075,0.03070837878650687,0.01955888546635818,-0.016722757106192997 "
-"2003,0.018077627377710254,0.01799178075398624,0.0055778337527122275,-0.009490464436747939,0.031039221178181715,-0.032672918106522814,0.02730045453129586,-0.027074202548294426,0.029714148948380863,0.008088019334130826 "
-"2000,-0.0037045597506780935,-0.03865834035784312,0.09438144243423659,-0.07855475726223553,-0.12504122239835389,0.016313358058102547,0.018916619328711377,0.07949705854863542,0.00987987230804146,-0.029720940378910123 "
-"2001,-0.009761897250471838,-0.04789775251632367,0.09526426124015311,-0.06628479845454392,-0.19152485736401956,0.012170354328594358,-0.028731772157358327,0.06310063665980732,0.030797604456333106,0.04358978010774665 "
-"2006,0.07465802418806776,-0.03489954256162325,-0.03443043537949067,0.08563000127540316,0.018955632878007275,-0.048151212416058464,-0.04341914512674587,0.015070238224564879,-0.03624651936127652,4.166813692363302E-5 "
-"2007,0.13203007919298504,-0.03552660355446119,-0.019909409486877513,0.07128439842356177,-0.15063329927746455,-0.165861249922331,-0.0985907178433569,0.14103738538219796,-0.16849425252799843,0.0043978883038373285 "
-"2004,2.355131257878598E-4,-0.0018628515633069477,-0.00196001809608719,0.020457698150566046,0.015652862492239395,-0.00583865937964757,-0.020985308268009747,-0.004091005576598848,0.007270349372186742,-0.009001650750021581 "
-"2005,0.02566370441882727,-0.0056838669678915986,-0.008784299794793964,0.04136146510082816,0.03286890502827023,-0.02693148795342735,-0.013446241211502601,0.0025176870752769633,-0.024385039023097722,-0.016903035109581747 "
-"2010,-0.02529891022901685,0.027886157034731764,0.01287798215163642,0.008450479240963194,0.08939908291662702,0.0025845074074571373,-0.011276915044296495,-0.02474707527968991,-0.013632663283336876,0.012730060669671507 "
-"2011,0.0037021381878395926,-0.012319983203225346,-0.034587837921125394,0.021654846696151486,0.06873627343635538,-0.0013153249924229037,-0.015484973686052188,-0.017625469792986247,-0.026420285091193558,0.0014193345469956276 "
-"2008,-0.008282663539695681,0.020314707717872638,-0.016638470728379498,0.004444100681403919,0.034441045565241184,-0.00785061417974935,-0.026741204795939524,-0.025879737875557453,-0.021697809785309358,0.009576772842595449 "
-"2009,-0.10627467926745007,0.03681235054991107,-0.07707817035526256,0.17457447908540027,0.021353292272754437,0.03239677582297408,0.08803637515476095,-0.08873592679198018,0.02071938176059162,-0.05024783751388474 "
-"2014,0.02970604510544439,0.013684766496290114,-0.014164860496455756,0.03941979819747547,0.08745318959567115,-0.017420056310463585,-0.009231059662272056,-0.05119757232562197,0.019748397322306963,0.019012286415237428 "
-"2015,-0.007568570198933766,0.009827570948830636,0.013402471928872395,0.006688440075463444,0.07206534833815043,-0.02639239734801677,0.0013431373781401651,-0.02462078302105753,0.021352918947811748,-0.005873968385530947 "
-"2012,0.01170813590665016,0.0015121207132359716,-0.01101935342290261,0.022469722082710076,0.04091042257108341,-0.017428723746527767,-0.00179650444549421,-0.03209407477312265,-0.004100628675670726,-0.009855286694873167 "
-"2013,0.007072106452402959,0.0027976531654790894,0.009514269668733574,0.004020273091960143,0.05610771479272934,0.021328233403136013,-0.0026755533260219935,-0.05120737639604132,0.008094413537971981,-0.003060470031747138 "
-"1987,0.02100408482832857,-0.006718881544771455,0.02234641392529586,-0.08195604889731194,-0.02271214407485181,0.005117936372357483,0.04448118137250724,0.030842381865599365,0.03332893310093538,0.002858253357734975 "
-"1986,7.576510392000519E-4,-0.03153320824147791,0.009977364921980536,0.0033687081881155078,0.005660522497804721,0.005238575428418186,-0.026473877717958793,0.012223890357382075,-0.027165924988949892,-0.023396193994202664 "
-"1985,0.007028922123414018,-0.016443546033143797,0.010836038549889869,0.008962730757879145,0.02887769638642338,-8.37989032005471E-4,-0.010665782355679434,0.008600352580524578,7.96297534622309E-4,-0.00192505811395068 "
-"1984,0.0042296297408831555,2.666606697751386E-4,0.02700988778153713,-0.05094812210134295,-0.032450490919818,0.007227992628765653,0.024013974191878406,0.04879078371547383,0.020504487803059208,-0.014071511643301901 "
-"1991,-0.02562028754408535,0.012151408827380205,-0.005022747966424021,-0.02723185199576131,0.06745143378726512,-0.01100580153078291,0.009937857887460792,-0.04839158040821443,0.03217551396211182,0.031106154599055066 "
-"1990,0.011281534644538807,-0.017705062123968145,-0.008961160301528161,-0.016776244268474717,0.020517517017817427,0.006196057317741979,0.008837563278976215,0.016140271755870485,0.03329833873874215,-0.014107702791130472 "
-"1989,-0.0016713689141123415,-6.655233634115599E-4,0.02337321940117965,0.001275252834872783,-0.020259631017823885,0.012685089474648555,0.003523337754313268,-7.567260534828448E-4,0.009444840019892438,0.0023775166608573516 "
-"1988,0.12862571423211364,-0.046256925387585746,0.03598220271025007,-0.11632777021060617,0.028423828378308508,-0.09957302877256878,0.1149324323961378,0.15965688611231685,0.030914300606192293,0.04732861252747647 "
-"1995,-0.018215689475642154,-0.002104589303096869,-0.02122431697368723,0.015578791096061221,-0.058918137043650454,0.0058219269987877026,-0.03343735183174925,-0.02364213721047141,0.0011308869701232586,0.020400545448662002 "
-"1994,0.046712842297433874,-0.007738105302854054,-0.01890242400450895,-0.01251023409966308,-0.050816829913869335,-0.032666129054313715,0.04274655577331985,0.10491624039582026,0.0383177467925561,-0.0177926796390087 "
-"1993,0.003069340438429642,0.022579091477425296,-0.009716133805837976,-0.05785793388207741,0.02878732732144632,-0.0047193745306318225,0.032399740170294615,0.04041667428124839,0.036046643437003534,-0.012788114716009349 "
-"1992,-0.0010257195324953185,0.0193070963334318,-0.0059356376909651155,-0.04253439454109959,0.08748877802843529,-0.006065303140381853,0.030325898618811686,-0.05440229064910483,0.024286926250449488,0.03981729736163115 "
-"1999,0.006355106159510451,0.005939127637129048,-0.0010932415215827009,-0.004589159378415013,0.031908885972074544,-0.006177910500622481,-0.006373254370519936,-0.021061875237757304,0.01112789333465639,0.011812039597336442 "
-"1998,-0.015182712016355713,0.005285918054837325,0.0013351522157774378,0.01089459842916415,0.023609043494288672,-0.008255591119434046,0.017136780209866854,-0.02042034626562625,0.001579743116590503,-0.013205609819020482 "
-"1997,0.11609965933711577,-0.08698390389901844,-0.0560683021941947,0.13053504947292874,-0.14727791811078003,-0.14338461692336063,0.10264712721992798,0.07610711157407313,0.05661965557612394,0.07251429832422229 "
-"1996,-8.45416409658513E-4,-0.019538626247749182,-0.038472971478633204,0.0031762183730444284,0.01808830499623063,-0.025319503239591153,0.017747131210688133,0.040271724168649686,0.025444079987997855,-0.05455128375101337 "
-"1972,0.02361700208269527,-0.004081126174857151,0.0011422499528639144,0.011124481475806205,0.041871216376663536,-0.0032814860577267775,-0.007208390472968783,-0.039296052854589356,-0.008108116294322803,-0.024188023730128738 "
-"1973,0.039534480697049616,-0.060657263409655035,0.05748004114866785,-0.026166214867442802,-0.00861413900570738,0.017796765552404583,0.018212214019588,0.009449971205882049,-0.01171718523797754,-0.034788286083695746 "
-"1974,-0.012106667960080775,0.008601473128192936,0.009630930906487872,-0.015643059778724794,-0.003530418500608266,0.012293853711978706,0.027791973579765327,0.011252500044631129,-0.006082445742493794,-0.026466375121041056 "
-"1975,0.004973641923995686,-0.006361273299048989,-0.011277587023045358,0.009140167050562663,0.01742507457139264,-0.0262278662793634,-0.024904415557430455,-0.0049367561548432975,-9.731103447779181E-4,0.011622597502924962 "
-"1968,-0.004135080335125549,0.0024138874427330134,0.015089589511244806,-0.0030412722640467977,-0.005376752760342028,0.01844319310981006,-0.0010889786420041703,0.010162033525387368,0.0026524777032716873,-0.005287503692450534 "
-"1969,-0.004954605220361547,-0.0210491413362851,0.02060973642286053,-1.9916214577123668E-4,-0.030202013588392203,0.013931348362329357,0.01878038652421018,0.014340422091744479,-0.02810108155666564,-0.018215284626305662 "
-"1970,0.0030120396236851163,-0.0029159405495063273,-0.023809122771980423,0.01768270461812259,0.04534085461851701,-0.010415952421544352,-0.008518266562413668,-0.013866139294926217,-0.003582208102701355,0.012425839160853637 "
-"1971,0.01695821075929556,0.0076659767974580715,-0.006975054549573514,0.028392698580187437,0.03262406663296277,-0.02731515129486595,-0.008792045876266964,-0.03838830942251978,-0.0029956496763174356,0.01556146261786038 "
-"1980,2.690317511354161E-5,-0.015402887627657222,0.008351385487519417,-0.0065722463221269825,0.01695948011519164,-0.01630764119124968,-0.010593626071828758,-0.021386824439350815,-0.018552119972678152,0.005302724936300302 "
-"1981,0.002760936010399818,0.005585731318003578,-0.030021925224763116,0.007518081241787709,0.052507459730911574,-0.027022273794788654,-0.021380657000896034,-0.054821703766625436,0.00541214048507007,0.02107377663060061 "
-"1982,0.04723702081390991,-0.012147666170883465,-0.023776070760864437,-0.01190069931546985,0.04404330242793114,-0.05415441097491194,0.026268346825079326,0.017475282980072858,0.04831694563078818,-0.01249544951529552 "
-"1983,-0.009516490964473939,-1.800786789004873E-4,0.022875643244684125,-0.014598561572239883,-0.030933761123882585,0.0017775412620795864,0.01633559048663159,0.0208499823195231,0.004894503493622408,0.008058310550027705 "
-"1976,0.050184422527594585,-0.04188835936167528,0.04141890694310477,-6.747774869500273E-4,0.00571510292046436,0.00790437201167565,-0.03363540368968065,-0.001464326845892253,-0.08730552773771615,-0.0027744864385876454 "
-"1977,0.012491907961257334,-0.0022772354011028144,-0.005246046320867922,-0.001693222809104707,-0.012337608033891764,0.005050493729902257,-0.0019497703119608484,0.030991522089806198,0.006369770426139873,2.861594537056533E-5 "
-"1978,-0.010765707769086903,0.011134481556498346,-0.002346484141790453,0.010643708017161864,0.008723416267974625,-0.006023295128797275,-0.006480733746193225,0.021335262698078693,-0.008898453711022403,0.008704027665587734 "
-"1979,0.008556293018015061,-0.008883122328307683,-0.020045091496421412,0.006136837783114052,0.036472413425289,-0.014723327736050233,-0.0030535846153034313,-0.011339935591814279,0.01114723606357867,0.027182198360543763 "
-"1957,0.009324551814569945,-0.014678134466191314,-0.030958057975256546,0.045423485324759025,0.03631041578456688,-0.001822681105132236,0.01078893991648608,0.015916878275460955,-0.02931026642420444,-0.034890856268915985 "
-"1956,0.014297150519117252,-0.00963126263655162,-0.02556207637166996,0.02565446235922708,0.03186153937590445,-0.0017933846344855397,0.009698816297762326,0.004369486759225956,0.003736038002271094,-0.021504966301406494 "
-"1959,0.01663545840577068,0.025415107983945376,-0.058466042974934594,0.046486036634745084,0.05940444395112718,-0.038948038811474614,-0.01913210542558135,0.07305798061717615,-0.043485145261025114,-0.03680083500699763 "
-"1958,0.011470154218177092,0.026807005835922347,-0.050759240987693015,0.026655818606255464,0.06689285808020294,-0.031219191513035326,-1.2393481262559444E-4,0.02119287902309382,0.00995636779427462,-0.01727870689376319 "
-"1953,0.006100583452223566,-0.01072651607733812,0.020386669552908045,0.02081543285556571,0.002917443810111755,0.016042595478763216,-0.005358500116647748,0.014669682805910465,-0.03202705514195125,-0.04307180392928457 "
-"1952,0.0037876527149240244,0.014952197213882454,-0.007857646545482162,0.023097542878360133,0.039713687931007456,-0.005165534964188969,0.014680273346273818,-0.009578054301273304,-0.02254711102841318,-0.007748106985958817 "
-"1955,-0.015771839345177934,-0.005169230240728753,0.01510951073761424,-0.06812862986795186,-0.03223923177478206,0.024357888686116724,0.0276308694518213,0.05736568160389743,0.06678893813400488,-0.018549492348155353 "
-"1954,-0.0219552844346757,-0.011141244709694532,-0.0201808377380287,-0.0014740369755763662,-0.011903434451252156,-0.01984147830045078,0.04526784714918352,0.043632877471113274,0.024633433244835707,-0.04444369061301263 "
-"1965,0.027842366374054902,-0.008452806986816195,0.01548706331903875,0.04881400482347889,-0.05993889537328417,-0.0025044212433036708,-0.015590222019576805,0.028016471720934646,-0.05324734936819617,0.003673469876937275 "
-"1964,0.013055051916048699,0.009094909766656055,-0.0083993260025553,0.029695431387706795,0.011773030708105243,-0.00818886580303842,-0.023742259807337733,-0.007881665124961816,-0.019237958636678102,0.005454813034051026 "
-"1967,-0.03609996598532243,0.01318846880043785,-0.023829577400773978,0.091171132375838,-0.15882416007249037,-0.05823997484805806,0.0447333558521826,-0.01984633641156258,-0.14420982702454263,0.11954892129953074 "
-"1966,0.017928823619213226,0.006620882406953765,-0.011147701097508268,-0.01875270463217827,0.015954061152537887,-0.00938422619839412,0.010183162038171108,0.0017040569574482093,-0.0207448411809026,-0.020376216834583915 "
-"1961,0.014335664192689586,-0.021680984449420144,0.013855110008220699,0.008872439726411266,-0.015065095159935931,0.0011846196114965334,-0.006098742655996866,0.02163921834443445,-0.025063818212494777,-0.010933180541504226 "
-"1960,-0.01973839344082034,-0.0247269465847832,-0.009302281710806107,-0.004514018684240761,-9.75132707022354E-4,-0.009642010838821194,7.675209679711996E-4,-0.004467748458106224,-0.017490056410611916,-0.005290388934840604 "
-"1963,-0.08688802974323763,-0.009686537559538692,0.009517800218072685,-0.01767737323615942,-0.05995125430501269,-1.60152415303648E-4,-0.09919273726793847,-0.035017843927845876,0.055726308406360704,0.015142041833911163 "
-"1962,0.0059791227754558505,-0.0533262326710801,0.03598004930212695,0.020367357250106268,-0.08151154245882902,0.02988030386882419,-0.022344213599138192,0.03402558828721089,-0.0386463366259731,-0.013111302539925707 "
-"1942,0.032857414571014314,-0.03296665357900031,0.0278944372119477,0.016702047332620727,-0.09165700686256627,-0.0036173521515570537,-0.02964247930329852,0.01382254179622448,0.010180588058663526,0.019733707569327703 "
-"1943,-4.792129854691438E-4,-0.011445314714753988,0.01711749479725804,0.011545393854788389,-4.306310678758368E-4,-0.007553963576877576,0.005774321706968524,-0.003789618662923445,-0.011939758213620519,-0.0028307481663355383 "
-"1940,0.09671316528662552,0.014081060552730104,0.02604948527743548,0.04415731282791977,0.019063583792903748,0.004225112521388514,0.03286067964858169,0.03087628387017154,0.021692655593799823,-0.059804615071219834 "
-"1941,0.01103292023945677,-0.016153564740548777,0.02760601004102232,0.00979023936103867,-0.007538785996757565,-1.3070815912463518E-4,-0.004758054763369954,0.021151781420047495,0.0013627001458126967,-0.031195495725176582 "
-"1938,-0.006872495832354018,0.0468482726324724,-0.02397302473440738,-0.014763266415856747,0.02858737757863789,0.01447109868071487,0.022421777784781233,0.003092419859283136,-0.011891109078844915,-0.0761073996833526 "
-"1939,0.006373017335814568,0.03297573789726434,-0.022948412837680968,-0.019274872922009047,0.02697542468446129,0.002811143920587561,0.022788768951136143,-0.04036992922493371,-0.009180484245250345,-0.028799927378028757 "
-"1936,0.03853375294363078,0.0021663723758837683,-0.032350985228418026,0.02881438735858928,0.06997708577464909,-0.027254112560896843,-0.018281980087375128,-0.03673062026049352,0.013184162949343109,-0.012793291153511837 "
-"1937,0.03859953666204028,0.08081278982124143,-0.06467574868719168,-0.023089186970671027,0.02828101396628386,-0.03323578756753279,0.006853903947805181,-0.041759094661105514,-0.03998452848196925,-0.09396851936715626 "
-"1950,0.00515929294867703,0.007404278689017491,-0.0021636615445353113,0.008425585477616815,0.015253070806223014,-0.019720189092472994,0.007060888853169973,-0.003931665668402699,-0.014705611862509722,-0.02900701192250452 "
-"1951,0.008423336000244868,-0.008254546961383637,-0.012698650812726165,0.029424413844610843,0.012674752722737931,-0.0036671001084909727,0.003500118863334283,0.016660208343364406,-0.021631342460905416,-0.02916728624677752 "
-"1948,-0.006707254538108169,-0.00728299035381591,0.03723906050195113,-0.015283322582180148,-0.032063470412445394,0.021606705284915265,0.021483385170286397,0.02811660414345276,0.017858425833247687,-0.029348584723309357 "
-"1949,0.09313801398524427,-0.06404052818573194,0.07291477207002235,0.0753142888510784,-0.21143944320665106,-0.03706817144471337,-0.04469483770330234,0.04106655489497419,-0.13843563025571423,0.02510250043874238 "
-"1946,0.0397332510316756,-0.047807316599654245,0.02244952836698948,0.04662975750468641,-0.09844390959669579,0.014375331578950972,-0.07256196297509064,0.04164021552781526,-0.049641903364084146,-0.008558086982656482 "
-"1947,0.0033443978182418534,-0.016538053208651576,0.0026537034500360873,0.024796118338759447,-0.027133120466805705,0.02006292582291959,-0.10110522286712419,-0.04562046546910964,0.02602052483839502,0.04867723528406327 "
-"1944,-0.015894703560071534,-0.027794957641038714,0.02321185433897546,-0.009293355001046036,-0.030680954480488545,-0.0010755735180553888,0.011117541301909234,0.026457383672191075,-0.0055403348407656846,-0.017127074478294358 "
-"1945,6.284055229017769E-5,-0.005521001938335954,0.014301304143669355,0.012745545520702473,-0.016355650652220215,0.0015556949590170908,-0.013441646267349446,-0.0045408472596189554,-0.023669389405907626,-0.010502856345056455 "
-"1927,-0.08838914159107095,0.05732174754079283,-0.02972017322323669,-0.024520668745304983,-0.004883081809190008,-0.036810453844272895,0.03952168764457172,-0.09727722552877639,0.04505748989606172,-0.061032136484662686 "
-"1926,-0.012482966682779262,0.04775935373831752,-0.023439492553671268,-0.012175535364040993,0.027333793095203025,0.04331214324014983,-0.0019834482596528535,-0.06795680697289246,-0.008272355490095105,0.01095435170212811 "
-"1925,0.012349097132729211,-0.007242017953107695,-6.913977846708884E-4,0.006369268251175132,0.008613219461910555,0.013038739578026471,-0.012450287331938857,0.0019950321486177742,0.02491166352294703,-0.04012658741828331 "
-"1924,-0.003098705420227344,0.04364816591201731,-0.02451048721222357,0.01973850755734506,0.10973822039754312,0.032487535336662945,-0.02033835902344322,-0.06273402578151283,-0.023065217603188175,-0.008224273968678687 "
-"1923,0.03593777184361465,0.00674751412309899,-0.011689725624841623,0.02352411645531956,0.06993368848210121,-0.009896553650456214,0.022075375623829312,-0.0627918937328849,0.0030251840663723575,-0.006982740497124705 "
-"1922,-0.018029066497269364,0.03558306679750781,0.003277672378362499,-0.020712570019522734,0.0777837740091793,0.023504265669166708,-0.035362555024198425,-0.04577227835884515,0.05765136350325522,-0.0325869792611031 "
-"1921,-0.07206218049475499,0.008403647391296865,-0.042878929881304075,-0.009344597513810653,-0.034780901514336306,0.01420778750097662,-0.009522991408256366,-0.04303803431673745,0.009015396279129615,0.01074967099051194 "
-"1920,0.017038388166311536,-0.023982761662635414,-0.026607943204655322,0.037364318174103905,-0.07903161666650071,-0.04100305185991189,-0.00488931505837586,0.06383516912947433,0.025883248032640818,0.02879304814164521 "
-"1935,0.0031795229073172506,0.015949667131270738,-0.011576313297684394,0.03476540845627064,0.11472419174876858,-0.04136655647067052,-0.036923108682718836,-0.05029449430330976,0.026109200668082623,-0.01440936057532122 "
-"1934,0.0010161727452088125,-0.011790234065643293,-0.004495829109581603,0.006849873488671323,0.023747277845819325,-0.00567641852982104,-0.015700880972175108,0.003948878987796451,0.014367887858613574,-0.00948797187675249 "
-"1933,-0.00501393941025873,0.0368193561798138,-0.016250504758862677,-0.027158909295982303,0.05966463390415463,0.034355808731374886,-0.011577825505483263,-0.0231378204286109,0.08835252451090408,-0.036234864380648775 "
-"1932,-0.05430874842571148,-0.032587527295320856,-0.1001429476896952,0.04773008246684643,-0.08402527162074135,0.07184036769939783,-0.03045710434761287,-0.050634046410796954,0.009621361608629279,-0.0775916279670066 "
-"1931,-0.01070530565123099,0.0031454879321807473,0.029961066422747592,-0.02482632689927538,-0.027096833347118442,0.004465984589715102,-0.024312672727020486,0.024645596605080453,0.027415525873488455,-0.0409646703510157 "
-"1930,-0.060205360665940524,0.03538084989390739,-0.04652593021634307,0.05400340925329256,0.09036245077780773,-4.466175973478091E-4,-0.07343682223404417,-0.05277989635686954,-0.04420876682749448,-0.009523284208277185 "
-"1929,-0.011273760975035843,0.0011580240049802004,0.0011426824100225232,-0.008006521229789744,0.012438382849686971,0.007908795695616326,-0.012639128130147096,-0.020104404570867825,-0.010951710249942263,0.024959848995525977 "
-"1928,-0.03218451496844622,0.03359836487667367,-0.039485994879582466,7.874839334810385E-4,0.044079529832159965,0.010136623500984345,-0.01777510068065101,-0.076284110475925,-0.004894332607447194,0.006294829580665473 "
-;
+static const std::size_t gFeatureDataNuFeatures = 1231;
+
+static const std::size_t gFeatureDataK = 10;
+
+static const unsigned short gFeatureDataID[1231] = {
+0,
+1,
+2,
+3,
+4,
+5,
+6,
+7,
+8,
+9,
+10,
+11,
+12,
+13,
+14,
+15,
+17,
+16,
+19,
+18,
+21,
+20,
+23,
+22,
+25,
+24,
+27,
+26,
+29,
+28,
+31,
+30,
+34,
+35,
+32,
+33,
+38,
+39,
+36,
+37,
+42,
+43,
+40,
+41,
+46,
+47,
+44,
+45,
+51,
+50,
+49,
+48,
+55,
+54,
+53,
+52,
+58,
+57,
+56,
+63,
+62,
+61,
+60,
+68,
+69,
+70,
+71,
+64,
+65,
+66,
+67,
+76,
+77,
+78,
+79,
+72,
+73,
+74,
+75,
+85,
+84,
+87,
+86,
+81,
+80,
+83,
+82,
+93,
+92,
+95,
+94,
+89,
+88,
+91,
+90,
+102,
+103,
+100,
+101,
+98,
+99,
+96,
+97,
+110,
+111,
+108,
+109,
+106,
+107,
+104,
+105,
+119,
+118,
+117,
+116,
+115,
+114,
+113,
+112,
+127,
+126,
+125,
+124,
+123,
+122,
+121,
+120,
+2065,
+137,
+136,
+2064,
+139,
+2067,
+2066,
+138,
+141,
+2069,
+140,
+2068,
+2071,
+143,
+2070,
+142,
+129,
+2073,
+128,
+2075,
+131,
+130,
+2074,
+2077,
+133,
+132,
+135,
+2079,
+134,
+2078,
+2048,
+152,
+153,
+2049,
+2050,
+2051,
+155,
+156,
+2052,
+2053,
+2054,
+2055,
+2056,
+144,
+2057,
+145,
+2058,
+146,
+2059,
+147,
+148,
+2060,
+149,
+2061,
+2062,
+150,
+151,
+2063,
+2099,
+2098,
+2097,
+2103,
+2102,
+2101,
+2100,
+2107,
+2106,
+2105,
+2104,
+2111,
+2110,
+2109,
+2108,
+2082,
+2083,
+2080,
+2081,
+2086,
+2087,
+2084,
+2085,
+2090,
+2091,
+2088,
+2089,
+2094,
+2092,
+2093,
+2133,
+2132,
+2135,
+2134,
+2129,
+2128,
+2131,
+2130,
+2141,
+2140,
+2143,
+2142,
+2137,
+2136,
+2139,
+2138,
+2116,
+2117,
+2118,
+2119,
+2112,
+2113,
+2114,
+2115,
+2124,
+2125,
+2126,
+2127,
+2120,
+2121,
+2122,
+2123,
+2150,
+2151,
+2149,
+2146,
+2147,
+2144,
+2145,
+2152,
+2153,
+1016,
+1017,
+1018,
+1019,
+1020,
+1021,
+1022,
+1023,
+1008,
+1009,
+1010,
+1011,
+1012,
+1013,
+1014,
+1015,
+1001,
+1000,
+1003,
+1002,
+1005,
+1004,
+1007,
+1006,
+1100,
+1101,
+1102,
+1103,
+1096,
+1097,
+1099,
+1092,
+1093,
+1094,
+1095,
+1088,
+1089,
+1090,
+1091,
+1117,
+1116,
+1119,
+1118,
+1113,
+1112,
+1115,
+1114,
+1109,
+1108,
+1110,
+1105,
+1104,
+1107,
+1106,
+1134,
+1132,
+1133,
+1130,
+1131,
+1128,
+1129,
+1126,
+1127,
+1124,
+1125,
+1122,
+1123,
+1120,
+1121,
+1032,
+1033,
+1034,
+1035,
+1036,
+1037,
+1038,
+1039,
+1024,
+1025,
+1026,
+1027,
+1028,
+1029,
+1030,
+1031,
+1049,
+1048,
+1051,
+1050,
+1053,
+1052,
+1055,
+1054,
+1041,
+1040,
+1043,
+1042,
+1045,
+1044,
+1047,
+1046,
+1066,
+1067,
+1064,
+1065,
+1070,
+1071,
+1068,
+1069,
+1058,
+1059,
+1056,
+1057,
+1062,
+1063,
+1060,
+1061,
+1083,
+1082,
+1081,
+1080,
+1087,
+1086,
+1085,
+1084,
+1075,
+1074,
+1073,
+1072,
+1079,
+1078,
+1077,
+1076,
+1221,
+1220,
+1223,
+1222,
+1217,
+1216,
+1219,
+1218,
+1229,
+1228,
+1231,
+1230,
+1225,
+1224,
+1227,
+1226,
+1236,
+1237,
+1238,
+1239,
+1232,
+1233,
+1234,
+1235,
+1244,
+1245,
+1246,
+1247,
+1240,
+1241,
+1242,
+1243,
+1255,
+1254,
+1253,
+1252,
+1251,
+1250,
+1249,
+1248,
+1263,
+1262,
+1261,
+1260,
+1259,
+1258,
+1257,
+1256,
+1270,
+1271,
+1268,
+1269,
+1266,
+1267,
+1264,
+1265,
+1278,
+1279,
+1276,
+1277,
+1274,
+1275,
+1272,
+1273,
+1202,
+1203,
+1200,
+1201,
+1206,
+1207,
+1204,
+1205,
+1210,
+1211,
+1208,
+1209,
+1214,
+1215,
+1212,
+1213,
+1375,
+1374,
+1373,
+1372,
+1371,
+1370,
+1369,
+1368,
+1367,
+1366,
+1365,
+1364,
+1363,
+1362,
+1361,
+1360,
+1358,
+1359,
+1356,
+1357,
+1354,
+1355,
+1352,
+1353,
+1350,
+1351,
+1348,
+1349,
+1346,
+1347,
+1344,
+1345,
+1405,
+1404,
+1407,
+1406,
+1401,
+1400,
+1403,
+1402,
+1397,
+1396,
+1399,
+1398,
+1393,
+1392,
+1395,
+1394,
+1388,
+1389,
+1390,
+1391,
+1384,
+1385,
+1386,
+1387,
+1380,
+1381,
+1382,
+1383,
+1376,
+1377,
+1378,
+1379,
+1307,
+1306,
+1305,
+1304,
+1311,
+1310,
+1309,
+1308,
+1299,
+1298,
+1297,
+1296,
+1303,
+1302,
+1301,
+1300,
+1290,
+1291,
+1288,
+1289,
+1294,
+1295,
+1292,
+1293,
+1282,
+1283,
+1280,
+1281,
+1286,
+1287,
+1284,
+1285,
+1337,
+1336,
+1339,
+1338,
+1341,
+1340,
+1343,
+1342,
+1329,
+1328,
+1331,
+1330,
+1333,
+1332,
+1335,
+1334,
+1320,
+1321,
+1322,
+1323,
+1324,
+1325,
+1326,
+1327,
+1312,
+1313,
+1314,
+1315,
+1316,
+1317,
+1318,
+1319,
+1494,
+1495,
+1492,
+1493,
+1490,
+1491,
+1488,
+1489,
+1502,
+1503,
+1500,
+1501,
+1498,
+1499,
+1496,
+1497,
+1479,
+1478,
+1477,
+1476,
+1475,
+1474,
+1473,
+1472,
+1487,
+1486,
+1485,
+1484,
+1483,
+1482,
+1481,
+1480,
+1524,
+1525,
+1526,
+1527,
+1520,
+1521,
+1522,
+1523,
+1532,
+1533,
+1534,
+1535,
+1528,
+1529,
+1530,
+1531,
+1509,
+1508,
+1511,
+1510,
+1505,
+1504,
+1507,
+1506,
+1517,
+1516,
+1519,
+1518,
+1513,
+1512,
+1515,
+1514,
+1426,
+1427,
+1424,
+1425,
+1430,
+1431,
+1428,
+1429,
+1434,
+1435,
+1432,
+1433,
+1438,
+1439,
+1436,
+1437,
+1411,
+1410,
+1409,
+1408,
+1415,
+1414,
+1413,
+1412,
+1419,
+1418,
+1417,
+1416,
+1423,
+1422,
+1421,
+1420,
+1456,
+1457,
+1458,
+1459,
+1460,
+1461,
+1462,
+1463,
+1464,
+1465,
+1466,
+1467,
+1468,
+1469,
+1470,
+1471,
+1441,
+1440,
+1443,
+1442,
+1445,
+1444,
+1447,
+1446,
+1449,
+1448,
+1451,
+1450,
+1453,
+1452,
+1455,
+1454,
+1642,
+1643,
+1640,
+1641,
+1646,
+1647,
+1644,
+1645,
+1634,
+1635,
+1632,
+1633,
+1638,
+1639,
+1636,
+1637,
+1659,
+1658,
+1657,
+1656,
+1663,
+1662,
+1661,
+1660,
+1651,
+1650,
+1649,
+1648,
+1655,
+1654,
+1653,
+1652,
+1608,
+1609,
+1610,
+1611,
+1612,
+1613,
+1614,
+1615,
+1600,
+1601,
+1602,
+1603,
+1604,
+1605,
+1606,
+1607,
+1625,
+1624,
+1627,
+1626,
+1629,
+1628,
+1631,
+1630,
+1617,
+1616,
+1619,
+1618,
+1621,
+1620,
+1623,
+1622,
+1582,
+1583,
+1580,
+1581,
+1578,
+1579,
+1576,
+1577,
+1574,
+1575,
+1572,
+1573,
+1570,
+1571,
+1568,
+1569,
+1599,
+1598,
+1597,
+1596,
+1595,
+1594,
+1593,
+1592,
+1591,
+1590,
+1589,
+1588,
+1587,
+1586,
+1585,
+1584,
+1548,
+1549,
+1550,
+1551,
+1544,
+1545,
+1546,
+1547,
+1540,
+1541,
+1542,
+1543,
+1536,
+1537,
+1538,
+1539,
+1565,
+1564,
+1567,
+1566,
+1561,
+1560,
+1563,
+1562,
+1557,
+1556,
+1559,
+1558,
+1553,
+1552,
+1555,
+1554,
+1763,
+1762,
+1761,
+1760,
+1767,
+1766,
+1765,
+1764,
+1771,
+1770,
+1769,
+1768,
+1775,
+1774,
+1773,
+1772,
+1778,
+1779,
+1776,
+1777,
+1782,
+1783,
+1780,
+1781,
+1786,
+1787,
+1784,
+1785,
+1790,
+1791,
+1788,
+1789,
+1729,
+1728,
+1731,
+1730,
+1733,
+1732,
+1735,
+1734,
+1737,
+1736,
+1739,
+1741,
+1740,
+1743,
+1742,
+1744,
+1747,
+1748,
+1749,
+1750,
+1751,
+1752,
+1753,
+1754,
+1755,
+1756,
+1757,
+1758,
+1759,
+1703,
+1702,
+1701,
+1700,
+1699,
+1698,
+1697,
+1696,
+1711,
+1710,
+1709,
+1708,
+1707,
+1706,
+1705,
+1704,
+1718,
+1719,
+1716,
+1717,
+1714,
+1715,
+1712,
+1713,
+1726,
+1727,
+1724,
+1725,
+1722,
+1723,
+1720,
+1721,
+1669,
+1668,
+1671,
+1670,
+1665,
+1664,
+1667,
+1666,
+1677,
+1676,
+1679,
+1678,
+1673,
+1672,
+1675,
+1674,
+1684,
+1685,
+1686,
+1687,
+1680,
+1681,
+1682,
+1683,
+1692,
+1693,
+1694,
+1695,
+1688,
+1689,
+1690,
+1691,
+1913,
+1912,
+1915,
+1914,
+1917,
+1916,
+1919,
+1918,
+1905,
+1904,
+1907,
+1906,
+1909,
+1908,
+1911,
+1910,
+1896,
+1897,
+1898,
+1899,
+1900,
+1901,
+1902,
+1903,
+1888,
+1889,
+1890,
+1891,
+1892,
+1893,
+1894,
+1895,
+1883,
+1882,
+1881,
+1880,
+1887,
+1886,
+1885,
+1884,
+1875,
+1874,
+1873,
+1872,
+1879,
+1878,
+1877,
+1876,
+1866,
+1867,
+1864,
+1865,
+1870,
+1871,
+1868,
+1869,
+1858,
+1859,
+1856,
+1857,
+1862,
+1863,
+1860,
+1861,
+1853,
+1852,
+1855,
+1854,
+1849,
+1848,
+1851,
+1850,
+1845,
+1844,
+1847,
+1846,
+1841,
+1840,
+1843,
+1842,
+1836,
+1837,
+1838,
+1839,
+1832,
+1833,
+1834,
+1835,
+1828,
+1829,
+1830,
+1831,
+1826,
+1827,
+1822,
+1821,
+1820,
+1819,
+1818,
+1817,
+1816,
+1815,
+1814,
+1813,
+1812,
+1811,
+1810,
+1809,
+1808,
+1806,
+1807,
+1804,
+1805,
+1802,
+1803,
+1800,
+1801,
+1798,
+1799,
+1796,
+1797,
+1794,
+1795,
+1792,
+1793,
+2032,
+2033,
+2034,
+2035,
+2036,
+2037,
+2038,
+2039,
+2040,
+2041,
+2042,
+2043,
+2044,
+2045,
+2046,
+2047,
+2017,
+2016,
+2019,
+2018,
+2021,
+2020,
+2023,
+2022,
+2025,
+2024,
+2027,
+2026,
+2029,
+2028,
+2031,
+2030,
+2002,
+2003,
+2000,
+2001,
+2006,
+2007,
+2004,
+2005,
+2010,
+2011,
+2008,
+2009,
+2014,
+2015,
+2012,
+2013,
+1987,
+1986,
+1985,
+1984,
+1991,
+1990,
+1989,
+1988,
+1995,
+1994,
+1993,
+1992,
+1999,
+1998,
+1997,
+1996,
+1972,
+1973,
+1974,
+1975,
+1968,
+1969,
+1970,
+1971,
+1980,
+1981,
+1982,
+1983,
+1976,
+1977,
+1978,
+1979,
+1957,
+1956,
+1959,
+1958,
+1953,
+1952,
+1955,
+1954,
+1965,
+1964,
+1967,
+1966,
+1961,
+1960,
+1963,
+1962,
+1942,
+1943,
+1940,
+1941,
+1938,
+1939,
+1936,
+1937,
+1950,
+1951,
+1948,
+1949,
+1946,
+1947,
+1944,
+1945,
+1927,
+1926,
+1925,
+1924,
+1923,
+1922,
+1921,
+1920,
+1935,
+1934,
+1933,
+1932,
+1931,
+1930,
+1929,
+1928,
+};
+
+static const float gFeatureDataW[1231] = {
+-0.043992401778103436f,
+0.013726505460659157f,
+0.021824381149550737f,
+0.0832011275700712f,
+0.030029223710345103f,
+-0.032434075362046476f,
+-0.07054452617334656f,
+-0.05346281063101783f,
+0.01425871703781274f,
+-0.03200214516806793f,
+0.008039393053046368f,
+0.007454692598728527f,
+-0.01575881378289391f,
+0.004588413254933907f,
+0.006060363861275674f,
+-0.0069868433528680165f,
+-0.002682649426821909f,
+-0.044603608112031956f,
+-0.025762858167422065f,
+0.026238867946587214f,
+0.0013706025678200413f,
+-0.008331972214515503f,
+0.010576975511002883f,
+0.005513920464238472f,
+-0.009885408915858316f,
+-0.006710622610912039f,
+0.048245768532464914f,
+0.0721229580111337f,
+0.05643824179670058f,
+0.05662108428969269f,
+0.036346251737295554f,
+0.03189044922457084f,
+0.015470385909787691f,
+0.017419384815110243f,
+0.027337978801361795f,
+0.027068965982860932f,
+0.006865637084974617f,
+0.008868679880252963f,
+0.010143514220863535f,
+0.006853378898158785f,
+0.05641779088586299f,
+-0.01808279243513353f,
+0.007020402360215468f,
+0.004161220319272579f,
+-0.001934566183802659f,
+-7.905203478286436E-4f,
+9.492334142165993E-4f,
+0.010591633960498918f,
+0.0027129282878604654f,
+4.982554368960841E-4f,
+-0.006397983347134027f,
+0.009674609482409927f,
+0.0028631517035285917f,
+0.0029165917041469006f,
+3.7052188452014627E-4f,
+8.782421196743944E-4f,
+0.0026000820916568593f,
+-2.034338426974144E-4f,
+0.0020516731203063963f,
+0.024395798328755425f,
+0.2210934064599223f,
+0.10677784099992223f,
+0.03682552934670927f,
+-0.01408608097091831f,
+-0.021417280230580836f,
+0.006848791377503277f,
+-0.029923885909300903f,
+0.049914465952207665f,
+1.8214037587076037E-4f,
+-0.10338078081345567f,
+-0.05380849461979005f,
+0.0162783360858933f,
+6.890036145584671E-4f,
+-0.004740129206808317f,
+-0.007070010218196361f,
+0.05459620474664538f,
+-0.003894112085623163f,
+-0.005256747072283061f,
+0.006981161833293663f,
+-0.008649663384383497f,
+-0.0031227517822727635f,
+-4.4738414464035557E-4f,
+-0.004795509208773559f,
+-0.005475953617356016f,
+-2.845644320532957E-4f,
+-0.003975786879713506f,
+0.003969720598243573f,
+0.09808211201028438f,
+0.0696886948678087f,
+-0.009809081378452215f,
+0.12473471032842148f,
+0.022061335591713013f,
+0.007097664576092979f,
+0.04155915326854618f,
+0.03397858390212572f,
+-0.008445341187092613f,
+-0.003310037939552013f,
+-0.010256427873308147f,
+-0.002066590723852283f,
+-0.007726182025732693f,
+-0.007410480560470403f,
+-0.012612192584626114f,
+-0.006590143021560319f,
+0.01851690951217028f,
+0.051093838305935786f,
+0.03283573564306124f,
+0.0014625114666563855f,
+6.095802650115428E-4f,
+0.0043819492198116095f,
+-4.4809385603389887E-4f,
+0.017174111990581813f,
+-0.02126975136430529f,
+0.05794803528357812f,
+-0.002852031222105959f,
+0.0022506537294581085f,
+-0.008636494757834104f,
+0.01877562083326379f,
+0.08068130708252146f,
+-0.0033079869469821864f,
+0.10606724031611293f,
+-0.03457883248671212f,
+0.001355644363513237f,
+-0.048062840022129794f,
+0.012682125197970847f,
+-0.026677041045145712f,
+-0.024363839539926054f,
+-0.03513874736724853f,
+0.02675215849568557f,
+0.04612659102148556f,
+0.04521193304625435f,
+0.0178234341628396f,
+0.09447936702883221f,
+-0.006718416856905685f,
+-0.027009925454548916f,
+0.0663595777536972f,
+0.035629139760351675f,
+0.030812981374148826f,
+0.09343990569196184f,
+0.025640191188814034f,
+-0.006857105925215715f,
+-0.10896750064328727f,
+0.015429379758252891f,
+-0.08345253159562638f,
+-0.001985303837076265f,
+0.0016660521854566395f,
+-0.037325902296473805f,
+-0.04634625286203708f,
+0.05823645943800869f,
+0.040694229870526934f,
+-0.0028218764673441097f,
+-0.009755010873196792f,
+0.0657177858075339f,
+0.048829896583332616f,
+0.021272051967373213f,
+-0.04353851551265163f,
+0.030437790419205458f,
+-0.008423689907073165f,
+-0.030972940271981525f,
+-0.04307687774134541f,
+0.006996557890509391f,
+-0.04500347657636045f,
+0.10435981144037892f,
+-0.026435063469366072f,
+0.010244201544087748f,
+0.014322864319786624f,
+-0.01126376429611901f,
+0.01130995595890669f,
+0.0552603937387763f,
+0.07411551234314483f,
+-0.020971501048387388f,
+-0.13074171659102812f,
+0.01040594119158525f,
+-0.1341562830317203f,
+0.034882867360408645f,
+-0.14623660485711756f,
+0.10534833625661712f,
+-0.09614326195111703f,
+-0.03938354168477378f,
+0.0075835779010149f,
+0.007200191195495038f,
+-0.02907762717531834f,
+-0.023506706234821272f,
+-0.08205247850386785f,
+-0.05887192296769318f,
+0.035468462460988115f,
+-0.03327282099472421f,
+-0.028030818248827458f,
+-0.004131247573966846f,
+-0.05419993657178016f,
+-0.026745786969392192f,
+-0.026231386856547807f,
+-0.10037139316352488f,
+-0.027778192301470505f,
+-0.01643592229334825f,
+-0.02577956491124747f,
+3.019642462468328E-4f,
+-0.04757112556668956f,
+-8.918223438745458E-4f,
+-0.0367287706800554f,
+-0.03970218104983201f,
+-0.0024837183803171686f,
+-0.03380849740574179f,
+-0.08486280157448385f,
+-0.009610173512731381f,
+-0.04187171964721987f,
+-0.06476310815178032f,
+-0.07495516517539266f,
+-0.02365553932162855f,
+-0.045632967412513256f,
+-0.07058408512204624f,
+-0.06748077241495308f,
+-0.04756243525896897f,
+-0.07921341995968473f,
+-0.045783076495173686f,
+-0.06200312659485457f,
+0.0021814410464036076f,
+-0.021412515635916184f,
+-0.036185792804755146f,
+-0.044989748121346304f,
+-0.055668067058814656f,
+-0.02497744183695997f,
+-0.00422806258466199f,
+-0.0314746678653239f,
+0.04450976673399777f,
+-0.0298859053943595f,
+-0.0285565725890815f,
+0.021058123468361695f,
+-0.03597709758787071f,
+-0.04748511695929543f,
+0.07324983913929778f,
+-0.0781500096118026f,
+-0.03798527959718149f,
+-0.039772923204370876f,
+-0.050366530173639144f,
+-0.04712440682969475f,
+-0.05348789711597286f,
+-0.06476343126774144f,
+-0.05917808464404155f,
+-0.06395052633126183f,
+-0.03567320063717441f,
+-0.02756492156323723f,
+-0.06387230231919785f,
+0.020109685828133248f,
+-0.0575832936682619f,
+-0.02751274688463667f,
+-0.015152833910795445f,
+-0.005965703567185184f,
+-0.06705645833161628f,
+-0.050861145579705745f,
+-0.004604816183074605f,
+-0.0355038204840882f,
+-0.03486556053526509f,
+0.047308768319900725f,
+-0.06475098366863184f,
+-0.03074334398618455f,
+-0.01282605778209353f,
+-0.005559476460219528f,
+-0.02272063542675227f,
+-0.036784044761226944f,
+0.04169459640121203f,
+-0.02507430438618407f,
+0.010431419368448977f,
+-0.08287347569204655f,
+-0.04993877103847261f,
+-0.05352071111456951f,
+0.02590715470174332f,
+0.02350561221801707f,
+0.03099292076783201f,
+0.05993941445706721f,
+-0.027012726956415035f,
+-0.024981421287623356f,
+0.017085556500822552f,
+-0.01417086110326981f,
+-0.008958327948566484f,
+0.0291354452756606f,
+-0.02642380555408049f,
+-0.04165812308658163f,
+-0.03261435394889726f,
+-0.04516330911510853f,
+-0.005150219870730215f,
+-0.03241018071668431f,
+-0.016834218167248848f,
+-0.016580226457972646f,
+-0.0033675286143880394f,
+0.010909184812895316f,
+8.028512938932167E-4f,
+-0.02038446408302541f,
+0.0021363098897318887f,
+0.01608670649921052f,
+-0.029899685467017975f,
+0.0022685159196322506f,
+0.07735297391047982f,
+0.06013688525270816f,
+-0.029993635536629645f,
+3.3810253132303967E-4f,
+-0.04607439671795628f,
+-0.007584254594763804f,
+-0.04043355032014595f,
+-0.04318518036942975f,
+0.00973389074177488f,
+0.0018399129828928589f,
+0.006784155895861046f,
+-0.013316302618894188f,
+-0.004612148698687968f,
+-0.01804476513545704f,
+-2.0254040039077636E-4f,
+-0.03434768833052755f,
+-0.049822685331843614f,
+8.391104122435933E-4f,
+0.025784087840202054f,
+-0.05532667307982664f,
+-0.0362700699566704f,
+-0.025730532806231925f,
+-0.049552090279822006f,
+-0.05898738457311805f,
+-0.02392644777918006f,
+-0.02567547115143628f,
+-0.009432899647360707f,
+-0.047699525058250494f,
+-0.0339982753677997f,
+-0.05287402993542117f,
+-0.02492043072530953f,
+-0.035609477418608086f,
+0.08600929335798498f,
+-0.026942111404045527f,
+0.007636755459512571f,
+0.05994257887542596f,
+-0.015771107243345364f,
+0.0724124779857773f,
+0.07642909207087699f,
+0.10340222416772736f,
+0.012490380036565756f,
+-0.0320076455005188f,
+-0.031498497486121824f,
+-0.04990926369196036f,
+-0.05886087101476793f,
+0.05241783855990501f,
+-0.005263650731502935f,
+0.06264165857494776f,
+0.08871360717842346f,
+0.009005124996462943f,
+-0.010358036419693538f,
+0.005735380391472816f,
+0.04940831990630696f,
+-0.018273369679692935f,
+-0.01578804011178581f,
+-0.043756639500844685f,
+-0.010865508622924831f,
+-0.02502872534722696f,
+0.03668578839228413f,
+0.08659006978623017f,
+-0.022792199617635046f,
+-0.0016947085738542812f,
+0.06703196928694294f,
+0.019405381297113576f,
+-0.026884021111133614f,
+-0.002473019531838211f,
+-0.0315466020468379f,
+-0.033581786337290184f,
+0.004193084108455971f,
+0.03950089271165306f,
+-0.008973434379960782f,
+-0.05974538115289261f,
+-0.0394752635665169f,
+-0.014821233412549364f,
+0.04547608380977173f,
+0.0474685831360299f,
+-0.004053598281267016f,
+-0.04406988905195337f,
+0.052166022053045026f,
+0.013181929222815816f,
+-0.0060480938696798265f,
+-0.011250086419493231f,
+0.05128872376519892f,
+-0.01758435858352421f,
+0.06591487063119104f,
+-0.004168628247834099f,
+0.06522591129819935f,
+0.02558564658404101f,
+0.045603352175815584f,
+0.0454145170115692f,
+0.05893633567573366f,
+0.033190722110648226f,
+-0.002783831808565348f,
+0.05630858380627057f,
+0.0659402199332498f,
+0.11198485874670007f,
+0.030409383235237352f,
+0.03585228356297456f,
+-0.002705109382248942f,
+-0.026918530351081146f,
+-0.07915578787622264f,
+-0.05566481572072644f,
+-0.03310692832893936f,
+-0.049112374737801646f,
+-0.02490641591442671f,
+0.01642305886786737f,
+-0.033164644900195606f,
+-0.02974692632583031f,
+-0.009952507460167393f,
+0.01675336209716531f,
+0.013076650973271223f,
+0.055579093271147455f,
+0.014203877042690506f,
+0.003466570755362898f,
+-0.016154333394968f,
+-0.059540083229363265f,
+-0.042022274409670546f,
+0.01842964136144187f,
+-0.01836795159442367f,
+-0.015889707261689798f,
+-0.014712175077106497f,
+-0.043699886923330086f,
+-0.05415029841234023f,
+-0.04879319660032631f,
+0.0067211130373561094f,
+-0.06407734950490258f,
+-0.08094135753517888f,
+-0.05766195575042671f,
+-0.01486975568188599f,
+-0.06137187563430399f,
+-0.02722226881232098f,
+-0.03590401801577042f,
+-0.07678676636067061f,
+-0.05467889173697396f,
+-0.03464112578256286f,
+-0.08091094831845687f,
+-0.05088403761727405f,
+-0.018140051275984313f,
+0.10315537476598781f,
+-0.05645219050643576f,
+-0.06820546666067927f,
+-0.036454486648852896f,
+-0.08845564822569547f,
+-0.07588958846321674f,
+-0.02833234883753232f,
+-0.038923219396751196f,
+0.04790772446346352f,
+0.05650198208865081f,
+0.02731619197907423f,
+0.09551322173764534f,
+0.034519622724387876f,
+-7.935723715061275E-4f,
+0.10931700180120742f,
+0.07463169303262387f,
+0.059822520818952f,
+-0.014198571075265773f,
+-0.014548805433660755f,
+0.004542525290679923f,
+-0.024859878562669257f,
+-0.036516883112761245f,
+0.0885648408001271f,
+0.06289801192888082f,
+0.009071348986803764f,
+-0.0214008607779595f,
+-0.0019878176283711895f,
+-0.006049731057169549f,
+-0.025318734759811157f,
+-0.0067388446295774534f,
+-0.021920481088842262f,
+-0.05961776619516547f,
+-0.01068185819819945f,
+-0.02188149527751847f,
+-0.022209768231757767f,
+0.006469759630625069f,
+-0.01847975969597921f,
+-0.0033927287889131317f,
+-0.06551141824742046f,
+-0.016781836597815788f,
+0.06634255211438696f,
+0.07292209944310227f,
+0.076876685718844f,
+0.062463851178562804f,
+0.08121279715456428f,
+-0.10377531435476223f,
+-0.06148717140479422f,
+-0.04080317733088864f,
+-0.02013317110140765f,
+-0.020766036526837485f,
+-0.004233063053817159f,
+-0.0170034245504385f,
+-0.011849883946741115f,
+-0.025219839731792024f,
+-0.03508401095399027f,
+-0.028491814943300744f,
+-0.05071368402160848f,
+0.003867507690958167f,
+0.010816479700700125f,
+-0.08589780724171338f,
+-0.07233336351452355f,
+-0.050775714097126314f,
+-0.049918190459288365f,
+0.00243959981412419f,
+-0.022600650883161818f,
+-0.027091721062792097f,
+-0.0121009204195204f,
+-0.016825206764574385f,
+-0.02800475325501452f,
+0.016858676368677075f,
+0.016136569838365183f,
+-0.02698267007206571f,
+0.08775098447460504f,
+0.0787358740223556f,
+-0.02511793594634371f,
+0.014304501741173892f,
+0.05486842815760608f,
+0.08722489919746902f,
+0.09819136668974893f,
+0.05900723645077392f,
+0.05203887491914832f,
+0.08816028685002615f,
+0.02257784278475029f,
+0.011107738449634762f,
+0.06750468197914228f,
+0.02050977963964964f,
+0.07734181372991573f,
+0.02817919904097723f,
+0.04150877873614092f,
+0.07102076612083308f,
+0.03486018667868617f,
+0.037795684585729634f,
+0.024263354320639537f,
+0.030820857643692908f,
+0.029443799247337518f,
+0.0849472433807709f,
+0.08153206835789857f,
+0.052091979925380394f,
+0.01719271035744913f,
+0.02635294723197123f,
+0.08810634920436268f,
+0.07837229522584523f,
+0.09352284285589683f,
+0.07303462116313517f,
+-0.038047062892014365f,
+-0.02098434469790756f,
+-0.04221655681120846f,
+-0.03713975188468147f,
+0.016116518253057533f,
+-0.0628147456566315f,
+-0.07314080152476808f,
+-0.0293370029964073f,
+-0.03569437641541893f,
+-0.05388469737609968f,
+-0.042555268848532585f,
+-0.04823092315599767f,
+-0.04286957891944828f,
+-0.004749303258986937f,
+-0.004671625602237391f,
+0.054505616570636635f,
+-0.03395829027449506f,
+0.042345172923876045f,
+0.025414104473920913f,
+0.037323934794733164f,
+-0.05716443063700491f,
+-0.07761985131663074f,
+0.0017126444797324275f,
+-0.0140611188121496f,
+0.09810293040014798f,
+0.029495728478814435f,
+0.014842081392581783f,
+-0.00871938123168936f,
+0.014638518600089046f,
+0.01741120127553747f,
+0.016947408865975438f,
+0.003561153694882679f,
+-0.029666381695924122f,
+0.0011941050295664784f,
+0.02420919871385881f,
+0.03248071789525166f,
+-0.05437567587736952f,
+0.018036259230222052f,
+-0.05508054501087427f,
+0.020806379202639242f,
+0.06654450035401997f,
+0.0384759517842854f,
+0.030113076909424746f,
+0.008183883815002905f,
+0.02931909411352109f,
+-2.2004680396106225E-4f,
+-0.010047205728826527f,
+0.0013347749602660081f,
+-0.09118910010942557f,
+-0.045349832170140825f,
+-0.05924303004860717f,
+-0.04164253048063017f,
+-0.05277670404437997f,
+-0.06092943186763444f,
+0.02349593540395798f,
+0.055734719191883775f,
+-0.027325362732666923f,
+-0.02281170983149662f,
+-0.06203215274671967f,
+-0.07216780011479315f,
+-0.06573566093872073f,
+0.0011427289105249028f,
+-0.038240787349496624f,
+-0.09192726982548403f,
+-0.05822103059637337f,
+0.029668546814003563f,
+-0.04539105082091353f,
+-0.02778364018674272f,
+0.024112999922445102f,
+-0.05827867647308197f,
+-0.08234822967733449f,
+-0.042261164001899214f,
+0.01631936036111976f,
+0.002771502061787286f,
+-0.039219198741051176f,
+0.00767338353004308f,
+-0.052149105218268814f,
+-0.026940922722951555f,
+-0.0047572464502777636f,
+0.01778176090967447f,
+-0.057735288847658765f,
+0.007813312264248732f,
+0.041396670756342735f,
+0.02342071942946955f,
+-0.05146925687632311f,
+-0.051784314744714253f,
+0.011962472541088405f,
+-0.0056136159579240055f,
+0.013704864776394555f,
+-0.023011651491812845f,
+-0.01182234965320937f,
+0.002562604199201778f,
+-0.031481837799989164f,
+-0.05260082087665725f,
+0.02979420863082137f,
+-0.04412745579537329f,
+-0.0505303428947886f,
+-0.03224231646155538f,
+-0.017813700941924755f,
+-0.04209105256597075f,
+-0.008312758105762657f,
+-6.64615365879106E-4f,
+-0.04254627625250674f,
+-0.03989282716340575f,
+-0.0613620223953188f,
+-0.0863841640848614f,
+-0.03267595696829311f,
+-0.04839999838385506f,
+-0.017433064455393735f,
+-0.028323373087683026f,
+-0.04750867975937367f,
+-0.0065179391975195445f,
+4.3577337286224605E-4f,
+-2.2733172844105264E-5f,
+-0.018067645922187594f,
+-0.05218156468886111f,
+-0.030358034567840007f,
+-0.005645287656881207f,
+0.006775772721717606f,
+-0.01693247918792155f,
+-0.01472883376755915f,
+-0.029711198449317393f,
+0.0036753313110818773f,
+-0.03450349107089164f,
+0.019344519705974453f,
+-0.06236928756203702f,
+-0.017036122155892685f,
+-0.02098744011835874f,
+0.1017318899395874f,
+0.06845929425978468f,
+0.040797138555299504f,
+0.06839576919983109f,
+0.04981841536429327f,
+0.06453050473260638f,
+0.11385464122973951f,
+0.054945117713657184f,
+-0.012785287158635932f,
+0.027112178667483493f,
+7.471375156263334E-4f,
+-0.017557633724623153f,
+0.06169469617010478f,
+0.0822970779109715f,
+0.010092942975303243f,
+0.03432831746730882f,
+0.008608638713554882f,
+-0.025577765880979066f,
+0.044594563369123534f,
+-0.03206215057007763f,
+0.05108772581582938f,
+0.0722432651169995f,
+0.05275333955265944f,
+0.07799192092872365f,
+0.0132063867904901f,
+0.06014796449438088f,
+-0.009166474404971698f,
+-0.03169183716577759f,
+0.034367005396612346f,
+0.06378199321972823f,
+0.07168954312180142f,
+0.028944750728268003f,
+0.011790109622450298f,
+0.0018563589376547475f,
+-0.01599465482125056f,
+0.015949923558837634f,
+-0.017834553344867363f,
+0.009428677480382395f,
+-0.023778634244065792f,
+0.009894799131522667f,
+0.025479651177121504f,
+-0.04055643168837989f,
+-0.011375206647724335f,
+-0.08683907485968359f,
+-0.03687860010392081f,
+-0.0475706053684137f,
+0.028110582274918944f,
+-0.0178162116193858f,
+0.057253611306374526f,
+0.060990929837856436f,
+0.03315834359744337f,
+-2.936989773497541E-4f,
+0.05280841828205785f,
+0.04428349649763493f,
+0.0015337359006265725f,
+0.0680287197676135f,
+0.03858556423572122f,
+-0.04763952380898406f,
+-0.02612160784489234f,
+0.03935582309187596f,
+-0.05340667912776836f,
+-0.01903388792700827f,
+-0.012733955972751287f,
+0.05782895571964873f,
+-0.013516132624610568f,
+-0.021262662935783227f,
+0.04648997984538887f,
+-0.04054050270479543f,
+-0.07216506954303292f,
+-0.0449192136917221f,
+-0.017670929904524246f,
+0.0028587103818606165f,
+-0.03568813733336882f,
+0.028126833002188583f,
+0.026502517833243346f,
+-0.05526565313734021f,
+-0.08643900618476054f,
+-0.05847192783808189f,
+0.05806287116098972f,
+-0.004369037299568298f,
+-0.04349468913685991f,
+-0.011666090453587259f,
+-0.06423419060908259f,
+-0.04790382205657435f,
+-0.047476138769091326f,
+-0.06605923425610317f,
+-0.08104226571983243f,
+-0.012343925371349195f,
+-0.07114321710047719f,
+-0.028073297600178276f,
+-0.04644881028626087f,
+0.03406902691030074f,
+-0.058314775293515184f,
+-0.014302032560728394f,
+-0.016647989513715607f,
+0.022864272206959534f,
+-0.05277752786600711f,
+0.0043320995487587345f,
+-0.007141767825028041f,
+-0.022214076632552555f,
+-0.03757129388004899f,
+-0.0376785252395109f,
+0.0038348199835944105f,
+-0.029433520764371713f,
+0.04119945279959438f,
+0.020179397667319906f,
+0.017089652038427956f,
+-0.032357753740524756f,
+-0.02373969846448136f,
+-0.007079787007448442f,
+-9.847678489541545E-4f,
+0.019234655327062044f,
+-0.05433897604966886f,
+-0.050767925196831314f,
+-0.0567217945087556f,
+-0.05347576544332472f,
+0.0171170494602865f,
+-0.05078724677970489f,
+-0.015076073143619195f,
+-0.030379751146877538f,
+-0.061244795674401845f,
+-0.038091020991611206f,
+-0.03514919056049605f,
+-0.061866020362912694f,
+-0.02127636192028812f,
+-0.0721241839234125f,
+-0.03522649495385283f,
+-0.03490891636807941f,
+-0.0028747343698626144f,
+0.020905067844791604f,
+-0.017374684424257172f,
+0.0491909481670027f,
+0.027513628639472303f,
+-0.04739607226946191f,
+0.09188549050921622f,
+0.08381474025640785f,
+0.006677351752116402f,
+0.05924352463484781f,
+0.05381710704898666f,
+-0.03547853060144756f,
+-0.0730183889271682f,
+-0.046326011226159695f,
+0.08073558782190897f,
+0.003374006621209027f,
+-0.007348732858313164f,
+-0.03882632886991932f,
+-0.030061565476238852f,
+-0.03160462913147608f,
+-0.044481656488362574f,
+-0.07728061416120387f,
+0.0037330124446233216f,
+0.01879322354915591f,
+0.048058807178104054f,
+0.08266112305752038f,
+0.04526543667712681f,
+0.03971177429633543f,
+0.023103072500861403f,
+0.014592354224180941f,
+0.03827210903024501f,
+0.03700755556442373f,
+-0.04632484049059414f,
+-0.03649634663003607f,
+-0.01571710772248295f,
+-0.03802077131432067f,
+0.03485900406910957f,
+-0.007753940652783601f,
+-0.020818947676847926f,
+-0.02781780699184963f,
+0.019755330818474692f,
+0.024036939950299412f,
+0.03962926049078589f,
+0.04887659056608873f,
+-0.0646047055290148f,
+-5.014443945072896E-4f,
+0.045925011514488516f,
+0.041532460368095436f,
+0.04735988107705963f,
+0.06362778473647353f,
+0.09057278031074312f,
+0.058652421793348175f,
+0.06447407703743425f,
+0.09800200909003755f,
+0.028476505175232054f,
+-0.010076293983548151f,
+-0.034002722503161f,
+-0.0278916608493728f,
+-0.026060152436898115f,
+0.0036641924875022297f,
+-0.030227344628182367f,
+0.03415627935136438f,
+-0.01880899679673321f,
+-0.009065385389277137f,
+0.057137325110193836f,
+0.07220509683375491f,
+0.06137831874393375f,
+-0.022513488833726187f,
+0.05150397529078659f,
+0.04258139179631829f,
+0.053883756341893976f,
+0.047420923814902385f,
+0.05429221384439086f,
+0.046104292248654186f,
+0.06570231238045693f,
+0.05678459159239611f,
+0.08465721786946422f,
+0.0727836748481201f,
+0.05037560254407821f,
+0.033641142358501824f,
+-0.015624187928692404f,
+-5.51340602895596E-4f,
+0.09783570213317272f,
+-0.023325718341118632f,
+-0.007977583283598535f,
+-0.01326951445368309f,
+-0.06362978594895802f,
+-0.034846804922475334f,
+-0.007487254439409188f,
+-0.03544466578916607f,
+-0.0062370262162550275f,
+0.002602187133276143f,
+-0.020436505493727244f,
+-0.023496522354812893f,
+-0.03089946301728579f,
+-0.015064270774968535f,
+0.004394918510364035f,
+0.024959187034014105f,
+0.015382716213425211f,
+0.042545849808488835f,
+0.027916157082814325f,
+0.036070645957590915f,
+0.027745647367563867f,
+0.04887645114096407f,
+0.02741381524568974f,
+0.0668685886063833f,
+0.029738266208429735f,
+0.01659033330019099f,
+0.007074976363872501f,
+-0.01320752998018861f,
+-0.0069960055342197f,
+0.053150219839180224f,
+0.028555099136260448f,
+0.012690743701839974f,
+0.0070203651311574215f,
+-0.0038456825265310566f,
+-0.02011561730285461f,
+-0.022210128163545242f,
+0.01490443565808065f,
+0.002058329530726467f,
+0.027453239317060042f,
+0.018974139136866425f,
+0.01756820150116343f,
+-0.0072365597715203294f,
+-0.03699738753438178f,
+0.04975364881851881f,
+0.03111598577545405f,
+0.04309202557032709f,
+0.016956688905246396f,
+0.019977115545067103f,
+0.0253010824839262f,
+0.03419573746025433f,
+0.019544756869059567f,
+0.022624614670787555f,
+0.013753938040731512f,
+0.029173583922936203f,
+0.013333482144407835f,
+0.03613383758103249f,
+0.03903930803883627f,
+0.04635144781097358f,
+0.03594773512770843f,
+0.012417747077642788f,
+0.039820262339957196f,
+0.04544563393987076f,
+0.0087716303340873f,
+0.05856815891699551f,
+0.025320602141061785f,
+0.04837564347847174f,
+0.05126660850341336f,
+0.015620716769650676f,
+0.012501264181598973f,
+0.036380803199274205f,
+0.03259991941260677f,
+0.018334446716450216f,
+0.08443434003822246f,
+0.058490287730207195f,
+0.04399566973615661f,
+-0.0018267896145968217f,
+-0.052223094729212646f,
+-0.043760232185101645f,
+-0.047840282088789834f,
+-0.04901340771681348f,
+-0.029272916499260854f,
+-0.05050342184641798f,
+-0.03951512487771977f,
+0.12626344386955476f,
+0.10596008504660775f,
+0.064149313585366f,
+0.03096114201205629f,
+-0.041898001669759724f,
+-0.04866330134428434f,
+0.18080536055411225f,
+-0.059937675031759785f,
+0.04583672014106752f,
+0.05855159095196367f,
+0.06418122329594234f,
+0.0528812575259326f,
+0.07532803170918581f,
+0.05309336889280403f,
+0.04102337861093615f,
+0.04066479965812105f,
+0.05582861621414569f,
+0.051001688820723826f,
+0.05942111171295918f,
+0.046995464695278946f,
+0.09554712927422124f,
+0.08090944265091378f,
+0.04591124017921673f,
+0.025103188812446733f,
+-0.02870078386912269f,
+-0.03813182559492526f,
+-0.04620341632843284f,
+-0.08270613164163224f,
+-0.0442132455023816f,
+-0.05528271952864918f,
+0.013345669534844158f,
+0.017067913357331824f,
+0.07289865760056338f,
+0.024241613319915156f,
+0.013724736043555117f,
+0.053961177352624255f,
+-0.06356535969876943f,
+-0.07847143210048568f,
+-0.03232055082816688f,
+-0.043119831042946484f,
+0.04094886563149578f,
+-0.022194951868517464f,
+0.009699998238242122f,
+0.03825345528625408f,
+0.026965169646660347f,
+0.022519056498881463f,
+0.03365427549751735f,
+-0.046320053105276635f,
+-0.034252539215763676f,
+-0.05625256369961331f,
+-0.041594803333875205f,
+-0.015667484531964843f,
+-0.02296441671040103f,
+-0.048595256967999594f,
+-0.029425593713972492f,
+-0.039741423297137084f,
+0.02274662841094908f,
+0.014402977608943338f,
+0.02648479872945902f,
+-0.006140547407405092f,
+0.027129104641710783f,
+-0.03294316813948855f,
+-0.030210667707417073f,
+-0.036853852122818595f,
+0.009020799652558968f,
+-0.008208422578658827f,
+0.013823252551110807f,
+-0.021906344465158243f,
+-0.012987644159519482f,
+0.017493423411491776f,
+0.02738519892896237f,
+0.053889046991277424f,
+0.007951883595464245f,
+0.010488963447290072f,
+-0.05132010456120794f,
+0.011104472504080655f,
+0.05465354949522765f,
+-0.015871083275913203f,
+0.025633420696203134f,
+0.04235100927343539f,
+0.015569063743535328f,
+0.008811673429480412f,
+-0.011109400015843743f,
+-0.0036306357415500953f,
+0.04138968431885151f,
+-0.022595173721014584f,
+-0.004650418348978827f,
+-0.0019125816945030625f,
+-0.015339037845355879f,
+0.03416418212257788f,
+0.009727794680791785f,
+0.0010349422262152645f,
+-0.025060976190132016f,
+0.024310820417230632f,
+0.03810560569031143f,
+-0.001510330332598438f,
+0.12616103348523713f,
+0.06751812374659608f,
+0.007340829656927825f,
+0.11323798955506646f,
+0.03663425307296854f,
+0.08091314636663169f,
+0.05467945960103556f,
+0.010201338550905043f,
+0.03980172093810433f,
+0.04422207561503064f,
+0.05299126249461622f,
+0.09854198185704538f,
+0.08172795832824903f,
+0.08855808541659616f,
+0.05193740089986691f,
+0.06460203872958475f,
+0.002791485006238851f,
+0.019834300145797453f,
+-0.013992865537473198f,
+-0.022572514102215946f,
+0.02486421756761402f,
+0.019859464647367153f,
+0.017722100754102483f,
+0.04018586937592687f,
+0.01858149106716321f,
+0.02489010882480114f,
+0.02796155688847391f,
+0.053572308542632646f,
+-0.035700298844132124f,
+-0.04147851003154955f,
+-0.0032934261610068605f,
+-0.03383005765596558f,
+-0.03821012824058713f,
+0.017210579348190334f,
+-0.0052887123367731294f,
+0.019883586013478963f,
+-0.03204793452855613f,
+-0.007607993834786281f,
+-0.0462100543268485f,
+-0.03241134453853386f,
+-0.023133303594425576f,
+0.01529604262277411f,
+0.011251018550365931f,
+-0.013902863471270191f,
+0.02185110126219133f,
+-0.012577196146530556f,
+-0.028982900762336332f,
+-0.02907537562712478f,
+-0.005003076941779314f,
+-0.08748797013450005f,
+-0.049339951054084716f,
+0.0030344668015961705f,
+0.008288345995431925f,
+-0.06813030739819861f,
+-0.05622026560634024f,
+-0.03735947554108809f,
+-0.05017569648305658f,
+0.03931986517712213f,
+0.007267767221376991f,
+-0.03855337016332199f,
+-0.025368993813374655f,
+-0.0010272193756863683f,
+0.008260384791855372f,
+0.0010455674861538753f,
+-0.02279572319420591f,
+-0.006119239073604253f,
+-0.03716126478398527f,
+-0.019835593289771462f,
+0.010104616130191391f,
+-0.024711314150175353f,
+-0.021995722024815423f,
+-0.041776854706797865f,
+0.0023347336146059875f,
+-0.06430195100224198f,
+0.04597663275271223f,
+-0.026122323322902277f,
+-0.04182701700259763f,
+0.08083553490932885f,
+-0.005723940448104608f,
+-0.0458257505387525f,
+0.09289010246878596f,
+1.252818550726806E-4f,
+-0.02285909608092597f,
+-0.011517636124519243f,
+0.03225510137995382f,
+0.00917781809467497f,
+-0.02701946133010099f,
+0.05087557924165699f,
+0.048945844645351726f,
+0.0222789830035091f,
+0.03512657353743509f,
+-9.766761891753682E-4f,
+0.008961989735083147f,
+-0.006542078258807564f,
+-0.027568570164724263f,
+0.005836989045884744f,
+-0.027317060228472072f,
+-0.04234963763238233f,
+-0.03633649340428962f,
+-0.05153747901775723f,
+-0.005867774423626416f,
+0.04142621026168701f,
+0.010714708297296078f,
+0.002100304155894238f,
+0.0449319581506138f,
+-0.02975983077565631f,
+0.03573961000026774f,
+0.022214165106938615f,
+0.03741785066261834f,
+0.029051170834690308f,
+0.04613188530294165f,
+0.016517403517889252f,
+-0.01573729742808912f,
+-0.0020022788577150055f,
+0.03188160248576958f,
+0.03726649482140757f,
+0.012566908594202978f,
+-0.013908144982858597f,
+0.006722295198325225f,
+0.03584593087261663f,
+-0.007171222473391572f,
+0.02843171406498146f,
+0.055419387186744135f,
+-0.031751584100460604f,
+-0.02854640469077387f,
+-0.021451685841063866f,
+-0.0034948023971093597f,
+-0.0038596213547673758f,
+0.05118565091502217f,
+0.01980294706099186f,
+0.0296977107969931f,
+0.04079819045384915f,
+-0.009458502092790751f,
+0.020952131020357753f,
+-7.176003457410586E-4f,
+0.008457762585549982f,
+0.0012549461130460363f,
+0.03800431705223756f,
+0.01398027274311412f,
+0.03566796333710245f,
+0.020041600303011345f,
+0.047715414401100345f,
+0.030045178301504574f,
+0.03239344141728169f,
+0.028545343381191718f,
+0.05288344863436481f,
+0.018209223447133428f,
+0.010628901378837636f,
+0.046522656016439116f,
+0.0791140376075904f,
+0.04202076356992625f,
+-0.014636915944464136f,
+0.06917006756196778f,
+-0.011094727135906746f,
+-2.838132381874041E-4f,
+-0.03591828794248421f,
+-0.008547971356920626f,
+0.009421361424930014f,
+0.020755443730262908f,
+0.10534699107550174f,
+0.021862244572765945f,
+0.07113836984738646f,
+0.031096213543710165f,
+0.06107554830345548f,
+0.042229985397844616f,
+-0.01781284710187362f,
+-0.004061716885902599f,
+-0.009384489538467435f,
+-0.013474928377567476f,
+-0.03656648970345727f,
+-0.03633907127849818f,
+0.0017344516138185534f,
+0.022414160222360226f,
+-0.04042393990378021f,
+-0.06032417792926133f,
+-0.04681391486853574f,
+0.005097843666281454f,
+-0.002691132671156104f,
+-0.019326107597130767f,
+-0.057892891019431576f,
+-0.01744537426093878f,
+};
+
+static const float gFeatureDataV[1231][10] = {
+{ 0.004840715912585551f, -0.010424259813660679f, 0.0059812353285258425f, 0.009950242154963918f, -5.125161279501135E-4f, 6.53493015802173E-4f, 0.0021519409202473668f, -0.0161208644898635f, 0.009168471663835994f, 0.0021978299562927725f },
+{ -0.010338765311749869f, -3.35863021000052E-4f, 0.0033766700191334496f, 0.0076306230916654075f, -0.01362343660382321f, 0.01907254836965299f, 0.008484914609284301f, -0.018942130473330127f, 0.010609160494305186f, 0.008645858843534674f },
+{ 0.10798716399297975f, 0.11203297124933127f, 0.10779697569356121f, -0.11647907809343662f, 0.10059793293498787f, 0.10387495072473363f, -0.021237796425719397f, -0.042187151163773286f, -0.20667227494855062f, 0.14498195754880275f },
+{ -0.019784705393618058f, 0.007367937068515709f, 0.019402025518050106f, -0.03323192319557583f, -0.011014449885554719f, 0.04427192106450429f, 0.001263008389385975f, 0.015066363573151957f, 0.009145426604221008f, -0.007315588899645081f },
+{ -0.012839952428633108f, 0.009918754818595313f, -0.008164074486497553f, 0.006422180765041738f, -0.010327946799604167f, 0.01518210214467495f, -0.008680326514448949f, -0.00296383308755184f, 0.010469671195648912f, 0.01642515921225322f },
+{ -0.11359880147012329f, -0.04434842571514103f, 0.01855766098444471f, 0.17074394534675588f, -0.1041110026168367f, 0.007301382132389278f, 0.014594224902176527f, 0.0764114366528255f, 0.03508620377861354f, 0.0010747887823789552f },
+{ -0.023474044866424695f, 0.08047447049571493f, -0.033780809790023215f, 0.027397251535087586f, 0.02260458363594278f, -0.006040266775986433f, -0.02992475229035604f, -0.05826894068528439f, 0.10384806823285192f, 0.03793419017152103f },
+{ -0.006724314183155895f, -0.003252329798426285f, 0.013626097912670151f, -0.03362663669032102f, -0.06067748706639167f, 0.020632807159932806f, -0.0014550734991603035f, 0.03239439189971242f, -0.0058410276795799725f, 0.04110518569670427f },
+{ 0.09230303886906643f, -0.05826289181399044f, 0.03796991314127315f, 0.06711974866436407f, -0.047063363466511625f, -0.06738718915723689f, -0.06582515706379588f, -0.09288972458584642f, -0.11082744746914087f, -0.043833855774433175f },
+{ -0.015010472018814936f, -0.02654616599199026f, -0.0452247338461454f, 1.2906067221907073E-4f, 0.1163788722107306f, -0.041323639683188404f, 0.10011223079027003f, -0.014287177014378035f, 0.020993302208776137f, -0.056686292280804566f },
+{ -0.073522570702932f, 0.07905934832499868f, -0.061653596928390224f, 0.09326090982079394f, 0.07218380024114156f, 0.04526089787305425f, 0.03035798651317862f, 0.1278039971189991f, 0.03711177430340277f, -0.11344777886113161f },
+{ 0.007468031905761105f, -0.009131678713306387f, -0.011254317623421405f, 0.010209191693946395f, -5.837032180734371E-4f, 0.0039380793555975355f, 0.013388946011754006f, 0.014305382342455316f, 0.01226271807029128f, -0.03962466274223709f },
+{ 0.0025081714170067547f, 0.002582960596150814f, -0.018224821461316414f, 0.029616598660067217f, -0.02669931727991623f, 0.009006994357450154f, 0.008423983423874291f, 0.007106966362633942f, 0.010034380615367799f, 0.010969172077802233f },
+{ -0.027483295336835176f, 0.023066024155990784f, -0.012610137040216964f, 0.06346709361223617f, 0.019715156768559065f, 0.05303118808338145f, 0.0012548054497634822f, 0.008288560735027617f, -0.011781044710324139f, -0.03616580740515764f },
+{ -0.01892136033069443f, 0.02448935447160605f, -0.002308777961420247f, 0.014470918918398652f, 6.336740919575799E-4f, -0.013805326667938357f, 0.016183062144723735f, 0.051027092767571f, -0.013428498616621676f, 0.003661265587923731f },
+{ -0.03146362454927564f, -0.01468365384838675f, -0.05493895262913416f, 0.004746042303585347f, -0.017910575066576243f, -9.27019026300079E-4f, -0.046011114313462435f, 0.01846107807083994f, 0.029278443429557408f, -0.011153629519514277f },
+{ 6.417858129128295E-4f, -0.05581521895701492f, -0.047672387948935725f, 0.024491216536890358f, 0.09325097325880494f, -0.08843058045958642f, -0.028007180669477803f, -0.10183716025225478f, 0.03408721923552825f, 0.006559995962196028f },
+{ -0.11017662217184307f, 0.11611471654950442f, -0.03455239765791468f, 0.05700128434697541f, -0.057627115286276974f, 0.11160278138796485f, -0.009432150142752957f, 0.10282365057777137f, -0.09433659101547828f, -0.05910417192654762f },
+{ 2.075676761861273E-4f, -0.050205995851656214f, -0.06430039504389481f, -0.03424127293031972f, 0.08394974885194312f, 0.0271655608504779f, 0.030543832653898238f, 0.006922535724244048f, 0.02331268876252788f, -0.10661169472008518f },
+{ -0.09549298653265458f, -0.12227607143082553f, -0.028958835940105458f, -0.02574369058058839f, 0.05657076059625528f, -0.0382846245048178f, -0.011009521978665941f, 0.08928528298250174f, -0.18128872116346226f, 0.02366431041008819f },
+{ -0.01755325956113324f, 0.02338126272889981f, -0.015396305542935536f, -0.001746932413170419f, 0.05135153124975171f, 0.022183003297107f, -0.014754709963085647f, -0.03034553943682112f, 0.004109709858628021f, 7.434303337009901E-4f },
+{ 0.007461222473019564f, -0.057386757636113575f, -0.0012692320578434537f, -0.10604302544654695f, 0.08750625238746429f, -0.04184289685397028f, 0.07458602725568612f, -0.13100036218409492f, 0.029971629082835582f, 0.03973434105512041f },
+{ -1.4763518964024943E-4f, -0.0048989199831086785f, -0.022329787677114056f, 0.008452557626562116f, -0.024100324046707453f, -0.03866374178662231f, 0.052022461844087514f, -0.030197753004690773f, 0.006416189468251116f, -0.023768977427006573f },
+{ -0.01434297667928312f, 0.05342440087360056f, -0.0280923042453874f, -0.08643106446277596f, 0.032242340683489946f, 0.024058577994084118f, -0.054455402975603945f, 0.022235173268490723f, -0.04367278947922603f, -0.06329022359058968f },
+{ 0.021593859903974073f, -0.008643367220184035f, 0.016484211775859927f, 0.008534760317754688f, 0.02692883574964557f, -0.007167642362216809f, -0.026924696697407977f, -0.015330212921022213f, 0.03361705616302292f, 0.035985238910469904f },
+{ 0.023433456184248965f, -0.037632380989227575f, -0.002636427158339785f, 0.03007317383388743f, -0.0024339195556994327f, -0.013323706764567055f, 0.043754213602743765f, -0.032341536038448956f, 0.03731936716126459f, 0.04659292182870834f },
+{ 0.01388700491629974f, -0.129266273721562f, -0.027309822797932797f, 0.05583918737284816f, -0.15686423352030807f, -0.013730871056341827f, -0.0671475201458623f, 0.22281278708242608f, 0.1288870755289351f, -0.057571729899116277f },
+{ -0.12396097522774989f, -0.04838759792709876f, 0.1846169351088827f, -0.20058408669579317f, -0.2863033617873776f, 0.11828485878184851f, 0.055780754979091664f, 0.1722194044582421f, 0.04286454271900498f, -0.058582732267537185f },
+{ -0.08157428674779649f, -0.04308799110044339f, -0.04556096183143208f, 0.0304014471545683f, -0.0803537712865659f, 0.004944791429559958f, 0.008277511566194364f, 0.14253244810695126f, -0.07012746064997481f, -0.011763698289032466f },
+{ -0.052681399311137876f, 0.023486985849777913f, 0.03728748891584511f, 0.011526093889870416f, -0.08507878737412267f, 0.11850427759584169f, 0.054097552146572796f, 0.07024161678081361f, -0.03749806204017421f, 0.003752305537631553f },
+{ -0.03144890030537811f, 0.04232178381826858f, -0.02245168939837177f, 0.055011955336744814f, -0.06630047258540779f, -0.01334203375399589f, 0.01347386465125624f, 0.08133543374429585f, -0.08291660529556422f, 0.01249885386138512f },
+{ -0.025910519113230435f, -0.005961026766133367f, -0.03702737373406245f, 0.057227501477663055f, -0.05145323201085645f, -0.03848788210527203f, -0.027531820784143797f, 0.07630745144491581f, -0.05230596588525663f, 0.0017765534295099761f },
+{ -0.012706292875331834f, 0.03771308320137129f, -0.018863217936442318f, 0.019912473986506012f, -0.04022201211872985f, -0.01960553551109748f, -0.009253933626786016f, -0.0010809715203438128f, -0.0513255000094462f, 0.016348355853736417f },
+{ -0.006096519701549444f, 0.02940965275240204f, -0.02797170069241402f, 0.008981558696687555f, -0.025964937192590475f, -0.013334642264588104f, -0.0014128229486138572f, 0.011819272741893162f, -0.056311148403075884f, 0.008560383706224778f },
+{ -0.027479316239760614f, 0.027766131122403982f, -0.025563916541046408f, 0.03499311711811649f, -0.045436828870847275f, -0.018599008733045555f, -0.003508675949482729f, 0.027944253122715125f, -0.07872718278277437f, 0.01461608975722409f },
+{ 0.007300513651403705f, 0.023557298671858025f, -0.0639704906633368f, 0.017089360423346255f, -0.05741240915794585f, 0.034111391333128564f, 0.006876412183445497f, 0.01812504459594891f, -0.08247406338395809f, 0.04376989279325289f },
+{ 7.906141458596492E-4f, 0.017306247148876436f, -0.020839462425065562f, 0.010923812373703847f, -0.015207221542593307f, -0.007499535734456249f, 5.221003208460765E-4f, -0.020575854726556563f, -0.029689551778723088f, 0.007755641923008345f },
+{ 8.800705916096845E-4f, 0.013122550043157244f, -0.011316478084626661f, 0.0010947659053241782f, -0.005866342674291632f, -0.008013814065932942f, -0.0022297891167167884f, -0.014161009562921411f, -0.03634823847941082f, -0.0026322988548990564f },
+{ -0.0015594447270463488f, 0.02285670999345614f, -0.02182899542993637f, 0.008754617786611222f, -0.020152581348572094f, -0.009555697481116844f, -0.0012752653762630665f, -0.007214780128129486f, -0.042450130184513046f, 0.004359077579141321f },
+{ 0.0022578958441132045f, 0.013528453530394063f, -0.018834321791436133f, 0.011413879518634316f, -0.012386623962980105f, -0.009127997674126259f, -2.4628723366892593E-4f, -0.015123332496832072f, -0.03516871155078311f, 0.005915193858765522f },
+{ -0.029143143946125348f, -0.02022298550146421f, -0.003767438855227278f, -0.006834750366944501f, -0.001490649938359261f, 0.008501971665653047f, 0.01843190277955293f, 0.03603791949001696f, 0.006145360779113928f, -0.02591672250927549f },
+{ 0.15665059678688847f, -0.037016887220412714f, 0.05309805901356322f, 0.0944600638910404f, -0.0013313099964387903f, -0.0380706769811365f, 0.0777921882684548f, 0.04611209538360044f, -0.14396032277072374f, -0.05799911523816532f },
+{ -0.002502189402181228f, 0.0131147559127856f, -0.011016965952730624f, 0.0035871867680929877f, -0.0024357158797430126f, -0.014092274218910055f, 0.005492514051061372f, -0.010997909167213988f, -0.02410729623702821f, -0.003003968241731374f },
+{ -0.0013907513636524582f, 0.018121605568565593f, -0.005988987929085254f, 0.0029090182973817193f, -0.004091485361797661f, -0.01001638480095782f, 0.009376086227239766f, -0.026532879696153474f, -0.01771536143949828f, -0.004871460836565394f },
+{ -0.031123791701898947f, 0.004770111650326629f, -0.0815750785673882f, 0.056319450847280295f, -0.05128616868779751f, -0.0436899354556534f, -0.0349131643173875f, -0.010310965105196038f, -0.05096725043042794f, 0.037174872230475435f },
+{ -0.009035371605100945f, 0.03565292664307223f, -0.020863823048539298f, 0.03800482037222116f, -7.930561961398882E-4f, -0.033289762016906733f, -0.009469798710702852f, -0.03392514183526299f, -0.0484782874647561f, 0.011208551667324011f },
+{ -0.09254961823282669f, 0.04281296860470068f, -0.0662695467768093f, 0.029264286750066915f, 0.004427129215504747f, -0.06945890919611487f, 0.04677403504592575f, 0.10142139466942061f, -0.021078616618601685f, 0.14325126449667225f },
+{ -0.009738817019927421f, 0.023573427893761798f, -0.025810591603159613f, 0.055876820092863204f, 0.024952549087554034f, -0.04579480159440948f, -0.010493006288093135f, 0.06811990489759479f, -0.08093035642532966f, 0.024437584905575786f },
+{ -0.0073547919149859675f, 0.006094661975559454f, 6.125105431234477E-5f, 0.0169163696215306f, 0.0066474400558060405f, -0.02466018381903369f, -6.415804899199798E-4f, -0.02028643336965927f, 4.92376991859528E-4f, -0.006067163766863213f },
+{ 0.0157612766390277f, 0.005415241935558493f, -0.01643997625947701f, 0.016832111135246998f, -0.008261519064768193f, -0.032111494004080435f, 0.005441746234206574f, -0.04766006843399971f, -0.01327012503890087f, -0.004650049897667436f },
+{ -2.813529146854773E-4f, 0.02494883727719566f, -0.009527598751151303f, 0.015232853608704121f, 0.0026267616959645274f, -0.027808335859523404f, -0.011765144301250453f, -0.03886981640480687f, -0.015328751359179427f, -0.0020848201407603034f },
+{ -0.009158360303161122f, 0.015292794268619996f, -0.023656311813285414f, 0.03722796526386252f, -0.018957086492330813f, -0.06050215903938439f, -0.008913881030336322f, -0.04085076116138853f, -0.02428845860342565f, -0.006862036214859405f },
+{ 0.002717278735357667f, -0.004564720272466145f, 0.005663626832812079f, 0.007892262694887039f, -3.2983362377303493E-4f, -0.004956814352922836f, 0.004127424206856515f, 0.003280396327210475f, 0.007511980971849896f, -0.010079082262097618f },
+{ -0.007683273640347369f, 0.003057448268794101f, 0.006841402115589882f, 0.011300601362704405f, -0.001565266062251232f, -0.022002302545963186f, 0.006607308500559987f, -0.007651758120766877f, 0.012326609552803283f, -0.012058627336949436f },
+{ -0.007602395827800724f, 0.001969039882657404f, 0.008084227765217571f, 0.0031291750120329667f, -0.007626204414078349f, -0.028808027733885796f, 0.002322692537363608f, -0.011390386492031253f, -5.164693590510961E-4f, -0.011888249479685566f },
+{ -0.007398380834285504f, 0.012329292630811632f, 0.0038939672551709997f, 0.019781598417032354f, -3.0765053390281055E-4f, -0.019897724275021813f, 0.0019714434645748576f, -0.01913030842834288f, -6.466066598690746E-4f, -0.006060951271927754f },
+{ 0.0030295503944445783f, 0.003476064360702395f, 5.891448353572955E-4f, 1.431587761048183E-4f, -0.0028378405315416235f, -0.004192592705696569f, -0.0018077608035133718f, 0.013270091509228199f, 0.007651094512933352f, -0.0053744208881054455f },
+{ -0.006008282408024337f, -0.007058771739399252f, -0.004712931031685336f, 0.0060368766818799015f, -0.009238265137611572f, -0.0019331675576604898f, -1.6608943183174914E-4f, -0.0026768585984249605f, 0.009715263323866071f, -0.005242928358498017f },
+{ 0.004330611943024018f, 5.474782103498595E-4f, -0.0074463198349474435f, 0.005191079732966096f, 1.426240557871542E-4f, -0.013516271175484689f, 0.004131984946081289f, -8.531292408167924E-4f, 0.0092606577820419f, -0.0038689833455031824f },
+{ -0.06310060414912891f, -0.07182518298760837f, -0.056824533994293755f, 0.07072753387232301f, 0.002218725892875211f, 0.07564042746647766f, 0.046729024471736214f, -0.07586099399001246f, -0.056248113293234626f, -0.0842137250204712f },
+{ 0.04617973798332657f, 0.07350708148311985f, 0.0939489982014583f, 0.21700956559964146f, -0.24329105727024614f, 0.09071526134060307f, -0.3379450443822772f, -0.052961642739861044f, -0.2679287334160111f, 0.3492681963694394f },
+{ -0.04258524889739602f, 0.08528582649446576f, -0.10037941056525881f, 0.028447304318857596f, 0.15427122576735794f, -0.05513705814674709f, -0.03731716575537335f, -0.005558405442857615f, 0.0363389193261474f, 0.060347934850758775f },
+{ 0.012448850679364442f, 0.01310189888084014f, -0.025036849479305415f, -0.01349523985723958f, -0.0076952609566971805f, -0.015542633357230096f, -0.0073306321991569124f, 0.004371857308795489f, -0.01522092187722233f, 0.007975374872821421f },
+{ 0.06879626340073848f, 0.005417572096549315f, 0.05597804328924214f, 0.05398995065082583f, -0.040237735286289725f, 0.029289935670123578f, -0.09095080765315611f, -0.08114516201080005f, 0.016295832013242702f, 0.016905776280101127f },
+{ 0.03918315519771642f, -0.007393664273614849f, 0.023544623620889302f, -0.03791474890947383f, 0.007851957844906571f, 0.036813438133226774f, -0.04275148430724421f, -0.07119671497705073f, -0.0035396341524973644f, -0.01068232676494611f },
+{ 0.027503081256229498f, 4.4144892994064906E-4f, -0.02821559307467891f, 0.0811389540650771f, -0.019838175163991358f, 0.06281681894847507f, -0.07182212709498914f, -0.013262146417885373f, 0.04059835775193592f, -0.01346680611342608f },
+{ 0.00268587959001957f, -3.239974351677676E-4f, 0.006671493241232835f, -0.0023224952601265344f, 0.008119154035345464f, -0.006140057351595654f, 0.016368018481842037f, 0.006027757816397986f, -0.0029611306261522036f, 0.0034715320526094505f },
+{ 0.027617403588858332f, -0.01578360529962783f, 0.056878735420619476f, -0.06016983489956437f, -0.13558079956554617f, 0.004188954829187729f, 0.09749009640996087f, 0.11741632150906367f, 0.03394945764374947f, -0.055718212998141455f },
+{ -0.0368906826575262f, 0.06213116707418468f, 0.06958944914028364f, 0.031013840016681088f, -0.008892240562294049f, 0.05402000489176009f, -0.02378831357274612f, 0.008676903805706482f, -0.029055095108860087f, 0.0820910115726149f },
+{ -0.0338227204787279f, 0.05121878859461879f, -0.01892896217894527f, -0.013981194040680421f, 0.15337730613828562f, -0.009209902219608514f, -0.03597955717364012f, -0.15129699577967648f, -0.036819737322729626f, 0.08149177889731453f },
+{ -0.02631876224037716f, 0.016013133107152775f, -0.03006283478250471f, -0.054393455491551494f, 0.04575389123416487f, -0.018184261149391135f, 0.014846651930769353f, -0.025106228279225797f, 0.049282221843304136f, -0.012674469108042955f },
+{ 0.07995169241944083f, -0.076148676956392f, -0.1717649782049536f, -0.04419480461461312f, -0.04369050652523708f, 0.14634283190050165f, 0.07562134300474732f, -0.05358088065791901f, -0.018355489245334755f, 0.05982583225946031f },
+{ -0.0050901574680889666f, -0.002082898248366459f, 0.01687120110708151f, -0.014247738593485703f, 0.0012495452306857423f, -0.05196635077550295f, -0.013195742271337924f, -0.02703988877658249f, 0.017939005207633234f, -0.010207504184613971f },
+{ 0.0012274465193703931f, 0.009339033590928162f, 0.02284696024085891f, 0.001072647975933767f, 0.022439584159986897f, -0.020585867899086577f, -0.012315381811975896f, -0.013218021439278195f, 0.0025337996920064025f, -0.006937198843782624f },
+{ 0.016590457981491332f, 0.0047513107814671f, 0.008920835923898638f, -0.008040758274921938f, 0.04080269897742824f, -0.007921277232769385f, -0.00818900188250179f, -0.008680494976511932f, 0.009428314548865425f, 0.014479732135724803f },
+{ -0.024308018061177508f, -0.014140703954750797f, 0.0858842539924878f, -0.09581980787495427f, -0.09414683273806337f, 0.029139758737496944f, 0.05388279361524293f, 0.09815526281243071f, 0.014163826460895857f, -0.01199485376391986f },
+{ 0.03635847122411571f, 0.06243112197589677f, 0.038471567873040576f, -0.020690801582952133f, 0.01432541080111688f, 0.06330925459299569f, 0.03797791722854376f, -0.017940610792104683f, -0.06450738086563276f, -0.0405507020734416f },
+{ -0.03175397548825186f, 0.0011726327903677728f, -0.033578343680142834f, 0.053525573812971884f, 0.025534168958193063f, 0.014442816930062274f, 0.005850858169673108f, 0.036646272683929094f, 0.03219053906434306f, -0.02802445210256789f },
+{ -0.08852305670670771f, 0.006016092406665344f, -0.03558853285613965f, 0.02166101312625371f, -0.0337284796578415f, -0.06628064335151605f, 0.03432853439180079f, -0.05662531425688032f, 0.0029456184295019484f, -0.02730391135865791f },
+{ 0.023250947398655082f, 0.01788478915171793f, -0.021402788690528658f, 0.0024197559694033445f, 0.008762065954423278f, -0.017195179649821587f, -0.016936737667706123f, -0.006174820492530332f, 0.023107456712527466f, 0.02338188867384164f },
+{ 0.009084144044970127f, 0.01784249337073073f, -0.016539547102938628f, 0.026144305686809855f, -0.00570771264502797f, -0.022481253670805827f, 0.006916596359601718f, -0.017771142756057873f, 0.007302357124270397f, 0.030223780740140965f },
+{ 0.015422691286989958f, 0.02139860114998968f, -0.014039735359346587f, -0.026427073015441005f, 0.04491316589385186f, 0.001183324249820479f, -0.011212198979833828f, -0.01117121079029774f, 0.028147788419489454f, -0.0012342534076795325f },
+{ 0.010908758949214586f, 0.015973137322102215f, -0.012915474803828741f, -0.015392951558902494f, 0.021774422726898803f, -0.016377341333015466f, -0.01610881649916343f, -0.0041238808395806835f, 0.036573109582352756f, 0.01908150173478531f },
+{ 0.00813359801027486f, 0.009178224256132027f, 0.00402063372186461f, 4.582053450626692E-4f, 0.024745084591169527f, -0.009958973439398286f, -0.013805990422484928f, -0.01155193756811101f, 0.018157831382348718f, 0.012394481971442198f },
+{ 0.00195503963582951f, 0.009372955406512196f, 0.0028629196706923647f, -0.0040640061623453665f, 0.02096087168417585f, -0.001478485771426582f, -0.002867633787901785f, -0.007284729262346181f, 0.012140001063370298f, -0.0023607356749006897f },
+{ 0.02546298419173118f, -0.01777588513868456f, -3.836880273010837E-4f, 0.05737036435245619f, -0.06576199083289291f, -0.05493555556575915f, 0.06670242323873575f, -0.05670942515192391f, -0.03414022484473222f, 0.021313066687233474f },
+{ 0.013510112805704275f, 0.004630469686494732f, -0.004308303767466562f, -6.164318122431926E-4f, 0.016379855968823638f, -0.0016603369701549762f, 0.0045450159465763645f, -0.0039279907876342f, 0.022240073418187546f, 0.009814295883235725f },
+{ -0.028344434296106138f, -0.1666779785537561f, 0.19922081714025452f, 0.012526530447015119f, 0.026906430899372558f, 0.10192009673406062f, -0.027673399156688438f, -0.10623273800109927f, -0.05066444640470585f, -0.10034011989923004f },
+{ -0.049237273303516085f, -0.1529527968948011f, 0.14565568253914166f, 3.960479689086749E-4f, 0.040616944028934135f, 0.11500472009438369f, -0.04917482552597431f, -0.060380778670592855f, -0.02494848227654664f, -0.05228350677536861f },
+{ 0.0061271854288091855f, -0.001101307968536875f, -0.025765000372917193f, 0.007253228884012156f, -0.02081034907577957f, 0.015846400631000245f, -0.007057636859397132f, -0.07658567878971646f, -0.035312140651168465f, 0.030057754188420684f },
+{ 0.021956427659625476f, -0.08181388923403744f, 0.10950995008670555f, 0.009052016444960367f, -0.025395971530678938f, 0.012705138072838186f, -0.0139467861805697f, -0.046956343370349575f, -0.034822920453689586f, -0.04019493020919825f },
+{ -0.014064028122470425f, -0.009381026853158173f, 0.0027833024286868188f, -0.03230173018867639f, 0.05158134599720102f, 0.025312863801242425f, -0.028798552824233783f, 0.0011995572278911929f, 0.019464365726675273f, -0.01737734747578318f },
+{ 0.001358791834860318f, 0.006624897407321627f, -0.006443782971349938f, -0.02665793294822965f, 0.056557570271300484f, 0.0068882758332909f, -0.017729579109541017f, -0.004800490085774379f, 0.03251863711287613f, -0.015335917337756121f },
+{ -0.025238549201320074f, -0.10819552799768026f, 0.0945902711924579f, -0.020383840570165256f, 0.037038887044930066f, 0.09460383986574727f, -0.048994132711175996f, -0.03179734947491452f, -0.010064717787844376f, -0.03540001169854355f },
+{ -0.02395111026403576f, -0.04982881611524122f, 0.04675958226269778f, -0.038970436921136324f, 0.03747735365196854f, 0.060053448216001344f, -0.031759752912533475f, -0.002686136076577915f, -9.79584662714763E-4f, -0.04034040470385451f },
+{ -0.044074974068796985f, -0.01287200443397828f, 0.06052644282372529f, 0.01763508111183071f, -0.004951069266599835f, -0.06950983150325955f, 0.021141740806724065f, -0.024008528977452377f, 0.04139157871547639f, -0.020845959445164507f },
+{ -0.03170512000686905f, 0.02128816526162481f, 0.0281905454255157f, 0.005403861616132328f, 0.03931808741754621f, -0.058818864198896155f, -0.0032644020879073125f, 0.007815370155892037f, 0.005306495979820553f, -0.01772977326703128f },
+{ -0.0069238845053878045f, -0.007697253378960143f, 0.03214163147617953f, 0.0016061541006013444f, 0.021236462241221825f, -0.0299340311183964f, 0.0031172375289524917f, -0.042421244279088145f, 0.01956666365150667f, -0.02137742708996365f },
+{ -0.023433835833665595f, 0.008961115404125334f, 0.019135815439642302f, 0.016270340665998938f, -0.015519348623182992f, -0.03423642484615157f, 0.008175395365033712f, 0.016768140285143108f, 9.168459370466858E-4f, -0.012519560491203386f },
+{ -0.002477846514524583f, 0.004128906706235404f, 0.016462428347038423f, 0.010638185601205687f, 0.01312812938244654f, -0.03557263074837529f, -0.014596191478909157f, -0.04905613267770856f, -9.826445721767855E-4f, -0.011582475338460905f },
+{ -0.00795537927889383f, 0.011264526812216074f, 0.0034145850887470986f, 0.0026899419297197052f, 0.0016827631286079829f, -0.031938380937931915f, 0.002255193815993162f, -0.05101613203264894f, -0.0038444871480957207f, -0.006537032641058816f },
+{ 0.0025249597225149895f, -0.004279581302818278f, 0.003202957069223109f, 0.006426173175243278f, 0.024213128117294584f, -0.021007979775503536f, -0.016160565052085865f, -0.04227542920146101f, 0.017056267704712913f, -0.007157586873371011f },
+{ -0.004608792071177397f, 0.009872316220252085f, 0.01796313521041846f, -0.006330006412311906f, 0.013549489839796876f, 0.009346628269975666f, 0.004556704274823527f, -0.03505479688709662f, 0.015056216443784364f, -0.0021796820694830617f },
+{ -0.008946212175908881f, 0.001058723117277628f, -0.006055178858866389f, -0.012564829047006912f, 0.025058048575573737f, 0.0033611894928032076f, -0.014013567106373569f, -0.035188741541880446f, 0.03184362988105283f, -0.00999460523358618f },
+{ 0.016726174260010898f, -0.014718291475431772f, -0.01454977269958031f, -0.008404444237221843f, -0.003840650920064367f, 0.010975056052456467f, 0.003138245241435895f, -0.011789599383878585f, -0.013338078549126341f, 0.015427144562359307f },
+{ 0.00639736144782126f, -0.00338196871926818f, -0.014810940361565694f, -0.011772898068572835f, -0.021448165374704682f, 0.025466412119689596f, 0.003265640910073852f, 0.004423511558657608f, -0.022916597937971957f, 0.008543380646644384f },
+{ 0.009062766524132718f, 0.0033530594640636606f, -0.008707174071122077f, -7.390907616353E-4f, -0.011858884422108206f, 0.0034653161941301503f, 0.003726100617765449f, -0.004833082950923716f, 0.0034961342999984824f, 0.00412932644171811f },
+{ 0.00502463130611962f, -0.028858566622601584f, -4.711299890530796E-4f, -0.00202504696581882f, 0.006997739641720102f, -0.012275214614393288f, 0.0070910630398634f, -0.039318331859239275f, 0.02015753195445479f, 0.0018413108849128185f },
+{ 0.008394556274970683f, -0.01742507148145126f, -0.03655054201125849f, -0.0061585706175161905f, -0.0031475954367964263f, 0.028521122374301225f, 0.010332233606021644f, -0.01233060977397886f, 0.0032586273151296663f, 0.010041551169956075f },
+{ -0.044902696135994014f, -0.0032168397295054335f, 0.07243649860093845f, 0.03798744859103776f, 0.02910293472375091f, -0.09739374658396771f, 0.006288668498431302f, -0.016268445836956677f, 0.02250010393793195f, -0.03975448646365503f },
+{ -0.032005080283938364f, -0.01089293728158476f, 0.04693094620223364f, 0.03111445458829837f, 0.017297808685198493f, -0.07165543668041748f, -0.013615182843439133f, 0.0018955854380033972f, 0.035425192983181565f, -0.0304018879289234f },
+{ 0.11541385906096668f, -0.042078546847626255f, 0.059407493612186606f, 0.019478561940501297f, -0.0050135455720252825f, -0.001475943606173596f, -0.01840845408698924f, 0.03575348430287433f, -0.040507511306124164f, -0.07150631335006323f },
+{ -0.023272253584217764f, -0.012035706337021607f, -0.005966828962485815f, -0.007514639242027941f, 0.0064340920559106075f, 0.033990390618123686f, -0.004519113034842216f, 0.006142895795119186f, 0.0176743447142027f, 0.002870208421355809f },
+{ 0.01627694805756693f, 0.0010837282186064142f, -0.009880750903854924f, 0.0026453077734665807f, 0.05766447763038933f, -0.025173548539473442f, 0.0013182189553251657f, -0.04203493964592463f, 0.020614576359706996f, 0.010249281848141107f },
+{ -0.012648421182879281f, 0.02888936566211332f, 0.008184257285959975f, -0.007675330697314366f, 0.024450223881244824f, 0.017804012646304847f, 0.015582751008548576f, 0.030417377931215798f, -0.054646067690919495f, 0.019675640634040044f },
+{ 0.009139612393642822f, -0.015315217019413569f, -0.014751557189027788f, 0.04399637037864256f, -0.0661116410022208f, 0.002356673493666091f, -0.06717022336913915f, 0.029663586044155758f, 0.020578094924761484f, -0.03167129697965925f },
+{ -0.11508147805378575f, 0.034401559512340564f, 0.04995247765369151f, -0.1228706911068263f, -0.11610070284560926f, 0.12017677369626296f, -0.002297280560980057f, 0.04255714848947577f, 0.03468554413967422f, -0.007555572435259083f },
+{ 0.17489820282905158f, -0.11477851752469727f, -0.35800621421853923f, -0.04678222580365817f, -0.19434324537907458f, 0.36254286956142856f, 0.14232130641251559f, -0.03251901671795204f, -0.14850415583490756f, 0.1692965483748809f },
+{ -0.018680522025101145f, -0.0019699888368193696f, 0.0025160456269256023f, 0.0040128392934304785f, 0.019854290632687357f, -0.0026227259660843126f, -0.0013460706588432584f, -0.00331663654173853f, -0.0018469681552841437f, -0.0025127588187415046f },
+{ 0.06941433838619018f, 0.050553626096352056f, 0.09448250289067792f, -0.08940225859421598f, 0.1845719051144419f, 0.11695688718029931f, 0.17020136009765735f, -0.10231659133500097f, -0.17970037492888102f, -0.24398201622960555f },
+{ -0.05643118020188247f, -0.08777840963131034f, 0.0469392070604456f, -0.14718206562645725f, 0.1060772524196001f, 0.05746911716700245f, 0.06794397071503325f, -0.10209287780886586f, 0.15402155700014208f, -0.1605477641154282f },
+{ 0.02719798536770835f, 0.01910301348400447f, -0.05091435698059231f, 0.04808147196909368f, 0.11456319221340559f, -6.589350558574555E-4f, -0.003828218149027193f, -0.05667084982465422f, 0.03677394466367085f, -0.034778469231574384f },
+{ -0.04534697520685767f, 0.056749015645107946f, -0.063212880701878f, 0.06866337459414194f, 0.0734187646430679f, 0.016212600356127864f, -0.09749408867375739f, -0.040303561163047605f, 0.03749186747712758f, 0.044828473578153324f },
+{ 0.03147861121168066f, 0.05296452471903547f, -2.9107934439341973E-4f, -0.011759129425030003f, 0.06655708800936282f, -0.01662592614490404f, 0.03249369697149191f, -0.008062967197840182f, 0.044391066243837485f, 0.010875903813762472f },
+{ -0.0060885747764062624f, 0.008715333313279271f, 0.00503525631571876f, -0.01171105048081813f, 0.030916259089528438f, -0.005780912763996037f, -2.357150839714678E-4f, -0.015262603223663813f, 0.015161890407836314f, -0.008552918290013582f },
+{ -0.006001831934320625f, 0.002912854006526367f, -0.013128309790193839f, -0.013536228127970899f, -6.258330849528732E-5f, -0.012545673248971156f, -0.023200800517572295f, -0.04315624984120794f, 0.015157532746664554f, 0.0052482332647414195f },
+{ -0.0222504015597781f, 0.022403202741159253f, -0.010413992013379031f, 0.0110316285253621f, 0.03837866053085445f, -0.03128110861800996f, -0.004860884481986916f, 0.016475716246492918f, 6.402250425678304E-4f, 0.05594628910982861f },
+{ 0.013891010040924958f, -0.023948586568431206f, -1.9682299517893898E-5f, 0.033185632575792566f, -0.0704972706556743f, 0.0052431950618048034f, -0.021443826863554456f, 0.025825567904060594f, 0.019002070470297016f, -0.017053236604550846f },
+{ -0.02972276831083007f, 0.015765948335850943f, 0.02555156565732899f, -0.01612499985901735f, -0.005790533800399461f, 0.04312753893441617f, 0.015926761007533905f, 0.0575937919672322f, -0.07765930118381892f, 0.0022068743580573496f },
+{ -0.0199445738895864f, -0.028330695654541792f, -7.382326082637774E-5f, -0.020622064795397566f, 0.014361039748597397f, 0.036281068696779f, -0.030279166052586466f, 0.07725697186134026f, -0.061388037705136456f, 0.030794341112990918f },
+{ -0.025389303877614164f, 0.010126243491666203f, -0.07244317857948106f, -0.001571412771136561f, -0.09554602612269897f, -0.008513465416476273f, -0.06743010452436765f, -0.02239499253960048f, -0.07013654683437531f, 0.05622471806218883f },
+{ -0.04293513619151457f, 0.04063413132921415f, -0.007836778294488634f, 0.046782179297988676f, -0.07431893467617932f, 0.06710948371293429f, -8.32044095842281E-4f, 0.09259954670066148f, -0.06335886880031094f, 0.02156413512554044f },
+{ 0.003660864049013447f, -0.007227623013001912f, 0.015091394377909826f, -0.008050011341648294f, 0.03708626691435466f, -0.007998337062759328f, -0.0010497973613759766f, -0.035258253969020895f, 0.025707867349417778f, 0.013436603682381091f },
+{ -0.04219560530695935f, -0.027578389814608688f, -0.06897336207169111f, -0.00532064646129134f, 0.015379777460984609f, 0.036167462401205684f, -0.023181277994872043f, -0.0392602291630991f, 0.08231139933447236f, -0.03507776444580252f },
+{ -0.06373520191899011f, 0.006335292595393874f, 0.045061553196284965f, 0.029238200543229467f, -0.027159277290573644f, 0.07674083806166306f, 0.0013441045367463057f, 0.10194650526229573f, -0.07187369346769457f, 0.02202201453122183f },
+{ 0.002711409054068466f, 0.012640076015234442f, 0.00844642972259068f, -0.002434673445552608f, -0.01190610129023336f, 0.014388212702667727f, -0.002802537318363527f, 4.73639940784742E-4f, 0.005943018599918893f, 8.502852593924127E-4f },
+{ 0.056225594757745107f, -0.08046253928655f, -0.0322854928046041f, 0.10783921163426993f, -0.1503287869720523f, -0.03770017994003754f, -0.03561407972569577f, -0.013626891353210708f, -0.016013930831356472f, 0.004867179581587633f },
+{ -0.028689581003954735f, 0.0674892021022625f, -0.001567420664677872f, 0.026670721733851883f, -0.06048616185484725f, 0.015795745660082402f, -0.004664008905376882f, 0.05034259232054034f, 0.006031335421951709f, 0.029324921502808382f },
+{ 0.0867128064662476f, -0.059368431918079556f, -0.06910206028678857f, 0.0059715934306415926f, -0.08316115529651605f, -0.036332766282714604f, -0.09971634929579021f, 0.06186525292602789f, -0.07478519529409115f, 0.03523340812524911f },
+{ 9.693211151879735E-4f, 6.58979658180296E-4f, 0.007642566321150904f, 0.013496447025540412f, 0.008074213088360593f, -4.575670709659772E-4f, 0.012427480523011469f, 0.007263752983674187f, -0.002815093576916293f, -0.01452803831455845f },
+{ 0.006898166473907389f, -0.007923554749768606f, -0.04603503678577369f, 0.040964877619240884f, 0.04394583776071589f, 0.01283528869825932f, -0.0019255818982911806f, -0.008390621976510554f, 0.027697275781050655f, -0.0392554644507552f },
+{ -0.029619745534018704f, -0.057644253344641926f, -0.05992165538739357f, 0.20800101621326691f, -0.0868292441899817f, -0.048788689992256454f, -0.10151115541288823f, 0.010999742731556128f, 0.09025962530014574f, 0.044500606330848055f },
+{ 0.020525567064130182f, 0.04129864262359442f, -0.02634965676275115f, -0.0032609962580805838f, 0.047209039879981686f, -0.01620811502196384f, -0.001771429989442324f, -0.011877596305509526f, 0.028651595520537823f, 0.0029713016357956912f },
+{ -0.004668098129997496f, 0.04011157745966907f, 0.018600118293272908f, 0.0763407761752263f, -0.07304128986006411f, 0.005583023343504627f, -0.09532042375204651f, 0.05750815776751978f, -0.020430111071620363f, 0.0036363170733955596f },
+{ -0.01401563024895992f, 0.014625983073728414f, -0.005824423326752611f, 0.0030347246982181f, 0.008552398420079542f, -0.0039829938064950745f, -0.012442287133013227f, 2.817620080340542E-4f, -0.0013253482954568802f, 8.818734905483545E-4f },
+{ -0.006328920582896634f, -0.02029257228538648f, -0.032103483803002375f, 0.02814325329088474f, 0.05550988911710831f, -0.040490817950683815f, 0.061082988294407045f, 0.004843941512851004f, -0.05571198389650469f, -0.04794334488028927f },
+{ 0.00870918666246026f, 0.007506298058490029f, -0.007425710040017724f, 0.009474335464478366f, 1.6709436942042086E-4f, -0.012411876677424908f, -0.0048842387684594184f, -0.009188468874701788f, -0.011796133634740809f, -0.0032036012501646923f },
+{ 0.026600001108984434f, 0.05095400946262633f, 0.001167049987872794f, 0.13508948636517712f, -0.10377415147247926f, 0.0709781690558679f, -0.09681972112866934f, 0.08604941172690711f, -0.01660736670588666f, -0.05923938697652539f },
+{ -0.01104627694902879f, 0.026540509397658875f, 0.0029587983429257957f, 0.11784596447002811f, -0.0969743996520024f, 0.03719385802197957f, -0.05327959910626861f, 0.0636265064796542f, 9.015071917900218E-5f, -0.023977465065146045f },
+{ 0.010263211790423497f, 0.0029409168454393435f, 0.005560436873984545f, 0.004143903663889384f, 0.005862819305478367f, -0.016816310729866335f, -0.0010722158548270846f, 0.008068870649937783f, -0.008174833777976542f, 0.0018173670730549396f },
+{ 0.005518498763616055f, -0.005517645961355445f, -0.014508276549068375f, -0.002499715584082512f, 0.004280085290322505f, 0.006552422049132251f, -0.011437298801100788f, -0.008521048954083895f, -0.0040170059957993845f, 0.0018589501225270383f },
+{ -0.0067843126981862465f, 0.02102022533923221f, 0.006883070032820467f, 0.08992514971983546f, -0.11171016878729008f, 0.014201533795205477f, -0.043228047003634314f, 0.11168788128833418f, -0.03257427533662379f, -0.05222118323454255f },
+{ -8.949225626462597E-4f, 0.017062578272091174f, -0.0035099934027300575f, 0.12700711252195473f, -0.11627697196194291f, 0.014893689542989499f, -0.07365150416141977f, 0.10001997178044154f, -0.015265776025786111f, -0.030065698889708167f },
+{ -0.08135268088652663f, 0.05534562962730632f, 0.0012618605238980073f, 0.02344879316946917f, 0.043693300112107064f, 0.019526352473297773f, 0.046322221519921394f, -0.0071596137244904125f, -0.10321207681330774f, -0.011094396449951723f },
+{ 0.011492534156093828f, -0.010470252311146826f, -0.015095919097154104f, 0.012105366075496801f, 0.022435513034828807f, -0.009821255920701329f, -0.0028702505592139607f, -0.0142226340885681f, 0.004072964810859686f, 0.0021228708904651836f },
+{ -0.004767957223637788f, -0.009354462851573679f, 0.01688460377276967f, 0.010584474631483478f, -0.013548649013115671f, 0.007208339654342421f, -0.00909835269770739f, 0.014623317930566027f, 0.0022766751187911793f, -0.0030750387261647043f },
+{ 0.0044151829428698865f, 0.006890887699939045f, 0.0012017001184959108f, 0.004523226434065426f, 0.012689362555655653f, 9.982563803599299E-4f, -0.006867382405532477f, 0.003159124381165719f, -0.018189266968604536f, 0.01496391253192658f },
+{ -0.012277958438356324f, 0.017356471069754017f, -0.0027655434619681695f, 0.007822840318864394f, 0.004122671846675866f, 0.00908432109025624f, -0.0013381090846893166f, -0.020488245544361242f, -0.0042262974047805775f, 0.0154326431228135f },
+{ 0.007742532266632345f, 0.00812806604723113f, -0.01332942697478559f, 0.02187073118005791f, 0.028553751151134447f, -0.005982540443880859f, -0.009724238590845756f, 0.0014949115568690927f, -0.0073871122133462985f, 0.002883848368083849f },
+{ -0.0018973178303242383f, -0.010998199013740424f, -0.01453757646572537f, -0.002436913244823767f, 0.015894740277576935f, -0.009146442802509449f, 0.008999486475177289f, -0.01608055977423532f, 0.01824493700416162f, -0.00379619525428351f },
+{ -0.028635030829712086f, 0.04116063947386654f, -0.004625478657993739f, -0.032667281092930496f, 0.06612385116001188f, 0.002241145521326574f, 0.020803737956396565f, -0.05748745055586813f, 0.02080203155124633f, -0.0015464860073512875f },
+{ -0.017751020889091876f, -0.012527068068251193f, 0.011178306380727225f, -0.031799118894155855f, -0.0462888259501299f, 0.010934617407859728f, 0.027210417647159018f, 0.02644125612968233f, 0.009171492596952805f, -0.01540247098235841f },
+{ 0.013621899972845141f, 0.0031001900098880804f, -0.00712658031607799f, 0.015156582314933185f, 0.01726639043848769f, -0.007803306272886913f, 0.0018374212994431934f, -0.035729515860165324f, -0.020737148340289373f, -0.019211606239037615f },
+{ -0.018715669354363227f, 0.008753431367099876f, 0.01038488050709625f, 0.009229887185780642f, -0.03305138218378449f, -0.009883867217494999f, 0.026176862244228855f, 0.0154478624799673f, -0.02064091866944851f, -0.0029014852370679864f },
+{ -0.056215904084178835f, -0.023358330507328256f, -0.02035884703333924f, -0.004150735355269867f, -0.08435783512649321f, -0.029236706444887225f, -0.0366073143354048f, 0.027675398174322775f, -0.02159951375505988f, -0.0655870053875325f },
+{ 0.0013323165333357957f, 0.01775637524469127f, -0.0066759062757741515f, 0.023928625808871954f, 0.05547723480407036f, -0.00489082577466829f, -0.013035801071510679f, -0.032120396586779995f, -0.011448844196972013f, -0.004572297002549122f },
+{ 0.042541238369340206f, -0.008528736694099983f, 0.007078370904271208f, -0.004659685719251615f, -0.004491745444794862f, -0.016345690375813703f, -0.015479015403666231f, 0.0018725561223489609f, -0.010129753655490356f, 0.014347496964924869f },
+{ 0.10243206328133064f, -0.0728514587352468f, 0.04008260724001152f, -0.018912070037717492f, -0.1534316080839338f, -0.019798253515813963f, -0.03039863852797607f, 0.08487971765545671f, -0.004907564213631882f, -6.419177816981409E-5f },
+{ 0.00409989781382608f, -0.03285430409817249f, 0.08913369960210984f, -0.06764571298421361f, -0.15015888375101114f, 0.033380060763811545f, 0.019933788275447686f, 0.08082250078501935f, 0.038231743643211476f, 0.025226063163729842f },
+{ 0.029147562539409737f, 0.006770441754111066f, -0.008785330013592278f, 0.014132474974770699f, 0.022069313925992092f, 0.0046884492950609565f, 0.013180733148243248f, -0.014082785093220649f, 0.004193123088244579f, -0.023585033333012626f },
+{ 0.014926892997195459f, -0.007674234517927269f, -0.04992081932643584f, 0.03237024532825016f, 0.10548921151764744f, -0.047217038523187746f, 0.03149434791352793f, -0.006798255011578164f, 0.022415829126293172f, -0.018320499385204896f },
+{ 0.015346409544953471f, -0.025960277554317738f, 0.0059849492208568274f, 0.032723475869999f, 0.022166852270776617f, 0.004398969979379174f, -0.00800396462819427f, -0.008246987233645541f, -0.010230225350032984f, 0.016536155269995856f },
+{ 0.014382052289176888f, 0.018675249908700155f, -0.06729508265178191f, 0.020843176576436383f, 0.09317408099113988f, -0.06368510445145273f, 0.035020388720088745f, -0.024242027160005442f, 0.015635222383224946f, 0.002142126025329985f },
+{ 0.09384158719512913f, -0.07861942303619542f, 0.010094804238868332f, 0.027802622763962184f, -0.07958210733321541f, -0.05693414164402666f, -0.0632940434405984f, 0.05410135385704578f, 0.005562633319211948f, 0.028417739140237402f },
+{ 0.021854389316413775f, 0.018910907608021603f, -0.011732139919978075f, 0.007787671195751055f, 0.029714424900176863f, -0.03027250540992837f, 8.589136076602832E-4f, -0.009834390052714212f, -4.7547582265709386E-4f, 0.019572145200971277f },
+{ 0.22006702596717234f, -0.14693615175174826f, 0.14332588995318593f, -0.02557336091502828f, -0.3574576181817885f, -0.12502141489528815f, -0.09695066022344319f, 0.2040685397486108f, -0.016722274417696442f, 0.06121982637261777f },
+{ 0.023997145918154102f, 0.025643540629199244f, -0.014864809988992585f, 0.014468577374761572f, -0.024033553935074156f, -0.025032755820946367f, 0.014326357762723431f, 0.024627433263097905f, -0.004633874925949777f, 0.034258697953012195f },
+{ 5.765183173951782E-4f, 0.007442564653973501f, 0.011126074783773301f, 0.011261577144974212f, -0.019766360481212792f, 0.0025190894189076685f, 0.009258722867018121f, 0.003655376573510135f, -0.022210791623920045f, -0.005119639418335109f },
+{ -0.014568222612025117f, -0.07590873506463366f, -0.004091233221366632f, 0.06966042325505228f, -0.09734475165606092f, 0.06698524616182065f, 0.0515510277578933f, -0.03087054367412374f, -0.06075706727772894f, -0.07086177904243442f },
+{ 0.010530488097626314f, -0.031173832110285026f, -0.005800992878341239f, 0.002895817692982472f, 0.010218748854983407f, -0.008188656400806833f, 0.013055640197269961f, -0.003268488776332258f, 0.03766445495461569f, -0.008391126903703085f },
+{ 0.014100740585386424f, 0.01582279323198432f, 0.019962704707609805f, -0.01938468618990779f, 0.05202035449310404f, -0.02218554029657648f, 0.01482411003608694f, -0.07068940540765836f, 0.023496371832940233f, 0.024192727636947936f },
+{ 0.04150243600756126f, -0.0122491169049331f, -0.023027253110394184f, -0.019842574961561197f, 0.054353812554457225f, -5.568702830814473E-4f, -0.03281960269843826f, -0.04940450392089308f, 0.01751130948726881f, 0.010332314085346532f },
+{ -0.011372224193163217f, -0.0035744583959841916f, -0.015556930769157973f, -0.008201888065228f, -0.009665925612736935f, -0.02192585096250474f, -7.683261900761996E-4f, 0.0016920636480105141f, 0.011443109456286892f, -0.003591667322158005f },
+{ -0.0023311018438406553f, -0.005933777813026126f, 4.40304935044084E-4f, -0.004096636489613428f, -1.8865153327467867E-4f, -0.007977689601261145f, -0.011938823658585949f, -0.0035881836470784195f, 0.007705250734841049f, 0.002211063500602574f },
+{ 0.0314769739944467f, -0.022536608519001883f, 0.004786662494077816f, -0.005953317952232611f, -0.11243353357483457f, -0.0400067755566592f, 0.024705744419446746f, 0.018350841414820962f, -0.03392294412088893f, 0.010166601166033021f },
+{ 0.00823486733065063f, -0.009043739256149113f, 0.010156998337859947f, -0.008909810245213146f, 0.009653581595984699f, -0.00890122678362251f, 0.005945401788597254f, -0.008579718916114237f, -0.008483515904767374f, 0.0029421230842370054f },
+{ 0.014600403538106026f, 0.007796542331379583f, -0.006364176453091009f, -0.019854256163056475f, -0.006343561562641635f, -0.010092905196586404f, -0.00335079556908089f, -3.911810501538909E-4f, 0.004242432729987888f, 0.01503923227481356f },
+{ -1.2715929115616505E-4f, -0.004942008816049868f, 0.004848068482684069f, -0.006304910162552776f, -0.007501470243508061f, -0.010914457289636593f, -0.015602890642953879f, -3.651350121233147E-5f, 0.012153375646919635f, -0.011547449233702753f },
+{ 0.025628371912344478f, 0.016946499792725944f, -0.0015694407139510557f, 0.019329942560091178f, 0.03905079125713374f, -0.011469937196246891f, -0.02051119501964141f, -0.02507024191261438f, -0.009892395567977153f, -0.0017339077462827823f },
+{ 0.024306020935264336f, 0.0022560435993627622f, -0.019988960159634767f, 0.027338728006402125f, 0.0824427703453408f, -0.006237645657146728f, -0.018275129144049582f, -0.06244675915884993f, -0.018858817004807193f, 0.006686792803673428f },
+{ 0.03562762235411201f, -0.007727000107819696f, -0.018799657178551178f, 0.014958416841487217f, 0.050652191053167525f, -0.008694109798391554f, -0.01347397474932368f, -0.018015383841728412f, -0.010793291618998094f, -0.004968410605099298f },
+{ 0.03391525790725368f, -0.01983264662099299f, -0.014355362141694252f, 0.01887117995162858f, 0.039710636307405504f, 0.00387647426515905f, -0.006869431474638691f, -0.0027203371555035256f, -0.01882956165146613f, -0.010096477536578958f },
+{ -0.010474152929805974f, 0.014957963910731654f, -0.01593268085579618f, -8.630108501163455E-4f, 0.008834632225310675f, -8.326040316144585E-4f, 0.0015530805901004584f, -0.0020128039122873373f, 7.200680494027561E-4f, 0.004812818252617156f },
+{ 0.009191817909265812f, 0.0042528647132960016f, -0.008757504822069018f, 0.010881053072087135f, 0.005444938908648901f, 0.0025449934350801613f, -0.0033523522081450752f, 0.0035523239109533657f, -0.012007906435466524f, 0.016908838047302574f },
+{ 0.02430031085687033f, 3.224116402726911E-5f, -0.051685643530526536f, -1.7296835104237018E-4f, 0.08758688883794975f, -0.008000835370562995f, -0.03175102291401608f, -0.05572581004947695f, -2.935368246537192E-4f, -0.0348711670631029f },
+{ 0.04689588788155326f, -0.028419627407366917f, 0.026244855452330445f, 0.021357207008120355f, 0.02391350222768962f, -0.011484752856437398f, -0.002254121962208134f, -0.00341903045432371f, -0.010685712509345623f, -0.018714996625075826f },
+{ 0.013089887372170705f, 6.888564616265234E-5f, 0.003074641900755138f, 0.0019489762396403445f, 0.0052576667507982944f, -0.032368768631717684f, 0.0019945988185039445f, -0.008040036245762883f, -0.01916576303526201f, -0.010260474889192501f },
+{ 0.0016525637938323474f, 0.00516586739688349f, -0.016672259696679525f, -0.0038045534335500748f, 0.001554003494847687f, -0.01738522913739681f, 0.013869421655890165f, -0.021518677326439188f, 0.02330095496992901f, 0.02012173105519856f },
+{ 0.03407893734995059f, 0.02004447150550609f, -0.018976322361287074f, 0.041749395338357795f, 0.09415355130576132f, -0.018924409088931848f, -0.029398692583187055f, -0.038845346242759f, 0.0040013261841001495f, -0.0016155508461974503f },
+{ 0.0031251917400386526f, -4.917509055896475E-4f, -0.005030638899902247f, 0.004679324519357829f, 0.013780748267055788f, -0.01551907418830508f, -0.0019046626354890408f, -0.003009389499283742f, -0.004521722335335948f, 0.005742722477645842f },
+{ -0.0013429568591012335f, 0.0036864693702970686f, -0.012311711500169947f, 0.008988577907554352f, 0.004047547634265988f, 0.0019037282297295018f, 0.019115206235283334f, -0.018037671291135298f, 0.011485548409241906f, -0.003237505570951381f },
+{ -0.0010361107596289674f, -0.004476134130957264f, 0.007508411123183927f, 0.0017751134863619317f, 0.014203674880684674f, -0.027710830968281915f, 0.010884663747094245f, -0.005650226885228515f, -0.01607787779138886f, -0.01586000514906604f },
+{ 0.021268802691733573f, -0.0033080376071458113f, -0.017619988400734515f, 0.02155069284972697f, 0.03455788141958616f, -0.02887799945172121f, -0.014265937149089391f, -0.01204926875909625f, -0.009183586107653659f, 0.02114539302015139f },
+{ -0.014692502536466192f, -0.003588729102094363f, -0.009983224827802707f, 0.001557208581969603f, 0.002439178118927691f, -0.016180692892643227f, 0.0017641733709850027f, -0.0230670939960949f, -0.011971029817513256f, 0.033141581409688176f },
+{ 0.015651851084207413f, 5.567656682965982E-4f, -0.009901009070055729f, 0.017799422837472368f, 0.00594739363457948f, -0.024724961288796504f, -9.731557220699946E-4f, -0.011639723440823814f, 0.011168287360322146f, 0.0046056616211069285f },
+{ 0.025460254782501364f, 0.0016621265955440432f, -0.008544151438556266f, -0.0013161818707496098f, 0.04863220077743354f, -0.018936972282728823f, 0.013454262084460038f, -0.04840484258163398f, -0.006123093038127026f, 0.010778436437356488f },
+{ 0.02636826788040985f, 0.004506037052753569f, 1.8509753366961415E-4f, 0.023839657793172153f, 0.029048364138787017f, -0.0018802900160191144f, -0.009980095430640388f, -0.020090015356837406f, -0.00873016488701831f, 0.020496768363283114f },
+{ 0.0013759202085642797f, 0.01381267913267916f, -0.00525120601727131f, -0.0015861528069671166f, 0.008901279254805692f, 2.1772240719884428E-4f, 0.006839030204572328f, 0.007596968206681925f, -0.002348326402123589f, -0.007402265784653386f },
+{ 0.01896680587944549f, -0.0013049046070408418f, -0.022655519394165696f, 0.026512413877966667f, 0.05427440144259002f, -0.0031385357311808164f, 0.004697660072235892f, -0.030272054764495522f, 0.009226880513249302f, 0.003135474637146956f },
+{ 0.06613033876403468f, -0.004400530675233918f, -0.04955462720921782f, 0.05159427939069155f, 0.100565741898881f, -0.04894798383584732f, -0.01900684283068504f, -0.08248051879595746f, 0.04335296390294879f, 0.0036971612336938638f },
+{ 0.036100401245938725f, 0.013037059357904317f, -0.025954142673590287f, -0.0015123288686108556f, 0.10122501770387932f, -0.02494106150818503f, 0.01521593403471834f, -0.06421262149023459f, -0.0047163381713337055f, 0.0025417733789339474f },
+{ 0.035838531489371495f, -0.0021517290729567585f, -0.034112361224511f, 0.01750198783528296f, 0.0425239972828808f, -0.01949754042371792f, -0.03309347098585544f, -0.016835509039653345f, 0.004263883106546425f, -0.012093246984673766f },
+{ 0.014600637611926273f, -0.005899383970092244f, -0.004538914010188669f, 0.006372473965834976f, 0.055091158281981724f, -0.01112601313234434f, 0.004228681572160089f, -0.04281326097287639f, -0.014960273276736805f, 0.011977296943542869f },
+{ 0.009178287731463461f, -0.0037444906530945325f, -0.012215497111056881f, 0.0066563573282102505f, 0.011894785656455215f, -0.010569046021518466f, -5.172028963160714E-4f, -0.009785481709036486f, -0.02565778042861209f, 7.290601360838388E-4f },
+{ 0.0049361227952343595f, -0.013202979118069249f, -0.02402958275085135f, 0.032721399601797284f, 0.04156354972045493f, -0.006574783524533855f, 9.875073915998115E-4f, -0.020071473733101943f, -0.011127702460453857f, -0.016361703204595526f },
+{ -0.003217735150576413f, 3.5956885039011753E-4f, -0.01187798155392485f, 0.010774415408465672f, -0.0027008394697185436f, 0.004599594379898639f, 0.0024680710673288943f, 0.013475137314964454f, 0.0054154444038255f, -0.008652809345630823f },
+{ 0.013811241093509605f, 0.046033184646273366f, -0.006008861246783901f, 0.02048655997672463f, 0.07037505289013216f, -0.01427866503839152f, 0.02942613979530166f, -0.05404082773363138f, 0.03236078782106859f, 0.061520800106504354f },
+{ 0.0025240256620477773f, 8.282951905470504E-4f, -0.003210215735625438f, -0.0032222245296134587f, 0.00235499052916206f, -0.005534508690755355f, 0.01200236518038475f, 0.009013428917946022f, 0.011407200782284712f, -0.0049890663622419295f },
+{ -0.015870356406052916f, 0.006455526433366816f, 0.0043882212267320145f, -0.0035804480973504918f, -0.002011990590256575f, 0.022193005610492582f, -0.002560938316593307f, -0.0036169657044559846f, 0.02392200150734973f, -0.0013439589654772846f },
+{ 0.002043115294309275f, -8.821590303134776E-4f, -0.001547045617135255f, 0.028381899578616185f, 0.03682225367268553f, -0.006408304509486089f, -0.023077273590363205f, -0.01730707218830328f, 0.00392183750402448f, -0.015049172984518017f },
+{ -0.07228107252507537f, 0.1003742672622874f, -0.017102267769756492f, 0.012103699501236668f, 0.10941431780957847f, 0.056067440677849786f, -0.021338375892761444f, 0.009284740922408592f, 0.0403055680516919f, -0.016123632482833064f },
+{ 0.021525554610797235f, 0.04260231768394794f, -0.03488207960312609f, 0.017552583781598897f, 0.039011312836205285f, -0.038599043941347375f, 0.02288228755408387f, -0.031750583615171996f, -0.0023639220824554228f, 0.0336457329475731f },
+{ 0.0217849351996634f, 0.06949509649545725f, -0.010721485136630864f, 0.02311912198436407f, 0.1436297897351945f, -0.01956574095486682f, -0.002280248120576964f, -0.017057252305729124f, 0.019058481077806097f, 0.09274151361322536f },
+{ 0.07249175541917678f, -0.012077441176134919f, -0.05039282786934223f, 0.029556050041980662f, 0.006746285090917307f, 0.017930225512726335f, -0.014403948761333307f, 0.0050226413307011344f, -0.13696889190903716f, -0.04140751986056491f },
+{ 0.015290634662402082f, -0.007589073067712269f, 0.0033205619478216064f, 0.0508227420354618f, 0.09121538137805789f, -0.0313532846237286f, -0.03040535012123623f, -0.02958975668405585f, 0.008206966328366032f, 0.017646172206669055f },
+{ 0.024669197977053366f, 1.0010275679186612E-4f, -0.006842836447976963f, 0.04340729090931292f, 0.13436256157508264f, -0.02576173823515233f, -0.0621055871708099f, -0.027748916703562426f, 4.622441317446106E-4f, -0.041668464934847875f },
+{ 0.06521134638113056f, -0.03729209770669773f, 0.16326919213715824f, -0.07270554205786993f, -0.11179355014924418f, 0.06815269542988066f, 0.03556968659490203f, -0.01066370299121957f, 0.06409789402586577f, 0.11064359856740116f },
+{ -0.02718683337588978f, 0.026334871155587195f, -0.027612621899362127f, -0.0242675102814694f, 0.10353990816743822f, -0.004627879271027974f, -0.057015794308623836f, -0.02720898342154288f, 0.02957280740338774f, -0.03593607045716035f },
+{ 0.013196920992997465f, 0.01153310876094957f, -0.02030177438530112f, 0.03295042368586119f, 0.052668925323031635f, -0.025492852855606186f, -0.019691983479733874f, -0.02853379742260243f, -6.092601518019084E-4f, -0.003310627126331779f },
+{ -0.012534556178337989f, -0.0077359394258252195f, 0.04218658885843743f, -0.041898813857419795f, -0.019068697307020377f, 0.021143793688318615f, 0.0087598218744604f, 0.027973717739568086f, 0.012030354233896182f, -0.003184588036340613f },
+{ -0.02975786909158991f, 0.045413794175253215f, -4.081186296849476E-4f, -0.03696867264474209f, 0.09128163758846822f, 0.0012331107534680028f, -0.012470351634514577f, -0.0459731191279535f, 0.03365009022569859f, 0.002765946541201336f },
+{ 0.020738052290250247f, -0.002952997903792765f, -0.03596048102082284f, 0.03430671567810101f, 0.09607150613452078f, 0.003229408787487687f, -0.050520565835762164f, -0.020591705979780456f, 0.01632126044418758f, -0.022743889103938722f },
+{ 0.028719303926346692f, -0.022504774101608255f, -0.006607415292125774f, -0.011002931316303734f, 0.01838265114299931f, -0.017035543496057844f, 0.0029257650170290018f, -0.009746718832709037f, -0.0022919772918148077f, 0.01806431900827183f },
+{ 0.07006572031921778f, 0.01421087277873278f, -0.044393095572739814f, 0.021852055729242897f, 0.09418140209209852f, -0.01943104028199578f, -0.03317791920829087f, -0.06011073996917852f, 0.04707816633348742f, -1.9867783618882673E-4f },
+{ 0.03316304788749464f, 0.02199072558303792f, -0.02183419959356593f, 0.03575041288382477f, 0.10260739928620786f, -0.03385806053430042f, 0.008605014657646542f, -0.06254608223883573f, -0.00875454829549397f, 0.012729836506091306f },
+{ 0.054525878939138066f, -0.0145826036313219f, -0.03033001950775684f, 0.028161993050703882f, 0.08958826116408762f, -0.022331911927328002f, -0.00897950744093673f, -0.06446721613485372f, 0.029009915943940874f, -0.011811747592127426f },
+{ 0.03241368918961318f, -0.009648316789406895f, -0.02357085374242641f, 0.006706969956066248f, 0.04251825147660968f, -0.00506890243912031f, -0.018527051970663757f, -0.03027581626883022f, 0.023670125984427543f, -0.007707662254539441f },
+{ 0.023214006371149454f, 0.03138221332049716f, -0.024854064061665994f, 0.0029481595028371197f, 0.07213417434081988f, -0.01117180365239006f, 0.025980161983470085f, -0.060209238003631455f, -1.6911289143394125E-4f, 0.01980263151845097f },
+{ 0.04809288148534803f, 0.035098932541074226f, -0.04025334559396466f, 0.010117951178450973f, 0.14951503091180546f, -0.04602410116689811f, 0.007491044475022134f, -0.08675791316677187f, 0.04250062955046118f, 0.005707342146052061f },
+{ 0.010332372529699003f, 0.04041698021513131f, -0.012985846549734968f, 0.001916737218525485f, 0.0988412017120452f, -0.038247721576864346f, 0.038369356105696015f, -0.06403261081376792f, -0.01871560331437595f, 0.016907827686439506f },
+{ 0.05277258458657275f, 0.07059266147980417f, 0.002073517827881136f, 0.047045703280975223f, 0.06743946859601077f, -0.029474165289391865f, 0.022258481300883898f, -0.038615489730115256f, 0.03827093503836166f, 0.09963775447153735f },
+{ -0.01350225474648085f, 0.022356168086291806f, -0.004835610134491791f, -0.006130768960100584f, 0.024665285776470678f, 0.008142660943020163f, 0.0035086137675565177f, -0.00991281849512244f, 0.04545579480907158f, -0.010177077283919972f },
+{ -0.02595289686445373f, 0.030292494146146355f, 0.008709149442044622f, -0.045135271374617494f, 0.02786441582902039f, 0.05271212965216641f, 0.038360618579449876f, -0.00908786957593579f, -0.09124870648707509f, 0.006831986987527073f },
+{ 0.08800448305674569f, 0.05173013806139477f, -0.042845967862840874f, 0.04785787189860133f, 0.1315589021399892f, -0.03717565154778803f, -0.008818049014863454f, -0.03386977003321992f, 0.07673869533752366f, -0.005824424265324569f },
+{ 0.005869092859140668f, 0.018002160180097117f, 0.007392011121214999f, 0.007792988843550716f, 0.032752203627890296f, -0.01039609232639815f, 0.023614241351584752f, -0.04087973198316792f, 0.007960288418733629f, 0.025842132156669445f },
+{ 0.0184241015010063f, 0.078090121715619f, -0.03473889799808779f, -0.013728847624611233f, 0.05892006084834386f, -0.04256359111547834f, 0.04656288748035018f, -0.045882417458780626f, -0.00159745272187124f, 0.02392440218615618f },
+{ -0.07001149042761955f, 0.07350080277590612f, 0.003110640726312088f, -0.034593333912687076f, 0.0999757983394719f, 0.03673092797874728f, -0.0065992771641211565f, -0.017535164578841935f, -0.017166010646762177f, 0.02596363876342762f },
+{ 0.07137063215883105f, -0.006374036423829806f, -0.0174833844579217f, 0.03133900894918324f, 0.15726440320730314f, -7.719099359830758E-4f, -0.0691794837932676f, -0.08700829138511659f, 0.07000604030343863f, -0.02808228465554148f },
+{ 0.04603306148542469f, 0.009515973987673634f, -0.0304272859419784f, 0.03373361437934474f, 0.14231204706652184f, -0.005192221312502162f, -0.06239295913167645f, -0.06715636708480685f, 0.04252852057371797f, -0.010810094184327655f },
+{ 0.009898477018832993f, 0.004317568277513336f, -0.011038847993850014f, -0.011284019070274598f, 0.012816413443508099f, -0.0032540940968966117f, -0.011764982265440146f, 0.0012809642844700713f, -0.008160807501419353f, 0.001445461210689606f },
+{ -0.011761366984514462f, 0.008086487053571628f, -0.0436508986640759f, 0.039394059537541416f, 0.11631375808402793f, -0.002453668880298499f, -0.10101499314675781f, 0.00952799934657431f, 0.03532800677786095f, -0.022706247571531803f },
+{ 0.013716647426223137f, 0.04021904499798819f, -0.003776145168702878f, -0.03793389949365664f, 0.028489770765643057f, 0.019216215094101992f, -0.0020366971267367297f, -0.016769867562235065f, 0.12570308857264678f, 0.013376163960504003f },
+{ 0.02990247286102247f, -0.03229233431215111f, 0.047304998156957365f, -0.045815677220454966f, -0.18021129051617446f, -0.038260125530705895f, 0.024185050183078132f, 0.029741141191351086f, -0.018341660368542317f, -0.025520772271831808f },
+{ -0.005152773476797098f, 0.04429126320824663f, -0.009856138102622394f, -0.021761553710649067f, 0.05647697159115706f, -0.00627450023603572f, -0.013501132047574856f, -0.044762266702130765f, 0.04801597175081847f, -0.001839903701522886f },
+{ 0.014916609509751416f, 0.0037592417046734025f, -0.034883159541236115f, 0.020474675559027405f, 0.08808376391431899f, -0.07123813657566588f, -0.0269091889788507f, -0.03575323067766835f, 0.023726737796408433f, 0.0645034560981312f },
+{ 0.03675212899820262f, -0.021526926944174563f, -0.004662901783506239f, -0.009670681095878417f, 0.009162764866976576f, -0.01907362703057659f, 0.058475556465159395f, -0.0238197585344174f, 0.03967941011007683f, 0.0208828640906781f },
+{ 0.006039908505618318f, -0.03191358703327778f, 0.004314173483934936f, 0.058074756707856355f, 0.02189882557760895f, 0.014067195862974741f, -0.024331458536152723f, 0.00571091299275212f, -0.07723240402050313f, 0.019427612442964818f },
+{ -0.003006203639302614f, -0.03030357212625961f, -0.014198784797937078f, -0.007801552588098486f, 0.0540676828019481f, -0.0156716961981348f, -0.031776383636436326f, -0.07076062477014596f, 0.0296627092597962f, 0.036829552677697996f },
+{ 0.004675265840492279f, 0.005063003192397103f, -0.0021939238537062207f, -0.005949208047136654f, -0.0014094670019469267f, -0.0026430648204739437f, -0.004969489917718213f, -0.0177628384859195f, -0.005799576814087594f, 0.00550163202089431f },
+{ -0.03865177771117145f, 0.009259544724562878f, 0.04963101386405498f, -0.05455354310763602f, -0.06730012807790903f, 0.030372155519399112f, 0.04333656647764519f, 0.051782480321490715f, -0.007841249406127179f, -0.027299885573076957f },
+{ -0.005066434939338367f, 0.0025501793387353246f, -0.017790217286836336f, 0.0012134065402188503f, -5.786484114941392E-4f, 0.007910484632553148f, -0.01090199263879769f, 0.014550867901436766f, 0.009890193036888073f, 0.002570187578742744f },
+{ -0.005622783365454364f, -0.005516826579513814f, -0.0020586112095510706f, 0.0022835073021041288f, -0.013697306912758743f, -0.014945578175910131f, -0.003197178893692237f, 0.02400810860673724f, -0.01397447289452995f, -0.016952927009247613f },
+{ 0.006634948974463697f, -0.006305530505713342f, -0.034461230912616936f, 0.012874154076672705f, 0.028269217193814245f, -0.017129126613053866f, 0.010413543986434747f, 0.0026436609262002497f, 0.0015982109877493349f, 0.013843948534341434f },
+{ -0.008035509724096645f, 0.005357864951242013f, -0.006880217225758995f, 0.015425658482853507f, 0.01488415727954383f, -0.004073020474071155f, 0.004679268803488008f, 0.004890438079205336f, 0.013002930745282441f, 0.0119889981955738f },
+{ -0.004654233949956592f, 0.009090910415631408f, -0.0012400952335863754f, -0.019099660667652018f, 7.252051138615824E-4f, -0.0011989451560227308f, 0.013753670727177016f, 0.010196141354089977f, 0.001978282780331467f, 0.019007885565113562f },
+{ -2.9099873152832137E-4f, -0.019224333631680312f, 0.005477150140860299f, 9.885300435016138E-4f, -0.016011903009516985f, 0.01692662141000213f, -0.01633532614359976f, 0.018032536722042483f, -0.0168000716020623f, -0.004128826687063467f },
+{ -0.013645894943009555f, 0.01693646095063223f, 0.005088506462008849f, -0.01626466228546277f, -0.025928596201616055f, -0.0023346240260279367f, 0.011116256415101937f, 0.019306489335835685f, 0.002310383350233494f, -3.410917551688599E-4f },
+{ -0.04174835040040666f, 0.005708681925946074f, 0.022118030886755704f, -0.04693566751114142f, -0.054545096575711965f, 0.029985948501483846f, 0.0332320760358235f, 0.05194228854624753f, 0.014681033771077314f, 1.5837468382904496E-4f },
+{ -0.00545138511852371f, -0.039116145470383265f, 0.010987237548286271f, -7.492008679324219E-4f, -0.0491749311969825f, 0.02015824699602194f, 0.028790588075719378f, 0.07591394919136284f, -0.003913516662241036f, -0.0598666030718026f },
+{ -4.2338111844378957E-4f, 0.03163658924391355f, -0.0713746587803764f, 0.0589883122141877f, 0.0567438920687644f, -0.01167249790697213f, -0.01717942927704343f, -0.03142476280675462f, -0.03669477709294048f, -0.0030371364679442343f },
+{ -0.04769064216575058f, -0.028750877273267698f, 0.02275162612800475f, 0.010769770293221253f, 0.07379214978666264f, 0.018691647330657358f, -0.014625950226004263f, -0.09553017149438238f, -0.004147211838756239f, 0.03098652523919782f },
+{ 7.593124170535277E-6f, 0.006881373703480313f, 0.023845538052162083f, 0.02074846640479419f, -0.025888574411305813f, 0.0029318340475087026f, -0.006145491921121355f, 0.0029770441158281616f, -0.015223645859690391f, -0.008247584294419514f },
+{ -0.0063156707691304674f, -0.01297207644293254f, -0.04484133434024298f, 0.019931678300272954f, 0.0321617135114093f, -0.048868140359418354f, -0.005914935791655334f, -0.007793122418029752f, 0.04366295161673487f, -0.02589971404245903f },
+{ 0.010010017237250401f, 0.003286884898012255f, 0.0013870948119570406f, -0.010419705066679953f, -0.019532069446697903f, -0.012442010177214104f, 0.01208160964662648f, -0.014536242706438055f, -2.864866527952944E-4f, -6.954485726208105E-4f },
+{ 0.026131369849723748f, -0.012257285049671407f, -0.005121777786511939f, 0.02097863393526887f, 0.023623058426355228f, -0.01978229199145001f, -0.00621984406363582f, -0.033988294098215924f, -0.016675316566611177f, -0.024523781059286747f },
+{ 0.006825263498110828f, -4.307265975698013E-4f, -0.014606662901740225f, -0.01899241508243051f, -0.0025415949166270805f, -0.018408331337143237f, 0.007085113849894746f, 0.006072067661938685f, 0.005729571494239905f, -0.017654958789085993f },
+{ -0.002918482317641088f, -0.004051718752181463f, -0.0022303520867385253f, 0.010251727065722272f, -0.006286153210084147f, 0.005825077668318434f, 0.002553039649438378f, -0.01446515992173745f, 0.00845405994205389f, 0.008318454813732442f },
+{ 1.6401571161697498E-4f, 0.014562955587258297f, -0.03222350361233048f, 0.060192064912877104f, 0.06730689759244908f, -0.004543233133072745f, -0.02084157756922415f, -0.029358512237180508f, -0.017107259574239888f, 0.023659615612411797f },
+{ 0.009979383035913142f, 2.362293629294532E-5f, -0.015224584767029689f, -5.455705525987566E-4f, 0.015234606790849791f, -0.010338183109797438f, -0.015303332140790778f, 0.003867659335979767f, 0.007417728586065516f, 0.023339222798514407f },
+{ 0.008431443256821046f, 0.008381937730322976f, 0.015429950153357951f, -4.229910905334883E-4f, -0.008284047944140886f, 0.0034535330870862292f, 0.004141644374372744f, 0.0010297027988804867f, 0.010283086836202293f, 0.01574613387624239f },
+{ 0.013110278519328345f, 0.0027903811777478713f, -0.04956826876968764f, 0.022702504936593527f, 0.017637286468493572f, -0.02819616958052936f, -0.01834906364993682f, 7.483801311565366E-4f, -0.032826571052491135f, -0.017208202874238233f },
+{ 0.017172382092353798f, 0.008255726654864919f, 0.008309790740779015f, 0.011425471216322565f, -0.0028901355175821857f, -0.0020529086808858277f, -0.003593750729737489f, 6.427943653386392E-4f, 0.004048880987497847f, -0.008074403208267673f },
+{ 0.01376536768677284f, -9.68450943372704E-4f, -0.026822287829444486f, 0.022532526764446115f, 0.02631857783022168f, -0.025584326345510854f, 0.012304544028488256f, -0.018659486722348777f, -0.013179547589879579f, 0.0015826842747197261f },
+{ -0.0028244756481751758f, -0.005783205497024932f, 0.01578300632764226f, 0.011099258527992567f, -0.008188494650718865f, 0.005382419613276359f, 0.0038995275217613714f, 0.00986624157839776f, 0.0195359213625182f, 0.005901151182404651f },
+{ -0.0054778079246106375f, 0.009360042979090535f, -8.543993786942955E-4f, -0.0062502163991386165f, -0.005629481315640954f, 0.01369135362367997f, -0.004570637222823771f, -0.0017588391400986932f, -0.011017202011114715f, -0.00969465369293113f },
+{ 0.012804951819972933f, 0.028383104583478657f, -0.002146030347338067f, 0.02190283640875459f, 8.198538277372446E-4f, 0.003384678555796936f, -0.00902730153296875f, 0.022719650845392413f, -0.006155166580232698f, 0.011910072702375287f },
+{ 4.272492485072345E-4f, 0.0044166862973099566f, -0.0031310384255659914f, 0.002897661099837208f, -0.012512776928096226f, -0.020371604477964707f, -0.0015290704978972041f, 0.008566234275837041f, -2.0039720017611798E-4f, -0.00990594651642095f },
+{ 0.026249141824014274f, 0.004579850948150026f, -0.019494888738397095f, 0.041544164843812986f, 0.018228303161897115f, -0.030922270061011475f, -0.010164393633631917f, 0.00410107763800263f, -0.02628609222909792f, 0.008020466318998214f },
+{ 8.317706461288481E-4f, -0.010662051518370491f, -0.003026340868595966f, -3.066302034303778E-4f, -0.021092963493005913f, -8.191142612013507E-4f, -0.016590984312855994f, -0.01777434395525062f, 0.013983596116774034f, -0.004219753877573625f },
+{ -0.05592614271293662f, 0.03919515591364252f, -0.08492109174406241f, 0.07141350092020322f, 0.09568116012113813f, 0.022227368353122886f, -0.11342405061202089f, -0.04922201989296738f, -0.09214028675061424f, 0.06289592509937912f },
+{ -0.011465834047982527f, 0.015906212256139272f, -0.016934288370285096f, 0.005759864821984019f, 0.015692695271837552f, -0.009315851357683848f, -0.014343383326859173f, 0.006830479400972367f, -0.016955629493704084f, 0.03677197087330052f },
+{ -0.049983412175550045f, -0.0043385229283116914f, 0.009514995409706588f, -0.048606024668713485f, -0.018120391344794602f, 0.019796449910911004f, 0.0026656913934511943f, 0.0335449383161117f, -0.014596220839880386f, 0.010495013947782478f },
+{ -0.0691774655076038f, -0.19674690713834228f, 0.09888544355476771f, -0.15193213776386605f, -0.14601919609490083f, -0.017116021444100838f, -0.01407431082921816f, 0.021530027592375725f, 0.00588846331041467f, 0.032719697030150464f },
+{ -0.019992126091471534f, 0.009996913545668291f, -0.06657252830016996f, 0.14608318856916366f, 0.13872729747019874f, 0.0026270853642013483f, -0.07602455599018287f, -0.04341516993537414f, -0.12726971161111175f, 0.005957477048122011f },
+{ 0.0010462406672256226f, 0.00985963239221741f, -0.011097053351346576f, 0.014106734199071266f, -0.0071644773470803174f, -0.0031704768125924133f, 0.0024766365853145155f, 0.003730853293679038f, -0.004607272312471682f, -0.013488678137710085f },
+{ 0.009848140508757864f, 0.016032025624742433f, -0.017506362551232f, -0.0055413622492612525f, 0.013866978824401032f, -0.010825109129263629f, -0.016195699997671516f, -0.0037523728013083516f, 0.023514828531206913f, 0.0028604021196987576f },
+{ 0.04189174021999496f, 0.08872612631183249f, -0.05474496174512534f, -0.033942118247166066f, -0.012916978199142904f, -0.04181865348103275f, 0.019461338410758318f, -0.008871048779691842f, 0.06647332525437379f, 0.022191028425045584f },
+{ 0.016380185478063893f, 0.03367391124681713f, -0.015707239005732482f, -0.010468417720617853f, 0.03681634938037581f, -0.02477070447177114f, 0.01189400049445118f, -0.021052312024998816f, 0.04403502457112304f, 0.007476619246793202f },
+{ -0.04959040049488221f, 0.01932430536357784f, -0.008887119529878485f, -0.03918329857645323f, 0.06842214415445069f, 0.0016257787639933645f, -0.05394953551601107f, -0.11083587556587879f, -0.03609535268488755f, 0.05812921942697552f },
+{ -0.013168380705546188f, 0.023261492826635234f, 0.018891835711587555f, -0.004216317548702049f, -0.022136774394646678f, 0.008008642137023438f, 0.00709633981475457f, 1.2338017479258397E-4f, 0.02848380968600995f, 0.005410651177483341f },
+{ -0.002738154404147455f, -0.010501971581455553f, -0.001273253285874907f, 0.003868572210072358f, 0.030244541188432773f, -0.013241731985721471f, -0.005236738305928054f, -0.030371357243319113f, 0.005788176873955942f, -0.006809717236572607f },
+{ -0.0023769298944360056f, -0.007363426653335152f, 0.014495975244826964f, 8.825096578439888E-4f, 0.001749024970857791f, 0.012357474902941826f, 0.0015803291297717121f, -4.533457562664533E-4f, -2.1834044976682052E-4f, -0.009080217149667148f },
+{ 0.02790908815557429f, 0.06132805166881528f, -0.01729964338941318f, -0.012888422518737334f, 0.01676542134038871f, -0.013209848687776833f, 0.020702441465825304f, -0.004820690380339997f, 0.05129840156240941f, -0.010101488048814042f },
+{ -0.01967805890430976f, -0.009309832855832057f, -0.01910048662921774f, -0.005132427533369863f, -8.384528223911868E-4f, -0.018869268960479243f, -0.02726446401882757f, -0.013587482172717269f, -3.0197099576514456E-5f, 0.016989119688371745f },
+{ -0.010739389077330533f, 0.0038079691857375282f, -0.011688311712760394f, 0.01402420391939027f, 0.03147127292874651f, 0.006552690926026442f, -0.024828892356853417f, -0.051719812398359016f, 0.005579211350471894f, -3.9919185018134055E-4f },
+{ 0.0061738304547842f, -0.020580399233223152f, -0.01832405478483404f, 0.014979327006629432f, 0.030203863050032306f, -0.0039536214693144936f, -0.011208528423941908f, -0.03503261887487376f, -0.007781189942749428f, -0.020113632389366618f },
+{ 0.015306508070591106f, 0.027530201937842037f, -0.03147313902431107f, 0.03618351769640378f, 0.07789968403050032f, -0.018755698067719345f, -0.019353616214902076f, -0.05917375752859373f, -0.0013270103026961101f, 0.005669969360171255f },
+{ 0.02137136375041496f, 0.002021599153587689f, -0.030368046176409393f, 0.03764000281694609f, 0.01744614825163898f, -0.02275963426052236f, -0.006065643583202931f, -0.020765398089405463f, 0.0022493012238114156f, -0.011528153727243057f },
+{ 0.020679152149318487f, 0.005808793179136594f, 7.125574631186198E-4f, -0.003228773734892914f, -0.007389396840201391f, -0.0038021686846461686f, 0.003163753245575235f, 9.820721687259434E-4f, 0.005158177753019045f, -0.0070024433404304f },
+{ 0.02071217476979304f, 0.004665221144945026f, -0.020738065600973347f, -0.006777311914297318f, -0.03871099074701677f, 0.012112403130520491f, -0.0031383885199334455f, -9.651238266389032E-4f, 0.01595084007678589f, 0.00472235414201444f },
+{ 0.0650537583058094f, 0.0412304722693199f, -0.030354848603366583f, -0.03156576252200993f, 0.053606414528301664f, -0.05296211400897961f, 0.026648203645491267f, -0.019016577806791186f, 0.11466142882234157f, 0.004745635910454563f },
+{ 0.014556976719773837f, 0.0091336891219853f, -0.011400108684016199f, -0.028051774845803706f, 0.025501800519708993f, -0.0209292811837689f, 0.0040128151445873355f, -0.009826591810288358f, 0.043500817819439624f, -0.0059964317807659285f },
+{ 0.016651866815680417f, -0.023531825015393325f, -0.017996943140672652f, 0.020883219036288224f, 0.047706832754143905f, -0.008243905660769662f, -0.012834499853031603f, -0.03984720769338448f, 0.030971782134186686f, -0.005693090665410304f },
+{ -0.007118636200194335f, 0.06373468158494666f, -0.04852354258909643f, -0.014543953719687586f, 0.08690354147354573f, -0.06446306936359013f, 0.05004640014260321f, -0.04058109898286796f, 0.04362429532804654f, 0.012316411804503163f },
+{ 0.039048534249694816f, 0.07212581686844023f, -0.04303117583760529f, -0.05057584808337567f, 0.09807430586252673f, -0.06363131826399006f, 0.05124902866690955f, -0.02738930518805796f, 0.07378199224890863f, 0.004395156338124049f },
+{ 0.009267029033333776f, -0.0011335206635846589f, -0.005664281391377672f, -0.005666141433053331f, 0.024131196843639683f, -0.02264371408912014f, -0.011633150302881723f, 0.003994888893940604f, 0.008822793257011914f, 0.0029457450364898078f },
+{ 0.02093732028588332f, -0.010368636156056583f, -0.016166120436371535f, 0.01669841633778685f, 0.0324572328184218f, -0.03755612740831808f, -0.005373229554209031f, -0.01284404616085764f, 0.014592547343531064f, -0.01039626245061587f },
+{ 0.010021782045481773f, -0.07411433250847896f, -0.03368516805092236f, -0.07013679415112861f, 0.03354745075831163f, -0.07753342494613764f, 0.036660968356601396f, 0.0405181700169168f, 0.16181913374768053f, 0.041188534967067404f },
+{ -0.07832300955670461f, 0.017598075681215207f, -0.024835337938004232f, -0.039023470928426014f, 0.10612266514072309f, 0.010935723250526096f, -0.07052693748598189f, -0.07663685601793337f, 0.029361541065029258f, 0.07971664771706743f },
+{ 0.021530406019594966f, 0.01798691993015729f, 0.005560865756926433f, -0.02078076871279195f, 0.04059338797766732f, -0.00811753562691062f, 0.01610740954103561f, -0.053893285135017344f, 0.015849925476312362f, -0.008833234231620714f },
+{ 0.057890338617813175f, 0.0778819210479824f, -0.07697304867149646f, 0.02907935107006599f, 0.03152304996786512f, 0.020509166706234268f, -0.01552466003289807f, 0.004276966276505953f, 0.08502885204364172f, -0.12408919509355237f },
+{ 0.04950565638050496f, -0.05936953632144006f, -0.052465008864661725f, 0.10256113527716966f, 0.0898082907357915f, -0.0019407232005575082f, -0.07920903975849033f, -0.0554093091891319f, -0.01209484847617107f, -0.022998113241492164f },
+{ 0.027540179017242792f, 0.04988687956778038f, -0.05305165877872741f, 0.002628383616679811f, -0.021467182381419328f, -0.028151894050540034f, -0.013388949358053057f, -0.01862047966791106f, 0.03485797029454097f, -0.03167603414718864f },
+{ -0.037622169563113254f, 0.026709022255977967f, 0.06875340646280229f, -0.06243619359093999f, -0.2562935095185516f, 0.08385538590439212f, 0.027980184994842783f, 0.12471324455956669f, 0.09237986051087119f, 0.04515213709555308f },
+{ -0.02004004511446555f, 0.009232511890214833f, -0.017343111395545216f, 0.1062616731432959f, 0.15158904629310868f, 0.028502973088671918f, -0.022717889061770486f, -0.07263813579918363f, -0.11268044403399141f, 1.1811534537612436E-4f },
+{ -0.0017514005445570335f, 0.008342181164263775f, 0.014870122286571134f, 0.052279169307107395f, 0.011289751682077532f, 0.03725449611994982f, -0.08277829409357808f, -0.049198292946623f, -0.07426251692415588f, 0.01641054134635416f },
+{ -0.03526092546207483f, -0.01402060096120333f, 0.050717215406433834f, -0.06129486822147126f, -0.08082853721549219f, 0.0381473926480292f, 0.04247382526268277f, 0.026767680608569558f, 0.02545539922238103f, -0.0040224447707629864f },
+{ 0.05491281072378466f, 0.11302923031271697f, 0.16408697939708125f, 0.016513521999113486f, 0.0942062464092881f, 0.1921685669189769f, 0.04671757677183706f, -0.21264178041081203f, -0.32624557762108536f, 0.03787048088346675f },
+{ 5.246978439966988E-4f, -0.018712843537878002f, 0.016404237677465103f, 0.0028758908220022574f, -0.013941837220612452f, 0.013637225806088834f, 0.004239171410948336f, 0.02174151440725604f, -0.02607709260459441f, 4.907792934743934E-4f },
+{ -0.010400649973027072f, -0.011006470555938069f, 0.06087521054432344f, 0.003307175024223222f, -0.12454389245925135f, 0.0460962107412404f, 0.04372664619298821f, 0.1348399718381108f, -0.12466664511672051f, -0.0036693215803454047f },
+{ -0.02073222398013532f, -0.005949378137275389f, 0.033704061163519206f, -0.02237586929552192f, -0.04423672879065896f, 0.014699855225162433f, 0.021736938260714003f, 0.08247406897458838f, -0.019277531541581027f, -0.06295619558863635f },
+{ -0.014614683685658632f, 0.02585785277524118f, -0.010211904829513127f, 0.03256447180287724f, 0.011410750037807239f, -0.0064333378413881466f, -0.005771806126730615f, -0.009401395273961229f, -0.023034359939316948f, 0.022855492577070653f },
+{ -0.006197182787318659f, 0.019048658101652245f, -0.04526457806278754f, 0.14599318724561894f, 0.13099653956463964f, 0.0029922498958095986f, -0.060529294268853485f, -0.06495341410209417f, -0.0802308670341658f, 0.04055014780034317f },
+{ -0.011098872647294367f, -0.0019365398503181528f, -0.002879953886098518f, 0.003536717402422574f, -0.0079653364943238f, -0.015643836087342437f, 0.0013274469890125398f, -0.0017504066358821687f, 0.0026330885305461587f, 0.0285199736556799f },
+{ 0.005930449803374283f, 0.021110669730763528f, -0.03222270905352158f, 0.00192440331618168f, 0.00510463566733743f, 0.001734685165153466f, -0.00771293689721491f, -0.016421897149454596f, -0.019270263573364758f, 0.021329952803356356f },
+{ -0.007783963735201239f, -0.007920790090599185f, -0.020687874034988406f, -0.020488079661546362f, -0.0019011580642889381f, -0.018736843471999876f, -0.004566694765036501f, 0.004657762883619322f, 0.0011172036753107346f, 0.004798317534181712f },
+{ -0.011382790117972516f, -0.014814790379218398f, 0.035525954817695195f, -0.015760360150104416f, -0.04583448837765392f, 0.02769741506756472f, 0.016240558923291393f, 0.0304674878068012f, 0.0089809838128398f, -0.01962542612171562f },
+{ 0.05690776620775648f, 0.02728285636489705f, 0.08915080459418101f, 0.029991869415229827f, 0.050081069851689565f, 0.08288477262850748f, 0.004599617742520056f, -0.03829783024019071f, -0.12393270438279609f, -0.021649269389465386f },
+{ 0.010078537433176516f, -0.003683593499230478f, 0.034286340196366505f, 0.026155741529876507f, -0.03862021412701013f, 0.03280715667891752f, -0.018500333740794787f, -0.008972996252584449f, -0.06370775283628803f, -0.002795596341829136f },
+{ -0.04389217167493832f, -0.02144557173057866f, 0.07236889388744766f, -0.06747610968159871f, -0.11899137071800873f, 0.07329219779395311f, 0.05335629113532495f, 0.09382796033322498f, 0.044013321032897554f, -0.06614015412781181f },
+{ 0.01788484436547321f, -0.006118409935979232f, 0.08520342973312425f, -0.023352685563236105f, 0.02313142637889828f, 0.006978688464065344f, 0.011869820576775854f, -0.052097164309955084f, -0.12236400208954755f, 0.007864151282418786f },
+{ 0.018571490172715116f, 0.01279347346738699f, -4.40348630134416E-5f, 0.0027976933551013953f, -0.004161448516929293f, -0.0021495021533076662f, -0.020760734288858336f, -0.010317465818558628f, -0.004206297602362849f, -0.003710092175070723f },
+{ -0.02506446489726662f, -0.0037069046033956585f, -0.01036698893971958f, 0.011347154146718955f, 0.03458284890621143f, 0.015217684857070413f, 0.011673651093146697f, -0.012237077618625634f, 0.025678369225296812f, -0.015239336817573635f },
+{ -0.021798579214503247f, -0.06775138369519373f, 0.05853041474978259f, -0.04295050336256841f, -0.10871935999755333f, 0.08703626691540951f, 0.047370869931099735f, 0.025965451736439597f, 0.05706627170563556f, -0.10298272673537374f },
+{ -0.028469629589098627f, 0.00157742799124415f, -0.02739750127967018f, -0.046374503810800834f, 0.04249650552593363f, -0.032664185355517544f, -0.004321013316554171f, 0.011251718787267878f, 0.11197413560860349f, 0.013840828366555336f },
+{ -0.036255466295619265f, 0.03275001069036148f, -0.037122718720917616f, 0.03430347525142692f, 0.02516848466757166f, 0.025864638169179072f, -0.023229925253105646f, -0.014916169697998137f, -0.017895751167188563f, -0.004760020137593356f },
+{ 0.005831594631762987f, -0.005792978155652197f, -0.005755783799027557f, 0.00824359262105412f, -0.016855479334714634f, 0.003647632870132397f, -0.004305405232352503f, 0.010755084704689435f, -0.0035235581052201694f, 0.003635216419260946f },
+{ 0.0023605482280129415f, -0.0038460097791193854f, 0.0031199717444318066f, -0.007600013809718227f, -0.0158315776744255f, 0.021773040605046895f, -0.004468715045469472f, 4.2210931382383383E-4f, -0.0025754970793472015f, 0.0014831475141598048f },
+{ -0.013820138720879593f, -0.005144512355680938f, -0.0018554968599625138f, -0.0035396972686579427f, 0.008685020756468266f, 0.01729388813494318f, 0.01848384165686804f, -0.033620319659393785f, 0.008720153156586011f, -0.0017804745820939427f },
+{ -6.402924592169103E-4f, -0.008424690993551965f, 0.006939885152252078f, 0.0016994213353596558f, -0.010588427020150093f, 0.0037716806116905176f, -3.1674379398775594E-4f, 0.013072463239564335f, -0.0319169005045332f, -0.015867139254857856f },
+{ -0.014590046913844907f, 0.0014447320211634761f, 0.03860494872987877f, -0.027550316971575645f, -0.04419565949380621f, 0.04496216153748763f, 0.019454034485111144f, 0.031670551921124224f, 0.025325464308257387f, -0.031066652298500433f },
+{ -0.006769875061518608f, 0.0011186327385590933f, -0.0017409421478598497f, -0.014997070072399645f, 0.0058774845111510135f, 0.004948243420931894f, 0.03051363092738065f, -0.011079606297089229f, -0.02255970374602274f, 0.0015474441290525272f },
+{ 0.001469973880788386f, -0.037890892305431495f, -0.03969133348090906f, 0.09380247660219497f, 0.08949693505948211f, -0.05057764850551661f, -0.0380875915657584f, -0.044203767104620824f, -0.07935145620305172f, 0.06056590687175684f },
+{ 0.023845655548168383f, -0.015962484449496016f, 0.03402579229526233f, 0.026859228801445208f, -0.023270056638820123f, 0.023130390021123496f, -0.01847157560128918f, 0.013883561289469605f, -0.031410549663858346f, -0.016094132393659935f },
+{ 0.0012648424383400142f, -0.027343562220654847f, -0.019791562022489433f, -0.004099841263603066f, -0.031003688807403708f, -0.006505379529511182f, -0.007051161320986916f, 0.04595433512225769f, 0.024189223901830058f, -0.015006145073116206f },
+{ -0.011849111829781754f, 0.034424280569061f, -0.008044390841013993f, -0.02968019428103518f, 0.058344755092422755f, -0.008664014321714658f, 0.005548698223564698f, -0.04427911078457991f, 0.018873930700599464f, -9.481432620636202E-4f },
+{ 2.643102192843038E-4f, 0.0056618862694410785f, -0.021604594794726144f, -0.0015602065418035692f, 0.03861863448564088f, -0.012393336416955602f, -0.0037511315434281076f, -0.007160919821769164f, -0.009320524706527332f, 0.0042966864221113095f },
+{ -5.681488127045781E-4f, 0.019707320708277312f, -0.023231693991402846f, -0.0011406550108969179f, 0.01151983218494242f, -0.01813358646663371f, 0.004023902654775571f, -9.634647285828885E-4f, 0.012736464331287398f, 0.009544622549630902f },
+{ -0.0015531095895462005f, -0.01476441120423959f, -0.011789683508297295f, 0.014563009526597285f, 4.0951489880288247E-4f, 0.01900080221471168f, -0.007311856000905959f, -0.0148195192052628f, 0.01213146162810955f, -0.0028438833784542677f },
+{ 0.003144689158321595f, -0.017072653592964875f, -0.010638505356051466f, -0.0029368416305323415f, 0.002755186028889357f, 0.006833584447676372f, -0.016607888423511834f, -0.003261865208309606f, -0.0015445725799985309f, 0.009498633485900734f },
+{ -0.014003002375021537f, -0.004523034942062381f, 0.005466832510822084f, -0.013616772833623727f, -0.027056525813387345f, 0.009308577114508325f, -2.430501111052895E-4f, 0.01010374130964757f, 0.00407216685194609f, 0.01469691908344938f },
+{ 0.003435589859491018f, 0.004073912229784595f, 0.010041318941176571f, -0.012009832085980873f, 0.02692717823766171f, -0.016568070028169544f, -6.387582353462378E-4f, -0.003910144355326108f, -0.0043883630123562525f, 0.005966264172094901f },
+{ 0.0017033162878221215f, 0.031553992980899295f, -0.006242286262089656f, -0.024674122709864747f, 0.026118461540142367f, -0.03035101228380397f, 7.318878357465363E-4f, -0.0303561747073526f, 0.03639712957940263f, 0.03533547796521847f },
+{ 0.013039678925714214f, 0.004316646334182418f, -0.0028505032242980275f, -0.008639742975347312f, -0.0032096927024390168f, 0.004855111137054819f, 3.408389555849938E-4f, -0.00899374823975664f, 0.004842110061041487f, 0.033928117980220864f },
+{ -0.008810490666635891f, -0.005847649911195303f, 0.014901657122952447f, -0.0076762047865702975f, -0.015410682640506018f, 0.001977380515369965f, 0.002184264610101911f, 0.012697125039442002f, -0.008982107111759553f, 0.018394680791701788f },
+{ -0.013467952857399202f, 0.00313298142988004f, -0.0067627631061232246f, -0.009774336482486629f, -0.020113576186923977f, -0.00876182883542371f, 0.006458466423097355f, 0.009717201775146216f, -0.006370141562967705f, -0.004139414226137565f },
+{ 0.00925492496720925f, -0.008431097478081875f, 0.048923009222381506f, -0.023047569109671956f, -0.10793075147714412f, 0.0412390405068055f, 0.018664573739386868f, 0.06696430598847636f, 0.02860318285193874f, -0.04967664455723936f },
+{ 0.0030598728467839654f, 0.008344349903332934f, -2.609879586669574E-4f, -0.0031481318900466737f, -0.02253717142086035f, -0.012466869145299974f, 2.59208193937355E-4f, 0.004703609180896541f, 0.018292935884375843f, 0.005674705683588219f },
+{ 0.005322977200031543f, 0.005980934939993876f, 0.008567609236631059f, -0.01055847884833699f, 0.005611694714916333f, -0.009208796019014977f, 0.020521568310699657f, -0.003134851074548843f, 0.012105720515116125f, 0.0021952107683669802f },
+{ -0.001568763273904139f, -0.02178104072294607f, 0.00919153923792756f, -0.026730316306520535f, -0.014292002773623667f, 0.012747224029349559f, 0.008549156575183932f, 0.018990323590272244f, 0.0029293266592969555f, -0.034102785518777164f },
+{ -0.003903510121038116f, 0.0013921890514703137f, -0.009339948123046655f, 0.00967471338484742f, 0.023848807784406366f, -0.014526120002900702f, 0.006557076666613872f, -0.007224600610113628f, 0.023016568588134608f, 0.012926150611643313f },
+{ -0.006280931278441995f, -6.016181523044326E-4f, -2.7850405724274885E-4f, -0.009286523202815138f, -0.02239050655310208f, 0.010751665344717626f, 0.008772278603302678f, -0.0035631927204605495f, 0.01001645957079304f, 8.713512659195032E-4f },
+{ 0.004068545621239062f, 0.008182297131813137f, -0.024725428091611344f, 0.016012619494616416f, 0.027673826355135267f, -0.003952742174444015f, -0.011200601391052957f, -0.032046447883416374f, 0.002789236643040344f, 0.015729386271419926f },
+{ -0.01666767147501962f, -0.023361491548542303f, 0.01990877398410216f, 0.030330583540224346f, -0.049030880234445774f, -0.00906059643941012f, 0.033958767215844586f, 0.03316165023923836f, 0.017397879670829095f, 0.03749329802247834f },
+{ -0.01393869856871785f, 0.024567824330529293f, 0.005348531404145828f, -0.07521934319386134f, 0.04779438276594816f, 0.07712916800064085f, 0.016849762960114367f, 0.02748847468911601f, -0.017989125968132534f, -0.05948400957767948f },
+{ -0.015511378664445397f, -0.008185439936568872f, -0.027946125860740745f, -0.053213166694780226f, -0.05126606930970309f, 0.01376844373457134f, -0.03926038526598556f, 0.05125611390650799f, 0.009124434493006997f, 0.015506454113812018f },
+{ 0.016210629925734972f, 0.11687619538739598f, 0.007010734230238966f, 0.005392012319371516f, 0.01878197110137384f, 0.09174467187924437f, -0.00847147626711546f, -0.005885614705903601f, -0.034212213769725885f, -0.06672761294546221f },
+{ -0.02252557499027144f, -0.026261710340799386f, 0.04558107999835873f, -0.08316041454041635f, -0.05221769828663683f, -0.03726635156631857f, 0.02734506429777869f, 0.029132136994688217f, 0.004275095612919236f, 0.03561953314848155f },
+{ 0.01719008741050577f, 0.007067589937303482f, 0.00942659328789116f, -0.007591540156102776f, -0.0011010176201272004f, 0.0017007866956219224f, 0.006800552243290054f, -0.017372313748556408f, 0.005884502304451953f, -0.007231679714836624f },
+{ -0.03205598655605064f, -0.010017806059487036f, 0.08342026542505222f, -0.048327217020163044f, -0.06884174921554191f, 0.006838806904426384f, -0.002745557595688683f, 0.0393228588918134f, 0.0158502216232446f, 0.019404124484424155f },
+{ -0.010109678211782453f, 0.006795188828768022f, 0.019342954026800394f, -0.021679750501107896f, -0.018256275593378564f, 0.01260778989203277f, 0.00213845693534294f, 0.021639933117946344f, -0.003048196026763973f, 0.0027290821301569537f },
+{ 0.016097179792884463f, -0.03150536330863159f, 0.039669307493036154f, -0.07337640178579798f, -0.07168050133148965f, 0.017769569050346313f, 0.033829847520013265f, 0.05314793994324327f, 0.007561412493552427f, 0.009610376516986657f },
+{ -0.024515759749943918f, -0.02688921318277695f, 0.007169355694831396f, -0.01321354219833786f, -0.007520473364552754f, -0.004523872499151385f, 0.009090446397549279f, 0.029952473128048548f, 0.01983487553746009f, -0.019403006157175513f },
+{ -0.10216717247928388f, -0.03425078526776068f, 0.04976578723949644f, 0.0035888541517222683f, -0.036412441924155915f, 0.05449146099909243f, -0.02993414944156964f, -0.024538963678798265f, 0.012194941458119378f, 0.011232165105129296f },
+{ -0.021325551758264415f, 0.007653172717196147f, 0.031186534628793044f, -0.006817183989382897f, -0.034069226135051076f, 0.04103694990851162f, 0.026249515055597805f, 0.020335047544456218f, 0.0037959975952678846f, -0.0168412888356188f },
+{ -0.032905476155056644f, 0.004777944113404964f, 0.06148865319742168f, 0.005188567254040686f, -0.07870862497016592f, -0.004987946086909861f, 0.0455526016655552f, 0.05783998070823349f, 0.012927527638336175f, 0.01973040831287536f },
+{ 0.008908660022644238f, -0.043515468813090714f, 0.05882711128504907f, 0.004146408868248709f, -0.04777426218523861f, 0.05430635704777778f, 0.07626339265829189f, 0.013236736133191042f, 8.232108773941175E-4f, -0.07536408983262305f },
+{ -0.054460280548421704f, -0.07352943760983932f, 0.12430362907297642f, -0.07116758615873242f, -0.13040388715393067f, 0.08560503609036878f, -0.003364902385406693f, -0.038586359443099176f, 0.0451024517265456f, 0.025000828197465068f },
+{ -0.002337744110116237f, -0.01273575450795323f, 0.015905879661133746f, -0.01765594082553004f, -0.019263914197554126f, 0.005277525442668101f, 0.01852269861895456f, -0.00587697783208253f, 0.0014087088769308342f, -0.0035519282395943437f },
+{ -0.02417227193100003f, 0.009396232044972244f, 0.01846424170582785f, -0.029655524794876507f, -0.002616458333605163f, 0.021049738652898484f, 0.01050582978721715f, 0.01565857896421644f, -0.007252734175858485f, -0.004273642208637039f },
+{ -0.01161112345104283f, 0.005136709242207467f, -0.005316092794973151f, -0.01809487761243383f, 0.05513026938401625f, 0.010418183443260136f, -0.01935810362570554f, -0.03243626670916465f, -4.4893039083281744E-4f, 0.0036575647908705096f },
+{ 0.020859140693931875f, 0.0017548004539918738f, -0.009571115738890511f, -0.0025368290827623855f, 0.01804668910827722f, -0.007847927181847207f, -4.0473228056379245E-4f, -0.0274311639394789f, 5.936616220680959E-4f, 0.014484402725542215f },
+{ 0.00939904966582205f, -2.479400643640551E-4f, -0.01603836602827021f, -0.0024843044687731853f, 0.034507707714088606f, -0.004464560718999913f, 0.012648274904867984f, -0.03375725293850425f, 0.006633038260426567f, 0.01663367710802352f },
+{ 0.011613896040750596f, -0.007916858583292167f, -0.006081199964593964f, -0.0062896603578565385f, -6.815494648685368E-4f, 0.001122982966203444f, 0.0040389963394157225f, 0.0037790455611828983f, 0.015392388329653969f, 0.015317440355424929f },
+{ 0.011401418483547537f, -0.0030012889018351903f, -0.005647110629402759f, 0.010297398587286193f, 0.02006932210690161f, 0.018152831251043482f, -0.00123039777011796f, -0.01693747511597046f, -0.006787004393860654f, 0.02129673933049715f },
+{ -0.009341885401233782f, 0.0032556417838700683f, 0.012640863177034814f, 5.897369976014532E-4f, 0.02053872703602336f, -0.01891453709820053f, -0.004510453683853811f, -0.0228655699773551f, -0.008851598024218366f, 8.487141309741464E-4f },
+{ -0.026491750482830118f, 0.029082791555591923f, 0.04276599890940272f, 0.014903425690879345f, -0.011511532252109609f, 0.025230375334866183f, 0.029744406042903654f, 0.021448557334724193f, 0.0010265510707174758f, -0.0036285374904328504f },
+{ -0.007180799579782121f, -0.025497896075519035f, -0.01845043517754549f, 0.002786570904963742f, 0.07332040683988574f, -0.024833605842546225f, -0.024044068042725863f, -0.05300408933216878f, 0.0021577888344587065f, -0.005497731273869416f },
+{ -0.005106662851294023f, 0.004318694376908125f, -0.012731509963650982f, 0.029707674570565078f, 0.04825355208154361f, -0.009523263915017533f, -0.017736422716792145f, -0.032067504285845254f, -0.02839143760973676f, 0.011648298294862155f },
+{ -0.005989578837506907f, -0.022852104924122665f, 0.044825393813920526f, -0.02129304341887682f, -0.002439197456880233f, 0.007937099586192433f, -0.0064243927022909495f, -0.007198418277604821f, 0.001058389371320093f, 0.02075445651553481f },
+{ 0.006517974465638895f, 0.005203696526817953f, 0.00467474863903691f, 0.014614647153193577f, 0.001998470989660837f, 0.006644993676257365f, -0.0041649693832054874f, 0.032778735552136895f, -0.026458116929575077f, 0.0160564710433677f },
+{ -0.02986287919171399f, -0.04728294679980345f, 0.006634372359878754f, -0.02971937398339595f, -0.03297205870894847f, -0.009145920967051286f, 0.018270017537518505f, 0.04740146860009454f, 0.0590630287461351f, -0.02947831667668828f },
+{ -0.010081419212975725f, -0.0528728242066497f, 0.04915668286708088f, -0.060782845841041655f, -0.08960611056469667f, 0.021094972173544235f, 0.018035542310399933f, 0.026113919373066428f, 0.08058422454701855f, -0.0401210893230514f },
+{ -0.036278829645980205f, 0.027375062739855356f, 0.030738800484526284f, 0.019002716033112363f, -0.017519192683937295f, 0.03147843616994312f, -0.003736623432075735f, 0.018783749776977915f, 0.007970551301313706f, 0.008174737472325154f },
+{ -0.009589024158702615f, -0.02060683900497343f, 0.03832186008361103f, -0.014464225538879527f, -0.005174426789463243f, 0.007317178886774992f, -0.018502067227170033f, -0.007402764361091307f, 0.03552454885452782f, 0.021961177023696415f },
+{ -0.010122344749438876f, 0.01786820150598549f, 0.011077993514868758f, 0.02351170525526676f, 0.0018157358738725283f, 0.018988546064359145f, -0.006050764774259272f, 0.01976024869445696f, -0.002904208094019519f, 0.013088961370499197f },
+{ 0.0025566346500300705f, 0.008029672389139203f, -0.008367979739841215f, -3.853123638139174E-4f, 0.0172806577173596f, -0.01979027230201835f, -0.002029451274315967f, 0.00958436974813518f, -0.009696424538298963f, -0.01647727149996374f },
+{ 0.010595778882731218f, -0.002180780367279519f, -0.013421385586475246f, 0.009652629706956059f, 0.04112747041513083f, 0.001514038685132449f, -0.008648942145194861f, -0.03200377581903562f, 0.016334691847393022f, 0.005616879871443268f },
+{ -0.017731857979584223f, -0.005715040053183093f, 0.01878135566585548f, -0.013650164173719807f, -0.04343291565176602f, 0.030257836861547836f, -0.005983572658270405f, 0.023796425155318414f, -0.024588512110434408f, -0.007038324324038625f },
+{ 0.0038419706439426944f, -0.02926823033103969f, 0.018789934088024277f, -0.014182625711403295f, 0.027085437583778512f, 0.006238321695450112f, -0.012904531402883945f, -0.024327906746963727f, 0.03240766991648176f, 0.013862760202545453f },
+{ -0.01766743069177887f, 4.1848424895696865E-4f, -0.0022563805998532323f, 0.0050872525226960145f, 0.02457360483730925f, 0.01668486539984747f, -0.011463779842297038f, -0.03829279052375668f, 0.002896199494659489f, -0.004094943424587163f },
+{ -0.03454500327765117f, 0.011767213943637141f, -0.0012761250186815365f, 7.109668604258115E-4f, 0.0525885137598173f, 0.008971574690325446f, -0.01998147827004809f, -0.020556508305869067f, -0.021619855529669222f, 0.006366544688384524f },
+{ 0.019975525167512744f, 2.2078884881159648E-4f, -8.93845766687889E-4f, -3.827962298746587E-4f, 0.020763018703123436f, -0.0131577758857247f, -0.020376785271592854f, -0.016307701672355117f, 0.002654166518079264f, -0.007766654086333095f },
+{ 0.004331656306549875f, -0.005542451589923846f, 0.0030007294391137455f, -0.004413005321015443f, 0.0032865333114706894f, 8.284750508989794E-4f, -0.0010485658369528974f, -0.003465031438589403f, 0.008140534250417612f, -0.001842331246485997f },
+{ -0.01224709548003883f, -0.01844026470736626f, -0.0029099499901205136f, -0.02690634121588212f, 0.0028998014345359567f, -0.005026137178937344f, 0.01835930096021401f, 0.00909443583521287f, 0.010332683745562793f, -0.003082666387288714f },
+{ -0.0334278871659752f, -0.01303796829982854f, 1.8476577928247707E-4f, -0.020056557338394284f, -0.011006526044099909f, 0.011746413517063412f, -0.04045715649241517f, 0.015256538633523548f, 0.04364186706215237f, -0.012864514249104808f },
+{ 0.006020623661407331f, 0.020431635343569163f, -4.5332696063290786E-5f, -0.012142780969970861f, 2.9231149456702244E-4f, -0.0034496069502681893f, 0.04363720163486197f, -0.01254327692102565f, -0.013201814153759216f, 0.015437853084204851f },
+{ -0.004896618389183179f, -0.015432295979599867f, 0.005940668374500814f, 0.004878798444067609f, 0.010281256771296952f, -0.031060704003160154f, -9.607173235436653E-5f, 0.013481956571824572f, 0.004035335002051163f, 0.016168721127080114f },
+{ 0.02205995948009288f, -0.0027111206602414345f, -0.010769596325218428f, 9.774551233101279E-4f, 0.04217216119795886f, -0.02909336453268757f, -0.003912827855289283f, -0.043318109104972816f, 0.039966260375190646f, 0.02877906599128369f },
+{ -0.011428595960989085f, 0.014289352402531293f, -0.009724285387034034f, -0.011676978335939196f, -0.018329640940765765f, 0.022744047036901638f, 1.6633843489480935E-4f, 0.003211622308924165f, 0.02186954801373159f, 0.012665928377106722f },
+{ -0.017642316775478364f, 0.0025945182985087196f, 0.008966701673817688f, -0.006994749861929666f, 0.008485188638526037f, -0.0020672694045139437f, 0.02166123307922291f, -0.01927450945869353f, -9.614355768999332E-4f, 0.004379322886017032f },
+{ -0.002999295143035217f, 0.0028712352085896726f, -0.005417795759296866f, -0.011214486612610559f, -8.858813829315369E-4f, -0.01998544615327064f, -0.0030722760865264085f, 3.655153844389918E-4f, 0.00600554578794381f, 0.0030443322423351227f },
+{ -0.01033862158478682f, -0.0117054254103267f, 0.013367761427331518f, -0.0032350894799089208f, -0.014119489049897443f, -0.0021285306321788006f, -0.0018687339757116107f, 8.581694520459349E-4f, 0.013970544665348267f, 0.005666285415570498f },
+{ 0.0070723423365972f, 0.007334259980393412f, 0.009783040927230946f, 7.292486689454079E-4f, 0.020959455485831714f, 0.014181191401639846f, 0.00249992722034471f, -0.011608841861127154f, 6.733950371980832E-4f, -0.0014609531445706231f },
+{ -0.007187909599674242f, -0.012095539513546617f, -0.021518696115499635f, -0.020066716879009273f, 0.01624378113518059f, -5.29792083687672E-4f, 0.019280316371078077f, -0.0101230919834583f, 0.004255254152852716f, 0.022191259279626896f },
+{ 0.00939035134116382f, -0.003197736121255375f, -0.005961524435336303f, 0.0011450958307586835f, 0.01450245793970157f, 0.00442950452093921f, -0.001150803674606377f, 0.002490950328237514f, -4.812004008619828E-4f, 0.010537648975107472f },
+{ 0.016391427181702774f, -0.00557340690538792f, -0.020877699841490432f, 0.011268405870125914f, 0.029943274572837176f, -0.023224816712867254f, -0.009023554156797717f, -0.016353080869309797f, 0.0032578071182670938f, 0.01994637851183241f },
+{ 0.017291437115193126f, 0.019329625616476925f, -0.021167107919210913f, 0.01648445818086268f, 0.05096057778960273f, -0.02354598430322315f, -0.01894561563118455f, -0.0297585759328096f, -0.004034210947307073f, 0.01142353099082423f },
+{ -0.024499719245962524f, -0.009542192264760333f, 0.011513341432717797f, -0.004477664955568309f, 0.01555755862133511f, 0.01422602565695148f, 0.0069878356507521175f, 0.009078611810302345f, -0.017007696375150896f, 0.019489998285843493f },
+{ -0.04587240144821805f, -0.02952519522601935f, 0.04338196368895513f, -0.02369828782219324f, -0.0606509985812769f, 0.032850773984438655f, 0.026192863594723847f, 0.03187217743737995f, 0.009951732903704926f, -0.03659791984255005f },
+{ -0.011578905126169568f, 0.01670433979532793f, 0.011546368941206064f, -0.012730247963310175f, 0.008750152734638203f, -0.011550746320913663f, 0.0031426661452731565f, -0.009778663854374191f, 0.01031370261906505f, 0.0026243233830312057f },
+{ 0.0042037529554470755f, 0.003962668313945828f, 0.01648384193296279f, -0.017856640589120242f, 0.01733972638509458f, 0.009016096046306892f, -0.014312548674467677f, -0.01824842535778166f, 0.006982265136349389f, -0.005437194521902214f },
+{ 0.0018522127650538627f, 0.004570415990007676f, 0.017460012173876212f, -0.00811266173545479f, -0.005864697507171039f, -0.0071252265042829905f, -0.01450989746209256f, 0.007653728331180079f, -0.004614838740706236f, 0.01219617968371005f },
+{ 0.012183484217733104f, 0.002136945810126685f, -0.007761390683376553f, 0.026816672600095442f, 0.018411786180039073f, -0.019239196856567106f, 4.996922824745702E-5f, -0.01555893567708452f, 0.003955250138390876f, 1.833253434581556E-6f },
+{ -0.006068015001777577f, 0.02266927247532737f, -0.013298920010152615f, 0.014344186890928902f, 0.019027624875429475f, -0.001934468066620536f, 2.058773793481616E-4f, -0.01452153023767372f, -0.016218220890440862f, -0.0010261656540059018f },
+{ -0.008626782941505375f, 0.008243216167206642f, 0.003403530351678499f, -0.004689951054116289f, -0.006333171780303869f, 0.01174278946778009f, 0.005126764037975103f, -0.0055707369378812654f, 0.0197189974717262f, 0.016500867893065766f },
+{ 0.020533607581469326f, -0.017431046098626297f, -0.00487666123596263f, -0.006802994356633174f, 0.0014259255612470822f, 4.76843616605763E-4f, 0.01247737777889058f, -0.01939360614576596f, -0.012088942379345394f, -0.01136962689727789f },
+{ -0.061386011962388194f, -0.018031255936676226f, 0.05257906283552962f, -0.06789058525318199f, -0.10009170091153566f, 0.05839753414977839f, 0.02825190574079028f, 0.06621982712334468f, 0.01931164445727724f, -0.002901198289583507f },
+{ -0.040423849503604205f, -0.010333802995117457f, 0.0395343813160381f, -0.08056945053430767f, -0.08361006015847852f, 0.02739732875979484f, 0.014591795315443953f, 0.04187259248451479f, 0.04557899612320916f, -0.012990403469112666f },
+{ -0.018369199129964046f, 0.005173521616660178f, 0.005020812751564159f, 0.0019632285866115072f, -0.02429143325357864f, 0.0017778533104560294f, 0.01596526841142437f, 0.02018100996687946f, 0.028618854109676746f, 0.018872179025573962f },
+{ -0.035226708785693915f, -0.011669103446269266f, 0.031615802773083915f, -0.02598265377269765f, -0.030795563220587963f, 0.03227499962904253f, 0.015185015842061125f, 0.04979854824067422f, 0.01816876311696236f, -4.5765881128140696E-4f },
+{ -0.02642365768456504f, 7.441159165068254E-5f, 0.01457149764592147f, -0.004599777679565884f, -0.016162010656918857f, 0.017500233499736957f, 0.008582699179605939f, 0.027497476190167337f, -0.00276696286039914f, -0.004480419838788894f },
+{ 0.00629205889371608f, 0.03657237247706501f, 0.005403298191782524f, 0.050188443245582054f, 0.04681126840347589f, 0.0024632305808974823f, -0.008504888896676829f, -0.028058867075657315f, -0.01182939107683104f, 0.010832862716786922f },
+{ -0.04165502824884309f, -0.009152409212266129f, 0.03965665257101165f, -0.08249161057697045f, -0.10473531938903706f, 0.03145913049530387f, 0.04005815023636902f, 0.07090221032001595f, 0.042814821792939176f, -0.03023506371816042f },
+{ -0.02746925712752184f, -0.008730106829876757f, 0.06170178230481441f, -0.06609241040918151f, -0.12234199331026763f, 0.035686300591060184f, 0.05003960223542559f, 0.04948001124063311f, 0.053557528471512024f, -0.029798700290699885f },
+{ -0.021065009878517473f, -0.00368274113706798f, 0.0463298571105048f, -0.04840510178090123f, -0.06877039589323038f, 0.025425118691589855f, 0.014240810253530268f, 0.013044430368178797f, 0.04599376142040446f, -0.0236604510992125f },
+{ -0.008211235323041495f, -0.012624280806934994f, 0.002723063834613119f, 0.002248338491904014f, 0.05729804590931353f, -0.03527982438553935f, -0.02317678592508628f, -0.01317622082508715f, 0.0031058205864266906f, -0.012725576504884718f },
+{ 0.021394993946848753f, -0.0028038767021338552f, 0.015450936199518536f, 0.008515747151559293f, 0.035510301524053794f, 0.004214760625164681f, 0.009795887007055887f, -0.05988829203462402f, 0.034338118043798695f, -0.01296393708693952f },
+{ 0.008672954272428184f, -0.03546028205306267f, 0.03269300843259785f, 0.007770084329069084f, 0.011746399611535546f, 0.01667395840628698f, -0.02242875096901436f, -0.003537621286009222f, 0.009687459008750182f, -0.006450937076684089f },
+{ 0.006241892793511399f, 0.0038746702434634605f, -0.006506722383511378f, 0.023350755927944857f, 0.028404198446880462f, -0.016121937018006967f, -0.016730651468265186f, 0.0019554354980081995f, -0.011000128206266389f, 0.007484219512594056f },
+{ 0.01645247152262654f, -0.023521463080241143f, -0.024068593261650482f, 0.03692932972106534f, 0.0727574260527988f, -0.018223932963997866f, -0.015377090766863895f, -0.057712322909639374f, -0.0033931901998631117f, -0.0022739218549364297f },
+{ -0.010562956692785074f, -0.013695276750591515f, 0.05024977110335542f, -0.01243985196435545f, -0.058585504392247335f, 0.020278546174234083f, 0.017192808920495517f, 0.03885495142059385f, 0.013994003504561306f, -0.01228165353451426f },
+{ -0.04430189150331401f, -0.003148072210319159f, 0.06018213968113723f, -0.0516436957104114f, -0.0996789269482805f, 0.02995569462976234f, 0.02770414783366726f, 0.048129468932005516f, 0.004274410940387341f, -0.02272051000210695f },
+{ 0.012946744385620539f, 0.009073949127474132f, 0.018866205453386554f, -0.002361266764967755f, -0.009285730087465605f, -3.3308862432062424E-5f, 0.010259173566046055f, 0.004890937231466412f, 5.35411991924304E-4f, 0.0035694347972685383f },
+{ -0.014390636669895499f, 0.008182120825191905f, -0.011934822714544017f, 0.013418140150833723f, 0.022212528469324377f, -0.03458807826294092f, -1.0116232952346439E-4f, -0.0226115474116357f, 0.011108282292179248f, -0.007442833239175373f },
+{ -0.012399561542568764f, 0.01439648101019638f, -0.015118105060520014f, 5.973158099115135E-4f, -0.0013998313694680942f, -6.717164422516189E-4f, 0.006662541048096247f, -0.013153856556275365f, 0.007317451711531241f, -0.00592772568690171f },
+{ -0.0013601314205103714f, 0.006383304859800477f, 0.009605771341889602f, -0.008169349896847517f, 0.0023329611841745802f, 4.0959084803548286E-4f, 0.008279541796450204f, -0.004812148017688881f, -0.0012195102536498095f, 0.001800124653345076f },
+{ -0.019056893100388467f, -0.0135531400076103f, -0.02180497578249931f, -0.013449164284213708f, 0.012974872441003947f, 0.012087753390692402f, 0.007345156230586836f, -0.004290071414820447f, -0.012033219830230552f, -0.004614086588169636f },
+{ 0.00886941177237951f, 0.005644532120988495f, 0.0030540831467017505f, 0.0024596869106100067f, 0.008197008938526477f, -0.011401503111286614f, 0.00431779353893807f, -0.002755409722075768f, -0.011788309899514772f, -2.231383515991633E-4f },
+{ 0.005929391050547232f, 0.013324012869092435f, -0.019419714261196958f, 0.05325025714422443f, 0.0431642659702626f, -0.0035236972164649463f, -0.02371033968054114f, -0.03965340650103976f, -0.028785048866678986f, 0.028110989200804258f },
+{ 0.011065073207495063f, 0.014256751939547587f, -0.026455005788395044f, 0.013250649608367112f, -0.0036929552775261916f, -0.028987482603577818f, 0.01655041044431674f, -0.01661772856000467f, 0.01695805030023403f, -0.005995409203080653f },
+{ -0.010941502898892902f, -0.002870626651923264f, -0.0030469622716041153f, -0.004973741359067252f, -0.008197050802802655f, -0.017391078284062847f, -0.004940961417786713f, -0.0189225692693123f, -0.002524106465133904f, 0.004553861766472057f },
+{ -0.00377028866223445f, 0.010798589083260807f, -0.010220762462158663f, 0.013066618244836306f, 0.030210271018055783f, 0.007626382740270843f, -0.007511845515986185f, -0.023810537640139625f, -0.021856881155931936f, 0.005293755123015265f },
+{ 0.013180807063745985f, 0.003611781515099347f, 0.0022770192435714273f, -0.0012466502971288196f, -0.01629020923174864f, -0.0026713471572638488f, 0.0056627784969021456f, -9.016519684177177E-4f, -0.0025756410315575773f, 0.003607665110045468f },
+{ -0.003646246028014782f, 0.0310919321611577f, 0.0038467252860193858f, 0.016770868902293273f, 0.07191952070673664f, 0.011319247765284425f, -0.05241330852911865f, -0.07439404859167321f, -8.37988776670585E-4f, -5.84486371009371E-4f },
+{ 0.005829326466617334f, -0.007764215342359554f, 0.009072806771969023f, 0.0047401442470462124f, 0.02025551769970571f, -0.015664025994738904f, 0.0044475908773223905f, -0.01317026144758711f, -0.016547755000857815f, 0.013466809131779358f },
+{ -0.010954624829753984f, 0.006847696679040467f, 0.008233845090632356f, -0.0022509082847118438f, 0.006270884281322107f, -0.01199332828320052f, -0.007114742717424075f, -0.005552946853158326f, 0.0030111172181212357f, -0.0036714713951306603f },
+{ 6.707729655242678E-5f, -0.004860313646312873f, -0.01882555058958855f, 0.01667187529202192f, 0.024070780249836003f, -0.0101606299933245f, -0.01700634733217127f, -0.01569470427516499f, -0.011137636525705619f, 0.010760459786399359f },
+{ -0.002093779412387925f, -0.009091420648312807f, -0.0022285174148160016f, -0.007642643605748829f, -0.012347297196390885f, 0.01381388616657157f, 3.2326987974236896E-4f, 0.013366450548616899f, -0.006737720984719705f, 0.0031765886152693166f },
+{ -0.03544081624950591f, 0.006152263425950226f, 0.028496780807235753f, -0.02866105581814458f, -0.07291609614018678f, 0.0064389637120062905f, 0.013058682926730385f, 0.04118716894998202f, 0.013318503829742053f, -0.01252738267064391f },
+{ -0.0010307639585890407f, -0.009607216278548367f, 1.0787133195671896E-4f, -0.005793322313754731f, -0.01668934438757265f, 0.007698887936672766f, 0.003388793318984504f, 0.03365197843349305f, -0.022582288618053677f, -0.006806887903995404f },
+{ -0.02409631774847758f, -7.074742751356523E-4f, 0.019224295791967813f, -0.029674396810742486f, -0.03582089968141929f, 0.018761603499558945f, 9.092646470863675E-4f, 0.03831449916277055f, 0.005350623979067503f, 0.010433963448672605f },
+{ -0.04241207561808054f, -0.04493169659798205f, 0.07194955871241811f, -0.1339706613693399f, -0.13323365176162894f, 0.05360401260751253f, 0.0624524406880276f, 0.08124975711986933f, 0.09592287450292772f, -0.05088846015833502f },
+{ -0.016930189639767373f, -0.0125558017409849f, 0.02219473514906381f, 0.019313017929050935f, -0.04584042879023855f, 0.01724723916043677f, -0.007056734870552964f, -8.07440419832144E-4f, -0.01101070240426738f, -0.001906461752258647f },
+{ -0.021734446269427717f, 0.00763301252140415f, 0.01570566759225292f, -0.025109910539188866f, 0.012525452790656675f, -0.010092156227162679f, 0.008585766178793362f, -0.014166026859755505f, 0.009509401706951328f, 0.03466449981171826f },
+{ 0.0048166760472103266f, 0.017812227367720913f, -0.011149236106041398f, 3.4612539243487493E-4f, 0.004802851271599361f, -0.0012311445846892807f, 0.005823017273000847f, -0.01085856726082999f, 0.004192364012863908f, 3.070112747786305E-4f },
+{ -0.007497658641345674f, -0.002420262535676533f, 0.0022081705094377196f, -0.017853274425334267f, -0.004808945788306498f, -0.0198632488827351f, 0.0029005462693094375f, 0.008437683676879375f, 0.013878048875320249f, -0.009520087798974371f },
+{ 5.474530818219472E-4f, -0.01001958118550058f, -0.007200277658221889f, 0.0012188864299383867f, 0.018630711467077624f, 0.0062990771954551435f, -0.01206220274189674f, -0.025417443873385126f, 0.004293547826385853f, 0.005931464222214797f },
+{ 0.0056737094961183485f, -0.011980858641572794f, -0.0046953117158138585f, 0.009107523563686413f, 0.012562632341667693f, -0.01496198453493836f, 0.01790794143918025f, -0.0012993303357351363f, -0.007867442458018245f, 0.016473307231144988f },
+{ -0.015524907688348726f, -0.002393407245059767f, -0.008654764850788308f, -0.017445924956224185f, 0.009462380829277733f, 0.01306178364574188f, 0.017380488034775397f, -0.005786098802204287f, 0.009133267561024385f, -0.0010391061054960944f },
+{ -0.008329059302562775f, -0.005905465958141101f, 0.006346462446411125f, -0.025776166918937003f, -0.006006227650179345f, -0.009308391438466745f, 0.02113557857851441f, -0.01063337392988423f, -0.0044811780711075016f, 0.020228648160159388f },
+{ 0.007600792726243679f, -0.012410953402629757f, 0.008627563641016769f, 0.008822273781237844f, -0.012101161807668086f, -0.0056143225931744156f, 0.008555086426504082f, 0.0017428604170887081f, 4.338571741792202E-4f, 0.005935893286515376f },
+{ 0.02081316489235303f, 0.013606417333859628f, 0.0016191574767766743f, -0.0013815637999854992f, 0.019322628970064322f, 0.013354593533080454f, 0.006173875197175379f, -0.016951787029286985f, -0.003268810693760397f, -0.015811266685422657f },
+{ -0.003110934716780123f, -0.00675835040623466f, 0.009092666304552155f, 0.005125479791711187f, -0.012074010321311609f, -0.012249960515315926f, -0.009123736457724473f, -0.008553978827214589f, 0.005574757450814352f, 0.016632428310719784f },
+{ 0.006165883338860352f, -0.004485465249379293f, -0.020749933369051263f, 0.00706220639772356f, 0.0034436684002638975f, -0.0057649335691759025f, -0.0016942383575061848f, 0.006250271700695087f, 7.930579327535307E-4f, 0.012161253637667768f },
+{ 0.036648915317862546f, 0.01201837668241769f, -0.023952994675786234f, 0.03235176543884349f, 0.0554831346346145f, -0.029614864243755194f, 0.005299525750437413f, -0.05418010186013756f, 0.0019828590495899238f, 0.017065499632833287f },
+{ -0.011723841661266424f, 0.014768893397232287f, 2.738191008305031E-4f, 0.0030329660629069095f, 0.007539932770135925f, 1.2216813486701713E-4f, -0.010115754511488563f, 0.011914792803384455f, 0.015176690782048897f, 0.0013469778422016108f },
+{ -0.031866680518236434f, -0.010379024703993057f, 0.035905594431639654f, -0.012587497100666546f, -0.023852971339262105f, 0.01802571719543496f, -0.006258341286904479f, 0.030414666774910344f, -0.033908247266036605f, -0.0035974529986946583f },
+{ -0.0022599543582953532f, 0.0035791292933373534f, -0.009207960637356839f, 0.017359227085636537f, 0.0018754774664326965f, -0.005120402999629066f, 0.0030102058817697563f, -0.011826169599181834f, -0.0019030170847604995f, 0.005279253532947648f },
+{ -0.002118235100149943f, 0.008145126725324072f, -0.019956975309068068f, 0.013126511299510276f, 0.014164374162423781f, -0.016731836276592426f, 0.004300367748641633f, -0.023905414815674816f, -0.0028754917222109633f, 0.011119930931263514f },
+{ -0.003793668457633486f, 6.136451930207778E-4f, -0.009042584451259524f, 0.006437586641235963f, 0.03847689510661375f, -0.009014882901595089f, -0.015318623885710241f, -0.012152929320534453f, -0.016267255063804553f, -0.008895359660194724f },
+{ 0.009433729800960916f, 9.890067138115142E-4f, -0.01865099500805337f, 0.012367543015803622f, 0.036127546726771376f, -0.027002399306698954f, -0.014771621049283925f, -0.01954804942408512f, 0.0038109325496883516f, -6.939752971669134E-4f },
+{ -0.0027564279786083164f, -0.012867095849261287f, 0.009614809435492191f, 0.002533117200480593f, -0.0013095247360456112f, 0.014140556142945248f, 0.006266042940297506f, -0.011282265987134584f, -0.0051779085505854455f, 0.006518737857451482f },
+{ -0.015919947507624068f, -0.003757754072607962f, 1.3491999255539494E-4f, 0.009205377712968758f, 0.054362392319435925f, 0.0016953733825127253f, -0.0172962651395232f, -0.02548948895571763f, -0.014063812664526651f, 0.026146397405178833f },
+{ -0.027827966429046225f, 0.013274925020846097f, 0.010817420562558949f, 0.004784269344152186f, 0.05146533990979452f, -0.010148716003899367f, -0.0030698071872218304f, -0.0321989024636729f, -0.021221939808772856f, 0.004101257278793675f },
+{ -4.417105678871275E-4f, -0.006045243556220756f, 0.01904149965203046f, -0.009876199185592306f, 0.015156105359354516f, 0.02205221042677468f, -0.008939823970925085f, -0.0123507831058699f, 0.0030258143550116324f, -0.005335834787954467f },
+{ 0.00751641120377651f, -0.023405063730356678f, 0.00424835564449971f, -0.005723228929891581f, 0.027811206364483334f, 0.007531125746236889f, -0.02140881525793746f, -0.023957858451782672f, -0.011385536220885735f, 0.013792793130863021f },
+{ -0.007068785335681445f, -0.0023550121448869888f, -0.002611369505985708f, 0.01284098171175217f, 0.045725400848803666f, -0.009561206760206614f, 0.0020800135937550854f, -0.025838491876685504f, -0.001043777441802464f, 0.009079805528538782f },
+{ -6.616670593746876E-4f, 0.003071268515928363f, 0.002486369418063762f, 0.004258068515871596f, -0.009691606310250525f, 0.002685415663966502f, 0.003952084630225481f, 0.014293098631750855f, -0.010198767184476237f, 0.01774987550698008f },
+{ -0.005946106134226828f, 0.007551089998331877f, 0.010596679790693533f, -0.018662524001939695f, 6.989525491124446E-4f, -0.004694920523743629f, 0.011982611865297227f, -3.427526435187322E-4f, -0.03074029660492938f, 0.018732324716266614f },
+{ 0.00822441725256961f, 0.00471102724335462f, -0.018797562980876405f, 0.038329029755248004f, 0.029711285070553806f, -0.03225945330426086f, -0.0010857386347594314f, -0.014519419441293074f, -0.043378723684064584f, 0.01891776237630078f },
+{ -0.01866110506420052f, 0.0075534815545367185f, 0.012094975061831638f, -0.012852335110727807f, -0.061304328662327996f, 0.02450915718056372f, 0.021013582314778394f, 0.040634693778412154f, 0.0037621556602773663f, -0.042831372232470265f },
+{ -0.006740634312570658f, 6.993988022878578E-4f, 0.04130713592499932f, 0.008911093625349212f, -0.03800251369205168f, 0.015329418582186437f, 0.012086962086224234f, 0.04558810685703036f, 0.007871154356587317f, -0.013827395484680021f },
+{ 0.014240384455141664f, 0.0028748945985944364f, -0.023553999254556462f, 0.048993945780831404f, 0.054564787077592984f, -0.003136722269582364f, -0.01751338073475508f, -0.027202276150141407f, -0.016007362360217214f, -0.0022302029884476524f },
+{ -0.0017184973636269936f, 0.010093048774552589f, -0.008476838561105725f, 0.014173500113410637f, 0.029166772348623613f, -0.003677076932579459f, -2.129848407908902E-4f, 1.0872612282203123E-4f, -0.001243990673679444f, 0.009905234925172505f },
+{ -0.032623784721275674f, -0.03604278707676595f, 0.03606522826300003f, -0.04913219167108595f, -0.09532937205699392f, 0.03327909842155626f, 0.034588268528472826f, 0.06241695612476021f, 0.008082336758143403f, -0.03957164281450297f },
+{ -0.03184060532850215f, 0.0023958219817810586f, 0.04846116458534926f, -0.02483292826321014f, -0.04723567327969148f, 0.032155268021646005f, 0.015679250149328427f, 0.057022374899171946f, 0.002941443979920717f, -0.0026138689873786937f },
+{ -0.04387244425350836f, -0.012437019292521626f, 0.042358725234039926f, -0.024690638528973834f, -0.045170813782473646f, 0.028225830456235456f, 0.015952468089461814f, 0.04344433355198851f, -0.003369296038758028f, -0.013385610158194568f },
+{ -0.01673278590592117f, -0.0031427590485809146f, 0.03693579763826202f, -0.06123074652969329f, -0.06707247799507923f, 0.011510271016961338f, 0.0273516103338026f, 0.047811661074358525f, 0.040505361639365765f, -0.017672463797553783f },
+{ -0.006342758479243507f, 0.009926527689502845f, 0.0018298217431594393f, 0.013850112054813164f, 0.015524213659139023f, -7.609313035350572E-4f, 0.013011432170099677f, 0.016749497757585337f, 0.008480270202171847f, 0.01456077928599498f },
+{ -0.01646049249588269f, -0.021444712310869727f, 0.030210968531395044f, -0.03435737468298592f, -0.07746221467880349f, 0.034002543014289226f, 0.007417940715162283f, 0.0565964717014549f, 0.022980640264003566f, -0.005821503544150373f },
+{ 0.01099482153729648f, -0.006142272816716584f, -0.011923433191064179f, 0.022548745706252378f, 0.007275714907977291f, -0.007913434727234927f, -0.0019230387528044936f, 0.01195920856906537f, 0.018315562064462585f, -0.0036681718710883998f },
+{ 0.007998332537337366f, 0.020798170961558452f, -0.042890096188203136f, 0.0565717549804776f, 0.06459080255410171f, 0.01190764706879923f, -0.02105819179129252f, -0.032372846779509745f, 0.00234841169272523f, 0.007671313497051741f },
+{ 0.022973502344108634f, -0.019865232308581057f, 0.02094227625707394f, 0.02883068074659198f, -0.07256283145255775f, -0.003792548539788579f, -0.011959737193706665f, 0.05742937018101551f, -0.027284776340783322f, -0.010067944070583536f },
+{ -0.0092376735560939f, -0.010528503349924771f, 0.011312785006962181f, 0.0237857181330184f, -0.11806153523270986f, 0.05722597904230239f, -0.03784081657850342f, 0.0862672131294976f, 0.02407044289024281f, -0.02324885851725814f },
+{ -0.0193778655549074f, -0.007489921547206126f, 0.03247398846015306f, -0.036115409595591404f, -0.05493893669566845f, 0.016766950746644686f, 0.021090957590707272f, 0.028739566893526934f, 0.007691941078846982f, -0.015530400775501023f },
+{ 0.017482690125773352f, 0.021539520457265295f, 0.016072124470604115f, -0.04171396250709418f, -0.16794651732315688f, 0.0012164502609774504f, -0.016520892668607345f, 0.12077981987959648f, 0.040419552274344676f, -0.05701947255197452f },
+{ -0.01880507921012095f, -0.03535537492611686f, 0.08117040519002443f, -0.10134407398866757f, -0.11605514361588551f, 0.03473469690679432f, 0.014679518725587528f, 0.016755530959936316f, 0.07782757136089682f, 0.006577167806461124f },
+{ 0.01354630254227704f, -0.031004561601776243f, 0.007116011316132426f, -0.002383132980886623f, -0.06174272140311212f, 0.00456998778540002f, 0.005753934567416382f, 0.0564851617656602f, -0.006083500397647283f, -0.01185821856862466f },
+{ -0.010281244857962708f, -0.02947809100776671f, -0.013448714634873668f, 0.028797395184936972f, -0.006334144662932858f, -5.65641417653436E-4f, -0.00927532078165951f, 0.05826050178212604f, -0.004777643643684214f, -0.025494014283333654f },
+{ 0.012491328246329375f, -0.012633195278765573f, -0.01104367076065545f, 0.04317813355698493f, -0.022245424670322828f, -0.018451243346782657f, 0.018215563733012658f, 0.08341995903806317f, -0.011144870259326907f, -0.038894326565042596f },
+{ 0.02384872726083315f, -0.0487076325838186f, -0.014885105805366401f, 0.017136698677162356f, -0.12948941612898437f, -0.02431247805512402f, -0.014880720231397068f, 0.11065658462848771f, 0.04651353689400139f, -0.03175831942264167f },
+{ -0.003633825440996879f, -0.026528822388811824f, -0.00880122013900193f, 0.0278689808307852f, -0.03221845024122469f, 0.025853776443231096f, -9.943142501934947E-4f, 0.0018714367623718267f, -0.028245001875605098f, -0.011753098328792566f },
+{ 0.01996163464115072f, -0.037331628676387646f, -0.015685997490450854f, 0.063497924338038f, -0.06830696203921444f, -0.037673648193802485f, -0.005114834782799011f, 0.07631884946078704f, 0.022301470888084866f, -0.023847928740709276f },
+{ -0.011810694512575787f, -0.0217807954153895f, 0.03025245273250096f, 0.01972285526293071f, -0.0834216051099594f, 0.006702986557789659f, -0.01312640323263312f, 0.04432005783993782f, -0.011926432797469166f, -0.007624259016077443f },
+{ -0.06970293628478f, -0.056333041422866034f, 0.09669201003617574f, -0.1597996929871309f, -0.18145529435177735f, 0.04025119831427782f, 0.08160403688776287f, 0.1372941989798239f, 0.0797775975518406f, -0.04631607044168666f },
+{ 0.0035161355121264f, 0.003924129401073554f, -0.016785940249312292f, 0.01254244675214234f, -0.04283872412697426f, -0.004463824302145028f, -0.013969510908479572f, 0.05636975903131537f, 0.013293093687797578f, -0.018006139520670313f },
+{ -0.019338425578829144f, -0.010978599749258569f, -0.017800088818353512f, 0.021780103968456203f, 0.006743760028974969f, -0.00804837406722395f, -0.015695324921839823f, 0.026683084438420466f, 0.02169988064479056f, -0.0430501584837572f },
+{ 0.02780726200059378f, -0.02146858771710861f, -0.009295840868179715f, 0.042669336289336154f, 0.002214811649655327f, -0.005624051445526623f, 0.0073421144311229735f, 0.016119961700299595f, -0.00996593477190993f, -0.01522160365248108f },
+{ -0.015955820994530648f, -0.03969377592165153f, 0.10469308909155046f, -0.09704368811309537f, -0.17807457237119345f, 0.07730682290493616f, 0.07011035540203249f, 0.12140998364517079f, 0.07765134079585488f, -0.04440120681951793f },
+{ -0.0019837461136638663f, -0.03387340558115751f, 0.03270556482743209f, 0.008825270957626833f, -0.04487688240168101f, 0.011848075074940081f, -0.012017001476465549f, 0.020439622466180606f, -0.019866732672678192f, -7.391192289011878E-4f },
+{ -0.017818420636379485f, -0.03853125259166539f, 0.10891798810621384f, -0.09145868719168843f, -0.17575194007851772f, 0.051766860763616675f, 0.021928982364677878f, 0.08838530878604088f, 0.061314271167211436f, -0.018102907825182698f },
+{ -0.010834366192628115f, 0.009930586045465302f, 0.030379302138095813f, 0.008600122528911529f, -0.03862265673769541f, 0.014584149456154927f, 0.002671067906975068f, 0.029220048620086918f, -0.02527625253280773f, -0.011863841763522709f },
+{ -0.047898361192189993f, 0.07172075418035952f, -0.09711005955618748f, -0.1808029025255719f, 0.0021595189579492954f, 0.04717777294995745f, -0.11538867018068714f, -0.020306383101678205f, 0.025998633598868393f, -0.07857966680624204f },
+{ -0.04909931333494044f, 0.01582412743291878f, 0.0021470996219880778f, -0.0018546644711148273f, 0.12030560154706219f, 0.03593873700731684f, -0.027120919518482712f, -0.1042766459676537f, -0.030354269816353825f, 0.012866091786595523f },
+{ 3.120894448168405E-4f, 0.014575931986686483f, -0.02880470761221695f, -0.025892925246707558f, 0.05079055754760153f, 0.03696221910022927f, -0.045965963530808576f, -0.08727066825375081f, 0.03372436502528623f, 0.014943327534399033f },
+{ -0.006465834610888908f, -0.007199114692933377f, -0.013233054949531833f, 0.009205652797829582f, 0.10285279236866117f, 0.0028891268442063516f, -0.031578779998735915f, -0.057185864746207675f, 0.012802612669984241f, 0.0022269804192569737f },
+{ -0.011491234499476496f, 9.334939390014504E-5f, -0.0014425503142760374f, -0.010730840385453732f, 0.009680171196993572f, 0.0045737774082114605f, 0.009263206192651467f, 0.004098916765142342f, -0.00850978456471941f, -0.015629178324149017f },
+{ 0.009995130016410964f, 0.0026422215199218167f, -0.0040789433540152865f, -0.021302907646982987f, 0.016753168231657678f, 0.014314954846204327f, 0.0040840903542962645f, -0.0013427732241578444f, 0.010770230485314133f, 0.0037334295658600887f },
+{ 0.007506417430044039f, 0.009403537734785104f, -0.00591583403855058f, -0.015493296273436858f, -0.015727029872726655f, 0.007290486632517855f, 0.009997317722347477f, -0.02054819926926326f, 0.013579670090381593f, -0.002123573756959592f },
+{ 0.014337900065026804f, 0.001893946598461687f, -0.013000154789514712f, 9.08355151108142E-4f, 0.002071460051274665f, -0.002026017066235571f, -0.003389898162327554f, 0.005744364650357374f, 0.0097134088039814f, -0.0052618320944147765f },
+{ -0.03372166537067885f, 0.011526559276676058f, 0.058541560030067157f, -0.05927244577909723f, -0.05206209047948305f, 0.03130617752390123f, 0.015134100426433428f, -0.002099742627789829f, 0.054254209438479806f, 0.0022988233240643524f },
+{ 0.009971264094755617f, -4.0485924971292946E-4f, -0.048024712413618234f, 0.053773210590784375f, 0.13447817807111412f, -0.010806308711763f, -0.05090750796215082f, -0.11051777569472719f, -0.020069414168182895f, 0.005912320951347191f },
+{ 0.005193117710850181f, 0.012099527364704129f, -0.005474980039071685f, 0.03711237250892443f, 0.12767224721103287f, 0.02056527211955732f, -0.026845427018928024f, -0.14292331797266386f, -0.01752388646607425f, 0.021278347354601126f },
+{ 0.014142141969658108f, 0.009569955211442965f, -0.03223055992593031f, 0.06079479253224075f, 0.12037030338914266f, -0.0070648391586463416f, -0.03752653089380193f, -0.09625653141333951f, -0.018364186114687802f, 0.0032455661417993527f },
+{ 0.01823260075735079f, -0.009564430552359381f, 0.005750160740263887f, 0.012296516954923285f, 0.08711408834606729f, -0.01172594337777227f, -0.002415004087084577f, -0.06624137871388355f, 0.01624457216741987f, -0.017621922166739364f },
+{ -0.035185432502887f, -0.01963734479379481f, 0.009001152780258865f, -0.023803230806047262f, 0.024709585746326264f, 0.00669954433830804f, -0.025939678213947957f, 0.014436379301949319f, 0.012801959571968988f, -0.019828063367205783f },
+{ -0.04075891807914698f, -0.01642945879074712f, 0.09853925398232384f, -0.14849523667092615f, -0.07461654789801263f, 0.0521996654923864f, 0.03261311945081654f, -0.002576800223668355f, 0.08166545020384983f, -0.01124897672411823f },
+{ -0.01904140089860109f, -0.046356667963650344f, 0.06853054001567607f, -0.08489248093455616f, -0.1392120664578813f, 0.07170714608243244f, 0.013546937601565782f, 0.08868767108401544f, 0.04541706251155439f, -0.049394889112960305f },
+{ -0.02962085684678824f, -0.018942706106237734f, 0.04866612858591515f, -0.06987125277900104f, 0.011583902126992432f, 0.012139400068318108f, 0.004424868785868284f, -0.011823832649425946f, 4.1810481351331073E-4f, 0.026552967073727975f },
+{ -0.03940749782543824f, -0.02915292090672823f, 0.007393817810542823f, -0.02953897224143287f, -0.06143056135625256f, 0.02722506428256073f, 0.00807180630925237f, 0.08153269525280049f, 0.02649104050978778f, -0.05829402935462246f },
+{ -0.04672702377487636f, 0.004923203774433973f, 0.02332012316101167f, -0.04353317507812157f, -0.033493168180465736f, 0.016688547069906093f, 0.025865883739645358f, 3.4056268590569073E-4f, 0.010068213493018417f, -0.002837219910514036f },
+{ -0.031080348022045998f, -0.02162417947478266f, 0.07729817069612056f, -0.11869719024209387f, -0.08717048562267289f, 0.06645326645926831f, 0.010669881375762962f, 0.02642056219984318f, 0.05832330755740846f, -0.027710738858952685f },
+{ 0.01910057949751909f, 0.008964737125547647f, -0.009065438374735963f, 0.030359379950657354f, 0.04028040386141036f, -0.007360341618433865f, -0.01323288954886145f, -0.01411822551052051f, -0.02059584690281386f, 0.012170695089554573f },
+{ 0.011727314833975086f, 0.0024304595819294754f, -0.03548723829009496f, 0.021226797195956115f, 0.029399779979003192f, -0.010356363706133206f, -0.0014467301683510445f, -0.014808172977841724f, -0.008956143977479415f, 0.009779751928583246f },
+{ -0.053447178474983634f, -0.028686225324860686f, 0.08144158082484543f, -0.07481073396339631f, -0.021409352818552965f, 0.055002125259976685f, 0.034821193634894596f, 0.02936261654869528f, -0.0481117540232245f, 0.018532181254198383f },
+{ 0.004290930860423158f, -0.0018080617937846959f, -0.01606045068461348f, 0.013634752829602302f, 0.04232423816684999f, -0.010515959758010746f, -0.013450404231395936f, -0.027585468992774604f, -0.026364634530491815f, 0.020822426904251297f },
+{ -0.05141739236478841f, -0.0653578927546736f, 0.14976797903352324f, -0.13170888256731442f, -0.23699753098621973f, 0.11893460826591105f, 0.028878556431092654f, 0.11160336827515752f, 0.07801575963975334f, -0.06800507972652445f },
+{ -0.10394799469746518f, -0.028142479888255918f, 0.14047806792874737f, -0.1804442269818408f, -0.14144807556426503f, 0.11374562887841477f, 0.04226627743373604f, 0.06407325730413577f, 0.07919942495335323f, -0.037983822108327084f },
+{ -0.011787046761361575f, 0.014417828377582442f, -0.027417265585729027f, 0.024036463872382684f, -0.03504148277997408f, -0.007675520491293195f, -0.050173106523319244f, 0.006859441192152931f, 0.012093825714738446f, -0.023487471181970573f },
+{ -0.02955958088381f, -0.0049984901086586675f, 0.03147839886663635f, -0.04814082886970924f, -0.044780675170135904f, 0.03774046501438702f, 0.019970562276325998f, 0.010045459305622883f, 0.012851894968868002f, -0.017857779481677837f },
+{ -0.035712881633944274f, 0.062113316722435384f, 0.014298738194602832f, 0.03052802185476315f, -0.01372773669191989f, 0.007721897878831268f, -0.00350995863761228f, -0.011857872275352918f, 0.006709973508514293f, 0.013228264798150403f },
+{ -0.05485823138933313f, -0.01906589555338176f, 0.06175308879754117f, -0.0876741468991565f, -0.09380708838915654f, 0.05188957130657572f, 0.02309935190978306f, 0.04735711131546063f, 0.06037660386904827f, -0.02542206007166161f },
+{ -0.0523813132238177f, 0.01851546515330889f, 0.03431233875566388f, -0.019157347917834938f, -0.05178200904831111f, 0.03185217406990926f, 0.023312697577857464f, 0.038798534537625155f, 0.032556028751395634f, 0.0028276693831376528f },
+{ -0.0141344720565849f, 0.044670405911132166f, -0.006031602341658518f, 0.05982791274992242f, 0.028031310473072724f, -0.00716034138851107f, -0.003355267409093824f, -0.02152225224350769f, -0.0040801786023397235f, 0.029876864875302705f },
+{ -0.01358446241368399f, 0.019475952671191222f, 0.0019012996215545474f, -0.007601893943815573f, 0.00909381729822209f, -0.006392141632235728f, -0.004790788286952944f, -0.013135442024084924f, -0.008240078440056154f, 0.004724723801073928f },
+{ -0.03459318648429145f, 0.021685040521015938f, 0.010905123421669796f, -0.01799051577700147f, 0.08865714615514159f, 0.0593744803924385f, -0.11695316686477311f, -0.05818807217893429f, 0.04687336343935859f, 0.029638979393669353f },
+{ -0.03052371151904589f, -0.008846125917960176f, 0.015785654214103252f, -0.00863845239062727f, -0.030044373467440728f, 0.02023410206898982f, 0.0177930296600326f, 0.037436092936923834f, 0.03780454586517599f, -0.004601173379480198f },
+{ 0.003825557590220385f, -0.023356039912337433f, 0.056613590554854126f, -0.037999357917849336f, -0.09640585361844115f, 0.025796709844971632f, -0.0038299961563791466f, 0.04166827811710333f, 0.022011547649518078f, -2.1812729390656926E-4f },
+{ -0.00631239986917194f, -0.007957049752162116f, 0.006753415811153329f, -0.007643120176910044f, 0.0045754878198944575f, -0.021475266909964007f, 0.007629224677621017f, -0.016601430555921504f, 0.006642234332366521f, 0.017042355984989783f },
+{ -0.0028351548971739986f, -0.010721400300822253f, 0.030505099834658853f, -0.00841342050127976f, -0.03235304708977077f, 0.020381753278858245f, -0.023529703629327554f, 0.021385752028261113f, 0.03329306698955493f, 0.0124237429606144f },
+{ 0.0035748534039161395f, 0.01484171385940674f, 0.012936565968728395f, 0.001762169869627952f, 0.011260095755331266f, -0.032418654002333375f, 0.007518178107101218f, -0.02538832566051896f, 0.0014130211415450042f, -2.8227920525793925E-4f },
+{ -0.041173514669839956f, -0.004481375601306551f, 0.004538317061530548f, -0.003501374034993262f, -0.02910613590668581f, 0.006626996595348237f, -0.053215557404596076f, 0.010956711636159553f, 0.010329175222285792f, 0.016543327722806096f },
+{ -0.044537592756383436f, -0.047027482736316954f, 0.04664201117876825f, -0.08571863554355501f, -0.14586882544995294f, 0.015164987557352209f, 0.020930325650946983f, 0.1021668057616537f, 0.08261801576349734f, -0.035722101943944096f },
+{ 0.04119385483362494f, 0.0051674283348887426f, 0.03398579586647618f, 0.02427979259473472f, -0.004949840475353315f, 0.009116981668986413f, -0.056373202957263835f, -0.040805189536068355f, -0.0624990419624489f, 0.07975592531057277f },
+{ -0.01787073523769062f, -0.02586420004836871f, 0.042522545529972436f, -0.05201219020640329f, -0.09028907322503704f, 0.022790904680893533f, 0.039878838104841635f, 0.0560890437098312f, 0.026099878137283036f, -0.02555978248320171f },
+{ -0.023167444496308316f, -0.02699004494372564f, -0.0011008038909268163f, -0.00613766965453745f, -0.036026056398657996f, 0.0024133848575658133f, -0.0030395205746275005f, 0.0487439142471655f, 0.03876435554230554f, -0.01601913505109162f },
+{ -0.008045962806929105f, -0.008272124380776028f, -0.003941601295380566f, -0.016776434196103508f, -0.016295871655952313f, 0.007964779275897822f, -0.003101641687078575f, 0.0017581024496117871f, 0.015237016785097987f, -0.006078032058066429f },
+{ 0.004784992457115252f, -0.018325557269630945f, 0.015636606119532343f, 0.03241332684287292f, -0.028433468996390227f, 0.02551944624184748f, -0.02042484791945243f, 0.0364721351753415f, -0.0068316540265806755f, -0.02795570381397042f },
+{ 0.013568798790128699f, 0.0038698109093325645f, -0.010637872635054642f, -0.02241586636397403f, 0.008247235476597612f, -0.01911891296080718f, -3.441638461976177E-4f, -0.005828769193288236f, -0.0010531095624858055f, -0.016996297568140275f },
+{ 0.0303909092250218f, -0.011508932139702638f, 0.016822659559135096f, 0.02961069035501649f, -0.07273956272565875f, -0.006111074727818585f, -0.05270455682592872f, 0.04775903708156115f, -0.04385282839786572f, 0.01334841668105564f },
+{ 0.014532978697354846f, 0.02070785867987623f, -0.04071689024914121f, 0.01800540439317454f, 0.028683082953057434f, 0.005795904363332197f, -0.013529097482628802f, -0.016565584918522044f, -0.007310151281581066f, 0.010900977786283976f },
+{ 0.007567504796564456f, 0.001825348056095035f, 0.02014941964283871f, -0.017055932721336625f, 0.04392408499582875f, 0.016729836062485903f, 0.015593390418033658f, -0.055963739307775595f, 0.004824830062061759f, -0.001712551769571095f },
+{ -0.013397430356871437f, 0.001320975980302564f, -0.004474512709834169f, -0.03142825683191579f, 0.029116909081739986f, -0.006261539108101878f, 0.006677401136286985f, -0.03966591782581904f, 0.006194254238159972f, 0.014950113141208829f },
+{ -0.022724618222448274f, 0.002326037774882037f, -4.198835041334499E-4f, -0.010475282695310124f, 0.00439045456215604f, -0.003667975245109975f, 0.010768455649686546f, -0.0018014049290443971f, -0.002876379915315922f, 0.01138441979550488f },
+{ 0.010375042601212971f, 0.011004549834256775f, -0.03287344825336473f, 0.006668585226008529f, 0.06814514443512494f, -6.796848862307339E-4f, -0.007149298105920068f, -0.006273240359050692f, -0.004974175991072669f, -0.014850665983014035f },
+{ -0.008938813640478232f, 0.061533515434723525f, -0.0362127998628739f, -0.024783116631271803f, 0.07219754993587318f, -0.022258387282761694f, 0.015479750137231536f, -0.011786014688430433f, 0.03384332690045636f, -0.012991206639793591f },
+{ 0.016988124103245527f, 0.012626008165350448f, 0.03566164617424867f, 0.029172152778988762f, 0.0018024277864657206f, 0.0027001734095436175f, -0.02253937709802813f, -0.024212197451148675f, -0.05216406052861946f, 0.036590305583055455f },
+{ 0.022636252012424068f, -0.020602288719433988f, 0.004669454721197255f, 0.02119301496649026f, -0.010410029039372931f, -0.004831920686202845f, -0.02884057686898001f, 0.007230444014249241f, 0.01014651382943848f, 0.02746911770143965f },
+{ 0.001896710450217795f, -0.014527576995156171f, -0.005998211707734963f, 0.015815527059697326f, 0.040608316396082186f, -0.004436436376489932f, 0.016680555428783272f, -0.02817819378850823f, 0.004953836890694258f, -9.919844908882706E-4f },
+{ 0.006346953498449078f, -0.019429917354022976f, 0.015867838406488748f, -0.013624939382628251f, 0.03339720401178328f, 0.007712414767283773f, 0.010380783110030479f, -0.022392163702384175f, 0.044755919063420906f, 6.012429012169448E-4f },
+{ -0.001636563064447386f, -3.109157091732828E-4f, -0.008461783472745147f, 0.012625971328055737f, 0.00641421888759258f, -0.0058237467499633105f, 0.006944436954687878f, 0.010709668477642237f, 0.015763376904901937f, 0.005204615251507312f },
+{ 0.008000574925493898f, -0.005325328237515637f, -0.002213789224476216f, -0.007449548427875438f, 0.01107074730583646f, -0.018208551284365947f, 0.013200219200830164f, -0.01853162505256654f, 0.016099153893872235f, 0.014042126827789034f },
+{ -0.004973031133056233f, 0.017490325709457983f, -0.026714133367557596f, -0.014470699001346253f, 0.022194995621115612f, -0.007135923049925834f, 0.0011134971361757948f, -0.01598424755180907f, 0.00548151796692795f, 0.005509193141163396f },
+{ -0.026608799628956025f, 0.0028104388579633876f, -0.013817682935527069f, -0.024384365421413312f, 0.03695519827869501f, -0.012466631193697885f, -0.018415928122247474f, -0.005594722323140004f, 0.035286795876086095f, -0.03278758051496644f },
+{ -0.013064165173765343f, 0.02568658753934749f, -0.01872548965539856f, -0.028591923196881724f, 0.03998847953286507f, -0.002991433903260003f, 0.00802236169955059f, -0.018816486655526737f, 0.016655997216756077f, 0.026026621895132385f },
+{ 0.01867945977397339f, 0.014594602557794678f, -0.025035519457155115f, 0.012157706581407076f, 0.015942427225256066f, -0.015232103507996118f, -0.0015920068541009135f, -0.03067186611010118f, 0.007925729460688254f, -0.0014692556374003764f },
+{ -0.0035906025093496627f, -0.008628637063339282f, 0.0026289614030973124f, -0.0065824631575530194f, 0.030426084163634813f, 0.011864727109728258f, 0.004169124234074973f, -0.013983269441432801f, 0.003093544644299254f, 0.005423575392245948f },
+{ -0.013388177458266736f, 6.384641304377261E-4f, -0.008234641785159898f, 0.0017625671712096045f, -0.00994537431897587f, 0.0156746206508308f, 0.023147752928188926f, 0.004924512254924157f, -0.0032948579725994576f, -8.151284674902243E-4f },
+{ -0.009275324435007719f, 0.044034681014793894f, -0.14711853591573149f, 0.029165935070263778f, 0.13295815262688346f, -0.004673186606399889f, -0.14055111022367778f, -0.09584002782098568f, -0.09881095288389771f, -0.09377839512492114f },
+{ 0.001230678582984196f, 0.0028385727356262875f, -0.003253926674104167f, -0.029304950523063648f, 0.036898802555683466f, 0.006777983895660551f, 0.01991876437779032f, -0.03244101509763782f, 0.011119632354462432f, -0.0018172918368437787f },
+{ -0.05290939353298646f, -0.03819403618038257f, 0.012434667384933318f, -0.036690544702381006f, -0.026756964124930074f, 0.00869274213425223f, -0.03595138704119264f, 0.06300946546788878f, -0.03155041895989666f, -0.03721183849010555f },
+{ 0.012039499859562625f, 0.01654101972017539f, -0.05159661708126434f, 0.04445361143829665f, 0.1525693169909844f, -0.019809712196431f, -0.05264806892394592f, -0.10812975300713144f, -0.029135878268128242f, 0.016597099924550378f },
+{ 0.014323195426207884f, 0.02030918008644102f, -0.033480361156815866f, 0.023805037160768983f, 0.011281996029698503f, -0.017304507555893075f, -0.014503109230314159f, -0.015382960207370336f, -0.017100777897633215f, -0.0015041840031665642f },
+{ 0.018234172939052818f, -0.028343367191143068f, -0.006057137951092349f, 0.02244061852807571f, 0.08587133183739318f, -0.03245034111107118f, -0.023520172104419267f, -0.065457586728295f, -0.012027982536840232f, 5.6349224456555276E-5f },
+{ -0.0029620430817909236f, 0.01340269122909517f, 0.003934348064222611f, -0.009563842497501859f, 0.010457433540971199f, -0.0032699225568021627f, 0.018255878586740684f, 0.008260149748774273f, -0.00677671178003294f, -0.015311355552775036f },
+{ 0.0024575658612363055f, -0.0275187373976497f, 0.00568876586623382f, 0.025143347984560114f, -0.03575133117927018f, -0.006766818204289893f, -0.026834551448587735f, 0.06334355956682323f, 0.042819503525058616f, -0.013631761635222566f },
+{ -0.030998474272180186f, 0.020525284312419383f, -0.04877308661477492f, -0.0902338401673147f, -0.013769392986241741f, 0.04972905324978773f, -0.060466683906238425f, 0.03822910292274712f, 0.05137480920009983f, -0.09909713208481342f },
+{ 0.004981139364131304f, -0.021151927045984266f, 0.003875839070389196f, 0.01484382078521066f, -0.012802198390434298f, 0.012166830747773505f, -0.028803630295790552f, 0.0319049254091226f, 0.023918651613191292f, -0.001426206174453296f },
+{ 0.0021838772584992735f, 0.008070711435415646f, 0.002176378356439287f, -0.018410114492373165f, 0.00399998062524692f, 0.004760133835322515f, 0.001284384954690475f, -0.014375246769132972f, -0.006623317760745571f, -0.020369785176552316f },
+{ -0.020242324317326636f, 0.012797461742716922f, 0.0014803000165312693f, -0.024521594378822467f, 0.05226672093062008f, 0.008567864483232249f, 0.004885101645697073f, -0.0420132158060912f, 0.04189007212606067f, 0.015072391824711914f },
+{ -0.003109138596774397f, 4.928547594159026E-4f, 0.02226175209098748f, 0.0015312014777358793f, 0.009939868238171565f, 0.013308846197739772f, 0.011456686206118328f, -0.01083514196805495f, 0.006335723964133319f, 0.002649550764427306f },
+{ -0.0038917712930729795f, -0.03512530038219142f, 0.005580681779450976f, -0.003102812813350619f, -0.009907077137849003f, 0.001398098261694344f, 0.015643410045029074f, 0.04558885457950282f, -0.02606920153003399f, -0.003053228493662819f },
+{ 0.018195519163776035f, 0.00857094173992241f, -0.03934043718638689f, 0.03229791843497848f, 0.05027923945333274f, -0.02692441060246342f, -0.005310894642911854f, -0.023087314689259578f, -0.017369522324043343f, -0.0018542534902959362f },
+{ -0.0018367416289791806f, 0.02563999172985909f, -0.015846998689899305f, 0.0336740941744466f, 0.0274221137879299f, -0.021542854475328645f, 3.916302107865353E-4f, -0.0036049150903805045f, -0.007962183264067734f, 0.008201414626691187f },
+{ 0.023949385182893346f, -0.07609137514625545f, 0.02967876689577394f, 0.015357587408988651f, -0.1273060729766698f, 0.011379880259573837f, -0.012684130869956152f, 0.12063010605827013f, 0.012791145822861524f, -0.07643930318089623f },
+{ 0.00882279331560172f, -0.028568601648158585f, 0.011392894289793962f, 0.021106943934385235f, -0.021200559259016136f, 0.016605051244251667f, -0.0024753047107524094f, 0.05819977410734033f, -6.717207684629767E-4f, -0.05708154602364823f },
+{ 0.02104705840677398f, 0.04203037174974105f, -0.07211079716089522f, 0.07364744689194186f, 0.14511097179522844f, -0.025755960300191717f, -0.057166268035453396f, -0.0857710846040746f, -0.01677248932318047f, 0.01102190721547506f },
+{ 0.01346760064865351f, 0.012032181768778037f, -0.04871879887011051f, 0.06579673721136792f, 0.14520123836821033f, -0.028980573175811646f, -0.04840839991785178f, -0.1060058943083877f, -0.032590509376724155f, 0.026944663710137973f },
+{ -0.022985310424534774f, -0.017627410453358312f, 0.016666340127131186f, -0.02255034140306494f, -0.02501598624545613f, 0.02527054591739978f, -0.002311886119047129f, 0.0099979463924512f, -0.009321760314772439f, -0.01754672486371562f },
+{ 0.00781929136795704f, -0.040562300305495014f, 0.0055260545102656655f, -0.0011775966146717735f, 0.03851979847146576f, 0.006930931173186366f, -0.033670170156888474f, 0.005232495920289766f, -0.006349670399573842f, -0.0338640374112396f },
+{ -0.003838461242192224f, 0.02374198736591864f, -0.028093656942167637f, 0.046811711827864554f, 0.02051330724685061f, -0.011916229588141817f, -0.031651283373896645f, -0.007112966886661801f, -0.012642078573097739f, -0.004197295690639445f },
+{ 0.008049410868261055f, 4.921109869254742E-4f, -7.607525879577736E-4f, -0.008233311778760282f, 0.06390152021327465f, -0.0026341499241199166f, -0.011532781385239058f, -0.01593860422553324f, 0.009567814468566273f, 0.00195035766619338f },
+{ 0.0074358816523622485f, -0.002269844921953334f, -0.02276285861357741f, 0.025738245302539244f, 0.08385401571355912f, 0.00643640292310906f, -4.894354042408734E-4f, -0.0035055785005325855f, -0.0491003975792116f, -0.009580174451805718f },
+{ -0.052049997151865944f, -0.014189942918983909f, 0.07541710984931808f, -0.07391255580735216f, 0.016662329722932738f, 0.029806434401151202f, -0.005436642425178689f, 0.028700768648224965f, -0.020082390374579876f, 0.013054159921621358f },
+{ -0.020852267042994838f, 0.013451454990664791f, -0.019894370566473054f, 0.03714097883734833f, 0.16634513850591773f, 0.015817875112605635f, -0.037081248816765576f, -0.11550738455117684f, -0.06390943861536094f, 0.03232284864134208f },
+{ -0.002583006293630894f, 0.014475883563639895f, -0.01662734423935545f, 0.03172484303539244f, 0.14592610714487567f, 0.008681770576768236f, -0.042192802527686625f, -0.13363860482712295f, -0.0326263084285422f, 0.025399209659073725f },
+{ -0.012790682505659973f, 8.941834327402704E-4f, -0.012260613638558723f, -0.0023745677630261537f, -0.013003971438020817f, 0.017757962289716787f, 0.0014134068414791128f, 0.019634217666118996f, 0.008494177992602431f, 0.006720281806157541f },
+{ 0.027474620340391994f, -0.0090791991440839f, -0.00635840144627899f, 0.0379713028350082f, 0.08545659788633503f, -0.011509427765572131f, -0.017666441054468587f, -0.041709603723127806f, 0.010691405090959139f, -0.006978125724267599f },
+{ 0.00611071399176901f, -0.01032923579140659f, -0.0037109447722173785f, -0.0013774442894831376f, 0.023637279546103604f, -0.0045747694841982494f, 0.0033967557516758223f, -0.012387915151511357f, 7.093986707210907E-4f, 0.005858550083022311f },
+{ -0.010461894097659618f, 0.009186463431362743f, 0.008901189914307077f, -0.007059133391817622f, 0.011114552196967168f, 0.003832609421189101f, 0.02191526997018464f, -0.0043376277928576625f, -6.631586066029199E-4f, -0.0016585595514697364f },
+{ 0.02016884737359673f, -0.005469182951947077f, 0.011823441830222747f, -0.0036689909179943776f, -0.00295426130856875f, -0.008083029494894343f, 0.008998477873071611f, 0.007146851207394925f, 3.8889016487480855E-5f, 0.005870665777409286f },
+{ -9.967137426151792E-4f, -0.01092194938908312f, 0.012216270391714905f, 0.003406824837718022f, 0.011573290592826328f, -0.0029305141831248924f, 0.009975759629790007f, -0.0035293189281042133f, 0.007719664245937779f, -0.011493200804927868f },
+{ 0.01859201304176896f, -0.0069912446056641965f, -0.01849650533554471f, 0.002764865488577885f, 0.003733341469235749f, -0.006477628077456259f, 0.013262319531964986f, -0.006564759620021512f, -0.014589863684521991f, -0.007023088971086864f },
+{ -0.020758184155978947f, -0.004044260150622077f, 6.053375642929175E-4f, -0.005651725972822292f, 0.017032293885254426f, -0.0013436633414422884f, 0.013287735170547833f, -0.008401304764046776f, 8.469369311185078E-4f, 0.013216012044963296f },
+{ 0.002145172469909118f, -0.004182325511542141f, -0.010912663830211194f, -0.016383702522457588f, 0.021437790003589918f, -0.014661795716821201f, 0.0011250312465595621f, -0.012695850752995055f, -0.0031231697820246645f, 0.010631306226021243f },
+{ -0.0229288139891644f, 1.2912477361381078E-4f, -3.224182075358271E-4f, -0.004001220603987741f, 0.012225374125411009f, -0.007551968522443383f, -0.008263975571190848f, -0.009213637198667112f, 0.0016539309002950762f, 0.012808041439083121f },
+{ 0.0048800733594492295f, 0.006121237040004293f, -0.011786943291221388f, 0.012701771577167948f, 0.009575310764677656f, 0.0038497888284310497f, 0.0017043740866786309f, -0.01064532717002239f, -0.021492468935151658f, 0.02053234008053309f },
+{ 0.0040204375611696715f, 0.005013443462846028f, -0.017619224415815014f, 0.023055684209224703f, 0.023377715434240116f, -0.01651963340146086f, -0.0021722396837257087f, -0.01898050754420667f, -0.02125749255232845f, 0.002845130814279794f },
+{ 0.014743445061754118f, -0.00815265688289223f, 0.002378588311517289f, -4.6053813963575665E-4f, -0.004263060065757382f, -0.007316474377490607f, -0.007834450224353334f, -0.005704007452771518f, 0.005471860579680612f, 0.00775230596658135f },
+{ 0.0036228425536371767f, 1.5837146647864752E-4f, 0.0158040068259065f, -0.004597556976085269f, -0.004826887518725772f, 0.013711123396916452f, 0.007682388170105171f, 0.012313669249803892f, -9.460481379416127E-6f, 5.520199063135812E-4f },
+{ -3.784542374173826E-5f, -9.676074239380217E-4f, -0.009700008414090149f, 0.006826857422819083f, 0.019884389023435898f, 0.009261022511375831f, -0.003167252917224856f, -0.018275461022630494f, 0.0042887240517849425f, -7.972799839910242E-5f },
+{ -0.0020005956144846806f, 0.0017533894021761896f, 0.008083572060636363f, 0.014044941628632655f, 0.012514865789148769f, -0.011381698749638408f, -0.0033090921072902024f, -0.002062462874844914f, 0.0033255733922338106f, -0.0012688464822858587f },
+{ -3.942222705155986E-4f, -0.006047701552174199f, 0.0034619725004662433f, 0.021012091212815224f, 0.0235016743058373f, -0.02218153973811086f, 0.0018767773911484071f, -0.017371153681566585f, -0.003145727708583638f, -0.0062641099633050056f },
+{ -0.01134672773084076f, 0.0033904674973982856f, 0.01036664634555261f, -0.024871901225244582f, -0.019168223426528835f, 0.007266026165105723f, 0.013190411517829733f, -0.002453076354647965f, 0.031119348060651714f, -0.001987630936045097f },
+{ 0.04877606992317618f, -0.05470840340993256f, 0.018109276306690857f, -0.022489755303504336f, -0.04468509738760571f, -0.045097039476790134f, -0.017486960739994346f, 0.026329444144009596f, 0.01546857048350414f, 1.7586904023948285E-4f },
+{ 0.018396277316267605f, -0.03450918208382952f, 0.008024319256458743f, -0.03964610413885616f, 0.013972397753076925f, -7.842304516018611E-5f, 0.012571989098304566f, -0.04491665773695515f, 0.005669111094582555f, 0.030149216559636496f },
+{ -0.027214270734754766f, 0.011146530513045502f, -0.010014816673342277f, -0.01947377501213776f, 0.046774664271715144f, 0.022170005367227144f, -0.0055727097663223705f, -0.055183814767460655f, 0.03217947980321739f, 4.07523773832512E-4f },
+{ -0.017008400749244583f, 0.013714968711650838f, 0.01702276228974286f, -0.016098259456042936f, 0.039698854742140376f, 0.0014671688093175986f, 0.006365417510581013f, -0.01669319721952019f, 0.003102126949630267f, 0.035174293433937305f },
+{ -0.02859299717736665f, -0.020611658095028407f, 0.035492284608466644f, -0.03984683015867458f, 0.06483089281753734f, 0.0015584727039382772f, 0.019819704894360295f, -0.07601171123635f, 0.001565555455070947f, 0.02571454643146288f },
+{ 0.01556999376082555f, -0.0031492287343229007f, 0.0010359420747614707f, -0.009874348735839287f, 0.0089856836090489f, 0.011956877283056774f, -0.005981582984198007f, 0.00341839408126578f, 0.002027366646330554f, 0.013939725049601415f },
+{ -0.006962282363724888f, -0.01694702003773731f, -0.009292397057811784f, 0.031222484708739475f, -0.04455914867942344f, 0.008702784954988087f, -0.030935250630602165f, 0.06359453194894225f, 0.013815676351350841f, -0.023784659144887477f },
+{ 0.0034629529702644452f, -0.0010105083688024918f, 0.03594098137945213f, -0.0012546916608615918f, 0.06699158908379695f, 0.00168128742302528f, -0.0056480392847833485f, -0.06175925298170776f, -3.9262111363410376E-4f, 0.01085702090656251f },
+{ -0.018925618918069674f, 0.01084079643890892f, -0.013087716420268274f, -0.03845015360599399f, 0.04434260110260816f, 0.016474211167176626f, -3.3008301953154696E-4f, -0.06438059053079132f, 0.025632743508783865f, 0.022995842392781254f },
+{ -0.00917751419050554f, 0.0019184062976536536f, -0.016799424921962614f, 0.006645572435311525f, -0.0026161291405984613f, 0.0057907499651052635f, -0.02746994340114651f, 0.0332872859175805f, 0.03344189256369214f, -0.019160510862996732f },
+{ 0.0017742550520476472f, 0.002813299951129678f, -0.0032192204101771514f, -0.010140338761942832f, -0.013192480413420329f, -0.0070530197381536f, -0.0023199612144593467f, 0.004965558284260846f, 0.0012865365556709277f, -0.005249673209887561f },
+{ -0.02378706947001029f, 0.03084211868514512f, -0.03927758493866433f, -0.05545983407811053f, 0.048951476921194725f, 0.012191988576355077f, -0.008627505285516661f, -0.005601154365734765f, 0.05607624209570322f, -0.02326131446364202f },
+{ -0.005725844635491415f, 0.012632792987292307f, 0.001411193001728841f, -0.013274270503346038f, -0.031167002247391808f, 0.019428449277526513f, 0.004107724011061518f, 0.046515219351817384f, -0.0015960448860527273f, -0.009812929341111512f },
+{ -0.02660728777124635f, 0.020997085890626654f, -0.010599966621242938f, -0.01699072363669658f, 0.052136222607523305f, 0.003914972150576026f, 0.01277335171856314f, -0.024645522908810388f, 0.01930090049283515f, 0.007822398840660378f },
+{ 0.018094334834275718f, -0.013105379491161088f, -0.029887580571631114f, -0.012476074213323005f, 0.09033065039963836f, -0.0028034162606952536f, -0.0013872354708225326f, -0.05926881674992247f, -0.004903747658433401f, 4.719958055770809E-4f },
+{ 0.004028064973514925f, 0.002124995986971593f, 0.007839509540319695f, -0.01527182104665551f, 0.06273000264466927f, -0.0031884880836533834f, 0.012189606209652147f, -0.05478698950504036f, 0.0045964695674254406f, 0.010895424782742835f },
+{ -0.03027813126678631f, -0.010095118595840486f, 0.06785737311746758f, -0.05488068011004165f, -0.13419103782046163f, 0.050542478742311624f, 0.030994515776948173f, 0.07062867590361627f, 0.04176325806586874f, -0.02929991330282424f },
+{ -0.00944891479738494f, -0.0228735797498544f, 0.006738516100643644f, -0.03931520133291802f, -0.06124671521555219f, 0.02500964342332846f, 0.010740998836178538f, 0.02377671052529648f, 0.017444416614960195f, 0.002196909692895687f },
+{ -0.008210329987203328f, 0.01122536246225835f, -0.013297983545671422f, -0.0060394504055502375f, 0.02207161102602168f, 2.984652918834274E-4f, 0.012058873319947603f, 0.014741775299248517f, -0.007595747459052179f, -0.0031597881523075426f },
+{ -0.018951567345795926f, -0.019476272587579026f, 0.00632538464706609f, -0.03281625683973182f, -0.0568091023481916f, -0.014891123558659292f, 0.036158788923639565f, 0.051257858455820225f, 0.005407593084263692f, 0.01475897485965196f },
+{ 0.009335434057558593f, 1.8171960742192472E-4f, 0.02853867807485944f, 0.010406706685265348f, -0.03044390319833956f, -0.014644372300043411f, -1.8650798319400422E-4f, 0.015433941502615652f, -0.010731777731758898f, -0.01796692194663563f },
+{ 0.0011390229073298813f, -0.014981330639449628f, 0.016316772932651356f, -0.019515237043251577f, -0.08029488293771792f, 0.020031264646088686f, 0.013524160772831924f, 0.07276530119731393f, -1.3204562099713464E-4f, -0.009503748944928494f },
+{ -0.005916859020457984f, -0.028946296156137294f, 0.04839450127804109f, -0.0696809241115203f, -0.1304420966290844f, 0.014262165623574f, 0.03462527375125577f, 0.09316220788776537f, 0.03988296978717282f, -0.03843680694640608f },
+{ -0.011719487484265281f, -0.033983361088330714f, 0.01642155368149753f, 0.028043532043518407f, -0.13853097906117157f, 0.015429508496641901f, -0.029900686286648142f, 0.1333643718183495f, 0.03231493642967333f, -0.03293558967840676f },
+{ 0.009792859041679557f, 0.018976472529190373f, 0.005467316038016607f, 0.004327076071781954f, 0.010696456853178157f, -0.004826883023555115f, 0.010022308645573037f, -0.008001275727636996f, 0.0017524560281611617f, 0.01009535123963184f },
+{ 0.010901027388964118f, -0.030491801712866626f, -0.010094578163123124f, 0.029246040547543102f, -0.059196570580269836f, -0.025322185150630207f, -0.014237536404913948f, 0.09274626400975605f, 0.027351990956148636f, -0.01184669460167177f },
+{ -0.007945355174181174f, 0.0063824255075977205f, -0.012110161841133176f, -0.0047063671171239324f, 0.009368220352054507f, -0.001511276407501301f, -0.003099459301373181f, -5.639968213040651E-4f, 0.003746139540305178f, -0.024819263168846955f },
+{ -0.002480964132250935f, -0.028193209800302894f, 0.02665756936577074f, 0.0090838328446093f, 0.041136788210692485f, 0.011839379695991078f, -0.008313459715224712f, -0.02433133134978956f, -0.0013715706069099803f, 0.00640849656229508f },
+{ -0.031101895961602757f, -0.018070375013898486f, 0.049363081030702916f, -0.04773614547716601f, -0.15610258754077605f, 0.07777353498022073f, -0.011429968360203883f, 0.06992408626407283f, 0.021027321499241226f, -0.03695642236354159f },
+{ -0.015038803807533675f, -0.012357481851543027f, 0.01605522146925054f, -0.02118222478490278f, -0.05269611436109684f, 0.025063073512341102f, 0.011801860301113801f, 0.02800097012068689f, 0.031031830185184947f, -0.009557484568279755f },
+{ 0.01336507887785317f, -0.03154801944531554f, -0.014628229508369077f, -0.013033111609430319f, 0.040558131197640616f, -0.0223788261886082f, 0.011711637484094435f, -0.04461342586708183f, -0.007949621193997643f, 0.017245595437257375f },
+{ 0.04212589292231455f, -0.05734119796921575f, -0.031390409725184754f, 0.004379895481513982f, -0.05291427005707959f, -0.05677297569742629f, 0.02357597501162246f, 0.0652068344407402f, 0.04100387404866756f, -0.011874606775462992f },
+{ 0.022490092484353456f, -0.03577437046149034f, 0.04393300926974397f, 0.02166559217053887f, 0.03132285413544898f, 0.007041605448013993f, -0.03172013321302851f, -0.014193241245077917f, -0.01652364963149038f, -0.012182405105877049f },
+{ 0.03338471496948519f, 0.005191479409807559f, 0.02227866855369795f, 0.028163177749782945f, 0.04353567656619186f, 0.014442250948290169f, 0.009842626146212658f, -0.07108472777452325f, 0.03646004194363176f, -0.013347863655728738f },
+{ -0.029265433125457596f, 0.0015581602651096188f, 0.044225347889701644f, -0.02554986818971672f, -0.05472852562206001f, 0.012692541372738482f, 0.020798147187491678f, 0.06118643015689294f, -0.018242882794789136f, -0.007381846398194197f },
+{ 0.01654897991759294f, -0.003217378160530796f, -0.012139823566280298f, 0.02383621785553134f, 0.07356599116191563f, -0.019120045686699987f, -0.016447142034406708f, -0.04033821353252228f, -0.003974637701571401f, 2.704894648012215E-4f },
+{ 0.0203813119732747f, -0.012213374781825975f, -0.007295351563894543f, 0.01584608200906634f, -0.02317436165212514f, -0.0038164956637491256f, -0.007433467548101075f, 0.01739549060424323f, -0.014166419356898656f, 5.588401696103487E-4f },
+{ -0.004640481919556036f, 6.686642576038226E-4f, 0.03495753732238437f, -0.03914994372717019f, -0.07685738687300835f, 0.03046711362042752f, 0.026059666200931537f, 0.029202921117993125f, 0.025160097899968505f, -0.0219283171957317f },
+{ -0.008463383626556733f, 0.002357269314677135f, 0.015885418647114073f, -0.02511243785193568f, -0.03524217981202582f, 0.03390459308672441f, 0.023548190446988304f, 0.02562245999148507f, 0.021764534695458995f, -0.02142711919384791f },
+{ -0.020313724478818414f, -0.019931636803727077f, 0.013032831492613844f, -0.041269507784409076f, -0.08058542264464194f, 0.03144563492086382f, 0.013108607891236763f, 0.04858064991569129f, 0.03132777439576952f, -0.021790097683346946f },
+{ 0.03421678181280844f, -0.04264603952801119f, 0.044894596722164795f, 0.031528498679803243f, 0.004442309208578814f, 0.028262831803915398f, -0.0037716189136069627f, -0.01590752795064878f, -0.03130877099201027f, -0.04076731821598988f },
+{ 0.002150567733977721f, -0.016372781975433875f, 0.012896074778679469f, -0.04646905476740806f, -0.05915876759980302f, -8.399572140901587E-4f, 0.023573737215542227f, 0.038374141194342785f, 0.016836246958057483f, 0.004724400543650522f },
+{ 0.024196514141879504f, -0.02577070487382506f, -0.0043822424958309585f, 0.03540246095318067f, 0.067389398485062f, -0.03393085543744222f, -0.021146569287968434f, -0.022181796934124507f, -0.00883566536592736f, -0.035077361552790086f },
+{ 0.024906870617698886f, 0.006420860956738523f, -0.01093078903803741f, 0.034589454737412f, 0.05945890595260163f, -0.027621023263058434f, -0.02145001337831329f, -0.060383185354118886f, -0.008574603047591419f, -0.01141756829317612f },
+{ -0.007093117956885285f, -0.006252282358994438f, 1.581421736642205E-4f, 0.0013954194638072972f, -0.013305828974965885f, 0.0047400591127545934f, -0.01033404607160534f, 0.01480520226059366f, -2.9793526365286087E-4f, 0.011883436357098412f },
+{ 0.002219934185454881f, -0.017977315186397093f, 0.07155967046028357f, -0.047678882293926014f, -0.11561682511803802f, 0.04264221793288218f, -0.023581435440325316f, 0.047692398008182375f, 0.031025277402211733f, -0.0037926160010467204f },
+{ -0.014893520158097839f, -0.007983985730049617f, 0.004763510988425194f, -0.025864209297626242f, -0.03051688702601485f, 0.02405398800135888f, -0.0044294852320730625f, -0.003158146984818115f, -0.0059119250130761185f, -0.011896405263261963f },
+{ 0.11407869972930935f, -0.050100059961929046f, 0.001717462131606899f, 0.07154342415820482f, -0.03366053030338772f, -0.01858178638773124f, -0.027196585160425404f, 0.015809380160786354f, -0.11200965170929303f, -0.028815393067318586f },
+{ -0.006881426254441407f, -0.028993496698806513f, -0.0497896791083859f, 0.0459574920803943f, 0.015291601757396913f, -0.0018501368922589987f, 0.005579704852373689f, 0.07713954271147479f, 0.04253605177256335f, -0.04740753056145783f },
+{ 0.07159968259828918f, -0.026784253119130894f, -0.03209394217165825f, 0.08766954443729567f, -0.0015398546666232228f, -0.03666447724734871f, -0.030486836050016973f, 0.048015796669570274f, -0.02564722187837829f, -0.004801475293596597f },
+{ -0.04658684421073154f, 0.016481363792355548f, -0.01544425715370063f, 0.01355122740082039f, 0.047218029756094376f, 0.016753863153442326f, -0.011742386280146632f, -0.04134272044968875f, -0.01887164046222886f, -0.0065671900800496254f },
+{ 0.017581894375770353f, 0.02184155443668f, 0.003714960438747304f, -0.004842631927479011f, 0.008995856443983326f, 0.006282110456735489f, 0.0038208583578115945f, 0.012838918663495635f, -0.0436303760923668f, -0.007432638251795999f },
+{ -0.03774943493313711f, 0.06825583137685726f, -0.04118967247318909f, 0.011607282454638539f, 0.07708941091628121f, 0.00918044335208915f, -0.039402005217682196f, -0.021796948863408737f, -0.01588626174568593f, 0.0015295315733790877f },
+{ 0.06395153237083556f, -0.06390078249880031f, 0.08135721826813011f, 0.0361037277481496f, -0.09197361289683449f, 0.02098120207240421f, -0.038231177118274215f, 0.015649886930274824f, -0.03157431304903938f, 0.030225889967188727f },
+{ 0.018604209138901612f, -9.825810007498162E-4f, -6.592357411263278E-4f, -0.018099167827418654f, 0.027559308357739922f, -0.005143581080123557f, 0.020103712230980102f, -0.0034530863797261574f, 0.014759908139123772f, 4.977966767224094E-4f },
+{ -0.008891227704917326f, 0.0026571363716970373f, -0.035284345750887215f, 0.034817106992586305f, 0.006170486503548977f, -0.015272676223692534f, 0.0011621835270447132f, 0.04812798568599335f, -0.007068302332217309f, -0.0323564948577049f },
+{ 0.10601645686528413f, -0.08546452147590926f, 0.014293168070327813f, 0.09907350551041007f, -0.22276207247706648f, -0.1873169026729221f, -0.019440268357147582f, 0.07351962314467626f, -0.15828672073171504f, 0.011244021575030018f },
+{ -0.04123788537532772f, 0.026894471466985898f, -0.02404781714718074f, -0.030452411250206354f, 0.06367400282501198f, 0.04151583240495697f, -0.04470782411126195f, -0.01699511115150711f, 0.01676368369976143f, -0.06411591619629163f },
+{ 0.010901451159047088f, -0.013125975754397229f, 0.014843203940846317f, 0.07538836165806861f, -0.08987644846631004f, -0.02292238589785051f, -0.09634033301722547f, -0.035321343423941005f, -0.06394283695361475f, 0.034482473450100165f },
+{ -0.08709528996514743f, 0.09585716310319639f, -0.07354603063656905f, -0.024086346981409393f, 0.15704529893170963f, 0.13726780724895202f, -0.11493613469710723f, 0.031604905673209914f, -0.05850204039193759f, -0.14713258360238265f },
+{ 0.007576289849455264f, -0.005323761559792616f, -0.0060089699133728785f, 0.01809422694608108f, 0.07088927445432254f, -0.030649107632125548f, 0.0012325717269067835f, -0.037925607260269674f, -0.0287879189637374f, 5.810807411109095E-4f },
+{ 0.011799615022170015f, -0.030739513724906162f, -0.02374099802294338f, 0.020396545875441843f, 0.03160831375234009f, -0.034027642659324335f, 0.007070490729600348f, -0.02421223415895803f, 0.00506992381349855f, 0.008927306102365046f },
+{ -0.019627432508455375f, 0.0035113723761719283f, 0.008017016748066402f, -0.008477099181555559f, -0.020557724693132776f, 0.005419281409263807f, 0.004446224414632885f, -0.0023202118373667436f, 0.0035165858637960018f, 0.009051436485322596f },
+{ 0.011899026230076331f, -0.015930889177488933f, -0.02130008741209255f, 0.029165200058130968f, 0.047332680957425655f, -0.020209775423572232f, -0.030232021314168283f, -0.010371696554118673f, -0.029660211531463428f, -0.0014998020851691445f },
+{ -0.023714250086394738f, -0.013887121382238625f, 0.013018852199389891f, -0.018140960216824216f, -0.03013938139211935f, 0.016605771370150534f, -0.01469991552211043f, 0.08197538066077213f, -0.006165615744416272f, 0.00712588977274604f },
+{ -7.829718887287409E-4f, -0.03020427302600862f, 0.06384643335051446f, -0.04066070061562964f, -0.09318151680876936f, 0.03950060171074309f, -6.184786096199272E-4f, 0.06265628167486456f, 0.046591071726356646f, -0.007436654773282019f },
+{ 0.009024405935428725f, -0.031573999705858016f, 0.002782724013812004f, 0.028047976346090082f, -0.027717209047627478f, -0.010746383579447228f, -0.026712870414076415f, 0.050465724706840236f, -0.02270079167592333f, -0.004222540021415556f },
+{ -0.004091602791194402f, -0.019598482000355258f, 0.007969398715487144f, 0.0029750981277705006f, 0.01185039635735176f, 0.006940114700600553f, -0.015737295079762195f, -0.019256258714366117f, -0.004890750486569369f, -0.0030341661395379116f },
+{ 0.03394558589391338f, -0.018346615486048042f, 0.016405349646471886f, -3.601163524421341E-5f, -0.05203979885681387f, -0.02517083387957448f, 0.027535801981552283f, 0.0601253178544639f, -0.007820663833836842f, -0.024394873783113974f },
+{ 0.0080909295625713f, -0.029173443753029726f, -0.003943553011029831f, 0.00894882690272972f, -0.11911478148727013f, 0.03449538488663749f, -0.012311224374468615f, 0.09350810637368366f, 0.03639350653751647f, -0.031236901600912987f },
+{ -0.013206926021110009f, 0.0021888550713837426f, 0.01829256874854859f, -0.01653355957113378f, 0.017881818110512957f, 0.013168253773683778f, -0.0038111947478690505f, 0.015734751922860092f, 0.03744616654541418f, -0.015511335400818647f },
+{ 0.05756850511013245f, -0.0818447073244539f, -0.019363811520221867f, 0.023515847092057292f, -0.18325568852240554f, -0.09634732394091178f, 0.08174961640289406f, 0.1852976193145946f, 0.09694559074509994f, -0.05565128645245493f },
+{ -0.018042048630148765f, -0.01941215416114024f, 0.004365014543012074f, -0.01829366385556898f, -0.06162034464400547f, 0.021890953454366268f, 0.02443617037139243f, 0.07644619739558511f, 0.010212556566192217f, -0.02696251501384048f },
+{ 0.013033395938480529f, 0.018028049628768243f, -0.009430084718756166f, 0.00398014215850218f, 0.024574462028103535f, -0.008308103041318009f, 0.007205920319327511f, -0.03589760492196037f, 0.013392567291640022f, 0.0013166334014688623f },
+{ -0.014761446916654479f, 0.020479377847364803f, -0.01314184875753729f, -0.010715348478821019f, 0.029026676625465507f, 0.005824353767089271f, -0.014742724098000095f, -0.041939832413283654f, -0.004396526466838206f, 0.017216073872840854f },
+{ -0.01989207574616698f, -0.027988618470288808f, 0.047176550493639814f, -0.04310778607962629f, -0.06535784449976796f, 0.02292012983302277f, 0.016339944485583933f, 0.03138295376593885f, 0.01788976144880706f, 0.012841566582495374f },
+{ -0.02691598061091215f, 0.0492649736597169f, -0.04034604105520939f, -0.024541252563516833f, 0.1123688747097917f, 0.004644106005427412f, -0.03340724202409502f, -0.05869805199261198f, -0.019512240556890992f, -0.019396549179228628f },
+{ 0.001987904883075284f, 0.012998932379612643f, 0.001757385507402586f, 9.040656824779994E-4f, 0.02510060138861667f, -0.002755098449747673f, -0.026747545697124925f, -0.038583420388780314f, -0.02404343895884897f, 0.020284439626940844f },
+{ -0.039746547798373735f, 0.014627349536017168f, -0.009258760332614017f, 0.15292661472663396f, -0.07919673419642438f, 0.14201401254810586f, -0.06006066639022622f, 0.11755933360935025f, 0.036551853978255236f, -0.11754632492493375f },
+{ 0.035935917814171235f, -0.03106554428917436f, 0.036528564932592045f, 0.05731684270698796f, -0.11471364565079892f, 0.018155637921737723f, -0.046733843863099624f, 0.04582193409121544f, -0.07445879597823654f, -0.010342757604640923f },
+{ -0.004136979023669091f, 0.0021855116132613248f, 0.0012075556423233578f, 0.004336336008649803f, 0.07748641071440636f, -5.844410685331554E-4f, -0.0077409073604104385f, -0.039844841310259525f, -0.010133027261699554f, 0.014429759990780737f },
+{ -0.017950513719302886f, 0.014452763072822013f, -0.0015949654521089567f, 0.0032826967761157835f, 0.038150720041404323f, 0.01185345599892231f, 0.01019732738206571f, 0.0014333281774429698f, 0.014017932501388013f, 0.015521519367287892f },
+{ -0.05679378835424567f, -2.4137730614420005E-4f, 0.05747975588143858f, -0.09558697910691788f, -0.09572462750693217f, 0.04864330608841254f, 0.03480359814582267f, 0.05447949891650499f, 0.029924055121255823f, -0.00839154134925108f },
+{ 0.00925110802773852f, 0.004141169544879614f, -0.014555535278199822f, 0.004934180490886007f, 0.04589916794207855f, -0.003850634286734693f, 8.225962023150567E-4f, -0.05573956597238862f, 0.008252415152223243f, 0.005520192784872321f },
+{ 0.006387823291082413f, 0.009737812468622714f, -0.012283597040303584f, 0.026467171404129484f, 0.009814622519789063f, -0.01938690205970965f, 0.0036328533899330244f, -0.0037200949789088222f, 0.007385422371446379f, -0.0134551531870905f },
+{ 0.034920756801145f, -0.004119253794543319f, -0.0345845791987509f, 0.04020099874825281f, 0.0716716132794906f, -0.006429952751270295f, -0.008478617277662711f, -0.04861243825402233f, -0.010258384186081795f, 0.00761588304268009f },
+{ -0.027405173787130546f, 8.261437364674758E-4f, 0.030213840373651626f, -0.0421622277346491f, -0.013881550496843097f, 0.007721000539214285f, 0.01239838400572867f, 0.014954824329653685f, 0.025217092391569898f, -0.007116728497955496f },
+{ -0.013575327750698755f, 0.037489307000499766f, -0.03662691995998585f, 0.029865010442421888f, 0.027610378364649232f, -0.0025764900345489165f, -9.912063597491284E-4f, -0.027873542023313894f, 0.009167985361101241f, 0.02367894826561083f },
+{ 0.007011305608809743f, 0.01124312596268768f, -0.014166538961992355f, -0.01484038139042842f, 0.031204586222213716f, -0.0017552691668264253f, -0.0022460056956980254f, -0.002839036707723778f, -0.002790625432212556f, -0.009091243025538504f },
+{ -0.027894131606985274f, -0.011369244044487073f, 0.02679016964756794f, -0.03322832414307301f, -0.03918130798977787f, 0.017143150643640765f, 0.010130819159921107f, 0.053266429513434264f, 0.033589108765434895f, -0.04011527980335022f },
+{ -0.047722681559673324f, -0.01731310550229943f, 0.10625406825098455f, -0.11316734163252985f, -0.12980659657346108f, 0.0773726891382553f, 0.029435964593585082f, 0.055133962253512594f, 0.08740190917466069f, -0.01011535907300396f },
+{ 0.020678243341239105f, 0.010868373057448652f, -0.009361620246572706f, 0.015212471948258094f, 0.02494005398365898f, -0.021172103701980013f, 0.017875674716805595f, -0.012416170670501584f, 0.010727994885104777f, 0.004838863827012186f },
+{ 0.01698266982783742f, 0.0031519148357693175f, -0.01674232647380037f, 0.021052679425663016f, 0.005302549394384633f, -0.014932664450078448f, 0.006839076806005476f, -0.032818246391153695f, -0.01529422065547767f, -0.009166666382234465f },
+{ 0.00868291603259733f, -0.017596691677047985f, -0.05125093088837425f, 0.012706149576498597f, 0.03401133216068807f, -0.008876379594386509f, -0.01707738571985638f, -0.021799478375450987f, 0.008122988995366141f, 0.004531095238121189f },
+{ -0.03595830949373273f, -0.0366828602345304f, 0.09740377000182493f, -0.07838344897648392f, -0.16947577742122424f, 0.07445212286170062f, 0.010286559917770454f, 0.11989267754876652f, 0.02430651323473671f, -0.034153513385623044f },
+{ -0.012003140276764966f, 0.03361351797445858f, -0.03475444682175501f, 0.014512661736811852f, 0.04633224998494289f, 0.0027413019856001733f, -0.026740485233613564f, -0.0329155048826365f, -0.007019927755360879f, -0.003227129846181325f },
+{ -0.005920523916207056f, 0.03190172060136926f, -0.03371712820605917f, -0.04449224671628113f, 0.05842912617997649f, 0.006676255247345072f, -0.02548111493858135f, -0.011399645246660631f, 0.04146565747353905f, -0.014444426397947045f },
+{ -0.003033305030930895f, 0.0033004046146007165f, -0.006434060692883825f, 0.009152844012792446f, 0.0037781681718934844f, -0.0170824948037039f, -0.04403819788912102f, -0.04122542075562005f, 0.007144112258342347f, 0.0010428358454255898f },
+{ -0.009731427670968578f, 0.03072628359622799f, -0.029030956146619383f, -0.02751279565107552f, 0.06431263915852825f, -0.0010873606486628393f, -0.007722228397367233f, -0.03701306197208179f, 0.0429088222298539f, -0.00595892270548571f },
+{ 0.007560629046800606f, 0.0032716224531264375f, -0.003005964161826132f, -0.008617027200664653f, 0.017954949817878797f, 0.01469143158166292f, 0.0011864182298503992f, -0.02440434390956776f, 0.015211578716411597f, -0.0026607346233155017f },
+{ -0.0019402602403344005f, 0.0017814225451976136f, 0.0014813245648972707f, -0.01241121728948776f, 0.003532653277257181f, 0.015453387781124775f, 0.009233465289060678f, -0.01630324461530481f, 0.019189338912648787f, -0.011113070604366624f },
+{ 0.030260197164028488f, 4.046234126027741E-4f, -0.030979333530985885f, 0.04470701646948413f, 0.06244993907158602f, -0.028418804587897764f, -0.008840038886542822f, -0.03378888208596056f, 0.004232056198872765f, 0.005588186875810449f },
+{ 0.00798510040695786f, -0.0020443843690296946f, -0.014213256640032618f, 0.002067795755766454f, 0.01949362432755653f, -0.02022399997239285f, -0.011450480308857152f, -0.0167155608441428f, -0.005463509569319198f, -0.018803312053550427f },
+{ 0.0037721249520611517f, 0.01376215458956629f, -0.006763211544461876f, -0.016997620670984367f, 0.010096260072721113f, 0.016981380046416528f, -0.008703685102247942f, 0.006233916568064719f, 0.01919905021764512f, -0.001466645207882049f },
+{ 0.013954558999963087f, 0.012548367603769562f, 0.010852521207231588f, -0.00524365149572944f, 0.007589827387991758f, 0.00819488535403662f, 0.006937004010362488f, -0.01616441986988529f, 0.020988787682897005f, 0.01320015361134758f },
+{ -0.010118312095042279f, 0.03406723599438182f, -0.07787128515475296f, -0.0742783369385277f, 0.08428220276527942f, 0.002838414185490741f, -0.03891697158415923f, -0.02806174890346042f, -0.04507357198055324f, -0.07708012841133942f },
+{ 0.007097098621118039f, -0.018117138557877322f, -0.021598089491194617f, 0.020407711493418614f, 0.024214132875988753f, -0.007004193462026271f, -0.009640324728761257f, -0.02342021048096902f, -0.01739190680235367f, 0.023249609805969792f },
+{ -0.030649047183135023f, -0.04367402387321355f, 0.12609388768196772f, -0.1448253106655559f, -0.17296762071230942f, 0.06341924072076288f, 0.016586242698603103f, 0.03885887860392197f, 0.1187971585933541f, 0.013679849779094692f },
+{ -0.004465105642796289f, 0.005954613260362362f, 0.005621636317634933f, -0.018083114126765675f, 0.0273674415279415f, -0.0024815264232357806f, 0.006153997962235743f, -0.008572808940061762f, 0.00877599745808231f, -0.014311617734725132f },
+{ -0.010504063367424647f, -0.009495306398459824f, 0.011847923364783759f, -0.06733172830179855f, 0.02216168575300232f, 0.02519156993492803f, -0.037171829156642085f, -0.0047869758626250015f, 0.03654841086673176f, -0.00939681533659744f },
+{ 0.010095544143159817f, -1.2664083133534724E-4f, -0.011014738567068654f, -0.003899291260279648f, 0.003276058816117421f, -0.00895208283322123f, -3.630479401244717E-4f, -3.991786921376675E-4f, 0.014100525806033094f, -0.01448996000074172f },
+{ -0.014330913851166461f, -0.003952469520612596f, -0.0032611060415848585f, -0.007033829895085346f, -0.01149775360397522f, -0.016586292034199115f, 0.03423521720312999f, 0.05475590406955814f, -0.007695742304263972f, 0.005292894095645681f },
+{ 0.0014890678360134433f, -0.01632302995278089f, 0.004888665694730158f, -0.001751297287898533f, -0.007390214227480973f, 0.009624917535745398f, 0.010507361636319771f, -0.0017671935691936055f, 9.456423041959774E-4f, 0.022070415221174162f },
+{ -0.03530618557165795f, -0.020601332374699573f, 0.018466842934450032f, -0.013554604829803765f, -0.023908967726123196f, 0.02594452960822428f, 0.0028565400193133364f, 0.04375918711913242f, -0.025443553358549587f, -0.007958817682687452f },
+{ -0.009863031792067458f, -0.015496991665394368f, 0.02382225498562214f, -0.05098067209159836f, -0.031014284359858518f, 0.031129113287188863f, -0.014362703172443574f, 0.01213427369044466f, 0.016297229493297285f, -0.013655979464729741f },
+{ 0.012117233658055183f, 0.005275937589505039f, -0.015376545045795983f, -0.00384198884435747f, 0.008171466684667516f, 0.0126153158164584f, 0.003923514866105061f, 3.4214932637218804E-4f, -0.0012824290466299179f, -0.001518469384638064f },
+{ 0.004163243067664893f, 0.0010145948500613425f, -0.004322384504105012f, -0.011325167060141498f, -0.003155791569492237f, 0.0032815651429039332f, -0.009899602585905377f, 0.0062777791570035645f, -0.022377225930994935f, 0.008918063877437132f },
+{ -0.008047825848662399f, 0.011599143989497376f, -0.010184481966528712f, 0.0021733529568257184f, -0.008501148028397833f, -5.838066162545165E-4f, 0.005281333760228385f, -0.006677796427985499f, 0.012172716385174125f, 0.0041564349758502215f },
+{ -0.0064308769160436215f, -0.0023614967181944655f, 0.005531479083084655f, -0.042204853673741716f, 0.007552062924423809f, 0.004784246959024206f, -0.02256486894737206f, -0.005870626688035421f, 0.029514929149339342f, 0.0016427111809514017f },
+{ -2.8900509046326703E-4f, 4.3893503168601405E-4f, -0.003952132691143515f, 0.005457865071978564f, 0.004560815046250802f, -0.009804649110460244f, -0.001718023392120847f, -0.01032874731197127f, 0.0022270180017998054f, -0.010047418444512011f },
+{ -0.014403086344526925f, -0.0156076857452393f, 0.05265158611760019f, -0.03849806225682361f, -0.08506930496626812f, -0.003159940126674418f, -0.0025598241396739244f, 0.029516969476081227f, 0.052522267948915353f, -0.01214681316592807f },
+{ -0.12236492395845408f, 0.018377503678694906f, 0.09067244801524495f, -0.12556453871741904f, -0.11544535583284721f, 0.07883981394003779f, -0.013234495640457719f, -0.03499226058587537f, 0.15361980531821492f, 0.06809564494782959f },
+{ -0.0681661674845597f, -0.021606387621999238f, 0.07393084413056776f, -0.04643879620956141f, -0.048325502310933424f, 0.024724009600730155f, 0.036580947390374055f, 0.12859107997694783f, -0.032330325715563026f, 0.008746242703617246f },
+{ 0.007284215076282095f, -0.008099370815101474f, -0.004492039089459214f, 0.02252197056146106f, 0.07419962829866557f, -0.02496183384659321f, -0.00124219086245176f, -0.04986240266865747f, 0.017585483373411495f, -0.014150265321863037f },
+{ -0.03825741977176927f, -0.02389061335697039f, -0.060861952414176364f, -0.01840735729424395f, 0.10362983606763822f, 0.012231121515281955f, -0.03791805110717601f, 0.014664143229897921f, 0.05147863986704497f, -0.0037532306319876143f },
+{ -0.03703397528416396f, 0.003061311616068458f, -0.010597159247491661f, -0.009688177240275743f, 0.006841441235202234f, 0.04685858497903608f, -0.0717411058175228f, -0.03815326630034328f, 0.045615297525033516f, -0.030580241462427056f },
+{ -0.12273129650326534f, 0.08383996421809638f, -0.009525382654843623f, -0.03253667233060811f, 0.14308176747719367f, 0.025580836809113567f, -0.033148973292460235f, -0.05240777109072414f, -0.08181054168145944f, -0.003622880709232147f },
+{ -0.027726517283843687f, 0.012987348819861683f, -0.05796476989170375f, -0.0234463451946454f, -0.17270055194862347f, 0.0021034225682743895f, -0.09766806580556661f, 0.012395313146046328f, 0.08687957515214506f, -0.009206083486765096f },
+{ -0.0077735673122069126f, 0.00179177575929893f, -0.0045672372370186756f, -0.002585526759256631f, 0.010993354409184931f, -0.0171462532006054f, 8.646089780677983E-5f, 0.004366303318497548f, 0.013607450519483128f, -0.01202085918433442f },
+{ 0.025078621003265095f, 0.01595107518856639f, -0.019394932231417233f, 0.02625865666763432f, 0.0554654213035351f, -0.015901287307671232f, -0.018485483540729448f, -0.03217465061327644f, 0.018325381380007215f, 0.023146759274330044f },
+{ -0.006229063743141219f, 0.006950341013768946f, -0.02920690576532326f, 0.003989592565776356f, 0.0599032456451146f, -0.01975745850079058f, 0.021609264206223677f, -0.02328726187210329f, 0.01981666653557298f, 0.00906527971172001f },
+{ -0.007071767948922287f, 0.017741613255380193f, 0.008714499436521474f, -0.024642181177234605f, 0.018659568681737355f, -0.005475728191910058f, 0.016124978860706164f, -0.020190458989522524f, -0.002484809045249035f, 0.0012188919161393327f },
+{ -0.02597483834745508f, 0.0200578302390486f, 0.009770402775546482f, -0.014072582921116334f, -0.02917509668585935f, 0.02331834128052459f, 0.003650660076345576f, 0.0019511314723729878f, 0.024971270263709915f, 0.011875285343576288f },
+{ 7.162139063797245E-4f, -0.003938019045562129f, -0.011519310421341333f, -7.792278772640629E-4f, 0.003533124934208539f, 0.0071373467551697324f, 0.018546786217354665f, 0.005677340803109251f, 0.005920051487633757f, -0.019846558381511396f },
+{ -0.010007827366755364f, -0.027316357671803994f, -0.010404131976115316f, 0.007712749511673293f, 0.04872191538594044f, -0.010503589657986786f, -0.0023857352329621742f, -0.02110306471440061f, -0.00577626320542326f, -0.031223700316123103f },
+{ 0.009875977271540257f, 0.012166075600433703f, -0.0189483071124354f, 0.005954897831954072f, 0.0031585413101504526f, -0.016412827304772063f, 0.011994024315716086f, -0.015324747810636103f, 0.009111285664122244f, -5.871728608816042E-4f },
+{ 0.01869920562250107f, 0.007318038093259356f, -0.012601813835619636f, 0.024442348378004537f, 0.027210469662630108f, -0.014687152101531726f, -0.027733524509681036f, -0.03050809171796903f, 0.002101145043286521f, 0.012497261293928006f },
+{ 0.0026061975157168644f, 0.009560804364187122f, -0.00984057313007924f, 0.002919151959847255f, 0.052216325067037224f, -0.006932268535610747f, -0.020071913322764052f, -0.051243135565171904f, -6.402037083251263E-4f, -0.004303263322541148f },
+{ 0.0025764999880815505f, 0.02201501161219958f, 0.0021217716767959528f, -0.02302587100299559f, 0.061399094915852846f, 0.013749514721852424f, 0.012670692720308048f, -0.04449601236633802f, 0.01718372711471352f, 0.005526704472388351f },
+{ -0.009469664803445924f, -3.5149452687505345E-4f, 0.008643817602905751f, -0.0050554636992160736f, 0.007922650315743998f, 0.005183479613482224f, 0.0207842175606408f, -0.01472126938372202f, 7.16833764075732E-4f, 0.0059019872023709135f },
+{ 0.008302722924745187f, -0.008926769334406684f, -0.0038592751154642563f, -0.005412020522924375f, 0.01624454351581069f, -0.014234288097234435f, -0.002217020728930089f, -0.0032798709410888026f, -0.0025715875733075206f, -0.005818805844122167f },
+{ 0.0011186152886882967f, 0.0205688986314885f, -0.013992734419140574f, -1.7520762271773475E-4f, 0.035237036029555205f, 0.020704340023428913f, 0.014746350607686306f, -0.014623773203090074f, 0.01234201539542369f, 0.005399827138082581f },
+{ 0.01641985789050907f, 0.007719757243167645f, -0.006432616780723593f, 0.02212996182448148f, 0.06183880806555354f, -0.017823519201624644f, -0.006333956728100071f, -0.03521999383791146f, 0.01555728440620154f, 0.003834849673100317f },
+{ 0.011644408934323685f, -0.0020529020617930716f, -0.0023978837940636165f, 0.004192171668042607f, -0.011297331867507704f, -0.005387045181618137f, 0.023992556737196018f, 0.008550874417252267f, -0.0010375162336593398f, -0.005679070016572477f },
+{ 0.006827255645785376f, -0.03749045602164284f, -0.0023885228001881567f, 0.05171229277430073f, 0.054238193616165234f, 0.008847852577396051f, -0.026017010162845137f, -1.0315409249342834E-4f, -0.02827938170658898f, -0.008276910303081735f },
+{ -0.02548598907230415f, 0.012830159247415833f, -0.07938908458606818f, 0.01967237029756853f, 0.08705716008705812f, 0.0359074608724274f, -0.06444481771163267f, 0.08100324063707144f, -0.06102765392419965f, 0.02743933609876882f },
+{ 0.02287139793751108f, -0.002155972546768996f, -0.004889644641041952f, 0.04119349406585302f, 0.07532707281049411f, -0.04156520076195598f, -0.006036022546264446f, -0.012658201339589701f, -0.025755006005603792f, -0.02139237680192099f },
+{ -0.03471332886402399f, 0.008800742719061052f, 0.03155370418608545f, -0.07210402976452991f, -0.10576006263988277f, 0.03340161326124062f, 0.014614665021798938f, 0.021002645021907212f, 0.06104067120790484f, 0.0022266720783805246f },
+{ -0.03943983584712046f, 0.02515481381633727f, 0.012636023874157657f, -0.019262739380177148f, -0.03875079177884629f, -0.02100077664291675f, 0.009994895445080754f, 0.05239475295835661f, 2.2820501556040305E-4f, 0.02989841352393834f },
+{ 0.018350355335250108f, -0.007205703933224898f, -0.010175486082353058f, 0.03316430122543808f, 0.050204064122822536f, -0.023830436341803877f, -0.012216550160511186f, -0.047917880791663675f, -0.007203421808785186f, 0.004618308284598194f },
+{ 0.0025091328657261785f, -0.02389261532281771f, 0.050646728455551036f, -0.05616055453160979f, -0.11057803497968385f, 0.04166090737561238f, 0.05762489438559055f, 0.044660039344787204f, 0.016266676578797615f, -0.01693870320348038f },
+{ -0.032808989322507254f, 0.00753187006779202f, 0.06267519284649774f, -0.07564404811808553f, -0.08717827456823726f, 0.05487696901656733f, 0.04052211071116483f, 0.052110108705143404f, 0.041922304845747695f, -0.03145357009800007f },
+{ 0.01097070863261794f, 0.016985765129204043f, -0.0013117189320044917f, -0.0076999763788721184f, 0.009185252233831438f, 0.020757059911234565f, -0.009545081824132327f, -0.009113403398586383f, 0.027386748668726722f, -0.026078782368521035f },
+{ -0.04452695939949351f, 0.011824315336939215f, 0.01590960278425117f, -0.0407152017395779f, -0.05869713072132809f, 0.027214335109282162f, 0.018099333112305892f, 0.02637502234648863f, 0.03242727828149248f, -0.0029938501069033136f },
+{ -0.08683656131556591f, -0.002819606510998314f, 0.07256802514179073f, -0.10338419476392155f, -0.13310339361091306f, 0.062140280306242024f, 0.04178101825974703f, 0.09142810823168253f, 0.016635502710377024f, -0.030983428483710686f },
+{ 0.03714167905192425f, -0.013528229199799291f, -0.010320940339255874f, 0.03105621976489241f, 0.06780330385238047f, -0.006384727403959095f, -0.0023624563059305484f, -0.06262926094136641f, 0.045514071449544016f, -0.0030480897013711425f },
+{ 0.017459002302822983f, -0.001800048178069181f, -0.012753591404912229f, 0.027947763497246134f, 0.019413019573715433f, -0.012733895329237252f, 0.020734631845572386f, -0.011302210540484553f, -0.001854039176307749f, -0.0034222666639101037f },
+{ 0.023516459940112193f, 0.0050333563619447035f, -0.014061049596095257f, 0.014727387218192623f, 0.06055863328076574f, -0.011325522677118434f, -0.02653368295007499f, -0.018009275089747562f, -0.020596831947564707f, -0.01362208856983779f },
+{ -0.00827299911923122f, -0.030815092668028465f, 0.03796125379231952f, -0.04698412134311759f, -0.08313340454662922f, 0.015607152392028277f, 0.010357936167628734f, 0.03251488662129478f, 0.006463905146239427f, -0.025967899342170964f },
+{ -0.011012739115932436f, 0.03460982014719302f, -0.02144519071102975f, 0.03167426977697912f, 0.040786144614690135f, -0.0012440067368143638f, -0.010551964303963657f, -0.03433084093586094f, -0.031096630419034876f, 1.169486758864549E-4f },
+{ -0.05157765239970251f, -0.002180013104370262f, 0.07332532903567425f, -0.08551674995803767f, -0.06605476742393152f, 0.06744561361096817f, 0.009579307449353367f, -5.959699515835695E-5f, 0.06242941423260143f, 0.0013860537012315498f },
+{ -0.015228028121850827f, -0.015829870333651793f, -0.0630413522737606f, -0.004386657094096452f, 0.11854713025340782f, -0.03506157062332373f, -0.06603254975174623f, -0.10559368008514554f, 0.0062429722862067305f, 0.0471225071348427f },
+{ -0.04696944133440069f, 0.031263959673057576f, -0.04514417987030561f, -0.008767813782214598f, 0.1390145798974901f, 0.023073781787023875f, -0.02944195129029249f, -0.1396612991693001f, -0.010929652851520207f, 0.04830037382224202f },
+{ -0.001070479823166564f, 0.03947380657573959f, -0.03385879766654237f, 0.05421321438810701f, 0.12324832299957818f, 0.01947565382435118f, -0.0580797344901327f, -0.051700420501399516f, -0.031692824472405345f, -0.022337036754016732f },
+{ 0.0323656069040593f, 0.007479824339874529f, -0.03537942108922717f, 0.026768345026839127f, 0.0823315342241174f, -0.008597373521066909f, -0.03035110193689071f, -0.06246272592504226f, 0.002211620794529037f, 8.789050828014163E-4f },
+{ 0.01716377455516418f, -0.0020122657770092326f, -0.016550296614369332f, 0.027598867318649564f, 0.017254628771370083f, -0.012015363810322295f, -4.3431214028486826E-4f, -0.02194041434226372f, 0.01444644382966207f, 0.003217036049647334f },
+{ -0.007082861780994499f, -0.010863763588776788f, 0.002340129028267107f, 0.01673992910015388f, 0.005488149545567926f, -0.006725138327835726f, -0.0066372464606547915f, 0.025143363883084684f, -0.04257222569384824f, 0.006384162682928161f },
+{ -0.09701899949307197f, -0.03644319238963425f, 0.06673500882144695f, -0.060425090595803005f, -0.028103781146715294f, 0.02595060817844908f, 0.014572555507563206f, 0.044676567834162184f, -0.1531445605398463f, 0.018639428158719506f },
+{ -0.015432959015205236f, -0.016989251759809518f, 0.005710238930446844f, 0.0022699723171919037f, -0.038799169831526543f, 0.0180346897933335f, 0.017970236851343236f, 0.04767097867337582f, 0.01431846992198656f, -0.009682336671705965f },
+{ 0.004712844478106906f, 0.009500989727872538f, 0.11792502282308805f, -0.21490219999372684f, -0.2770743858021432f, 0.10861180852932766f, 0.02296868094409471f, 0.07482346096170844f, 0.11155704091680717f, -0.04145729256648463f },
+{ -0.04848351667588813f, -0.01502807237352205f, 0.03364029619902087f, -0.07034924983795443f, -0.06428562236024864f, 0.056221190677088015f, 0.02753309366793032f, 0.004878334670447761f, 0.033639848635513434f, -0.01158450545969493f },
+{ -0.04999603415404162f, -0.041583294609296974f, 0.09388137366040038f, -0.10520810018346426f, -0.16286113525375737f, 0.06947480501127412f, 0.04698918164982569f, 0.07919443369522931f, 0.0805898269082776f, -0.03341556979090302f },
+{ -0.10657205719064146f, 0.0881063446730538f, -0.014124598457524347f, 0.010165123091800144f, -0.06701881516086719f, -0.020110780738847717f, 0.027816523107920307f, 0.053145174928644914f, 0.07484377322803326f, 0.07459490468184474f },
+{ -0.010098661944090315f, 0.0330493948369278f, -0.019638232582540525f, 0.031342302533348194f, -0.0030148220049416473f, -0.007525160204488418f, 3.742424769754599E-4f, -0.011328494128081228f, -0.014994144433449017f, 0.039524420863287044f },
+{ -0.040106076971759906f, 0.011878042356224737f, 0.024709852555450586f, -0.03460698096962344f, -0.07520245410393181f, 0.02473546822873395f, 0.03233981766098895f, 0.06496605739517354f, 0.03432973087250083f, 4.927322130944199E-4f },
+{ -0.09460408119763065f, -0.013585321692521638f, 0.10918007086976901f, -0.12488471590836502f, -0.1513011350684105f, 0.1066775782162855f, 0.027563044100549498f, 0.02434744802264022f, 0.07211522992606696f, -0.03439675104402814f },
+{ 0.01644803114846758f, 0.004368498728726476f, -0.0155115834367475f, 0.00456794132535497f, 0.042102935088722135f, -0.03183538458291046f, 0.003985348567782352f, -0.017887463545454608f, -0.017352916589941963f, 0.009255278637099153f },
+{ 0.0027822149400069393f, 0.013597372129406168f, -0.011230259297784831f, 0.01540646202013271f, 0.05738680976838394f, -0.00859522586009822f, -0.0021322446650236192f, -0.04972805666008686f, 0.007390401960145754f, -0.0027270852800991385f },
+{ 0.0020547498808828274f, -0.0041500955009361115f, 0.011843961937391819f, -0.02511862028546437f, 0.04280297090166242f, 0.009835495714557429f, -0.012030951041665532f, -0.04734992102783551f, 0.04026592029218836f, 0.00941709622110323f },
+{ -0.010654377529282449f, -0.0010978190564405424f, -0.010183548671962691f, 1.8318465291102744E-4f, 0.0537038977189167f, -0.024178764797761914f, -0.02167578905909917f, -0.018181757553739f, 0.04230244247586381f, 0.007310920710259566f },
+{ -0.031785593926780924f, -0.03302992040140388f, -0.0012853174470850554f, -0.03981101243740685f, -0.046744858430153594f, -0.008863202621584628f, 0.04219715485130715f, 0.07521417529226054f, 0.04372341640225351f, -0.042172444878658476f },
+{ -0.04131993364023041f, 0.025411137692693757f, 0.05037768857328085f, -0.04273459894823877f, 0.06564206627543503f, 0.02686412478072126f, -0.015168108010090438f, 0.0066167298150581555f, -0.013316513471665911f, 0.023028518083449013f },
+{ -0.024199998273791445f, 0.007304557867952629f, -0.01677706210237454f, 0.023458109480366484f, 0.04921923866787531f, -0.009049003561814673f, -0.018806039031977282f, -0.022887435774900357f, -0.011591184955342154f, 0.024106084054936083f },
+{ -0.0018987126038532607f, 0.011951825649907957f, -0.025056888472338123f, 0.03413292948859404f, 0.08100561481826199f, -0.010149589897306988f, -0.036949310817724984f, -0.04639888772919386f, -0.037400672021329566f, 0.013615520027209664f },
+{ -0.08980459297726265f, 0.028740909103374065f, -0.0028251860079257255f, -0.02944330555164738f, -0.06659260673173435f, 0.06379350882781462f, 0.0640943265843129f, 0.032206413591186f, 0.02746773503735421f, 0.013054204858643547f },
+{ -0.05630076669074879f, 0.002586359606370705f, 0.04276562157444265f, -0.057157897305395305f, -0.052601587757584084f, 0.04419738715161748f, 0.030617161952542448f, 0.056162766192979566f, 0.0017335479233621493f, -0.016094898713557987f },
+{ -0.010629951183156483f, -0.0034515015777323767f, 0.026361342461477637f, -0.021980603376443978f, -0.04521695016277138f, -0.0013868642267844435f, 0.009867595474345124f, 0.01340185624885389f, 0.007277279507315231f, -0.018950479863264015f },
+{ -0.0906447257185303f, -0.013542480772499407f, 0.07431732107233904f, -0.09694524243191215f, -0.11433769914339323f, 0.06893137534285261f, 0.07973739742483042f, 0.12239268049954882f, -0.003347519429040034f, -0.04233629376289528f },
+{ 0.010661945715552885f, -0.0029292231138834147f, -0.0019231477649486878f, -0.023689188433050647f, 0.025103403652513057f, -6.645246917706915E-4f, -7.969998768554094E-4f, -0.009766259677825496f, 0.025027040202602626f, 0.007581144120394289f },
+{ -0.0308952093581741f, -0.02616151359288134f, 0.018362676461445147f, -0.006933846051189529f, -0.006131624128850204f, 0.019439306178125202f, 0.00833338779711344f, -0.009261061901669698f, 0.012080365329684671f, 0.00827116117765303f },
+{ -0.06164766993133051f, 0.02956168251381314f, 0.03958107823277422f, -0.013079210355719828f, -0.05329586880616283f, 0.05509354857940574f, 0.02613425202710185f, 0.03564241983665252f, 0.009372548449666684f, 0.005627496449895055f },
+{ -0.06707940395701775f, 0.001549190269439756f, 0.04091664703770789f, -0.017457109354587563f, -0.056443052181414884f, 0.04560396882305299f, 0.01758858646872329f, 0.05743546397301477f, 0.012323082861713968f, 0.00905046625106904f },
+{ -0.02602267269548637f, 0.0027459898605045824f, 0.03415755005120548f, -0.01780349390460852f, -0.05562636676895097f, 0.03028600840609989f, 0.019642433597328243f, 0.030064653914042505f, 0.0036892010421274734f, 0.006117884429667313f },
+{ -0.04546396571182758f, -0.007416242940797069f, 0.044472265909068776f, -0.04507299748128469f, -0.04357825789672316f, 0.04452310886199514f, 0.023363123537942346f, 0.017821252271891096f, 0.0241994655294708f, -0.020593059844820853f },
+{ -0.015324087144781928f, -0.013296978986782806f, 0.036198978145391796f, -0.04444197130075389f, -0.056048583682057805f, 0.03167618822899496f, 0.027398793569112324f, 0.05016943273235673f, 0.0034672755457599903f, -0.01690249978152613f },
+{ -0.02037707240754413f, -0.015552220499258789f, 0.0252588755226098f, -0.03514924447976064f, -0.04420201887295369f, 0.00209643445410592f, 0.028778068675718475f, 0.02522287749132765f, 0.0173576917485763f, -0.01853194342833338f },
+{ -0.011191963997977632f, -0.0018269558683146655f, 0.003733887773215511f, 6.071877116591718E-4f, -0.027819936096548106f, 0.012161429323749582f, 0.01209234043403472f, 0.019585845634401078f, -0.014431738340905673f, -0.013947807113255169f },
+{ -0.034698177410684615f, -0.0106126084695415f, 0.04367877858379352f, -0.054226099553744314f, -0.08654052879730716f, 0.036712307934000585f, 0.01909797790091013f, 0.05197137743062103f, 0.018767284058070273f, -0.016866047272343043f },
+{ 0.003108974430558805f, 0.015085764398243018f, -0.009378513736555209f, -0.009030148875243966f, 0.007573324156057562f, -0.01883439891234184f, -3.3160087374452994E-4f, 0.005923056744843234f, -0.003914821743585779f, -0.004771755658573979f },
+{ 0.010251190641208363f, 0.005433369099135909f, -0.005513897523431144f, 0.03004187662899551f, 0.034539007506416676f, -0.003636891536702205f, -0.010197721759820809f, -0.021800510173374244f, -0.017470108700001104f, 0.004816203046144497f },
+{ -0.012948660746933578f, 0.005928695661747023f, 0.017900558754347103f, -0.02342826187593981f, 0.04358221599560978f, -0.012626638784846506f, -0.001118321444868372f, -0.033760567351884624f, 0.022992326238618355f, -0.005645906510847712f },
+{ -0.023191757649278465f, -7.983780757068372E-4f, -0.004850953004252883f, 0.006673813525903074f, 0.0942943220047598f, -0.01366014310960873f, -0.023066019503040044f, -0.029275874771596103f, 0.02752748358545836f, -0.014984294664343905f },
+{ -0.05924230245675063f, 0.0504484247278902f, 0.03497367408967269f, -0.1378616450838727f, 0.027178765987623702f, -0.009565217946411863f, -0.030156984727244512f, 0.04334126182427472f, 0.0659000321605178f, -0.08453086991952312f },
+{ 0.007775413124086799f, -0.014640705785643382f, 0.0022822255256914714f, -0.014050382138873524f, -0.02346494047877568f, 0.02406256515946557f, -0.007134744023860537f, 0.029533961112035163f, 0.08569852771342465f, -0.013825906915100905f },
+{ -0.023555315527170422f, -0.007680652441817119f, 0.03334709162229007f, -0.024397873027720483f, 0.011852851155595714f, 0.018766718868709096f, -0.01607369839727661f, -0.029820320239125675f, 0.033074200386722624f, -0.007441582415517628f },
+{ -0.06853337562087489f, -0.013383159794443076f, 0.08046642190261408f, -0.08434409062482479f, -0.07098022099174893f, 0.05308317442897928f, 0.007027634901705795f, 0.012005105038349256f, 0.057395147468693584f, -9.783340521129728E-4f },
+{ -0.03575676443403942f, -0.028668656557530946f, -0.012214281963141239f, -0.0049881313153478015f, 0.08270260840680133f, -0.004636283341770021f, -0.023652809597080476f, -0.005387524752930053f, -7.096219105434934E-4f, -0.033996079739743654f },
+{ -0.05348107914873153f, -0.01470605209001939f, 0.011076102703615413f, -0.008608361380541591f, 0.04608029439151591f, 0.010650796566932885f, -0.029049424133271603f, -0.006504495774736606f, 0.00933656498454899f, -0.011634946249691804f },
+{ -0.013758143651908694f, -0.016966724390119103f, 0.021814984112824697f, -0.00473631697959774f, -0.05524737882103967f, 0.018029065407482007f, 0.01730904858992176f, 0.04007570885499907f, 0.02154833278531672f, -0.002539907937650607f },
+{ 0.0067755782207690645f, -0.023593914682190912f, 0.02068063112315265f, -0.03293381630813074f, -0.03522625954775647f, -7.873415168533574E-4f, 0.001552848320936944f, 0.039638099345286636f, -0.0037090509299587777f, -0.021363226205125724f },
+{ -0.012797491344495229f, 0.007643805871679921f, 0.02055882896682359f, -0.003907676308849369f, -0.037838330691308965f, 0.013648681632248067f, 0.02214985410790522f, 0.00450574551357928f, 0.015504260686505192f, -0.003803085547825395f },
+{ -0.005519324218523414f, 0.04148467176267613f, -0.07374423529157192f, 0.07929242032151972f, 0.10942612666887397f, 0.015994005036237408f, -0.033680830249353366f, -0.09676066181900544f, -0.013574244988739114f, -0.001896535680578452f },
+{ -0.0015485644219483965f, 0.0036795245608530064f, 0.03393271786395288f, -0.019283237427454535f, -0.04274114506605873f, 0.029855287808278872f, -0.006081821323682501f, 0.03411921976906089f, -9.089286297902748E-4f, -0.01662716424249712f },
+{ -0.011966088938373854f, -0.010282183737411516f, -0.0026720553545168755f, -0.008923015791144538f, -0.026629936484198515f, 0.017056481455678143f, -8.517511757812118E-4f, 0.026661043678336754f, -0.0022460968602384065f, -0.01716068631704322f },
+{ -0.01748291895768802f, -0.006813824179304966f, 0.006714126384779957f, -0.0027364883847312413f, -0.01855795277134401f, -1.8318641434244306E-4f, -0.01884762887138049f, 0.011095046058492156f, -0.01579546276958931f, -0.02356797943057859f },
+{ -0.03259214174247215f, -0.0351639470940498f, 0.030993668493561725f, -0.04304038143375974f, -0.11224929134283478f, 0.03385938725882077f, 0.02830055037673406f, 0.05252775734518423f, -0.03539108008087083f, -0.013712113404179658f },
+{ -0.00301846315228962f, -0.02434130793066701f, -0.0030871825394941923f, 0.015278198452708959f, -0.020154400772287372f, 0.008886093402050708f, -0.0035752407864010393f, 0.05640055837635562f, -0.015713681543660818f, -0.017997403899388437f },
+{ -0.006147590118261157f, -0.0014660141804935674f, 0.04982044315082885f, -0.052982592492175136f, -0.0735644249999484f, 0.02034607559021717f, 0.021279447108504282f, 0.040970646245675674f, -0.028838833712031164f, 0.03186697914310196f },
+{ -0.003201665574671497f, -0.003249892466975876f, 0.04942653177193991f, -0.029021541124701674f, -0.03649436368602318f, 0.0017608755642310608f, 0.031580682145038105f, 0.031241350064799178f, 0.013291208080713691f, -0.0171135463646144f },
+{ -0.015543801824263778f, -0.03353642682364108f, 0.02520837994237559f, -0.03782775655824225f, -0.05446854105592695f, 0.03296508847963526f, 0.011826827984537588f, 0.05182982919525487f, -0.00822648052583818f, -0.01656881030484764f },
+{ 0.005341357459669632f, -0.025273295325633795f, 0.05095967797691084f, -0.05769944490553412f, -0.09407169405530398f, 0.01164307975650226f, 0.0461280205130877f, 0.06693655700117336f, 0.014480158019532736f, -0.0203103611175482f },
+{ -9.008235170372512E-4f, -0.036750243294998146f, 0.036296156920491825f, 0.004811670681592977f, -0.08773569583643857f, 0.019389853978147627f, 0.009422435464098038f, 0.05757503478290166f, -0.03189428851673479f, -0.004834077061197524f },
+{ -0.0023703880533564206f, -0.007458836438697141f, 0.022551333129039f, -0.007531974623290218f, -0.04385397739203836f, 0.018360227021755552f, 0.007022120774628519f, 0.015566307783045378f, -0.01055216948056876f, -0.00664046950960748f },
+{ -0.06436329717480303f, -0.0063056376778853115f, 0.01944358159530676f, -0.026394235310135437f, -0.06545339602175348f, 0.0074606202689394855f, 0.03491661009418574f, 0.13360433953865172f, -0.08606059345604902f, -0.013906855117269065f },
+{ 0.0015364199199063228f, -0.007172720723236184f, -6.722311808275286E-5f, 5.385363664614094E-4f, 0.007589776747819943f, -0.016331509217290437f, -0.010398285097444357f, -0.005909913229344889f, -0.0038523417005709043f, -0.0075731618918848075f },
+{ -0.004341978099568175f, 0.002749561089921494f, 0.0015177845832199375f, 2.3787381688369127E-4f, -8.997065810086902E-4f, -0.005896100731053295f, 0.006952862317778671f, -0.0018412765539970143f, -0.021580438572770477f, -0.01213985534015424f },
+{ 0.07480566304898971f, -0.06030944759171182f, 0.0368168760133334f, -0.1438542057901044f, -0.30547762330250544f, 0.006453816965424165f, 0.06580408510317759f, 0.03132533551895081f, -0.02522083537068819f, -0.012282519730211766f },
+{ 0.003714376479827659f, -8.33897047172546E-4f, -0.014690080937155034f, 0.0025624908023494718f, -0.010494742558376288f, -0.004221964810974317f, -0.003987629050973799f, 0.007914374655582377f, -0.0027558683827931577f, 0.004351970395307159f },
+{ -0.013003432879694146f, 0.003024722880048289f, 0.019656138709467606f, 4.685319084502947E-4f, 0.007414662989756958f, 2.998323684549424E-4f, -0.012063916639199148f, -0.012489522421831871f, 0.0170298984836883f, 0.0069420059041228254f },
+{ -0.006336427131458836f, 0.0023434404806746785f, -2.623255740904189E-5f, 0.005516705504217926f, 0.008223835726336878f, -0.008455001184476818f, 0.009251026682482818f, 0.007310858889836563f, 0.0059149722193343884f, -0.006479038626490307f },
+{ 0.03251042970297121f, -0.006797789556979715f, -0.030324582627984754f, 0.022074200543153868f, 0.0362265614766254f, -0.005314942018285697f, -0.003502311547997883f, -0.02032041066628808f, -1.9860912069487823E-4f, 0.02011434086623267f },
+{ 0.025608752093154663f, 0.008048121006932172f, -0.005137218780412935f, 0.011404480356160157f, 0.02901049030901344f, -0.0023175072350784948f, -0.019765913112449143f, -0.016457584334673158f, -0.005351063149095665f, 0.0034356579668040443f },
+{ 0.01498141758814576f, -0.007550840047590729f, -0.01030167626205974f, -0.0021962498035222105f, -0.0036230286286420116f, 0.018939609664966998f, 0.004401109970863034f, -0.009550383467669123f, -0.0011941643576875202f, 0.01158466274876087f },
+{ -0.01381115081832004f, 0.014999840266309752f, -0.016072413955976028f, 0.0035524223342553447f, 0.0025424034450445766f, -0.007512839271674856f, 0.003509178674865472f, -0.01947214233898731f, 0.004983873100055409f, 0.005029819220544771f },
+{ -0.001873625194325582f, 0.0035555272480472925f, 3.593237836066756E-4f, 0.013616936877806582f, 0.016585350291353152f, 0.01570025203978562f, 0.007117050703892344f, -6.167749184844445E-4f, -0.012001921028545744f, 0.0045045203341399455f },
+{ 0.006445521005726306f, -4.254003781774118E-4f, 0.0032186256563365456f, 0.007612588981066399f, 0.013279314683554566f, 5.788691459370256E-4f, 0.01636770214798245f, -0.002867082583043844f, 0.004277662933665096f, -0.0020601898023729324f },
+{ 0.01577709065770788f, 0.006603022564446867f, -0.0038160363325678986f, -0.009157931293927432f, 0.01388427493390081f, -0.007506857893404564f, 0.005058592478844782f, -0.025093200014359107f, -0.0060829622799782775f, 0.005548894150104916f },
+{ 0.02033641976745098f, 0.006149667167958788f, 0.008104171945610118f, 0.011787544429508873f, -0.0038259774128017758f, 0.011169227713978318f, 0.018012731858281672f, 0.015291012211888182f, 0.022747386230834145f, -0.0047206539868622005f },
+{ 0.00644792561857783f, -0.009608136655407554f, -0.001898105977556456f, 0.012887218508769335f, 0.017301860317756095f, 0.011790902469981277f, -0.0018336395818778887f, -0.006388334721097461f, 0.01221282635496286f, -0.013842642695551105f },
+{ 0.003732283215794911f, 0.010268670888121766f, 9.253992431890916E-4f, 0.03537403096786711f, 0.02486261242000827f, -4.6546039491980205E-4f, -0.0025787783944428194f, -0.004046283231128151f, -0.03576903438287731f, -0.00576192978233435f },
+{ 0.007349308800018985f, 0.013603640583181956f, -0.0333752416752993f, 0.05054733004454509f, 0.0577266621799208f, 0.0166683574811747f, 0.009032176723351692f, -0.0011012459550153579f, -0.020885005399979353f, 0.0031299005869593137f },
+{ 0.01521992612480938f, 0.010022923372772117f, -0.010373407744841079f, 0.012595950905277084f, -0.0018274305036792683f, -0.023590558979962758f, 0.014137480884298045f, 0.006218620165255981f, -0.02522598147624366f, 0.008449065968261189f },
+{ -0.027007157851276865f, 0.015576359291661611f, 0.011106708592314052f, 0.005323044169946109f, -0.012796510248468536f, 0.001472773573899042f, 0.006699841869657015f, 0.01843394947799251f, -7.183648576586148E-4f, 0.021723699026402466f },
+{ 0.013461296542736628f, 0.0022179757056867188f, 0.013318055526983454f, 0.004827117581766988f, -0.019261953080334855f, 0.005236007482865105f, 0.008411186443053078f, 0.015017299319642637f, -0.029173772696479222f, -0.007476699481614665f },
+{ 0.021737374002648534f, -0.004483810950271664f, -0.010264663111888492f, 0.03528621119092245f, 0.010689808563577905f, -0.016821522114651856f, -0.01023935772021317f, -5.613337239485035E-5f, -0.00634836309758054f, 0.007977039261437752f },
+{ 0.004550597693978523f, -0.009361525220245416f, 0.0056129656832703476f, -0.004316225640628799f, 0.009717817514091988f, 0.007654068150009631f, -0.0024455247995066195f, 0.011475680217421706f, -0.010800210126384891f, -0.0010417415009306645f },
+{ 0.07819659081284606f, 0.03654740222476859f, -0.040809063009549514f, 0.09845892962004302f, -0.027968896589101646f, -0.026975795062888743f, -0.028523758712399535f, 0.031142697708743037f, -0.03282771635374453f, 0.0022578950476796504f },
+{ 0.009199689579643327f, -0.00661436702098997f, 0.013555653906982074f, 0.018235216297384078f, -0.018137007904102852f, -0.001548449254437486f, -0.012825830933476678f, 0.014263235702183474f, 0.008048509951131967f, 0.004030159985295574f },
+{ -0.019284155631054994f, 0.02905527173681493f, -0.0011962008577270872f, 0.004386118085443382f, 0.008867931119745856f, -0.01711201948665245f, -0.010556917396123872f, 0.006891800449165705f, -0.030206124349298147f, 0.01315291726319302f },
+{ -0.018409613155482438f, 0.0043565899790147635f, 0.029185551104797813f, -0.015469485852071163f, 0.008638329686278397f, 0.012303857588377036f, 0.015684160375266765f, 0.010442238752929515f, 0.008308298375460621f, 0.017950218048595066f },
+{ -0.005194468657341918f, 0.013311323815259823f, -0.012097539862808497f, 0.010166015376778172f, 0.008613802569092355f, 0.006118101582537747f, 0.017248311554961426f, 0.009177731625241548f, -0.018951668724781674f, 0.0013545291638042785f },
+{ 0.003814277636258854f, 0.011754095073619155f, 0.001312969989299533f, 0.007694770849581773f, 0.008989504019011942f, -0.015707340230749173f, 0.008788288866798142f, -0.001373848672681991f, 0.003024970978720605f, 7.522755897993522E-4f },
+{ 2.1991571873167622E-4f, -0.002505533210110224f, -0.009234178568156705f, -0.011892482995680275f, 0.03139786292614388f, -0.002864521458848462f, -0.00885126451206512f, -0.019689477514573006f, -0.009582873827073818f, -0.0036149926985400535f },
+{ 0.002068213077919417f, 0.023170888973778846f, -0.04095674782167515f, 0.05478510622772552f, 0.07571006838945064f, -0.02782075232002715f, -0.04013771177351135f, -0.04424615997609814f, -0.01192545629018747f, 0.008808590235253554f },
+{ 0.017350990836834446f, 0.007733754033228391f, -0.034080385590906814f, 0.03329752351737183f, 0.07622057458462461f, 0.001028053120430786f, -0.02675091449258816f, -0.05567038814921675f, -0.02261714265859597f, 0.0015598977506101736f },
+{ -0.0037425885386189626f, 0.004153432386414071f, -0.004403859405385119f, 4.657057642554406E-4f, 4.241090452069224E-4f, 0.013468253060025144f, 0.0023431314278096744f, 0.02266393415558352f, -0.016588816079723904f, 0.023228165629059706f },
+{ 0.015411682084133883f, 0.006674155907781758f, -0.0028376809300301115f, 0.007965260935365707f, -0.01500275923875224f, -0.006099300694455247f, -0.02503751192000631f, 0.01929288809827112f, -0.007468981247426378f, 0.0010950988821416836f },
+{ 0.012555604172056192f, -0.005119786657737413f, 0.0019757347923104436f, 0.010282050838376222f, 0.018954007813695103f, 0.0010715522558208447f, -0.006993479461384882f, -0.005327231839530214f, 0.019552942934229905f, -0.004060792290988746f },
+{ 0.010670632950459249f, -0.008458452461489145f, -9.122123356366999E-4f, 0.017529343887349915f, 0.0203057923975058f, -0.017816525211980756f, 0.0010313214683561288f, -0.01533168512193602f, 0.03469265890761145f, 0.003660444218452915f },
+{ 0.02379305740113818f, 0.026047687747732664f, -0.0320067581835563f, 0.053218250367477876f, 0.07741184530409968f, -0.017188887259430546f, -0.03784884716231038f, -0.05312844629934416f, -0.022889257550876424f, 0.003587515304390943f },
+{ -0.001221007981702075f, 0.0054595944777830795f, -0.04012067576940277f, 0.05226539671771095f, 0.08402123166718796f, -0.030691434020991795f, -0.026934439290506453f, -0.07754686777934122f, -0.04191288620879151f, 0.011245605445436487f },
+{ 0.019312686844304115f, 0.016670284104484387f, -0.061053575363537095f, 0.05810866257557448f, 0.1204162706435541f, -0.006071385252154617f, -0.025640674341161327f, -0.07498549265174576f, -0.03220451424357086f, -0.026369241754742645f },
+{ -0.003784193091461107f, 0.029100470656006357f, -0.03655596160814601f, 0.024095816602345877f, 0.04279510635441253f, 0.005133162574167792f, 4.7276647257389213E-4f, -0.030745971857826054f, -0.01922987851702333f, 0.009321942904174638f },
+{ -0.006079144242993389f, 0.03975894754915724f, -0.03561913694410205f, 0.05150326772808061f, 0.059131452289322164f, 0.006089958796539288f, -0.03930974879509171f, -0.024993388474316987f, -0.01335479456357793f, 0.04152333521824208f },
+{ -0.004216700497908544f, 0.023274776156989998f, -0.010745509687751684f, -0.0018858785619579022f, -0.009689069879781456f, 0.025221090132920426f, -0.018128774958372732f, 0.004491925578675485f, 0.002702557903835898f, -0.013509436069625394f },
+{ 0.011339998555679291f, -0.002873228208237702f, -0.013647868114757431f, 0.0032281804904933896f, 0.004515941082598804f, 0.0046185905048997606f, 0.004699988948950597f, -0.00718171286584088f, 0.021467659177754755f, -0.010808404250868408f },
+{ 0.0011484431263403445f, -0.007799175810286289f, -4.2589416697705145E-4f, -0.0039055989963444494f, 0.00528123325082257f, -0.002557902822251993f, -0.008743608727685231f, -0.021392241336299637f, 0.004296933617402328f, 0.006166810731879495f },
+{ 0.00839080557377718f, 0.054317200073921976f, -0.06237050059203629f, 0.08162746720702811f, 0.052805868505441604f, -0.04506779010877818f, -0.022088656724477452f, -0.049734387654355304f, -0.017029163120276993f, 0.02759648856092146f },
+{ 0.010678690640948847f, 0.05878209469116266f, -0.06172638815005703f, 0.043788814991439905f, 0.12828686919202556f, -0.003203043394397515f, -0.027927925484416447f, -0.08440037797262574f, -0.01061565037206705f, -0.019605088289319384f },
+{ -0.0018731044419416187f, -0.01401525924030456f, 0.006200551994888692f, -0.021662205457554262f, 0.011619676989779061f, 8.792934485969244E-5f, 0.032917611805814186f, 0.006707718486116682f, -0.006277213970131864f, 0.008434494872642936f },
+{ -0.039159416050735946f, 0.016177946439394554f, 0.03454253749536601f, -0.05621226754808006f, -0.08933194749063006f, 0.018588957520668345f, 0.03917121947559282f, 0.03739976808079065f, 0.04628634493466311f, -0.0027660272415152712f },
+{ 0.007462308778063533f, 0.018661931538013498f, 0.004098601518175875f, -0.007057223911695834f, -0.019098310402562952f, -0.005192287389521452f, 0.017501698604870924f, -7.032597046385179E-4f, 0.007373089200588794f, 0.009491789523124737f },
+{ 0.026973113601691977f, 0.04914168797891341f, -0.007664050750507711f, 0.07039948492111271f, 0.03682628824509188f, -0.022757897587676594f, -0.00863681767273519f, -0.02025069573174575f, -0.05101536557502557f, 0.057406091716689665f },
+{ -0.01092709877185186f, 0.03737494559521038f, -0.0010809177801773368f, 0.04364317829990651f, 0.04341878394044671f, -0.008384755118791137f, -0.01776999725336056f, -0.06317258520035661f, -0.03809047221469324f, 0.028587526496055917f },
+{ 0.014028044730854476f, 0.02736189772571807f, -4.4898681319374483E-4f, 0.012381934599287915f, 0.022706279907043356f, -0.007772041035632031f, -0.016114978795340296f, -0.009531130635104459f, -0.005008554411396854f, 0.006767854341938466f },
+{ -0.008133265756773856f, 5.063268153799694E-4f, -0.014800866857603824f, 0.011647433770252267f, 0.03127262930433219f, -0.009415880582069628f, -0.006686376643752646f, 8.871801345564467E-4f, 0.0011840456957846628f, -0.028256244186809408f },
+{ -0.012596228825204864f, 0.012774710313120578f, 0.014827402861009288f, -0.001040532439384228f, 0.019892642022014365f, 0.010489966997349469f, -0.013734505567387579f, 0.008390803746941138f, -0.004512968871754369f, 0.01564270148346349f },
+{ 0.0037659513286192876f, 1.364049671936815E-5f, 4.884033332615621E-4f, 6.122026885935404E-4f, -0.022819778315802425f, 0.00574104224465224f, -5.380542924531107E-4f, -0.001087690541025081f, 3.6643093659066483E-4f, -0.010182025142691068f },
+{ -0.007774743935890822f, -0.007357502591026133f, -0.0017599731399370556f, 0.010255798015452396f, -0.003013149692016138f, 0.01047244971257595f, -0.002490702697268056f, 0.026544703610336912f, -0.023078931082567443f, -0.0014534468442693694f },
+{ 0.006906704241989683f, 0.013842705623949842f, 0.014076729270899762f, 0.0011121381500201627f, -0.0029750270062147205f, 4.3090461034517085E-4f, 0.02126418883957474f, -0.0015055073273121738f, 0.011008051800957127f, -0.01205696720978261f },
+{ -0.053067237357414726f, 0.037157880675899056f, -0.04482244474883813f, 0.01952556647601459f, -0.08687727679049118f, -0.06364319762510556f, 0.04676415335760899f, 0.02149255976081016f, 0.014282311035808511f, 0.13991453269917833f },
+{ -0.022255088959825732f, 0.03557095779264303f, -0.0025211874860067715f, 0.0057994627956357795f, 0.019115158183894358f, 0.008043060657233652f, 0.009189266072230752f, -0.012764636735333436f, -0.0521575879038037f, 0.01628622052909901f },
+{ -0.017575866911061253f, 0.025195470833827706f, 0.0242091299154617f, -0.06981738006623561f, -0.09589073040201908f, 0.015410238056820383f, 0.04494788382047319f, 0.049704584569933825f, 0.06162551926425448f, 0.012385429446232188f },
+{ -0.001935525887141768f, 0.015235355506326351f, 0.006472561028351275f, -0.004564459817665679f, -0.01656713390131252f, -0.016934307683639554f, 0.011937888861534282f, 0.0040232835230608185f, -2.5602947984236935E-4f, 0.011448115861251934f },
+{ -0.002957518265914845f, 8.757291683371215E-4f, 0.022002958052562124f, 0.015238829361683002f, 0.013402329397433061f, 0.004987497906172842f, 0.0029243679265269886f, -0.014771725433987882f, 0.00781385199029571f, -0.009518806420228065f },
+{ -0.0028242250888553333f, 5.135867668691888E-4f, -0.005244379676094133f, 0.05571302950486698f, 0.03332585460704043f, 2.939317424686544E-4f, -0.005041630181382367f, -7.927517171892991E-4f, -0.08279121558039494f, 0.04298225761928889f },
+{ -0.04539286522825935f, 0.012845399431506425f, -0.0017094820710978934f, -0.02095349420620803f, -0.022635577386391284f, 0.011935299715696927f, 0.0314272711400648f, 0.032575570942316376f, -0.03339357126233321f, 0.024698795736028133f },
+{ -0.01805929164175518f, -0.00416524189472266f, 0.02157222924632799f, -0.041886290144585815f, -0.05548289728834737f, 0.025781033977200718f, 0.030052652556347807f, 0.028704795108373773f, 0.013656263775930485f, -0.0026221605761811433f },
+{ 0.0025156947662199414f, 0.03282262165399937f, -0.009552230628482986f, 0.04838796499985516f, 0.03829057001823379f, -3.392457855263618E-4f, -0.0281675963717074f, -0.02049930695109256f, -0.05461677824340169f, 0.029079415522402854f },
+{ -0.010844826424444686f, -0.005750918954306467f, 0.05174145905834132f, -0.18054900876223406f, -0.14800123584575076f, 0.04462142954899762f, 0.02735494322874945f, 0.09066081701616273f, 0.09237950242102051f, -0.05703527994712293f },
+{ 0.009002672165895833f, -0.0035713181388178595f, 0.007056663463296129f, 0.012057740677113515f, -0.014273387404926093f, 2.7085898075409693E-4f, -0.014698488904007951f, -0.0069971422776933315f, -0.006641541247938022f, 0.003801915499429618f },
+{ -0.025799194811590757f, -0.019975358212528976f, 0.042978962842172196f, -0.07990808590294508f, -0.07289215360423315f, 0.020981910814849916f, 0.023216114675179412f, 0.05715027499053159f, 0.036989139820235696f, -0.014096766417379301f },
+{ -0.04248952420883769f, 0.003867382814158636f, 0.020607670706480202f, -0.05591046844990189f, -0.05167864782331279f, 0.015452633767455813f, 0.05096999692170421f, 0.06035585687380806f, 0.016871548994730614f, -0.00406373054271305f },
+{ 0.001988850595292718f, 0.028972275972609436f, 0.0033998710503976657f, 0.018799819115537353f, 0.007382368659723176f, -0.008329303412028363f, 2.9080015955743873E-4f, 0.00344682980801245f, 7.720691322094478E-4f, -0.0013350298280238534f },
+{ 0.02496267575940077f, 0.003530745248088446f, -0.031801206349535725f, 0.018609742909694738f, 0.03135293208779893f, -0.00809708256510414f, 0.003928408405983587f, -0.01861698206905776f, -0.005989155601078491f, 0.007638481211629309f },
+{ 0.006005413091312052f, 0.02408343602868537f, 8.027891748035402E-4f, -0.014990494524784655f, -0.009106240175369627f, 0.010353347097002316f, -0.019259111078903282f, 0.022863067119168686f, -0.011922865637851757f, 0.018851638055893936f },
+{ -0.008739023001643604f, -3.326484627282953E-5f, -0.0011091884856715007f, -9.085520974475987E-4f, -0.005586152498742974f, 0.014742545187042003f, 9.093292186622167E-4f, 0.011460851451751264f, 0.01538317738075317f, 0.022655133368130395f },
+{ -0.044009594078621775f, -0.007960174484555669f, -0.03258100358864568f, 0.012476444527110981f, 0.006579030675453404f, -0.01991031509874475f, 0.04367412486559366f, 0.0038327544303443906f, -0.06623353272305188f, 0.018855024504008496f },
+{ 0.040770221991564194f, 0.022022722262560752f, 0.05285038407066836f, -0.17725457002963665f, -0.25829864361072585f, -0.011193739288304942f, 0.03944192640405941f, 0.14793148146962573f, 0.04406730719283038f, 0.018484571387338368f },
+{ -0.05898421614801555f, 0.0175379001135732f, 0.020232723119410552f, -0.0533645675293049f, -0.0618030535860565f, 0.038707332393060144f, 0.07254862275934171f, 0.07318081523458186f, -0.05912730429602037f, 0.016444976688886694f },
+{ -0.018039697685603404f, -0.02121786015391836f, 0.051356829574789105f, -0.06156858602930162f, -0.06945927313302334f, 0.0077951892425688046f, 0.03911567296279621f, 0.08456044275319263f, -7.834511964832613E-4f, 0.01748383418596036f },
+{ -0.021443668902561035f, -0.025440015113803817f, 0.03589026813369852f, -0.04214249219769418f, -0.03124437332674661f, 0.03879740047780857f, 0.002109109297649366f, 0.01237007278322154f, 0.05036350356585463f, 0.020209210268028757f },
+{ -0.011678826821352191f, 0.03272328786568564f, -0.00580754831014625f, -0.006939524158337972f, 0.06549569568431182f, -0.008301252324305302f, 0.016082719510178423f, -0.031760015355137464f, 0.020802822696240824f, 0.015837046207744468f },
+{ 0.003082208009201871f, 0.012486382585217629f, -0.03760032212574362f, 0.007819078410822394f, 0.09879658561171614f, -0.0021988733539426934f, -0.04076585732868341f, -0.05071369521148804f, 0.006663271491239141f, -0.0044045293261521816f },
+{ 0.020559541097340046f, 0.0069435119418509855f, -0.02150151941647182f, 0.01901860544519208f, 0.02567567704893158f, -0.009996939422203982f, -0.011898029379257838f, -0.015556425493603242f, 3.505239536454879E-4f, -0.007940107139186345f },
+{ -0.011337035721824025f, 0.026837051620478836f, -0.0105066429970353f, -0.037432164326174f, 0.07409881631487043f, 0.02643333488261814f, 0.020717089432502386f, -0.06306051785659411f, 0.03805931389227148f, 0.003341562962145684f },
+{ -0.0252805783233335f, 0.028818796193691983f, 0.004864998705976079f, -0.030641207806525912f, 0.05646492084149135f, -0.00247756967314438f, 0.008600296238372114f, -0.05971986113602116f, 0.02269264372551594f, 0.007315622181289183f },
+{ -0.01882021229610502f, 0.014998487610359624f, -0.017304077662132218f, -0.01592889132149102f, 0.023042953864371284f, -0.014547817301174477f, -0.00500765451741338f, -0.04046435854455381f, 0.022606449890980564f, 0.012979030224437244f },
+{ -0.01416853925985798f, -1.835692126835269E-4f, 0.001157578226476163f, 8.321478596879022E-4f, 0.0027559985366908727f, 0.008527711797026478f, 0.009663722100036413f, -0.015257309047362524f, -0.011124609103083476f, 0.003976379971055164f },
+{ 0.028793498144327943f, -0.04099318780977284f, -0.024232690568499214f, 0.058670332275715914f, 0.08559411294848762f, -0.028210315347143054f, 0.08591924604074738f, -0.08835283194411538f, 4.5998178950620167E-5f, -0.10133229398183913f },
+{ -0.004452495586625719f, 0.028769817217514426f, 0.03731485216187331f, 0.0484770031559287f, 0.05003685618944861f, 0.02659349015002248f, 0.03833735310449742f, -0.05564787575657845f, -0.008206925436961951f, -0.07012991184948084f },
+{ -0.03392670332084852f, -0.016543931859099505f, 0.018510193848743424f, -0.012060940822746474f, -0.03493101963165122f, 0.011099461398289774f, 0.01002571784778287f, 0.02566595156373395f, -0.007213103585558921f, 0.02372645096541056f },
+{ -0.020655070549156683f, 0.008001903957754384f, 0.009124229524658611f, -0.022931481011961415f, -0.010937834977995466f, -0.0028268198423104253f, -1.6378263448169262E-4f, 9.636848343224204E-4f, -0.017065482149982533f, -0.015286241786740446f },
+{ -0.011486850653361268f, 0.028574130789144156f, -0.01879978461011971f, -0.028540919859841623f, 0.03596747009460328f, 0.008833787910905711f, 0.005893927111333781f, -0.03017366778148859f, 0.005286814775611974f, -0.0162263013854295f },
+{ -0.021182782837452913f, 0.02516847913731999f, -0.004682081692662725f, -0.016573100141154085f, 0.029967835064920612f, 0.009750412208032501f, -0.0025982033191957166f, -0.006912197165651336f, 0.0010624009906039652f, -0.01728388029301803f },
+{ -0.02123241029652466f, 0.004964263032992454f, 0.0180851497717632f, 0.010894801952919024f, 0.06076650203452372f, 0.04042521224194635f, 0.05026567007895441f, -0.003985704350237342f, -0.07465067548013879f, -0.06780956371818077f },
+{ -0.007815811926026144f, 0.05816573763748502f, -0.0371225257918483f, -0.02313424456216539f, 0.08013780086988864f, -0.010087415948330429f, 0.020798952628280482f, -0.022212714302139353f, 0.09790544834828821f, -0.011337199688411794f },
+{ 0.03196762474493331f, -0.029925163440912807f, 0.012041993237391546f, -0.03816439174004766f, 0.08904264459172989f, -0.020823124257702726f, -0.06860041976206856f, -0.055225522636624995f, -0.03824460653288594f, 0.006911552217335921f },
+{ -0.01717646687926273f, -0.040705353386930584f, -0.027189842511227472f, -0.07257326944387953f, -0.027870195564702917f, -0.035158881684337805f, -0.018085435408935813f, 0.07796527323569755f, 0.02758730959536668f, 0.0058660542074526305f },
+{ -0.01959095916490385f, -0.013476467200139f, 0.0217898130682723f, 0.011100085992716212f, -0.045499424800816486f, -0.019548917117962507f, 0.012934679222135167f, 0.023476219876156598f, 0.00567219881553172f, 0.03243737307349063f },
+{ -0.015224228867565796f, -0.0034497400274745744f, 0.003468761095570851f, 0.0066763445838378755f, -0.009294481618600593f, -0.003735279950759441f, 0.007769254145025768f, 0.006467786444418101f, -0.002804081292227721f, -0.014455611958090508f },
+{ -0.020250584878039702f, -0.012118430835044809f, 0.019803061542542317f, -0.02491831364001767f, -0.027387287145629758f, 9.390396316391825E-4f, 0.024248101885065678f, 0.03344482434907451f, 0.0032868665437904873f, 0.0075840983796005654f },
+{ -0.016561689482883297f, 0.0015579457566876585f, -0.01028348187134396f, 0.017682211755202674f, 0.0017261986383115225f, 0.026721507023648245f, 0.012936509366099342f, 0.014372543891178506f, 0.0016996716630454304f, -0.005075191996160372f },
+{ 0.01849066973760931f, -0.0038658251898648147f, -0.003842417716534034f, -0.008966546033579931f, 0.004099850393500234f, 0.011779269059460357f, 0.0012035314995272506f, 0.005013570217899994f, 0.01699198077595977f, -0.006386331037789559f },
+{ 0.08074957221573212f, 0.05930897006267937f, -4.718097532085059E-4f, -0.08180236816082273f, 0.1157350810614053f, -0.00435919131513255f, -0.05115262141052743f, -0.08319483654632208f, -0.05387401578722479f, 0.012376412196214373f },
+{ -0.0068626774732933144f, -0.024886228853138903f, 0.0128196436353819f, -0.01600702390450719f, -0.05398651464442125f, 0.014308923426309015f, 0.01708210094756088f, 0.030800693773535205f, 0.006861592754229331f, 0.0029050148259313854f },
+{ -0.013472364222116616f, 0.0016066317370193187f, 0.005544835574579061f, 0.005687474090114047f, -0.01808290709660227f, 0.008152590021429606f, 0.011913434589709055f, 0.020973031799912632f, -0.007684904476222341f, -0.004048593933861837f },
+{ -0.0078072603162563994f, 0.0025769897470182294f, 0.023222939635662077f, -0.025143521797993243f, -0.021194539569871558f, 0.002746601009591655f, 0.03492000597494703f, 0.049220931052334535f, 0.004231646589498427f, 0.0060985470833581756f },
+{ 0.004086622735647673f, -0.0038202511329719813f, 0.008135279457813354f, 0.00766081692489458f, -0.007260828837502605f, 0.020369339087937605f, 0.024134357716395983f, 0.028914159887197817f, -0.005903223285926446f, 0.002579177683902188f },
+{ 0.04409379647224408f, -0.03158196313683199f, 0.05322050542480961f, -0.06251654940589074f, -0.07643714607433703f, -0.07599723832806497f, 0.0651108700783914f, -0.023172061710185123f, 0.0047007638306466246f, 0.05828066719443135f },
+{ -0.03857317809752988f, 0.023581185855797354f, 0.04734280556949842f, 0.001352311282636671f, -0.10568042648404856f, -0.022118984104035826f, 0.04735735799959748f, 0.02254371211737009f, 0.02145075431309359f, 0.09057453090010005f },
+{ 0.007019799355274636f, 0.018967579940714716f, 0.01629882661256395f, -0.023605889653161422f, -0.032069734421472505f, -0.008678548883527698f, 0.0211341556898668f, 0.027129443050319727f, 0.018978964507179747f, 0.002007836933401245f },
+{ 0.014405463442557687f, -0.006898664502014948f, -0.011314735188041797f, 0.018249856155637633f, -0.006426569918641066f, 0.006232411460825594f, 0.010096333958945271f, -4.3983796393520433E-4f, 0.014043349019007188f, 0.008679384313601662f },
+{ 0.031257991647612934f, -0.0015167631699775606f, -0.01869930564923757f, 0.028789648428284968f, 0.0440021559416546f, -7.873055121878518E-4f, -0.012829621823220646f, -0.01719299967566667f, 0.005137229280964052f, -0.008752427963653884f },
+{ -0.010426395670269987f, 0.023706421129693185f, -0.05700915104639139f, 0.07633635062309216f, 0.15437690743310634f, -0.004947343738061718f, -0.04654209084041501f, -0.08956653386280707f, -0.02881783509717696f, 0.025552109033269134f },
+{ 0.04443561419685789f, -0.010602948563314663f, -0.025805495745021508f, 0.03241501343117695f, 0.0582267487389077f, -0.032942249461568984f, -0.01486900952786575f, -0.05058223278174836f, -0.013872014025599838f, -0.019495024394522012f },
+{ 0.013608537278828832f, -0.007571115304008612f, -0.017263677666544606f, 0.009276792410154373f, 0.030123673981841726f, -0.006352267887905062f, -0.0043065730466068765f, -0.018643708099969628f, 0.004953847000898266f, 0.009596710226913397f },
+{ 0.04800961955887271f, 0.03996129999260164f, -0.07150735049387819f, -0.0018685589192316f, 0.10005070666715508f, -0.0028849217758405f, -0.03438532971020665f, -0.06356235637735058f, -0.014237815310709105f, -0.0702581259140907f },
+{ 0.04265258855542605f, -0.01111763894775368f, -0.02759569170186138f, 0.019012483147987466f, 0.0359977960053034f, -0.026029402771276213f, -0.015105389330063211f, -0.04398206953231227f, 0.00827420560956016f, -0.0025231834608182156f },
+{ 0.012942348299015093f, 0.024316128116350196f, -0.012235242490778949f, 0.009286790011637597f, 0.018238904134807336f, 0.0040901963292951475f, 0.010447294318200897f, -0.03462670865007307f, -0.0179007253012625f, 0.006197174409369576f },
+{ -0.009432537398758819f, -0.0025953488467959896f, -0.014503122404396144f, 0.01168407289463855f, -0.013077030479890783f, 0.010023040282571847f, -0.003912640337976454f, 0.02196804152969101f, 0.010047230937220158f, 0.022284525321599656f },
+{ 0.06896615627499601f, -0.05768220518197264f, 0.030093660213722017f, 0.05341796018439194f, -0.15251129609783134f, 0.02320838810698983f, -0.026373642388016157f, 0.1583979442008143f, -0.046715768233940226f, -0.07271354001357677f },
+{ 0.0034035544954431375f, -0.014883925564129279f, -0.014828331981140351f, -0.007459471410509445f, 0.002882770086375601f, -0.004249028487984999f, 0.020085210686649875f, 0.04135680519310068f, -0.01410907244901273f, -0.039930093072194195f },
+{ -0.15779845094888179f, -0.03647038799363651f, -0.11128100559748777f, 0.1986645239954334f, -0.23881855157622245f, 0.23914338620750536f, 0.08090126973083435f, -0.1080497657397743f, -0.029908470465890295f, -0.09070495070031821f },
+{ 0.01698627263670839f, -0.05333265360199228f, -0.008866924530576118f, 0.0873146318169103f, -0.1400498913468642f, -0.025560122149993304f, -0.03257732326425361f, 0.061335849366734474f, -0.03425308637362554f, -0.028384946892270214f },
+{ 0.008662794483581485f, 0.0031649567836395426f, -0.006871623546542752f, 0.012654475737327277f, 0.018641758506106075f, -0.0029853337428989374f, -8.56946658536078E-4f, -0.026258567850469452f, 0.0027618710108668204f, -0.009462351539949633f },
+{ 0.01450722676135431f, 0.0051934061852402635f, -0.009612716787649961f, 0.00943062066259952f, 0.005645848686758751f, -0.014291408969125223f, -6.882028515803066E-4f, 0.0015631469005371699f, 0.01491805646611687f, 0.012407544839059289f },
+{ 0.010551592264153158f, 0.004084251426263093f, -2.922928953674225E-4f, 0.008486213813753812f, 0.08067201087413399f, -8.915208971881043E-4f, 0.009567604297398918f, -0.05411095644301107f, 0.006875953090167162f, -0.0057212725464926735f },
+{ 0.023456400174356906f, 0.0050527931592877886f, 0.003760859664752526f, -0.012462558811002914f, 0.0710591369229734f, -0.006455108463735108f, 3.3808069174003514E-4f, -0.06448150184226836f, -0.0020348393012755966f, -0.013644941870241081f },
+{ 0.004981975311202576f, -0.0116214852879203f, -0.01402247290348204f, 0.012286991912437395f, -0.023949473477687926f, 0.0076257907891239f, 0.0037749623906380434f, -0.0010902522564205613f, 1.4933545799934633E-4f, -0.010594301764614721f },
+{ 0.01228872965461992f, -0.0015864041767279695f, -0.019090268262021967f, 0.027374222532514803f, -0.017702374157431908f, 0.0010124996739163225f, -8.058056615692636E-4f, -0.00475663523804926f, 0.013112191879039588f, -0.0014049616820140654f },
+{ 0.015379008773988722f, -0.0015388169209504857f, -0.006536295031134061f, 0.008549926870743421f, 0.035870305547823125f, -0.03362605809090918f, 0.008467338560836715f, 0.01611265136212273f, 0.009402100012189517f, -0.01973535952454308f },
+{ 0.023736759292285026f, -0.02617081144784427f, 0.019502405890085103f, 0.04828895612932437f, -0.052942044751084764f, -0.007198605736742685f, -0.016847338760683315f, 0.07110767606364707f, -0.011301955214299907f, -0.03722787776528613f },
+{ 0.015580826841350426f, -0.012120951366421114f, 0.009497685069550966f, 0.02539974201504726f, -0.04432053344539572f, -0.012132457795013837f, -0.013241860420217095f, 0.03182997136897589f, -0.015041254488823146f, -0.013412365548181275f },
+{ -0.004409918883978396f, -0.010840893368422555f, -0.01028163000416944f, 0.029692416499576893f, -0.1104377897916819f, 0.003647859966871521f, -0.011249747510953272f, 0.061752584639323566f, 0.019708092020767815f, -0.02100258893175148f },
+{ 0.015627121491843095f, -0.008965352925942806f, 0.012293352530084178f, 0.04301658494962727f, -0.03710665339325004f, 0.006921230602464111f, -0.01055526521603626f, 0.009147462463074603f, -0.0464567334912224f, -0.028437708938420753f },
+{ 0.007108613100088048f, 0.0031408738640527783f, -0.019040884135689308f, -0.023150274727200184f, 0.02191660364419543f, -0.006070521480773629f, 0.0051219695190952f, -0.004179446800056692f, 0.018937041456792418f, 0.003429296233940861f },
+{ -0.037325187868194706f, 0.021294521537399663f, -0.019151761236812594f, 0.01054254545753812f, 0.038839207515188094f, 0.005124342385727745f, -0.038285767446329076f, -0.04264245224289049f, 0.028387715059328304f, 0.013621404730881507f },
+{ 0.02248240391054084f, 0.002120631152159325f, -0.016214464660059904f, 0.014650010403181597f, 0.024641561464517313f, -1.5543625155230972E-4f, -0.004507439164846455f, -0.035592896623533384f, 0.013902931766609786f, 0.016695074918860246f },
+{ 0.04406897623919145f, -0.007761953299578896f, -0.006373164711257336f, 0.028327287226802802f, 0.03603022075225549f, 0.00179990877297986f, -0.010761698493064164f, -0.054956796730072144f, 0.006494493397004079f, -0.018441916603643103f },
+{ -2.9794905480072086E-4f, 0.010338750272314205f, 0.014487476922195847f, -0.03495979462995455f, 0.052467015289171116f, 0.03719412468280737f, 0.0061009064311766436f, -0.06932038256970037f, 5.925813174220679E-4f, -0.02517495262892484f },
+{ 0.017624845652763812f, 0.010473908946772267f, -0.029500338480210584f, -0.06496825154822797f, 0.0328306139650131f, 0.02358985265418682f, -0.02984549099251001f, -0.036653950341375634f, 0.026023298216276962f, -0.08165960320818849f },
+{ -0.0044825887088603845f, -0.00428782758375543f, 0.0020176499758234375f, -0.012750246134378898f, 0.007277061388053433f, 0.016605328881395584f, 3.056680708162665E-5f, -0.030724648055174025f, 0.016077725158918383f, 0.0024912066487111713f },
+{ 0.05343053892307582f, 0.014978686207107478f, -0.020676361032625157f, 0.013623203740094764f, 0.061195267205061764f, 0.0013587913731620996f, -0.048321220499998825f, -0.05165966634171736f, 0.04355291860777163f, -0.04952263807771611f },
+{ 0.034597904014776984f, 0.02963559646683574f, -0.03647348717480191f, 0.03498422825123851f, 0.06261237201489116f, -0.0030365978284401457f, 0.001732226424417204f, 0.018341915684569957f, -0.015109002563452868f, -0.10874850876445233f },
+{ 0.03489011860773726f, 0.07387241906870019f, -0.028599807765187887f, 0.09756420447208f, -0.09787634139052552f, -0.08353413403834652f, 0.04148383855138249f, 0.0054408428201991235f, -0.056103672079968366f, 0.09538572641315851f },
+{ -0.02238001370993216f, 0.05892016928896022f, -0.05632557282846709f, 0.027027187594716187f, 0.06142296873952772f, -0.06793382371063603f, 0.10083446831243356f, -0.0020056564613744597f, -0.15210642747694753f, 0.09531932555507282f },
+{ 0.011997892089535311f, 0.03810363938420325f, -0.0032933909679227734f, 0.021862632671006757f, -0.017320066400514984f, -0.030053827288529424f, -0.0053404362954437125f, 0.017258370699158733f, 0.0023179124483056123f, 0.04481864102966383f },
+{ -0.06613525040264245f, -0.09425430817673665f, -0.030529870796052405f, -0.011536156146913737f, 0.06527638039730142f, -0.028846473122977688f, 0.04222396908722682f, 0.007451731548169049f, -0.20135751324931908f, -0.0035444246923145043f },
+{ 0.01672409224652743f, -0.026470006134784434f, 0.016582512694373313f, 0.05509665496434969f, -0.06348944013218677f, -0.004483501072126058f, -0.02824574508955995f, 0.027725451325302485f, -0.0371337343443862f, -0.02700542097975083f },
+{ 0.021407801926050518f, -0.002794292616713507f, -0.0017180071118838688f, -0.024163927418986788f, 0.004323967849241185f, 3.8869477424771485E-4f, -0.003161986917920571f, -0.021627629332342968f, 0.021837620411326423f, -0.022785192613632047f },
+{ 0.02014480149374437f, -0.014856498940819059f, 0.005951213520068868f, -0.02717410413515778f, 0.008845946279990137f, 0.02515216198532402f, -0.015179957599692257f, -0.0352632814216507f, 0.017182140291449547f, -0.011843903447218187f },
+{ -0.011829136217605925f, 0.0018679006914654164f, 8.330320570356223E-4f, 0.0056372099454792554f, 0.015550084706126002f, 0.012688071863017179f, 0.010440500665268675f, -0.01085373588174264f, 0.004875916706028793f, -0.0036478722032838393f },
+{ -0.007904233369467481f, 0.05202714501691864f, 0.04645939030330036f, 0.08297086558141265f, 0.0034390639499776864f, -0.15330483000820364f, 0.033856661848354f, -0.0048163496634283706f, -0.2471838114324432f, 0.0766913003639142f },
+{ -0.028875230724876397f, 0.04155992196934689f, -0.04169785598513275f, 0.022979194830937886f, 0.11564651839376967f, -0.05211958496097513f, 0.011848080220322672f, -0.014425758346936613f, -0.12808229373818036f, 0.05487571672984218f },
+{ -0.022453966533111182f, 0.03789587234705215f, -0.0390182836628722f, 0.057225046809381536f, 0.04068429249621868f, -0.02799946241525725f, 0.010785202307538813f, 0.017059612007554036f, -0.07888393697486627f, 0.00359487521704338f },
+{ -0.00830164869592394f, -0.008224137044814632f, -0.025884280834094282f, 0.012444694137174368f, 0.10944256512343033f, 0.0063588694627869985f, -0.03848598392167786f, -0.02047354504144041f, -0.07063589663294871f, -0.05124308554505091f },
+{ -0.006774988799019775f, -0.0070080229659726856f, -0.03186639687956729f, 0.005838469521587692f, 0.0832932734792698f, -0.004646793462689971f, 0.010126471265596942f, -0.00361580546957128f, -0.037413874996363165f, -0.013852187507442555f },
+{ -0.014025462986000076f, 0.0033153845715386907f, 0.009609271250001451f, 0.01368270830098504f, -0.0038947042906424144f, -0.006255588511926038f, 0.02655208475892492f, 0.021017479691511975f, -0.030496348375322124f, -0.0024862780482209075f },
+{ -0.028332297123789527f, 0.029778624137313633f, 0.024158111053006394f, -0.08067958305836949f, -0.1709420849576582f, 0.03138394783612681f, 0.04819107903918558f, 0.06213657641550996f, 0.07226809683110043f, 0.107828895702839f },
+{ -0.013714877631838098f, -0.02547377870974787f, -4.8707194448860267E-4f, -1.508480504836497E-4f, -0.1335319083686333f, 0.026427202923162016f, 0.0024830456704784207f, 0.11569696934730324f, -0.005443756390013079f, 0.05680994359298176f },
+{ 0.005568240287042956f, 0.019660338989652804f, -0.00958823107930458f, 0.0356689246526499f, 0.008715905047702217f, -0.0030120372498032796f, -0.0011722715398444234f, 0.015148912244890938f, -0.0035664231151726236f, 0.01628167694836403f },
+{ -0.027230918141776993f, 0.04747272220867373f, -0.031527698831400774f, 0.037054891209737754f, 0.0758203561712238f, -0.040110926941130866f, 0.034468656300958765f, 0.009062431130697643f, -0.11445893066513754f, 0.010914792360273864f },
+{ -0.09507971214455527f, -0.04733721662951449f, -0.04188994049771512f, -0.10639104035012378f, 0.048629502647329924f, -0.07141646623525871f, -0.030949048980055145f, -0.010651039970637011f, -0.13828400051820483f, -0.012509468189374205f },
+{ -0.05670407549090718f, -0.025237112922311424f, 0.02065621920401351f, -0.007521177765038109f, -0.06428195040524183f, -0.023524346604723106f, 0.037903465956657646f, 0.05848915399674204f, -0.09101909319572148f, -0.014031350267424027f },
+{ 0.01398639471682965f, -0.035440944149786505f, 0.038431440977616575f, -0.011212297784092098f, -0.177690542320398f, 0.021937779803799188f, -0.0026826269108903233f, 0.14653478419642027f, -0.004579300733766548f, -0.018039373905584934f },
+{ 0.018741173254671638f, -0.002999101035865392f, -0.016462756694937936f, 0.025685510378411044f, 0.08374672345331324f, 0.02199420459156576f, 0.0016573495664092878f, -0.025952992370549564f, -0.013960692286771914f, -0.04429555006423641f },
+{ 0.07159128616187257f, 0.06957750081014728f, -0.1015441927001903f, -0.011591946114927079f, -0.10883758484689315f, -0.061498635426875996f, -0.01495701529580521f, 0.065128231056565f, -0.049621936083522875f, -0.02561541070347762f },
+{ 0.02005385066725619f, -0.012161073175329573f, -0.006928409031192338f, 0.001374561175555926f, 0.0054344117665544155f, -0.0015765611434268966f, 0.0077051240783789525f, 0.01624489235245641f, -0.007187539420672414f, 0.009202015911761294f },
+{ 0.005710445895327318f, -0.01897395695001093f, 0.008644393926975552f, 0.02082418726817779f, -0.03527198760627673f, 0.01069578252196177f, 0.010030715622826846f, 0.09428341930010607f, -0.05058973006185639f, 0.026762367016951397f },
+{ -0.04898597111507217f, 0.002696496817922704f, -0.003951762766820715f, 0.008383778035091034f, -0.02956428504077374f, 0.024851602821848392f, 0.013982001065087447f, 0.09166105880151708f, -0.07774411896573633f, 0.04454755311595097f },
+{ 0.015085382691650245f, -0.012249848806018088f, -0.011729897652187704f, -0.013258863942183237f, 0.017147878683631074f, -0.018699275895527126f, -0.007113359629385134f, -0.006475620549033056f, 1.5412900979903775E-4f, 0.0015471308371920308f },
+{ 0.001493219401872223f, -0.012506844744425276f, -0.01315462108268324f, 0.017289198166283208f, 0.04169995705922066f, -0.02516643313025262f, 0.011080138699553998f, 0.020171563076635f, -0.05035791659618756f, 0.017884952979029273f },
+{ -0.05676169284593169f, -0.044823989111767513f, 0.04104480313289812f, -0.05641895069108503f, -0.05326116415864085f, 0.028464097725568006f, 0.02184657601823046f, 0.07410280906220376f, -0.010935481710249991f, -0.0032806205511750307f },
+{ 0.016324542651588815f, -0.033282343458653885f, -0.005096957434151493f, 0.01466490803163315f, 0.05055019644677186f, -0.020617643941071774f, -0.022377841111844102f, -0.025314461110211826f, -0.013722351713882188f, 0.009868375672228414f },
+{ 0.0013922669454400803f, 0.010019006128922028f, 0.014116619108862472f, -0.001796527773622496f, 0.008944288822321563f, -0.0025787234705292057f, 0.0040777632967078535f, -0.019272791383167686f, -0.0042055607430384265f, 0.001267846653227326f },
+{ 0.002372076515277996f, 0.004653251483473583f, 0.002781332567582232f, -0.006831789660154082f, -0.007165801914710349f, 0.00759505683612931f, 0.014888876210976709f, 0.006222889003227179f, 0.00990139661456907f, 0.003971175118308553f },
+{ -0.014525916685891165f, -0.011270873472872528f, -0.011812790195278401f, 0.007868928932065544f, 0.0080927825172199f, -0.01318652150441786f, 0.0068894790887903635f, -0.003567652653061079f, 0.005959562645500912f, 0.003585754777292919f },
+{ 0.0019531162994917558f, 0.009109636093911135f, -0.0015970539616856176f, 0.01728088446568225f, -0.00525151622344117f, 0.01595509585218339f, -0.020830241891950322f, 0.005392329663333621f, -0.02185616461104056f, 0.0015684532889037705f },
+{ 0.013623494322944322f, 0.016642191098550217f, -0.005611345644753389f, -0.023051264928013727f, 0.012231788119471954f, 0.004186083216019302f, 5.711922987929163E-4f, 0.012782940027165313f, -0.010393841598288626f, -0.01840502453390338f },
+{ 0.019645659037768156f, -4.6482004904806125E-4f, -0.008805872875252916f, -0.0029717381456987857f, -0.006141656078650975f, -0.0011168918422162584f, -0.013626307641033498f, 1.8436924196056157E-4f, -1.269251670746218E-4f, -4.7206118467646403E-4f },
+{ 0.014273787085443137f, -0.032286484708014145f, -0.0036299694526918933f, 0.014232450074429706f, 0.05971188951678738f, -0.0028014539638796954f, -0.024896657929759806f, -0.04281853728473372f, 0.01711244908184479f, -0.022566179466219544f },
+{ -0.06764756715674847f, -0.024959465409441786f, 0.04918575627047237f, -0.0472409853229447f, -0.04975583952442508f, 0.03550208962444641f, 0.029611843867125086f, 0.0735115878649345f, -0.017849547217383046f, 0.009178004424798089f },
+{ -0.010845803487743924f, -0.012026315260792876f, 0.0031642721045703885f, 0.0015379773274652796f, -0.007977741477573554f, -0.0017242477781112108f, 0.006402953617979139f, 0.026239665494650573f, -0.016375312143839842f, -0.014707251256247974f },
+{ -0.013182568690295925f, -0.03388894821627996f, 0.017649632101801597f, -0.041474745433204535f, 0.026695837689229906f, -0.004233526180278758f, -0.01375569703232026f, 0.024427483506647998f, 0.0024990331976446722f, -0.053658714096109304f },
+{ -0.019268472971165736f, -0.031202528537778593f, 0.0888077281611804f, -0.08965741151453316f, -0.15661394376763832f, 0.0381916380732038f, -0.0011158694900904292f, 0.09148534513333702f, 0.044124166938979144f, 0.0014954740613432862f },
+{ -0.013134740202952024f, -0.003773591944403709f, 0.03870300255538802f, -0.0385323886120806f, -0.10773310954112418f, 0.02061331626097747f, 0.05306467737619008f, 0.06526138907072422f, 0.018331153877071585f, -0.001117930192861638f },
+{ 0.0025469807445882217f, -9.99704823658153E-4f, -4.3024122689419434E-4f, 0.01274416336948781f, 0.007081744565417342f, -0.007288644041769745f, 0.009200635675789064f, -0.0037216233050374804f, -0.014723873710553934f, -0.001992836851415545f },
+{ 0.05888169103221469f, -0.08649975203045343f, 0.21232291905933895f, -0.20430971320308466f, -0.45891204003624325f, 0.021389362997891428f, 0.0014523148612529892f, 0.14365528378197695f, 0.13747179509585677f, 0.09647056436788336f },
+{ 0.008161392901709384f, -0.026073585400228576f, 0.034612959084482024f, -0.03311808655781641f, -0.07302849267801655f, 0.013141311936367086f, -0.006952574784144534f, 0.011940677729085119f, 0.03330402930779f, 0.016404045999451194f },
+{ -0.0671387888705015f, -0.005198572467322971f, 0.13753843755801395f, -0.16606548517614142f, -0.24924072311404943f, 0.07685113778664063f, 0.09774110393814966f, 0.14439520430857122f, 0.0464931009275719f, -0.00354759553369512f },
+{ 0.005646157235166318f, -0.013105338808489875f, 0.024806075049661154f, -0.02297645131703742f, -0.06457815668764055f, -0.004576048831573468f, -0.0029212027767729887f, 0.022783279307312686f, -0.007971174882503304f, 0.03953445361444526f },
+{ -0.019477728349757414f, -0.014286927582649673f, 0.0529690273084138f, -0.0699260281200144f, -0.06841499311786882f, 0.036567519319590826f, 0.008152148355898963f, 0.024855160557159306f, 0.044535876438813425f, -0.0021288709027732005f },
+{ -0.02788447466271624f, 0.009570156542315448f, 0.018630564586862703f, -0.027095784546422755f, -0.059252768697155386f, 0.01124763020525031f, 0.006225094255471941f, 0.014414088721258938f, 0.016229632909624838f, -0.0126339507813518f },
+{ -0.028825244872577028f, -0.005725470063657879f, 0.04288116662023624f, -0.04614877188204709f, -0.1015238152465206f, 0.028812071010798215f, 0.02364470127270529f, 0.064284533844927f, 0.018502268007577365f, -0.018331817689617582f },
+{ -0.036465224128526444f, 0.005437787968117365f, 0.04607921298851119f, -0.07646186603896508f, -0.09221260517183827f, 0.0544016290190407f, 0.028324109880246234f, 0.0818446219722929f, -0.010315900962788987f, -0.02445758652954169f },
+{ -0.04655266216139524f, -0.011229689083735018f, 0.05620346989380938f, -0.09657843734964032f, -0.129691099186953f, 0.03998736803771318f, 0.03287109726474492f, 0.060556244669396866f, 0.03793434783154185f, 0.00852656286464352f },
+{ -0.013649601426616573f, 0.008038482923105498f, 0.03608688963811409f, -0.0232009633913417f, -0.03817847586764231f, 0.00663610511369342f, 0.01441617859958073f, 0.017876871119126243f, 0.009906606945241042f, -0.013924204376378388f },
+{ -0.02245157040320717f, -0.03383907651404065f, 0.07045839831891189f, -0.052442224773927335f, -0.12864631023484616f, 0.037507189375269395f, 0.002651667246864397f, 0.09586846993559733f, 0.016788248270988456f, -0.0371044079031778f },
+{ -0.08682309524406444f, -0.024341547628614152f, 0.1634987678124606f, -0.19308720335877091f, -0.22191597043792066f, 0.0848250734148258f, 0.03922694019235561f, 0.09261386144593373f, 0.09386772474095859f, -0.006569923680973095f },
+{ 0.014750705229219447f, 0.0029567010145250196f, 0.007699608866733431f, 0.009021812645693728f, -0.022245302718745828f, -0.003926460721531081f, 0.0018301910593690126f, 0.004493157423413133f, -0.02338082027814204f, -0.010789266805725738f },
+{ 0.018190733150476694f, -0.013883414052379979f, 0.01079623296348731f, -0.025164273908833645f, 0.01502293315974443f, 0.004320990178761483f, -0.012117019839765477f, -0.0468294224732203f, 0.01188651963943007f, -0.01039245517170641f },
+{ 0.009825045545143138f, 0.02593843052801544f, -0.05045690959360384f, 0.04457733536806685f, 0.03015964473210457f, -0.020639544561212322f, -0.018066537320545518f, -0.029226662351343954f, -0.01351018088827283f, 0.046146136127437856f },
+{ -0.016966596964559214f, 0.07751760808409364f, -0.06381132883117102f, 0.057020204120539715f, 0.11928509234732389f, -0.004805555633982426f, -0.009188661666529534f, -0.05531319903504447f, -0.05261230840511188f, 0.04043985685836745f },
+{ -0.060181113128635576f, 0.11258064579994441f, -0.06501651271410458f, 0.08844325024324479f, 0.06789755967334471f, -0.03951934286915474f, 0.037720140123564366f, -0.049028718559455606f, -0.03380873173771515f, 0.21162756510153402f },
+{ -0.0012905109952459962f, -4.819405693754143E-4f, -0.0036947437422971178f, -0.01914496803575523f, -0.010746056617814581f, 0.005891753117988045f, -0.015017909331876408f, -0.005708914575191238f, 0.007167865734561938f, 0.011016499027534193f },
+{ -7.029103333361504E-4f, -0.012271384774632119f, 0.009263075847121363f, -0.010874653850323207f, 0.0013991029426047702f, -2.347529897282403E-5f, -0.0071608488974840056f, -0.009418608868125478f, 7.71422813404625E-4f, -0.0031513825503823078f },
+{ -0.03547910663326122f, 0.1288850535140231f, -0.02679758483833088f, 0.03617776286207863f, -0.08692232657661599f, -0.05618482587918692f, 0.1336920807269726f, 0.052541914335607696f, 0.08311930668600648f, 0.20789788965964798f },
+{ 0.007466770244430136f, 0.006138070640795818f, -0.007793508546902062f, -0.005642363686596424f, -0.03337545946248479f, -0.0034043043573813636f, 0.004471635490903306f, -1.1871300250190987E-4f, 0.013963215279500748f, 0.023212955189864264f },
+{ -0.006502325188593056f, 0.004722402229301229f, -0.01921115914533991f, 0.02124790449101753f, 0.00676199923494828f, -0.03368509902699514f, 0.023244251380587867f, 0.01883550192664633f, -0.020106674422560207f, 0.029820223888860686f },
+{ 0.021268423531402316f, -0.002175191598780661f, -0.020669039593020078f, 0.006924405820402491f, 0.021980875147437764f, -0.024052584984693613f, 2.735890383529805E-4f, 0.022410397263725474f, -0.018084612641303136f, 0.004409733691730604f },
+{ -0.019905345623155837f, 0.025616171730348095f, 9.199219881307723E-4f, -0.006094176982056543f, -0.006238044908609189f, 0.009671299671106151f, 0.006355903886510805f, 0.009743122787564864f, -0.004907065368956824f, 0.003340728440458778f },
+{ -0.011792347239972f, 0.0029436573181976793f, 0.02398313304799121f, -0.008539512559424998f, -0.032589231942006344f, 0.014508048026466871f, 0.019680043823754885f, 0.030632048386423093f, -0.006564929013931243f, 6.752426102662368E-4f },
+{ 0.04836151060882624f, 0.07487293059027357f, -0.1059352862816318f, 0.08305766339397073f, 0.13877303343260688f, -0.038097978197270066f, -0.04117815352575858f, -0.08354541166491408f, -0.007078157820559671f, 0.022575154555637102f },
+{ 0.04669845513079778f, 0.05012670572146292f, -0.056996644270131756f, 0.04031450045201776f, 0.13579434402130097f, -0.01683415819151128f, -0.03123517324265727f, -0.12194179795140307f, 4.088977086279795E-4f, 0.01467625801377832f },
+{ 0.01267081019527276f, 0.0015499173497215168f, -0.07891649478496886f, 0.07063488848816712f, 0.07040437024746707f, -0.01894953720763358f, -0.00475173622170576f, -0.019507719143449263f, -0.06496538633926029f, 0.012626910667043766f },
+{ 0.053478728799910544f, 0.002588489349294179f, -0.02795548072246018f, 0.038558794573317075f, 0.0845957358019072f, 0.00393970644794706f, -0.020491082679059344f, -0.059930311573174674f, 0.044589555803810015f, -0.01699348697411113f },
+{ 0.05044617697389276f, -0.009785488884618852f, -0.025144146983417794f, 0.0407556605012449f, 0.05066661454718612f, -0.018212930804914318f, -0.019550362908717f, -0.050975883596246045f, 0.044431254027182836f, -0.003832077703161655f },
+{ -0.004610730187362556f, 0.008857589191210883f, 0.00139692458936302f, -0.002067085375311779f, -0.008338087256629155f, -0.01583552099293064f, 0.005709628606842095f, 0.010278022320248017f, -9.207355737311731E-4f, 0.00462947290113528f },
+{ -0.012667435521312945f, -0.004155524400503646f, -0.04002783238966908f, 0.018211084947698127f, -0.016195171842447915f, 0.005590628186863652f, 0.01850006456691224f, 0.07205277277623724f, 0.03323975475045593f, 0.009234226134060658f },
+{ -0.015588819469217296f, 0.005347116552454826f, 0.013154016712417387f, -0.002532788660599083f, -0.05039223754655586f, 0.015525089756666584f, -1.9992441863417518E-4f, 0.023895115863683116f, 0.021903575819102687f, 0.0078726997499227f },
+{ 0.045675090449910284f, 0.05725683189790398f, -0.06156457499655555f, 0.06818376298830207f, 0.12968914732398895f, -0.06298136168724094f, -0.02413358092738162f, -0.06688165845167453f, -0.053767744350023315f, 0.03412404665978565f },
+{ 0.005358032380118874f, 0.01276120586101603f, -0.03985592760488654f, 0.03640323103056126f, 0.0697098571826972f, -0.027221225610061076f, -0.004583687023451627f, -0.03249501802306854f, -0.0299792246823751f, 0.011386258684845935f },
+{ 0.04071386275976684f, 0.0396962845541043f, -0.06294432829970588f, 0.04776525380384626f, 0.14310776091038085f, -0.03127252524604341f, -0.032600401192348784f, -0.11524753681307078f, -0.04620622681919241f, 0.0021752341815911317f },
+{ 0.043792736664921325f, -0.007169365251779331f, -0.030709779289096975f, 0.028959593878720723f, 0.04820120570443678f, 0.007008190770067525f, -0.008758270531706152f, -0.028851699212297566f, 0.035005222201954796f, -0.004514151318724732f },
+{ 0.03195126883474231f, -0.007695929016113682f, -0.019731068408633593f, 0.007997807260090944f, 0.05341571667504212f, -0.010480698351904983f, -0.004150716615208646f, -0.04281441472425067f, 0.01924277460273761f, -0.018625857015663383f },
+{ 0.007884331142383363f, -0.012852398814285773f, 0.011780493537952859f, 0.01756382106365634f, -0.025498746586149566f, 0.006397661804008302f, 0.0015061355922316292f, 0.022129146284267105f, 0.008834733729385652f, 0.00786200338191638f },
+{ -0.002187030604898786f, -0.0037348670479031964f, -0.017764123691566863f, 0.005304902086259192f, 0.014986336644229744f, -0.019631258767815008f, -0.004152443477776283f, 9.600376254111935E-4f, -0.02289954690228682f, 0.0033267317748690017f },
+{ 0.026874598961110066f, 0.003504671388575751f, -0.04792687615538065f, 0.0774058184415238f, 0.09015945222778271f, -0.019334020658455568f, -0.013128244213899304f, -0.0387711507761863f, -0.037474168801872654f, -0.007867331172748853f },
+{ 0.0031476271309693864f, 0.009809878965900583f, -0.0065850132800932696f, 0.025764601281881214f, -0.0053368604894627174f, 0.010673068491005456f, -0.013630575445786374f, -0.011767741753186716f, 0.004469802927520142f, -0.011940723352988963f },
+{ 0.038772848536258085f, 0.0011127391247677885f, -0.04448887079754326f, 0.04754370439438906f, 0.07098900603290155f, -0.01266614843367275f, -0.03613041780380606f, -0.04513805046195002f, -0.018849197120896985f, -0.00576446187372381f },
+{ 0.013334298161766756f, 0.01697183573913224f, -0.023367326955462286f, 0.05772610704264541f, 0.1137690296285788f, -0.006474824058511909f, -0.007844627500850533f, -0.11244175103405202f, -0.02654960872604619f, -0.0022875499218147875f },
+{ 0.04608634042977863f, -0.031311000201605425f, -0.02416134394703185f, 0.023796468967229607f, 0.030942667922405565f, -0.00479759461041291f, -0.009719527250711096f, -0.027518017149603016f, 0.036937464196679f, -0.0052418429302073695f },
+{ 0.005768961124299118f, -0.03718955545908585f, 0.010452135633654602f, 0.028029985237632688f, 0.04747386822929508f, -0.008963516942843426f, -0.011967233363958496f, -0.008146274769219072f, -0.018928081579451878f, -0.01553125445765509f },
+{ 0.009042317383929193f, 0.018861274926467175f, -0.020480770141253293f, 0.01653389173749272f, 0.02150047920450213f, -0.02038189302406493f, 0.0015561482607079808f, 0.012761695947131543f, -0.004255366588863827f, -0.02626942011312763f },
+{ -0.001439361532903088f, -0.006624172165609526f, -0.027238449821160818f, 0.015483931800781196f, 0.06572041814252394f, -0.03008782926036948f, -0.019487723904864505f, -0.03798871675716897f, -0.01806020502088128f, -0.022932773257675f },
+{ 0.00345505853414852f, 0.015208268908870264f, -0.0055465703634595374f, 0.016679673411717017f, 0.006721036231580927f, -0.0037661801926522445f, -0.0012650533386139578f, 0.005340678328505184f, 0.004751172548675789f, -0.0010777278337209051f },
+{ -0.015216679191387158f, 0.010017324844825752f, -0.0040983330355726585f, 0.02127249962263997f, 0.02399578994946371f, -0.00956275757777141f, 0.0026810996296327064f, 0.025850327194916353f, -0.02250929418766812f, 0.011741212947646757f },
+{ 0.01170696832222464f, 0.013409124291005861f, -0.017825088486666446f, 0.03919388672554888f, 0.052186700096171316f, -0.013767511151210929f, -0.0012729173085894636f, -0.028509402996492243f, -7.633517077425632E-4f, 0.004802365861795898f },
+{ 0.02806544688480142f, -0.011986849494157686f, -0.04278323044846009f, 0.028683049547052315f, 0.07435839596702551f, -0.02398212679519654f, -0.021790754457787394f, -0.045577148982490795f, 0.0070579912659440944f, -0.007132159014325818f },
+{ 0.020483797833635933f, 0.01225009782087495f, -0.03862218182983345f, 0.03631422250638445f, 0.14801206863158337f, -0.007513295227843948f, -0.048654596835361316f, -0.12201507591555186f, -0.011480606140611381f, 0.05384728624913416f },
+{ 0.04051745595402167f, 6.751701812105467E-4f, -0.09129701377105107f, 0.007450410516771124f, 0.1422498488561357f, -0.0418315210437701f, -0.11715415421951016f, -0.11127133648824f, -0.026696195138818966f, 0.037905099930643636f },
+{ 0.03915566456769385f, -0.00443661591282166f, 0.00588471984287791f, 0.011292768788845498f, -0.0597146097462835f, 0.003630353669802837f, 0.004473165303362797f, 0.04963632980527517f, -0.0036318538924032468f, 8.664819196475721E-4f },
+{ -0.021507319541381763f, -0.009382895549239288f, 0.05275063374872117f, -0.041891821358689185f, -0.009218220557806278f, 0.0696504090905074f, -0.023225215450787203f, -0.012511501926681587f, -0.0860182379640079f, -0.009448457105521876f },
+{ 0.03954462361792417f, -0.02257467324429648f, 0.0012311239983959887f, 0.036587012976981526f, 0.07225888877274675f, -0.034767660093410126f, -0.015213645100137996f, -0.037811932306381114f, 0.012293061405989264f, -0.019779240094113523f },
+{ 0.05822884516323038f, -0.02066332054078167f, -0.025500800207345322f, 0.03216426660165922f, 0.10240201945815501f, -0.01192872520954401f, -0.04960671989573882f, 0.00356433023455404f, 0.0068328692071347105f, -0.07729545217240348f },
+{ 0.005571807038479356f, 0.031007709454830956f, 0.002761969429415659f, -0.03950939731497561f, 0.07944967010592077f, -0.024928286069954786f, -0.008260817221711363f, -0.08538591412433186f, -0.10623300545499324f, 0.04088809903171683f },
+{ 0.09371620371579695f, 0.05432024576228673f, -0.07263405886127067f, 0.008962973175401998f, -0.03408316184270416f, -0.056645217823215056f, -0.04816233534667229f, -0.060481948247858526f, -0.12855406808707737f, 0.0205281459054081f },
+{ -0.003106392891108583f, 0.009376336119322495f, 0.016037055244406455f, 0.002683863986283782f, -0.01927621700333144f, 0.00965655194694927f, -0.0014556061209333425f, 0.009901197301845471f, -0.006597044536571635f, -0.02064197164090092f },
+{ 0.010956713117357707f, -0.007635302700172256f, -0.011904101425300202f, -0.0024404279662236725f, 0.05547938408426035f, -0.011514703818721442f, -0.0037409844197481504f, -0.0473313080060784f, 0.018411524960607308f, 0.020125715142085967f },
+{ 0.014962137457701155f, -0.0065035028354778635f, 0.016922072968689146f, 0.0014062334794604676f, 0.004896968288004004f, 0.007840816730897163f, 0.009083191609844655f, -0.028443532146300077f, -0.01860551566432723f, 0.01633041069917622f },
+{ -0.04320040208085037f, 0.04443623299846091f, -2.532662787322656E-4f, -0.036262648445621f, 0.0931296572059255f, 0.0030108020445948993f, -0.003744059060681642f, -0.08628693003863756f, 0.0253928685298313f, 0.004325553986705289f },
+{ 0.017831292579355774f, -1.3299078613873564E-4f, 0.01622214409059294f, 6.780241888791111E-4f, 0.00592483657380261f, 0.004997906299149509f, -0.006054789761602028f, 0.00282635559521958f, 0.01147433394032276f, -7.669574453452321E-4f },
+{ 0.013259076908312958f, -0.015366595997685664f, 0.019297936404932638f, -0.007633265861685511f, 0.0026968085916728155f, 0.009463901635652095f, 0.0015185267968055595f, 0.0028946720136803087f, 0.01718598561200494f, -0.0036711146807560735f },
+{ 0.005186932364882055f, 7.056127550654744E-4f, 0.016715660739469233f, 0.01579739667446836f, 0.08456602140076938f, -0.029514546814913424f, -0.03032164440823617f, -0.01769303676923037f, -0.0064041554204288306f, 0.007699231907689655f },
+{ -0.012198500718638386f, -0.023091687721690277f, 0.0018602262363178244f, 0.01567684435490176f, 0.06655389882977555f, -0.022937136575377885f, -0.007247942252527832f, -0.025772498644816646f, -0.00134543142936667f, -0.02679170223001344f },
+{ 0.003879738064968296f, 0.03523243115821892f, -0.020306288692872477f, 0.00464875315577607f, 0.14027746234457633f, -0.017977020075248446f, -0.035371770560920036f, -0.027984837954403433f, 0.002137842535811495f, -0.02400818559726465f },
+{ 1.0335129955365753E-4f, -0.0075899141292167f, 0.01185842621811656f, 0.00927186159273174f, 0.025406528534631788f, -0.008360443257914624f, -0.022499827190573213f, 0.011829639957035155f, -0.019970850746950188f, -0.006429436616271854f },
+{ 0.005344302135165817f, 0.008772859326646853f, -0.03571544407320336f, 0.027057460385382186f, 0.03360778889611429f, -0.010971149278182336f, -0.0072348065430504534f, -0.017919240975513694f, 7.558303189374257E-5f, -0.0041736817195919375f },
+{ 0.013268029927335721f, -0.015978149767253362f, 0.012733158924157634f, -0.013331954030767881f, -0.015424729260994023f, 0.010480566006331925f, -0.0018211103864272749f, 0.01169187899676258f, -0.016851270077163374f, -0.0058209070834127855f },
+{ 0.031074651450493027f, -0.029739382413085522f, -0.02361431761892202f, 0.03250734578367639f, 0.0575671756427877f, 0.001196643305548152f, -0.0011730029806308376f, -0.04107249565909207f, 0.009009797415396231f, -0.009612159257799133f },
+{ 0.020720225440412045f, 6.290154110755174E-4f, -0.029084092540132972f, 0.0290658791042414f, 0.046241863675175104f, -0.018715026781529615f, -0.010466400357443702f, -0.029535098864015903f, -0.017031772737782464f, -0.00630120388701002f },
+{ -0.007688907510745728f, -0.013037713070453035f, 0.028788265029716677f, -0.017900600074874873f, -0.04654835951590183f, -0.0017084528213591685f, 0.013364943620118447f, 0.04039144468564411f, -0.015929827303325105f, -0.012018532359777357f },
+{ 0.03509321138316726f, -0.015257777008850096f, 0.011337479559259397f, 0.021443827064531375f, 0.007891040408870743f, 0.003180961013790843f, -0.00717557823929103f, -0.02854049177448363f, 0.0025012032755725383f, -0.02018803086467666f },
+{ 0.015379666897159364f, 0.010041228198834936f, -0.01233563322626516f, 0.019723678078245054f, 0.03843963712648617f, -0.030776079835270382f, 8.912841896505019E-4f, -0.005388587215096819f, -0.012521676249055392f, -0.004321469129421202f },
+{ -0.0014916964785727882f, -0.020305812601875466f, 0.041424418035377386f, -0.052172164850276204f, -0.08361224418688507f, 0.021878755829692204f, 0.02628730041464381f, 0.039244042319678145f, -0.009614526493975454f, -0.049633080233956565f },
+{ 0.043803227817644876f, -0.01860185225409516f, 0.016175456572110905f, 0.022251211512743237f, 0.02616450401355142f, -0.004134792564927477f, -0.011208694422904326f, -3.737711338399138E-4f, -0.023374617945550593f, -0.035769660080511655f },
+{ 0.035067147900228655f, -0.030029348555856032f, -0.025944018353532612f, 0.04174332457411347f, 0.08714641746695109f, -0.02048073808329651f, -0.01840313210827627f, -0.02633214436893186f, -0.003010824704183496f, 0.010404673868032618f },
+{ -0.03975260173837363f, 0.02178431425607697f, -0.0664684080643233f, 0.04468593739641291f, 0.09829942190255245f, -0.046535998426363454f, -0.02749967140865239f, 0.0013991091170076513f, -0.1688222988810575f, 0.018391344593510016f },
+{ 0.0810075501823508f, -0.03218552457987686f, 0.0027860179932059116f, 0.04368622069178867f, 0.010161575707588603f, -0.03772233549709148f, -0.10258627272822048f, 0.012615520544080147f, -0.15594087484835767f, 0.009195200754784479f },
+{ 0.009477896856592262f, 0.0014238456245577848f, -0.022260033101150344f, -0.016928366039548573f, -0.010871251146235715f, 0.010656473131153489f, -0.019903000909007075f, 0.03070837878650687f, 0.01955888546635818f, -0.016722757106192997f },
+{ 0.018077627377710254f, 0.01799178075398624f, 0.0055778337527122275f, -0.009490464436747939f, 0.031039221178181715f, -0.032672918106522814f, 0.02730045453129586f, -0.027074202548294426f, 0.029714148948380863f, 0.008088019334130826f },
+{ -0.0037045597506780935f, -0.03865834035784312f, 0.09438144243423659f, -0.07855475726223553f, -0.12504122239835389f, 0.016313358058102547f, 0.018916619328711377f, 0.07949705854863542f, 0.00987987230804146f, -0.029720940378910123f },
+{ -0.009761897250471838f, -0.04789775251632367f, 0.09526426124015311f, -0.06628479845454392f, -0.19152485736401956f, 0.012170354328594358f, -0.028731772157358327f, 0.06310063665980732f, 0.030797604456333106f, 0.04358978010774665f },
+{ 0.07465802418806776f, -0.03489954256162325f, -0.03443043537949067f, 0.08563000127540316f, 0.018955632878007275f, -0.048151212416058464f, -0.04341914512674587f, 0.015070238224564879f, -0.03624651936127652f, 4.166813692363302E-5f },
+{ 0.13203007919298504f, -0.03552660355446119f, -0.019909409486877513f, 0.07128439842356177f, -0.15063329927746455f, -0.165861249922331f, -0.0985907178433569f, 0.14103738538219796f, -0.16849425252799843f, 0.0043978883038373285f },
+{ 2.355131257878598E-4f, -0.0018628515633069477f, -0.00196001809608719f, 0.020457698150566046f, 0.015652862492239395f, -0.00583865937964757f, -0.020985308268009747f, -0.004091005576598848f, 0.007270349372186742f, -0.009001650750021581f },
+{ 0.02566370441882727f, -0.0056838669678915986f, -0.008784299794793964f, 0.04136146510082816f, 0.03286890502827023f, -0.02693148795342735f, -0.013446241211502601f, 0.0025176870752769633f, -0.024385039023097722f, -0.016903035109581747f },
+{ -0.02529891022901685f, 0.027886157034731764f, 0.01287798215163642f, 0.008450479240963194f, 0.08939908291662702f, 0.0025845074074571373f, -0.011276915044296495f, -0.02474707527968991f, -0.013632663283336876f, 0.012730060669671507f },
+{ 0.0037021381878395926f, -0.012319983203225346f, -0.034587837921125394f, 0.021654846696151486f, 0.06873627343635538f, -0.0013153249924229037f, -0.015484973686052188f, -0.017625469792986247f, -0.026420285091193558f, 0.0014193345469956276f },
+{ -0.008282663539695681f, 0.020314707717872638f, -0.016638470728379498f, 0.004444100681403919f, 0.034441045565241184f, -0.00785061417974935f, -0.026741204795939524f, -0.025879737875557453f, -0.021697809785309358f, 0.009576772842595449f },
+{ -0.10627467926745007f, 0.03681235054991107f, -0.07707817035526256f, 0.17457447908540027f, 0.021353292272754437f, 0.03239677582297408f, 0.08803637515476095f, -0.08873592679198018f, 0.02071938176059162f, -0.05024783751388474f },
+{ 0.02970604510544439f, 0.013684766496290114f, -0.014164860496455756f, 0.03941979819747547f, 0.08745318959567115f, -0.017420056310463585f, -0.009231059662272056f, -0.05119757232562197f, 0.019748397322306963f, 0.019012286415237428f },
+{ -0.007568570198933766f, 0.009827570948830636f, 0.013402471928872395f, 0.006688440075463444f, 0.07206534833815043f, -0.02639239734801677f, 0.0013431373781401651f, -0.02462078302105753f, 0.021352918947811748f, -0.005873968385530947f },
+{ 0.01170813590665016f, 0.0015121207132359716f, -0.01101935342290261f, 0.022469722082710076f, 0.04091042257108341f, -0.017428723746527767f, -0.00179650444549421f, -0.03209407477312265f, -0.004100628675670726f, -0.009855286694873167f },
+{ 0.007072106452402959f, 0.0027976531654790894f, 0.009514269668733574f, 0.004020273091960143f, 0.05610771479272934f, 0.021328233403136013f, -0.0026755533260219935f, -0.05120737639604132f, 0.008094413537971981f, -0.003060470031747138f },
+{ 0.02100408482832857f, -0.006718881544771455f, 0.02234641392529586f, -0.08195604889731194f, -0.02271214407485181f, 0.005117936372357483f, 0.04448118137250724f, 0.030842381865599365f, 0.03332893310093538f, 0.002858253357734975f },
+{ 7.576510392000519E-4f, -0.03153320824147791f, 0.009977364921980536f, 0.0033687081881155078f, 0.005660522497804721f, 0.005238575428418186f, -0.026473877717958793f, 0.012223890357382075f, -0.027165924988949892f, -0.023396193994202664f },
+{ 0.007028922123414018f, -0.016443546033143797f, 0.010836038549889869f, 0.008962730757879145f, 0.02887769638642338f, -8.37989032005471E-4f, -0.010665782355679434f, 0.008600352580524578f, 7.96297534622309E-4f, -0.00192505811395068f },
+{ 0.0042296297408831555f, 2.666606697751386E-4f, 0.02700988778153713f, -0.05094812210134295f, -0.032450490919818f, 0.007227992628765653f, 0.024013974191878406f, 0.04879078371547383f, 0.020504487803059208f, -0.014071511643301901f },
+{ -0.02562028754408535f, 0.012151408827380205f, -0.005022747966424021f, -0.02723185199576131f, 0.06745143378726512f, -0.01100580153078291f, 0.009937857887460792f, -0.04839158040821443f, 0.03217551396211182f, 0.031106154599055066f },
+{ 0.011281534644538807f, -0.017705062123968145f, -0.008961160301528161f, -0.016776244268474717f, 0.020517517017817427f, 0.006196057317741979f, 0.008837563278976215f, 0.016140271755870485f, 0.03329833873874215f, -0.014107702791130472f },
+{ -0.0016713689141123415f, -6.655233634115599E-4f, 0.02337321940117965f, 0.001275252834872783f, -0.020259631017823885f, 0.012685089474648555f, 0.003523337754313268f, -7.567260534828448E-4f, 0.009444840019892438f, 0.0023775166608573516f },
+{ 0.12862571423211364f, -0.046256925387585746f, 0.03598220271025007f, -0.11632777021060617f, 0.028423828378308508f, -0.09957302877256878f, 0.1149324323961378f, 0.15965688611231685f, 0.030914300606192293f, 0.04732861252747647f },
+{ -0.018215689475642154f, -0.002104589303096869f, -0.02122431697368723f, 0.015578791096061221f, -0.058918137043650454f, 0.0058219269987877026f, -0.03343735183174925f, -0.02364213721047141f, 0.0011308869701232586f, 0.020400545448662002f },
+{ 0.046712842297433874f, -0.007738105302854054f, -0.01890242400450895f, -0.01251023409966308f, -0.050816829913869335f, -0.032666129054313715f, 0.04274655577331985f, 0.10491624039582026f, 0.0383177467925561f, -0.0177926796390087f },
+{ 0.003069340438429642f, 0.022579091477425296f, -0.009716133805837976f, -0.05785793388207741f, 0.02878732732144632f, -0.0047193745306318225f, 0.032399740170294615f, 0.04041667428124839f, 0.036046643437003534f, -0.012788114716009349f },
+{ -0.0010257195324953185f, 0.0193070963334318f, -0.0059356376909651155f, -0.04253439454109959f, 0.08748877802843529f, -0.006065303140381853f, 0.030325898618811686f, -0.05440229064910483f, 0.024286926250449488f, 0.03981729736163115f },
+{ 0.006355106159510451f, 0.005939127637129048f, -0.0010932415215827009f, -0.004589159378415013f, 0.031908885972074544f, -0.006177910500622481f, -0.006373254370519936f, -0.021061875237757304f, 0.01112789333465639f, 0.011812039597336442f },
+{ -0.015182712016355713f, 0.005285918054837325f, 0.0013351522157774378f, 0.01089459842916415f, 0.023609043494288672f, -0.008255591119434046f, 0.017136780209866854f, -0.02042034626562625f, 0.001579743116590503f, -0.013205609819020482f },
+{ 0.11609965933711577f, -0.08698390389901844f, -0.0560683021941947f, 0.13053504947292874f, -0.14727791811078003f, -0.14338461692336063f, 0.10264712721992798f, 0.07610711157407313f, 0.05661965557612394f, 0.07251429832422229f },
+{ -8.45416409658513E-4f, -0.019538626247749182f, -0.038472971478633204f, 0.0031762183730444284f, 0.01808830499623063f, -0.025319503239591153f, 0.017747131210688133f, 0.040271724168649686f, 0.025444079987997855f, -0.05455128375101337f },
+{ 0.02361700208269527f, -0.004081126174857151f, 0.0011422499528639144f, 0.011124481475806205f, 0.041871216376663536f, -0.0032814860577267775f, -0.007208390472968783f, -0.039296052854589356f, -0.008108116294322803f, -0.024188023730128738f },
+{ 0.039534480697049616f, -0.060657263409655035f, 0.05748004114866785f, -0.026166214867442802f, -0.00861413900570738f, 0.017796765552404583f, 0.018212214019588f, 0.009449971205882049f, -0.01171718523797754f, -0.034788286083695746f },
+{ -0.012106667960080775f, 0.008601473128192936f, 0.009630930906487872f, -0.015643059778724794f, -0.003530418500608266f, 0.012293853711978706f, 0.027791973579765327f, 0.011252500044631129f, -0.006082445742493794f, -0.026466375121041056f },
+{ 0.004973641923995686f, -0.006361273299048989f, -0.011277587023045358f, 0.009140167050562663f, 0.01742507457139264f, -0.0262278662793634f, -0.024904415557430455f, -0.0049367561548432975f, -9.731103447779181E-4f, 0.011622597502924962f },
+{ -0.004135080335125549f, 0.0024138874427330134f, 0.015089589511244806f, -0.0030412722640467977f, -0.005376752760342028f, 0.01844319310981006f, -0.0010889786420041703f, 0.010162033525387368f, 0.0026524777032716873f, -0.005287503692450534f },
+{ -0.004954605220361547f, -0.0210491413362851f, 0.02060973642286053f, -1.9916214577123668E-4f, -0.030202013588392203f, 0.013931348362329357f, 0.01878038652421018f, 0.014340422091744479f, -0.02810108155666564f, -0.018215284626305662f },
+{ 0.0030120396236851163f, -0.0029159405495063273f, -0.023809122771980423f, 0.01768270461812259f, 0.04534085461851701f, -0.010415952421544352f, -0.008518266562413668f, -0.013866139294926217f, -0.003582208102701355f, 0.012425839160853637f },
+{ 0.01695821075929556f, 0.0076659767974580715f, -0.006975054549573514f, 0.028392698580187437f, 0.03262406663296277f, -0.02731515129486595f, -0.008792045876266964f, -0.03838830942251978f, -0.0029956496763174356f, 0.01556146261786038f },
+{ 2.690317511354161E-5f, -0.015402887627657222f, 0.008351385487519417f, -0.0065722463221269825f, 0.01695948011519164f, -0.01630764119124968f, -0.010593626071828758f, -0.021386824439350815f, -0.018552119972678152f, 0.005302724936300302f },
+{ 0.002760936010399818f, 0.005585731318003578f, -0.030021925224763116f, 0.007518081241787709f, 0.052507459730911574f, -0.027022273794788654f, -0.021380657000896034f, -0.054821703766625436f, 0.00541214048507007f, 0.02107377663060061f },
+{ 0.04723702081390991f, -0.012147666170883465f, -0.023776070760864437f, -0.01190069931546985f, 0.04404330242793114f, -0.05415441097491194f, 0.026268346825079326f, 0.017475282980072858f, 0.04831694563078818f, -0.01249544951529552f },
+{ -0.009516490964473939f, -1.800786789004873E-4f, 0.022875643244684125f, -0.014598561572239883f, -0.030933761123882585f, 0.0017775412620795864f, 0.01633559048663159f, 0.0208499823195231f, 0.004894503493622408f, 0.008058310550027705f },
+{ 0.050184422527594585f, -0.04188835936167528f, 0.04141890694310477f, -6.747774869500273E-4f, 0.00571510292046436f, 0.00790437201167565f, -0.03363540368968065f, -0.001464326845892253f, -0.08730552773771615f, -0.0027744864385876454f },
+{ 0.012491907961257334f, -0.0022772354011028144f, -0.005246046320867922f, -0.001693222809104707f, -0.012337608033891764f, 0.005050493729902257f, -0.0019497703119608484f, 0.030991522089806198f, 0.006369770426139873f, 2.861594537056533E-5f },
+{ -0.010765707769086903f, 0.011134481556498346f, -0.002346484141790453f, 0.010643708017161864f, 0.008723416267974625f, -0.006023295128797275f, -0.006480733746193225f, 0.021335262698078693f, -0.008898453711022403f, 0.008704027665587734f },
+{ 0.008556293018015061f, -0.008883122328307683f, -0.020045091496421412f, 0.006136837783114052f, 0.036472413425289f, -0.014723327736050233f, -0.0030535846153034313f, -0.011339935591814279f, 0.01114723606357867f, 0.027182198360543763f },
+{ 0.009324551814569945f, -0.014678134466191314f, -0.030958057975256546f, 0.045423485324759025f, 0.03631041578456688f, -0.001822681105132236f, 0.01078893991648608f, 0.015916878275460955f, -0.02931026642420444f, -0.034890856268915985f },
+{ 0.014297150519117252f, -0.00963126263655162f, -0.02556207637166996f, 0.02565446235922708f, 0.03186153937590445f, -0.0017933846344855397f, 0.009698816297762326f, 0.004369486759225956f, 0.003736038002271094f, -0.021504966301406494f },
+{ 0.01663545840577068f, 0.025415107983945376f, -0.058466042974934594f, 0.046486036634745084f, 0.05940444395112718f, -0.038948038811474614f, -0.01913210542558135f, 0.07305798061717615f, -0.043485145261025114f, -0.03680083500699763f },
+{ 0.011470154218177092f, 0.026807005835922347f, -0.050759240987693015f, 0.026655818606255464f, 0.06689285808020294f, -0.031219191513035326f, -1.2393481262559444E-4f, 0.02119287902309382f, 0.00995636779427462f, -0.01727870689376319f },
+{ 0.006100583452223566f, -0.01072651607733812f, 0.020386669552908045f, 0.02081543285556571f, 0.002917443810111755f, 0.016042595478763216f, -0.005358500116647748f, 0.014669682805910465f, -0.03202705514195125f, -0.04307180392928457f },
+{ 0.0037876527149240244f, 0.014952197213882454f, -0.007857646545482162f, 0.023097542878360133f, 0.039713687931007456f, -0.005165534964188969f, 0.014680273346273818f, -0.009578054301273304f, -0.02254711102841318f, -0.007748106985958817f },
+{ -0.015771839345177934f, -0.005169230240728753f, 0.01510951073761424f, -0.06812862986795186f, -0.03223923177478206f, 0.024357888686116724f, 0.0276308694518213f, 0.05736568160389743f, 0.06678893813400488f, -0.018549492348155353f },
+{ -0.0219552844346757f, -0.011141244709694532f, -0.0201808377380287f, -0.0014740369755763662f, -0.011903434451252156f, -0.01984147830045078f, 0.04526784714918352f, 0.043632877471113274f, 0.024633433244835707f, -0.04444369061301263f },
+{ 0.027842366374054902f, -0.008452806986816195f, 0.01548706331903875f, 0.04881400482347889f, -0.05993889537328417f, -0.0025044212433036708f, -0.015590222019576805f, 0.028016471720934646f, -0.05324734936819617f, 0.003673469876937275f },
+{ 0.013055051916048699f, 0.009094909766656055f, -0.0083993260025553f, 0.029695431387706795f, 0.011773030708105243f, -0.00818886580303842f, -0.023742259807337733f, -0.007881665124961816f, -0.019237958636678102f, 0.005454813034051026f },
+{ -0.03609996598532243f, 0.01318846880043785f, -0.023829577400773978f, 0.091171132375838f, -0.15882416007249037f, -0.05823997484805806f, 0.0447333558521826f, -0.01984633641156258f, -0.14420982702454263f, 0.11954892129953074f },
+{ 0.017928823619213226f, 0.006620882406953765f, -0.011147701097508268f, -0.01875270463217827f, 0.015954061152537887f, -0.00938422619839412f, 0.010183162038171108f, 0.0017040569574482093f, -0.0207448411809026f, -0.020376216834583915f },
+{ 0.014335664192689586f, -0.021680984449420144f, 0.013855110008220699f, 0.008872439726411266f, -0.015065095159935931f, 0.0011846196114965334f, -0.006098742655996866f, 0.02163921834443445f, -0.025063818212494777f, -0.010933180541504226f },
+{ -0.01973839344082034f, -0.0247269465847832f, -0.009302281710806107f, -0.004514018684240761f, -9.75132707022354E-4f, -0.009642010838821194f, 7.675209679711996E-4f, -0.004467748458106224f, -0.017490056410611916f, -0.005290388934840604f },
+{ -0.08688802974323763f, -0.009686537559538692f, 0.009517800218072685f, -0.01767737323615942f, -0.05995125430501269f, -1.60152415303648E-4f, -0.09919273726793847f, -0.035017843927845876f, 0.055726308406360704f, 0.015142041833911163f },
+{ 0.0059791227754558505f, -0.0533262326710801f, 0.03598004930212695f, 0.020367357250106268f, -0.08151154245882902f, 0.02988030386882419f, -0.022344213599138192f, 0.03402558828721089f, -0.0386463366259731f, -0.013111302539925707f },
+{ 0.032857414571014314f, -0.03296665357900031f, 0.0278944372119477f, 0.016702047332620727f, -0.09165700686256627f, -0.0036173521515570537f, -0.02964247930329852f, 0.01382254179622448f, 0.010180588058663526f, 0.019733707569327703f },
+{ -4.792129854691438E-4f, -0.011445314714753988f, 0.01711749479725804f, 0.011545393854788389f, -4.306310678758368E-4f, -0.007553963576877576f, 0.005774321706968524f, -0.003789618662923445f, -0.011939758213620519f, -0.0028307481663355383f },
+{ 0.09671316528662552f, 0.014081060552730104f, 0.02604948527743548f, 0.04415731282791977f, 0.019063583792903748f, 0.004225112521388514f, 0.03286067964858169f, 0.03087628387017154f, 0.021692655593799823f, -0.059804615071219834f },
+{ 0.01103292023945677f, -0.016153564740548777f, 0.02760601004102232f, 0.00979023936103867f, -0.007538785996757565f, -1.3070815912463518E-4f, -0.004758054763369954f, 0.021151781420047495f, 0.0013627001458126967f, -0.031195495725176582f },
+{ -0.006872495832354018f, 0.0468482726324724f, -0.02397302473440738f, -0.014763266415856747f, 0.02858737757863789f, 0.01447109868071487f, 0.022421777784781233f, 0.003092419859283136f, -0.011891109078844915f, -0.0761073996833526f },
+{ 0.006373017335814568f, 0.03297573789726434f, -0.022948412837680968f, -0.019274872922009047f, 0.02697542468446129f, 0.002811143920587561f, 0.022788768951136143f, -0.04036992922493371f, -0.009180484245250345f, -0.028799927378028757f },
+{ 0.03853375294363078f, 0.0021663723758837683f, -0.032350985228418026f, 0.02881438735858928f, 0.06997708577464909f, -0.027254112560896843f, -0.018281980087375128f, -0.03673062026049352f, 0.013184162949343109f, -0.012793291153511837f },
+{ 0.03859953666204028f, 0.08081278982124143f, -0.06467574868719168f, -0.023089186970671027f, 0.02828101396628386f, -0.03323578756753279f, 0.006853903947805181f, -0.041759094661105514f, -0.03998452848196925f, -0.09396851936715626f },
+{ 0.00515929294867703f, 0.007404278689017491f, -0.0021636615445353113f, 0.008425585477616815f, 0.015253070806223014f, -0.019720189092472994f, 0.007060888853169973f, -0.003931665668402699f, -0.014705611862509722f, -0.02900701192250452f },
+{ 0.008423336000244868f, -0.008254546961383637f, -0.012698650812726165f, 0.029424413844610843f, 0.012674752722737931f, -0.0036671001084909727f, 0.003500118863334283f, 0.016660208343364406f, -0.021631342460905416f, -0.02916728624677752f },
+{ -0.006707254538108169f, -0.00728299035381591f, 0.03723906050195113f, -0.015283322582180148f, -0.032063470412445394f, 0.021606705284915265f, 0.021483385170286397f, 0.02811660414345276f, 0.017858425833247687f, -0.029348584723309357f },
+{ 0.09313801398524427f, -0.06404052818573194f, 0.07291477207002235f, 0.0753142888510784f, -0.21143944320665106f, -0.03706817144471337f, -0.04469483770330234f, 0.04106655489497419f, -0.13843563025571423f, 0.02510250043874238f },
+{ 0.0397332510316756f, -0.047807316599654245f, 0.02244952836698948f, 0.04662975750468641f, -0.09844390959669579f, 0.014375331578950972f, -0.07256196297509064f, 0.04164021552781526f, -0.049641903364084146f, -0.008558086982656482f },
+{ 0.0033443978182418534f, -0.016538053208651576f, 0.0026537034500360873f, 0.024796118338759447f, -0.027133120466805705f, 0.02006292582291959f, -0.10110522286712419f, -0.04562046546910964f, 0.02602052483839502f, 0.04867723528406327f },
+{ -0.015894703560071534f, -0.027794957641038714f, 0.02321185433897546f, -0.009293355001046036f, -0.030680954480488545f, -0.0010755735180553888f, 0.011117541301909234f, 0.026457383672191075f, -0.0055403348407656846f, -0.017127074478294358f },
+{ 6.284055229017769E-5f, -0.005521001938335954f, 0.014301304143669355f, 0.012745545520702473f, -0.016355650652220215f, 0.0015556949590170908f, -0.013441646267349446f, -0.0045408472596189554f, -0.023669389405907626f, -0.010502856345056455f },
+{ -0.08838914159107095f, 0.05732174754079283f, -0.02972017322323669f, -0.024520668745304983f, -0.004883081809190008f, -0.036810453844272895f, 0.03952168764457172f, -0.09727722552877639f, 0.04505748989606172f, -0.061032136484662686f },
+{ -0.012482966682779262f, 0.04775935373831752f, -0.023439492553671268f, -0.012175535364040993f, 0.027333793095203025f, 0.04331214324014983f, -0.0019834482596528535f, -0.06795680697289246f, -0.008272355490095105f, 0.01095435170212811f },
+{ 0.012349097132729211f, -0.007242017953107695f, -6.913977846708884E-4f, 0.006369268251175132f, 0.008613219461910555f, 0.013038739578026471f, -0.012450287331938857f, 0.0019950321486177742f, 0.02491166352294703f, -0.04012658741828331f },
+{ -0.003098705420227344f, 0.04364816591201731f, -0.02451048721222357f, 0.01973850755734506f, 0.10973822039754312f, 0.032487535336662945f, -0.02033835902344322f, -0.06273402578151283f, -0.023065217603188175f, -0.008224273968678687f },
+{ 0.03593777184361465f, 0.00674751412309899f, -0.011689725624841623f, 0.02352411645531956f, 0.06993368848210121f, -0.009896553650456214f, 0.022075375623829312f, -0.0627918937328849f, 0.0030251840663723575f, -0.006982740497124705f },
+{ -0.018029066497269364f, 0.03558306679750781f, 0.003277672378362499f, -0.020712570019522734f, 0.0777837740091793f, 0.023504265669166708f, -0.035362555024198425f, -0.04577227835884515f, 0.05765136350325522f, -0.0325869792611031f },
+{ -0.07206218049475499f, 0.008403647391296865f, -0.042878929881304075f, -0.009344597513810653f, -0.034780901514336306f, 0.01420778750097662f, -0.009522991408256366f, -0.04303803431673745f, 0.009015396279129615f, 0.01074967099051194f },
+{ 0.017038388166311536f, -0.023982761662635414f, -0.026607943204655322f, 0.037364318174103905f, -0.07903161666650071f, -0.04100305185991189f, -0.00488931505837586f, 0.06383516912947433f, 0.025883248032640818f, 0.02879304814164521f },
+{ 0.0031795229073172506f, 0.015949667131270738f, -0.011576313297684394f, 0.03476540845627064f, 0.11472419174876858f, -0.04136655647067052f, -0.036923108682718836f, -0.05029449430330976f, 0.026109200668082623f, -0.01440936057532122f },
+{ 0.0010161727452088125f, -0.011790234065643293f, -0.004495829109581603f, 0.006849873488671323f, 0.023747277845819325f, -0.00567641852982104f, -0.015700880972175108f, 0.003948878987796451f, 0.014367887858613574f, -0.00948797187675249f },
+{ -0.00501393941025873f, 0.0368193561798138f, -0.016250504758862677f, -0.027158909295982303f, 0.05966463390415463f, 0.034355808731374886f, -0.011577825505483263f, -0.0231378204286109f, 0.08835252451090408f, -0.036234864380648775f },
+{ -0.05430874842571148f, -0.032587527295320856f, -0.1001429476896952f, 0.04773008246684643f, -0.08402527162074135f, 0.07184036769939783f, -0.03045710434761287f, -0.050634046410796954f, 0.009621361608629279f, -0.0775916279670066f },
+{ -0.01070530565123099f, 0.0031454879321807473f, 0.029961066422747592f, -0.02482632689927538f, -0.027096833347118442f, 0.004465984589715102f, -0.024312672727020486f, 0.024645596605080453f, 0.027415525873488455f, -0.0409646703510157f },
+{ -0.060205360665940524f, 0.03538084989390739f, -0.04652593021634307f, 0.05400340925329256f, 0.09036245077780773f, -4.466175973478091E-4f, -0.07343682223404417f, -0.05277989635686954f, -0.04420876682749448f, -0.009523284208277185f },
+{ -0.011273760975035843f, 0.0011580240049802004f, 0.0011426824100225232f, -0.008006521229789744f, 0.012438382849686971f, 0.007908795695616326f, -0.012639128130147096f, -0.020104404570867825f, -0.010951710249942263f, 0.024959848995525977f },
+{ -0.03218451496844622f, 0.03359836487667367f, -0.039485994879582466f, 7.874839334810385E-4f, 0.044079529832159965f, 0.010136623500984345f, -0.01777510068065101f, -0.076284110475925f, -0.004894332607447194f, 0.006294829580665473f },
+};
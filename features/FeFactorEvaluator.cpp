@@ -0,0 +1,169 @@
+//----------------------------------------------------------------------------
+/** @file FeFactorEvaluator.cpp
+    See FeFactorEvaluator.h */
+//----------------------------------------------------------------------------
+
+#include "SgSystem.h"
+#include "FeFactorEvaluator.h"
+
+#include <algorithm>
+#include "FeFeatureWeights.h"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define FE_FACTOR_AVX 1
+#elif defined(__SSE__)
+#include <xmmintrin.h>
+#define FE_FACTOR_SSE 1
+#endif
+
+//----------------------------------------------------------------------------
+
+namespace {
+
+/** Number of floats processed by one instruction of the kernel. */
+#if defined(FE_FACTOR_AVX)
+const std::size_t SIMD_WIDTH = 8;
+#elif defined(FE_FACTOR_SSE)
+const std::size_t SIMD_WIDTH = 4;
+#else
+const std::size_t SIMD_WIDTH = 1;
+#endif
+
+} // namespace
+
+//----------------------------------------------------------------------------
+
+const std::size_t FeFactorEvaluator::ALIGNMENT;
+
+FeFactorEvaluator::FeFactorEvaluator()
+    : m_nuFeatures(0),
+      m_k(0),
+      m_stride(0)
+{
+    Allocate();
+}
+
+FeFactorEvaluator::FeFactorEvaluator(const FeFeatureWeights& weights)
+    : m_nuFeatures(weights.m_w.size()),
+      m_k(weights.m_k),
+      m_stride((weights.m_k + SIMD_WIDTH - 1) / SIMD_WIDTH * SIMD_WIDTH),
+      m_w(weights.m_w)
+{
+    Allocate();
+    for (std::size_t k = 0; k < m_k; ++k)
+    {
+        SG_ASSERT(weights.m_v[k].size() == m_nuFeatures);
+        for (std::size_t i = 0; i < m_nuFeatures; ++i)
+            m_v[i * m_stride + k] = weights.m_v[k][i];
+    }
+}
+
+FeFactorEvaluator::FeFactorEvaluator(const FeFactorEvaluator& evaluator)
+    : m_nuFeatures(evaluator.m_nuFeatures),
+      m_k(evaluator.m_k),
+      m_stride(evaluator.m_stride),
+      m_w(evaluator.m_w)
+{
+    Allocate();
+    std::copy(evaluator.m_v, evaluator.m_v + m_nuFeatures * m_stride, m_v);
+}
+
+FeFactorEvaluator&
+FeFactorEvaluator::operator=(const FeFactorEvaluator& evaluator)
+{
+    if (this != &evaluator)
+    {
+        m_nuFeatures = evaluator.m_nuFeatures;
+        m_k = evaluator.m_k;
+        m_stride = evaluator.m_stride;
+        m_w = evaluator.m_w;
+        Allocate();
+        std::copy(evaluator.m_v, evaluator.m_v + m_nuFeatures * m_stride,
+                  m_v);
+    }
+    return *this;
+}
+
+/** Allocate the zero-initialized factor matrix and align its start.
+    The storage of a std::vector is aligned at least to sizeof(float), so the
+    aligned start is a whole number of floats from the beginning. */
+void FeFactorEvaluator::Allocate()
+{
+    const std::size_t padding = ALIGNMENT / sizeof(float);
+    m_storage.assign(m_nuFeatures * m_stride + padding, 0.f);
+    float* start = &m_storage[0];
+    const std::size_t misalignment =
+        reinterpret_cast<std::size_t>(start) % ALIGNMENT;
+    if (misalignment != 0)
+        start += (ALIGNMENT - misalignment) / sizeof(float);
+    m_v = start;
+}
+
+float FeFactorEvaluator::Evaluate(const int* active,
+                                  std::size_t nuActive) const
+{
+    float linear = 0;
+    for (std::size_t a = 0; a < nuActive; ++a)
+        if (static_cast<std::size_t>(active[a]) < m_nuFeatures)
+            linear += m_w[active[a]];
+    // Twice the sum of the pairwise interactions
+    float interactions = 0;
+    for (std::size_t c = 0; c < m_stride; c += SIMD_WIDTH)
+    {
+#if defined(FE_FACTOR_AVX)
+        __m256 sum = _mm256_setzero_ps();
+        __m256 sumSquares = _mm256_setzero_ps();
+        for (std::size_t a = 0; a < nuActive; ++a)
+            if (static_cast<std::size_t>(active[a]) < m_nuFeatures)
+            {
+                const __m256 v = _mm256_load_ps(Row(active[a]) + c);
+                sum = _mm256_add_ps(sum, v);
+                sumSquares = _mm256_add_ps(sumSquares, _mm256_mul_ps(v, v));
+            }
+        float d[SIMD_WIDTH];
+        _mm256_storeu_ps(d, _mm256_sub_ps(_mm256_mul_ps(sum, sum),
+                                          sumSquares));
+        interactions += ((d[0] + d[1]) + (d[2] + d[3]))
+                      + ((d[4] + d[5]) + (d[6] + d[7]));
+#elif defined(FE_FACTOR_SSE)
+        __m128 sum = _mm_setzero_ps();
+        __m128 sumSquares = _mm_setzero_ps();
+        for (std::size_t a = 0; a < nuActive; ++a)
+            if (static_cast<std::size_t>(active[a]) < m_nuFeatures)
+            {
+                const __m128 v = _mm_load_ps(Row(active[a]) + c);
+                sum = _mm_add_ps(sum, v);
+                sumSquares = _mm_add_ps(sumSquares, _mm_mul_ps(v, v));
+            }
+        float d[SIMD_WIDTH];
+        _mm_storeu_ps(d, _mm_sub_ps(_mm_mul_ps(sum, sum), sumSquares));
+        interactions += (d[0] + d[1]) + (d[2] + d[3]);
+#else
+        float sum = 0;
+        float sumSquares = 0;
+        for (std::size_t a = 0; a < nuActive; ++a)
+            if (static_cast<std::size_t>(active[a]) < m_nuFeatures)
+            {
+                const float v = Row(active[a])[c];
+                sum += v;
+                sumSquares += v * v;
+            }
+        interactions += sum * sum - sumSquares;
+#endif
+    }
+    return linear + 0.5f * interactions;
+}
+
+const char* FeFactorEvaluator::KernelName()
+{
+#if defined(FE_FACTOR_AVX)
+    return "avx";
+#elif defined(FE_FACTOR_SSE)
+    return "sse";
+#else
+    return "scalar";
+#endif
+}
+
+//----------------------------------------------------------------------------
@@ -0,0 +1,107 @@
+//----------------------------------------------------------------------------
+/** @file FeFactorEvaluator.h
+    Fast evaluation of active features with the factorization machine model
+    of FeFeatureWeights. */
+//----------------------------------------------------------------------------
+
+#ifndef FE_FACTOR_EVALUATOR_H
+#define FE_FACTOR_EVALUATOR_H
+
+#include <cstddef>
+#include <vector>
+
+class FeFeatureWeights;
+
+//----------------------------------------------------------------------------
+
+/** Evaluates a list of active features with the weights of a
+    FeFeatureWeights in O(nuActive * k) instead of O(nuActive^2 * k).
+    Uses the identity for the sum of the pairwise interactions of the
+    factorization machine:
+    sum_{a<b} <v_a, v_b> = 1/2 sum_f ((sum_a v_af)^2 - sum_a v_af^2).
+
+    The latent factors are stored feature-major: the k factors of a feature
+    are contiguous and padded with zeros to a multiple of the SIMD width, and
+    each row is aligned to ALIGNMENT bytes. The kernel uses AVX or SSE, if
+    the compiler targets it (__AVX__, __SSE__), and a scalar loop otherwise.
+    The result differs from FeFeatures::EvaluateActiveFeatures() only by
+    rounding, because the sums are computed in a different order.
+
+    Features with an ID that is not smaller than FeFeatureWeights::m_w.size()
+    are ignored, like in FeFeatureWeights::Combine(). */
+class FeFactorEvaluator
+{
+public:
+    /** Alignment of the rows of the factor matrix in bytes. */
+    static const std::size_t ALIGNMENT = 32;
+
+    /** Construct an evaluator for empty weights (evaluates to 0). */
+    FeFactorEvaluator();
+
+    explicit FeFactorEvaluator(const FeFeatureWeights& weights);
+
+    FeFactorEvaluator(const FeFactorEvaluator& evaluator);
+
+    FeFactorEvaluator& operator=(const FeFactorEvaluator& evaluator);
+
+    /** Evaluate a list of active features.
+        @param active Array of feature IDs
+        @param nuActive Number of features in active */
+    float Evaluate(const int* active, std::size_t nuActive) const;
+
+    /** Number of factors per feature. */
+    std::size_t K() const;
+
+    std::size_t NuFeatures() const;
+
+    /** Number of floats per row of the factor matrix (K() rounded up to a
+        multiple of the SIMD width). */
+    std::size_t Stride() const;
+
+    /** Name of the kernel selected at compile time ("avx", "sse" or
+        "scalar"). */
+    static const char* KernelName();
+
+private:
+    std::size_t m_nuFeatures;
+
+    std::size_t m_k;
+
+    std::size_t m_stride;
+
+    std::vector<float> m_w;
+
+    /** Storage of the factor matrix, with room for the alignment. */
+    std::vector<float> m_storage;
+
+    /** Aligned start of the factor matrix in m_storage. */
+    float* m_v;
+
+    void Allocate();
+
+    const float* Row(int feature) const;
+};
+
+inline std::size_t FeFactorEvaluator::K() const
+{
+    return m_k;
+}
+
+inline std::size_t FeFactorEvaluator::NuFeatures() const
+{
+    return m_nuFeatures;
+}
+
+inline const float* FeFactorEvaluator::Row(int feature) const
+{
+    return m_v + static_cast<std::size_t>(feature) * m_stride;
+}
+
+inline std::size_t FeFactorEvaluator::Stride() const
+{
+    return m_stride;
+}
+
+//----------------------------------------------------------------------------
+
+#endif // FE_FACTOR_EVALUATOR_H
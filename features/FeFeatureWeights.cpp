@@ -6,11 +6,9 @@
 #include "FeFeatureWeights.h"
 
 #include <iostream>
-#include <sstream>
 #include <string>
 #include "FeBasicFeatures.h"
 #include "FeData.h"
-#include "SgDebug.h"
 #include "SgException.h"
 
 //----------------------------------------------------------------------------
@@ -106,18 +104,18 @@ FeFeatureWeights FeFeatureWeights::Read(std::istream& stream)
 
 FeFeatureWeights FeFeatureWeights::ReadDefaultWeights()
 {
-    try
+    FeFeatureWeights f(MAX_FEATURE_INDEX, gFeatureDataK);
+    for (size_t i = 0; i < gFeatureDataNuFeatures; ++i)
     {
-        std::istringstream in(gFeatureData);
-        if (! in)
-            throw SgException("Cannot open gFeatureData");
-        return FeFeatureWeights::Read(in);
-    }
-    catch (const SgException& e)
-    {
-        SgDebug() << "Loading gFeatureData failed: " << e.what();
+        const size_t index = gFeatureDataID[i];
+        SG_ASSERT(index < MAX_FEATURE_INDEX);
+        f.m_minID = std::min(f.m_minID, index);
+        f.m_maxID = std::max(f.m_maxID, index);
+        f.m_w[index] = gFeatureDataW[i];
+        for (size_t j = 0; j < gFeatureDataK; ++j)
+            f.m_v[j][index] = gFeatureDataV[i][j];
     }
-    return FeFeatureWeights(0, 0);
+    return f;
 }
 
 //----------------------------------------------------------------------------
@@ -31,7 +31,9 @@ public:
     /** Read features in the format produced by Wistuba's tool. */
     static FeFeatureWeights Read(std::istream& stream);
 
-    /** Read weights from auto-generated string in FeData.h */
+    /** Get the default weights from the auto-generated arrays in
+        FeData.h. The arrays are compiled into the program, so this only
+        copies them and does not parse any text. */
     static FeFeatureWeights ReadDefaultWeights();
 
     size_t m_nuFeatures;
@@ -8,6 +8,8 @@
 #include <boost/test/auto_unit_test.hpp>
 #include "FeBasicFeatures.h"
 
+#include <cstdlib>
+#include <limits>
 #include <sstream>
 #include "GoBoard.h"
 #include "GoSetupUtil.h"
@@ -1012,6 +1014,41 @@ BOOST_AUTO_TEST_CASE(FeBasicFeaturesTest_ClosestStone)
     }
 }
 
+/** Compare the closest stone features of all points on a large board with
+    the distances computed by a loop over all stones. */
+BOOST_AUTO_TEST_CASE(FeBasicFeaturesTest_ClosestStone_AllPoints)
+{
+    GoBoard bd(19);
+    bd.Play(Pt(4, 4), SG_BLACK);
+    bd.Play(Pt(16, 17), SG_WHITE);
+    bd.Play(Pt(17, 3), SG_BLACK);
+    bd.Play(Pt(10, 10), SG_WHITE);
+    bd.Play(Pt(3, 16), SG_BLACK);
+    bd.Play(Pt(1, 19), SG_WHITE);
+    FeFullBoardFeatures f(bd);
+    f.FindAllFeatures();
+    for (GoPointList::Iterator it(f.LegalMoves()); it; ++it)
+        for (SgBWIterator itColor; itColor; ++itColor)
+        {
+            int expected = std::numeric_limits<int>::max();
+            for (GoBoard::Iterator it2(bd); it2; ++it2)
+                if (bd.IsColor(*it2, *itColor))
+                {
+                    const int dx = std::abs(SgPointUtil::Col(*it)
+                                            - SgPointUtil::Col(*it2));
+                    const int dy = std::abs(SgPointUtil::Row(*it)
+                                            - SgPointUtil::Row(*it2));
+                    expected = std::min(expected,
+                                        dx + dy + std::max(dx, dy));
+                }
+            expected = std::min(expected, MAX_CLOSEST_DISTANCE);
+            const FeBasicFeature base = (*itColor == bd.ToPlay()) ?
+                FE_DIST_CLOSEST_OWN_STONE_2 : FE_DIST_CLOSEST_OPP_STONE_2;
+            const int feature = static_cast<int>(base) + expected - 2;
+            BOOST_CHECK(f.BasicFeatures(*it).test(feature));
+        }
+}
+
 BOOST_AUTO_TEST_CASE(FeBasicFeaturesTest_FeEvalDetail)
 {
     const double eps = 1.0e-5;
@@ -0,0 +1,98 @@
+//----------------------------------------------------------------------------
+/** @file FeFactorEvaluatorTest.cpp
+    Unit tests for FeFactorEvaluator. */
+//----------------------------------------------------------------------------
+
+#include "SgSystem.h"
+
+#include <boost/test/auto_unit_test.hpp>
+#include "FeFactorEvaluator.h"
+
+#include <cmath>
+#include "FeBasicFeatures.h"
+#include "FeFeatureWeights.h"
+#include "GoBoard.h"
+#include "SgRandom.h"
+
+using SgPointUtil::Pt;
+
+//----------------------------------------------------------------------------
+
+namespace {
+
+/** Check that the evaluator gives the same value as the pairwise evaluation
+    FeFeatures::EvaluateActiveFeatures(), up to rounding. */
+void CheckEvaluate(const FeFeatureWeights& weights,
+                   const FeFactorEvaluator& evaluator,
+                   const FeActiveArray& active, size_t nuActive)
+{
+    const float expected =
+        FeFeatures::EvaluateActiveFeatures(active, nuActive, weights);
+    const float value = evaluator.Evaluate(active.data(), nuActive);
+    BOOST_CHECK_SMALL(value - expected,
+                      1e-4f * std::max(1.f, std::fabs(expected)));
+}
+
+BOOST_AUTO_TEST_CASE(FeFactorEvaluatorTest_Empty)
+{
+    FeFactorEvaluator evaluator;
+    FeActiveArray active;
+    active[0] = 5;
+    BOOST_CHECK_EQUAL(evaluator.Evaluate(active.data(), 1), 0.f);
+    BOOST_CHECK_EQUAL(evaluator.Evaluate(active.data(), 0), 0.f);
+}
+
+BOOST_AUTO_TEST_CASE(FeFactorEvaluatorTest_Layout)
+{
+    FeFeatureWeights weights(FeFeatureWeights::MAX_FEATURE_INDEX, 10);
+    FeFactorEvaluator evaluator(weights);
+    BOOST_CHECK_EQUAL(evaluator.K(), 10u);
+    BOOST_CHECK_EQUAL(evaluator.NuFeatures(),
+                      FeFeatureWeights::MAX_FEATURE_INDEX);
+    BOOST_CHECK(evaluator.Stride() >= 10u);
+    BOOST_CHECK(evaluator.Stride() <= 16u);
+}
+
+BOOST_AUTO_TEST_CASE(FeFactorEvaluatorTest_Random)
+{
+    SgRandom random;
+    FeFeatureWeights weights(FeFeatureWeights::MAX_FEATURE_INDEX, 10);
+    for (size_t i = 0; i < weights.m_nuFeatures; ++i)
+    {
+        weights.m_w[i] = random.Float(2.f) - 1.f;
+        for (size_t k = 0; k < weights.m_k; ++k)
+            weights.m_v[k][i] = random.Float(2.f) - 1.f;
+    }
+    const FeFactorEvaluator evaluator(weights);
+    const FeFactorEvaluator copy(evaluator);
+    FeActiveArray active;
+    for (int n = 0; n < 100; ++n)
+    {
+        const size_t nuActive = random.Int(MAX_ACTIVE_LENGTH + 1);
+        for (size_t i = 0; i < nuActive; ++i)
+            active[i] = random.Int(static_cast<int>(weights.m_nuFeatures));
+        CheckEvaluate(weights, evaluator, active, nuActive);
+        CheckEvaluate(weights, copy, active, nuActive);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(FeFactorEvaluatorTest_DefaultWeights)
+{
+    const FeFeatureWeights weights = FeFeatureWeights::ReadDefaultWeights();
+    const FeFactorEvaluator evaluator(weights);
+    GoBoard bd(9);
+    bd.Play(Pt(5, 5), SG_BLACK);
+    bd.Play(Pt(3, 4), SG_WHITE);
+    bd.Play(Pt(4, 4), SG_BLACK);
+    FeFullBoardFeatures features(bd);
+    features.FindAllFeatures();
+    const GoEvalArray<float> expected = features.EvaluateFeatures(weights);
+    const GoEvalArray<float> eval = features.EvaluateFeatures(evaluator);
+    for (GoPointList::Iterator it(features.LegalMoves()); it; ++it)
+        BOOST_CHECK_SMALL(eval[*it] - expected[*it],
+                          1e-4f * std::max(1.f, std::fabs(expected[*it])));
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------
@@ -0,0 +1,59 @@
+//----------------------------------------------------------------------------
+/** @file FeFeatureWeightsTest.cpp
+    Unit tests for FeFeatureWeights. */
+//----------------------------------------------------------------------------
+
+#include "SgSystem.h"
+
+#include <boost/test/auto_unit_test.hpp>
+#include "FeFeatureWeights.h"
+
+#include <sstream>
+
+//----------------------------------------------------------------------------
+
+namespace {
+
+BOOST_AUTO_TEST_CASE(FeFeatureWeightsTest_Read)
+{
+    std::istringstream in("size:2,k:2 "
+                          "7,0.5 "
+                          "3,-0.25 "
+                          "3,1,2 "
+                          "7,-1,0.5 ");
+    const FeFeatureWeights w = FeFeatureWeights::Read(in);
+    BOOST_CHECK_EQUAL(w.m_k, 2u);
+    BOOST_CHECK_EQUAL(w.m_nuFeatures, FeFeatureWeights::MAX_FEATURE_INDEX);
+    BOOST_CHECK_EQUAL(w.m_minID, 3u);
+    BOOST_CHECK_EQUAL(w.m_maxID, 7u);
+    BOOST_CHECK_EQUAL(w.m_w[7], 0.5f);
+    BOOST_CHECK_EQUAL(w.m_w[3], -0.25f);
+    BOOST_CHECK_EQUAL(w.m_w[0], 0.f);
+    BOOST_CHECK_EQUAL(w.m_v[0][3], 1.f);
+    BOOST_CHECK_EQUAL(w.m_v[1][3], 2.f);
+    BOOST_CHECK_EQUAL(w.m_v[0][7], -1.f);
+    BOOST_CHECK_EQUAL(w.m_v[1][7], 0.5f);
+    BOOST_CHECK_EQUAL(w.Combine(3, 7), 0.f);
+    BOOST_CHECK_EQUAL(w.Combine(3, 3), 5.f);
+}
+
+/** Check some values of the arrays in FeData.h against the model file they
+    were generated from. */
+BOOST_AUTO_TEST_CASE(FeFeatureWeightsTest_ReadDefaultWeights)
+{
+    const FeFeatureWeights w = FeFeatureWeights::ReadDefaultWeights();
+    BOOST_CHECK(w.IsAllocated());
+    BOOST_CHECK_EQUAL(w.m_k, 10u);
+    BOOST_CHECK_EQUAL(w.m_nuFeatures, FeFeatureWeights::MAX_FEATURE_INDEX);
+    BOOST_CHECK_EQUAL(w.m_minID, 0u);
+    BOOST_CHECK_EQUAL(w.m_maxID, 2153u);
+    BOOST_CHECK_EQUAL(w.m_w[0], -0.043992401778103436f);
+    BOOST_CHECK_EQUAL(w.m_w[47], -7.905203478286436E-4f);
+    BOOST_CHECK_EQUAL(w.m_v[0][0], 0.004840715912585551f);
+    BOOST_CHECK_EQUAL(w.m_v[9][1], 0.008645858843534674f);
+    BOOST_CHECK_EQUAL(w.m_v[9][1931], -0.0409646703510157f);
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------
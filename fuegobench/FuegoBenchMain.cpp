@@ -0,0 +1,507 @@
+//----------------------------------------------------------------------------
+/** @file FuegoBenchMain.cpp
+    Main function for FuegoBench.
+    Throughput benchmarks for the playout and search hot paths on fixed
+    positions from regression/sgf. Each result is written as one line with
+    the tab-separated fields benchmark name, position, value and unit, so
+    that the output of different builds can be compared by scripts. */
+//----------------------------------------------------------------------------
+
+#include "SgSystem.h"
+
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <vector>
+#include <boost/filesystem/path.hpp>
+#include <boost/program_options/options_description.hpp>
+#include <boost/program_options/cmdline.hpp>
+#include <boost/program_options/variables_map.hpp>
+#include <boost/program_options/parsers.hpp>
+#include "FeBasicFeatures.h"
+#include "FeFactorEvaluator.h"
+#include "FeFeatureWeights.h"
+#include "GoGame.h"
+#include "GoInit.h"
+#include "GoNodeUtil.h"
+#include "GoSetup.h"
+#include "GoUctBoard.h"
+#include "GoUctGlobalSearch.h"
+#include "GoUctPatterns.h"
+#include "GoUctPlayoutPolicy.h"
+#include "SgDebug.h"
+#include "SgException.h"
+#include "SgGameReader.h"
+#include "SgInit.h"
+#include "SgRandom.h"
+#include "SgTime.h"
+
+using boost::filesystem::path;
+using std::string;
+using std::vector;
+namespace po = boost::program_options;
+
+//----------------------------------------------------------------------------
+
+namespace {
+
+typedef GoUctGlobalSearch<GoUctPlayoutPolicy<GoUctBoard>,
+                          GoUctPlayoutPolicyFactory<GoUctBoard> >
+                          GlobalSearch;
+
+/** @name Settings from command line options */
+// @{
+
+double g_duration;
+
+int g_maxThreads;
+
+int g_srand;
+
+SgUctValue g_searchGames;
+
+string g_sgfDir;
+
+bool g_verbose;
+
+// @} // @name
+
+/** Stream buffer that discards all output.
+    Used instead of SgDebugToNull(), which makes SgDebug() fail on the
+    first write in builds with assertions. */
+class NullBuffer
+    : public std::streambuf
+{
+protected:
+    int overflow(int c)
+    {
+        return c;
+    }
+};
+
+/** A fixed benchmark position. */
+struct Position
+{
+    /** Name used in the output. */
+    const char* m_name;
+
+    /** File name relative to the sgf directory. */
+    const char* m_file;
+
+    /** Move number as in the GTP command loadsgf. */
+    int m_moveNumber;
+};
+
+const Position POSITIONS[] = {
+    { "9x9", "games/2009/CGOS/702960.sgf", 20 },
+    { "13x13", "games/2014/2014-10-22-Fuego-sacrifice2-bug.sgf", 40 },
+    { "19x19", "games/2014/Fuego-GnuGo-2014-10-26.sgf", 100 }
+};
+
+const int NU_POSITIONS = sizeof(POSITIONS) / sizeof(POSITIONS[0]);
+
+/** Wall clock time.
+    Used for all measurements, CPU time would add up the time of all threads
+    in the search benchmark. */
+double Time()
+{
+    return SgTime::Get(SG_TIME_REAL);
+}
+
+path GetSgfDir()
+{
+    if (! g_sgfDir.empty())
+        return path(g_sgfDir);
+    #ifdef ABS_TOP_SRCDIR
+        return path(ABS_TOP_SRCDIR) / "regression" / "sgf";
+    #else
+        return path("regression") / "sgf";
+    #endif
+}
+
+/** Load a position into a board.
+    Only the stones, the color to play and the komi are used; the history
+    of the game is not needed by the benchmarks. */
+void LoadPosition(const Position& position, GoBoard& bd)
+{
+    const string fileName = (GetSgfDir() / position.m_file).string();
+    std::ifstream in(fileName.c_str());
+    if (! in)
+        throw SgException("could not open " + fileName);
+    SgGameReader reader(in);
+    SgNode* root = reader.ReadGame();
+    if (root == 0)
+        throw SgException("no game in " + fileName);
+    GoGame game;
+    game.Init(root);
+    if (! GoGameUtil::GotoBeforeMove(&game, position.m_moveNumber))
+        throw SgException("invalid move number for " + fileName);
+    const GoBoard& gameBd = game.Board();
+    GoSetup setup;
+    setup.m_player = gameBd.ToPlay();
+    for (GoBoard::Iterator it(gameBd); it; ++it)
+        if (gameBd.Occupied(*it))
+            setup.m_stones[gameBd.GetStone(*it)].Include(*it);
+    GoRules rules;
+    rules.SetKomi(GoNodeUtil::GetKomi(game.CurrentNode()));
+    bd.Init(gameBd.Size(), rules, setup);
+}
+
+void WriteResult(const string& benchmark, const Position& position,
+                 double value, const string& unit)
+{
+    std::ostringstream line;
+    line.setf(std::ios::fixed);
+    line.precision(1);
+    line << benchmark << '\t' << position.m_name << '\t' << value << '\t'
+         << unit << '\n';
+    std::cout << line.str() << std::flush;
+}
+
+/** Play one playout with the policy from the current board position.
+    Same termination as in GoUctGlobalSearchState: the game ends after two
+    passes in a row or after a maximum length.
+    @param[out] moves Optional list of the moves played */
+int PlayPlayout(GoUctBoard& bd, GoUctPlayoutPolicy<GoUctBoard>& policy,
+                vector<SgPoint>* moves)
+{
+    const int maxLength = 3 * bd.Size() * bd.Size();
+    int nuPasses = 0;
+    int length = 0;
+    policy.StartPlayout();
+    while (nuPasses < 2 && length < maxLength)
+    {
+        const SgPoint move = policy.GenerateMove();
+        SG_ASSERT(move != SG_NULLMOVE);
+        nuPasses = (move == SG_PASS ? nuPasses + 1 : 0);
+        bd.Play(move);
+        policy.OnPlay();
+        if (moves != 0)
+            moves->push_back(move);
+        ++length;
+    }
+    policy.EndPlayout();
+    return length;
+}
+
+/** Rate of GoUctBoard::Play.
+    Records the moves of playouts first and measures only the time for
+    replaying them after restoring the board from a snapshot. */
+void BenchUctBoardPlay(const Position& position, const GoBoard& bd)
+{
+    GoUctBoard uctBd(bd);
+    GoUctPlayoutPolicyParam param;
+    GoUctPlayoutPolicy<GoUctBoard> policy(uctBd, param);
+    uctBd.TakeSnapshot();
+    const int nuRecorded = 100;
+    vector<vector<SgPoint> > playouts(nuRecorded);
+    for (int i = 0; i < nuRecorded; ++i)
+    {
+        uctBd.RestoreSnapshot();
+        PlayPlayout(uctBd, policy, &playouts[i]);
+    }
+    double nuMoves = 0;
+    const double startTime = Time();
+    double time;
+    do
+    {
+        for (int i = 0; i < nuRecorded; ++i)
+        {
+            uctBd.RestoreSnapshot();
+            const vector<SgPoint>& moves = playouts[i];
+            for (vector<SgPoint>::const_iterator it = moves.begin();
+                 it != moves.end(); ++it)
+                uctBd.Play(*it);
+            nuMoves += double(moves.size());
+        }
+        time = Time() - startTime;
+    }
+    while (time < g_duration);
+    WriteResult("uctboard_play", position, nuMoves / time, "moves/s");
+}
+
+/** Rate of playouts with a playout policy configuration. */
+void BenchPlayoutPolicy(const Position& position, const GoBoard& bd,
+                        const string& name,
+                        const GoUctPlayoutPolicyParam& param)
+{
+    GoUctBoard uctBd(bd);
+    uctBd.SetMaintainPatternCodes(param.m_incrementalPatternCodes);
+    GoUctPlayoutPolicy<GoUctBoard> policy(uctBd, param);
+    uctBd.TakeSnapshot();
+    double nuPlayouts = 0;
+    const double startTime = Time();
+    double time;
+    do
+    {
+        for (int i = 0; i < 50; ++i)
+        {
+            uctBd.RestoreSnapshot();
+            PlayPlayout(uctBd, policy, 0);
+            ++nuPlayouts;
+        }
+        time = Time() - startTime;
+    }
+    while (time < g_duration);
+    WriteResult("playout_" + name, position, nuPlayouts / time,
+                "playouts/s");
+}
+
+void BenchPlayoutPolicies(const Position& position, const GoBoard& bd)
+{
+    GoUctPlayoutPolicyParam param;
+    BenchPlayoutPolicy(position, bd, "default", param);
+    param.m_fullBoardGammaPlayout = true;
+    BenchPlayoutPolicy(position, bd, "full_board_gamma", param);
+    param.m_fullBoardGammaPlayout = false;
+    param.m_usePatternsInPlayout = false;
+    BenchPlayoutPolicy(position, bd, "no_patterns", param);
+}
+
+/** Rate of 3x3 pattern matches.
+    Matches the patterns of all empty points of the position. */
+void BenchPatternMatch(const Position& position, const GoBoard& bd)
+{
+    GoUctBoard uctBd(bd);
+    GoUctPatterns<GoUctBoard> patterns(uctBd);
+    vector<SgPoint> empty;
+    for (GoUctBoard::Iterator it(uctBd); it; ++it)
+        if (uctBd.IsEmpty(*it))
+            empty.push_back(*it);
+    double nuMatches = 0;
+    int nuMatched = 0;
+    const double startTime = Time();
+    double time;
+    do
+    {
+        for (int i = 0; i < 100; ++i)
+            for (vector<SgPoint>::const_iterator it = empty.begin();
+                 it != empty.end(); ++it)
+                if (patterns.MatchAny(*it))
+                    ++nuMatched;
+        nuMatches += 100 * double(empty.size());
+        time = Time() - startTime;
+    }
+    while (time < g_duration);
+    if (g_verbose)
+        SgDebug() << "FuegoBench: " << nuMatched << " matches\n";
+    WriteResult("pattern_match", position, nuMatches / time, "matches/s");
+}
+
+/** Rate of the evaluation of the move features with the feature weights.
+    Evaluates the features of all legal moves of the position with the
+    pairwise evaluation FeFeatures::EvaluateActiveFeatures() and with
+    FeFactorEvaluator. */
+void BenchFeatureEvaluation(const Position& position, const GoBoard& bd,
+                            const FeFeatureWeights& weights,
+                            const FeFactorEvaluator& evaluator)
+{
+    FeFullBoardFeatures features(bd);
+    features.FindAllFeatures();
+    vector<FeActiveArray> active;
+    vector<size_t> nuActive;
+    for (GoPointList::Iterator it(features.LegalMoves()); it; ++it)
+    {
+        active.push_back(FeActiveArray());
+        nuActive.push_back(
+                  features.Features()[*it].ActiveFeatures(active.back()));
+    }
+    for (int pairwise = 1; pairwise >= 0; --pairwise)
+    {
+        double nuEvaluations = 0;
+        float sum = 0;
+        const double startTime = Time();
+        double time;
+        do
+        {
+            for (int i = 0; i < 100; ++i)
+                for (size_t j = 0; j < active.size(); ++j)
+                    sum += pairwise ?
+                        FeFeatures::EvaluateActiveFeatures(active[j],
+                                                           nuActive[j],
+                                                           weights)
+                        : evaluator.Evaluate(active[j].data(), nuActive[j]);
+            nuEvaluations += 100 * double(active.size());
+            time = Time() - startTime;
+        }
+        while (time < g_duration);
+        if (g_verbose)
+            SgDebug() << "FuegoBench: sum of move values " << sum << '\n';
+        const string name = (pairwise ? string("pairwise")
+                             : string(FeFactorEvaluator::KernelName()));
+        WriteResult("feature_eval_" + name, position, nuEvaluations / time,
+                    "moves/s");
+    }
+}
+
+/** Rate of the child selection at the root node after a search.
+    Selects the child with the highest bound with SgUctSearch::GetBound(),
+    which uses the same bound as the child selection in the in-tree phase
+    of the search. */
+void BenchSelectChild(const Position& position, GlobalSearch& search)
+{
+    const SgUctTree& tree = search.Tree();
+    const SgUctNode& root = tree.Root();
+    if (! root.HasChildren())
+        return;
+    double nuSelections = 0;
+    SgMove bestMove = SG_NULLMOVE;
+    const double startTime = Time();
+    double time;
+    do
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            const SgUctNode* bestChild = 0;
+            SgUctValue bestBound = 0;
+            for (SgUctChildIterator it(tree, root); it; ++it)
+            {
+                const SgUctValue bound = search.GetBound(search.Rave(), root,
+                                                         *it);
+                if (bestChild == 0 || bound > bestBound)
+                {
+                    bestChild = &(*it);
+                    bestBound = bound;
+                }
+            }
+            bestMove = bestChild->Move();
+        }
+        nuSelections += 1000;
+        time = Time() - startTime;
+    }
+    while (time < g_duration);
+    if (g_verbose)
+        SgDebug() << "FuegoBench: selected " << SgWritePoint(bestMove)
+                  << '\n';
+    WriteResult("select_child", position, nuSelections / time,
+                "selections/s");
+}
+
+/** Games per second of the full search for 1..g_maxThreads threads.
+    Uses the default parameters of the search as in GoUctPlayer. */
+void BenchSearch(const Position& position, GoBoard& bd)
+{
+    GoUctPlayoutPolicyParam policyParam;
+    GoUctDefaultMoveFilterParam treeFilterParam;
+    GoUctFeatureKnowledgeParam featureParam;
+    GlobalSearch search(bd,
+                  new GoUctPlayoutPolicyFactory<GoUctBoard>(policyParam),
+                  policyParam, treeFilterParam, featureParam);
+    for (int nuThreads = 1; nuThreads <= g_maxThreads; ++nuThreads)
+    {
+        search.SetNumberThreads(nuThreads);
+        vector<SgMove> sequence;
+        const double startTime = Time();
+        search.Search(g_searchGames, std::numeric_limits<double>::max(),
+                      sequence);
+        const double time = Time() - startTime;
+        std::ostringstream name;
+        name << "search_threads_" << nuThreads;
+        WriteResult(name.str(), position,
+                    search.Tree().Root().MoveCount() / time, "games/s");
+        if (nuThreads == 1)
+            BenchSelectChild(position, search);
+    }
+}
+
+void RunBenchmarks()
+{
+    const FeFeatureWeights weights = FeFeatureWeights::ReadDefaultWeights();
+    const FeFactorEvaluator evaluator(weights);
+    for (int i = 0; i < NU_POSITIONS; ++i)
+    {
+        const Position& position = POSITIONS[i];
+        GoBoard bd;
+        LoadPosition(position, bd);
+        BenchUctBoardPlay(position, bd);
+        BenchPlayoutPolicies(position, bd);
+        BenchPatternMatch(position, bd);
+        BenchFeatureEvaluation(position, bd, weights, evaluator);
+        BenchSearch(position, bd);
+    }
+}
+
+void Help(po::options_description& desc)
+{
+    std::cout << "Options:\n" << desc << '\n';
+    exit(1);
+}
+
+void ParseOptions(int argc, char** argv)
+{
+    po::options_description desc;
+    desc.add_options()
+        ("duration",
+         po::value<double>(&g_duration)->default_value(2),
+         "minimum time in seconds for each benchmark except search")
+        ("games",
+         po::value<SgUctValue>(&g_searchGames)->default_value(5000),
+         "number of games for each search")
+        ("help", "displays this help and exit")
+        ("sgfdir",
+         po::value<std::string>(&g_sgfDir)->default_value(""),
+         "directory with the regression SGF files (default: from source "
+         "directory)")
+        ("srand",
+         po::value<int>(&g_srand)->default_value(1),
+         "set random seed (-1:none, 0:time(0))")
+        ("threads",
+         po::value<int>(&g_maxThreads)->default_value(1),
+         "search with 1..threads threads")
+        ("verbose", "print debug messages");
+    po::variables_map vm;
+    try
+    {
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+        po::notify(vm);
+    }
+    catch (...)
+    {
+        Help(desc);
+    }
+    if (vm.count("help"))
+        Help(desc);
+    if (vm.count("verbose"))
+        g_verbose = true;
+    if (g_maxThreads < 1)
+        throw SgException("threads must be at least 1");
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        ParseOptions(argc, argv);
+    }
+    catch (const SgException& e)
+    {
+        SgDebug() << e.what() << "\n";
+        return 1;
+    }
+    NullBuffer nullBuffer;
+    std::ostream nullStream(&nullBuffer);
+    if (! g_verbose)
+        SgSwapDebugStr(&nullStream);
+    try
+    {
+        SgRandom::SetSeed(g_srand);
+        SgInit();
+        GoInit();
+        RunBenchmarks();
+        GoFini();
+        SgFini();
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << '\n';
+        return 1;
+    }
+    return 0;
+}
+
+//----------------------------------------------------------------------------
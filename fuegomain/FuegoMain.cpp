@@ -18,9 +18,12 @@
 #include "FuegoMainEngine.h"
 #include "FuegoMainUtil.h"
 #include "GoInit.h"
+#include "GtpInputStream.h"
+#include "GtpOutputStream.h"
 #include "SgDebug.h"
 #include "SgException.h"
 #include "SgInit.h"
+#include "SgMpiSharedMemorySynchronizer.h"
 #include "SgPlatform.h"
 
 using boost::filesystem::path;
@@ -58,6 +61,79 @@ void Help(po::options_description& desc, ostream& out)
     exit(0);
 }
 
+/** Input stream of a process of a cluster.
+    The root process reads the input and broadcasts each line to the other
+    processes, which read the lines from the synchronizer. At the end of
+    the input, the root process sends a quit command. */
+class ClusterInputStream
+    : public GtpInputStream
+{
+public:
+    ClusterInputStream(std::istream& in,
+                       SgMpiSharedMemorySynchronizer& synchronizer);
+
+    bool EndOfInput();
+
+    bool GetLine(string& line);
+
+private:
+    SgMpiSharedMemorySynchronizer& m_synchronizer;
+
+    bool m_isEndOfInput;
+};
+
+ClusterInputStream::ClusterInputStream(std::istream& in,
+                                 SgMpiSharedMemorySynchronizer& synchronizer)
+    : GtpInputStream(in),
+      m_synchronizer(synchronizer),
+      m_isEndOfInput(false)
+{ }
+
+bool ClusterInputStream::EndOfInput()
+{
+    return m_isEndOfInput;
+}
+
+bool ClusterInputStream::GetLine(string& line)
+{
+    if (m_isEndOfInput)
+        return false;
+    if (m_synchronizer.IsRootProcess() && ! GtpInputStream::GetLine(line))
+    {
+        string quit = "quit";
+        m_synchronizer.SynchronizeInputLine(quit);
+        m_isEndOfInput = true;
+        return false;
+    }
+    m_synchronizer.SynchronizeInputLine(line);
+    return true;
+}
+
+/** Output stream of the non-root processes of a cluster.
+    Only the root process sends responses. */
+class NullOutputStream
+    : public GtpOutputStream
+{
+public:
+    NullOutputStream();
+
+    void Write(const string& line);
+
+    void Flush();
+};
+
+NullOutputStream::NullOutputStream()
+    : GtpOutputStream(std::cout)
+{ }
+
+void NullOutputStream::Flush()
+{ }
+
+void NullOutputStream::Write(const string& line)
+{
+    SG_UNUSED(line);
+}
+
 struct CommandLineOptions {
 
     /** Use opening book */
@@ -79,12 +155,28 @@ struct CommandLineOptions {
     int m_srand;
     
     vector<string> m_inputFiles;
+
+    /** Name of the cluster or empty, if not running as a cluster. */
+    string m_cluster;
+
+    int m_clusterSize;
+
+    int m_clusterRank;
 };
 
 void ParseOptions(int argc, char** argv, struct CommandLineOptions& options)
 {
     po::options_description normalOptions("Options");
     normalOptions.add_options()
+        ("cluster",
+         po::value<std::string>(&options.m_cluster)->default_value(""),
+         "run as a process of a cluster on this host with the given name")
+        ("clusterrank",
+         po::value<int>(&options.m_clusterRank)->default_value(0),
+         "rank of the process in the cluster (0 reads the input)")
+        ("clustersize",
+         po::value<int>(&options.m_clusterSize)->default_value(1),
+         "number of processes of the cluster")
         ("config", 
          po::value<std::string>(&options.m_config)->default_value(""),
          "execute GTP commands from file before starting main command loop")
@@ -122,6 +214,9 @@ void ParseOptions(int argc, char** argv, struct CommandLineOptions& options)
     }
     if (vm.count("help"))
         Help(normalOptions, std::cout);
+    if (options.m_clusterSize < 1 || options.m_clusterRank < 0
+        || options.m_clusterRank >= options.m_clusterSize)
+        Help(normalOptions, std::cerr);
     if (vm.count("nobook"))
         options.m_useBook = false;
     if (vm.count("nohandicap"))
@@ -130,6 +225,32 @@ void ParseOptions(int argc, char** argv, struct CommandLineOptions& options)
         options.m_quiet = true;
 }
 
+/** Run the main loop of the engine.
+    If the engine is a process of a cluster, the input of the root process is
+    distributed to all processes. */
+void MainLoop(FuegoMainEngine& engine, std::istream& in,
+              SgMpiSharedMemorySynchronizer* synchronizer)
+{
+    if (synchronizer == 0)
+    {
+        GtpInputStream gtpIn(in);
+        GtpOutputStream gtpOut(std::cout);
+        engine.MainLoop(gtpIn, gtpOut);
+    }
+    else if (synchronizer->IsRootProcess())
+    {
+        ClusterInputStream gtpIn(in, *synchronizer);
+        GtpOutputStream gtpOut(std::cout);
+        engine.MainLoop(gtpIn, gtpOut);
+    }
+    else
+    {
+        ClusterInputStream gtpIn(in, *synchronizer);
+        NullOutputStream gtpOut;
+        engine.MainLoop(gtpIn, gtpOut);
+    }
+}
+
 void PrintStartupMessage()
 {
     SgDebug() <<
@@ -179,6 +300,15 @@ int main(int argc, char** argv)
                                options.m_programPath,
                                ! options.m_allowHandicap);
         GoGtpAssertionHandler assertionHandler(engine);
+        boost::shared_ptr<SgMpiSharedMemorySynchronizer> synchronizer;
+        if (options.m_cluster != "")
+        {
+            synchronizer.reset(new SgMpiSharedMemorySynchronizer(
+                                                  options.m_cluster,
+                                                  options.m_clusterSize,
+                                                  options.m_clusterRank));
+            engine.SetMpiSynchronizer(synchronizer);
+        }
         if (options.m_maxGames >= 0)
             engine.SetMaxClearBoard(options.m_maxGames);
         if (options.m_useBook)
@@ -195,17 +325,11 @@ int main(int argc, char** argv)
                 if (! fin)
                     throw SgException(boost::format("Error file '%1%'") 
                     				  % file);
-                GtpInputStream in(fin);
-                GtpOutputStream out(std::cout);
-                engine.MainLoop(in, out);
+                MainLoop(engine, fin, synchronizer.get());
             }
         }
         else
-        {
-            GtpInputStream in(std::cin);
-            GtpOutputStream out(std::cout);
-            engine.MainLoop(in, out);
-        }
+            MainLoop(engine, std::cin, synchronizer.get());
     }
     catch (const GtpFailure& e)
     {
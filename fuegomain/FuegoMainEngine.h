@@ -28,6 +28,10 @@ public:
     void CmdName(GtpCommand& cmd);
     void CmdVersion(GtpCommand& cmd);
 
+    /** Set the synchronizer of the engine and of the player.
+        Used for running Fuego as a cluster of processes. */
+    void SetMpiSynchronizer(const SgMpiSynchronizerHandle& handle);
+
 private:
     GoUctCommands m_uctCommands;
 
@@ -429,6 +429,22 @@ namespace GoBoardUtil
     float ScoreSimpleEndPosition(const GoBoard& bd, float komi,
                                  bool noCheck = false);
 
+    /** Same as ScoreSimpleEndPosition(const BOARD&,float,const SgBWSet&,
+        bool,SgPointArray<SgEmptyBlackWhite>*), but computed with set
+        operations on the point sets of the stones (BOARD::All()).
+        Does not loop over the points of the board, which makes it
+        suitable for scoring the final position of each Monte-Carlo game.
+        Does not check, if the empty points are single empty points.
+        @param bd
+        @param komi
+        @param safe
+        @param[out] area Optional sets to fill in the points counted for
+        each color (points in neither set are dame); null if not needed
+        @return Score including komi, positive for black. */
+    template<class BOARD>
+    float ScoreSimpleEndPositionBitset(const BOARD& bd, float komi,
+                                       const SgBWSet& safe, SgBWSet* area);
+
     /** Check if move would be self-atari.
      Faster than Executing the move, then calling InAtari(). */
     template<class BOARD>
@@ -476,6 +492,18 @@ namespace GoBoardUtil
     float TrompTaylorScore(const BOARD& bd, float komi,
                            SgPointArray<SgEmptyBlackWhite>* scoreBoard = 0);
 
+    /** Same as TrompTaylorScore(), but computed with set operations on the
+        point sets of the stones (BOARD::All()).
+        The empty regions are flood-filled from the neighbors of the stones
+        of each color by growing the point sets, which needs one iteration
+        per point of the longest distance within an empty region.
+        @param bd
+        @param komi
+        @param[out] area See ScoreSimpleEndPositionBitset() */
+    template<class BOARD>
+    float TrompTaylorScoreBitset(const BOARD& bd, float komi,
+                                 SgBWSet* area);
+
     /** Compute the Japanese score for the current positions.
         @todo not implemented, just calls TrompTaylorScore.
      */
@@ -779,6 +807,35 @@ float GoBoardUtil::ScoreSimpleEndPosition(const BOARD& bd, float komi,
     return score;
 }
 
+template<class BOARD>
+float GoBoardUtil::ScoreSimpleEndPositionBitset(const BOARD& bd, float komi,
+                                                const SgBWSet& safe,
+                                                SgBWSet* area)
+{
+    const SgPointSet& black = bd.All(SG_BLACK);
+    const SgPointSet& white = bd.All(SG_WHITE);
+    const SgPointSet empty =
+        SgPointSet::AllPoints(bd.Size()) - black - white;
+    const SgPointSet blackNb = black.BorderNoClip();
+    const SgPointSet whiteNb = white.BorderNoClip();
+    // Stones and empty points with only neighbors of one color, but safe
+    // points count for their color; black safe points take precedence as
+    // in ScoreSimpleEndPosition()
+    SgPointSet blackArea = black | ((empty & blackNb) - whiteNb);
+    SgPointSet whiteArea = white | ((empty & whiteNb) - blackNb);
+    blackArea -= safe[SG_WHITE];
+    blackArea |= safe[SG_BLACK];
+    whiteArea -= safe[SG_BLACK];
+    whiteArea |= safe[SG_WHITE] - safe[SG_BLACK];
+    const float score = float(blackArea.Size() - whiteArea.Size()) - komi;
+    if (area != 0)
+    {
+        (*area)[SG_BLACK] = blackArea;
+        (*area)[SG_WHITE] = whiteArea;
+    }
+    return score;
+}
+
 template<class BOARD>
 inline bool GoBoardUtil::SelfAtari(const BOARD& bd, SgPoint p)
 {
@@ -1098,6 +1155,39 @@ float GoBoardUtil::TrompTaylorScore(const BOARD& bd, float komi,
     return score;
 }
 
+template<class BOARD>
+float GoBoardUtil::TrompTaylorScoreBitset(const BOARD& bd, float komi,
+                                          SgBWSet* area)
+{
+    const SgPointSet& black = bd.All(SG_BLACK);
+    const SgPointSet& white = bd.All(SG_WHITE);
+    const SgPointSet empty =
+        SgPointSet::AllPoints(bd.Size()) - black - white;
+    // Empty points reachable from stones of each color
+    SgBWSet reach;
+    for (SgBWIterator it; it; ++it)
+    {
+        SgPointSet& r = reach[*it];
+        r = bd.All(*it).BorderNoClip() & empty;
+        while (true)
+        {
+            const SgPointSet newPoints = r.BorderNoClip() & empty;
+            if (newPoints.IsEmpty())
+                break;
+            r |= newPoints;
+        }
+    }
+    const SgPointSet blackArea = black | (reach[SG_BLACK] - reach[SG_WHITE]);
+    const SgPointSet whiteArea = white | (reach[SG_WHITE] - reach[SG_BLACK]);
+    const float score = float(blackArea.Size() - whiteArea.Size()) - komi;
+    if (area != 0)
+    {
+        (*area)[SG_BLACK] = blackArea;
+        (*area)[SG_WHITE] = whiteArea;
+    }
+    return score;
+}
+
 //----------------------------------------------------------------------------
 
 template<class BOARD>
@@ -566,6 +566,44 @@ void CheckSelfAtari(const GoBoard& bd, SgPoint p, int nuExpectedStones)
     BOOST_CHECK_EQUAL(nuStones, nuExpectedStones);
 }
 
+/** Test ScoreSimpleEndPositionBitset() against ScoreSimpleEndPosition()
+    on a position with dame and safe points. */
+BOOST_AUTO_TEST_CASE(GoBoardUtilTest_ScoreSimpleEndPositionBitset)
+{
+    // @ @ . O O
+    // . @ . O .
+    // . @ . O .
+    // . @ . O .
+    // . @ . O .
+    GoSetup setup;
+    for (SgGrid y = 1; y <= 5; ++y)
+    {
+        setup.AddBlack(Pt(2, y));
+        setup.AddWhite(Pt(4, y));
+    }
+    setup.AddBlack(Pt(1, 5));
+    setup.AddWhite(Pt(5, 5));
+    GoBoard bd(5, setup);
+    SgBWSet safe;
+    safe[SG_BLACK].Include(Pt(3, 1));
+    safe[SG_WHITE].Include(Pt(2, 1));
+    const float komi = 0.5;
+    SgBWSet area;
+    BOOST_CHECK_CLOSE(ScoreSimpleEndPositionBitset(bd, komi, safe, &area),
+                      -1.5f, 1e-4f);
+    SgPointArray<SgEmptyBlackWhite> scoreBoard;
+    BOOST_CHECK_CLOSE(ScoreSimpleEndPosition(bd, komi, safe, true,
+                                             &scoreBoard),
+                      -1.5f, 1e-4f);
+    for (GoBoard::Iterator it(bd); it; ++it)
+    {
+        BOOST_CHECK_EQUAL(area[SG_BLACK].Contains(*it),
+                          scoreBoard[*it] == SG_BLACK);
+        BOOST_CHECK_EQUAL(area[SG_WHITE].Contains(*it),
+                          scoreBoard[*it] == SG_WHITE);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(GoBoardUtilTest_SelfAtari_1)
 {
     // . @ . O O . O O . 9
@@ -823,6 +861,41 @@ BOOST_AUTO_TEST_CASE(GoBoardUtilTest_TrompTaylorScore)
     BOOST_CHECK_CLOSE(GoBoardUtil::TrompTaylorScore(bd, komi), -77.5f, 1e-4f);
 }
 
+/** Test TrompTaylorScoreBitset() against TrompTaylorScore() on the
+    position of GoBoardUtilTest_TrompTaylorScore and on the empty board. */
+BOOST_AUTO_TEST_CASE(GoBoardUtilTest_TrompTaylorScoreBitset)
+{
+    GoSetup setup;
+    setup.AddBlack(Pt(1, 2));
+    setup.AddBlack(Pt(2, 1));
+    setup.AddBlack(Pt(2, 2));
+    setup.AddWhite(Pt(3, 1));
+    setup.AddWhite(Pt(3, 2));
+    setup.AddWhite(Pt(3, 3));
+    setup.AddWhite(Pt(3, 4));
+    setup.AddWhite(Pt(1, 4));
+    setup.AddWhite(Pt(2, 4));
+    setup.AddWhite(Pt(8, 1));
+    setup.AddWhite(Pt(8, 2));
+    setup.AddWhite(Pt(9, 2));
+    setup.AddBlack(Pt(9, 9));
+    GoBoard bd(9, setup);
+    const float komi = 6.5;
+    SgBWSet area;
+    SgPointArray<SgEmptyBlackWhite> scoreBoard;
+    BOOST_CHECK_CLOSE(TrompTaylorScoreBitset(bd, komi, &area),
+                      TrompTaylorScore(bd, komi, &scoreBoard), 1e-4f);
+    for (GoBoard::Iterator it(bd); it; ++it)
+    {
+        BOOST_CHECK_EQUAL(area[SG_BLACK].Contains(*it),
+                          scoreBoard[*it] == SG_BLACK);
+        BOOST_CHECK_EQUAL(area[SG_WHITE].Contains(*it),
+                          scoreBoard[*it] == SG_WHITE);
+    }
+    GoBoard empty(9);
+    BOOST_CHECK_CLOSE(TrompTaylorScoreBitset(empty, komi, 0), -6.5f, 1e-4f);
+}
+
 BOOST_AUTO_TEST_CASE(GoBoardUtilTest_TrompTaylorScore_Empty9)
 {
     GoBoard bd(9);
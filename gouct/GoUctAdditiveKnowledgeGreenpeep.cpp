@@ -97,27 +97,51 @@ void ComputeContexts9(const GoBoard& bd,
     }
 }
 
-void ReadPatternArray(unsigned short predictor[], int size,
-                      PatternEntry patternEntry[], unsigned int nuPatterns)
-{
-    for (int i = 0; i < size; ++i)
-        predictor[i] = NEUTRALPREDICTION;
+/** Number of bits of a context used to select its bucket. */
+const int BUCKET_BITS = 16;
+
+/** Shift of a 9x9 context to get its bucket (contexts have 26 bits). */
+const int BUCKET_SHIFT_9X9 = 26 - BUCKET_BITS;
 
+/** Shift of a 19x19 context to get its bucket (contexts have 24 bits). */
+const int BUCKET_SHIFT_19X19 = 24 - BUCKET_BITS;
+
+/** Compute the start of the entries of each bucket in a pattern table,
+    which must be sorted by index. The entries of bucket b are
+    patterns[bucketStart[b]] to patterns[bucketStart[b + 1] - 1]. */
+void FindBuckets(const PatternEntry patterns[], unsigned int nuPatterns,
+                 int shift, std::vector<unsigned int>& bucketStart)
+{
+    bucketStart.assign((1 << BUCKET_BITS) + 1, 0);
     for (unsigned int i = 0; i < nuPatterns; ++i)
     {
-        unsigned int context = patternEntry[i].index;
-        SG_ASSERT(context < static_cast<unsigned int>(size));
-        predictor[context] = patternEntry[i].code;
+        SG_ASSERT(i == 0 || patterns[i - 1].index < patterns[i].index);
+        SG_ASSERT((patterns[i].index >> shift) < (1u << BUCKET_BITS));
+        ++bucketStart[(patterns[i].index >> shift) + 1];
     }
+    for (std::size_t b = 1; b < bucketStart.size(); ++b)
+        bucketStart[b] += bucketStart[b - 1];
+}
+
+bool IndexLess(const PatternEntry& entry, unsigned int context)
+{
+    return entry.index < context;
 }
 
-void ReadPatterns(unsigned short predictor9[],
-                  unsigned short predictor19[])
+/** Look up a context by binary search in its bucket of a pattern table.
+    Contexts that are not in the table get the neutral prediction. */
+unsigned short Predictor(const PatternEntry patterns[],
+                         const std::vector<unsigned int>& bucketStart,
+                         int shift, unsigned int context)
 {
-    ReadPatternArray(predictor9, NUMPATTERNS9X9,
-                     greenpeepPatterns9, nuGreenpeepPatterns9);
-    ReadPatternArray(predictor19, NUMPATTERNS19X19,
-                     greenpeepPatterns19, nuGreenpeepPatterns19);
+    const unsigned int bucket = context >> shift;
+    const PatternEntry* end = patterns + bucketStart[bucket + 1];
+    const PatternEntry* entry =
+        std::lower_bound(patterns + bucketStart[bucket], end, context,
+                         IndexLess);
+    if (entry != end && entry->index == context)
+        return entry->code;
+    return NEUTRALPREDICTION;
 }
 
 } // namespace
@@ -126,7 +150,27 @@ void ReadPatterns(unsigned short predictor9[],
 
 GoUctAdditiveKnowledgeParamGreenpeep::GoUctAdditiveKnowledgeParamGreenpeep()
 {
-    ReadPatterns(m_predictor9x9, m_predictor19x19);
+    FindBuckets(greenpeepPatterns9, nuGreenpeepPatterns9, BUCKET_SHIFT_9X9,
+                m_bucketStart9x9);
+    FindBuckets(greenpeepPatterns19, nuGreenpeepPatterns19,
+                BUCKET_SHIFT_19X19, m_bucketStart19x19);
+}
+
+unsigned short
+GoUctAdditiveKnowledgeParamGreenpeep::Predictor9x9(unsigned int context) const
+{
+    SG_ASSERT(context < static_cast<unsigned int>(NUMPATTERNS9X9));
+    return Predictor(greenpeepPatterns9, m_bucketStart9x9, BUCKET_SHIFT_9X9,
+                     context);
+}
+
+unsigned short
+GoUctAdditiveKnowledgeParamGreenpeep::Predictor19x19(unsigned int context)
+    const
+{
+    SG_ASSERT(context < static_cast<unsigned int>(NUMPATTERNS19X19));
+    return Predictor(greenpeepPatterns19, m_bucketStart19x19,
+                     BUCKET_SHIFT_19X19, context);
 }
 
 //----------------------------------------------------------------------------
@@ -142,7 +186,6 @@ void GoUctAdditiveKnowledgeGreenpeep::
 ProcessPosition19(std::vector<SgUctMoveInfo>& moves)
 {
     SG_ASSERT(Board().Size() >= 15);
-    const unsigned short* predictor(m_param.m_predictor19x19);
     ComputeContexts19(Board(), moves.begin(), moves.end(), m_contexts);
 
     for (std::size_t i = 0; i < moves.size(); ++i)
@@ -155,7 +198,8 @@ ProcessPosition19(std::vector<SgUctMoveInfo>& moves)
             value = PASSPREDICTION / NEUTRALPREDICTION_FLOAT;
         }
         else
-            value = predictor[context] / NEUTRALPREDICTION_FLOAT;
+            value = m_param.Predictor19x19(context)
+                  / NEUTRALPREDICTION_FLOAT;
     }
 }
 
@@ -163,7 +207,6 @@ void GoUctAdditiveKnowledgeGreenpeep::
 ProcessPosition9(std::vector<SgUctMoveInfo>& moves)
 {
     SG_ASSERT(Board().Size() < 15);
-    const unsigned short* predictor = m_param.m_predictor9x9;
     ComputeContexts9(Board(), moves.begin(), moves.end(), m_contexts);
 
     for (std::size_t i = 0; i < moves.size(); ++i)
@@ -181,10 +224,11 @@ ProcessPosition9(std::vector<SgUctMoveInfo>& moves)
             // end of training instead.
             const unsigned int altContext =
                 context & ~GoPattern12Point::ATARI_BIT;
-            value = std::max(predictor[context], predictor[altContext]);
+            value = std::max(m_param.Predictor9x9(context),
+                             m_param.Predictor9x9(altContext));
         }
         else
-            value = predictor[context];
+            value = m_param.Predictor9x9(context);
 	    value /= NEUTRALPREDICTION_FLOAT;
     }
 }
@@ -15,6 +15,7 @@
 #ifndef GOUCT_ADDITIVEKNOWLEDGEGREENPEEP_H
 #define GOUCT_ADDITIVEKNOWLEDGEGREENPEEP_H
 
+#include <vector>
 #include "GoAdditiveKnowledge.h"
 
 /* max 26-bit: 16-bit 8-neighbor core, 8-bit liberty & 2-away extension, 
@@ -26,15 +27,28 @@ const int NUMPATTERNS19X19 = 1<<24;
 
 //----------------------------------------------------------------------------
 
+/** Access to the pattern values.
+    The values are looked up in the sorted pattern tables, which are compiled
+    into the program. The contexts are divided into 2^16 buckets of
+    consecutive contexts, and the constructor only computes where the entries
+    of each bucket start, so a lookup is a short binary search.
+    Contexts that are not in the tables get the neutral value. */
 class GoUctAdditiveKnowledgeParamGreenpeep: public GoAdditiveKnowledgeParam
 {
-private:
 public:
     GoUctAdditiveKnowledgeParamGreenpeep();
 
-    unsigned short m_predictor9x9[NUMPATTERNS9X9];
-    
-    unsigned short m_predictor19x19[NUMPATTERNS19X19];
+    /** Value of a 9x9 context (with ko and atari bits) */
+    unsigned short Predictor9x9(unsigned int context) const;
+
+    /** Value of a 19x19 context */
+    unsigned short Predictor19x19(unsigned int context) const;
+
+private:
+    /** See FindBuckets() in GoUctAdditiveKnowledgeGreenpeep.cpp */
+    std::vector<unsigned int> m_bucketStart9x9;
+
+    std::vector<unsigned int> m_bucketStart19x19;
 };
 
 /** Use Greenpeep-style pattern values to make predictions. */
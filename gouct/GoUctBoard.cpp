@@ -9,6 +9,7 @@
 #include <boost/static_assert.hpp>
 #include <algorithm>
 #include "GoBoardUtil.h"
+#include "GoPattern3x3.h"
 #include "SgNbIterator.h"
 #include "SgStack.h"
 
@@ -23,14 +24,44 @@ namespace {
     time. */
 const bool CONSISTENCY = false;
 
+/** Offsets of the 8 neighbors of a point in the order of their digits in
+    GoPattern3x3::CodeOf8Neighbors(). */
+const int PATTERN_DIR[8] = {
+    -SG_NS - SG_WE, -SG_NS, -SG_NS + SG_WE, -SG_WE,
+    SG_WE, SG_NS - SG_WE, SG_NS, SG_NS + SG_WE
+};
+
+int PatternDirIndex(int dir)
+{
+    for (int i = 0; i < 8; ++i)
+        if (PATTERN_DIR[i] == dir)
+            return i;
+    SG_ASSERT(false);
+    return -1;
+}
+
+/** Copy the first elements of a point array.
+    Used for restoring only the part of the arrays that is used by the
+    current board size. */
+template<typename T>
+inline void CopyPoints(SgArray<T,SG_MAXPOINT>& dest,
+                       const SgArray<T,SG_MAXPOINT>& src, int nuPoints)
+{
+    SG_ASSERT(nuPoints <= SG_MAXPOINT);
+    std::memcpy(&dest[0], &src[0], nuPoints * sizeof(T));
+}
+
 } // namespace
 
 //----------------------------------------------------------------------------
 
 GoUctBoard::GoUctBoard(const GoBoard& bd)
-    : m_const(bd.Size())
+    : m_const(bd.Size()),
+      m_snapshot(new Snapshot())
 {
     m_size = -1;
+    m_maintainPatternCodes = false;
+    m_snapshot->m_size = -1;
     Init(bd);
 }
 
@@ -62,11 +93,38 @@ void GoUctBoard::CheckConsistency() const
             if (m_color[*it] == SG_WHITE)
                 ++n;
         SG_ASSERT(n == NumNeighbors(p, SG_WHITE));
+        SG_ASSERT(m_all[SG_BLACK].Contains(p) == (c == SG_BLACK));
+        SG_ASSERT(m_all[SG_WHITE].Contains(p) == (c == SG_WHITE));
         if (c == SG_BLACK || c == SG_WHITE)
             CheckConsistencyBlock(p);
         if (c == SG_EMPTY)
             SG_ASSERT(m_block[p] == 0);
+        if (m_maintainPatternCodes)
+        {
+            if (Line(p) > 1)
+                SG_ASSERT(m_patternCode[p]
+                          == GoPattern3x3::CodeOf8Neighbors(*this, p));
+            else if (Pos(p) > 1)
+                SG_ASSERT(m_patternCode[p]
+                          == GoPattern3x3::CodeOfEdgeNeighbors(*this, p));
+        }
     }
+    for (SgBWIterator it; it; ++it)
+        for (int nuLiberties = 1; nuLiberties <= 2; ++nuLiberties)
+        {
+            const AnchorList& anchors = (nuLiberties == 1 ?
+                                         m_atariBlocks[*it] :
+                                         m_twoLibBlocks[*it]);
+            for (int i = 0; i < anchors.Length(); ++i)
+            {
+                const Block* block = m_block[anchors[i]];
+                SG_ASSERT(block != 0);
+                SG_ASSERT(block->m_anchor == anchors[i]);
+                SG_ASSERT(block->m_color == *it);
+                SG_ASSERT(block->m_lowLibList == nuLiberties);
+                SG_ASSERT(block->m_lowLibIndex == i);
+            }
+        }
 }
 
 void GoUctBoard::CheckConsistencyBlock(SgPoint point) const
@@ -74,7 +132,7 @@ void GoUctBoard::CheckConsistencyBlock(SgPoint point) const
     SG_ASSERT(Occupied(point));
     SgBlackWhite color = GetColor(point);
     GoPointList stones;
-    Block::LibertyList liberties;
+    GoPointList liberties;
     SgMarker mark;
     SgStack<SgPoint,SG_MAXPOINT> stack;
     stack.Push(point);
@@ -101,47 +159,63 @@ void GoUctBoard::CheckConsistencyBlock(SgPoint point) const
     }
     SG_ASSERT(anchorFound);
     SG_ASSERT(color == block->m_color);
-    SG_ASSERT(stones.SameElements(block->m_stones));
-    SG_ASSERT(liberties.SameElements(block->m_liberties));
+    GoPointList blockStones;
+    for (StoneIterator it(*this, point); it; ++it)
+        blockStones.PushBack(*it);
+    SG_ASSERT(stones.SameElements(blockStones));
     SG_ASSERT(stones.Length() == NumStones(point));
+    GoPointList blockLiberties;
+    for (LibertyIterator it(*this, point); it; ++it)
+        blockLiberties.PushBack(*it);
+    SG_ASSERT(liberties.SameElements(blockLiberties));
+    SG_ASSERT(liberties.Length() == NumLiberties(point));
+    SG_ASSERT(block->m_lowLibList
+              == (liberties.Length() <= 2 ? liberties.Length() : 0));
 }
 
 void GoUctBoard::AddLibToAdjBlocks(SgPoint p, SgBlackWhite c)
 {
     if (NumNeighbors(p, c) == 0)
         return;
-    SgReserveMarker reserve(m_marker2);
-    m_marker2.Clear();
+    // Adding a liberty twice to the same block has no effect
     Block* b;
     if (m_color[p - SG_NS] == c && (b = m_block[p - SG_NS]) != 0)
     {
-        m_marker2.Include(b->m_anchor);
-        b->m_liberties.PushBack(p);
+        b->AddLiberty(p);
+        UpdateLowLibBlock(b);
+    }
+    if (m_color[p + SG_NS] == c && (b = m_block[p + SG_NS]) != 0)
+    {
+        b->AddLiberty(p);
+        UpdateLowLibBlock(b);
+    }
+    if (m_color[p - SG_WE] == c && (b = m_block[p - SG_WE]) != 0)
+    {
+        b->AddLiberty(p);
+        UpdateLowLibBlock(b);
+    }
+    if (m_color[p + SG_WE] == c && (b = m_block[p + SG_WE]) != 0)
+    {
+        b->AddLiberty(p);
+        UpdateLowLibBlock(b);
     }
-    if (m_color[p + SG_NS] == c && (b = m_block[p + SG_NS]) != 0
-        && m_marker2.NewMark(b->m_anchor))
-        b->m_liberties.PushBack(p);
-    if (m_color[p - SG_WE] == c && (b = m_block[p - SG_WE]) != 0
-        && m_marker2.NewMark(b->m_anchor))
-        b->m_liberties.PushBack(p);
-    if (m_color[p + SG_WE] == c && (b = m_block[p + SG_WE]) != 0
-        && ! m_marker2.Contains(b->m_anchor))
-        b->m_liberties.PushBack(p);
 }
 
 void GoUctBoard::AddStoneToBlock(SgPoint p, Block* block)
 {
     // Stone already placed
     SG_ASSERT(IsColor(p, block->m_color));
-    block->m_stones.PushBack(p);
-    if (IsEmpty(p - SG_NS) && ! IsAdjacentTo(p - SG_NS, block))
-        block->m_liberties.PushBack(p - SG_NS);
-    if (IsEmpty(p - SG_WE) && ! IsAdjacentTo(p - SG_WE, block))
-        block->m_liberties.PushBack(p - SG_WE);
-    if (IsEmpty(p + SG_WE) && ! IsAdjacentTo(p + SG_WE, block))
-        block->m_liberties.PushBack(p + SG_WE);
-    if (IsEmpty(p + SG_NS) && ! IsAdjacentTo(p + SG_NS, block))
-        block->m_liberties.PushBack(p + SG_NS);
+    m_nextStone[p] = m_nextStone[block->m_anchor];
+    m_nextStone[block->m_anchor] = p;
+    ++block->m_nuStones;
+    if (IsEmpty(p - SG_NS))
+        block->AddLiberty(p - SG_NS);
+    if (IsEmpty(p - SG_WE))
+        block->AddLiberty(p - SG_WE);
+    if (IsEmpty(p + SG_WE))
+        block->AddLiberty(p + SG_WE);
+    if (IsEmpty(p + SG_NS))
+        block->AddLiberty(p + SG_NS);
     m_block[p] = block;
 }
 
@@ -151,27 +225,20 @@ void GoUctBoard::CreateSingleStoneBlock(SgPoint p, SgBlackWhite c)
     SG_ASSERT(IsColor(p, c));
     SG_ASSERT(NumNeighbors(p, c) == 0);
     Block& block = m_blockArray[p];
-    block.InitSingleStoneBlock(c, p);
+    block.InitNewBlock(c, p);
+    block.m_nuStones = 1;
+    m_nextStone[p] = p;
     if (IsEmpty(p - SG_NS))
-        block.m_liberties.PushBack(p - SG_NS);
+        block.AddLiberty(p - SG_NS);
     if (IsEmpty(p - SG_WE))
-        block.m_liberties.PushBack(p - SG_WE);
+        block.AddLiberty(p - SG_WE);
     if (IsEmpty(p + SG_WE))
-        block.m_liberties.PushBack(p + SG_WE);
+        block.AddLiberty(p + SG_WE);
     if (IsEmpty(p + SG_NS))
-        block.m_liberties.PushBack(p + SG_NS);
+        block.AddLiberty(p + SG_NS);
     m_block[p] = &block;
 }
 
-bool GoUctBoard::IsAdjacentTo(SgPoint p,
-                              const GoUctBoard::Block* block) const
-{
-    return   m_block[p - SG_NS] == block
-          || m_block[p - SG_WE] == block
-          || m_block[p + SG_WE] == block
-          || m_block[p + SG_NS] == block;
-}
-
 void GoUctBoard::MergeBlocks(SgPoint p, const SgArrayList<Block*,4>& adjBlocks)
 {
     // Stone already placed
@@ -182,41 +249,39 @@ void GoUctBoard::MergeBlocks(SgPoint p, const SgArrayList<Block*,4>& adjBlocks)
     for (SgArrayList<Block*,4>::Iterator it(adjBlocks); it; ++it)
     {
         Block* adjBlock = *it;
-        int numStones = adjBlock->m_stones.Length();
+        int numStones = adjBlock->m_nuStones;
         if (numStones > largestBlockStones)
         {
             largestBlockStones = numStones;
             largestBlock = adjBlock;
         }
     }
-    largestBlock->m_stones.PushBack(p);
-    SgReserveMarker reserve(m_marker);
-    m_marker.Clear();
-    for (Block::LibertyIterator lib(largestBlock->m_liberties); lib; ++lib)
-        m_marker.Include(*lib);
+    const SgPoint anchor = largestBlock->m_anchor;
     for (SgArrayList<Block*,4>::Iterator it(adjBlocks); it; ++it)
     {
         Block* adjBlock = *it;
         if (adjBlock == largestBlock)
             continue;
-        for (Block::StoneIterator stn(adjBlock->m_stones); stn; ++stn)
+        RemoveLowLibBlock(adjBlock);
+        const SgPoint adjAnchor = adjBlock->m_anchor;
+        SgPoint stn = adjAnchor;
+        do
         {
-            largestBlock->m_stones.PushBack(*stn);
-            m_block[*stn] = largestBlock;
+            m_block[stn] = largestBlock;
+            stn = m_nextStone[stn];
         }
-        for (Block::LibertyIterator lib(adjBlock->m_liberties); lib; ++lib)
-            if (m_marker.NewMark(*lib))
-                largestBlock->m_liberties.PushBack(*lib);
+        while (stn != adjAnchor);
+        // Splice the stone rings
+        std::swap(m_nextStone[anchor], m_nextStone[adjAnchor]);
+        largestBlock->m_nuStones += adjBlock->m_nuStones;
+        for (int i = 0; i < m_nuLibertyWords; ++i)
+            largestBlock->m_liberties[i] |= adjBlock->m_liberties[i];
     }
-    m_block[p] = largestBlock;
-    if (IsEmpty(p - SG_NS) && m_marker.NewMark(p - SG_NS))
-        largestBlock->m_liberties.PushBack(p - SG_NS);
-    if (IsEmpty(p - SG_WE) && m_marker.NewMark(p - SG_WE))
-        largestBlock->m_liberties.PushBack(p - SG_WE);
-    if (IsEmpty(p + SG_WE) && m_marker.NewMark(p + SG_WE))
-        largestBlock->m_liberties.PushBack(p + SG_WE);
-    if (IsEmpty(p + SG_NS) && m_marker.NewMark(p + SG_NS))
-        largestBlock->m_liberties.PushBack(p + SG_NS);
+    int nuLiberties = 0;
+    for (int i = 0; i < m_nuLibertyWords; ++i)
+        nuLiberties += BitCount(largestBlock->m_liberties[i]);
+    largestBlock->m_nuLiberties = nuLiberties;
+    AddStoneToBlock(p, largestBlock);
 }
 
 void GoUctBoard::UpdateBlocksAfterAddStone(SgPoint p, SgBlackWhite c,
@@ -234,6 +299,7 @@ void GoUctBoard::UpdateBlocksAfterAddStone(SgPoint p, SgBlackWhite c,
         else
             MergeBlocks(p, adjBlocks);
     }
+    UpdateLowLibBlock(m_block[p]);
 }
 
 void GoUctBoard::Init(const GoBoard& bd)
@@ -246,6 +312,12 @@ void GoUctBoard::Init(const GoBoard& bd)
     m_lastMove = bd.GetLastMove();
     m_secondLastMove = bd.Get2ndLastMove();
     m_toPlay = bd.ToPlay();
+    for (SgBWIterator it; it; ++it)
+    {
+        m_atariBlocks[*it].Clear();
+        m_twoLibBlocks[*it].Clear();
+        m_all[*it] = bd.All(*it);
+    }
     for (GoBoard::Iterator it(bd); it; ++it)
     {
         const SgPoint p = *it;
@@ -261,21 +333,75 @@ void GoUctBoard::Init(const GoBoard& bd)
             SG_ASSERT(c == m_color[p]);
             Block& block = m_blockArray[p];
             block.InitNewBlock(c, p);
+            // Link the stones to a ring starting at the anchor
+            SgPoint last = p;
             for (GoBoard::StoneIterator it2(bd, p); it2; ++it2)
             {
-                block.m_stones.PushBack(*it2);
                 m_block[*it2] = &block;
+                if (*it2 != p)
+                {
+                    m_nextStone[last] = *it2;
+                    last = *it2;
+                }
             }
+            m_nextStone[last] = p;
+            block.m_nuStones = bd.NumStones(p);
             for (GoBoard::LibertyIterator it2(bd, p); it2; ++it2)
-                block.m_liberties.PushBack(*it2);
+                block.AddLiberty(*it2);
+            UpdateLowLibBlock(&block);
         }
     }
+    if (m_maintainPatternCodes)
+        InitPatternCodes();
     CheckConsistency();
 }
 
+void GoUctBoard::InitPatternCodes()
+{
+    for (Iterator it(*this); it; ++it)
+    {
+        const SgPoint p = *it;
+        if (Line(p) > 1)
+            m_patternCode[p] = GoPattern3x3::CodeOf8Neighbors(*this, p);
+        else if (Pos(p) > 1)
+            m_patternCode[p] = GoPattern3x3::CodeOfEdgeNeighbors(*this, p);
+        else
+            m_patternCode[p] = 0;
+    }
+}
+
+void GoUctBoard::InitPatternWeights()
+{
+    m_patternWeight.Fill(SgArray<int,8>(0));
+    for (Iterator it(*this); it; ++it)
+    {
+        const SgPoint p = *it;
+        SgArray<int,8>& weight = m_patternWeight[p];
+        if (Line(p) > 1)
+        {
+            int w = 1;
+            for (int i = 7; i >= 0; --i, w *= 3)
+                weight[i] = w;
+        }
+        else if (Pos(p) > 1)
+        {
+            // Digits in the order of GoPattern3x3::CodeOfEdgeNeighbors()
+            const int up = Up(p);
+            const int other = GoPatternBase::OtherDir(up);
+            weight[PatternDirIndex(other)] = 81;
+            weight[PatternDirIndex(up + other)] = 27;
+            weight[PatternDirIndex(up)] = 9;
+            weight[PatternDirIndex(up - other)] = 3;
+            weight[PatternDirIndex(-other)] = 1;
+        }
+    }
+}
+
 void GoUctBoard::InitSize(const GoBoard& bd)
 {
     m_size = bd.Size();
+    m_nuLibertyWords = SgPointUtil::Pt(m_size, m_size) / 64 + 1;
+    SG_ASSERT(m_nuLibertyWords <= Block::NU_WORDS);
     m_nuNeighbors[SG_BLACK].Fill(0);
     m_nuNeighbors[SG_WHITE].Fill(0);
     m_nuNeighborsEmpty.Fill(0);
@@ -291,6 +417,45 @@ void GoUctBoard::InitSize(const GoBoard& bd)
             m_isBorder[p] = false;
     }
     m_const.ChangeSize(m_size);
+    InitPatternWeights();
+}
+
+void GoUctBoard::RestoreSnapshot()
+{
+    const Snapshot& snapshot = *m_snapshot;
+    SG_ASSERT(snapshot.m_size == m_size);
+    const int nuPoints = snapshot.m_nuPoints;
+    m_lastMove = snapshot.m_lastMove;
+    m_secondLastMove = snapshot.m_secondLastMove;
+    m_koPoint = snapshot.m_koPoint;
+    m_toPlay = snapshot.m_toPlay;
+    m_prisoners = snapshot.m_prisoners;
+    CopyPoints(m_block, snapshot.m_block, nuPoints);
+    CopyPoints(m_color, snapshot.m_color, nuPoints);
+    CopyPoints(m_nuNeighborsEmpty, snapshot.m_nuNeighborsEmpty, nuPoints);
+    CopyPoints(m_nuNeighbors[SG_BLACK], snapshot.m_nuNeighbors[SG_BLACK],
+               nuPoints);
+    CopyPoints(m_nuNeighbors[SG_WHITE], snapshot.m_nuNeighbors[SG_WHITE],
+               nuPoints);
+    CopyPoints(m_nextStone, snapshot.m_nextStone, nuPoints);
+    m_atariBlocks = snapshot.m_atariBlocks;
+    m_twoLibBlocks = snapshot.m_twoLibBlocks;
+    m_all = snapshot.m_all;
+    SG_ASSERT(snapshot.m_maintainPatternCodes == m_maintainPatternCodes);
+    if (m_maintainPatternCodes)
+        CopyPoints(m_patternCode, snapshot.m_patternCode, nuPoints);
+    for (SgArrayList<SgPoint,SG_MAX_ONBOARD>::Iterator
+             it(snapshot.m_anchors); it; ++it)
+        m_blockArray[*it] = snapshot.m_blockArray[*it];
+    m_capturedStones.Clear();
+    CheckConsistency();
+}
+
+GoUctBoard::AnchorList& GoUctBoard::LowLibList(SgBlackWhite c,
+                                               int nuLiberties)
+{
+    SG_ASSERTRANGE(nuLiberties, 1, 2);
+    return nuLiberties == 1 ? m_atariBlocks[c] : m_twoLibBlocks[c];
 }
 
 void GoUctBoard::NeighborBlocks(SgPoint p, SgBlackWhite c,
@@ -320,6 +485,7 @@ void GoUctBoard::AddStone(SgPoint p, SgBlackWhite c)
     SG_ASSERT(IsEmpty(p));
     SG_ASSERT_BW(c);
     m_color[p] = c;
+    m_all[c].Include(p);
     --m_nuNeighborsEmpty[p - SG_NS];
     --m_nuNeighborsEmpty[p - SG_WE];
     --m_nuNeighborsEmpty[p + SG_WE];
@@ -329,6 +495,8 @@ void GoUctBoard::AddStone(SgPoint p, SgBlackWhite c)
     ++nuNeighbors[p - SG_WE];
     ++nuNeighbors[p + SG_WE];
     ++nuNeighbors[p + SG_NS];
+    if (m_maintainPatternCodes)
+        UpdatePatternCodes(p, c - SG_EMPTY);
 }
 
 /** Remove liberty from adjacent blocks and kill opponent blocks without
@@ -344,60 +512,70 @@ void GoUctBoard::RemoveLibAndKill(SgPoint p, SgBlackWhite opp,
     if ((b = m_block[p - SG_NS]) != 0)
     {
         m_marker.Include(b->m_anchor);
-        b->m_liberties.Exclude(p);
+        b->RemoveLiberty(p);
         if (b->m_color == opp)
         {
-            if (b->m_liberties.Length() == 0)
+            if (b->m_nuLiberties == 0)
                 KillBlock(b);
+            else
+                UpdateLowLibBlock(b);
         }
         else
             ownAdjBlocks.PushBack(b);
     }
     if ((b = m_block[p - SG_WE]) != 0 && m_marker.NewMark(b->m_anchor))
     {
-        b->m_liberties.Exclude(p);
+        b->RemoveLiberty(p);
         if (b->m_color == opp)
         {
-            if (b->m_liberties.Length() == 0)
+            if (b->m_nuLiberties == 0)
                 KillBlock(b);
+            else
+                UpdateLowLibBlock(b);
         }
         else
             ownAdjBlocks.PushBack(b);
     }
     if ((b = m_block[p + SG_WE]) != 0 && m_marker.NewMark(b->m_anchor))
     {
-        b->m_liberties.Exclude(p);
+        b->RemoveLiberty(p);
         if (b->m_color == opp)
         {
-            if (b->m_liberties.Length() == 0)
+            if (b->m_nuLiberties == 0)
                 KillBlock(b);
+            else
+                UpdateLowLibBlock(b);
         }
         else
             ownAdjBlocks.PushBack(b);
     }
     if ((b = m_block[p + SG_NS]) != 0 && ! m_marker.Contains(b->m_anchor))
     {
-        b->m_liberties.Exclude(p);
+        b->RemoveLiberty(p);
         if (b->m_color == opp)
         {
-            if (b->m_liberties.Length() == 0)
+            if (b->m_nuLiberties == 0)
                 KillBlock(b);
+            else
+                UpdateLowLibBlock(b);
         }
         else
             ownAdjBlocks.PushBack(b);
     }
 }
 
-void GoUctBoard::KillBlock(const Block* block)
+void GoUctBoard::KillBlock(Block* block)
 {
+    RemoveLowLibBlock(block);
     SgBlackWhite c = block->m_color;
     SgBlackWhite opp = SgOppBW(c);
     SgArray<int,SG_MAXPOINT>& nuNeighbors = m_nuNeighbors[c];
-    for (Block::StoneIterator it(block->m_stones); it; ++it)
+    for (StoneIterator it(*this, block->m_anchor); it; ++it)
     {
         SgPoint p = *it;
         AddLibToAdjBlocks(p, opp);
         m_color[p] = SG_EMPTY;
+        m_all[c].Exclude(p);
         ++m_nuNeighborsEmpty[p - SG_NS];
         ++m_nuNeighborsEmpty[p - SG_WE];
         ++m_nuNeighborsEmpty[p + SG_WE];
@@ -406,10 +584,12 @@ void GoUctBoard::KillBlock(const Block* block)
         --nuNeighbors[p - SG_WE];
         --nuNeighbors[p + SG_WE];
         --nuNeighbors[p + SG_NS];
+        if (m_maintainPatternCodes)
+            UpdatePatternCodes(p, SG_EMPTY - c);
         m_capturedStones.PushBack(p);
         m_block[p] = 0;
     }
-    int nuStones = block->m_stones.Length();
+    int nuStones = block->m_nuStones;
     m_prisoners[c] += nuStones;
     if (nuStones == 1)
         // Remember that single stone was captured, check conditions on
@@ -417,6 +597,87 @@ void GoUctBoard::KillBlock(const Block* block)
         m_koPoint = block->m_anchor;
 }
 
+void GoUctBoard::RemoveLowLibBlock(Block* block)
+{
+    if (block->m_lowLibList == 0)
+        return;
+    AnchorList& anchors = LowLibList(block->m_color, block->m_lowLibList);
+    const int index = block->m_lowLibIndex;
+    SG_ASSERT(anchors[index] == block->m_anchor);
+    // Move the last anchor into the free place
+    const SgPoint last = anchors.Last();
+    anchors[index] = last;
+    m_blockArray[last].m_lowLibIndex = index;
+    anchors.PopBack();
+    block->m_lowLibList = 0;
+}
+
+void GoUctBoard::SetMaintainPatternCodes(bool enable)
+{
+    m_maintainPatternCodes = enable;
+    if (enable)
+        InitPatternCodes();
+}
+
+void GoUctBoard::TakeSnapshot()
+{
+    Snapshot& snapshot = *m_snapshot;
+    snapshot.m_size = m_size;
+    snapshot.m_nuPoints = SgPointUtil::Pt(m_size, m_size) + SG_NS + 2;
+    snapshot.m_lastMove = m_lastMove;
+    snapshot.m_secondLastMove = m_secondLastMove;
+    snapshot.m_koPoint = m_koPoint;
+    snapshot.m_toPlay = m_toPlay;
+    snapshot.m_block = m_block;
+    snapshot.m_prisoners = m_prisoners;
+    snapshot.m_color = m_color;
+    snapshot.m_nuNeighborsEmpty = m_nuNeighborsEmpty;
+    snapshot.m_nuNeighbors = m_nuNeighbors;
+    snapshot.m_nextStone = m_nextStone;
+    snapshot.m_atariBlocks = m_atariBlocks;
+    snapshot.m_twoLibBlocks = m_twoLibBlocks;
+    snapshot.m_all = m_all;
+    snapshot.m_maintainPatternCodes = m_maintainPatternCodes;
+    if (m_maintainPatternCodes)
+        snapshot.m_patternCode = m_patternCode;
+    snapshot.m_anchors.Clear();
+    for (Iterator it(*this); it; ++it)
+    {
+        const SgPoint p = *it;
+        const Block* block = m_block[p];
+        if (block != 0 && block->m_anchor == p)
+        {
+            snapshot.m_anchors.PushBack(p);
+            snapshot.m_blockArray[p] = *block;
+        }
+    }
+}
+
+void GoUctBoard::UpdateLowLibBlock(Block* block)
+{
+    const int nuLiberties = block->m_nuLiberties;
+    const int list = (nuLiberties <= 2 ? nuLiberties : 0);
+    if (list == block->m_lowLibList)
+        return;
+    RemoveLowLibBlock(block);
+    if (list > 0)
+    {
+        AnchorList& anchors = LowLibList(block->m_color, list);
+        block->m_lowLibList = list;
+        block->m_lowLibIndex = anchors.Length();
+        anchors.PushBack(block->m_anchor);
+    }
+}
+
+void GoUctBoard::UpdatePatternCodes(SgPoint p, int delta)
+{
+    for (int i = 0; i < 8; ++i)
+    {
+        const SgPoint nb = p - PATTERN_DIR[i];
+        m_patternCode[nb] += delta * m_patternWeight[nb][i];
+    }
+}
+
 void GoUctBoard::Play(SgPoint p)
 {
     SG_ASSERT(p >= 0); // No special move, see SgMove
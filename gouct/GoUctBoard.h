@@ -8,6 +8,7 @@
 
 #include <bitset>
 #include <cstring>
+#include <memory>
 #include <stdint.h>
 #include <boost/static_assert.hpp>
 #include "GoBoard.h"
@@ -19,6 +20,7 @@
 #include "SgBoardColor.h"
 #include "SgMarker.h"
 #include "SgBWArray.h"
+#include "SgBWSet.h"
 #include "SgNbIterator.h"
 #include "SgPoint.h"
 #include "SgPointArray.h"
@@ -77,6 +79,13 @@ public:
 
     bool IsColor(SgPoint p, int c) const;
 
+    /** All points of color c.
+        Maintained incrementally by Play(), so that the final position of a
+        playout can be scored with set operations (see
+        GoBoardUtil::TrompTaylorScoreBitset()) instead of loops over the
+        points of the board. Same interface as GoBoard::All(). */
+    const SgPointSet& All(SgBlackWhite c) const;
+
     SgBoardColor GetColor(SgPoint p) const;
 
     SgBlackWhite GetStone(SgPoint p) const;
@@ -267,40 +276,97 @@ public:
         ignoring any possible repetition. */
     bool CanCapture(SgPoint p, SgBlackWhite c) const;
 
+    /** %List of anchors of blocks with a small number of liberties. */
+    typedef SgArrayList<SgPoint,SG_MAX_ONBOARD> AnchorList;
+
+    /** Anchors of all blocks of color c in atari.
+        Maintained incrementally by Play(), so that the playout heuristics
+        for captures and atari defense do not need to search the board for
+        blocks in atari. The order of the anchors is undefined. */
+    const AnchorList& AtariBlocks(SgBlackWhite c) const;
+
+    /** Anchors of all blocks of color c with two liberties.
+        @see AtariBlocks() */
+    const AnchorList& TwoLibertyBlocks(SgBlackWhite c) const;
+
     /** Checks whether all the board data structures are in a consistent
         state. */
     void CheckConsistency() const;
 
+    /** Remember the current position for quickly restoring it.
+        Only the flat arrays and the blocks currently on the board are
+        copied, which is cheaper than re-initializing the board from a
+        GoBoard with Init(). */
+    void TakeSnapshot();
+
+    /** Restore a snapshot.
+        Can only be called, if previously TakeSnapshot() was called and the
+        board size was not changed since then. RestoreSnapshot() can be used
+        multiple times for the same snapshot.
+        @see TakeSnapshot() */
+    void RestoreSnapshot();
+
+    /** Maintain the 3x3 pattern codes of all points incrementally.
+        If enabled, Play() updates the pattern codes of the neighbors of
+        added and captured stones, and PatternCode() is a single array
+        lookup. Default is false. */
+    void SetMaintainPatternCodes(bool enable);
+
+    /** See SetMaintainPatternCodes() */
+    bool MaintainPatternCodes() const;
+
+    /** The 3x3 pattern code of a point.
+        For points with Line(p) > 1, the same as
+        GoPattern3x3::CodeOf8Neighbors(); for points with Line(p) == 1 and
+        Pos(p) > 1, the same as GoPattern3x3::CodeOfEdgeNeighbors().
+        Requires: MaintainPatternCodes() */
+    int PatternCode(SgPoint p) const;
+
 private:
-    /** Data related to a block of stones on the board. */
+    /** Data related to a block of stones on the board.
+        The liberties are stored as a bitset over all points, the stones are
+        stored as a ring in GoUctBoard::m_nextStone, which keeps a block at
+        less than 100 bytes and makes merging blocks cheap. Only the first
+        GoUctBoard::m_nuLibertyWords words of the bitset can contain
+        liberties for the current board size; the other words are zero. */
     struct Block
     {
     public:
-        /** Upper limit for liberties.
-            Proof? */
-        static const int MAX_LIBERTIES = (SG_MAX_SIZE / 3) * 2 * SG_MAX_SIZE;
+        /** Number of words of the liberty bitset. */
+        static const int NU_WORDS = (SG_MAXPOINT + 63) / 64;
 
-        typedef SgArrayList<SgPoint,MAX_LIBERTIES> LibertyList;
+        SgPoint m_anchor;
 
-        typedef LibertyList::Iterator LibertyIterator;
+        SgBlackWhite m_color;
 
-        typedef GoPointList::Iterator StoneIterator;
+        int m_nuStones;
 
-        SgPoint m_anchor;
+        int m_nuLiberties;
 
-        SgBlackWhite m_color;
+        /** Number of liberties of the list of low-liberty blocks that
+            contains the anchor of this block (0, if not contained).
+            See GoUctBoard::AtariBlocks() and GoUctBoard::TwoLibertyBlocks() */
+        int m_lowLibList;
 
-        LibertyList m_liberties;
+        /** Index of the anchor in the list of low-liberty blocks. */
+        int m_lowLibIndex;
 
-        GoPointList m_stones;
+        uint64_t m_liberties[NU_WORDS];
 
-        void InitSingleStoneBlock(SgBlackWhite c, SgPoint anchor)
+        void AddLiberty(SgPoint p)
         {
-            SG_ASSERT_BW(c);
-            m_color = c;
-            m_anchor = anchor;
-            m_stones.SetTo(anchor);
-            m_liberties.Clear();
+            uint64_t& word = m_liberties[p / 64];
+            const uint64_t bit = uint64_t(1) << (p % 64);
+            if ((word & bit) == 0)
+            {
+                word |= bit;
+                ++m_nuLiberties;
+            }
+        }
+
+        bool HasLiberty(SgPoint p) const
+        {
+            return (m_liberties[p / 64] & (uint64_t(1) << (p % 64))) != 0;
         }
 
         void InitNewBlock(SgBlackWhite c, SgPoint anchor)
@@ -308,11 +374,74 @@ private:
             SG_ASSERT_BW(c);
             m_color = c;
             m_anchor = anchor;
-            m_stones.Clear();
-            m_liberties.Clear();
+            m_nuStones = 0;
+            m_nuLiberties = 0;
+            m_lowLibList = 0;
+            std::memset(m_liberties, 0, sizeof(m_liberties));
+        }
+
+        void RemoveLiberty(SgPoint p)
+        {
+            uint64_t& word = m_liberties[p / 64];
+            const uint64_t bit = uint64_t(1) << (p % 64);
+            if ((word & bit) != 0)
+            {
+                word &= ~bit;
+                --m_nuLiberties;
+            }
         }
     };
 
+    /** Data that can be restored quickly with TakeSnapshot/RestoreSnapshot.
+        Excludes data that is only defined immediately after a function call
+        (captured stones) or constant for the board size. */
+    struct Snapshot
+    {
+        /** Board size; -1, if no snapshot was made. */
+        SgGrid m_size;
+
+        /** Number of elements of the point arrays that are used for the
+            board size.
+            Includes the border points above the last row. */
+        int m_nuPoints;
+
+        SgPoint m_lastMove;
+
+        SgPoint m_secondLastMove;
+
+        SgPoint m_koPoint;
+
+        SgBlackWhite m_toPlay;
+
+        SgArray<Block*,SG_MAXPOINT> m_block;
+
+        SgBWArray<int> m_prisoners;
+
+        SgArray<int,SG_MAXPOINT> m_color;
+
+        SgArray<int,SG_MAXPOINT> m_nuNeighborsEmpty;
+
+        SgBWArray<SgArray<int,SG_MAXPOINT> > m_nuNeighbors;
+
+        SgArray<SgPoint,SG_MAXPOINT> m_nextStone;
+
+        /** Anchors of the blocks on the board. */
+        SgArrayList<SgPoint,SG_MAX_ONBOARD> m_anchors;
+
+        /** State of blocks on the board (only defined at the anchors). */
+        SgPointArray<Block> m_blockArray;
+
+        SgBWArray<AnchorList> m_atariBlocks;
+
+        SgBWArray<AnchorList> m_twoLibBlocks;
+
+        SgBWSet m_all;
+
+        bool m_maintainPatternCodes;
+
+        SgArray<int,SG_MAXPOINT> m_patternCode;
+    };
+
     SgPoint m_lastMove;
 
     SgPoint m_secondLastMove;
@@ -345,14 +474,49 @@ private:
 
     SgPointArray<Block> m_blockArray;
 
+    /** Next stone in the ring of stones of a block.
+        Only defined for occupied points. */
+    SgArray<SgPoint,SG_MAXPOINT> m_nextStone;
+
     mutable SgMarker m_marker;
 
     SgMarker m_marker2;
 
     GoPointList m_capturedStones;
 
+    /** See AtariBlocks() */
+    SgBWArray<AnchorList> m_atariBlocks;
+
+    /** See TwoLibertyBlocks() */
+    SgBWArray<AnchorList> m_twoLibBlocks;
+
+    /** See All() */
+    SgBWSet m_all;
+
     SgArray<bool,SG_MAXPOINT> m_isBorder;
 
+    /** Number of words of Block::m_liberties that contain the points of
+        the current board size.
+        Loops over the liberty bitsets use this instead of Block::NU_WORDS,
+        so that they are as short as with a build for the maximum board size
+        equal to the current size. */
+    int m_nuLibertyWords;
+
+    /** See SetMaintainPatternCodes() */
+    bool m_maintainPatternCodes;
+
+    /** See PatternCode() */
+    SgArray<int,SG_MAXPOINT> m_patternCode;
+
+    /** Weights of the neighbors of a point in its pattern code.
+        Indexed by the point and the direction index of the neighbor in the
+        order used by GoPattern3x3::CodeOf8Neighbors(). The weight is zero
+        for neighbors that are not part of the pattern of the point. Only
+        depends on the board size. */
+    SgArray<SgArray<int,8>,SG_MAXPOINT> m_patternWeight;
+
+    std::auto_ptr<Snapshot> m_snapshot;
+
     /** Not implemented. */
     GoUctBoard(const GoUctBoard&);
 
@@ -367,8 +531,6 @@ private:
 
     void InitSize(const GoBoard& bd);
 
-    bool IsAdjacentTo(SgPoint p, const Block* block) const;
-
     void MergeBlocks(SgPoint p, const SgArrayList<Block*,4>& adjBlocks);
 
     void RemoveLibAndKill(SgPoint p, SgBlackWhite opp,
@@ -383,10 +545,35 @@ private:
 
     void AddStone(SgPoint p, SgBlackWhite c);
 
-    void KillBlock(const Block* block);
+    void KillBlock(Block* block);
+
+    /** List of low-liberty blocks for a number of liberties in [1..2]. */
+    AnchorList& LowLibList(SgBlackWhite c, int nuLiberties);
+
+    /** Remove a block from the lists of low-liberty blocks.
+        Used for blocks that are captured or merged into another block. */
+    void RemoveLowLibBlock(Block* block);
+
+    /** Add or remove a block to the lists of low-liberty blocks after its
+        number of liberties changed. */
+    void UpdateLowLibBlock(Block* block);
 
     bool HasLiberties(SgPoint p) const;
 
+    void InitPatternCodes();
+
+    void InitPatternWeights();
+
+    /** Update the pattern codes of the neighbors of a point, after the
+        color of the point changed by delta. */
+    void UpdatePatternCodes(SgPoint p, int delta);
+
+    /** Number of bits set in a word. */
+    static int BitCount(uint64_t bits);
+
+    /** Index of the lowest bit set in a non-zero word. */
+    static int LowestBit(uint64_t bits);
+
 public:
     friend class LibertyIterator;
     friend class StoneIterator;
@@ -418,9 +605,17 @@ public:
         operator bool() const;
 
     private:
-        GoUctBoard::Block::LibertyList::Iterator m_it;
+        const uint64_t* m_liberties;
 
-        const GoUctBoard& m_board;
+        /** See GoUctBoard::m_nuLibertyWords */
+        const int m_nuWords;
+
+        int m_word;
+
+        /** Bits of the current word, which were not visited yet. */
+        uint64_t m_bits;
+
+        void SkipEmptyWords();
 
         /** Not implemented.
             Prevent unintended usage of operator bool() as an int.
@@ -454,10 +649,12 @@ public:
         operator bool() const;
 
     private:
-        GoUctBoard::Block::StoneIterator m_it;
-
         const GoUctBoard& m_board;
 
+        SgPoint m_first;
+
+        SgPoint m_current;
+
         /** Not implemented.
             Prevent unintended usage of operator bool() as an int.
             Detects bug of forgetting to dereference iterator - 
@@ -487,48 +684,62 @@ inline GoUctBoard::Iterator::Iterator(const GoUctBoard& bd)
 
 inline GoUctBoard::LibertyIterator::LibertyIterator(const GoUctBoard& bd,
                                                     SgPoint p)
-    : m_it(bd.m_block[p]->m_liberties),
-      m_board(bd)
+    : m_liberties(bd.m_block[p]->m_liberties),
+      m_nuWords(bd.m_nuLibertyWords),
+      m_word(0),
+      m_bits(m_liberties[0])
 {
-    SG_ASSERT(m_board.Occupied(p));
+    SG_ASSERT(bd.Occupied(p));
+    SkipEmptyWords();
 }
 
 inline void GoUctBoard::LibertyIterator::operator++()
 {
-    ++m_it;
+    m_bits &= m_bits - 1;
+    SkipEmptyWords();
 }
 
 inline SgPoint GoUctBoard::LibertyIterator::operator*() const
 {
-    return *m_it;
+    SG_ASSERT(m_bits != 0);
+    return m_word * 64 + LowestBit(m_bits);
 }
 
 inline GoUctBoard::LibertyIterator::operator bool() const
 {
-    return m_it;
+    return m_word < m_nuWords;
+}
+
+inline void GoUctBoard::LibertyIterator::SkipEmptyWords()
+{
+    while (m_bits == 0 && ++m_word < m_nuWords)
+        m_bits = m_liberties[m_word];
 }
 
 inline GoUctBoard::StoneIterator::StoneIterator(const GoUctBoard& bd,
                                                 SgPoint p)
-    : m_it(bd.m_block[p]->m_stones),
-      m_board(bd)
+    : m_board(bd),
+      m_first(p),
+      m_current(p)
 {
     SG_ASSERT(m_board.Occupied(p));
 }
 
 inline void GoUctBoard::StoneIterator::operator++()
 {
-    ++m_it;
+    m_current = m_board.m_nextStone[m_current];
+    if (m_current == m_first)
+        m_current = SG_NULLPOINT;
 }
 
 inline SgPoint GoUctBoard::StoneIterator::operator*() const
 {
-    return *m_it;
+    return m_current;
 }
 
 inline GoUctBoard::StoneIterator::operator bool() const
 {
-    return m_it;
+    return m_current != SG_NULLPOINT;
 }
 
 inline int GoUctBoard::AdjacentBlocks(SgPoint point, int maxLib,
@@ -570,6 +781,11 @@ inline int GoUctBoard::AdjacentBlocks(SgPoint point, int maxLib,
     return n;
 }
 
+inline const SgPointSet& GoUctBoard::All(SgBlackWhite c) const
+{
+    return m_all[c];
+}
+
 inline SgPoint GoUctBoard::Anchor(SgPoint p) const
 {
     SG_ASSERT(Occupied(p));
@@ -591,6 +807,12 @@ inline bool GoUctBoard::AtMostNumLibs(SgPoint block, int n) const
     return NumLiberties(block) <= n;
 }
 
+inline const GoUctBoard::AnchorList&
+GoUctBoard::AtariBlocks(SgBlackWhite c) const
+{
+    return m_atariBlocks[c];
+}
+
 inline const GoPointList& GoUctBoard::CapturedStones() const
 {
     return m_capturedStones;
@@ -678,13 +900,19 @@ inline bool GoUctBoard::IsLibertyOfBlock(SgPoint p, SgPoint anchor) const
     SG_ASSERT(IsEmpty(p));
     SG_ASSERT(Occupied(anchor));
     SG_ASSERT(Anchor(anchor) == anchor);
-    const Block* b = m_block[anchor];
-    if (m_nuNeighbors[b->m_color][p] == 0)
-        return false;
-    return (   m_block[p - SG_NS] == b
-            || m_block[p - SG_WE] == b
-            || m_block[p + SG_WE] == b
-            || m_block[p + SG_NS] == b);
+    return m_block[anchor]->HasLiberty(p);
+}
+
+inline int GoUctBoard::BitCount(uint64_t bits)
+{
+#ifdef __GNUC__
+    return __builtin_popcountll(bits);
+#else
+    int n = 0;
+    for ( ; bits != 0; bits &= bits - 1)
+        ++n;
+    return n;
+#endif
 }
 
 inline bool GoUctBoard::CanCapture(SgPoint p, SgBlackWhite c) const
@@ -778,6 +1006,19 @@ inline int GoUctBoard::Left(SgPoint p) const
     return m_const.Left(p);
 }
 
+inline int GoUctBoard::LowestBit(uint64_t bits)
+{
+    SG_ASSERT(bits != 0);
+#ifdef __GNUC__
+    return __builtin_ctzll(bits);
+#else
+    int n = 0;
+    for ( ; (bits & 1) == 0; bits >>= 1)
+        ++n;
+    return n;
+#endif
+}
+
 inline SgGrid GoUctBoard::Line(SgPoint p) const
 {
     return m_const.Line(p);
@@ -852,7 +1093,7 @@ inline int GoUctBoard::NumLiberties(SgPoint p) const
 {
     SG_ASSERT(IsValidPoint(p));
     SG_ASSERT(Occupied(p));
-    return m_block[p]->m_liberties.Length();
+    return m_block[p]->m_nuLiberties;
 }
 
 inline int GoUctBoard::NumNeighbors(SgPoint p, SgBlackWhite c) const
@@ -860,6 +1101,11 @@ inline int GoUctBoard::NumNeighbors(SgPoint p, SgBlackWhite c) const
     return m_nuNeighbors[c][p];
 }
 
+inline bool GoUctBoard::MaintainPatternCodes() const
+{
+    return m_maintainPatternCodes;
+}
+
 inline int GoUctBoard::NumPrisoners(SgBlackWhite color) const
 {
     return m_prisoners[color];
@@ -868,7 +1114,7 @@ inline int GoUctBoard::NumPrisoners(SgBlackWhite color) const
 inline int GoUctBoard::NumStones(SgPoint block) const
 {
     SG_ASSERT(Occupied(block));
-    return m_block[block]->m_stones.Length();
+    return m_block[block]->m_nuStones;
 }
 
 inline bool GoUctBoard::Occupied(SgPoint p) const
@@ -879,7 +1125,7 @@ inline bool GoUctBoard::Occupied(SgPoint p) const
 inline bool GoUctBoard::OccupiedInAtari(SgPoint p) const
 {
     const Block* b = m_block[p];
-    return (b != 0 && b->m_liberties.Length() <= 1);
+    return (b != 0 && b->m_nuLiberties <= 1);
 }
 
 inline SgBlackWhite GoUctBoard::Opponent() const
@@ -887,6 +1133,13 @@ inline SgBlackWhite GoUctBoard::Opponent() const
     return SgOppBW(m_toPlay);
 }
 
+inline int GoUctBoard::PatternCode(SgPoint p) const
+{
+    SG_ASSERT(m_maintainPatternCodes);
+    SG_ASSERT(IsValidPoint(p));
+    return m_patternCode[p];
+}
+
 inline SgGrid GoUctBoard::Pos(SgPoint p) const
 {
     return m_const.Pos(p);
@@ -911,7 +1164,7 @@ inline SgPoint GoUctBoard::TheLiberty(SgPoint p) const
 {
     SG_ASSERT(Occupied(p));
     SG_ASSERT(NumLiberties(p) == 1);
-    return m_block[p]->m_liberties[0];
+    return *LibertyIterator(*this, p);
 }
 
 inline SgBlackWhite GoUctBoard::ToPlay() const
@@ -919,6 +1172,12 @@ inline SgBlackWhite GoUctBoard::ToPlay() const
     return m_toPlay;
 }
 
+inline const GoUctBoard::AnchorList&
+GoUctBoard::TwoLibertyBlocks(SgBlackWhite c) const
+{
+    return m_twoLibBlocks[c];
+}
+
 inline int GoUctBoard::Up(SgPoint p) const
 {
     return m_const.Up(p);
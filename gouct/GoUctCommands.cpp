@@ -20,6 +20,7 @@
 #include "GoUctPatterns.h"
 #include "GoUctPlayer.h"
 #include "GoUctPlayoutPolicy.h"
+#include "GoUctTerritoryStatistics.h"
 #include "GoUctUtil.h"
 #include "GoUtil.h"
 #include "SgException.h"
@@ -305,12 +306,14 @@ void GoUctCommands::AddGoGuiAnalyzeCommands(GtpCommand& cmd)
         "dboard/Approximate Territory/approximate_territory\n"
         "none/Deterministic Mode/deterministic_mode\n"
         "gfx/Uct Additive Knowledge/uct_additive_knowledge\n"
+        "string/Uct Bench Threads/uct_bench_threads\n"
         "gfx/Uct Bounds/uct_bounds\n"
         "plist/Uct Default Policy/uct_default_policy\n"
         "gfx/Uct Gfx/uct_gfx\n"
         "none/IsPolicyCorrectedMove/is_policy_corrected_move\n"
         "none/IsPolicyMove/is_policy_move\n"
         "gfx/Uct Ladder Knowledge/uct_ladder_knowledge\n"
+        "none/Uct LoadTree Binary/uct_loadtree_binary %r\n"
         "none/Uct Max Memory/uct_max_memory %s\n"
         "plist/Uct Moves/uct_moves\n"
         "none/Uct Node Info/uct_node_info\n"
@@ -330,10 +333,12 @@ void GoUctCommands::AddGoGuiAnalyzeCommands(GtpCommand& cmd)
         "plist/Uct Root Filter/uct_root_filter\n"
         "none/Uct SaveGames/uct_savegames %w\n"
         "none/Uct SaveTree/uct_savetree %w\n"
+        "none/Uct SaveTree Binary/uct_savetree_binary %w\n"
         "gfx/Uct Sequence/uct_sequence\n"
         "hstring/Uct Stat Player/uct_stat_player\n"
         "none/Uct Stat Player Clear/uct_stat_player_clear\n"
         "hstring/Uct Stat Policy/uct_stat_policy\n"
+        "hstring/Uct Stat Profile/uct_stat_profile\n"
         "none/Uct Stat Policy Clear/uct_stat_policy_clear\n"
         "hstring/Uct Stat Search/uct_stat_search\n"
         "dboard/Uct Stat Territory/uct_stat_territory\n";
@@ -345,6 +350,59 @@ void GoUctCommands::CmdAdditiveKnowledge(GtpCommand& cmd)
 	DisplayKnowledge(cmd, true);
 }
 
+/** Measure the scaling of the search with the number of threads.
+    Runs searches in the current position with 1, 2, 4, ... threads up to a
+    maximum number, once with the shared tree and once in root-parallel mode
+    (see SgUctSearch::RootParallel), and returns a table with the games per
+    second and the speedup relative to one thread for both modes. Uses the
+    current search parameters (e.g. lock_free, pin_threads and
+    root_parallel_merge_interval in uct_param_search). The number of
+    threads and the mode are restored afterwards; the search tree is lost.
+    Arguments: [max_threads [games]] <br>
+    Default is 64 threads and 10000 games per search. */
+void GoUctCommands::CmdBenchThreads(GtpCommand& cmd)
+{
+    cmd.CheckNuArgLessEqual(2);
+    unsigned int maxThreads = 64;
+    if (cmd.NuArg() > 0)
+        maxThreads = cmd.ArgMin<unsigned int>(0, 1);
+    SgUctValue maxGames = 10000;
+    if (cmd.NuArg() > 1)
+        maxGames = cmd.ArgMin<SgUctValue>(1, 1);
+    GoUctSearch& search = Search();
+    const unsigned int numberThreads = search.NumberThreads();
+    const bool rootParallel = search.RootParallel();
+    cmd << "LockFree " << search.LockFree() << '\n'
+        << "PinThreads " << search.PinThreads() << '\n'
+        << "RootParallelMergeInterval "
+        << search.RootParallelMergeInterval() << '\n'
+        << "Threads    Shared Speedup   RootPar Speedup\n";
+    double gamesPerSecond1[2] = { 0, 0 };
+    for (unsigned int n = 1; n <= maxThreads; n *= 2)
+    {
+        search.SetNumberThreads(n);
+        cmd << format("%7d") % n;
+        for (int mode = 0; mode < 2; ++mode)
+        {
+            search.SetRootParallel(mode == 1);
+            std::vector<SgMove> sequence;
+            search.Search(maxGames, std::numeric_limits<double>::max(),
+                          sequence);
+            double gamesPerSecond = search.Statistics().m_gamesPerSecond;
+            if (n == 1)
+                gamesPerSecond1[mode] = gamesPerSecond;
+            cmd << format(" %9.0f %7.2f") % gamesPerSecond
+                % (gamesPerSecond1[mode] > 0 ?
+                   gamesPerSecond / gamesPerSecond1[mode] : 0);
+        }
+        cmd << '\n';
+        if (n > maxThreads / 2)
+            break;
+    }
+    search.SetNumberThreads(numberThreads);
+    search.SetRootParallel(rootParallel);
+}
+
 /** Show UCT bounds of moves in root node.
     This command is compatible with the GoGui analyze command type "gfx".
     Move bounds are shown as labels on the board, the pass move bound is
@@ -525,6 +583,25 @@ void GoUctCommands::CmdLadderKnowledge(GtpCommand& cmd)
     DisplayMoveInfo(cmd, moves, false);
 }
 
+/** Load a search tree saved with uct_savetree_binary.
+    The next search in the current position continues with the loaded tree.
+    The file must have been saved in a position with the same board size,
+    komi, color to play and stones on the board.
+    Arguments: filename
+    @see GoUctSearch::LoadTreeBinary() */
+void GoUctCommands::CmdLoadTreeBinary(GtpCommand& cmd)
+{
+    string fileName = cmd.Arg();
+    try
+    {
+        Search().LoadTreeBinary(fileName);
+    }
+    catch (const SgException& e)
+    {
+        throw GtpFailure(e.what());
+    }
+}
+
 /** Computes the maximum number of nodes in search tree given the
     maximum allowed memory for the tree. Assumes two trees. Returns
     current memory usage if no arguments.
@@ -601,6 +678,7 @@ void GoUctCommands::CmdParamFeatureKnowledge(GtpCommand& cmd)
             p.m_topN = cmd.Arg<int>(1);
         else
             throw GtpFailure() << "unknown parameter: " << name;
+        GlobalSearch().ClearPriorKnowledgeCache();
     }
     else
     throw GtpFailure() << "need 0 or 2 arguments";
@@ -616,6 +694,8 @@ void GoUctCommands::CmdParamFeatureKnowledge(GtpCommand& cmd)
         GoUctGlobalSearchStateParam::m_territoryStatistics
     @arg @c length_modification See
         GoUctGlobalSearchStateParam::m_langthModification
+    @arg @c prior_knowledge_cache_size See
+        GoUctGlobalSearch::PriorKnowledgeCacheSize
     @arg @c score_modification See
         GoUctGlobalSearchStateParam::m_scoreModification */
 void GoUctCommands::CmdParamGlobalSearch(GtpCommand& cmd)
@@ -642,6 +722,8 @@ void GoUctCommands::CmdParamGlobalSearch(GtpCommand& cmd)
             << p.m_additiveKnowledgeScale << '\n'
             << "[string] length_modification " << p.m_lengthModification
             << '\n'
+            << "[string] prior_knowledge_cache_size "
+            << s.PriorKnowledgeCacheSize() << '\n'
             << "[string] score_modification " << p.m_scoreModification
             << '\n'
             ;
@@ -665,10 +747,13 @@ void GoUctCommands::CmdParamGlobalSearch(GtpCommand& cmd)
         p.m_additiveKnowledgeScale = cmd.Arg<float>(1);
         else if (name == "length_modification")
             p.m_lengthModification = cmd.Arg<SgUctValue>(1);
+        else if (name == "prior_knowledge_cache_size")
+            s.SetPriorKnowledgeCacheSize(cmd.Arg<size_t>(1));
         else if (name == "score_modification")
             p.m_scoreModification = cmd.Arg<SgUctValue>(1);
         else
             throw GtpFailure() << "unknown parameter: " << name;
+        s.ClearPriorKnowledgeCache();
     }
     else
         throw GtpFailure() << "need 0 or 2 arguments";
@@ -685,6 +770,7 @@ void GoUctCommands::CmdParamGlobalSearch(GtpCommand& cmd)
     @arg @c ignore_clock See GoUctPlayer::IgnoreClock
     @arg @c ponder See GoUctPlayer::EnablePonder
     @arg @c reuse_subtree See GoUctPlayer::ReuseSubtree
+    @arg @c reuse_subtree_in_place See GoUctPlayer::ReuseSubtreeInPlace
     @arg @c use_root_filter See GoUctPlayer::UseRootFilter
     @arg @c max_games See GoUctPlayer::MaxGames
     @arg @c max_ponder_time See GoUctPlayer::MaxPonderTime
@@ -705,6 +791,8 @@ void GoUctCommands::CmdParamPlayer(GtpCommand& cmd)
             << "[bool] ignore_clock " << p.IgnoreClock() << '\n'
             << "[bool] ponder " << p.EnablePonder() << '\n'
             << "[bool] reuse_subtree " << p.ReuseSubtree() << '\n'
+            << "[bool] reuse_subtree_in_place " << p.ReuseSubtreeInPlace()
+            << '\n'
             << "[bool] use_root_filter " << p.UseRootFilter() << '\n'
             << "[string] max_games " << p.MaxGames() << '\n'
             << "[string] max_ponder_time " << p.MaxPonderTime() << '\n'
@@ -734,6 +822,8 @@ void GoUctCommands::CmdParamPlayer(GtpCommand& cmd)
             p.SetEnablePonder(cmd.Arg<bool>(1));
         else if (name == "reuse_subtree")
             p.SetReuseSubtree(cmd.Arg<bool>(1));
+        else if (name == "reuse_subtree_in_place")
+            p.SetReuseSubtreeInPlace(cmd.Arg<bool>(1));
         else if (name == "use_root_filter")
             p.SetUseRootFilter(cmd.Arg<bool>(1));
         else if (name == "max_games")
@@ -765,6 +855,10 @@ void GoUctCommands::CmdParamPlayer(GtpCommand& cmd)
         See GoUctPlayoutPolicyParam::m_statisticsEnabled
     @arg @c nakade_heuristic
         See GoUctPlayoutPolicyParam::m_useNakadeHeuristic
+    @arg @c full_board_gamma
+        See GoUctPlayoutPolicyParam::m_fullBoardGammaPlayout
+    @arg @c incremental_pattern_codes
+        See GoUctPlayoutPolicyParam::m_incrementalPatternCodes
     @arg @c fillboard_tries
         See GoUctPlayoutPolicyParam::m_fillboardTries */
 void GoUctCommands::CmdParamPolicy(GtpCommand& cmd)
@@ -775,7 +869,10 @@ void GoUctCommands::CmdParamPolicy(GtpCommand& cmd)
     {
         // Boolean parameters first for better layout of GoGui parameter
         // dialog, alphabetically otherwise
-        cmd << "[bool] nakade_heuristic " << p.m_useNakadeHeuristic << '\n'
+        cmd << "[bool] full_board_gamma " << p.m_fullBoardGammaPlayout << '\n'
+            << "[bool] incremental_pattern_codes "
+            << p.m_incrementalPatternCodes << '\n'
+            << "[bool] nakade_heuristic " << p.m_useNakadeHeuristic << '\n'
             << "[bool] statistics_enabled " << p.m_statisticsEnabled << '\n'
             << "[bool] use_patterns_in_playout " 
             << p.m_usePatternsInPlayout << '\n'
@@ -794,7 +891,11 @@ void GoUctCommands::CmdParamPolicy(GtpCommand& cmd)
     else if (cmd.NuArg() == 2)
     {
         string name = cmd.Arg(0);
-        if (name == "nakade_heuristic")
+        if (name == "full_board_gamma")
+            p.m_fullBoardGammaPlayout = cmd.Arg<bool>(1);
+        else if (name == "incremental_pattern_codes")
+            p.m_incrementalPatternCodes = cmd.Arg<bool>(1);
+        else if (name == "nakade_heuristic")
             p.m_useNakadeHeuristic = cmd.Arg<bool>(1);
         else if (name == "statistics_enabled")
             p.m_statisticsEnabled = cmd.Arg<bool>(1);
@@ -818,6 +919,7 @@ void GoUctCommands::CmdParamPolicy(GtpCommand& cmd)
             p.m_patternGammaThreshold = cmd.Arg<float>(1);
         else
             throw GtpFailure() << "unknown parameter: " << name;
+        GlobalSearch().ClearPriorKnowledgeCache();
     }
     else
         throw GtpFailure() << "need 0 or 2 arguments";
@@ -903,6 +1005,7 @@ void GoUctCommands::CmdParamTreeFilter(GtpCommand& cmd)
             p.SetFilterFirstLine(cmd.Arg<bool>(1));
         else
             throw GtpFailure() << "unknown parameter: " << name;
+        GlobalSearch().ClearPriorKnowledgeCache();
     }
     else
         throw GtpFailure() << "need 0 or 2 arguments";
@@ -916,13 +1019,17 @@ void GoUctCommands::CmdParamTreeFilter(GtpCommand& cmd)
     @arg @c keep_games See GoUctSearch::KeepGames
     @arg @c lock_free See SgUctSearch::LockFree
     @arg @c log_games See SgUctSearch::LogGames
+    @arg @c pin_threads See SgUctSearch::PinThreads
     @arg @c prune_full_tree See SgUctSearch::PruneFullTree
+    @arg @c prune_in_place See SgUctSearch::PruneInPlace
     @arg @c rave See SgUctSearch::Rave
+    @arg @c root_parallel See SgUctSearch::RootParallel
     @arg @c weight_rave_updates SgUctSearch::WeightRaveUpdates
     @arg @c bias_term_constant See SgUctSearch::BiasTermConstant
     @arg @c bias_term_frequency See SgUctSearch::BiasTermFrequency
     @arg @c expand_threshold See SgUctSearch::ExpandThreshold
     @arg @c first_play_urgency See SgUctSearch::FirstPlayUrgency
+    @arg @c knowledge_batch_size See SgUctSearch::KnowledgeBatchSize
     @arg @c knowledge_threshold See SgUctSearch::KnowledgeThreshold
     @arg @c live_gfx @c none|counts|sequence See GoUctSearch::LiveGfx
     @arg @c live_gfx_interval See GoUctSearch::LiveGfxInterval
@@ -932,7 +1039,11 @@ void GoUctCommands::CmdParamTreeFilter(GtpCommand& cmd)
     @arg @c number_playouts See SgUctSearch::NumberPlayouts
     @arg @c prune_min_count See SgUctSearch::PruneMinCount
     @arg @c rave_weight_final See SgUctSearch::RaveWeightFinal
-    @arg @c rave_weight_initial See SgUctSearch::RaveWeightInitial */
+    @arg @c rave_weight_initial See SgUctSearch::RaveWeightInitial
+    @arg @c root_parallel_merge_interval See
+    SgUctSearch::RootParallelMergeInterval
+    @arg @c transposition_mode @c none|uct1|uct2|uct3 See
+    SgUctSearch::TranspositionMode */
 void GoUctCommands::CmdParamSearch(GtpCommand& cmd)
 {
     cmd.CheckNuArgLessEqual(2);
@@ -946,8 +1057,11 @@ void GoUctCommands::CmdParamSearch(GtpCommand& cmd)
             << "[bool] keep_games " << s.KeepGames() << '\n'
             << "[bool] lock_free " << s.LockFree() << '\n'
             << "[bool] log_games " << s.LogGames() << '\n'
+            << "[bool] pin_threads " << s.PinThreads() << '\n'
             << "[bool] prune_full_tree " << s.PruneFullTree() << '\n'
+            << "[bool] prune_in_place " << s.PruneInPlace() << '\n'
             << "[bool] rave " << s.Rave() << '\n'
+            << "[bool] root_parallel " << s.RootParallel() << '\n'
             << "[bool] update_multiple_playouts_as_single " 
             << s.UpdateMultiplePlayoutsAsSingle() << '\n'
             << "[bool] virtual_loss " << s.VirtualLoss() << '\n'
@@ -960,6 +1074,8 @@ void GoUctCommands::CmdParamSearch(GtpCommand& cmd)
             << "[string] bias_term_depth " << s.BiasTermDepth() << '\n'
             << "[string] expand_threshold " << s.ExpandThreshold() << '\n'
             << "[string] first_play_urgency " << s.FirstPlayUrgency() << '\n'
+            << "[string] knowledge_batch_size "
+            << s.KnowledgeBatchSize() << '\n'
             << "[string] knowledge_threshold "
             << KnowledgeThresholdToString(s.KnowledgeThreshold()) << '\n'
             << "[string] max_knowledge_threads " 
@@ -978,6 +1094,11 @@ void GoUctCommands::CmdParamSearch(GtpCommand& cmd)
             << "[string] rave_weight_final " << s.RaveWeightFinal() << '\n'
             << "[string] rave_weight_initial "
             << s.RaveWeightInitial() << '\n'
+            << "[string] root_parallel_merge_interval "
+            << s.RootParallelMergeInterval() << '\n'
+            << "[list/none/uct1/uct2/uct3] transposition_mode "
+            << SgGtpUtil::TranspositionModeToString(s.TranspositionMode())
+            << '\n'
             ;
     }
     else if (cmd.NuArg() == 2)
@@ -1005,6 +1126,8 @@ void GoUctCommands::CmdParamSearch(GtpCommand& cmd)
             s.SetFirstPlayUrgency(cmd.Arg<SgUctValue>(1));
         else if (name == "keep_games")
             s.SetKeepGames(cmd.Arg<bool>(1));
+        else if (name == "knowledge_batch_size")
+            s.SetKnowledgeBatchSize(cmd.Arg<size_t>(1));
         else if (name == "knowledge_threshold")
             s.SetKnowledgeThreshold(KnowledgeThresholdFromString(cmd.Arg(1)));
         else if (name == "live_gfx")
@@ -1025,8 +1148,12 @@ void GoUctCommands::CmdParamSearch(GtpCommand& cmd)
              s.SetNumberThreads(cmd.ArgMin<unsigned int>(1, 1));
         else if (name == "number_playouts")
             s.SetNumberPlayouts(cmd.ArgMin<int>(1, 1));
+        else if (name == "pin_threads")
+            s.SetPinThreads(cmd.Arg<bool>(1));
         else if (name == "prune_full_tree")
             s.SetPruneFullTree(cmd.Arg<bool>(1));
+        else if (name == "prune_in_place")
+            s.SetPruneInPlace(cmd.Arg<bool>(1));
         else if (name == "prune_min_count")
             s.SetPruneMinCount(cmd.ArgMin<SgUctValue>(1, SgUctValue(1)));
         else if (name == "randomize_rave_frequency")
@@ -1037,6 +1164,12 @@ void GoUctCommands::CmdParamSearch(GtpCommand& cmd)
             s.SetRaveWeightFinal(cmd.Arg<float>(1));
         else if (name == "rave_weight_initial")
             s.SetRaveWeightInitial(cmd.Arg<float>(1));
+        else if (name == "root_parallel")
+            s.SetRootParallel(cmd.Arg<bool>(1));
+        else if (name == "root_parallel_merge_interval")
+            s.SetRootParallelMergeInterval(cmd.Arg<size_t>(1));
+        else if (name == "transposition_mode")
+            s.SetTranspositionMode(SgGtpUtil::TranspositionModeArg(cmd, 1));
         else if (name == "update_multiple_playouts_as_single")
             s.SetUpdateMultiplePlayoutsAsSingle(cmd.Arg<bool>(1));
         else if (name == "virtual_loss")
@@ -1240,6 +1373,25 @@ void GoUctCommands::CmdSaveTree(GtpCommand& cmd)
     }
 }
 
+/** Save the UCT tree for the current position in binary format.
+    The saved tree can be loaded with uct_loadtree_binary. The current
+    position must be the position of the last search or a follow-up
+    position contained in the search tree.
+    Arguments: filename
+    @see GoUctSearch::SaveTreeBinary() */
+void GoUctCommands::CmdSaveTreeBinary(GtpCommand& cmd)
+{
+    string fileName = cmd.Arg();
+    try
+    {
+        Search().SaveTreeBinary(fileName);
+    }
+    catch (const SgException& e)
+    {
+        throw GtpFailure(e.what());
+    }
+}
+
 /** Save all random games.
     Arguments: filename
     @see GoUctSearch::SaveGames() */
@@ -1322,6 +1474,23 @@ void GoUctCommands::CmdStatPolicy(GtpCommand& cmd)
     Policy(0).Statistics(SG_WHITE).Write(cmd);
 }
 
+/** Write the time profile of the phases of the games in the search.
+    Arguments: none <br>
+    Writes the number of calls, the total and mean ticks and a histogram of
+    the ticks per call for each phase, merged over all threads. Needs
+    compiling with the configure option --enable-uct-profile.
+    @see SgUctProfile */
+void GoUctCommands::CmdStatProfile(GtpCommand& cmd)
+{
+    cmd.CheckArgNone();
+    if (! SG_UCTPROFILE_ENABLED)
+        throw GtpFailure("profile not enabled, "
+                         "configure with --enable-uct-profile");
+    SgUctProfile profile;
+    Search().GetProfile(profile);
+    profile.Write(cmd);
+}
+
 /** Clear statistics of GoUctPlayoutPolicy
     Arguments: none <br>
     Only the statistics of the first thread's policy used.
@@ -1385,16 +1554,16 @@ SgUctValue GoUctCommands::DisplayTerritory(GtpCommand& cmd,
                                            MeanMapperFunction f)
 {
     cmd.CheckArgNone();
-    SgPointArray<SgUctStatistics> territoryStatistics
-        = ThreadState(0).m_territoryStatistics;
+    GoUctTerritoryStatistics territoryStatistics;
+    GlobalSearch().GetTerritoryStatistics(territoryStatistics);
+    if (territoryStatistics.Count() == 0)
+        throw GtpFailure("no statistics available: "
+                         "enable them and run search first");
     SgPointArray<SgUctValue> array(0);
     SgUctValue sum = SgUctValue(0);
     for (GoBoard::Iterator it(m_bd); it; ++it)
     {
-        if (territoryStatistics[*it].Count() == 0)
-            throw GtpFailure("no statistics available: "
-                             "enable them and run search first");
-        array[*it] = f(territoryStatistics[*it].Mean());
+        array[*it] = f(territoryStatistics.Mean(*it));
         sum += array[*it];
     }
     cmd << '\n'
@@ -1575,8 +1744,12 @@ SgPointSet GoUctCommands::DoFinalStatusSearch()
     }
     m_player->UpdateSubscriber();
 
-    SgPointArray<SgUctStatistics> territoryStatistics =
-        ThreadState(0).m_territoryStatistics;
+    GoUctTerritoryStatistics territoryStatistics;
+    search.GetTerritoryStatistics(territoryStatistics);
+    if (territoryStatistics.Count() == 0)
+        // No statistics, maybe all simulations aborted due to max length or
+        // mercy rule.
+        return deadStones;
     GoSafetySolver safetySolver(bd);
     SgBWSet safe;
     safetySolver.FindSafePoints(&safe);
@@ -1588,13 +1761,7 @@ SgPointSet GoUctCommands::DoFinalStatusSearch()
         {
             SgStatistics<SgUctValue,int> averageStatus;
             for (GoBoard::StoneIterator it2(bd, *it); it2; ++it2)
-            {
-                if (territoryStatistics[*it2].Count() == 0)
-                    // No statistics, maybe all simulations aborted due to
-                    // max length or mercy rule.
-                    return deadStones;
-                averageStatus.Add(territoryStatistics[*it2].Mean());
-            }
+                averageStatus.Add(territoryStatistics.Mean(*it2));
             const float threshold = 0.3f;
             isDead =
                     (c == SG_BLACK && averageStatus.Mean() < threshold)
@@ -1652,11 +1819,13 @@ void GoUctCommands::Register(GtpEngine& e)
              &GoUctCommands::CmdIsPolicyMove);
     Register(e, "uct_additive_knowledge",
              &GoUctCommands::CmdAdditiveKnowledge);
+    Register(e, "uct_bench_threads", &GoUctCommands::CmdBenchThreads);
     Register(e, "uct_bounds", &GoUctCommands::CmdBounds);
     Register(e, "uct_default_policy", &GoUctCommands::CmdDefaultPolicy);
     Register(e, "uct_estimator_stat", &GoUctCommands::CmdEstimatorStat);
     Register(e, "uct_gfx", &GoUctCommands::CmdGfx);
     Register(e, "uct_ladder_knowledge", &GoUctCommands::CmdLadderKnowledge);
+    Register(e, "uct_loadtree_binary", &GoUctCommands::CmdLoadTreeBinary);
     Register(e, "uct_max_memory", &GoUctCommands::CmdMaxMemory);
     Register(e, "uct_moves", &GoUctCommands::CmdMoves);
     Register(e, "uct_node_info", &GoUctCommands::CmdNodeInfo);
@@ -1680,12 +1849,14 @@ void GoUctCommands::Register(GtpEngine& e)
     Register(e, "uct_root_filter", &GoUctCommands::CmdRootFilter);
     Register(e, "uct_savegames", &GoUctCommands::CmdSaveGames);
     Register(e, "uct_savetree", &GoUctCommands::CmdSaveTree);
+    Register(e, "uct_savetree_binary", &GoUctCommands::CmdSaveTreeBinary);
     Register(e, "uct_sequence", &GoUctCommands::CmdSequence);
     Register(e, "uct_score", &GoUctCommands::CmdScore);
     Register(e, "uct_stat_player", &GoUctCommands::CmdStatPlayer);
     Register(e, "uct_stat_player_clear", &GoUctCommands::CmdStatPlayerClear);
     Register(e, "uct_stat_policy", &GoUctCommands::CmdStatPolicy);
     Register(e, "uct_stat_policy_clear", &GoUctCommands::CmdStatPolicyClear);
+    Register(e, "uct_stat_profile", &GoUctCommands::CmdStatProfile);
     Register(e, "uct_stat_search", &GoUctCommands::CmdStatSearch);
     Register(e, "uct_stat_territory", &GoUctCommands::CmdStatTerritory);
     Register(e, "uct_value", &GoUctCommands::CmdValue);
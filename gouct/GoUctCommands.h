@@ -54,6 +54,7 @@ public:
         - @link CmdFinalScore() @c final_score @endlink
         - @link CmdFinalStatusList() @c final_status_list @endlink
         - @link CmdAdditiveKnowledge() @c uct_additive_knowledge @endlink
+        - @link CmdBenchThreads() @c uct_bench_threads @endlink
         - @link CmdBounds() @c uct_bounds @endlink
         - @link CmdDefaultPolicy() @c uct_default_policy @endlink
         - @link CmdDeterministicMode() @c deterministic_mode @endlink
@@ -62,6 +63,7 @@ public:
         - @link CmdIsPolicyCorrectedMove() @c is_policy_corrected_move
           @endlink
         - @link CmdLadderKnowledge() @c uct_ladder_knowledge @endlink
+        - @link CmdLoadTreeBinary() @c uct_loadtree_binary @endlink
         - @link CmdMaxMemory() @c uct_max_memory @endlink
         - @link CmdMoves() @c uct_moves @endlink
         - @link CmdNodeInfo() @c uct_node_info @endlink
@@ -81,12 +83,14 @@ public:
         - @link CmdRootFilter() @c uct_root_filter @endlink
         - @link CmdSaveGames() @c uct_savegames @endlink
         - @link CmdSaveTree() @c uct_savetree @endlink
+        - @link CmdSaveTreeBinary() @c uct_savetree_binary @endlink
         - @link CmdSequence() @c uct_sequence @endlink
         - @link CmdScore() @c uct_score @endlink
         - @link CmdStatPlayer() @c uct_stat_player @endlink
         - @link CmdStatPlayerClear() @c uct_stat_player_clear @endlink
         - @link CmdStatPolicy() @c uct_stat_policy @endlink
         - @link CmdStatPolicyClear() @c uct_stat_policy_clear @endlink
+        - @link CmdStatProfile() @c uct_stat_profile @endlink
         - @link CmdStatSearch() @c uct_stat_search @endlink
         - @link CmdStatTerritory() @c uct_stat_territory @endlink
         - @link CmdValue() @c uct_value @endlink
@@ -96,6 +100,7 @@ public:
     // The callback functions are documented in the cpp file
     void CmdAdditiveKnowledge(GtpCommand& cmd);
     void CmdApproximateTerritory(GtpCommand& cmd);
+    void CmdBenchThreads(GtpCommand& cmd);
     void CmdBounds(GtpCommand& cmd);
     void CmdDefaultPolicy(GtpCommand& cmd);
     void CmdDeterministicMode(GtpCommand&);
@@ -106,6 +111,7 @@ public:
     void CmdIsPolicyCorrectedMove(GtpCommand& cmd);
     void CmdIsPolicyMove(GtpCommand& cmd);
     void CmdLadderKnowledge(GtpCommand& cmd);
+    void CmdLoadTreeBinary(GtpCommand& cmd);
     void CmdMaxMemory(GtpCommand& cmd);
     void CmdMoves(GtpCommand& cmd);
     void CmdNodeInfo(GtpCommand& cmd);
@@ -125,12 +131,14 @@ public:
     void CmdRootFilter(GtpCommand& cmd);
     void CmdSaveGames(GtpCommand& cmd);
     void CmdSaveTree(GtpCommand& cmd);
+    void CmdSaveTreeBinary(GtpCommand& cmd);
     void CmdScore(GtpCommand& cmd);
     void CmdSequence(GtpCommand& cmd);
     void CmdStatPlayer(GtpCommand& cmd);
     void CmdStatPlayerClear(GtpCommand& cmd);
     void CmdStatPolicy(GtpCommand& cmd);
     void CmdStatPolicyClear(GtpCommand& cmd);
+    void CmdStatProfile(GtpCommand& cmd);
     void CmdStatSearch(GtpCommand& cmd);
     void CmdStatTerritory(GtpCommand& cmd);
     void CmdValue(GtpCommand& cmd);
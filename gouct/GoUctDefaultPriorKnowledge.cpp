@@ -497,7 +497,10 @@ GoUctDefaultPriorKnowledge::ProcessPosition(std::vector<SgUctMoveInfo>&
     m_policy.GenerateMove();
     GoUctPlayoutPolicyType type = m_policy.MoveType();
     bool isFullBoardRandom =
-        (type == GOUCT_RANDOM || type == GOUCT_FILLBOARD);
+        (  type == GOUCT_RANDOM
+        || type == GOUCT_FULLBOARD_GAMMA
+        || type == GOUCT_FILLBOARD
+        );
     SgPointSet pattern;
     SgPointSet atari;
     GoPointList empty;
@@ -25,7 +25,8 @@
 GoUctFeatureCommands::GoUctFeatureCommands(const GoBoard& bd)
     :   m_bd(bd),
         m_weights(FeFeatureWeights::ReadDefaultWeights()),
-        m_policy(bd, GoUctPlayoutPolicyParam())
+        m_policyParam(),
+        m_policy(bd, m_policyParam)
 { }
 
 void GoUctFeatureCommands::AddGoGuiAnalyzeCommands(GtpCommand& cmd)
@@ -68,6 +68,9 @@ private:
     
     FeFeatureWeights m_weights;
 
+    /** Parameters of m_policy, which stores only a reference to them. */
+    GoUctPlayoutPolicyParam m_policyParam;
+
     GoUctPlayoutPolicy<GoBoard> m_policy;
 };
 
@@ -47,14 +47,15 @@ ProbabilityValue(float moveValue) const
 
 GoUctFeatureKnowledge::GoUctFeatureKnowledge(
                          const GoBoard& bd,
-                         const FeFeatureWeights& weights)
+                         const FeFactorEvaluator& evaluator)
     : GoAdditiveKnowledge(bd),
       GoUctKnowledge(bd),
       m_code(),
       m_moveValue(0),
       m_param(),
-      m_policy(bd, GoUctPlayoutPolicyParam()),
-      m_weights(weights)
+      m_policyParam(),
+      m_policy(bd, m_policyParam),
+      m_evaluator(evaluator)
 { }
 
 void GoUctFeatureKnowledge::
@@ -64,7 +65,7 @@ Compute(const GoUctFeatureKnowledgeParam& param)
     const GoBoard& bd = GoAdditiveKnowledge::Board();
     FeFullBoardFeatures features(bd);
     GoUctFeatures::FindAllFeatures(bd, m_policy, features);
-    m_moveValue = features.EvaluateFeatures(m_weights);
+    m_moveValue = features.EvaluateFeatures(m_evaluator);
     m_code = bd.GetHashCodeInclToPlay();
 }
 
@@ -270,12 +271,13 @@ GoUctFeatureKnowledgeFactory::~GoUctFeatureKnowledgeFactory()
 
 GoAdditiveKnowledge* GoUctFeatureKnowledgeFactory::Create(const GoBoard& bd)
 {
-    return new GoUctFeatureKnowledge(bd, m_weights);
+    return new GoUctFeatureKnowledge(bd, m_evaluator);
 }
 
 void GoUctFeatureKnowledgeFactory::ReadWeights()
 {
     m_weights = FeFeatureWeights::ReadDefaultWeights();
+    m_evaluator = FeFactorEvaluator(m_weights);
     SgDebug() << "GoUctFeatureKnowledgeFactory Read weights for "
               << m_weights.m_nuFeatures
               << " features with k = " << m_weights.m_k
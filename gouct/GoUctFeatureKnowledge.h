@@ -7,6 +7,7 @@
 #ifndef GOUCT_FEATURE_KNOWLEDGE_H
 #define GOUCT_FEATURE_KNOWLEDGE_H
 
+#include "FeFactorEvaluator.h"
 #include "FeFeatureWeights.h"
 #include "GoAdditiveKnowledge.h"
 #include "GoBoard.h"
@@ -74,7 +75,12 @@ class GoUctFeatureKnowledge
     : public GoAdditiveKnowledge, GoUctKnowledge
 {
 public:
-    GoUctFeatureKnowledge(const GoBoard& bd, const FeFeatureWeights& weights);
+    /** Constructor.
+        @param bd
+        @param evaluator The feature weights. Stores a reference. Lifetime
+        of parameter must exceed the lifetime of this instance. */
+    GoUctFeatureKnowledge(const GoBoard& bd,
+                          const FeFactorEvaluator& evaluator);
 
     void Compute(const GoUctFeatureKnowledgeParam& param);
     
@@ -116,9 +122,14 @@ private:
         
     GoUctFeatureKnowledgeParam m_param;
 
+    /** Parameters of m_policy, which stores only a reference to them. */
+    GoUctPlayoutPolicyParam m_policyParam;
+
     GoUctPlayoutPolicy<GoBoard> m_policy;
     
-    FeFeatureWeights m_weights;
+    /** The feature weights in the layout for fast evaluation.
+        Shared by all knowledge objects of a GoUctFeatureKnowledgeFactory. */
+    const FeFactorEvaluator& m_evaluator;
 };
 
 //----------------------------------------------------------------------------
@@ -159,6 +170,10 @@ private:
     void ReadWeights();
     
     FeFeatureWeights m_weights;
+
+    /** m_weights in the layout for fast evaluation, shared by all
+        GoUctFeatureKnowledge created by this factory. */
+    FeFactorEvaluator m_evaluator;
 };
 //----------------------------------------------------------------------------
 
@@ -0,0 +1,216 @@
+//----------------------------------------------------------------------------
+/** @file GoUctFullBoardGammaGenerator.h */
+//----------------------------------------------------------------------------
+
+#ifndef GOUCT_FULLBOARDGAMMAGENERATOR_H
+#define GOUCT_FULLBOARDGAMMAGENERATOR_H
+
+#include "GoBoard.h"
+#include "GoUctPatterns.h"
+#include "GoUctUtil.h"
+#include "SgBWArray.h"
+#include "SgSumTree.h"
+
+//----------------------------------------------------------------------------
+
+/** Select from all empty points on the board with a probability according
+    to the gamma values of their 3x3 patterns.
+    Each empty point has a weight for each color to play, which is its
+    pattern gamma, if it is above the threshold, and 1 otherwise (same as in
+    GoUctGammaMoveGenerator). The weights are stored in a SgSumTree per
+    color. After a move, only the weights of the points whose 3x3
+    neighborhood changed are updated: the move itself, its 8 neighbors and
+    the captured stones and their 8 neighbors. So a move can be selected in
+    logarithmic time instead of by a loop over all empty points. */
+template<class BOARD>
+class GoUctFullBoardGammaGenerator
+{
+public:
+    GoUctFullBoardGammaGenerator(const BOARD& bd,
+                                 float patternGammaThreshold,
+                                 const GoUctPatterns<BOARD>& patterns,
+                                 SgRandom& random);
+
+    /** Compute the weights of all empty points on the board. */
+    void Start();
+
+    /** Update the weights.
+        Must be called after each play on the board. */
+    void OnPlay();
+
+    /** Generate a move with probability according to the weights.
+        Selects an empty point that fulfills GoUctUtil::GeneratePoint() for
+        the color to play. Points that do not fulfill it are excluded during
+        the selection and get their weight back afterwards.
+        @return The move or SG_NULLMOVE, if no point fulfills
+        GoUctUtil::GeneratePoint() */
+    SgPoint Generate();
+
+    /** Weight of a point for a color to play. */
+    float Weight(SgPoint p, SgBlackWhite toPlay) const;
+
+private:
+    typedef SgSumTree<SG_MAXPOINT> Tree;
+
+    const BOARD& m_bd;
+
+    float m_patternGammaThreshold;
+
+    const GoUctPatterns<BOARD>& m_patterns;
+
+    SgRandom& m_random;
+
+    SgBWArray<Tree> m_tree;
+
+    /** Points excluded during Generate() */
+    GoPointList m_excluded;
+
+    void CheckConsistency() const;
+
+    float ComputeWeight(SgPoint p, SgBlackWhite toPlay) const;
+
+    /** Update the weights of an empty point. */
+    void Update(SgPoint p);
+
+    /** Update the weights of the empty points in the 8-neighborhood. */
+    void Update8Neighbors(SgPoint p);
+};
+
+template<class BOARD>
+GoUctFullBoardGammaGenerator<BOARD>::GoUctFullBoardGammaGenerator(
+                                        const BOARD& bd,
+                                        float patternGammaThreshold,
+                                        const GoUctPatterns<BOARD>& patterns,
+                                        SgRandom& random)
+    : m_bd(bd),
+      m_patternGammaThreshold(patternGammaThreshold),
+      m_patterns(patterns),
+      m_random(random)
+{ }
+
+template<class BOARD>
+inline void GoUctFullBoardGammaGenerator<BOARD>::CheckConsistency() const
+{
+#if 0 // Expensive check, enable only for debugging
+    for (typename BOARD::Iterator it(m_bd); it; ++it)
+    {
+        SgPoint p = *it;
+        for (SgBWIterator itColor; itColor; ++itColor)
+            SG_ASSERT(m_tree[*itColor].Get(p) == (m_bd.IsEmpty(p) ?
+                      ComputeWeight(p, *itColor) : 0.f));
+    }
+#endif
+}
+
+template<class BOARD>
+inline float GoUctFullBoardGammaGenerator<BOARD>::ComputeWeight(SgPoint p,
+                                                 SgBlackWhite toPlay) const
+{
+    SG_ASSERT(m_bd.IsEmpty(p));
+    const float gamma = m_patterns.GetPatternGamma(m_bd, p, toPlay);
+    return gamma > m_patternGammaThreshold ? gamma : 1.f;
+}
+
+template<class BOARD>
+SgPoint GoUctFullBoardGammaGenerator<BOARD>::Generate()
+{
+    const SgBlackWhite toPlay = m_bd.ToPlay();
+    Tree& tree = m_tree[toPlay];
+    SgPoint p = SG_NULLMOVE;
+    m_excluded.Clear();
+    while (tree.Total() > 0)
+    {
+        SgPoint q = tree.Select(m_random.Float(tree.Total()));
+        SG_ASSERT(m_bd.IsEmpty(q));
+        if (GoUctUtil::GeneratePoint(m_bd, q, toPlay))
+        {
+            p = q;
+            break;
+        }
+        m_excluded.PushBack(q);
+        tree.Set(q, 0.f);
+    }
+    for (GoPointList::Iterator it(m_excluded); it; ++it)
+        tree.Set(*it, ComputeWeight(*it, toPlay));
+    CheckConsistency();
+    return p;
+}
+
+template<class BOARD>
+void GoUctFullBoardGammaGenerator<BOARD>::OnPlay()
+{
+    const SgPoint lastMove = m_bd.GetLastMove();
+    if (SgIsSpecialMove(lastMove))
+        return;
+    if (m_bd.IsEmpty(lastMove)) // suicide
+        Update(lastMove);
+    else
+    {
+        m_tree[SG_BLACK].Set(lastMove, 0.f);
+        m_tree[SG_WHITE].Set(lastMove, 0.f);
+    }
+    Update8Neighbors(lastMove);
+    const GoPointList& capturedStones = m_bd.CapturedStones();
+    for (GoPointList::Iterator it(capturedStones); it; ++it)
+    {
+        Update(*it);
+        Update8Neighbors(*it);
+    }
+    CheckConsistency();
+}
+
+template<class BOARD>
+void GoUctFullBoardGammaGenerator<BOARD>::Start()
+{
+    m_tree[SG_BLACK].Clear();
+    m_tree[SG_WHITE].Clear();
+    for (typename BOARD::Iterator it(m_bd); it; ++it)
+        if (m_bd.IsEmpty(*it))
+            Update(*it);
+    CheckConsistency();
+}
+
+template<class BOARD>
+inline void GoUctFullBoardGammaGenerator<BOARD>::Update(SgPoint p)
+{
+    // Most changes of the neighborhood do not change the weight (gammas
+    // below the threshold), skip the update of the tree in this case
+    for (SgBWIterator it; it; ++it)
+    {
+        const float weight = ComputeWeight(p, *it);
+        if (weight != m_tree[*it].Get(p))
+            m_tree[*it].Set(p, weight);
+    }
+}
+
+template<class BOARD>
+inline void GoUctFullBoardGammaGenerator<BOARD>::Update8Neighbors(SgPoint p)
+{
+    if (m_bd.IsEmpty(p - SG_NS - SG_WE))
+        Update(p - SG_NS - SG_WE);
+    if (m_bd.IsEmpty(p - SG_NS))
+        Update(p - SG_NS);
+    if (m_bd.IsEmpty(p - SG_NS + SG_WE))
+        Update(p - SG_NS + SG_WE);
+    if (m_bd.IsEmpty(p - SG_WE))
+        Update(p - SG_WE);
+    if (m_bd.IsEmpty(p + SG_WE))
+        Update(p + SG_WE);
+    if (m_bd.IsEmpty(p + SG_NS - SG_WE))
+        Update(p + SG_NS - SG_WE);
+    if (m_bd.IsEmpty(p + SG_NS))
+        Update(p + SG_NS);
+    if (m_bd.IsEmpty(p + SG_NS + SG_WE))
+        Update(p + SG_NS + SG_WE);
+}
+
+template<class BOARD>
+inline float GoUctFullBoardGammaGenerator<BOARD>::Weight(SgPoint p,
+                                                 SgBlackWhite toPlay) const
+{
+    return m_tree[toPlay].Get(p);
+}
+
+//----------------------------------------------------------------------------
+
+#endif // GOUCT_FULLBOARDGAMMAGENERATOR_H
@@ -23,7 +23,9 @@
 #include "GoUctDefaultPriorKnowledge.h"
 #include "GoUctFeatureKnowledge.h"
 #include "GoUctKnowledgeFactory.h"
+#include "GoUctPriorKnowledgeCache.h"
 #include "GoUctSearch.h"
+#include "GoUctTerritoryStatistics.h"
 #include "GoUctUtil.h"
 
 //----------------------------------------------------------------------------
@@ -148,8 +150,9 @@ class GoUctGlobalSearchState
 public:
     /** Probabilities that a point belongs to Black in a terminal position.
         Only computed if GoUctGlobalSearchStateParam::m_territoryStatistics
-        is true. */
-    SgPointArray<SgUctStatistics> m_territoryStatistics;
+        is true. Contains only the games of this thread, see
+        GoUctGlobalSearch::GetTerritoryStatistics() */
+    GoUctTerritoryStatistics m_territoryStatistics;
 
     /** Constructor.
         @param threadId The number of the thread. Needed for passing to
@@ -176,6 +179,10 @@ public:
         Owned by this and deleted by destructor */
     void SetFeatureKnowledge(GoUctFeatureKnowledge* knowledge);
 
+    /** Set the cache for the moves generated by GenerateAllMoves().
+        Shared by the states of all threads and not owned by this. */
+    void SetPriorKnowledgeCache(GoUctPriorKnowledgeCache* cache);
+
     SgUctValue Evaluate();
 
     bool GenerateAllMoves(SgUctValue count, std::vector<SgUctMoveInfo>& moves,
@@ -184,6 +191,11 @@ public:
     /** Generates all legal moves with no knowledge values. */
     void GenerateLegalMoves(std::vector<SgUctMoveInfo>& moves);
 
+    /** Leaves out the prior knowledge, if feature or additive knowledge is
+        used. Only the tree filter is applied. */
+    bool GenerateMovesWithoutKnowledge(std::vector<SgUctMoveInfo>& moves,
+                                       SgUctProvenType& provenType);
+
     SgMove GeneratePlayoutMove(bool& skipRaveUpdate);
 
     void ExecutePlayout(SgMove move);
@@ -243,6 +255,9 @@ private:
 
     GoUctFeatureKnowledge* m_featureKnowledge;
 
+    /** See SetPriorKnowledgeCache() */
+    GoUctPriorKnowledgeCache* m_priorKnowledgeCache;
+
     boost::scoped_ptr<POLICY> m_policy;
 
     GoUctDefaultMoveFilter m_treeFilter;
@@ -278,6 +293,7 @@ GoUctGlobalSearchState<POLICY>::GoUctGlobalSearchState(unsigned int threadId,
       m_priorKnowledge(Board(), m_param.m_policyParam),
       m_additivePredictor(0),
       m_featureKnowledge(0),
+      m_priorKnowledgeCache(0),
       m_policy(policy),
       m_treeFilter(Board(), m_param.m_moveFilterParam)
 {
@@ -335,9 +351,7 @@ void GoUctGlobalSearchState<POLICY>::ApplyFilter(std::vector<SgUctMoveInfo>& mov
 template<class POLICY>
 void GoUctGlobalSearchState<POLICY>::ClearTerritoryStatistics()
 {
-    for (SgPointArray<SgUctStatistics>::NonConstIterator
-             it(m_territoryStatistics); it; ++it)
-        (*it).Clear();
+    m_territoryStatistics.Clear();
 }
 
 template<class POLICY>
@@ -363,40 +377,27 @@ SgUctValue GoUctGlobalSearchState<POLICY>::EvaluateBoard(const BOARD& bd,
                                                          float komi)
 {
     SgUctValue score;
-    SgPointArray<SgEmptyBlackWhite> scoreBoard;
-    SgPointArray<SgEmptyBlackWhite>* scoreBoardPtr;
+    SgBWSet area;
+    SgBWSet* areaPtr;
     const GoUctGlobalSearchStateParam& param = m_param.m_searchStateParam;
     if (param.m_territoryStatistics)
-        scoreBoardPtr = &scoreBoard;
+        areaPtr = &area;
     else
-        scoreBoardPtr = 0;
+        areaPtr = 0;
     if (param.m_mercyRule && m_mercyRuleTriggered)
         return m_mercyRuleResult;
     else if (m_passMovesPlayoutPhase < 2)
         // Two passes not in playout phase, see comment in GenerateAllMoves()
         score = SgUctValue(
-                    GoBoardUtil::TrompTaylorScore(bd, komi, scoreBoardPtr));
+                  GoBoardUtil::TrompTaylorScoreBitset(bd, komi, areaPtr));
     else
     {
         score = SgUctValue(
-                    GoBoardUtil::ScoreSimpleEndPosition(bd, komi, Safe(),
-                                                        false,
-                                                        scoreBoardPtr));
+                  GoBoardUtil::ScoreSimpleEndPositionBitset(bd, komi, Safe(),
+                                                            areaPtr));
     }
     if (param.m_territoryStatistics)
-        for (typename BOARD::Iterator it(bd); it; ++it)
-            switch (scoreBoard[*it])
-            {
-            case SG_BLACK:
-                m_territoryStatistics[*it].Add(1);
-                break;
-            case SG_WHITE:
-                m_territoryStatistics[*it].Add(0);
-                break;
-            case SG_EMPTY:
-                m_territoryStatistics[*it].Add(0.5);
-                break;
-            }
+        m_territoryStatistics.Add(area);
     if (bd.ToPlay() != SG_BLACK)
         score *= -1;
     SgUctValue lengthMod =
@@ -543,6 +544,19 @@ GenerateAllMoves(SgUctValue count,
     const GoUctFeatureKnowledgeParam& feParam = m_param.m_featureParam;
     provenType = SG_NOT_PROVEN;
     moves.clear();  // FIXME: needed?
+    // The moves after two passes depend on m_initialMoveNumber, which is
+    // not part of the key, see GenerateLegalMoves()
+    const bool useCache = count == 0
+                          && m_priorKnowledgeCache != 0
+                          && m_priorKnowledgeCache->IsEnabled()
+                          && ! GoBoardUtil::TwoPasses(Board());
+    SgHashCode key;
+    if (useCache)
+    {
+        key = GoUctPriorKnowledgeCache::Key(Board());
+        if (m_priorKnowledgeCache->Lookup(key, moves))
+            return false;
+    }
     GenerateLegalMoves(moves);
     if (! moves.empty() && count == 0) 
     {
@@ -563,10 +577,32 @@ GenerateAllMoves(SgUctValue count,
                 m_featureKnowledge->SetPriorKnowledge(moves);
         }
         ApplyAdditivePredictors(moves);
+        if (useCache)
+            m_priorKnowledgeCache->Store(key, moves);
     }
     return false;
 }
 
+template<class POLICY>
+bool GoUctGlobalSearchState<POLICY>::
+GenerateMovesWithoutKnowledge(std::vector<SgUctMoveInfo>& moves,
+                              SgUctProvenType& provenType)
+{
+    const GoUctFeatureKnowledgeParam& feParam = m_param.m_featureParam;
+    if (  feParam.m_priorKnowledgeType == PRIOR_NONE
+       && ! feParam.m_useAsAdditivePredictor
+       && GetAdditiveKnowledge() == 0
+       )
+        // Nothing expensive to leave out
+        return SgUctThreadState::GenerateMovesWithoutKnowledge(moves,
+                                                               provenType);
+    provenType = SG_NOT_PROVEN;
+    GenerateLegalMoves(moves);
+    if (! moves.empty() && m_param.m_searchStateParam.m_useTreeFilter)
+        ApplyFilter(moves);
+    return ! moves.empty();
+}
+
 template<class POLICY>
 SgMove GoUctGlobalSearchState<POLICY>::
 GeneratePlayoutMove(bool& skipRaveUpdate)
@@ -645,6 +681,13 @@ void GoUctGlobalSearchState<POLICY>::SetPolicy(POLICY* policy)
     m_policy.reset(policy);
 }
 
+template<class POLICY>
+inline void GoUctGlobalSearchState<POLICY>::SetPriorKnowledgeCache(
+                                            GoUctPriorKnowledgeCache* cache)
+{
+    m_priorKnowledgeCache = cache;
+}
+
 template<class POLICY>
 void GoUctGlobalSearchState<POLICY>::StartPlayout()
 {
@@ -665,6 +708,7 @@ void GoUctGlobalSearchState<POLICY>::StartPlayouts()
 template<class POLICY>
 void GoUctGlobalSearchState<POLICY>::StartSearch()
 {
+    SetMaintainPatternCodes(m_param.m_policyParam.m_incrementalPatternCodes);
     GoUctState::StartSearch();
     const GoBoard& bd = Board();
     const int size = bd.Size();
@@ -694,14 +738,16 @@ public:
         this instance.
         @param featureParam
         @param safe SgBWSet of proven safe points separated by color
-        @param allSafe Set of all proven safe points */
+        @param allSafe Set of all proven safe points
+        @param priorKnowledgeCache Cache shared by all created states */
     GoUctGlobalSearchStateFactory(GoBoard& bd,
                           FACTORY& playoutPolicyFactory,
                           const GoUctPlayoutPolicyParam& policyParam,
                           const GoUctDefaultMoveFilterParam& treeFilterParam,
                           const GoUctFeatureKnowledgeParam& featureParam,
                           const SgBWSet& safe,
-                          const SgPointArray<bool>& allSafe);
+                          const SgPointArray<bool>& allSafe,
+                          GoUctPriorKnowledgeCache& priorKnowledgeCache);
 
     SgUctThreadState* Create(unsigned int threadId, 
                              const SgUctSearch& search);
@@ -722,6 +768,8 @@ private:
     const SgBWSet& m_safe;
 
     const SgPointArray<bool>& m_allSafe;
+
+    GoUctPriorKnowledgeCache& m_priorKnowledgeCache;
 };
 
 template<class POLICY, class FACTORY>
@@ -732,7 +780,8 @@ GoUctGlobalSearchStateFactory<POLICY,FACTORY>
                   const GoUctDefaultMoveFilterParam& treeFilterParam,
                   const GoUctFeatureKnowledgeParam& featureParam,
                   const SgBWSet& safe,
-                  const SgPointArray<bool>& allSafe)
+                  const SgPointArray<bool>& allSafe,
+                  GoUctPriorKnowledgeCache& priorKnowledgeCache)
     : m_bd(bd),
       m_playoutPolicyFactory(playoutPolicyFactory),
       m_knowledgeFactory(policyParam),
@@ -740,7 +789,8 @@ GoUctGlobalSearchStateFactory<POLICY,FACTORY>
       m_treeFilterParam(treeFilterParam),
       m_featureParam(featureParam),
       m_safe(safe),
-      m_allSafe(allSafe)
+      m_allSafe(allSafe),
+      m_priorKnowledgeCache(priorKnowledgeCache)
 { }
 
 //----------------------------------------------------------------------------
@@ -786,12 +836,23 @@ public:
 
     void DisplayGfx();
 
+    /** Also writes the hit rate of the prior knowledge cache. */
+    void WriteStatistics(std::ostream& out) const;
+
     // @} // @name
 
 
     /** Set default search parameters optimized for a board size. */
     void SetDefaultParameters(int boardSize);
 
+    /** Get the territory statistics of all threads.
+        Merges the statistics of the thread states. Can be called during
+        a search.
+        @param[out] statistics The merged statistics (no games, if the
+        threads are not created yet)
+        @see GoUctGlobalSearchState::m_territoryStatistics */
+    void GetTerritoryStatistics(GoUctTerritoryStatistics& statistics) const;
+
     /** Output live graphics commands for GoGui.
         Similar to the GOUCT_LIVEGFX_COUNTS mode in GoUctSearch, but the
         influence data shows the terriroy statistics (which must be enabled)
@@ -803,6 +864,20 @@ public:
     /** See GlobalSearchLiveGfx() */
     void SetGlobalSearchLiveGfx(bool enable);
 
+    /** Remove all entries from the prior knowledge cache.
+        Must be called after changing a parameter that influences the prior
+        knowledge of GoUctGlobalSearchState::GenerateAllMoves(). Changes of
+        the board size or the rules are detected in OnStartSearch(). */
+    void ClearPriorKnowledgeCache();
+
+    /** Number of entries of the prior knowledge cache.
+        0 disables the cache.
+        @see GoUctPriorKnowledgeCache */
+    std::size_t PriorKnowledgeCacheSize() const;
+
+    /** See PriorKnowledgeCacheSize() */
+    void SetPriorKnowledgeCacheSize(std::size_t size);
+
 private:
     SgBWSet m_safe;
 
@@ -814,8 +889,21 @@ private:
 
     /** See GlobalSearchLiveGfx() */
     bool m_globalSearchLiveGfx;
+
+    /** Prior knowledge cache shared by the states of all threads.
+        See PriorKnowledgeCacheSize() */
+    GoUctPriorKnowledgeCache m_priorKnowledgeCache;
+
+    /** Board size of the entries in m_priorKnowledgeCache. */
+    int m_priorKnowledgeCacheBoardSize;
+
+    /** Rules of the entries in m_priorKnowledgeCache. */
+    GoRules m_priorKnowledgeCacheRules;
 };
 
+/** Default value for GoUctGlobalSearch::PriorKnowledgeCacheSize() */
+const std::size_t GOUCT_DEFAULT_PRIOR_KNOWLEDGE_CACHE_SIZE = 4096;
+
 template<class POLICY, class FACTORY>
 GoUctGlobalSearch<POLICY,FACTORY>::GoUctGlobalSearch(GoBoard& bd,
                          FACTORY* playoutFactory,
@@ -825,7 +913,10 @@ GoUctGlobalSearch<POLICY,FACTORY>::GoUctGlobalSearch(GoBoard& bd,
     : GoUctSearch(bd, 0),
       m_playoutPolicyFactory(playoutFactory),
       m_regions(bd),
-      m_globalSearchLiveGfx(GOUCT_LIVEGFX_NONE)
+      m_globalSearchLiveGfx(GOUCT_LIVEGFX_NONE),
+      m_priorKnowledgeCache(GOUCT_DEFAULT_PRIOR_KNOWLEDGE_CACHE_SIZE),
+      m_priorKnowledgeCacheBoardSize(bd.Size()),
+      m_priorKnowledgeCacheRules(bd.Rules())
 {
     SgUctThreadStateFactory* stateFactory =
         new GoUctGlobalSearchStateFactory<POLICY,FACTORY>(bd,
@@ -833,7 +924,8 @@ GoUctGlobalSearch<POLICY,FACTORY>::GoUctGlobalSearch(GoBoard& bd,
                                                           policyParam,
                                                           rootFilterParam,
                                                           featureParam,
-                                                          m_safe, m_allSafe);
+                                                          m_safe, m_allSafe,
+                                                      m_priorKnowledgeCache);
     SetThreadStateFactory(stateFactory);
     SetDefaultParameters(bd.Size());
 
@@ -855,6 +947,27 @@ GoUctGlobalSearch<POLICY,FACTORY>::GoUctGlobalSearch(GoBoard& bd,
     }
 }
 
+template<class POLICY, class FACTORY>
+inline void GoUctGlobalSearch<POLICY,FACTORY>::ClearPriorKnowledgeCache()
+{
+    m_priorKnowledgeCache.Clear();
+}
+
+template<class POLICY, class FACTORY>
+void GoUctGlobalSearch<POLICY,FACTORY>::GetTerritoryStatistics(
+                                 GoUctTerritoryStatistics& statistics) const
+{
+    statistics.Clear();
+    if (! ThreadsCreated())
+        return;
+    for (unsigned int i = 0; i < NumberThreads(); ++i)
+    {
+        const GoUctGlobalSearchState<POLICY>& state =
+            dynamic_cast<GoUctGlobalSearchState<POLICY>&>(ThreadState(i));
+        statistics.Merge(state.m_territoryStatistics);
+    }
+}
+
 template<class POLICY, class FACTORY>
 inline bool GoUctGlobalSearch<POLICY,FACTORY>::GlobalSearchLiveGfx() const
 {
@@ -867,12 +980,12 @@ void GoUctGlobalSearch<POLICY,FACTORY>::DisplayGfx()
     GoUctSearch::DisplayGfx();
     if (m_globalSearchLiveGfx)
     {
-        const GoUctGlobalSearchState<POLICY>& state =
-            dynamic_cast<GoUctGlobalSearchState<POLICY>&>(ThreadState(0));
+        GoUctTerritoryStatistics territoryStatistics;
+        GetTerritoryStatistics(territoryStatistics);
         SgDebug() << "gogui-gfx:\n";
         GoUctUtil::GfxBestMove(*this, ToPlay(), SgDebug());
-        GoUctUtil::GfxTerritoryStatistics(state.m_territoryStatistics,
-                                          Board(), SgDebug());
+        GoUctUtil::GfxTerritoryStatistics(territoryStatistics, Board(),
+                                          SgDebug());
         GoUctUtil::GfxStatus(*this, SgDebug());
         SgDebug() << '\n';
     }
@@ -892,12 +1005,33 @@ void GoUctGlobalSearch<POLICY,FACTORY>::OnStartSearch()
         for (GoBoard::Iterator it(bd); it; ++it)
             m_allSafe[*it] = m_safe.OneContains(*it);
     }
+    // The safe points, the board size and the rules are not part of the
+    // key of the prior knowledge cache
+    const GoBoard& bd = Board();
+    if (  GOUCT_USE_SAFETY_SOLVER
+       || bd.Size() != m_priorKnowledgeCacheBoardSize
+       || ! (bd.Rules() == m_priorKnowledgeCacheRules)
+       )
+    {
+        m_priorKnowledgeCache.Clear();
+        m_priorKnowledgeCacheBoardSize = bd.Size();
+        m_priorKnowledgeCacheRules = bd.Rules();
+    }
+    else
+        m_priorKnowledgeCache.ClearStatistics();
     if (m_globalSearchLiveGfx && ! m_param.m_territoryStatistics)
         SgWarning() <<
             "GoUctGlobalSearch: "
             "live graphics need territory statistics enabled\n";
 }
 
+template<class POLICY, class FACTORY>
+inline std::size_t
+GoUctGlobalSearch<POLICY,FACTORY>::PriorKnowledgeCacheSize() const
+{
+    return m_priorKnowledgeCache.MaxEntries();
+}
+
 template<class POLICY, class FACTORY>
 void GoUctGlobalSearch<POLICY,FACTORY>::SetDefaultParameters(int boardSize)
 {
@@ -935,6 +1069,13 @@ inline void GoUctGlobalSearch<POLICY,FACTORY>::SetGlobalSearchLiveGfx(
     m_globalSearchLiveGfx = enable;
 }
 
+template<class POLICY, class FACTORY>
+void GoUctGlobalSearch<POLICY,FACTORY>::SetPriorKnowledgeCacheSize(
+                                                             std::size_t size)
+{
+    m_priorKnowledgeCache.SetMaxEntries(size);
+}
+
 template<class POLICY, class FACTORY>
 SgUctValue GoUctGlobalSearch<POLICY,FACTORY>::UnknownEval() const
 {
@@ -943,6 +1084,15 @@ SgUctValue GoUctGlobalSearch<POLICY,FACTORY>::UnknownEval() const
     return SgUctValue(0.5);
 }
 
+template<class POLICY, class FACTORY>
+void GoUctGlobalSearch<POLICY,FACTORY>::WriteStatistics(std::ostream& out)
+    const
+{
+    GoUctSearch::WriteStatistics(out);
+    if (m_priorKnowledgeCache.IsEnabled())
+        m_priorKnowledgeCache.WriteStatistics(out);
+}
+
 template<class POLICY>
 GoAdditiveKnowledge* 
 GoUctGlobalSearchState<POLICY>::GetAdditiveKnowledge()
@@ -998,6 +1148,7 @@ SgUctThreadState* GoUctGlobalSearchStateFactory<POLICY,FACTORY>::Create(
             KNOWLEDGE_FEATURES));
 	SG_ASSERT(featureKnowledge);
     state->SetFeatureKnowledge(featureKnowledge);
+    state->SetPriorKnowledgeCache(&m_priorKnowledgeCache);
     return state;
 }
 
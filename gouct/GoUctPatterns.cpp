@@ -8,3 +8,52 @@
 
 #include <algorithm>
 #include "GoBoard.h"
+#include "GoUctGlobalPatternData.h"
+#include "GoUctLocalPatternData.h"
+
+//----------------------------------------------------------------------------
+
+GoUctPatternTables::TablesArray GoUctPatternTables::s_tables;
+
+template<class TABLE>
+void GoUctPatternTables::SetGammaValues(const GoUctPatternData::BWTable& pt,
+                                        TABLE& table)
+{
+    for (SgBWIterator it; it; ++it)
+    {
+        const SgBlackWhite color = *it;
+        for (int i = 0; i < pt[color].m_nuPatterns; ++i)
+        {
+            const int code = pt[color].m_patternArray[i].m_code;
+            if (code != -1)
+                table[color][code].
+                SetGammaValue(pt[color].m_patternArray[i].m_value);
+        }
+    }
+}
+
+GoUctPatternTables::GoUctPatternTables(PatternType type)
+{
+    if (type != PATTERN_NO_GAMMA)
+    {
+        const GoUctPatternData::PatternData& pt =
+            type == PATTERN_LOCAL ? GoUctLocalPatternData::gData :
+                                    GoUctGlobalPatternData::gData;
+        SetGammaValues(pt.m_edgePatterns, m_edgeTable);
+        SetGammaValues(pt.m_centerPatterns, m_table);
+    }
+    GoPattern3x3::InitCenterPatternTable(m_table);
+    GoPattern3x3::InitEdgePatternTable(m_edgeTable);
+}
+
+boost::shared_ptr<const GoUctPatternTables>
+GoUctPatternTables::Get(PatternType type)
+{
+    SG_ASSERT(type >= 0 && type < _GOUCT_NU_PATTERN_TYPE);
+    if (! s_tables[type])
+        s_tables[type] = boost::shared_ptr<const GoUctPatternTables>(
+                                                new GoUctPatternTables(type));
+    return s_tables[type];
+}
+
+//----------------------------------------------------------------------------
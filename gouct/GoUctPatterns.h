@@ -6,21 +6,88 @@
 #define GOUCT_PATTERNS_H
 
 #include <boost/array.hpp>
+#include <boost/shared_ptr.hpp>
 #include <cstdio>
 #include <utility>
 #include <string>
 #include "GoBoard.h"
 #include "GoBoardUtil.h"
 #include "GoPattern3x3.h"
-#include "GoUctGlobalPatternData.h"
-#include "GoUctLocalPatternData.h"
+#include "GoUctBoard.h"
 #include "GoUctPatternData.h"
+#include "SgArray.h"
 #include "SgBoardColor.h"
 #include "SgBWArray.h"
 #include "SgPoint.h"
 
 //----------------------------------------------------------------------------
 
+/** Lookup tables of GoUctPatterns for one type of gamma values.
+    The tables do not depend on the board and do not change after
+    construction. Like the data of SgBoardConst, the tables of each type are
+    created once and shared by all GoUctPatterns of that type, instead of
+    being copied into every playout policy of every search thread. */
+class GoUctPatternTables
+{
+public:
+    enum PatternType
+    {
+        PATTERN_GLOBAL,
+
+        PATTERN_LOCAL,
+
+        /** MoGo pattern flags only, all gamma values are zero */
+        PATTERN_NO_GAMMA,
+
+        _GOUCT_NU_PATTERN_TYPE
+    };
+
+    /** Get the shared tables of a type.
+        Creates the tables on the first call for a type. Not thread-safe;
+        like the constructor of SgBoardConst, it should be called while
+        creating the search, not from the search threads. */
+    static boost::shared_ptr<const GoUctPatternTables> Get(PatternType type);
+
+    /** Lookup table entry for a 8-neighbor code */
+    const PatternInfo& Center(SgBlackWhite toPlay, int code) const;
+
+    /** Lookup table entry for a 5-neighbor code on the edge */
+    const PatternInfo& Edge(SgBlackWhite toPlay, int code) const;
+
+private:
+    typedef SgArray<boost::shared_ptr<const GoUctPatternTables>,
+                    _GOUCT_NU_PATTERN_TYPE> TablesArray;
+
+    static TablesArray s_tables;
+
+    /** lookup table for 8-neighborhood of a move candidate */
+    SgBWArray<GoPattern3x3::GoPatternTable> m_table;
+
+    /** lookup table on the edge of board */
+    SgBWArray<GoPattern3x3::GoEdgePatternTable> m_edgeTable;
+
+    explicit GoUctPatternTables(PatternType type);
+
+	/** Copy gamma values from pt into table */
+    template<class TABLE>
+    static void SetGammaValues(const GoUctPatternData::BWTable& pt,
+                               TABLE& table);
+};
+
+inline const PatternInfo& GoUctPatternTables::Center(SgBlackWhite toPlay,
+                                                     int code) const
+{
+    return m_table[toPlay][code];
+}
+
+inline const PatternInfo& GoUctPatternTables::Edge(SgBlackWhite toPlay,
+                                                   int code) const
+{
+    return m_edgeTable[toPlay][code];
+}
+
+//----------------------------------------------------------------------------
+
 /** Hard-coded pattern matching routines to match patterns used by MoGo.
     See <a href="http://hal.inria.fr/docs/00/11/72/66/PDF/MoGoReport.pdf">
     Modification of UCT with Patterns in Monte-Carlo Go</a>.
@@ -78,10 +145,11 @@ public:
 
     enum PatternType
     {
-        PATTERN_GLOBAL,
-        PATTERN_LOCAL
+        PATTERN_GLOBAL = GoUctPatternTables::PATTERN_GLOBAL,
+        PATTERN_LOCAL = GoUctPatternTables::PATTERN_LOCAL
     };
 
+    /** Constructor for matching the MoGo patterns without gamma values. */
     GoUctPatterns(const BOARD& bd);
 
     GoUctPatterns(const BOARD& bd, PatternType patternType);
@@ -95,7 +163,7 @@ public:
     /** If matches any MoGo pattern, return true and lookup gamma value.*/
     bool MatchAny(SgPoint p, float& gamma) const;
 
-	/** provide interface of other gamma patterns*/
+	/** Use the shared gamma values of another pattern type. */
 	void InitializeGammaPatternFromProcessedData(PatternType patternType);
 
     /** Gamma value for given 8-neighbor code */
@@ -111,17 +179,19 @@ private:
 	/** Match any of the edge patterns, and return gamma */
 	float MatchAnyEdgeForGamma(SgPoint p, const SgBlackWhite toPlay) const;
 
-	/** Copy gamma values from pt into table */
-    template<class TABLE>
-    void SetGammaValues(const GoUctPatternData::BWTable& pt, TABLE& table);
-    
     const BOARD& m_bd;
 
-    /** lookup table for 8-neighborhood of a move candidate */
-    SgBWArray<GoPattern3x3::GoPatternTable> m_table;
+    /** Code of the 8 neighbors of a point.
+        See GoPattern3x3::CodeOf8Neighbors(). Specialized for GoUctBoard to
+        use the incrementally maintained pattern codes, if enabled. */
+    static int CenterCode(const BOARD& bd, SgPoint p);
 
-    /** lookup table on the edge of board */
-    SgBWArray<GoPattern3x3::GoEdgePatternTable> m_edgeTable;
+    /** Code of the 5 neighbors of an edge point.
+        See GoPattern3x3::CodeOfEdgeNeighbors() and CenterCode() */
+    static int EdgeCode(const BOARD& bd, SgPoint p);
+
+    /** The shared lookup tables. */
+    boost::shared_ptr<const GoUctPatternTables> m_tables;
 
     /** Match any of the center patterns. */
     bool MatchAnyCenter(SgPoint p) const;
@@ -143,45 +213,75 @@ GoUctPatterns<BOARD>::GoUctPatterns(const BOARD& bd, PatternType patternType)
     : m_bd(bd)
 {
     InitializeGammaPatternFromProcessedData(patternType);
-    GoPattern3x3::InitCenterPatternTable(m_table);
-    GoPattern3x3::InitEdgePatternTable(m_edgeTable);
 }
 
 template<class BOARD>
 GoUctPatterns<BOARD>::GoUctPatterns(const BOARD& bd)
-    : m_bd(bd)
+    : m_bd(bd),
+      m_tables(GoUctPatternTables::Get(GoUctPatternTables::PATTERN_NO_GAMMA))
+{ }
+
+template<class BOARD>
+inline int GoUctPatterns<BOARD>::CenterCode(const BOARD& bd, SgPoint p)
 {
-    GoPattern3x3::InitCenterPatternTable(m_table);
-    GoPattern3x3::InitEdgePatternTable(m_edgeTable);
+    return GoPattern3x3::CodeOf8Neighbors(bd, p);
+}
+
+template<>
+inline int GoUctPatterns<GoUctBoard>::CenterCode(const GoUctBoard& bd,
+                                                 SgPoint p)
+{
+    if (bd.MaintainPatternCodes())
+    {
+        SG_ASSERT(bd.Line(p) > 1);
+        return bd.PatternCode(p);
+    }
+    return GoPattern3x3::CodeOf8Neighbors(bd, p);
+}
+
+template<class BOARD>
+inline int GoUctPatterns<BOARD>::EdgeCode(const BOARD& bd, SgPoint p)
+{
+    return GoPattern3x3::CodeOfEdgeNeighbors(bd, p);
+}
+
+template<>
+inline int GoUctPatterns<GoUctBoard>::EdgeCode(const GoUctBoard& bd,
+                                               SgPoint p)
+{
+    if (bd.MaintainPatternCodes())
+    {
+        SG_ASSERT(bd.Line(p) == 1);
+        SG_ASSERT(bd.Pos(p) > 1);
+        return bd.PatternCode(p);
+    }
+    return GoPattern3x3::CodeOfEdgeNeighbors(bd, p);
 }
 
 template<class BOARD>
 float GoUctPatterns<BOARD>::CenterGamma(const SgBlackWhite toPlay, int code)
 const
 {
-    return m_table[toPlay][code].GetGammaValue();
+    return m_tables->Center(toPlay, code).GetGammaValue();
 }
 
 template<class BOARD>
 float GoUctPatterns<BOARD>::EdgeGamma(const SgBlackWhite toPlay, int code)
 const
 {
-    return m_edgeTable[toPlay][code].GetGammaValue();
+    return m_tables->Edge(toPlay, code).GetGammaValue();
 }
 
 template<class BOARD>
 inline bool GoUctPatterns<BOARD>::MatchAnyCenter(SgPoint p) const
 {
-    return m_table[m_bd.ToPlay()]
-                  [GoPattern3x3::CodeOf8Neighbors(m_bd, p)].IsPattern();
+    return m_tables->Center(m_bd.ToPlay(), CenterCode(m_bd, p)).IsPattern();
 }
 
 template<class BOARD>
 inline bool GoUctPatterns<BOARD>::MatchAnyEdge(SgPoint p) const
 {
-    return
-        m_edgeTable[m_bd.ToPlay()]
-                   [GoPattern3x3::CodeOfEdgeNeighbors(m_bd, p)].IsPattern();
+    return m_tables->Edge(m_bd.ToPlay(), EdgeCode(m_bd, p)).IsPattern();
 }
 
 template<class BOARD>
@@ -213,55 +313,26 @@ float GoUctPatterns<BOARD>::GetPatternGamma(const BOARD& bd,
         return 0;
 }
 
-template<class BOARD>
-template<class TABLE>
-void GoUctPatterns<BOARD>
-	::SetGammaValues(const GoUctPatternData::BWTable& pt, TABLE& table)
-{
-    for (SgBWIterator it; it; ++it)
-    {
-        const SgBlackWhite color = *it;
-        for (int i = 0; i < pt[color].m_nuPatterns; ++i)
-        {
-            const int code = pt[color].m_patternArray[i].m_code;
-            if (code != -1)
-                table[color][code].
-                SetGammaValue(pt[color].m_patternArray[i].m_value);
-        }
-	}
-}
-
 template<class BOARD>
 void GoUctPatterns<BOARD>
 	::InitializeGammaPatternFromProcessedData(PatternType patternType)
 {
-    m_table[SG_BLACK].Fill(PatternInfo());
-    m_table[SG_WHITE].Fill(PatternInfo());
-    m_edgeTable[SG_BLACK].Fill(PatternInfo());
-    m_edgeTable[SG_WHITE].Fill(PatternInfo());
-
-    const GoUctPatternData::PatternData& pt =
-        patternType == PATTERN_LOCAL ? GoUctLocalPatternData::gData :
-                                       GoUctGlobalPatternData::gData;
-    SetGammaValues(pt.m_edgePatterns, m_edgeTable);
-    SetGammaValues(pt.m_centerPatterns, m_table);
+    m_tables = GoUctPatternTables::Get(
+                  static_cast<GoUctPatternTables::PatternType>(patternType));
 }
 
 template<class BOARD>
 inline float GoUctPatterns<BOARD>::
 MatchAnyCenterForGamma(SgPoint p, const SgBlackWhite toPlay) const
 {
-    return m_table[toPlay]
-                  [GoPattern3x3::CodeOf8Neighbors(m_bd, p)].GetGammaValue();
+    return m_tables->Center(toPlay, CenterCode(m_bd, p)).GetGammaValue();
 }
 
 template<class BOARD>
 inline float GoUctPatterns<BOARD>::
 MatchAnyEdgeForGamma(SgPoint p, const SgBlackWhite toPlay) const
 {
-    return m_edgeTable[toPlay]
-                      [GoPattern3x3::CodeOfEdgeNeighbors(m_bd, p)]
-                      .GetGammaValue();
+    return m_tables->Edge(toPlay, EdgeCode(m_bd, p)).GetGammaValue();
 }
 
 template<class BOARD>
@@ -285,8 +356,8 @@ template<class BOARD>
 inline bool GoUctPatterns<BOARD>::MatchAnyCenter(SgPoint p, float& gamma)
 const
 {
-	const PatternInfo& pi = m_table[m_bd.ToPlay()]
-                                   [GoPattern3x3::CodeOf8Neighbors(m_bd, p)];
+	const PatternInfo& pi =
+        m_tables->Center(m_bd.ToPlay(), CenterCode(m_bd, p));
     gamma = pi.GetGammaValue();
 	return pi.IsPattern();
 }
@@ -295,8 +366,7 @@ template<class BOARD>
 inline bool GoUctPatterns<BOARD>::MatchAnyEdge(SgPoint p, float& gamma) const
 {
 	const PatternInfo& pi =
-            m_edgeTable[m_bd.ToPlay()]
-                       [GoPattern3x3::CodeOfEdgeNeighbors(m_bd, p)];
+        m_tables->Edge(m_bd.ToPlay(), EdgeCode(m_bd, p));
     gamma = pi.GetGammaValue();
 	return pi.IsPattern();
 }
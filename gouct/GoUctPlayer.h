@@ -18,6 +18,7 @@
 #include "GoUctObjectWithSearch.h"
 #include "GoUctPlayoutPolicy.h"
 #include "GoUctMoveFilter.h"
+#include "GoUctTerritoryStatistics.h"
 #include "SgArrayList.h"
 #include "SgDebug.h"
 #include "SgNbIterator.h"
@@ -212,6 +213,20 @@ public:
     /** See ReuseSubtree() */
     void SetReuseSubtree(bool enable);
 
+    /** Reuse the subtree from the last search in-place.
+        Only used if ReuseSubtree() is true. Instead of copying the subtree
+        to a new tree, the node of the current position becomes the root of
+        the existing search tree (see SgUctSearch::ReRootTree()). This takes
+        constant time independent of the size of the subtree, but the nodes
+        of the discarded part of the tree are only reclaimed when the search
+        prunes the full tree (see SgUctSearch::PruneFullTree()) or clears
+        it. The reuse statistics are measured in simulations instead of
+        nodes in this mode. Default is false. */
+    bool ReuseSubtreeInPlace() const;
+
+    /** See ReuseSubtreeInPlace() */
+    void SetReuseSubtreeInPlace(bool enable);
+
     /** Threshold for position value to resign.
         Default is 0.01. */
     SgUctValue ResignThreshold() const;
@@ -280,6 +295,9 @@ public:
     /** See ReuseSubtree() */
     bool m_reuseSubtree;
 
+    /** See ReuseSubtreeInPlace() */
+    bool m_reuseSubtreeInPlace;
+
     /** See EarlyPass() */
     bool m_earlyPass;
 
@@ -324,6 +342,8 @@ public:
     void FindInitTree(SgUctTree& initTree, SgBlackWhite toPlay,
                       double maxTime);
 
+    void FindInitTreeInPlace(SgBlackWhite toPlay);
+
     void SetDefaultParameters(int boardSize);
 
     bool VerifyNeutralMove(SgUctValue maxGames, double maxTime, SgPoint move);
@@ -408,6 +428,12 @@ inline bool GoUctPlayer<SEARCH, THREAD>::ReuseSubtree() const
     return m_reuseSubtree;
 }
 
+template <class SEARCH, class THREAD>
+inline bool GoUctPlayer<SEARCH, THREAD>::ReuseSubtreeInPlace() const
+{
+    return m_reuseSubtreeInPlace;
+}
+
 template <class SEARCH, class THREAD>
 inline GoUctMoveFilter& GoUctPlayer<SEARCH, THREAD>::RootFilter()
 {
@@ -556,6 +582,7 @@ GoUctPlayer<SEARCH, THREAD>::GoUctPlayer(const GoBoard& bd)
       m_enablePonder(false),
       m_useRootFilter(true),
       m_reuseSubtree(true),
+      m_reuseSubtreeInPlace(false),
       m_earlyPass(true),
       m_sureWinThreshold(0.80f),
       m_lastBoardSize(-1),
@@ -588,19 +615,15 @@ void GoUctPlayer<SEARCH, THREAD>::ClearStatistics()
     m_statistics.Clear();
 }
 
-typedef SgPointArray<SgUctStatistics> TerrArray;
-
-inline bool HasStatsForAllMoves(const GoBoard& bd, const TerrArray& territory)
+inline bool HasStatsForAllMoves(const GoUctTerritoryStatistics& territory)
 {
-    for (GoBoard::Iterator it(bd); it; ++it)
-        if (territory[*it].Count() == 0)
-        {
-            // No statistics, maybe all simulations aborted due to
-            // max length or mercy rule.
-            SgDebug() << "GoUctPlayer: no early pass possible (no stat) for"
-                        << SgWritePoint(*it) << '\n';
-            return false;
-        }
+    if (territory.Count() == 0)
+    {
+        // No statistics, maybe all simulations aborted due to
+        // max length or mercy rule.
+        SgDebug() << "GoUctPlayer: no early pass possible (no stat)\n";
+        return false;
+    }
     return true;
 }
 
@@ -616,12 +639,12 @@ inline SgUctValue ValueForPlayer(SgUctValue v, SgBlackWhite player)
 inline bool HasNonControlledLib(const GoBoard& bd,
                                 SgPoint block,
                                 SgBlackWhite toPlay,
-                                const TerrArray& territory,
+                                const GoUctTerritoryStatistics& territory,
                                 SgUctValue threshold)
 {
     SG_ASSERT(bd.IsColor(block, toPlay));
 
-    const SgUctValue blockMean = ValueForPlayer(territory[block].Mean(),
+    const SgUctValue blockMean = ValueForPlayer(territory.Mean(block),
                                                 toPlay);
     if (blockMean < threshold) // block not safe, probably dead. No fillin.
         // todo check for 1-threshold instead to check for dead blocks?
@@ -630,12 +653,12 @@ inline bool HasNonControlledLib(const GoBoard& bd,
 
     for (GoBoard::LibertyIterator it(bd, block); it; ++it)
     {
-        const SgUctValue mean = ValueForPlayer(territory[*it].Mean(), toPlay);
+        const SgUctValue mean = ValueForPlayer(territory.Mean(*it), toPlay);
         if (mean < threshold)
         {
             SgDebug() << "non-controlled liberty " << SgWritePoint(*it)
             << " of block " << SgWritePoint(block)
-            << " mean " << territory[*it].Mean()
+            << " mean " << territory.Mean(*it)
             << "\n";
 
             return true;
@@ -645,7 +668,8 @@ inline bool HasNonControlledLib(const GoBoard& bd,
 }
 
 inline bool AllowFillinMove(const GoBoard& bd, SgPoint move,
-                     const TerrArray& territory, SgUctValue threshold)
+                     const GoUctTerritoryStatistics& territory,
+                     SgUctValue threshold)
 {
     /*  Idea: if adj. block has another liberty that is not controlled by us
         - neutral or controlled by opponent (e.g. our selfatari)
@@ -707,9 +731,9 @@ bool GoUctPlayer<SEARCH, THREAD>::DoEarlyPassSearch(SgUctValue maxGames,
         earlyPassPossible = false;
     }
     move = SG_PASS;
-    THREAD& threadState = dynamic_cast<THREAD&>(m_search.ThreadState(0));
-    const TerrArray territory = threadState.m_territoryStatistics;
-    if (earlyPassPossible && ! HasStatsForAllMoves(bd, territory))
+    GoUctTerritoryStatistics territory;
+    m_search.GetTerritoryStatistics(territory);
+    if (earlyPassPossible && ! HasStatsForAllMoves(territory))
     {
         earlyPassPossible = false;
     }
@@ -729,7 +753,7 @@ bool GoUctPlayer<SEARCH, THREAD>::DoEarlyPassSearch(SgUctValue maxGames,
     {
         for (GoBoard::Iterator it(bd); it; ++it)
         {
-            const SgUctValue mean = territory[*it].Mean();
+            const SgUctValue mean = territory.Mean(*it);
             if (  mean > 1 - m_sureWinThreshold
                && mean < m_sureWinThreshold)
             {
@@ -738,7 +762,7 @@ bool GoUctPlayer<SEARCH, THREAD>::DoEarlyPassSearch(SgUctValue maxGames,
                 bool isSafeOppAdj = false;
                 for (GoNbIterator it2(bd, *it); it2; ++it2)
                 {
-                    const SgUctValue nbMean = territory[*it2].Mean();
+                    const SgUctValue nbMean = territory.Mean(*it2);
                     if (nbMean > m_sureWinThreshold)
                         isSafeToPlayAdj = true;
                     if (nbMean < 1 - m_sureWinThreshold)
@@ -801,7 +825,15 @@ SgPoint GoUctPlayer<SEARCH, THREAD>::DoSearch(SgBlackWhite toPlay,
     SgUctTree* initTree = 0;
     SgTimer timer;
     double timeInitTree = 0;
-    if (m_reuseSubtree)
+    if (m_reuseSubtree && m_reuseSubtreeInPlace)
+    {
+        // Cannot be truncated by an abort, so no need to check for an abort
+        // during pondering
+        timeInitTree = -timer.GetTime();
+        FindInitTreeInPlace(toPlay);
+        timeInitTree += timer.GetTime();
+    }
+    else if (m_reuseSubtree)
     {
         initTree = &m_search.GetTempTree();
         timeInitTree = -timer.GetTime();
@@ -941,6 +973,52 @@ void GoUctPlayer<SEARCH, THREAD>::FindInitTree(SgUctTree& initTree,
     }
 }
 
+/** Reuse the subtree of the current position in-place, if subtree reusing
+    is enabled.
+    Like FindInitTree(), but makes the node of the current position the root
+    of the search tree instead of copying its subtree.
+    @see SetReuseSubtreeInPlace */
+template <class SEARCH, class THREAD>
+void GoUctPlayer<SEARCH, THREAD>::FindInitTreeInPlace(SgBlackWhite toPlay)
+{
+    Board().SetToPlay(toPlay);
+    std::vector<SgPoint> sequence;
+    if (! m_search.BoardHistory().SequenceToCurrent(Board(), sequence))
+    {
+        SgDebug() << "GoUctPlayer: No tree to reuse found\n";
+        return;
+    }
+    const SgUctTree& tree = m_search.Tree();
+    const SgUctNode* node = SgUctTreeUtil::FindMatchingNode(tree, sequence);
+    const SgUctValue oldCount = tree.Root().MoveCount();
+    if (node == 0 || ! node->HasChildren() || oldCount == 0)
+    {
+        SgDebug() << "GoUctPlayer: Subtree to reuse has 0 nodes\n";
+        m_statistics.m_reuse.Add(0.f);
+        return;
+    }
+
+    // Check consistency
+    for (SgUctChildIterator it(tree, *node); it; ++it)
+        if (! Board().IsLegal((*it).Move()))
+        {
+            SgWarning() <<
+                "GoUctPlayer: illegal move in root child of init tree\n";
+            // Should not happen, if no bugs
+            SG_ASSERT(false);
+            return;
+        }
+
+    // Counting the nodes of the subtree would take linear time, use the
+    // fraction of simulations instead
+    const float reuse = float(node->MoveCount()) / float(oldCount);
+    const int reusePercent = static_cast<int>(100 * reuse);
+    SgDebug() << "GoUctPlayer: Reusing subtree in-place ("
+              << reusePercent << "% of simulations)\n";
+    m_statistics.m_reuse.Add(reuse);
+    m_search.ReRootTree(*node);
+}
+
 template <class SEARCH, class THREAD>
 SgPoint GoUctPlayer<SEARCH, THREAD>::GenMove(const SgTimeRecord& time,
                                              SgBlackWhite toPlay)
@@ -1090,6 +1168,12 @@ void GoUctPlayer<SEARCH, THREAD>::SetReuseSubtree(bool enable)
     m_reuseSubtree = enable;
 }
 
+template <class SEARCH, class THREAD>
+void GoUctPlayer<SEARCH, THREAD>::SetReuseSubtreeInPlace(bool enable)
+{
+    m_reuseSubtreeInPlace = enable;
+}
+
 template <class SEARCH, class THREAD>
 SgDefaultTimeControl& GoUctPlayer<SEARCH, THREAD>::TimeControl()
 {
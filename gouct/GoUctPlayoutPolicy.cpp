@@ -15,6 +15,8 @@ GoUctPlayoutPolicyParam::GoUctPlayoutPolicyParam()
       m_useNakadeHeuristic(false),
       m_usePatternsInPlayout(true),
       m_usePatternsInPriorKnowledge(true),
+      m_incrementalPatternCodes(false),
+      m_fullBoardGammaPlayout(false),
       m_fillboardTries(0),
       m_patternGammaThreshold(50.f),
       m_knowledgeType(KNOWLEDGE_GREENPEEP),
@@ -25,7 +27,7 @@ GoUctPlayoutPolicyParam::GoUctPlayoutPolicyParam()
 
 const char* GoUctPlayoutPolicyTypeStr(GoUctPlayoutPolicyType type)
 {
-    BOOST_STATIC_ASSERT(_GOUCT_NU_DEFAULT_PLAYOUT_TYPE == 13);
+    BOOST_STATIC_ASSERT(_GOUCT_NU_DEFAULT_PLAYOUT_TYPE == 14);
     switch (type)
     {
     case GOUCT_FILLBOARD:
@@ -48,6 +50,8 @@ const char* GoUctPlayoutPolicyTypeStr(GoUctPlayoutPolicyType type)
         return "Capture";
     case GOUCT_RANDOM:
         return "Random";
+    case GOUCT_FULLBOARD_GAMMA:
+        return "FullBoardGamma";
     case GOUCT_SELFATARI_CORRECTION:
         return "SelfAtariCorr";
     case GOUCT_CLUMP_CORRECTION:
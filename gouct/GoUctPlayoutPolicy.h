@@ -10,8 +10,10 @@
 #include "GoAdditiveKnowledge.h"
 #include "GoBoardUtil.h"
 #include "GoEyeUtil.h"
+#include "GoUctBoard.h"
 #include "GoUctPatterns.h"
 #include "GoUctPureRandomGenerator.h"
+#include "GoUctFullBoardGammaGenerator.h"
 #include "GoUctGammaMoveGenerator.h"
 
 //----------------------------------------------------------------------------
@@ -43,6 +45,20 @@ public:
     /** Use learned pattern probabilities in prior knowledge */
     bool m_usePatternsInPriorKnowledge;
 
+    /** Let the playout board maintain the 3x3 pattern codes incrementally.
+        See GoUctBoard::SetMaintainPatternCodes(). The update in every move
+        only pays off if the patterns are matched often relative to the
+        number of moves, which was the case on 19x19 but not on 9x9 in
+        tests. Default is false. */
+    bool m_incrementalPatternCodes;
+
+    /** Select the moves that are not generated by the tactical heuristics
+        and the capture heuristic from all empty points according to their
+        pattern gammas.
+        Replaces the local pattern moves and the pure random moves. See
+        GoUctFullBoardGammaGenerator. Default is false. */
+    bool m_fullBoardGammaPlayout;
+
     /** See GoUctPureRandomGenerator::GenerateFillboardMove.
         Default is 0 */
     int m_fillboardTries;
@@ -84,6 +100,8 @@ enum GoUctPlayoutPolicyType
 
     GOUCT_RANDOM,
 
+    GOUCT_FULLBOARD_GAMMA,
+
     GOUCT_SELFATARI_CORRECTION,
 
     GOUCT_CLUMP_CORRECTION,
@@ -220,7 +238,8 @@ public:
 
 private:
 
-    /** Incrementally keeps track of blocks in atari. */
+    /** Incrementally keeps track of blocks in atari.
+        Specialized for GoUctBoard to use GoUctBoard::AtariBlocks(). */
     class CaptureGenerator
     {
     public:
@@ -288,6 +307,8 @@ private:
 
     GoUctPureRandomGenerator<BOARD> m_pureRandomGenerator;
 
+    GoUctFullBoardGammaGenerator<BOARD> m_fullBoardGammaGenerator;
+
     SgBWArray<GoUctPlayoutPolicyStat> m_statistics;
 
     /** Captures if last move was self-atari */
@@ -299,6 +320,16 @@ private:
     /** Generate low lib moves around lastMove */
     bool GenerateLowLibMove(SgPoint lastMove);
 
+    /** Can there be blocks of color c in atari?
+        Always true for boards that do not know their blocks in atari
+        without a search; specialized for GoUctBoard, see
+        GoUctBoard::AtariBlocks(). */
+    bool MayHaveAtariBlocks(SgBlackWhite c) const;
+
+    /** Can there be blocks of color c with two liberties?
+        See MayHaveAtariBlocks() */
+    bool MayHaveTwoLibertyBlocks(SgBlackWhite c) const;
+
     bool GenerateNakadeMove();
 
     void GenerateNakadeMove(SgPoint p);
@@ -396,6 +427,29 @@ void GoUctPlayoutPolicy<BOARD>::CaptureGenerator::Generate(GoPointList& moves)
     }
 }
 
+template<>
+inline void GoUctPlayoutPolicy<GoUctBoard>::CaptureGenerator::StartPlayout()
+{
+    // Blocks in atari are maintained by the board
+}
+
+template<>
+inline void GoUctPlayoutPolicy<GoUctBoard>::CaptureGenerator::OnPlay()
+{
+    // Blocks in atari are maintained by the board
+}
+
+template<>
+inline void
+GoUctPlayoutPolicy<GoUctBoard>::CaptureGenerator::Generate(GoPointList& moves)
+{
+    SG_ASSERT(moves.IsEmpty());
+    // See comment in the generic version about duplicate moves
+    const GoUctBoard::AnchorList& anchors = m_bd.AtariBlocks(m_bd.Opponent());
+    for (GoUctBoard::AnchorList::Iterator it(anchors); it; ++it)
+        moves.PushBack(m_bd.TheLiberty(*it));
+}
+
 template<class BOARD>
 GoUctPlayoutPolicy<BOARD>::GoUctPlayoutPolicy(const BOARD& bd,
     const GoUctPlayoutPolicyParam& param)
@@ -407,7 +461,9 @@ GoUctPlayoutPolicy<BOARD>::GoUctPlayoutPolicy(const BOARD& bd,
       m_gammaGenerator(bd, param.m_patternGammaThreshold,
                        m_patterns, m_random),
       m_captureGenerator(bd),
-      m_pureRandomGenerator(bd, m_random)
+      m_pureRandomGenerator(bd, m_random),
+      m_fullBoardGammaGenerator(bd, param.m_patternGammaThreshold,
+                                m_patterns, m_random)
 {
     ClearStatistics();
 }
@@ -462,6 +518,8 @@ bool GoUctPlayoutPolicy<BOARD>::GenerateAtariCaptureMove()
 template<class BOARD>
 bool GoUctPlayoutPolicy<BOARD>::GenerateAtariDefenseMove()
 {
+    if (! MayHaveAtariBlocks(m_bd.ToPlay()))
+        return false;
     return GoBoardUtil::AtariDefenseMoves(m_bd, m_lastMove, m_moves);
 }
 
@@ -493,7 +551,9 @@ bool GoUctPlayoutPolicy<BOARD>::GenerateLowLibMove(SgPoint lastMove)
         PlayGoodLiberties(anchor);
     }
 
-    if (m_bd.NumNeighbors(lastMove, toPlay) != 0)
+    if (  m_bd.NumNeighbors(lastMove, toPlay) != 0
+       && MayHaveTwoLibertyBlocks(toPlay)
+       )
     {
         // play liberties of neighbor blocks
         SgArrayList<SgPoint,4> ourLowLibBlocks;
@@ -556,7 +616,7 @@ SG_ATTR_FLATTEN SgPoint GoUctPlayoutPolicy<BOARD>::GenerateMove()
             m_moveType = GOUCT_LOWLIB;
             mv = SelectRandom();
         }
-        if (mv == SG_NULLMOVE)
+        if (mv == SG_NULLMOVE && ! m_param.m_fullBoardGammaPlayout)
         {
         	if (m_param.m_usePatternsInPlayout)
             {
@@ -582,8 +642,16 @@ SG_ATTR_FLATTEN SgPoint GoUctPlayoutPolicy<BOARD>::GenerateMove()
     }
     if (mv == SG_NULLMOVE)
     {
-        m_moveType = GOUCT_RANDOM;
-        mv = m_pureRandomGenerator.Generate();
+        if (m_param.m_fullBoardGammaPlayout)
+        {
+            m_moveType = GOUCT_FULLBOARD_GAMMA;
+            mv = m_fullBoardGammaGenerator.Generate();
+        }
+        else
+        {
+            m_moveType = GOUCT_RANDOM;
+            mv = m_pureRandomGenerator.Generate();
+        }
     }
     if (mv == SG_NULLMOVE)
     {
@@ -745,7 +813,7 @@ GoPointList GoUctPlayoutPolicy<BOARD>::AllRandomMoves() const
 template<class BOARD>
 GoPointList GoUctPlayoutPolicy<BOARD>::GetEquivalentBestMoves() const
 {
-    if (m_moveType == GOUCT_RANDOM)
+    if (m_moveType == GOUCT_RANDOM || m_moveType == GOUCT_FULLBOARD_GAMMA)
         return AllRandomMoves();
     
     // Move in m_moves are not checked yet, if legal etc.
@@ -808,12 +876,45 @@ GetPolicyMoves(GoUctPlayoutPolicyType type)
         case GOUCT_RANDOM: m_moves = AllRandomMoves();
         break;
         
+        case GOUCT_FULLBOARD_GAMMA: m_moves = AllRandomMoves();
+        break;
+        
         default: SG_ASSERT(false); // not implemented
     }
     EndPlayout();
     return m_moves;
 }
 
+template<class BOARD>
+inline bool GoUctPlayoutPolicy<BOARD>::MayHaveAtariBlocks(SgBlackWhite c)
+    const
+{
+    SG_UNUSED(c);
+    return true;
+}
+
+template<>
+inline bool GoUctPlayoutPolicy<GoUctBoard>::MayHaveAtariBlocks(SgBlackWhite c)
+    const
+{
+    return ! m_bd.AtariBlocks(c).IsEmpty();
+}
+
+template<class BOARD>
+inline bool GoUctPlayoutPolicy<BOARD>::MayHaveTwoLibertyBlocks(SgBlackWhite c)
+    const
+{
+    SG_UNUSED(c);
+    return true;
+}
+
+template<>
+inline bool GoUctPlayoutPolicy<GoUctBoard>::MayHaveTwoLibertyBlocks(
+                                                         SgBlackWhite c) const
+{
+    return ! m_bd.TwoLibertyBlocks(c).IsEmpty();
+}
+
 template<class BOARD>
 GoUctPlayoutPolicyType GoUctPlayoutPolicy<BOARD>::MoveType() const
 {
@@ -825,6 +926,8 @@ void GoUctPlayoutPolicy<BOARD>::OnPlay()
 {
     m_captureGenerator.OnPlay();
     m_pureRandomGenerator.OnPlay();
+    if (m_param.m_fullBoardGammaPlayout)
+        m_fullBoardGammaGenerator.OnPlay();
 }
 
 template<class BOARD>
@@ -866,6 +969,8 @@ void GoUctPlayoutPolicy<BOARD>::StartPlayout()
 {
     m_captureGenerator.StartPlayout();
     m_pureRandomGenerator.Start();
+    if (m_param.m_fullBoardGammaPlayout)
+        m_fullBoardGammaGenerator.Start();
     m_nonRandLen = 0;
 }
 
@@ -875,7 +980,7 @@ void GoUctPlayoutPolicy<BOARD>::UpdateStatistics()
     GoUctPlayoutPolicyStat& statistics = m_statistics[m_bd.ToPlay()];
     ++statistics.m_nuMoves;
     ++statistics.m_nuMoveType[m_moveType];
-    if (m_moveType == GOUCT_RANDOM)
+    if (m_moveType == GOUCT_RANDOM || m_moveType == GOUCT_FULLBOARD_GAMMA)
     {
         if (m_nonRandLen > 0)
         {
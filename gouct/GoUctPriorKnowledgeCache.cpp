@@ -0,0 +1,143 @@
+//----------------------------------------------------------------------------
+/** @file GoUctPriorKnowledgeCache.cpp
+    See GoUctPriorKnowledgeCache.h */
+//----------------------------------------------------------------------------
+
+#include "SgSystem.h"
+#include "GoUctPriorKnowledgeCache.h"
+
+#include <iomanip>
+#include <iostream>
+#include <boost/io/ios_state.hpp>
+#include "GoBoard.h"
+#include "SgWrite.h"
+
+using namespace std;
+
+//----------------------------------------------------------------------------
+
+namespace {
+
+/** Map a move or SG_NULLMOVE to [0..SG_PASS + 1]. */
+inline int MoveIndex(SgMove move)
+{
+    SG_ASSERT(move >= SG_NULLMOVE && move <= SG_PASS);
+    return move + 1;
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------
+
+GoUctPriorKnowledgeCache::Entry::Entry()
+    : m_isValid(false)
+{ }
+
+//----------------------------------------------------------------------------
+
+GoUctPriorKnowledgeCache::Stripe::Stripe()
+    : m_nuLookups(0),
+      m_nuHits(0)
+{ }
+
+//----------------------------------------------------------------------------
+
+GoUctPriorKnowledgeCache::GoUctPriorKnowledgeCache(size_t maxEntries)
+    : m_entries(maxEntries)
+{ }
+
+void GoUctPriorKnowledgeCache::Clear()
+{
+    for (size_t i = 0; i < NU_STRIPES; ++i)
+    {
+        Lock lock(m_stripes[i].m_mutex);
+        for (size_t j = i; j < m_entries.size(); j += NU_STRIPES)
+        {
+            m_entries[j].m_isValid = false;
+            m_entries[j].m_moves.clear();
+        }
+        m_stripes[i].m_nuLookups = 0;
+        m_stripes[i].m_nuHits = 0;
+    }
+}
+
+void GoUctPriorKnowledgeCache::ClearStatistics()
+{
+    for (size_t i = 0; i < NU_STRIPES; ++i)
+    {
+        Lock lock(m_stripes[i].m_mutex);
+        m_stripes[i].m_nuLookups = 0;
+        m_stripes[i].m_nuHits = 0;
+    }
+}
+
+SgHashCode GoUctPriorKnowledgeCache::Key(const GoBoard& bd)
+{
+    // The context is a unique integer for the triple of moves. Its
+    // XOR with the random Zobrist code of the position does not need to
+    // be random itself to avoid collisions.
+    const int base = SG_PASS + 2;
+    const int context = MoveIndex(bd.KoPoint())
+        + base * (MoveIndex(bd.GetLastMove())
+                  + base * MoveIndex(bd.Get2ndLastMove()));
+    SgHashCode key = bd.GetHashCodeInclToPlay();
+    SgHashUtil::XorInteger(key, context);
+    return key;
+}
+
+bool GoUctPriorKnowledgeCache::Lookup(const SgHashCode& key,
+                                      vector<SgUctMoveInfo>& moves)
+{
+    if (! IsEnabled())
+        return false;
+    const size_t index = Index(key);
+    Stripe& stripe = m_stripes[index % NU_STRIPES];
+    Lock lock(stripe.m_mutex);
+    ++stripe.m_nuLookups;
+    const Entry& entry = m_entries[index];
+    if (! entry.m_isValid || entry.m_key != key)
+        return false;
+    ++stripe.m_nuHits;
+    moves = entry.m_moves;
+    return true;
+}
+
+void GoUctPriorKnowledgeCache::SetMaxEntries(size_t maxEntries)
+{
+    vector<Entry> entries(maxEntries);
+    m_entries.swap(entries);
+    ClearStatistics();
+}
+
+void GoUctPriorKnowledgeCache::Store(const SgHashCode& key,
+                                     const vector<SgUctMoveInfo>& moves)
+{
+    if (! IsEnabled())
+        return;
+    const size_t index = Index(key);
+    Lock lock(m_stripes[index % NU_STRIPES].m_mutex);
+    Entry& entry = m_entries[index];
+    entry.m_isValid = true;
+    entry.m_key = key;
+    entry.m_moves = moves;
+}
+
+void GoUctPriorKnowledgeCache::WriteStatistics(ostream& out) const
+{
+    size_t nuLookups = 0;
+    size_t nuHits = 0;
+    for (size_t i = 0; i < NU_STRIPES; ++i)
+    {
+        Lock lock(m_stripes[i].m_mutex);
+        nuLookups += m_stripes[i].m_nuLookups;
+        nuHits += m_stripes[i].m_nuHits;
+    }
+    boost::io::ios_all_saver saver(out);
+    out << SgWriteLabel("PriorCache") << nuHits << '/' << nuLookups;
+    if (nuLookups > 0)
+        out << " (" << fixed << setprecision(1)
+            << nuHits * 100.0 / nuLookups << "%)";
+    out << '\n';
+}
+
+//----------------------------------------------------------------------------
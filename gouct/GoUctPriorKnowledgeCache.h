@@ -0,0 +1,141 @@
+//----------------------------------------------------------------------------
+/** @file GoUctPriorKnowledgeCache.h */
+//----------------------------------------------------------------------------
+
+#ifndef GOUCT_PRIORKNOWLEDGECACHE_H
+#define GOUCT_PRIORKNOWLEDGECACHE_H
+
+#include <cstddef>
+#include <iosfwd>
+#include <vector>
+#include <boost/thread/mutex.hpp>
+#include "SgHash.h"
+#include "SgUctTree.h"
+
+class GoBoard;
+
+//----------------------------------------------------------------------------
+
+/** Cache of the move lists with prior knowledge generated by
+    GoUctGlobalSearchState::GenerateAllMoves().
+    Computing the prior knowledge is the most expensive part of a node
+    expansion. Positions are expanded again after a subtree is discarded at
+    the start of the next search, after the tree was pruned, or when a
+    ponder search is followed by a genmove search. A cache hit replaces the
+    computation by copying the stored move list.
+
+    The cache is direct-mapped with a fixed number of entries, a new entry
+    overwrites the old entry in the same slot. The entries are divided into
+    NU_STRIPES stripes, each protected by its own mutex, so that the threads
+    of a search rarely wait for each other.
+
+    The key is computed by Key(). The cache does not know about parameters
+    of the search; the owner must call Clear(), if a parameter that
+    influences the prior knowledge changes. The legality of moves under
+    superko rules depends on the game history, which is not part of the key.
+    This is ignored, as GoUctState also ignores superko when it plays the
+    in-tree moves. */
+class GoUctPriorKnowledgeCache
+{
+public:
+    /** Number of independently locked parts of the cache. */
+    static const std::size_t NU_STRIPES = 64;
+
+    /** Constructor.
+        @param maxEntries The number of entries. 0 disables the cache. */
+    explicit GoUctPriorKnowledgeCache(std::size_t maxEntries);
+
+    /** Key of the current position of a board.
+        Combines the hash code including the color to play with the ko point
+        and the last two moves, which are used by the prior knowledge. */
+    static SgHashCode Key(const GoBoard& bd);
+
+    /** Remove all entries and clear the statistics. */
+    void Clear();
+
+    /** Reset the number of lookups and hits. */
+    void ClearStatistics();
+
+    bool IsEnabled() const;
+
+    /** Get the stored move list for a key.
+        @param key
+        @param[out] moves The stored moves, unchanged if there is no entry
+        for the key
+        @return @c true, if an entry for the key was found */
+    bool Lookup(const SgHashCode& key, std::vector<SgUctMoveInfo>& moves);
+
+    std::size_t MaxEntries() const;
+
+    /** Change the number of entries.
+        Removes all entries. Must not be called during a search. */
+    void SetMaxEntries(std::size_t maxEntries);
+
+    /** Store the move list for a key.
+        Replaces the entry in the slot of the key. */
+    void Store(const SgHashCode& key, const std::vector<SgUctMoveInfo>& moves);
+
+    /** Write the number of lookups and the hit rate since the last call of
+        ClearStatistics(). */
+    void WriteStatistics(std::ostream& out) const;
+
+private:
+    struct Entry
+    {
+        bool m_isValid;
+
+        SgHashCode m_key;
+
+        std::vector<SgUctMoveInfo> m_moves;
+
+        Entry();
+    };
+
+    /** Mutex and statistics for the entries with index i, for which
+        i % NU_STRIPES is the index of the stripe. */
+    struct Stripe
+    {
+        boost::mutex m_mutex;
+
+        std::size_t m_nuLookups;
+
+        std::size_t m_nuHits;
+
+        Stripe();
+    };
+
+    typedef boost::mutex::scoped_lock Lock;
+
+    std::vector<Entry> m_entries;
+
+    mutable Stripe m_stripes[NU_STRIPES];
+
+    /** Not implemented */
+    GoUctPriorKnowledgeCache(const GoUctPriorKnowledgeCache&);
+
+    /** Not implemented */
+    GoUctPriorKnowledgeCache& operator=(const GoUctPriorKnowledgeCache&);
+
+    std::size_t Index(const SgHashCode& key) const;
+};
+
+inline std::size_t GoUctPriorKnowledgeCache::Index(const SgHashCode& key)
+    const
+{
+    SG_ASSERT(IsEnabled());
+    return key.Hash(static_cast<int>(m_entries.size()));
+}
+
+inline bool GoUctPriorKnowledgeCache::IsEnabled() const
+{
+    return ! m_entries.empty();
+}
+
+inline std::size_t GoUctPriorKnowledgeCache::MaxEntries() const
+{
+    return m_entries.size();
+}
+
+//----------------------------------------------------------------------------
+
+#endif // GOUCT_PRIORKNOWLEDGECACHE_H
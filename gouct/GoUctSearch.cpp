@@ -7,10 +7,12 @@
 
 #include <fstream>
 #include <iostream>
+#include <sstream>
 #include "GoBoardUtil.h"
 #include "GoNodeUtil.h"
 #include "GoUctUtil.h"
 #include "SgDebug.h"
+#include "SgException.h"
 #include "SgGameWriter.h"
 #include "SgNode.h"
 #include "SgUctTreeUtil.h"
@@ -75,6 +77,26 @@ void AppendGame(SgNode* node, SgUctValue gameNumber, unsigned int threadId,
     }
 }
 
+/** Information about the position of a saved tree.
+    Used to check that a tree loaded with GoUctSearch::LoadTreeBinary()
+    belongs to the current position. Contains one line per property, each
+    line starting with a property name. */
+std::string TreeFileInfo(const GoBoard& bd)
+{
+    std::ostringstream out;
+    out << "boardsize " << bd.Size() << '\n'
+        << "komi " << bd.Rules().Komi() << '\n'
+        << "toplay " << (bd.ToPlay() == SG_BLACK ? 'B' : 'W') << '\n';
+    for (SgBWIterator it; it; ++it)
+    {
+        out << (*it == SG_BLACK ? "black" : "white");
+        for (SgSetIterator it2(bd.All(*it)); it2; ++it2)
+            out << ' ' << SgWritePoint(*it2);
+        out << '\n';
+    }
+    return out.str();
+}
+
 //----------------------------------------------------------------------------
 
 } // namespace
@@ -96,7 +118,8 @@ GoUctState::GoUctState(unsigned int threadId, const GoBoard& bd)
     : SgUctThreadState(threadId, MOVERANGE),
       m_assertionHandler(*this),
       m_uctBd(bd),
-      m_synchronizer(bd)
+      m_synchronizer(bd),
+      m_snapshotMoveNumber(-1)
 {
     m_synchronizer.SetSubscriber(m_bd);
     m_isInPlayout = false;
@@ -138,9 +161,37 @@ void GoUctState::GameStart()
     m_gameLength = 0;
 }
 
+bool GoUctState::GetHashCode(SgHashCode& hashCode) const
+{
+    SG_ASSERT(! m_isInPlayout);
+    hashCode = m_bd.GetHashCodeInclToPlay();
+    return true;
+}
+
 void GoUctState::StartPlayout()
 {
-    m_uctBd.Init(m_bd);
+    const int moveNumber = m_bd.MoveNumber();
+    if (m_snapshotMoveNumber < 0 || moveNumber < m_snapshotMoveNumber)
+    {
+        m_uctBd.Init(m_bd);
+        return;
+    }
+    m_uctBd.RestoreSnapshot();
+    for (int i = m_snapshotMoveNumber; i < moveNumber; ++i)
+    {
+        const GoPlayerMove move = m_bd.Move(i);
+        if (move.Color() != m_uctBd.ToPlay())
+        {
+            m_uctBd.Init(m_bd);
+            return;
+        }
+        // In-tree moves are played with simple ko and without suicide
+        // (see StartSearch()), so they are legal on the playout board
+        SG_ASSERT(m_uctBd.IsLegal(move.Point()));
+        m_uctBd.Play(move.Point());
+    }
+    if (m_uctBd.ToPlay() != m_bd.ToPlay())
+        m_uctBd.Init(m_bd);
 }
 
 void GoUctState::StartPlayouts()
@@ -151,6 +202,17 @@ void GoUctState::StartPlayouts()
 void GoUctState::StartSearch()
 {
     m_synchronizer.UpdateSubscriber();
+    m_uctBd.Init(m_bd);
+    // GoUctBoard does not support suicide moves, which could occur in the
+    // in-tree phase, so the playout board cannot be updated by replaying the
+    // in-tree moves then
+    if (m_bd.Rules().AllowSuicide())
+        m_snapshotMoveNumber = -1;
+    else
+    {
+        m_uctBd.TakeSnapshot();
+        m_snapshotMoveNumber = m_bd.MoveNumber();
+    }
 }
 
 void GoUctState::TakeBackInTree(std::size_t nuMoves)
@@ -237,6 +299,30 @@ void GoUctSearch::DisplayGfx()
     SgDebug() << '\n';
 }
 
+void GoUctSearch::LoadTreeBinary(const std::string& fileName)
+{
+    SgUctTree& tree = GetTempTree();
+    std::string info;
+    SgUctTreeUtil::LoadBinary(tree, fileName, info);
+    std::istringstream in(info);
+    std::istringstream expectedIn(TreeFileInfo(m_bd));
+    std::string line;
+    std::string expectedLine;
+    while (std::getline(expectedIn, expectedLine))
+        if (! std::getline(in, line) || line != expectedLine)
+        {
+            std::string property = expectedLine.substr(0,
+                                                    expectedLine.find(' '));
+            throw SgException("tree file does not match current position ("
+                              + property + ")");
+        }
+    UseTree(tree);
+    m_toPlay = m_bd.ToPlay();
+    for (SgBWIterator it; it; ++it)
+        m_stones[*it] = m_bd.All(*it);
+    m_boardHistory.SetFromBoard(m_bd);
+}
+
 void GoUctSearch::OnStartSearch()
 {
     SgUctSearch::OnStartSearch();
@@ -285,6 +371,17 @@ void GoUctSearch::SaveTree(std::ostream& out, int maxDepth) const
                         maxDepth);
 }
 
+void GoUctSearch::SaveTreeBinary(const std::string& fileName) const
+{
+    std::vector<SgPoint> sequence;
+    const SgUctNode* node = 0;
+    if (m_boardHistory.SequenceToCurrent(m_bd, sequence))
+        node = SgUctTreeUtil::FindMatchingNode(Tree(), sequence);
+    if (node == 0)
+        throw SgException("search tree does not contain current position");
+    SgUctTreeUtil::SaveBinary(Tree(), *node, fileName, TreeFileInfo(m_bd));
+}
+
 SgBlackWhite GoUctSearch::ToPlay() const
 {
     return m_toPlay;
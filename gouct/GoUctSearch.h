@@ -54,10 +54,19 @@ public:
 
     void GameStart();
 
+    /** Synchronizes the playout board with the in-tree board.
+        Restores the snapshot of the root position taken in StartSearch()
+        and replays the in-tree moves, which avoids re-initializing the
+        playout board from the in-tree board. Falls back to
+        GoUctBoard::Init(), if the moves cannot be replayed. */
     void StartPlayout();
 
     void StartPlayouts();
 
+    /** Returns the hash code of the in-tree board including the color to
+        play. */
+    bool GetHashCode(SgHashCode& hashCode) const;
+
     // @} // @name
 
     /** Board used during in-tree phase. */
@@ -73,6 +82,9 @@ public:
 
     void Dump(std::ostream& out) const;
 
+    /** See GoUctBoard::SetMaintainPatternCodes() */
+    void SetMaintainPatternCodes(bool enable);
+
 private:
     /** Assertion handler to dump the state of a GoUctState. */
     class AssertionHandler
@@ -97,6 +109,11 @@ private:
 
     GoBoardSynchronizer m_synchronizer;
 
+    /** Move number of m_bd at the snapshot of m_uctBd taken in
+        StartSearch().
+        -1, if no snapshot is used. */
+    int m_snapshotMoveNumber;
+
     bool m_isInPlayout;
 
     /** See GameLength() */
@@ -118,6 +135,12 @@ inline bool GoUctState::IsInPlayout() const
     return m_isInPlayout;
 }
 
+inline void GoUctState::SetMaintainPatternCodes(bool enable)
+{
+    if (enable != m_uctBd.MaintainPatternCodes())
+        m_uctBd.SetMaintainPatternCodes(enable);
+}
+
 inline const GoUctBoard& GoUctState::UctBoard() const
 {
     return m_uctBd;
@@ -195,6 +218,22 @@ public:
     /** See GoUctUtil::SaveTree() */
     void SaveTree(std::ostream& out, int maxDepth = -1) const;
 
+    /** Save the subtree for the current position in binary format.
+        The current position must be the position of the last search or
+        a follow-up position contained in the search tree.
+        See SgUctTreeUtil::SaveBinary()
+        @throws SgException if the tree does not contain the current position
+        or the file cannot be written */
+    void SaveTreeBinary(const std::string& fileName) const;
+
+    /** Load a tree saved with SaveTreeBinary().
+        The next search in the current position continues with the loaded
+        tree (see SgUctSearch::UseTree()).
+        @throws SgException if the file is not valid, does not fit into the
+        search tree, or was saved for a position with a different board size,
+        komi, color to play or stones on the board */
+    void LoadTreeBinary(const std::string& fileName);
+
     /** Set initial color to play. */
     void SetToPlay(SgBlackWhite toPlay);
 
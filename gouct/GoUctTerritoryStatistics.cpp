@@ -0,0 +1,40 @@
+//----------------------------------------------------------------------------
+/** @file GoUctTerritoryStatistics.cpp
+    See GoUctTerritoryStatistics.h */
+//----------------------------------------------------------------------------
+
+#include "SgSystem.h"
+#include "GoUctTerritoryStatistics.h"
+
+//----------------------------------------------------------------------------
+
+GoUctTerritoryStatistics::GoUctTerritoryStatistics()
+{
+    Clear();
+}
+
+void GoUctTerritoryStatistics::Clear()
+{
+    m_count = 0;
+    m_owner[SG_BLACK].Fill(0);
+    m_owner[SG_WHITE].Fill(0);
+}
+
+void GoUctTerritoryStatistics::Merge(
+                                 const GoUctTerritoryStatistics& statistics)
+{
+    // Read the number of games last, the other instance increments it after
+    // adding the point counts of a game
+    for (SgBWIterator it; it; ++it)
+    {
+        unsigned int* owner = &m_owner[*it][0];
+        const unsigned int* otherOwner = &statistics.m_owner[*it][0];
+        // Plain loop over contiguous arrays, can be vectorized by the
+        // compiler
+        for (int i = 0; i < SG_MAXPOINT; ++i)
+            owner[i] += otherOwner[i];
+    }
+    m_count += statistics.m_count;
+}
+
+//----------------------------------------------------------------------------
@@ -0,0 +1,89 @@
+//----------------------------------------------------------------------------
+/** @file GoUctTerritoryStatistics.h */
+//----------------------------------------------------------------------------
+
+#ifndef GOUCT_TERRITORYSTATISTICS_H
+#define GOUCT_TERRITORYSTATISTICS_H
+
+#include "SgArray.h"
+#include "SgBWArray.h"
+#include "SgBWSet.h"
+#include "SgPoint.h"
+#include "SgUctValue.h"
+
+//----------------------------------------------------------------------------
+
+/** Statistics of the owners of the points in the terminal positions of the
+    playouts.
+    Stores the number of games and, for each point, the number of games in
+    which the point belonged to Black or to White in contiguous integer
+    arrays. Mean() is the mean of the values 1 (Black), 0.5 (neither
+    color) and 0 (White) over all games.
+
+    Each search thread owns one instance. Merge() only reads the other
+    instance, so the statistics of all threads can be merged while the
+    search is running, without locks. The result can then be slightly
+    inconsistent (a point count can include a game that is not yet included
+    in the number of games); Mean() clips to [0..1] for this case. */
+class GoUctTerritoryStatistics
+{
+public:
+    GoUctTerritoryStatistics();
+
+    /** Add the terminal position of a game.
+        @param area The points counted for each color (see
+        GoBoardUtil::TrompTaylorScoreBitset()) */
+    void Add(const SgBWSet& area);
+
+    void Clear();
+
+    /** Number of games. */
+    SgUctValue Count() const;
+
+    /** Probability that a point belonged to Black.
+        Requires Count() > 0 */
+    SgUctValue Mean(SgPoint p) const;
+
+    /** Add the counts of another instance.
+        The other instance can be updated concurrently by another thread. */
+    void Merge(const GoUctTerritoryStatistics& statistics);
+
+private:
+    unsigned int m_count;
+
+    SgBWArray<SgArray<unsigned int,SG_MAXPOINT> > m_owner;
+};
+
+inline void GoUctTerritoryStatistics::Add(const SgBWSet& area)
+{
+    for (SgBWIterator it; it; ++it)
+    {
+        SgArray<unsigned int,SG_MAXPOINT>& owner = m_owner[*it];
+        for (SgSetIterator it2(area[*it]); it2; ++it2)
+            ++owner[*it2];
+    }
+    ++m_count;
+}
+
+inline SgUctValue GoUctTerritoryStatistics::Count() const
+{
+    return SgUctValue(m_count);
+}
+
+inline SgUctValue GoUctTerritoryStatistics::Mean(SgPoint p) const
+{
+    SG_ASSERT(m_count > 0);
+    const SgUctValue count = SgUctValue(m_count);
+    const SgUctValue mean =
+        (count + SgUctValue(m_owner[SG_BLACK][p])
+         - SgUctValue(m_owner[SG_WHITE][p])) / (2 * count);
+    if (mean < 0)
+        return 0;
+    if (mean > 1)
+        return 1;
+    return mean;
+}
+
+//----------------------------------------------------------------------------
+
+#endif // GOUCT_TERRITORYSTATISTICS_H
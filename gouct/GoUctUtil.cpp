@@ -9,6 +9,7 @@
 #include <iostream>
 #include <boost/io/ios_state.hpp>
 #include <boost/format.hpp>
+#include "GoUctTerritoryStatistics.h"
 #include "SgBWSet.h"
 #include "SgPointSet.h"
 #include "SgProp.h"
@@ -203,16 +204,16 @@ void GoUctUtil::GfxStatus(const SgUctSearch& search, ostream& out)
 }
 
 void GoUctUtil::GfxTerritoryStatistics(
-                     const SgPointArray<SgUctStatistics>& territoryStatistics,
+                     const GoUctTerritoryStatistics& territoryStatistics,
                      const GoBoard& bd, std::ostream& out)
 {
     boost::io::ios_all_saver saver(out);
     out << fixed << setprecision(3) << "INFLUENCE";
-    for (GoBoard::Iterator it(bd); it; ++it)
-        if (territoryStatistics[*it].Count() > 0)
+    if (territoryStatistics.Count() > 0)
+        for (GoBoard::Iterator it(bd); it; ++it)
             // Scale to [-1,+1], black positive
             out << ' ' << SgWritePoint(*it) << ' '
-                << territoryStatistics[*it].Mean() * 2 - 1;
+                << territoryStatistics.Mean(*it) * 2 - 1;
     out << '\n';
 }
 
@@ -17,6 +17,7 @@
 #include "SgUctSearch.h"
 #include "SgUtil.h"
 
+class GoUctTerritoryStatistics;
 class SgBWSet;
 template<typename T,int N> class SgArrayList;
 
@@ -163,7 +164,7 @@ namespace GoUctUtil
         analyze command type "gfx" after the search (see http://gogui.sf.net).
         Uses INFLUENCE gfx command. */
     void GfxTerritoryStatistics(
-            const SgPointArray<SgUctStatistics>& territoryStatistics,
+            const GoUctTerritoryStatistics& territoryStatistics,
             const GoBoard& bd, std::ostream& out);
 
     /** selfatari of a larger number of stones and also atari on opponent. */
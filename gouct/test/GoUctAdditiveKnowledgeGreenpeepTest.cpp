@@ -0,0 +1,32 @@
+//----------------------------------------------------------------------------
+/** @file GoUctAdditiveKnowledgeGreenpeepTest.cpp
+    Unit tests for GoUctAdditiveKnowledgeGreenpeep. */
+//----------------------------------------------------------------------------
+
+#include "SgSystem.h"
+
+#include <boost/test/auto_unit_test.hpp>
+#include "GoUctAdditiveKnowledgeGreenpeep.h"
+
+//----------------------------------------------------------------------------
+
+namespace {
+
+/** Check the lookup of some entries of GoUctGreenpeepPatterns19.h,
+    including the first and last entry and contexts that are not in the
+    table. */
+BOOST_AUTO_TEST_CASE(GoUctAdditiveKnowledgeGreenpeepTest_Predictor19x19)
+{
+    const GoUctAdditiveKnowledgeParamGreenpeep param;
+    BOOST_CHECK_EQUAL(param.Predictor19x19(0), 512);
+    BOOST_CHECK_EQUAL(param.Predictor19x19(3), 16);
+    BOOST_CHECK_EQUAL(param.Predictor19x19(101), 903);
+    BOOST_CHECK_EQUAL(param.Predictor19x19(34141), 575);
+    BOOST_CHECK_EQUAL(param.Predictor19x19(34142), 512);
+    BOOST_CHECK_EQUAL(param.Predictor19x19(16774384), 6650);
+    BOOST_CHECK_EQUAL(param.Predictor19x19(NUMPATTERNS19X19 - 1), 512);
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------
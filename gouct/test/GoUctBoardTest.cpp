@@ -5,8 +5,12 @@
 
 #include "SgSystem.h"
 
+#include <algorithm>
+#include <vector>
 #include <boost/test/auto_unit_test.hpp>
+#include "GoPattern3x3.h"
 #include "GoUctBoard.h"
+#include "SgRandom.h"
 
 using SgPointUtil::Pt;
 
@@ -50,6 +54,217 @@ BOOST_AUTO_TEST_CASE(GoUctBoardTest_IsLibertyOfBlock)
     BOOST_CHECK(! bd.IsLibertyOfBlock(Pt(2, 3), bd.Anchor(Pt(1, 2))));
 }
 
+/** Test the stones and liberties of blocks after merging blocks and after
+    a capture. */
+/** Test LibertyIterator for the corner points with the highest point
+    numbers, which are in the last used word of the liberty bitsets. */
+BOOST_AUTO_TEST_CASE(GoUctBoardTest_LibertyIteratorBoardSize)
+{
+    for (int size = 3; size <= SG_MAX_SIZE; ++size)
+    {
+        GoSetup setup;
+        setup.AddBlack(Pt(size, size));
+        setup.AddWhite(Pt(size - 1, size));
+        GoBoard board(size, setup);
+        GoUctBoard bd(board);
+        GoPointList liberties;
+        for (GoUctBoard::LibertyIterator it(bd, Pt(size, size)); it; ++it)
+            liberties.PushBack(*it);
+        BOOST_CHECK_EQUAL(liberties.Length(), 1);
+        BOOST_CHECK(liberties.Contains(Pt(size, size - 1)));
+        bd.Play(Pt(size, size - 1));
+        BOOST_CHECK(bd.AreInSameBlock(Pt(size, size), Pt(size, size - 1)));
+        BOOST_CHECK_EQUAL(bd.NumLiberties(Pt(size, size)), 2);
+    }
+}
+
+/** Check GoUctBoard::AtariBlocks() and GoUctBoard::TwoLibertyBlocks()
+    against the blocks on the board. */
+void CheckLowLibertyBlocks(const GoUctBoard& bd)
+{
+    for (SgBWIterator it; it; ++it)
+    {
+        std::vector<SgPoint> atari;
+        std::vector<SgPoint> twoLib;
+        for (GoUctBoard::Iterator it2(bd); it2; ++it2)
+            if (bd.IsColor(*it2, *it) && bd.Anchor(*it2) == *it2)
+            {
+                if (bd.NumLiberties(*it2) == 1)
+                    atari.push_back(*it2);
+                else if (bd.NumLiberties(*it2) == 2)
+                    twoLib.push_back(*it2);
+            }
+        std::vector<SgPoint> atariBlocks;
+        for (GoUctBoard::AnchorList::Iterator it2(bd.AtariBlocks(*it));
+             it2; ++it2)
+            atariBlocks.push_back(*it2);
+        std::vector<SgPoint> twoLibBlocks;
+        for (GoUctBoard::AnchorList::Iterator it2(bd.TwoLibertyBlocks(*it));
+             it2; ++it2)
+            twoLibBlocks.push_back(*it2);
+        std::sort(atariBlocks.begin(), atariBlocks.end());
+        std::sort(twoLibBlocks.begin(), twoLibBlocks.end());
+        BOOST_CHECK(atari == atariBlocks);
+        BOOST_CHECK(twoLib == twoLibBlocks);
+    }
+}
+
+/** Test that the lists of blocks with one or two liberties are updated
+    after merges, captures and RestoreSnapshot(). */
+BOOST_AUTO_TEST_CASE(GoUctBoardTest_LowLibertyBlocks)
+{
+    GoSetup setup;
+    setup.AddBlack(Pt(2, 1));
+    setup.AddBlack(Pt(2, 2));
+    setup.AddBlack(Pt(4, 2));
+    setup.AddWhite(Pt(1, 1));
+    setup.AddWhite(Pt(1, 2));
+    GoBoard board(9, setup);
+    GoUctBoard bd(board);
+    CheckLowLibertyBlocks(bd);
+    BOOST_CHECK_EQUAL(bd.AtariBlocks(SG_WHITE).Length(), 1);
+    bd.TakeSnapshot();
+    SgRandom random;
+    for (int i = 0; i < 3; ++i)
+    {
+        bd.Play(Pt(3, 2));
+        CheckLowLibertyBlocks(bd);
+        bd.Play(Pt(5, 5));
+        bd.Play(Pt(1, 3));
+        CheckLowLibertyBlocks(bd);
+        BOOST_CHECK(bd.AtariBlocks(SG_WHITE).IsEmpty());
+        // Continue with a random game
+        for (int j = 0; j < 100; ++j)
+        {
+            SgPoint p = SG_PASS;
+            for (int k = 0; k < 20; ++k)
+            {
+                SgPoint q = Pt(random.Int(9) + 1, random.Int(9) + 1);
+                if (bd.IsEmpty(q) && bd.IsLegal(q) && ! bd.IsSuicide(q))
+                {
+                    p = q;
+                    break;
+                }
+            }
+            bd.Play(p);
+            CheckLowLibertyBlocks(bd);
+        }
+        bd.RestoreSnapshot();
+        CheckLowLibertyBlocks(bd);
+        BOOST_CHECK_EQUAL(bd.AtariBlocks(SG_WHITE).Length(), 1);
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(GoUctBoardTest_MergeAndCapture)
+{
+    GoSetup setup;
+    setup.AddBlack(Pt(2, 1));
+    setup.AddBlack(Pt(2, 2));
+    setup.AddBlack(Pt(2, 3));
+    setup.AddBlack(Pt(4, 2));
+    setup.AddWhite(Pt(1, 1));
+    setup.AddWhite(Pt(1, 2));
+    GoBoard board(9, setup);
+    GoUctBoard bd(board);
+    BOOST_CHECK_EQUAL(bd.NumStones(Pt(2, 2)), 3);
+    BOOST_CHECK_EQUAL(bd.NumLiberties(Pt(2, 2)), 5);
+    bd.Play(Pt(3, 2));
+    BOOST_CHECK(bd.AreInSameBlock(Pt(2, 3), Pt(4, 2)));
+    BOOST_CHECK_EQUAL(bd.NumStones(Pt(4, 2)), 5);
+    BOOST_CHECK_EQUAL(bd.NumLiberties(Pt(4, 2)), 7);
+    GoPointList stones;
+    for (GoUctBoard::StoneIterator it(bd, Pt(4, 2)); it; ++it)
+        stones.PushBack(*it);
+    BOOST_CHECK_EQUAL(stones.Length(), 5);
+    BOOST_CHECK(stones.Contains(Pt(2, 1)));
+    BOOST_CHECK(stones.Contains(Pt(2, 2)));
+    BOOST_CHECK(stones.Contains(Pt(2, 3)));
+    BOOST_CHECK(stones.Contains(Pt(3, 2)));
+    BOOST_CHECK(stones.Contains(Pt(4, 2)));
+    int nuLiberties = 0;
+    for (GoUctBoard::LibertyIterator it(bd, Pt(2, 2)); it; ++it)
+    {
+        BOOST_CHECK(bd.IsEmpty(*it));
+        BOOST_CHECK(bd.IsLibertyOfBlock(*it, bd.Anchor(Pt(2, 2))));
+        ++nuLiberties;
+    }
+    BOOST_CHECK_EQUAL(nuLiberties, 7);
+    BOOST_CHECK(bd.InAtari(Pt(1, 1)));
+    BOOST_CHECK_EQUAL(bd.TheLiberty(Pt(1, 1)), Pt(1, 3));
+    bd.Play(Pt(5, 5));
+    bd.Play(Pt(1, 3));
+    BOOST_CHECK_EQUAL(bd.NuCapturedStones(), 2);
+    BOOST_CHECK(bd.IsEmpty(Pt(1, 1)));
+    BOOST_CHECK(bd.IsEmpty(Pt(1, 2)));
+    BOOST_CHECK_EQUAL(bd.NumPrisoners(SG_WHITE), 2);
+    BOOST_CHECK(bd.AreInSameBlock(Pt(1, 3), Pt(4, 2)));
+    BOOST_CHECK_EQUAL(bd.NumStones(Pt(1, 3)), 6);
+    BOOST_CHECK_EQUAL(bd.NumLiberties(Pt(1, 3)), 9);
+}
+
+/** Test that the incrementally maintained pattern codes match the
+    pattern codes computed from the board after moves with captures. */
+BOOST_AUTO_TEST_CASE(GoUctBoardTest_PatternCode)
+{
+    GoBoard board(9);
+    GoUctBoard bd(board);
+    bd.SetMaintainPatternCodes(true);
+    int nuCaptured = 0;
+    for (int i = 0; i < 300; ++i)
+    {
+        SgPoint p = Pt(1 + (i * 7) % 9, 1 + (i * 5 + i / 9) % 9);
+        if (! bd.IsLegal(p))
+            p = SG_PASS;
+        bd.Play(p);
+        nuCaptured += bd.NuCapturedStones();
+        for (GoUctBoard::Iterator it(bd); it; ++it)
+        {
+            if (bd.Line(*it) > 1)
+                BOOST_CHECK_EQUAL(bd.PatternCode(*it),
+                              GoPattern3x3::CodeOf8Neighbors(bd, *it));
+            else if (bd.Pos(*it) > 1)
+                BOOST_CHECK_EQUAL(bd.PatternCode(*it),
+                              GoPattern3x3::CodeOfEdgeNeighbors(bd, *it));
+        }
+    }
+    BOOST_CHECK(nuCaptured > 0);
+}
+
+BOOST_AUTO_TEST_CASE(GoUctBoardTest_RestoreSnapshot)
+{
+    GoSetup setup;
+    setup.AddBlack(Pt(2, 1));
+    setup.AddBlack(Pt(2, 2));
+    setup.AddBlack(Pt(4, 2));
+    setup.AddWhite(Pt(1, 1));
+    setup.AddWhite(Pt(1, 2));
+    GoBoard board(9, setup);
+    GoUctBoard bd(board);
+    bd.TakeSnapshot();
+    for (int i = 0; i < 2; ++i)
+    {
+        bd.Play(Pt(3, 2));
+        bd.Play(Pt(5, 5));
+        bd.Play(Pt(1, 3));
+        BOOST_CHECK(bd.IsEmpty(Pt(1, 1)));
+        BOOST_CHECK(bd.AreInSameBlock(Pt(2, 2), Pt(4, 2)));
+        bd.RestoreSnapshot();
+        BOOST_CHECK_EQUAL(bd.ToPlay(), SG_BLACK);
+        BOOST_CHECK_EQUAL(bd.GetLastMove(), SG_NULLMOVE);
+        BOOST_CHECK_EQUAL(bd.NumPrisoners(SG_WHITE), 0);
+        BOOST_CHECK(bd.IsEmpty(Pt(1, 3)));
+        BOOST_CHECK(bd.IsEmpty(Pt(3, 2)));
+        BOOST_CHECK(bd.IsEmpty(Pt(5, 5)));
+        BOOST_CHECK_EQUAL(bd.GetColor(Pt(1, 1)), SG_WHITE);
+        BOOST_CHECK(! bd.AreInSameBlock(Pt(2, 2), Pt(4, 2)));
+        BOOST_CHECK_EQUAL(bd.NumStones(Pt(2, 2)), 2);
+        BOOST_CHECK_EQUAL(bd.NumLiberties(Pt(2, 2)), 3);
+        BOOST_CHECK_EQUAL(bd.NumStones(Pt(1, 1)), 2);
+        BOOST_CHECK_EQUAL(bd.NumLiberties(Pt(1, 1)), 1);
+    }
+}
+
 } // namespace
 
 //----------------------------------------------------------------------------
@@ -23,7 +23,8 @@ BOOST_AUTO_TEST_CASE(GoUctFeatureKnowledgeTest_GoUctFeatureKnowledge)
 {
     GoBoard bd(19);
     FeFeatureWeights weights(0,0);
-    GoUctFeatureKnowledge k(bd, weights);
+    const FeFactorEvaluator evaluator(weights);
+    GoUctFeatureKnowledge k(bd, evaluator);
 
     // TODO test something...
 }
@@ -0,0 +1,85 @@
+//----------------------------------------------------------------------------
+/** @file GoUctFullBoardGammaGeneratorTest.cpp
+    Unit tests for GoUctFullBoardGammaGenerator. */
+//----------------------------------------------------------------------------
+
+#include "SgSystem.h"
+
+#include <boost/test/auto_unit_test.hpp>
+#include "GoUctFullBoardGammaGenerator.h"
+
+#include "GoBoard.h"
+
+using SgPointUtil::Pt;
+
+//----------------------------------------------------------------------------
+
+namespace {
+
+/** Check that the weights are the same as the weights computed from
+    scratch. */
+void CheckWeights(const GoBoard& bd,
+                  const GoUctFullBoardGammaGenerator<GoBoard>& generator,
+                  const GoUctPatterns<GoBoard>& patterns)
+{
+    SgRandom random;
+    GoUctFullBoardGammaGenerator<GoBoard> expected(bd, 50.f, patterns,
+                                                   random);
+    expected.Start();
+    for (GoBoard::Iterator it(bd); it; ++it)
+        for (SgBWIterator itColor; itColor; ++itColor)
+            BOOST_CHECK_EQUAL(generator.Weight(*it, *itColor),
+                              expected.Weight(*it, *itColor));
+}
+
+/** Test that the weights are updated after moves and captures. */
+BOOST_AUTO_TEST_CASE(GoUctFullBoardGammaGeneratorTest_OnPlay)
+{
+    GoBoard bd(9);
+    GoUctPatterns<GoBoard> patterns(bd, GoUctPatterns<GoBoard>::PATTERN_LOCAL);
+    SgRandom random;
+    GoUctFullBoardGammaGenerator<GoBoard> generator(bd, 50.f, patterns,
+                                                    random);
+    bd.Play(Pt(5, 5), SG_BLACK);
+    generator.Start();
+    CheckWeights(bd, generator, patterns);
+    BOOST_CHECK_EQUAL(generator.Weight(Pt(5, 5), SG_BLACK), 0.f);
+    // White stone at 1,1 captured by 2,1 and 1,2
+    bd.Play(Pt(1, 1), SG_WHITE);
+    generator.OnPlay();
+    bd.Play(Pt(2, 1), SG_BLACK);
+    generator.OnPlay();
+    bd.Play(SG_PASS, SG_WHITE);
+    generator.OnPlay();
+    bd.Play(Pt(1, 2), SG_BLACK);
+    generator.OnPlay();
+    BOOST_CHECK(bd.IsEmpty(Pt(1, 1)));
+    CheckWeights(bd, generator, patterns);
+    BOOST_CHECK(generator.Weight(Pt(1, 1), SG_WHITE) > 0);
+}
+
+/** Test that Generate() selects only points that fulfill
+    GoUctUtil::GeneratePoint(). */
+BOOST_AUTO_TEST_CASE(GoUctFullBoardGammaGeneratorTest_Generate)
+{
+    GoBoard bd(9);
+    GoUctPatterns<GoBoard> patterns(bd, GoUctPatterns<GoBoard>::PATTERN_LOCAL);
+    SgRandom random;
+    GoUctFullBoardGammaGenerator<GoBoard> generator(bd, 50.f, patterns,
+                                                    random);
+    generator.Start();
+    for (int i = 0; i < 200; ++i)
+    {
+        SgPoint p = generator.Generate();
+        if (p == SG_NULLMOVE)
+            break;
+        BOOST_REQUIRE(GoUctUtil::GeneratePoint(bd, p, bd.ToPlay()));
+        bd.Play(p);
+        generator.OnPlay();
+    }
+    CheckWeights(bd, generator, patterns);
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------
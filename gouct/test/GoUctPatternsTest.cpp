@@ -44,6 +44,44 @@ namespace {
         BOOST_CHECK_EQUAL(codeB, SwapCenterColor(codeW));
         BOOST_CHECK_EQUAL(codeW, SwapCenterColor(codeB));
     }
+
+    /** Check that the tables of a pattern type are created once and shared,
+        and that the types differ only in the gamma values. */
+    BOOST_AUTO_TEST_CASE(GoUctPatternsTest_SharedTables)
+    {
+        typedef GoUctPatternTables Tables;
+        const boost::shared_ptr<const Tables> local =
+            Tables::Get(Tables::PATTERN_LOCAL);
+        const boost::shared_ptr<const Tables> global =
+            Tables::Get(Tables::PATTERN_GLOBAL);
+        const boost::shared_ptr<const Tables> noGamma =
+            Tables::Get(Tables::PATTERN_NO_GAMMA);
+        BOOST_CHECK(local == Tables::Get(Tables::PATTERN_LOCAL));
+        BOOST_CHECK(global == Tables::Get(Tables::PATTERN_GLOBAL));
+        BOOST_CHECK(local != global);
+        bool hasGamma = false;
+        for (int code = 0; code < GoPattern3x3::POWER3_8; ++code)
+        {
+            const bool isPattern =
+                noGamma->Center(SG_BLACK, code).IsPattern();
+            BOOST_CHECK_EQUAL(local->Center(SG_BLACK, code).IsPattern(),
+                              isPattern);
+            BOOST_CHECK_EQUAL(global->Center(SG_BLACK, code).IsPattern(),
+                              isPattern);
+            BOOST_CHECK_EQUAL(noGamma->Center(SG_BLACK, code).GetGammaValue(),
+                              0.f);
+            if (local->Center(SG_BLACK, code).GetGammaValue() > 0.f)
+                hasGamma = true;
+        }
+        BOOST_CHECK(hasGamma);
+
+        GoBoard bd(9);
+        const GoUctPatterns<GoBoard> patterns(bd,
+                                        GoUctPatterns<GoBoard>::PATTERN_LOCAL);
+        for (int code = 0; code < GoPattern3x3::POWER3_5; ++code)
+            BOOST_CHECK_EQUAL(patterns.EdgeGamma(SG_WHITE, code),
+                              local->Edge(SG_WHITE, code).GetGammaValue());
+    }
     
 } // namespace
 
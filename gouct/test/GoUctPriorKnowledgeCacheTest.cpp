@@ -0,0 +1,101 @@
+//----------------------------------------------------------------------------
+/** @file GoUctPriorKnowledgeCacheTest.cpp
+    Unit tests for GoUctPriorKnowledgeCache. */
+//----------------------------------------------------------------------------
+
+#include "SgSystem.h"
+
+#include <sstream>
+#include <boost/test/auto_unit_test.hpp>
+#include "GoBoard.h"
+#include "GoUctPriorKnowledgeCache.h"
+
+using namespace std;
+using SgPointUtil::Pt;
+
+//----------------------------------------------------------------------------
+
+namespace {
+
+BOOST_AUTO_TEST_CASE(GoUctPriorKnowledgeCacheTest_Disabled)
+{
+    GoUctPriorKnowledgeCache cache(0);
+    BOOST_CHECK(! cache.IsEnabled());
+    GoBoard bd(9);
+    const SgHashCode key = GoUctPriorKnowledgeCache::Key(bd);
+    vector<SgUctMoveInfo> moves(1, SgUctMoveInfo(Pt(3, 3)));
+    cache.Store(key, moves);
+    vector<SgUctMoveInfo> result;
+    BOOST_CHECK(! cache.Lookup(key, result));
+    BOOST_CHECK(result.empty());
+}
+
+/** Test that the key distinguishes the color to play and the last moves.
+    The last moves are not part of the hash code of the board. */
+BOOST_AUTO_TEST_CASE(GoUctPriorKnowledgeCacheTest_Key)
+{
+    GoBoard bd(9);
+    const SgHashCode empty = GoUctPriorKnowledgeCache::Key(bd);
+    bd.SetToPlay(SG_WHITE);
+    BOOST_CHECK(GoUctPriorKnowledgeCache::Key(bd) != empty);
+    bd.SetToPlay(SG_BLACK);
+    BOOST_CHECK(GoUctPriorKnowledgeCache::Key(bd) == empty);
+
+    // Same stones and color to play, different last moves
+    bd.Play(Pt(3, 3));
+    bd.Play(Pt(7, 7));
+    const SgHashCode key1 = GoUctPriorKnowledgeCache::Key(bd);
+    GoBoard bd2(9);
+    bd2.Play(Pt(7, 7), SG_WHITE);
+    bd2.Play(Pt(3, 3), SG_BLACK);
+    bd2.SetToPlay(SG_BLACK);
+    BOOST_CHECK(bd.GetHashCodeInclToPlay() == bd2.GetHashCodeInclToPlay());
+    BOOST_CHECK(GoUctPriorKnowledgeCache::Key(bd2) != key1);
+    bd.Undo();
+    bd.Undo();
+    BOOST_CHECK(GoUctPriorKnowledgeCache::Key(bd) == empty);
+}
+
+BOOST_AUTO_TEST_CASE(GoUctPriorKnowledgeCacheTest_LookupStore)
+{
+    GoUctPriorKnowledgeCache cache(16);
+    BOOST_CHECK(cache.IsEnabled());
+    BOOST_CHECK_EQUAL(cache.MaxEntries(), 16u);
+    GoBoard bd(9);
+    const SgHashCode key = GoUctPriorKnowledgeCache::Key(bd);
+    vector<SgUctMoveInfo> result;
+    BOOST_CHECK(! cache.Lookup(key, result));
+    vector<SgUctMoveInfo> moves;
+    moves.push_back(SgUctMoveInfo(Pt(3, 3), 0.4f, 10, 0.6f, 20));
+    moves.push_back(SgUctMoveInfo(SG_PASS));
+    moves[1].m_predictorValue = 0.5f;
+    cache.Store(key, moves);
+    BOOST_CHECK(cache.Lookup(key, result));
+    BOOST_REQUIRE_EQUAL(result.size(), 2u);
+    BOOST_CHECK_EQUAL(result[0].m_move, Pt(3, 3));
+    BOOST_CHECK_EQUAL(result[0].m_value, SgUctValue(0.4f));
+    BOOST_CHECK_EQUAL(result[0].m_count, SgUctValue(10));
+    BOOST_CHECK_EQUAL(result[0].m_raveValue, SgUctValue(0.6f));
+    BOOST_CHECK_EQUAL(result[0].m_raveCount, SgUctValue(20));
+    BOOST_CHECK_EQUAL(result[1].m_move, SG_PASS);
+    BOOST_CHECK_EQUAL(result[1].m_predictorValue, 0.5f);
+
+    bd.Play(Pt(5, 5));
+    BOOST_CHECK(! cache.Lookup(GoUctPriorKnowledgeCache::Key(bd), result));
+    BOOST_CHECK_EQUAL(result.size(), 2u);
+
+    ostringstream out;
+    cache.WriteStatistics(out);
+    BOOST_CHECK(out.str().find("1/3 (33.3%)") != string::npos);
+
+    cache.Clear();
+    BOOST_CHECK(! cache.Lookup(key, result));
+    cache.Store(key, moves);
+    cache.SetMaxEntries(8);
+    BOOST_CHECK_EQUAL(cache.MaxEntries(), 8u);
+    BOOST_CHECK(! cache.Lookup(key, result));
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------
@@ -0,0 +1,57 @@
+//----------------------------------------------------------------------------
+/** @file GoUctTerritoryStatisticsTest.cpp
+    Unit tests for GoUctTerritoryStatistics. */
+//----------------------------------------------------------------------------
+
+#include "SgSystem.h"
+
+#include <boost/test/auto_unit_test.hpp>
+#include "GoUctTerritoryStatistics.h"
+
+using SgPointUtil::Pt;
+
+//----------------------------------------------------------------------------
+
+namespace {
+
+BOOST_AUTO_TEST_CASE(GoUctTerritoryStatisticsTest_Add)
+{
+    GoUctTerritoryStatistics statistics;
+    BOOST_CHECK_EQUAL(statistics.Count(), SgUctValue(0));
+    SgBWSet area;
+    area[SG_BLACK].Include(Pt(1, 1));
+    area[SG_WHITE].Include(Pt(2, 1));
+    statistics.Add(area);
+    area[SG_BLACK].Include(Pt(2, 1));
+    area[SG_WHITE].Exclude(Pt(2, 1));
+    statistics.Add(area);
+    BOOST_CHECK_EQUAL(statistics.Count(), SgUctValue(2));
+    BOOST_CHECK_EQUAL(statistics.Mean(Pt(1, 1)), SgUctValue(1));
+    BOOST_CHECK_EQUAL(statistics.Mean(Pt(2, 1)), SgUctValue(0.5));
+    BOOST_CHECK_EQUAL(statistics.Mean(Pt(3, 1)), SgUctValue(0.5));
+    statistics.Clear();
+    BOOST_CHECK_EQUAL(statistics.Count(), SgUctValue(0));
+}
+
+BOOST_AUTO_TEST_CASE(GoUctTerritoryStatisticsTest_Merge)
+{
+    SgBWSet area;
+    area[SG_WHITE].Include(Pt(1, 1));
+    GoUctTerritoryStatistics statistics1;
+    statistics1.Add(area);
+    GoUctTerritoryStatistics statistics2;
+    statistics2.Add(area);
+    area[SG_WHITE].Clear();
+    statistics2.Add(area);
+    statistics2.Add(area);
+    GoUctTerritoryStatistics merged;
+    merged.Merge(statistics1);
+    merged.Merge(statistics2);
+    BOOST_CHECK_EQUAL(merged.Count(), SgUctValue(4));
+    BOOST_CHECK_EQUAL(merged.Mean(Pt(1, 1)), SgUctValue(0.25));
+    BOOST_CHECK_EQUAL(merged.Mean(Pt(5, 5)), SgUctValue(0.5));
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------
@@ -30,6 +30,10 @@ setup() {
 	    CXXFLAGS="-g -pipe"
 	    CONFIGUREFLAGS="--enable-assert=yes --enable-uct-value-type=float"
 	    ;;
+	dbg-atomic)
+	    CXXFLAGS="-g -pipe"
+	    CONFIGUREFLAGS="--enable-assert=yes --enable-uct-atomic"
+	    ;;
 	dbg-9)
 	    CXXFLAGS="-g -pipe"
 	    CONFIGUREFLAGS="--enable-assert=yes --enable-max-size=9"
@@ -42,6 +46,10 @@ setup() {
 	    CXXFLAGS="$GCC_OPTIMIZE -g -pipe"
 	    CONFIGUREFLAGS="--enable-uct-value-type=float"
 	    ;;
+	opt-atomic)
+	    CXXFLAGS="$GCC_OPTIMIZE -g -pipe"
+	    CONFIGUREFLAGS="--enable-uct-atomic"
+	    ;;
 	opt-9)
 	    CXXFLAGS="$GCC_OPTIMIZE -g -pipe"
 	    CONFIGUREFLAGS="--enable-max-size=9"
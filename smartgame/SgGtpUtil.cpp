@@ -87,4 +87,38 @@ std::string SgGtpUtil::MoveSelectToString(SgUctMoveSelect moveSelect)
     }
 }
 
+SgUctTranspositionMode SgGtpUtil::TranspositionModeArg(const GtpCommand& cmd,
+                                                       size_t number)
+{
+    std::string arg = cmd.ArgToLower(number);
+    if (arg == "none")
+        return SG_UCTTRANSPOSITION_NONE;
+    if (arg == "uct1")
+        return SG_UCTTRANSPOSITION_UCT1;
+    if (arg == "uct2")
+        return SG_UCTTRANSPOSITION_UCT2;
+    if (arg == "uct3")
+        return SG_UCTTRANSPOSITION_UCT3;
+    throw GtpFailure() << "unknown transposition mode argument \""
+                       << arg << '"';
+}
+
+std::string SgGtpUtil::TranspositionModeToString(SgUctTranspositionMode mode)
+{
+    switch (mode)
+    {
+        case SG_UCTTRANSPOSITION_NONE:
+            return "none";
+        case SG_UCTTRANSPOSITION_UCT1:
+            return "uct1";
+        case SG_UCTTRANSPOSITION_UCT2:
+            return "uct2";
+        case SG_UCTTRANSPOSITION_UCT3:
+            return "uct3";
+        default:
+            SG_ASSERT(false);
+            return "?";
+    }
+}
+
 
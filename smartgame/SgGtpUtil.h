@@ -114,6 +114,11 @@ namespace SgGtpUtil
     
     std::string MoveSelectToString(SgUctMoveSelect moveSelect);
 
+    SgUctTranspositionMode TranspositionModeArg(const GtpCommand& cmd,
+                                                size_t number);
+
+    std::string TranspositionModeToString(SgUctTranspositionMode mode);
+
 } // namespace SgGtpUtil
 
 //----------------------------------------------------------------------------
@@ -0,0 +1,557 @@
+//----------------------------------------------------------------------------
+/** @file SgMpiSharedMemorySynchronizer.cpp
+    See SgMpiSharedMemorySynchronizer.h */
+//----------------------------------------------------------------------------
+
+#include "SgSystem.h"
+#include "SgMpiSharedMemorySynchronizer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/managed_shared_memory.hpp>
+#include <boost/interprocess/shared_memory_object.hpp>
+#include <boost/interprocess/sync/interprocess_condition.hpp>
+#include <boost/interprocess/sync/interprocess_mutex.hpp>
+#include <boost/interprocess/sync/scoped_lock.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/thread/thread.hpp>
+#include "SgDebug.h"
+#include "SgException.h"
+#include "SgWrite.h"
+
+using namespace std;
+using boost::format;
+using boost::posix_time::microsec_clock;
+using boost::posix_time::ptime;
+using boost::posix_time::seconds;
+namespace ipc = boost::interprocess;
+
+typedef ipc::scoped_lock<ipc::interprocess_mutex> SharedLock;
+
+//----------------------------------------------------------------------------
+
+namespace {
+
+/** Maximum number of children of the root that are exchanged. */
+const size_t MAX_CHILDREN = 1024;
+
+/** Size of the buffer for broadcasts. */
+const size_t MAX_BROADCAST_SIZE = 16384;
+
+/** Timeout in seconds for waiting for other processes. */
+const int TIMEOUT = 60;
+
+/** Timeout in seconds for waiting for the final statistics at the end of
+    a search. */
+const int END_SEARCH_TIMEOUT = 10;
+
+ptime Deadline(int timeout)
+{
+    return microsec_clock::universal_time() + seconds(timeout);
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------
+
+/** Buffer for broadcasts from the root process. */
+struct SgMpiSharedMemorySynchronizer::Channel
+{
+    /** Number of broadcasts so far. */
+    unsigned int m_broadcast;
+
+    /** Number of processes that have not read the last broadcast yet. */
+    size_t m_pendingReaders;
+
+    size_t m_size;
+
+    char m_data[MAX_BROADCAST_SIZE];
+
+    Channel()
+        : m_broadcast(0),
+          m_pendingReaders(0),
+          m_size(0)
+    { }
+};
+
+struct SgMpiSharedMemorySynchronizer::Header
+{
+    ipc::interprocess_mutex m_mutex;
+
+    /** Signaled on every change of the header or the slots. */
+    ipc::interprocess_condition m_condition;
+
+    size_t m_nuProcesses;
+
+    /** Number of the last search finished by the root process.
+        Read without locking the mutex in CheckAbort(). */
+    volatile unsigned int m_finishedSearch;
+
+    /** Channels for input lines and values. */
+    Channel m_channel[2];
+
+    Header()
+        : m_nuProcesses(0),
+          m_finishedSearch(0)
+    { }
+};
+
+/** Statistics published by a process. */
+struct SgMpiSharedMemorySynchronizer::Slot
+{
+    bool m_isAttached;
+
+    /** Number of the current search of the process. */
+    unsigned int m_searchNumber;
+
+    /** Number of the last search, for which the process published its final
+        statistics. */
+    unsigned int m_endedSearch;
+
+    SgUctMergedValue m_root;
+
+    SgUctValue m_rootPosCount;
+
+    size_t m_nuChildren;
+
+    SgUctMergedValue m_children[MAX_CHILDREN];
+
+    Slot()
+        : m_isAttached(false),
+          m_searchNumber(0),
+          m_endedSearch(0),
+          m_rootPosCount(0),
+          m_nuChildren(0)
+    { }
+};
+
+//----------------------------------------------------------------------------
+
+SgMpiSharedMemorySynchronizer::SgMpiSharedMemorySynchronizer(
+                                                 const std::string& name,
+                                                 size_t nuProcesses,
+                                                 size_t rank)
+    : m_name(name),
+      m_nuProcesses(nuProcesses),
+      m_rank(rank),
+      m_exchangeInterval(500),
+      m_header(0),
+      m_slots(0),
+      m_searchNumber(0),
+      m_isExchangeEnabled(false),
+      m_nextExchange(0),
+      m_rootPosCountOffset(0),
+      m_rootPosCountBase(0),
+      m_nuExchanges(0),
+      m_importedGames(0)
+{
+    if (nuProcesses == 0 || rank >= nuProcesses)
+        throw SgException(format("SgMpiSharedMemorySynchronizer: invalid"
+                                 " rank %1% for %2% processes")
+                          % rank % nuProcesses);
+    const size_t size =
+        sizeof(Header) + nuProcesses * sizeof(Slot) + 65536;
+    if (rank == 0)
+    {
+        // Remove a segment left over by processes that did not terminate
+        // normally
+        ipc::shared_memory_object::remove(name.c_str());
+        m_segment.reset(new ipc::managed_shared_memory(ipc::create_only,
+                                                       name.c_str(), size));
+    }
+    else
+    {
+        const ptime deadline = Deadline(TIMEOUT);
+        while (! m_segment)
+        {
+            try
+            {
+                m_segment.reset(new ipc::managed_shared_memory(
+                                                            ipc::open_only,
+                                                            name.c_str()));
+            }
+            catch (const ipc::interprocess_exception&)
+            {
+                if (microsec_clock::universal_time() > deadline)
+                    throw SgException(format("SgMpiSharedMemorySynchronizer:"
+                                             " cluster '%1%' not found")
+                                      % name);
+                boost::this_thread::sleep(boost::posix_time::milliseconds(10));
+            }
+        }
+    }
+    m_header = m_segment->find_or_construct<Header>("Header")();
+    m_slots = m_segment->find_or_construct<Slot>("Slots")[nuProcesses]();
+    SharedLock lock(m_header->m_mutex);
+    if (m_header->m_nuProcesses == 0)
+        m_header->m_nuProcesses = nuProcesses;
+    if (m_header->m_nuProcesses != nuProcesses
+        || m_slots[rank].m_isAttached)
+        throw SgException(format("SgMpiSharedMemorySynchronizer: cannot"
+                                 " attach rank %1% to cluster '%2%'")
+                          % rank % name);
+    m_slots[rank].m_isAttached = true;
+    for (int i = 0; i < 2; ++i)
+        m_lastBroadcast[i] = m_header->m_channel[i].m_broadcast;
+    m_header->m_condition.notify_all();
+    const ptime deadline = Deadline(TIMEOUT);
+    for (size_t i = 0; i < nuProcesses; ++i)
+        while (! m_slots[i].m_isAttached)
+            if (! m_header->m_condition.timed_wait(lock, deadline))
+            {
+                m_slots[rank].m_isAttached = false;
+                throw SgException(format("SgMpiSharedMemorySynchronizer:"
+                                         " timeout waiting for process %1%")
+                                  % i);
+            }
+}
+
+SgMpiSharedMemorySynchronizer::~SgMpiSharedMemorySynchronizer()
+{
+    bool isLast = true;
+    try
+    {
+        SharedLock lock(m_header->m_mutex);
+        m_slots[m_rank].m_isAttached = false;
+        for (size_t i = 0; i < m_nuProcesses; ++i)
+            if (m_slots[i].m_isAttached)
+                isLast = false;
+        m_header->m_condition.notify_all();
+    }
+    catch (const ipc::interprocess_exception&)
+    {
+    }
+    m_segment.reset();
+    if (isLast)
+        ipc::shared_memory_object::remove(m_name.c_str());
+}
+
+void SgMpiSharedMemorySynchronizer::Broadcast(int channel, void* data,
+                                              size_t& size, bool isBlocking)
+{
+    if (m_nuProcesses == 1)
+        return;
+    SharedLock lock(m_header->m_mutex);
+    Channel& c = m_header->m_channel[channel];
+    const ptime deadline = Deadline(TIMEOUT);
+    if (IsRootProcess())
+    {
+        SG_ASSERT(size <= MAX_BROADCAST_SIZE);
+        while (c.m_pendingReaders > 0)
+            if (! m_header->m_condition.timed_wait(lock, deadline))
+            {
+                SgWarning() << "SgMpiSharedMemorySynchronizer: timeout"
+                            " waiting for processes\n";
+                break;
+            }
+        memcpy(c.m_data, data, size);
+        c.m_size = size;
+        c.m_pendingReaders = 0;
+        for (size_t i = 1; i < m_nuProcesses; ++i)
+            if (m_slots[i].m_isAttached)
+                ++c.m_pendingReaders;
+        ++c.m_broadcast;
+    }
+    else
+    {
+        while (c.m_broadcast == m_lastBroadcast[channel])
+        {
+            if (isBlocking)
+                m_header->m_condition.wait(lock);
+            else if (! m_header->m_condition.timed_wait(lock, deadline))
+            {
+                SgWarning() << "SgMpiSharedMemorySynchronizer: timeout"
+                            " waiting for root process\n";
+                return;
+            }
+        }
+        size = min(size, c.m_size);
+        memcpy(data, c.m_data, size);
+        m_lastBroadcast[channel] = c.m_broadcast;
+        if (c.m_pendingReaders > 0)
+            --c.m_pendingReaders;
+    }
+    m_header->m_condition.notify_all();
+}
+
+bool SgMpiSharedMemorySynchronizer::CheckAbort()
+{
+    return ! IsRootProcess()
+        && m_header->m_finishedSearch == m_searchNumber;
+}
+
+SgMpiSynchronizerHandle SgMpiSharedMemorySynchronizer::Create(
+                                                     const std::string& name,
+                                                     size_t nuProcesses,
+                                                     size_t rank)
+{
+    return SgMpiSynchronizerHandle(
+                   new SgMpiSharedMemorySynchronizer(name, nuProcesses, rank));
+}
+
+void SgMpiSharedMemorySynchronizer::Exchange(SgUctTree& tree)
+{
+    if (! tree.Root().HasChildren())
+        return;
+    SharedLock lock(m_header->m_mutex);
+    Publish(tree);
+    Merge(tree);
+    ++m_nuExchanges;
+}
+
+void SgMpiSharedMemorySynchronizer::InitOffsets(const SgUctTree& tree)
+{
+    const SgUctNode& root = tree.Root();
+    m_rootBase = SgUctMergedValue();
+    m_rootBase.Add(root);
+    m_rootPosCountBase = root.PosCount();
+    m_childBase.clear();
+    if (root.HasChildren())
+        for (SgUctChildIterator it(tree, root); it; ++it)
+        {
+            m_childBase.push_back(SgUctMergedValue((*it).Move()));
+            m_childBase.back().Add(*it);
+        }
+    m_rootOffset = m_rootBase;
+    m_rootPosCountOffset = m_rootPosCountBase;
+    m_childOffset = m_childBase;
+}
+
+bool SgMpiSharedMemorySynchronizer::IsActive(size_t rank) const
+{
+    return m_slots[rank].m_isAttached
+        && m_slots[rank].m_searchNumber == m_searchNumber;
+}
+
+bool SgMpiSharedMemorySynchronizer::IsRootProcess() const
+{
+    return m_rank == 0;
+}
+
+void SgMpiSharedMemorySynchronizer::Merge(SgUctTree& tree)
+{
+    const SgUctNode& root = tree.Root();
+    if (! root.HasChildren())
+        return;
+    const Slot& own = m_slots[m_rank];
+    m_rootOffset = m_rootBase;
+    m_rootPosCountOffset = m_rootPosCountBase;
+    m_childOffset.resize(own.m_nuChildren);
+    for (size_t i = 0; i < own.m_nuChildren; ++i)
+    {
+        const SgMove move = own.m_children[i].m_move;
+        size_t j = SgUctMergedValue::Find(m_childBase, move, i);
+        m_childOffset[i] = (j < m_childBase.size() ?
+                            m_childBase[j] : SgUctMergedValue(move));
+    }
+    for (size_t r = 0; r < m_nuProcesses; ++r)
+    {
+        if (r == m_rank || ! IsActive(r))
+            continue;
+        const Slot& slot = m_slots[r];
+        m_rootOffset.Add(slot.m_root);
+        m_rootPosCountOffset += slot.m_rootPosCount;
+        for (size_t i = 0; i < slot.m_nuChildren; ++i)
+        {
+            size_t j = SgUctMergedValue::Find(m_childOffset,
+                                              slot.m_children[i].m_move, i);
+            if (j < m_childOffset.size())
+                m_childOffset[j].Add(slot.m_children[i]);
+        }
+    }
+    m_importedGames = m_rootOffset.m_count - m_rootBase.m_count;
+    SgUctMergedValue value = own.m_root;
+    value.Add(m_rootOffset);
+    value.Write(tree, root);
+    tree.SetPosCount(root, own.m_rootPosCount + m_rootPosCountOffset);
+    size_t i = 0;
+    for (SgUctChildIterator it(tree, root); it && i < own.m_nuChildren;
+         ++it, ++i)
+    {
+        SG_ASSERT((*it).Move() == own.m_children[i].m_move);
+        value = own.m_children[i];
+        value.Add(m_childOffset[i]);
+        value.Write(tree, *it);
+    }
+}
+
+void SgMpiSharedMemorySynchronizer::OnEndPonder()
+{
+}
+
+void SgMpiSharedMemorySynchronizer::OnEndSearch(SgUctSearch &search)
+{
+    if (m_nuProcesses == 1)
+        return;
+    SgUctTree& tree = search.Tree();
+    SharedLock lock(m_header->m_mutex);
+    if (m_isExchangeEnabled)
+        Publish(tree);
+    m_slots[m_rank].m_endedSearch = m_searchNumber;
+    if (IsRootProcess())
+    {
+        m_header->m_finishedSearch = m_searchNumber;
+        m_header->m_condition.notify_all();
+        const ptime deadline = Deadline(END_SEARCH_TIMEOUT);
+        for (size_t i = 1; i < m_nuProcesses; ++i)
+            while (IsActive(i) && m_slots[i].m_endedSearch != m_searchNumber)
+                if (! m_header->m_condition.timed_wait(lock, deadline))
+                {
+                    SgWarning() << "SgMpiSharedMemorySynchronizer: timeout"
+                                " waiting for process " << i << '\n';
+                    break;
+                }
+        if (m_isExchangeEnabled)
+        {
+            Merge(tree);
+            ++m_nuExchanges;
+        }
+    }
+    else
+        m_header->m_condition.notify_all();
+}
+
+void SgMpiSharedMemorySynchronizer::OnSearchIteration(SgUctSearch &search,
+                                                SgUctValue gameNumber,
+                                                int threadId,
+                                                const SgUctGameInfo& info)
+{
+    SG_UNUSED(info);
+    if (threadId != 0 || ! m_isExchangeEnabled || gameNumber < m_nextExchange)
+        return;
+    m_nextExchange = gameNumber + m_exchangeInterval;
+    Exchange(search.Tree());
+}
+
+void SgMpiSharedMemorySynchronizer::OnStartPonder()
+{
+}
+
+void SgMpiSharedMemorySynchronizer::OnStartSearch(SgUctSearch &search)
+{
+    ++m_searchNumber;
+    m_isExchangeEnabled =
+        m_nuProcesses > 1
+        && ! (search.RootParallel() && search.NumberThreads() > 1);
+    m_nextExchange = m_exchangeInterval;
+    m_nuExchanges = 0;
+    m_importedGames = 0;
+    InitOffsets(search.Tree());
+    SharedLock lock(m_header->m_mutex);
+    Slot& slot = m_slots[m_rank];
+    slot.m_searchNumber = m_searchNumber;
+    slot.m_root = SgUctMergedValue();
+    slot.m_rootPosCount = 0;
+    slot.m_nuChildren = 0;
+}
+
+void SgMpiSharedMemorySynchronizer::OnThreadEndSearch(SgUctSearch &search,
+                                                      SgUctThreadState &state)
+{
+    SG_UNUSED(search);
+    SG_UNUSED(state);
+}
+
+void SgMpiSharedMemorySynchronizer::OnThreadStartSearch(
+                                                     SgUctSearch &search,
+                                                     SgUctThreadState &state)
+{
+    SG_UNUSED(search);
+    SG_UNUSED(state);
+}
+
+void SgMpiSharedMemorySynchronizer::Publish(const SgUctTree& tree)
+{
+    const SgUctNode& root = tree.Root();
+    if (! root.HasChildren())
+        return;
+    Slot& slot = m_slots[m_rank];
+    slot.m_root = SgUctMergedValue();
+    slot.m_root.Add(root);
+    slot.m_root.Subtract(m_rootOffset);
+    slot.m_rootPosCount = root.PosCount() - m_rootPosCountOffset;
+    size_t i = 0;
+    for (SgUctChildIterator it(tree, root); it && i < MAX_CHILDREN; ++it, ++i)
+    {
+        const SgUctNode& child = *it;
+        SgUctMergedValue& value = slot.m_children[i];
+        value = SgUctMergedValue(child.Move());
+        value.Add(child);
+        size_t j = SgUctMergedValue::Find(m_childOffset, child.Move(), i);
+        if (j < m_childOffset.size())
+            value.Subtract(m_childOffset[j]);
+    }
+    slot.m_nuChildren = i;
+}
+
+void SgMpiSharedMemorySynchronizer::SynchronizeEarlyPassPossible(bool &flag)
+{
+    SynchronizeData(flag);
+}
+
+void SgMpiSharedMemorySynchronizer::SynchronizeInputLine(std::string& line)
+{
+    vector<char> buffer(MAX_BROADCAST_SIZE);
+    size_t size = min(line.size(), MAX_BROADCAST_SIZE);
+    if (IsRootProcess())
+    {
+        if (size < line.size())
+            SgWarning() << "SgMpiSharedMemorySynchronizer: input line"
+                        " truncated\n";
+        copy(line.begin(), line.begin() + size, buffer.begin());
+    }
+    else
+        size = buffer.size();
+    Broadcast(0, &buffer[0], size, true);
+    line.assign(buffer.begin(), buffer.begin() + size);
+}
+
+void SgMpiSharedMemorySynchronizer::SynchronizeMove(SgMove &move)
+{
+    SynchronizeData(move);
+}
+
+void SgMpiSharedMemorySynchronizer::SynchronizePassWins(bool &flag)
+{
+    SynchronizeData(flag);
+}
+
+void SgMpiSharedMemorySynchronizer::SynchronizeSearchStatus(
+                                                     SgUctValue &value,
+                                                     bool &earlyAbort,
+                                                     SgUctValue &rootMoveCount)
+{
+    SynchronizeData(value);
+    SynchronizeData(earlyAbort);
+    SynchronizeData(rootMoveCount);
+}
+
+void SgMpiSharedMemorySynchronizer::SynchronizeUserAbort(bool &flag)
+{
+    SynchronizeData(flag);
+}
+
+void SgMpiSharedMemorySynchronizer::SynchronizeValue(SgUctValue &value)
+{
+    SynchronizeData(value);
+}
+
+string SgMpiSharedMemorySynchronizer::ToNodeFilename(
+                                                const string &filename) const
+{
+    if (IsRootProcess())
+        return filename;
+    return filename + "." + boost::lexical_cast<string>(m_rank);
+}
+
+void SgMpiSharedMemorySynchronizer::WriteStatistics(std::ostream& out) const
+{
+    out << SgWriteLabel("Processes") << m_nuProcesses << " (rank "
+        << m_rank << ")\n"
+        << SgWriteLabel("Exchanges") << m_nuExchanges << '\n'
+        << SgWriteLabel("ImportedGames") << m_importedGames << '\n';
+}
+
+//----------------------------------------------------------------------------
@@ -0,0 +1,247 @@
+//----------------------------------------------------------------------------
+/** @file SgMpiSharedMemorySynchronizer.h
+    Synchronizer for running a cluster of processes on a single host. */
+//----------------------------------------------------------------------------
+
+#ifndef SG_MPISHAREDMEMORYSYNCHRONIZER_H
+#define SG_MPISHAREDMEMORYSYNCHRONIZER_H
+
+#include <string>
+#include <vector>
+#include <boost/interprocess/interprocess_fwd.hpp>
+#include <boost/scoped_ptr.hpp>
+#include "SgMpiSynchronizer.h"
+#include "SgUctSearch.h"
+
+//----------------------------------------------------------------------------
+
+/** Synchronizer for a cluster of processes on a single host.
+    The processes of the cluster attach to a named POSIX shared memory
+    segment, so that no MPI installation is needed. Process 0 is the root
+    process; it reads the GTP input and its decisions (book moves, pass
+    decisions, the selected move) are broadcast to the other processes.
+    During a search, each process publishes the statistics of the root node
+    and its children, which it obtained by its own games, every
+    ExchangeInterval() games and adds the statistics published by the other
+    processes to its own tree. At the end of a search, the root process
+    waits for the other processes to publish their final statistics, so
+    that the move selection of the root process uses the games of the whole
+    cluster.
+
+    Each process uses its own allocator and search threads, so the cluster
+    scales beyond the memory and lock limits of a single process. The limit
+    on the number of games in a search applies to the total number of games
+    of the cluster, because the root node contains the games of all
+    processes.
+
+    The exchange works only on the tree of SgUctSearch::Tree(), therefore
+    it is disabled if the root-parallel mode of SgUctSearch is used with
+    more than one thread. The segment is removed when the last process
+    detaches from it. */
+class SgMpiSharedMemorySynchronizer
+    : public SgMpiSynchronizer
+{
+public:
+    /** Constructor.
+        Attaches to the shared memory segment and waits until all processes
+        of the cluster are attached.
+        @param name The name of the cluster (used as the name of the shared
+        memory segment)
+        @param nuProcesses The number of processes of the cluster
+        @param rank The rank of this process in [0..nuProcesses-1]
+        @throws SgException If not all processes were attached after
+        a timeout */
+    SgMpiSharedMemorySynchronizer(const std::string& name,
+                                  std::size_t nuProcesses, std::size_t rank);
+
+    virtual ~SgMpiSharedMemorySynchronizer();
+
+    static SgMpiSynchronizerHandle Create(const std::string& name,
+                                          std::size_t nuProcesses,
+                                          std::size_t rank);
+
+    std::size_t NuProcesses() const;
+
+    std::size_t Rank() const;
+
+    /** Number of games of each process between two exchanges of the
+        search statistics.
+        Default is 500. */
+    SgUctValue ExchangeInterval() const;
+
+    /** See ExchangeInterval() */
+    void SetExchangeInterval(SgUctValue interval);
+
+    /** Broadcast an input line from the root process.
+        Used for distributing the GTP commands read by the root process.
+        The other processes wait until the root process sends the next
+        line. */
+    void SynchronizeInputLine(std::string& line);
+
+    virtual std::string ToNodeFilename(const std::string &filename) const;
+
+    virtual bool IsRootProcess() const;
+
+    virtual void OnStartSearch(SgUctSearch &search);
+
+    virtual void OnEndSearch(SgUctSearch &search);
+
+    virtual void OnThreadStartSearch(SgUctSearch &search,
+                                     SgUctThreadState &state);
+
+    virtual void OnThreadEndSearch(SgUctSearch &search,
+                                   SgUctThreadState &state);
+
+    virtual void OnSearchIteration(SgUctSearch &search, SgUctValue gameNumber,
+                                   int threadId, const SgUctGameInfo& info);
+
+    virtual void OnStartPonder();
+
+    virtual void OnEndPonder();
+
+    virtual void WriteStatistics(std::ostream& out) const;
+
+    virtual void SynchronizeUserAbort(bool &flag);
+
+    virtual void SynchronizePassWins(bool &flag);
+
+    virtual void SynchronizeEarlyPassPossible(bool &flag);
+
+    virtual void SynchronizeMove(SgMove &move);
+
+    virtual void SynchronizeValue(SgUctValue &value);
+
+    virtual void SynchronizeSearchStatus(SgUctValue &value, bool &earlyAbort,
+                                         SgUctValue &rootMoveCount);
+
+    virtual bool CheckAbort();
+
+private:
+    struct Channel;
+
+    struct Header;
+
+    struct Slot;
+
+    std::string m_name;
+
+    std::size_t m_nuProcesses;
+
+    std::size_t m_rank;
+
+    SgUctValue m_exchangeInterval;
+
+    boost::scoped_ptr<boost::interprocess::managed_shared_memory> m_segment;
+
+    Header* m_header;
+
+    /** Array of m_nuProcesses slots in the shared memory segment. */
+    Slot* m_slots;
+
+    /** Number of the current search.
+        The processes execute the same commands, so the numbers of the
+        searches are the same in all processes. */
+    unsigned int m_searchNumber;
+
+    /** Is the exchange of statistics enabled in the current search. */
+    bool m_isExchangeEnabled;
+
+    /** Number of games of this process at which the next exchange is done. */
+    SgUctValue m_nextExchange;
+
+    /** Last broadcast read from each channel (only used in non-root
+        processes). */
+    unsigned int m_lastBroadcast[2];
+
+    /** Statistics of the root node, which were not obtained by this process
+        in the current search.
+        Contains the statistics at the start of the search and the
+        statistics of the other processes added at the last exchange. */
+    SgUctMergedValue m_rootOffset;
+
+    SgUctValue m_rootPosCountOffset;
+
+    /** See m_rootOffset */
+    std::vector<SgUctMergedValue> m_childOffset;
+
+    /** Statistics at the start of the search. */
+    SgUctMergedValue m_rootBase;
+
+    SgUctValue m_rootPosCountBase;
+
+    /** See m_rootBase */
+    std::vector<SgUctMergedValue> m_childBase;
+
+    /** Number of exchanges in the last search. */
+    std::size_t m_nuExchanges;
+
+    /** Number of games of the other processes in the last search. */
+    SgUctValue m_importedGames;
+
+    /** Broadcast data from the root process to the other processes.
+        @param channel The channel (0 for input lines, 1 for values)
+        @param data The data
+        @param size The size of the data; in the other processes, the size
+        of the buffer and on return the size of the received data
+        @param isBlocking Wait without a timeout in the other processes */
+    void Broadcast(int channel, void* data, std::size_t& size,
+                   bool isBlocking);
+
+    /** Publish the statistics and merge the statistics of the other
+        processes. */
+    void Exchange(SgUctTree& tree);
+
+    void InitOffsets(const SgUctTree& tree);
+
+    /** Is a slot of the segment active in the current search. */
+    bool IsActive(std::size_t rank) const;
+
+    /** Add the statistics of the other processes to the tree.
+        Requires that the statistics of this process are published and the
+        mutex of the segment is locked. */
+    void Merge(SgUctTree& tree);
+
+    /** Publish the statistics of this process in its slot.
+        Requires that the mutex of the segment is locked. */
+    void Publish(const SgUctTree& tree);
+
+    template<typename T>
+    void SynchronizeData(T& data);
+
+    SgMpiSharedMemorySynchronizer(const SgMpiSharedMemorySynchronizer&);
+
+    SgMpiSharedMemorySynchronizer&
+    operator=(const SgMpiSharedMemorySynchronizer&);
+};
+
+inline SgUctValue SgMpiSharedMemorySynchronizer::ExchangeInterval() const
+{
+    return m_exchangeInterval;
+}
+
+inline std::size_t SgMpiSharedMemorySynchronizer::NuProcesses() const
+{
+    return m_nuProcesses;
+}
+
+inline std::size_t SgMpiSharedMemorySynchronizer::Rank() const
+{
+    return m_rank;
+}
+
+inline void SgMpiSharedMemorySynchronizer::SetExchangeInterval(
+                                                         SgUctValue interval)
+{
+    m_exchangeInterval = interval;
+}
+
+template<typename T>
+void SgMpiSharedMemorySynchronizer::SynchronizeData(T& data)
+{
+    std::size_t size = sizeof(data);
+    Broadcast(1, &data, size, false);
+}
+
+//----------------------------------------------------------------------------
+
+#endif // SG_MPISHAREDMEMORYSYNCHRONIZER_H
@@ -21,6 +21,10 @@
 #ifdef HAVE_SYS_SYSCTL_H
 #include <sys/sysctl.h>
 #endif
+#ifdef HAVE_SCHED_SETAFFINITY
+#include <sched.h>
+#endif
+#include <boost/thread/thread.hpp>
 
 #include "SgStringUtil.h"
 //----------------------------------------------------------------------------
@@ -95,3 +99,24 @@ std::size_t SgPlatform::TotalMemory()
 
 //----------------------------------------------------------------------------
 
+bool SgPlatform::SetThreadAffinity(unsigned int processor)
+{
+    unsigned int nuProcessors = boost::thread::hardware_concurrency();
+    if (nuProcessors == 0)
+        return false;
+    processor %= nuProcessors;
+#if defined WIN32
+    return SetThreadAffinityMask(GetCurrentThread(),
+                                 DWORD_PTR(1) << processor) != 0;
+#elif defined HAVE_SCHED_SETAFFINITY && defined CPU_SET
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(processor, &set);
+    // Process ID 0 is the calling thread on Linux
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+//----------------------------------------------------------------------------
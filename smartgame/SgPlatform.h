@@ -33,6 +33,16 @@ namespace SgPlatform
         determined. */
     std::size_t TotalMemory();
 
+    /** Bind the calling thread to a processor.
+        Used for thread pinning in SgUctSearch. On systems with non-uniform
+        memory access (NUMA), memory first written by a pinned thread is
+        allocated on the memory node of its processor.
+        @param processor The processor index modulo the number of
+        processors
+        @return false, if not supported on this platform or if the system
+        call failed. */
+    bool SetThreadAffinity(unsigned int processor);
+
 }
 
 //----------------------------------------------------------------------------
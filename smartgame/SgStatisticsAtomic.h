@@ -0,0 +1,366 @@
+//----------------------------------------------------------------------------
+/** @file SgStatisticsAtomic.h
+    Versions of SgStatisticsVltBase and of volatile counters that use atomic
+    read-modify-write operations (C++11 std::atomic).
+    With volatile member variables, concurrent updates without locking can
+    be lost (see @ref sguctsearchlockfree). The classes in this file never
+    lose an update, even if many threads add values to the same statistics
+    at the same time. They are used by SgUctNode if Fuego is configured with
+    --enable-uct-atomic (macro SG_UCT_ATOMIC). */
+//----------------------------------------------------------------------------
+
+#ifndef SG_STATISTICSATOMIC_H
+#define SG_STATISTICSATOMIC_H
+
+#include <atomic>
+#include <iostream>
+#include <limits>
+#include "SgException.h"
+
+//----------------------------------------------------------------------------
+
+namespace SgAtomicUtil
+{
+
+/** Atomically add a value to a variable.
+    std::atomic::fetch_add is not available for floating point types in
+    C++11, so this uses a compare-and-swap loop.
+    @return The value before the addition. */
+template<typename T>
+inline T Add(std::atomic<T>& var, T n)
+{
+    T old = var.load(std::memory_order_relaxed);
+    while (! var.compare_exchange_weak(old, old + n,
+                                       std::memory_order_acq_rel,
+                                       std::memory_order_relaxed))
+    { }
+    return old;
+}
+
+/** Specialization of Add() for int.
+    Uses fetch_add, which does not need to retry under contention. */
+inline int Add(std::atomic<int>& var, int n)
+{
+    return var.fetch_add(n, std::memory_order_acq_rel);
+}
+
+} // namespace SgAtomicUtil
+
+//----------------------------------------------------------------------------
+
+/** Copyable wrapper for a std::atomic variable.
+    Loads use acquire, stores use release semantics, so that a reader that
+    sees a value also sees all writes of the writer before the store.
+    The class provides the operators that are used on the volatile member
+    variables of SgUctNode, so that it can replace them without changing the
+    code that uses them. Copying is not atomic as a whole, but it is only
+    used for nodes that are not accessed concurrently. */
+template<typename T>
+class SgAtomicValue
+{
+public:
+    SgAtomicValue(T value = T());
+
+    SgAtomicValue(const SgAtomicValue& value);
+
+    SgAtomicValue& operator=(const SgAtomicValue& value);
+
+    SgAtomicValue& operator=(T value);
+
+    operator T() const;
+
+    /** Atomically add a value.
+        @return The value after the addition. */
+    T Add(T n);
+
+    SgAtomicValue& operator+=(T n);
+
+    SgAtomicValue& operator-=(T n);
+
+    SgAtomicValue& operator++();
+
+    SgAtomicValue& operator--();
+
+    /** Atomic increment (the old value is not returned). */
+    void operator++(int);
+
+    /** Atomic decrement (the old value is not returned). */
+    void operator--(int);
+
+private:
+    std::atomic<T> m_value;
+};
+
+template<typename T>
+inline SgAtomicValue<T>::SgAtomicValue(T value)
+    : m_value(value)
+{ }
+
+template<typename T>
+inline SgAtomicValue<T>::SgAtomicValue(const SgAtomicValue& value)
+    : m_value(T(value))
+{ }
+
+template<typename T>
+inline SgAtomicValue<T>& SgAtomicValue<T>::operator=(const SgAtomicValue& value)
+{
+    m_value.store(T(value), std::memory_order_release);
+    return *this;
+}
+
+template<typename T>
+inline SgAtomicValue<T>& SgAtomicValue<T>::operator=(T value)
+{
+    m_value.store(value, std::memory_order_release);
+    return *this;
+}
+
+template<typename T>
+inline SgAtomicValue<T>::operator T() const
+{
+    return m_value.load(std::memory_order_acquire);
+}
+
+template<typename T>
+inline T SgAtomicValue<T>::Add(T n)
+{
+    return SgAtomicUtil::Add(m_value, n) + n;
+}
+
+template<typename T>
+inline SgAtomicValue<T>& SgAtomicValue<T>::operator+=(T n)
+{
+    Add(n);
+    return *this;
+}
+
+template<typename T>
+inline SgAtomicValue<T>& SgAtomicValue<T>::operator-=(T n)
+{
+    Add(-n);
+    return *this;
+}
+
+template<typename T>
+inline SgAtomicValue<T>& SgAtomicValue<T>::operator++()
+{
+    Add(T(1));
+    return *this;
+}
+
+template<typename T>
+inline SgAtomicValue<T>& SgAtomicValue<T>::operator--()
+{
+    Add(T(-1));
+    return *this;
+}
+
+template<typename T>
+inline void SgAtomicValue<T>::operator++(int)
+{
+    Add(T(1));
+}
+
+template<typename T>
+inline void SgAtomicValue<T>::operator--(int)
+{
+    Add(T(-1));
+}
+
+//----------------------------------------------------------------------------
+
+/** Version of SgStatisticsVltBase that can be updated concurrently without
+    losing updates.
+    Instead of the mean, the sum of the values is stored, so that an update
+    consists of two independent atomic additions (first the sum, then the
+    count), which both always succeed. This preserves the assumption of the
+    lock-free search that the mean value is valid if the count is greater
+    zero. A reader that accesses the statistics while another thread updates
+    it can see a sum that already contains a value that is not yet counted;
+    like in SgStatisticsVltBase, such temporary errors are small and ignored.
+    Note that with float as value type, the sum loses precision earlier than
+    an incrementally updated mean.
+    @see SgStatisticsVlt.h SgStatisticsBase */
+template<typename VALUE, typename COUNT>
+class SgStatisticsAtomicBase
+{
+public:
+    SgStatisticsAtomicBase();
+
+    /** Create statistics initialized with values.
+        Equivalent to creating a statistics and calling @c count times
+        Add(val) */
+    SgStatisticsAtomicBase(VALUE val, COUNT count);
+
+    void Add(VALUE val);
+
+    /** Remove a value.
+        Unlike Add(), this function is not safe to use concurrently with
+        other updates, if it can reduce the count to zero. */
+    void Remove(VALUE val);
+
+    /** Add a value n times */
+    void Add(VALUE val, COUNT n);
+
+    /** Remove a value n times.
+        See Remove(VALUE) */
+    void Remove(VALUE val, COUNT n);
+
+    void Clear();
+
+    COUNT Count() const;
+
+    /** Initialize with values.
+        Equivalent to calling Clear() and calling @c count times
+        Add(val) */
+    void Initialize(VALUE val, COUNT count);
+
+    /** Check if the mean value is defined.
+        See SgStatisticsVltBase::IsDefined() */
+    bool IsDefined() const;
+
+    VALUE Mean() const;
+
+    /** Write in human readable format. */
+    void Write(std::ostream& out) const;
+
+    /** Save in a compact platform-independent text format.
+        Uses the same format as SgStatisticsVltBase::SaveAsText() */
+    void SaveAsText(std::ostream& out) const;
+
+    /** Load from text format.
+        See SaveAsText() */
+    void LoadFromText(std::istream& in);
+
+private:
+    SgAtomicValue<COUNT> m_count;
+
+    SgAtomicValue<VALUE> m_sum;
+
+    static bool IsDefined(COUNT count);
+};
+
+template<typename VALUE, typename COUNT>
+inline SgStatisticsAtomicBase<VALUE,COUNT>::SgStatisticsAtomicBase()
+    : m_count(0),
+      m_sum(0)
+{ }
+
+template<typename VALUE, typename COUNT>
+inline SgStatisticsAtomicBase<VALUE,COUNT>::SgStatisticsAtomicBase(VALUE val,
+                                                                COUNT count)
+    : m_count(count),
+      m_sum(val * VALUE(count))
+{ }
+
+template<typename VALUE, typename COUNT>
+inline void SgStatisticsAtomicBase<VALUE,COUNT>::Add(VALUE val)
+{
+    Add(val, COUNT(1));
+}
+
+template<typename VALUE, typename COUNT>
+inline void SgStatisticsAtomicBase<VALUE,COUNT>::Add(VALUE val, COUNT n)
+{
+    // Write order dependency: the lock-free search assumes that the mean is
+    // valid if the count is greater zero, so the sum is updated first
+    m_sum.Add(VALUE(n) * val);
+    COUNT count = m_count.Add(n);
+    SG_DEBUG_ONLY(count);
+    SG_ASSERT(! std::numeric_limits<COUNT>::is_exact
+              || count > 0); // overflow
+}
+
+template<typename VALUE, typename COUNT>
+inline void SgStatisticsAtomicBase<VALUE,COUNT>::Remove(VALUE val)
+{
+    Remove(val, COUNT(1));
+}
+
+template<typename VALUE, typename COUNT>
+void SgStatisticsAtomicBase<VALUE,COUNT>::Remove(VALUE val, COUNT n)
+{
+    if (m_count > n)
+    {
+        m_count.Add(-n);
+        m_sum.Add(-VALUE(n) * val);
+    }
+    else
+        Clear();
+}
+
+template<typename VALUE, typename COUNT>
+inline void SgStatisticsAtomicBase<VALUE,COUNT>::Clear()
+{
+    m_count = 0;
+    m_sum = 0;
+}
+
+template<typename VALUE, typename COUNT>
+inline COUNT SgStatisticsAtomicBase<VALUE,COUNT>::Count() const
+{
+    return m_count;
+}
+
+template<typename VALUE, typename COUNT>
+inline void SgStatisticsAtomicBase<VALUE,COUNT>::Initialize(VALUE val,
+                                                            COUNT count)
+{
+    SG_ASSERT(count > 0);
+    m_sum = val * VALUE(count);
+    m_count = count;
+}
+
+template<typename VALUE, typename COUNT>
+inline bool SgStatisticsAtomicBase<VALUE,COUNT>::IsDefined(COUNT count)
+{
+    if (std::numeric_limits<COUNT>::is_exact)
+        return count > 0;
+    else
+        return count > std::numeric_limits<COUNT>::epsilon();
+}
+
+template<typename VALUE, typename COUNT>
+inline bool SgStatisticsAtomicBase<VALUE,COUNT>::IsDefined() const
+{
+    return IsDefined(m_count);
+}
+
+template<typename VALUE, typename COUNT>
+void SgStatisticsAtomicBase<VALUE,COUNT>::LoadFromText(std::istream& in)
+{
+    COUNT count;
+    VALUE mean;
+    in >> count >> mean;
+    m_sum = mean * VALUE(count);
+    m_count = count;
+}
+
+template<typename VALUE, typename COUNT>
+inline VALUE SgStatisticsAtomicBase<VALUE,COUNT>::Mean() const
+{
+    // Read order dependency: load the count first (see Add())
+    COUNT count = m_count;
+    SG_ASSERT(IsDefined(count));
+    return m_sum / VALUE(count);
+}
+
+template<typename VALUE, typename COUNT>
+void SgStatisticsAtomicBase<VALUE,COUNT>::Write(std::ostream& out) const
+{
+    if (IsDefined())
+        out << Mean();
+    else
+        out << '-';
+}
+
+template<typename VALUE, typename COUNT>
+void SgStatisticsAtomicBase<VALUE,COUNT>::SaveAsText(std::ostream& out) const
+{
+    COUNT count = m_count;
+    out << count << ' ' << (IsDefined(count) ? m_sum / VALUE(count) : 0);
+}
+
+//----------------------------------------------------------------------------
+
+#endif // SG_STATISTICSATOMIC_H
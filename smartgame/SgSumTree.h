@@ -0,0 +1,132 @@
+//----------------------------------------------------------------------------
+/** @file SgSumTree.h
+    Binary tree of partial sums for sampling with dynamic weights. */
+//----------------------------------------------------------------------------
+
+#ifndef SG_SUMTREE_H
+#define SG_SUMTREE_H
+
+#include <algorithm>
+
+//----------------------------------------------------------------------------
+
+/** Smallest power of two that is at least N.
+    Used for the number of leaves of SgSumTree. */
+template<int N, int P = 1, bool DONE = (P >= N)>
+struct SgSumTreeCapacity
+{
+    static const int VALUE = SgSumTreeCapacity<N,2 * P>::VALUE;
+};
+
+template<int N, int P>
+struct SgSumTreeCapacity<N,P,true>
+{
+    static const int VALUE = P;
+};
+
+//----------------------------------------------------------------------------
+
+/** Non-negative weights for the indices [0..SIZE-1] that support changing
+    a weight and selecting an index with a probability proportional to its
+    weight in logarithmic time.
+    The weights are stored in the leaves of a complete binary tree, each
+    inner node stores the sum of its two children. An inner node is always
+    recomputed from its children and never updated by adding a difference,
+    so rounding errors do not accumulate over many changes of a weight. */
+template<int SIZE>
+class SgSumTree
+{
+public:
+    /** Number of leaves. */
+    static const int CAPACITY = SgSumTreeCapacity<SIZE>::VALUE;
+
+    SgSumTree();
+
+    /** Set all weights to zero. */
+    void Clear();
+
+    float Get(int index) const;
+
+    /** Select the index for a value in [0..Total()).
+        Descends from the root into the left child, if the value is less
+        than the sum of the left child, otherwise into the right child after
+        subtracting the sum of the left child. Never selects an index with
+        weight zero, even if the value is not less than Total() because of
+        rounding. Requires Total() > 0.
+        @param value A value in [0..Total()), e.g. SgRandom::Float(Total()) */
+    int Select(float value) const;
+
+    void Set(int index, float weight);
+
+    /** Sum of all weights. */
+    float Total() const;
+
+private:
+    /** Root is at index 1, leaves at [CAPACITY..2*CAPACITY-1]. */
+    float m_node[2 * CAPACITY];
+};
+
+template<int SIZE>
+const int SgSumTree<SIZE>::CAPACITY;
+
+template<int SIZE>
+SgSumTree<SIZE>::SgSumTree()
+{
+    Clear();
+}
+
+template<int SIZE>
+inline void SgSumTree<SIZE>::Clear()
+{
+    std::fill(m_node, m_node + 2 * CAPACITY, 0.f);
+}
+
+template<int SIZE>
+inline float SgSumTree<SIZE>::Get(int index) const
+{
+    SG_ASSERTRANGE(index, 0, SIZE - 1);
+    return m_node[CAPACITY + index];
+}
+
+template<int SIZE>
+inline int SgSumTree<SIZE>::Select(float value) const
+{
+    SG_ASSERT(Total() > 0);
+    int i = 1;
+    while (i < CAPACITY)
+    {
+        i *= 2;
+        const float left = m_node[i];
+        if (value >= left && m_node[i + 1] > 0)
+        {
+            value -= left;
+            ++i;
+        }
+    }
+    SG_ASSERT(m_node[i] > 0);
+    return i - CAPACITY;
+}
+
+template<int SIZE>
+inline void SgSumTree<SIZE>::Set(int index, float weight)
+{
+    SG_ASSERTRANGE(index, 0, SIZE - 1);
+    SG_ASSERT(weight >= 0);
+    int i = CAPACITY + index;
+    m_node[i] = weight;
+    while (i > 1)
+    {
+        i /= 2;
+        m_node[i] = m_node[2 * i] + m_node[2 * i + 1];
+    }
+}
+
+template<int SIZE>
+inline float SgSumTree<SIZE>::Total() const
+{
+    return m_node[1];
+}
+
+//----------------------------------------------------------------------------
+
+#endif // SG_SUMTREE_H
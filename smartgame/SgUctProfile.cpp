@@ -0,0 +1,105 @@
+//----------------------------------------------------------------------------
+/** @file SgUctProfile.cpp
+    See SgUctProfile.h */
+//----------------------------------------------------------------------------
+
+#include "SgSystem.h"
+#include "SgUctProfile.h"
+
+#include <iomanip>
+#include <iostream>
+#include <boost/io/ios_state.hpp>
+#include "SgWrite.h"
+
+using namespace std;
+using boost::io::ios_all_saver;
+
+//----------------------------------------------------------------------------
+
+const char* SgUctProfilePhaseName(SgUctProfilePhase phase)
+{
+    switch (phase)
+    {
+    case SG_UCTPROFILE_INTREE:
+        return "InTree";
+    case SG_UCTPROFILE_EXPAND:
+        return "Expand";
+    case SG_UCTPROFILE_KNOWLEDGE:
+        return "Knowledge";
+    case SG_UCTPROFILE_PLAYOUT:
+        return "Playout";
+    case SG_UCTPROFILE_EVALUATE:
+        return "Evaluate";
+    case SG_UCTPROFILE_UPDATE:
+        return "Update";
+    case SG_UCTPROFILE_LOCKWAIT:
+        return "LockWait";
+    default:
+        SG_ASSERT(false);
+        return "?";
+    }
+}
+
+//----------------------------------------------------------------------------
+
+const int SgUctProfile::NU_BUCKETS;
+
+SgUctProfile::SgUctProfile()
+{
+    Clear();
+}
+
+void SgUctProfile::Clear()
+{
+    m_count.Fill(0);
+    m_ticks.Fill(0);
+    for (int i = 0; i < _SG_UCTPROFILE_NU_PHASES; ++i)
+        m_histogram[i].Fill(0);
+}
+
+void SgUctProfile::Merge(const SgUctProfile& profile)
+{
+    for (int i = 0; i < _SG_UCTPROFILE_NU_PHASES; ++i)
+    {
+        m_count[i] += profile.m_count[i];
+        m_ticks[i] += profile.m_ticks[i];
+        for (int j = 0; j < NU_BUCKETS; ++j)
+            m_histogram[i][j] += profile.m_histogram[i][j];
+    }
+}
+
+const char* SgUctProfile::TickUnit()
+{
+#ifdef SG_UCTPROFILE_RDTSC
+    return "cycles";
+#else
+    return "ns";
+#endif
+}
+
+void SgUctProfile::Write(std::ostream& out) const
+{
+    ios_all_saver saver(out);
+    out << SgWriteLabel("Unit") << TickUnit() << '\n';
+    for (int i = 0; i < _SG_UCTPROFILE_NU_PHASES; ++i)
+    {
+        SgUctProfilePhase phase = static_cast<SgUctProfilePhase>(i);
+        const uint64_t count = m_count[i];
+        out << SgWriteLabel(SgUctProfilePhaseName(phase)) << count;
+        if (count > 0)
+            out << " total " << m_ticks[i] << " mean " << fixed
+                << setprecision(1) << double(m_ticks[i]) / double(count);
+        out << '\n';
+        if (count == 0)
+            continue;
+        for (int j = 0; j < NU_BUCKETS; ++j)
+            if (m_histogram[i][j] > 0)
+                out << "  <2^" << setw(2) << left << (j + 1) << right
+                    << setw(12) << m_histogram[i][j] << ' ' << setw(5)
+                    << setprecision(1)
+                    << 100.0 * double(m_histogram[i][j]) / double(count)
+                    << "%\n";
+    }
+}
+
+//----------------------------------------------------------------------------
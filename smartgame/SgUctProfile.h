@@ -0,0 +1,209 @@
+//----------------------------------------------------------------------------
+/** @file SgUctProfile.h
+    Per-thread time profile of the phases of a game in SgUctSearch. */
+//----------------------------------------------------------------------------
+
+#ifndef SG_UCTPROFILE_H
+#define SG_UCTPROFILE_H
+
+#include <iosfwd>
+#include <stdint.h>
+#include "SgArray.h"
+#include "SgTime.h"
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#define SG_UCTPROFILE_RDTSC 1
+#include <x86intrin.h>
+#endif
+
+//----------------------------------------------------------------------------
+
+/** Phases of a game in SgUctSearch measured by SgUctProfile.
+    The phases are measured inclusively: SG_UCTPROFILE_KNOWLEDGE and
+    SG_UCTPROFILE_EXPAND are nested in SG_UCTPROFILE_INTREE, if the move
+    generation or expansion happens in SgUctSearch::PlayInTree(). */
+enum SgUctProfilePhase
+{
+    /** Selecting and executing the moves in the tree
+        (SgUctSearch::PlayInTree()). */
+    SG_UCTPROFILE_INTREE,
+
+    /** Creating the children of a node. */
+    SG_UCTPROFILE_EXPAND,
+
+    /** Generating the moves of a node with prior knowledge, including the
+        recomputation at the knowledge thresholds and the knowledge batch. */
+    SG_UCTPROFILE_KNOWLEDGE,
+
+    /** Starting and playing the playouts (SgUctSearch::PlayoutGame()). */
+    SG_UCTPROFILE_PLAYOUT,
+
+    /** Evaluating the end positions (SgUctThreadState::Evaluate()). */
+    SG_UCTPROFILE_EVALUATE,
+
+    /** Updating the values and statistics of the nodes in the tree. */
+    SG_UCTPROFILE_UPDATE,
+
+    /** Waiting for the global lock (only if not in lock-free mode). */
+    SG_UCTPROFILE_LOCKWAIT,
+
+    _SG_UCTPROFILE_NU_PHASES
+};
+
+/** Name of a phase as used in SgUctProfile::Write() */
+const char* SgUctProfilePhaseName(SgUctProfilePhase phase);
+
+//----------------------------------------------------------------------------
+
+/** Compile-time switch for the profiling of SgUctSearch.
+    Enabled with the configure option --enable-uct-profile. If disabled,
+    SgUctProfileTimer does nothing and the compiler removes it. */
+#ifdef SG_UCT_PROFILE
+const bool SG_UCTPROFILE_ENABLED = true;
+#else
+const bool SG_UCTPROFILE_ENABLED = false;
+#endif
+
+//----------------------------------------------------------------------------
+
+/** Number of calls, total ticks and histogram of the ticks per call for each
+    phase of a game.
+    The ticks are CPU cycles (time stamp counter) on x86 with GCC, and
+    nanoseconds of SgTime::Get(SG_TIME_REAL) otherwise (see TickUnit()). The
+    histogram uses logarithmic buckets; bucket i counts the calls with
+    [2^i..2^(i+1)-1] ticks (bucket 0 also includes zero ticks).
+
+    Each search thread owns one instance in SgUctThreadState::m_profile, so
+    Add() needs no locks. Merge() only reads the other instance and can be
+    used while the search is running; the result can then be slightly
+    inconsistent. */
+class SgUctProfile
+{
+public:
+    static const int NU_BUCKETS = 64;
+
+    SgUctProfile();
+
+    void Add(SgUctProfilePhase phase, uint64_t ticks);
+
+    /** Number of calls in a bucket of the histogram of a phase. */
+    uint64_t BucketCount(SgUctProfilePhase phase, int bucket) const;
+
+    void Clear();
+
+    /** Number of calls of a phase. */
+    uint64_t Count(SgUctProfilePhase phase) const;
+
+    /** Add the counts of another instance. */
+    void Merge(const SgUctProfile& profile);
+
+    /** Total ticks of a phase. */
+    uint64_t Ticks(SgUctProfilePhase phase) const;
+
+    /** Write the phases with count, total and mean ticks and the non-empty
+        buckets of the histogram. */
+    void Write(std::ostream& out) const;
+
+    /** Current value of the tick counter. */
+    static uint64_t GetTicks();
+
+    /** Bucket of the histogram for a number of ticks. */
+    static int Bucket(uint64_t ticks);
+
+    /** Unit of the ticks ("cycles" or "ns"). */
+    static const char* TickUnit();
+
+private:
+    SgArray<uint64_t,_SG_UCTPROFILE_NU_PHASES> m_count;
+
+    SgArray<uint64_t,_SG_UCTPROFILE_NU_PHASES> m_ticks;
+
+    SgArray<SgArray<uint64_t,NU_BUCKETS>,_SG_UCTPROFILE_NU_PHASES>
+        m_histogram;
+};
+
+inline void SgUctProfile::Add(SgUctProfilePhase phase, uint64_t ticks)
+{
+    ++m_count[phase];
+    m_ticks[phase] += ticks;
+    ++m_histogram[phase][Bucket(ticks)];
+}
+
+inline int SgUctProfile::Bucket(uint64_t ticks)
+{
+    int bucket = 0;
+    while (ticks > 1)
+    {
+        ticks >>= 1;
+        ++bucket;
+    }
+    return bucket;
+}
+
+inline uint64_t SgUctProfile::BucketCount(SgUctProfilePhase phase,
+                                          int bucket) const
+{
+    return m_histogram[phase][bucket];
+}
+
+inline uint64_t SgUctProfile::Count(SgUctProfilePhase phase) const
+{
+    return m_count[phase];
+}
+
+inline uint64_t SgUctProfile::GetTicks()
+{
+#ifdef SG_UCTPROFILE_RDTSC
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(SgTime::Get(SG_TIME_REAL) * 1e9);
+#endif
+}
+
+inline uint64_t SgUctProfile::Ticks(SgUctProfilePhase phase) const
+{
+    return m_ticks[phase];
+}
+
+//----------------------------------------------------------------------------
+
+/** Adds the ticks between construction and destruction to a phase of a
+    profile.
+    Does nothing, if SG_UCTPROFILE_ENABLED is false. */
+class SgUctProfileTimer
+{
+public:
+    SgUctProfileTimer(SgUctProfile& profile, SgUctProfilePhase phase);
+
+    ~SgUctProfileTimer();
+
+private:
+    SgUctProfile& m_profile;
+
+    const SgUctProfilePhase m_phase;
+
+    const uint64_t m_start;
+
+    /** Not implemented */
+    SgUctProfileTimer(const SgUctProfileTimer&);
+
+    /** Not implemented */
+    SgUctProfileTimer& operator=(const SgUctProfileTimer&);
+};
+
+inline SgUctProfileTimer::SgUctProfileTimer(SgUctProfile& profile,
+                                            SgUctProfilePhase phase)
+    : m_profile(profile),
+      m_phase(phase),
+      m_start(SG_UCTPROFILE_ENABLED ? SgUctProfile::GetTicks() : 0)
+{ }
+
+inline SgUctProfileTimer::~SgUctProfileTimer()
+{
+    if (SG_UCTPROFILE_ENABLED)
+        m_profile.Add(m_phase, SgUctProfile::GetTicks() - m_start);
+}
+
+//----------------------------------------------------------------------------
+
+#endif // SG_UCTPROFILE_H
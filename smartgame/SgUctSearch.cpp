@@ -91,6 +91,7 @@ void Notify(mutex& aMutex, condition& aCondition)
 void SgUctGameInfo::Clear(std::size_t numberPlayouts)
 {
     m_nodes.clear();
+    m_hashCodes.clear();
     m_inTreeSequence.clear();
     if (numberPlayouts != m_sequence.size())
     {
@@ -98,6 +99,7 @@ void SgUctGameInfo::Clear(std::size_t numberPlayouts)
         m_skipRaveUpdate.resize(numberPlayouts);
         m_eval.resize(numberPlayouts);
         m_aborted.resize(numberPlayouts);
+        m_playoutSetupTime.resize(numberPlayouts);
     }
     for (size_t i = 0; i < numberPlayouts; ++i)
     {
@@ -108,10 +110,63 @@ void SgUctGameInfo::Clear(std::size_t numberPlayouts)
 
 //----------------------------------------------------------------------------
 
+void SgUctMergedValue::Add(const SgUctNode& node)
+{
+    if (node.HasMean())
+    {
+        m_count += node.MoveCount();
+        m_sum += node.Mean() * node.MoveCount();
+    }
+    if (node.HasRaveValue())
+    {
+        m_raveCount += node.RaveCount();
+        m_raveSum += node.RaveValue() * node.RaveCount();
+    }
+}
+
+void SgUctMergedValue::Add(const SgUctMergedValue& value)
+{
+    m_count += value.m_count;
+    m_sum += value.m_sum;
+    m_raveCount += value.m_raveCount;
+    m_raveSum += value.m_raveSum;
+}
+
+size_t SgUctMergedValue::Find(const vector<SgUctMergedValue>& values,
+                              SgMove move, size_t index)
+{
+    if (index < values.size() && values[index].m_move == move)
+        return index;
+    for (size_t i = 0; i < values.size(); ++i)
+        if (values[i].m_move == move)
+            return i;
+    return values.size();
+}
+
+void SgUctMergedValue::Subtract(const SgUctMergedValue& value)
+{
+    m_count -= value.m_count;
+    m_sum -= value.m_sum;
+    m_raveCount -= value.m_raveCount;
+    m_raveSum -= value.m_raveSum;
+}
+
+void SgUctMergedValue::Write(SgUctTree& tree, const SgUctNode& node) const
+{
+    if (m_count > 0)
+        tree.InitializeValue(node, m_sum / m_count, m_count);
+    if (m_raveCount > 0)
+        tree.InitializeRaveValue(node, m_raveSum / m_raveCount, m_raveCount);
+}
+
+//----------------------------------------------------------------------------
+
 SgUctThreadState::SgUctThreadState(unsigned int threadId, int moveRange)
     : m_threadId(threadId),
       m_isSearchInitialized(false),
-      m_isTreeOutOfMem(false)
+      m_isTreeOutOfMem(false),
+      m_rootParallelGames(0),
+      m_isRootParallelMerged(false)
 {
     if (moveRange > 0)
     {
@@ -133,6 +188,21 @@ void SgUctThreadState::GameStart()
     // Default implementation does nothing
 }
 
+bool SgUctThreadState::GenerateMovesWithoutKnowledge(
+                                          std::vector<SgUctMoveInfo>& moves,
+                                          SgUctProvenType& provenType)
+{
+    GenerateAllMoves(0, moves, provenType);
+    return false;
+}
+
+bool SgUctThreadState::GetHashCode(SgHashCode& hashCode) const
+{
+    SG_UNUSED(hashCode);
+    // Default implementation does not support hash codes
+    return false;
+}
+
 void SgUctThreadState::StartPlayout()
 {
     // Default implementation does nothing
@@ -215,10 +285,12 @@ void SgUctSearchStat::Clear()
 {
     m_time = 0;
     m_knowledge = 0;
+    m_transpositions = 0;
     m_gamesPerSecond = 0;
     m_gameLength.Clear();
     m_movesInTree.Clear();
     m_aborted.Clear();
+    m_playoutSetupTime.Clear();
 }
 
 void SgUctSearchStat::Write(std::ostream& out) const
@@ -233,6 +305,9 @@ void SgUctSearchStat::Write(std::ostream& out) const
     out << '\n'
         << SgWriteLabel("Aborted")
         << static_cast<int>(100 * m_aborted.Mean()) << "%\n"
+        << SgWriteLabel("PlayoutSetup") << setprecision(2);
+    m_playoutSetupTime.Write(out);
+    out << " us\n"
         << SgWriteLabel("Games/s") << fixed << setprecision(1)
         << m_gamesPerSecond << '\n';
 }
@@ -246,14 +321,21 @@ SgUctSearch::SgUctSearch(SgUctThreadStateFactory* threadStateFactory,
       m_rave(false),
       m_knowledgeThreshold(),
       m_maxKnowledgeThreads(1024),
+      m_knowledgeBatchSize(0),
       m_moveSelect(SG_UCTMOVESELECT_COUNT),
+      m_transpositionMode(SG_UCTTRANSPOSITION_NONE),
+      m_keepTree(false),
       m_raveCheckSame(false),
       m_randomizeRaveFrequency(20),
       m_lockFree(GetLockFreeDefault()),
       m_weightRaveUpdates(true),
       m_pruneFullTree(true),
+      m_pruneInPlace(false),
       m_checkFloatPrecision(true),
       m_numberThreads(1),
+      m_pinThreads(false),
+      m_rootParallel(false),
+      m_rootParallelMergeInterval(1000),
       m_numberPlayouts(1),
       m_updateMultiplePlayoutsAsSingle(true),
       m_maxNodes(GetMaxNodesDefault()),
@@ -271,6 +353,7 @@ SgUctSearch::SgUctSearch(SgUctThreadStateFactory* threadStateFactory,
       m_raveWeightFinal(20000),
       m_virtualLoss(false),
       m_logFileName("uctsearch.log"),
+      m_mergedRootPosCount(0),
       m_fastLog(10),
       m_mpiSynchronizer(SgMpiNullSynchronizer::Create())
 {
@@ -298,6 +381,10 @@ void SgUctSearch::ApplyRootFilter(vector<SgUctMoveInfo>& moves)
 
 SgUctValue SgUctSearch::GamesPlayed() const
 {
+    if (! m_rootParallelTrees.empty())
+        // The root of m_tree contains the games of the other threads only
+        // after a merge
+        return m_numberGames;
     return m_tree.Root().MoveCount() - m_startRootMoveCount;
 }
 
@@ -308,13 +395,15 @@ bool SgUctSearch::CheckAbortSearch(SgUctThreadState& state)
         Debug(state, "SgUctSearch: abort flag");
         return true;
     }
-    const SgUctNode& root = m_tree.Root();
+    const SgUctNode& root = ThreadTree(state).Root();
     if (! SgUctValueUtil::IsPrecise(root.MoveCount()) && m_checkFloatPrecision)
     {
         Debug(state, "SgUctSearch: floating point type precision reached");
         return true;
     }
     SgUctValue rootCount = root.MoveCount();
+    if (! m_rootParallelTrees.empty())
+        rootCount = m_startRootMoveCount + GamesPlayed();
     if (rootCount >= m_maxGames)
     {
         Debug(state, "SgUctSearch: max games reached");
@@ -429,10 +518,31 @@ void SgUctSearch::CreateThreads()
     }
     m_tree.CreateAllocators(m_numberThreads);
     m_tree.SetMaxNodes(m_maxNodes);
+    CreateRootParallelTrees();
+    if (m_pinThreads)
+        // Create the temporary tree now, such that the threads can touch its
+        // memory before it is used
+        GetTempTree();
 
     m_searchLoopFinished.reset(new barrier(m_numberThreads));
 }
 
+void SgUctSearch::CreateRootParallelTrees()
+{
+    m_rootParallelTrees.clear();
+    if (! m_rootParallel || m_numberThreads == 1)
+        return;
+    // Thread 0 uses m_tree
+    m_rootParallelTrees.push_back(shared_ptr<SgUctTree>());
+    for (unsigned int i = 1; i < m_numberThreads; ++i)
+    {
+        shared_ptr<SgUctTree> tree(new SgUctTree());
+        tree->CreateAllocators(1);
+        tree->SetMaxNodes(m_maxNodes / m_numberThreads);
+        m_rootParallelTrees.push_back(tree);
+    }
+}
+
 /** Write a debugging line of text from within a thread.
     Prepends the line with the thread number if number of threads is greater
     than one. Also ensures that the line is written as a single string to
@@ -462,17 +572,18 @@ void SgUctSearch::DeleteThreads()
     @param node The node to expand. */
 void SgUctSearch::ExpandNode(SgUctThreadState& state, const SgUctNode& node)
 {
-    unsigned int threadId = state.m_threadId;
-    if (! m_tree.HasCapacity(threadId, state.m_moves.size()))
+    SgUctTree& tree = ThreadTree(state);
+    const size_t allocatorId = AllocatorId(state);
+    if (! tree.HasCapacity(allocatorId, state.m_moves.size()))
     {
         Debug(state, str(format("SgUctSearch: maximum tree size %1% reached")
-                         % m_tree.MaxNodes()));
+                         % tree.MaxNodes()));
         state.m_isTreeOutOfMem = true;
         m_isTreeOutOfMemory = true;
         SgSynchronizeThreadMemory();
         return;
     }
-    m_tree.CreateChildren(threadId, node, state.m_moves);
+    tree.CreateChildren(allocatorId, node, state.m_moves);
 }
 
 const SgUctNode*
@@ -550,6 +661,16 @@ void SgUctSearch::FindBestSequence(vector<SgMove>& sequence) const
     }
 }
 
+void SgUctSearch::FlushPendingKnowledge()
+{
+    if (m_pendingKnowledge.empty())
+        return;
+    SgUctThreadState& state = ThreadState(0);
+    state.m_knowledgeBatch.swap(m_pendingKnowledge);
+    m_pendingKnowledge.clear();
+    ComputeKnowledgeBatch(state);
+}
+
 void SgUctSearch::GenerateAllMoves(std::vector<SgUctMoveInfo>& moves)
 {
     if (m_threads.size() == 0)
@@ -594,6 +715,15 @@ SgUctValue SgUctSearch::GetBound(bool useRave, bool useBiasTerm,
     }
 }
 
+void SgUctSearch::GetProfile(SgUctProfile& profile) const
+{
+    profile.Clear();
+    if (! ThreadsCreated())
+        return;
+    for (unsigned int i = 0; i < m_threads.size(); ++i)
+        profile.Merge(ThreadState(i).m_profile);
+}
+
 SgUctTree& SgUctSearch::GetTempTree()
 {
     m_tempTree.Clear();
@@ -743,24 +873,127 @@ SgUctValue SgUctSearch::Log(SgUctValue x) const
 
 /** Creates the children with the given moves and merges with existing
     children in the tree. */
+void SgUctSearch::AddPendingKnowledge(SgUctThreadState& state,
+                                      const SgUctNode& node)
+{
+    boost::mutex::scoped_lock lock(m_pendingKnowledgeMutex);
+    // In lock-free mode, a node can be expanded by multiple threads
+    for (vector<SgUctPendingKnowledge>::const_iterator it =
+             m_pendingKnowledge.begin(); it != m_pendingKnowledge.end(); ++it)
+        if (it->m_node == &node)
+            return;
+    SgUctTree& tree = ThreadTree(state);
+    tree.AddVirtualLoss(node);
+    m_pendingKnowledge.push_back(SgUctPendingKnowledge());
+    m_pendingKnowledge.back().m_tree = &tree;
+    m_pendingKnowledge.back().m_node = &node;
+    m_pendingKnowledge.back().m_sequence = state.m_gameInfo.m_inTreeSequence;
+    if (m_pendingKnowledge.size() >= m_knowledgeBatchSize)
+    {
+        state.m_knowledgeBatch.insert(state.m_knowledgeBatch.end(),
+                                      m_pendingKnowledge.begin(),
+                                      m_pendingKnowledge.end());
+        m_pendingKnowledge.clear();
+    }
+}
+
+void SgUctSearch::ComputeKnowledgeBatch(SgUctThreadState& state)
+{
+    for (vector<SgUctPendingKnowledge>::const_iterator it =
+             state.m_knowledgeBatch.begin();
+         it != state.m_knowledgeBatch.end(); ++it)
+    {
+        SgUctTree& tree = *it->m_tree;
+        const SgUctNode& node = *it->m_node;
+        const vector<SgMove>& sequence = it->m_sequence;
+        state.GameStart();
+        for (vector<SgMove>::const_iterator it2 = sequence.begin();
+             it2 != sequence.end(); ++it2)
+            state.Execute(*it2);
+        state.m_moves.clear();
+        SgUctProvenType provenType = SG_NOT_PROVEN;
+        state.GenerateAllMoves(0, state.m_moves, provenType);
+        if (&node == &tree.Root())
+            ApplyRootFilter(state.m_moves);
+        tree.AddKnowledge(node, state.m_moves);
+        state.TakeBackInTree(sequence.size());
+        tree.RemoveVirtualLoss(node);
+    }
+    state.m_knowledgeBatch.clear();
+}
+
 void SgUctSearch::CreateChildren(SgUctThreadState& state, 
                                  const SgUctNode& node,
                                  bool deleteChildTrees)
 {
-    unsigned int threadId = state.m_threadId;
-    if (! m_tree.HasCapacity(threadId, state.m_moves.size()))
+    SgUctTree& tree = ThreadTree(state);
+    const size_t allocatorId = AllocatorId(state);
+    if (! tree.HasCapacity(allocatorId, state.m_moves.size()))
     {
         Debug(state, str(format("SgUctSearch: maximum tree size %1% reached")
-                         % m_tree.MaxNodes()));
+                         % tree.MaxNodes()));
         state.m_isTreeOutOfMem = true;
         m_isTreeOutOfMemory = true;
         SgSynchronizeThreadMemory();
         return;
     }
-    m_tree.MergeChildren(threadId, node, state.m_moves, deleteChildTrees);
+    tree.MergeChildren(allocatorId, node, state.m_moves, deleteChildTrees);
 }
 
-bool SgUctSearch::NeedToComputeKnowledge(const SgUctNode* current)
+void SgUctSearch::MergeRootParallelTrees()
+{
+    const SgUctMergedValue lastRoot = m_mergedRoot;
+    const SgUctValue lastRootPosCount = m_mergedRootPosCount;
+    const vector<SgUctMergedValue> lastChildren = m_mergedChildren;
+    for (unsigned int i = 0; i < m_threads.size(); ++i)
+    {
+        SgUctThreadState& state = ThreadState(i);
+        const SgUctTree& tree = ThreadTree(state);
+        const SgUctNode& root = tree.Root();
+        if (! root.HasChildren())
+            continue;
+        const bool isMerged = state.m_isRootParallelMerged;
+        m_mergedRoot.Add(root);
+        if (isMerged)
+            m_mergedRoot.Subtract(lastRoot);
+        m_mergedRootPosCount +=
+            root.PosCount() - (isMerged ? lastRootPosCount : 0);
+        size_t index = 0;
+        for (SgUctChildIterator it(tree, root); it; ++it, ++index)
+        {
+            const SgUctNode& child = *it;
+            size_t j = SgUctMergedValue::Find(m_mergedChildren, child.Move(),
+                                              index);
+            if (j == m_mergedChildren.size())
+                m_mergedChildren.push_back(SgUctMergedValue(child.Move()));
+            m_mergedChildren[j].Add(child);
+            if (isMerged && j < lastChildren.size())
+                m_mergedChildren[j].Subtract(lastChildren[j]);
+        }
+    }
+    for (unsigned int i = 0; i < m_threads.size(); ++i)
+    {
+        SgUctThreadState& state = ThreadState(i);
+        SgUctTree& tree = ThreadTree(state);
+        const SgUctNode& root = tree.Root();
+        if (! root.HasChildren())
+            continue;
+        m_mergedRoot.Write(tree, root);
+        tree.SetPosCount(root, m_mergedRootPosCount);
+        size_t index = 0;
+        for (SgUctChildIterator it(tree, root); it; ++it, ++index)
+        {
+            const SgUctNode& child = *it;
+            size_t j = SgUctMergedValue::Find(m_mergedChildren, child.Move(),
+                                              index);
+            m_mergedChildren[j].Write(tree, child);
+        }
+        state.m_isRootParallelMerged = true;
+    }
+}
+
+bool SgUctSearch::NeedToComputeKnowledge(SgUctTree& tree,
+                                         const SgUctNode* current)
 {
     if (m_knowledgeThreshold.empty())
         return false;
@@ -774,7 +1007,7 @@ bool SgUctSearch::NeedToComputeKnowledge(const SgUctNode* current)
                 // Mark knowledge computed immediately so other
                 // threads fall through and do not waste time
                 // re-computing this knowledge.
-                m_tree.SetKnowledgeCount(*current, threshold);
+                tree.SetKnowledgeCount(*current, threshold);
                 SG_ASSERT(current->MoveCount() > 0);
                 return true;
             }
@@ -850,14 +1083,31 @@ void SgUctSearch::OnSearchIteration(SgUctValue gameNumber,
     }
 }
 
+void SgUctSearch::PinThread(const SgUctThreadState& state)
+{
+    const unsigned int threadId = state.m_threadId;
+    if (! SgPlatform::SetThreadAffinity(threadId) && threadId == 0)
+        SgWarning() << "SgUctSearch: could not pin threads\n";
+    ThreadTree(state).TouchMemory(AllocatorId(state));
+    if (  m_tempTree.NuAllocators() == m_tree.NuAllocators()
+       && m_tempTree.MaxNodes() == m_tree.MaxNodes()
+       )
+        m_tempTree.TouchMemory(threadId);
+}
+
 void SgUctSearch::PlayGame(SgUctThreadState& state, GlobalLock* lock)
 {
+    SgUctTree& tree = ThreadTree(state);
     state.m_isTreeOutOfMem = false;
     state.GameStart();
     SgUctGameInfo& info = state.m_gameInfo;
     info.Clear(m_numberPlayouts);
     bool isTerminal;
-    bool abortInTree = ! PlayInTree(state, isTerminal);
+    bool abortInTree;
+    {
+        SgUctProfileTimer timer(state.m_profile, SG_UCTPROFILE_INTREE);
+        abortInTree = ! PlayInTree(state, isTerminal);
+    }
 
     // The playout phase is always unlocked
     if (lock != 0)
@@ -866,12 +1116,16 @@ void SgUctSearch::PlayGame(SgUctThreadState& state, GlobalLock* lock)
     if (! info.m_nodes.empty() && isTerminal)
     {
         const SgUctNode& terminalNode = *info.m_nodes.back();
-        SgUctValue eval = state.Evaluate();
+        SgUctValue eval;
+        {
+            SgUctProfileTimer timer(state.m_profile, SG_UCTPROFILE_EVALUATE);
+            eval = state.Evaluate();
+        }
         if (eval > 0.6) 
-            m_tree.SetProvenType(terminalNode, SG_PROVEN_WIN);
+            tree.SetProvenType(terminalNode, SG_PROVEN_WIN);
         else if (eval < 0.4)
-            m_tree.SetProvenType(terminalNode, SG_PROVEN_LOSS);
-        PropagateProvenStatus(info.m_nodes);
+            tree.SetProvenType(terminalNode, SG_PROVEN_LOSS);
+        PropagateProvenStatus(tree, info.m_nodes);
     }
 
     size_t nuMovesInTree = info.m_inTreeSequence.size();
@@ -889,6 +1143,7 @@ void SgUctSearch::PlayGame(SgUctThreadState& state, GlobalLock* lock)
                 eval = InverseEval(eval);
             info.m_aborted[i] = abortInTree || state.m_isTreeOutOfMem;
             info.m_eval[i] = eval;
+            info.m_playoutSetupTime[i] = -1;
         }
     }
     else 
@@ -896,18 +1151,29 @@ void SgUctSearch::PlayGame(SgUctThreadState& state, GlobalLock* lock)
         state.StartPlayouts();
         for (size_t i = 0; i < m_numberPlayouts; ++i)
         {
-            state.StartPlayout();
-            info.m_sequence[i] = info.m_inTreeSequence;
-            // skipRaveUpdate only used in playout phase
-            info.m_skipRaveUpdate[i].assign(nuMovesInTree, false);
             bool abort = abortInTree || state.m_isTreeOutOfMem;
-            if (! abort && ! isTerminal)
-                abort = ! PlayoutGame(state, i);
+            {
+                SgUctProfileTimer timer(state.m_profile,
+                                        SG_UCTPROFILE_PLAYOUT);
+                double setupStart = SgTime::Get(SG_TIME_REAL);
+                state.StartPlayout();
+                info.m_playoutSetupTime[i] =
+                    SgTime::Get(SG_TIME_REAL) - setupStart;
+                info.m_sequence[i] = info.m_inTreeSequence;
+                // skipRaveUpdate only used in playout phase
+                info.m_skipRaveUpdate[i].assign(nuMovesInTree, false);
+                if (! abort && ! isTerminal)
+                    abort = ! PlayoutGame(state, i);
+            }
             SgUctValue eval;
             if (abort)
                 eval = UnknownEval();
             else
+            {
+                SgUctProfileTimer timer(state.m_profile,
+                                        SG_UCTPROFILE_EVALUATE);
                 eval = state.Evaluate();
+            }
             size_t nuMoves = info.m_sequence[i].size();
             if (nuMoves % 2 != 0)
                 eval = InverseEval(eval);
@@ -921,17 +1187,29 @@ void SgUctSearch::PlayGame(SgUctThreadState& state, GlobalLock* lock)
 
     // End of unlocked part if ! m_lockFree
     if (lock != 0)
+    {
+        SgUctProfileTimer timer(state.m_profile, SG_UCTPROFILE_LOCKWAIT);
         lock->lock();
+    }
 
-    UpdateTree(info);
-    if (m_rave)
-        UpdateRaveValues(state);
+    {
+        SgUctProfileTimer timer(state.m_profile, SG_UCTPROFILE_UPDATE);
+        UpdateTree(tree, info);
+        if (m_rave)
+            UpdateRaveValues(state);
+    }
+    if (! state.m_knowledgeBatch.empty())
+    {
+        SgUctProfileTimer timer(state.m_profile, SG_UCTPROFILE_KNOWLEDGE);
+        ComputeKnowledgeBatch(state);
+    }
     UpdateStatistics(info);
 }
 
 /** Backs up proven information. Last node of nodes is the newly
     proven node. */
-void SgUctSearch::PropagateProvenStatus(const std::vector<const SgUctNode*>& nodes)
+void SgUctSearch::PropagateProvenStatus(SgUctTree& tree,
+                                  const std::vector<const SgUctNode*>& nodes)
 {
     if (nodes.size() <= 1) 
         return;
@@ -940,7 +1218,7 @@ void SgUctSearch::PropagateProvenStatus(const std::vector<const SgUctNode*>& nod
     {
         const SgUctNode& parent = *nodes[i];
         SgUctProvenType type = SG_PROVEN_LOSS;
-        for (SgUctChildIterator it(m_tree, parent); it; ++it)
+        for (SgUctChildIterator it(tree, parent); it; ++it)
         {
             const SgUctNode& child = *it;
             if (! child.IsProven())
@@ -954,7 +1232,7 @@ void SgUctSearch::PropagateProvenStatus(const std::vector<const SgUctNode*>& nod
         if (type == SG_NOT_PROVEN)
             break;
         else
-            m_tree.SetProvenType(parent, type);
+            tree.SetProvenType(parent, type);
         if (i == 0)
             break;
         --i;
@@ -970,11 +1248,20 @@ bool SgUctSearch::PlayInTree(SgUctThreadState& state, bool& isTerminal)
 {
     vector<SgMove>& sequence = state.m_gameInfo.m_inTreeSequence;
     vector<const SgUctNode*>& nodes = state.m_gameInfo.m_nodes;
-    const SgUctNode* root = &m_tree.Root();
+    SgUctTree& tree = ThreadTree(state);
+    const SgUctNode* root = &tree.Root();
     const SgUctNode* current = root;
     if (m_virtualLoss && m_numberThreads > 1)
-        m_tree.AddVirtualLoss(*current);
+        tree.AddVirtualLoss(*current);
     nodes.push_back(current);
+    // Without hash codes, the game does not use the transposition table,
+    // which can only contain nodes of m_tree
+    if (m_transpositionMode != SG_UCTTRANSPOSITION_NONE && &tree == &m_tree)
+    {
+        SgHashCode hashCode;
+        if (state.GetHashCode(hashCode))
+            state.m_gameInfo.m_hashCodes.push_back(hashCode);
+    }
     bool breakAfterSelect = false;
     isTerminal = false;
     bool useBiasTerm = false;
@@ -995,13 +1282,23 @@ bool SgUctSearch::PlayInTree(SgUctThreadState& state, bool& isTerminal)
         {
             state.m_moves.clear();
             SgUctProvenType provenType = SG_NOT_PROVEN;
-            state.GenerateAllMoves(0, state.m_moves, provenType);
+            bool isKnowledgePending = false;
+            {
+                SgUctProfileTimer timer(state.m_profile,
+                                        SG_UCTPROFILE_KNOWLEDGE);
+                if (m_knowledgeBatchSize > 0)
+                    isKnowledgePending =
+                        state.GenerateMovesWithoutKnowledge(state.m_moves,
+                                                            provenType);
+                else
+                    state.GenerateAllMoves(0, state.m_moves, provenType);
+            }
             if (current == root)
                 ApplyRootFilter(state.m_moves);
             if (provenType != SG_NOT_PROVEN)
             {
-                m_tree.SetProvenType(*current, provenType);
-                PropagateProvenStatus(nodes);
+                tree.SetProvenType(*current, provenType);
+                PropagateProvenStatus(tree, nodes);
                 break;
             }
             if (state.m_moves.empty())
@@ -1011,30 +1308,44 @@ bool SgUctSearch::PlayInTree(SgUctThreadState& state, bool& isTerminal)
             }
             if (current->MoveCount() >= m_expandThreshold)
             {
-                ExpandNode(state, *current);
+                {
+                    SgUctProfileTimer timer(state.m_profile,
+                                            SG_UCTPROFILE_EXPAND);
+                    ExpandNode(state, *current);
+                }
                 if (state.m_isTreeOutOfMem)
                     return true;
+                if (isKnowledgePending)
+                    AddPendingKnowledge(state, *current);
                 breakAfterSelect = true;
             }
             else
                 break;
         }
         else if (state.m_threadId < m_maxKnowledgeThreads 
-                 && NeedToComputeKnowledge(current))
+                 && NeedToComputeKnowledge(tree, current))
         {
             m_statistics.m_knowledge++;
             state.m_moves.clear();
             SgUctProvenType provenType = SG_NOT_PROVEN;
-            bool truncate = state.GenerateAllMoves(current->KnowledgeCount(), 
-                                                   state.m_moves,
-                                                   provenType);
+            bool truncate;
+            {
+                SgUctProfileTimer timer(state.m_profile,
+                                        SG_UCTPROFILE_KNOWLEDGE);
+                truncate = state.GenerateAllMoves(current->KnowledgeCount(),
+                                                  state.m_moves, provenType);
+            }
             if (current == root)
                 ApplyRootFilter(state.m_moves);
-            CreateChildren(state, *current, truncate);
+            {
+                SgUctProfileTimer timer(state.m_profile,
+                                        SG_UCTPROFILE_EXPAND);
+                CreateChildren(state, *current, truncate);
+            }
             if (provenType != SG_NOT_PROVEN)
             {
-                m_tree.SetProvenType(*current, provenType);
-                PropagateProvenStatus(nodes);
+                tree.SetProvenType(*current, provenType);
+                PropagateProvenStatus(tree, nodes);
                 break;
             }
             if (state.m_moves.empty())
@@ -1046,19 +1357,33 @@ bool SgUctSearch::PlayInTree(SgUctThreadState& state, bool& isTerminal)
                 return true;
             breakAfterSelect = true;
         }
-        current = &SelectChild(state.m_randomizeRaveCounter, useBiasTerm, *current);
+        current = &SelectChild(tree, state.m_randomizeRaveCounter, useBiasTerm,
+                               *current);
         if (m_virtualLoss && m_numberThreads > 1)
-            m_tree.AddVirtualLoss(*current);
+            tree.AddVirtualLoss(*current);
         nodes.push_back(current);
         SgMove move = current->Move();
         state.Execute(move);
         sequence.push_back(move);
+        if (m_transpositionMode != SG_UCTTRANSPOSITION_NONE)
+            ShareTransposition(state, *current);
         if (breakAfterSelect)
             break;
     }
     return true;
 }
 
+std::size_t SgUctSearch::PruneTree(SgUctTree& tree, SgUctValue minCount,
+                                   bool inPlace)
+{
+    if (inPlace)
+        return tree.PruneLowCount(minCount);
+    SgUctTree& tempTree = GetTempTree();
+    tree.CopyPruneLowCount(tempTree, minCount, true);
+    tree.Swap(tempTree);
+    return tree.NuNodes();
+}
+
 /** Finish the game using GeneratePlayoutMove().
     @param state The thread state.
     @param playout The number of the playout.
@@ -1116,6 +1441,8 @@ SgUctValue SgUctSearch::Search(SgUctValue maxGames, double maxTime,
             m_threads[i]->StartPlay();
         for (size_t i = 0; i < m_threads.size(); ++i)
             m_threads[i]->WaitPlayFinished();
+        // Pruning would invalidate the pending nodes
+        FlushPendingKnowledge();
         if (m_aborted || ! m_pruneFullTree)
             break;
         else
@@ -1124,20 +1451,32 @@ SgUctValue SgUctSearch::Search(SgUctValue maxGames, double maxTime,
             SgDebug() << "SgUctSearch: pruning nodes with count < "
                   << pruneMinCount << " (at time " << fixed << setprecision(1)
                   << startPruneTime << ")\n";
-            SgUctTree& tempTree = GetTempTree();
-            m_tree.CopyPruneLowCount(tempTree, pruneMinCount, true);
+            size_t oldNuNodes = m_tree.NuNodes();
+            size_t prunedNuNodes =
+                PruneTree(m_tree, pruneMinCount, m_pruneInPlace);
+            // The trees of the other root-parallel threads have only one
+            // allocator, which a copy into the temporary tree would not keep
+            for (size_t i = 1; i < m_rootParallelTrees.size(); ++i)
+            {
+                SgUctTree& tree = *m_rootParallelTrees[i];
+                oldNuNodes += tree.NuNodes();
+                prunedNuNodes += PruneTree(tree, pruneMinCount, true);
+            }
             int prunedSizePercentage =
-                static_cast<int>(tempTree.NuNodes() * 100 / m_tree.NuNodes());
-            SgDebug() << "SgUctSearch: pruned size: " << tempTree.NuNodes()
+                static_cast<int>(prunedNuNodes * 100 / oldNuNodes);
+            SgDebug() << "SgUctSearch: pruned size: " << prunedNuNodes
                       << " (" << prunedSizePercentage << "%) time: "
                       << (m_timer.GetTime() - startPruneTime) << "\n";
             if (prunedSizePercentage > 50)
                 pruneMinCount *= 2;
             else
                  pruneMinCount = m_pruneMinCount; 
-            m_tree.Swap(tempTree);
+            // The table contains pointers to nodes of the old tree
+            m_transpositionTable.Clear();
         }
     }
+    if (! m_rootParallelTrees.empty())
+        MergeRootParallelTrees();
     EndSearch();
     m_statistics.m_time = m_timer.GetTime();
     if (m_statistics.m_time > numeric_limits<double>::epsilon())
@@ -1155,11 +1494,13 @@ void SgUctSearch::SearchLoop(SgUctThreadState& state, GlobalLock* lock)
 {
     if (! state.m_isSearchInitialized)
     {
+        if (m_pinThreads)
+            PinThread(state);
         OnThreadStartSearch(state);
         state.m_isSearchInitialized = true;
     }
 
-    if (NumberThreads() == 1 || m_lockFree)
+    if (NumberThreads() == 1 || m_lockFree || ! m_rootParallelTrees.empty())
         lock = 0;
     if (lock != 0)
         lock->lock();
@@ -1172,6 +1513,15 @@ void SgUctSearch::SearchLoop(SgUctThreadState& state, GlobalLock* lock)
         if (m_logGames)
             m_log << SummaryLine(state.m_gameInfo) << '\n';
         ++m_numberGames;
+        if (  ! m_rootParallelTrees.empty()
+           && m_rootParallelMergeInterval > 0
+           && ++state.m_rootParallelGames >= m_rootParallelMergeInterval
+           )
+        {
+            state.m_rootParallelGames = 0;
+            boost::mutex::scoped_lock mergeLock(m_rootParallelMutex);
+            MergeRootParallelTrees();
+        }
         if (m_isTreeOutOfMemory)
             break;
         if (m_aborted || CheckAbortSearch(state))
@@ -1261,7 +1611,8 @@ SgPoint SgUctSearch::SearchOnePly(SgUctValue maxGames, double maxTime,
     return bestMove;
 }
 
-const SgUctNode& SgUctSearch::SelectChild(int& randomizeCounter, 
+const SgUctNode& SgUctSearch::SelectChild(const SgUctTree& tree,
+                                          int& randomizeCounter, 
                                           bool useBiasTerm,
                                           const SgUctNode& node)
 {
@@ -1283,7 +1634,7 @@ const SgUctNode& SgUctSearch::SelectChild(int& randomizeCounter,
 
     // If position count is zero, return first child
     if (posCount == 0)
-        return *SgUctChildIterator(m_tree, node);
+        return *SgUctChildIterator(tree, node);
         
     const SgUctValue logPosCount = Log(posCount);
     const SgUctNode* bestChild = 0;
@@ -1291,7 +1642,7 @@ const SgUctNode& SgUctSearch::SelectChild(int& randomizeCounter,
     const SgUctValue predictorWeight = 
     	m_additiveKnowledge.PredictorWeight(posCount);
     const SgUctValue epsilon = SgUctValue(1e-7);
-    for (SgUctChildIterator it(m_tree, node); it; ++it)
+    for (SgUctChildIterator it(tree, node); it; ++it)
     {
         const SgUctNode& child = *it;
         if (! child.IsProvenWin()) // Avoid losing moves
@@ -1321,6 +1672,31 @@ const SgUctNode& SgUctSearch::SelectChild(int& randomizeCounter,
     return *node.FirstChild();
 }
 
+/** Share the children of a node with a node for the same position.
+    Called in the in-tree phase after the move of @c node was executed.
+    @see SgUctTranspositionMode */
+void SgUctSearch::ShareTransposition(SgUctThreadState& state,
+                                     const SgUctNode& node)
+{
+    vector<SgHashCode>& hashCodes = state.m_gameInfo.m_hashCodes;
+    if (hashCodes.empty())
+        // Hash codes not supported by thread state
+        return;
+    SgHashCode hashCode;
+    if (! state.GetHashCode(hashCode))
+        return;
+    hashCodes.push_back(hashCode);
+    SG_ASSERT(hashCodes.size() == state.m_gameInfo.m_nodes.size());
+    const size_t depth = hashCodes.size() - 1;
+    const SgUctNode* other =
+        m_transpositionTable.Lookup(hashCode, depth, node);
+    if (other != &node && ! node.HasChildren() && other->HasChildren())
+    {
+        m_tree.ShareChildren(node, *other);
+        m_statistics.m_transpositions++;
+    }
+}
+
 void SgUctSearch::SetNumberThreads(unsigned int n)
 {
     SG_ASSERT(n >= 1);
@@ -1336,6 +1712,26 @@ void SgUctSearch::SetCheckTimeInterval(SgUctValue n)
     m_checkTimeInterval = n;
 }
 
+void SgUctSearch::SetPinThreads(bool enable)
+{
+    if (m_pinThreads == enable)
+        return;
+    m_pinThreads = enable;
+    // Threads cannot be unpinned and pages cannot be moved to another NUMA
+    // node, so start over with new threads and trees
+    if (m_threads.size() > 0)
+        CreateThreads();
+}
+
+void SgUctSearch::SetRootParallel(bool enable)
+{
+    if (m_rootParallel == enable)
+        return;
+    m_rootParallel = enable;
+    if (m_threads.size() > 0)
+        CreateThreads();
+}
+
 void SgUctSearch::SetRave(bool enable)
 {
     if (enable && m_moveRange <= 0)
@@ -1353,6 +1749,12 @@ void SgUctSearch::SetThreadStateFactory(SgUctThreadStateFactory* factory)
     // is not fully constructed) as an argument to the Create() function
 }
 
+void SgUctSearch::ReRootTree(const SgUctNode& node)
+{
+    m_tree.ReRoot(node);
+    m_keepTree = true;
+}
+
 void SgUctSearch::StartSearch(const vector<SgMove>& rootFilter,
                               SgUctTree* initTree)
 {
@@ -1367,11 +1769,14 @@ void SgUctSearch::StartSearch(const vector<SgMove>& rootFilter,
         SgWarning() << "SgUctSearch: using cpu time with multiple threads\n";
     m_raveWeightParam1 = SgUctValue(1.0 / m_raveWeightInitial);
     m_raveWeightParam2 = SgUctValue(1.0 / m_raveWeightFinal);
-    if (initTree == 0)
+    const bool keepTree = m_keepTree;
+    m_keepTree = false;
+    if (initTree == 0 && ! keepTree)
         m_tree.Clear();
     else
     {
-        m_tree.Swap(*initTree);
+        if (initTree != 0)
+            m_tree.Swap(*initTree);
         if (m_tree.HasCapacity(0, m_tree.Root().NuChildren()))
             m_tree.ApplyFilter(0, m_tree.Root(), rootFilter);
         else
@@ -1379,6 +1784,17 @@ void SgUctSearch::StartSearch(const vector<SgMove>& rootFilter,
                 "SgUctSearch: "
                 "root filter not applied (tree reached maximum size)\n";
     }
+    if (m_transpositionMode != SG_UCTTRANSPOSITION_NONE)
+    {
+        // Table size is a compromise between memory and the number of
+        // replaced entries; most nodes are leaves that are never looked up
+        // as a transposition
+        size_t maxEntries = std::max(m_maxNodes / 4, size_t(1));
+        if (m_transpositionTable.MaxEntries() != maxEntries)
+            m_transpositionTable.SetMaxEntries(maxEntries);
+        else
+            m_transpositionTable.Clear();
+    }
     m_statistics.Clear();
     m_aborted = false;
     m_wasEarlyAbort = false;
@@ -1390,18 +1806,39 @@ void SgUctSearch::StartSearch(const vector<SgMove>& rootFilter,
     
     m_nextCheckTime = SgUctValue(m_checkTimeInterval);
     m_startRootMoveCount = m_tree.Root().MoveCount();
+    if (! m_rootParallelTrees.empty())
+    {
+        for (size_t i = 1; i < m_rootParallelTrees.size(); ++i)
+            m_rootParallelTrees[i]->Clear();
+        // The statistics of a kept tree count as already merged
+        const SgUctNode& root = m_tree.Root();
+        m_mergedRoot = SgUctMergedValue();
+        m_mergedRoot.Add(root);
+        m_mergedRootPosCount = root.PosCount();
+        m_mergedChildren.clear();
+        if (root.HasChildren())
+            for (SgUctChildIterator it(m_tree, root); it; ++it)
+            {
+                m_mergedChildren.push_back(SgUctMergedValue((*it).Move()));
+                m_mergedChildren.back().Add(*it);
+            }
+    }
 
     for (unsigned int i = 0; i < m_threads.size(); ++i)
     {
         SgUctThreadState& state = ThreadState(i);
         state.m_randomizeRaveCounter = m_randomizeRaveFrequency;
         state.m_randomizeBiasCounter = m_biasTermFrequency;
+        state.m_rootParallelGames = 0;
+        state.m_isRootParallelMerged = (i == 0);
+        state.m_profile.Clear();
         state.StartSearch();
     }
 }
 
 void SgUctSearch::EndSearch()
 {
+    FlushPendingKnowledge();
     OnEndSearch();
 }
 
@@ -1523,7 +1960,8 @@ void SgUctSearch::UpdateRaveValues(SgUctThreadState& state,
     if (! node->HasChildren())
         return;
     size_t len = state.m_gameInfo.m_sequence[playout].size();
-    for (SgUctChildIterator it(m_tree, *node); it; ++it)
+    SgUctTree& tree = ThreadTree(state);
+    for (SgUctChildIterator it(tree, *node); it; ++it)
     {
         const SgUctNode& child = *it;
         SgMove mv = child.Move();
@@ -1538,7 +1976,7 @@ void SgUctSearch::UpdateRaveValues(SgUctThreadState& state,
             weight = 2 - SgUctValue(first - i) / SgUctValue(len - i);
         else
             weight = 1;
-        m_tree.AddRaveValue(child, eval, weight);
+        tree.AddRaveValue(child, eval, weight);
     }
 }
 
@@ -1551,10 +1989,13 @@ void SgUctSearch::UpdateStatistics(const SgUctGameInfo& info)
         m_statistics.m_gameLength.Add(
                                static_cast<float>(info.m_sequence[i].size()));
         m_statistics.m_aborted.Add(info.m_aborted[i] ? 1.f : 0.f);
+        if (info.m_playoutSetupTime[i] >= 0)
+            m_statistics.m_playoutSetupTime.Add(
+                    static_cast<SgUctValue>(1e6 * info.m_playoutSetupTime[i]));
     }
 }
 
-void SgUctSearch::UpdateTree(const SgUctGameInfo& info)
+void SgUctSearch::UpdateTree(SgUctTree& tree, const SgUctGameInfo& info)
 {
     SgUctValue eval = 0;
     for (size_t i = 0; i < m_numberPlayouts; ++i)
@@ -1568,14 +2009,82 @@ void SgUctSearch::UpdateTree(const SgUctGameInfo& info)
     {
         const SgUctNode& node = *nodes[i];
         const SgUctNode* father = (i > 0 ? nodes[i - 1] : 0);
-        m_tree.AddGameResults(node, father, i % 2 == 0 ? eval : inverseEval,
-                              count);
+        tree.AddGameResults(node, father, i % 2 == 0 ? eval : inverseEval,
+                            count);
         // Remove the virtual loss
         if (m_virtualLoss && m_numberThreads > 1)
-            m_tree.RemoveVirtualLoss(node);
+            tree.RemoveVirtualLoss(node);
+    }
+    if (  m_transpositionMode == SG_UCTTRANSPOSITION_UCT2
+       || m_transpositionMode == SG_UCTTRANSPOSITION_UCT3
+       )
+        UpdateTranspositionValues(tree, info, eval, count);
+}
+
+/** Update the values of the nodes of a game according to the transposition
+    mode.
+    @param info
+    @param eval The game result from the view of the root.
+    @param count The number of times the result was added to the nodes. */
+void SgUctSearch::UpdateTranspositionValues(SgUctTree& tree,
+                                            const SgUctGameInfo& info,
+                                            SgUctValue eval,
+                                            SgUctValue count)
+{
+    const vector<const SgUctNode*>& nodes = info.m_nodes;
+    if (m_transpositionMode == SG_UCTTRANSPOSITION_UCT2)
+    {
+        const vector<SgHashCode>& hashCodes = info.m_hashCodes;
+        SgUctValue inverseEval = InverseEval(eval);
+        SgUctStatistics value;
+        for (size_t i = 1; i < nodes.size() && i < hashCodes.size(); ++i)
+        {
+            const SgUctNode& node = *nodes[i];
+            if (! m_transpositionTable.AddGameResults(hashCodes[i], i,
+                                             i % 2 == 0 ? eval : inverseEval,
+                                             count, value))
+                continue;
+            // The entry can be younger than the node, if it replaced the
+            // entry of another position
+            if (value.Count() > node.MoveCount())
+                tree.InitializeValue(node, value.Mean(), value.Count());
+        }
+    }
+    else
+    {
+        SG_ASSERT(m_transpositionMode == SG_UCTTRANSPOSITION_UCT3);
+        // Bottom-up, so that the children of a node are already updated
+        for (size_t i = nodes.size() - 1; i > 0; --i)
+        {
+            const SgUctNode& node = *nodes[i];
+            if (! node.HasChildren() || node.MoveCount() == 0)
+                continue;
+            SgUctValue sum = 0;
+            SgUctValue childCount = 0;
+            for (SgUctChildIterator it(tree, node); it; ++it)
+            {
+                const SgUctNode& child = *it;
+                if (! child.HasMean())
+                    continue;
+                SgUctValue moveCount = child.MoveCount();
+                sum += moveCount * child.Mean();
+                childCount += moveCount;
+            }
+            if (childCount > 0)
+                tree.InitializeValue(node, InverseEval(sum / childCount),
+                                     node.MoveCount());
+        }
     }
 }
 
+void SgUctSearch::UseTree(SgUctTree& tree)
+{
+    if (m_threads.size() == 0)
+        CreateThreads();
+    m_tree.Swap(tree);
+    m_keepTree = true;
+}
+
 void SgUctSearch::WriteStatistics(std::ostream& out) const
 {
     out << SgWriteLabel("Count") << m_tree.Root().MoveCount() << '\n'
@@ -1586,8 +2095,18 @@ void SgUctSearch::WriteStatistics(std::ostream& out) const
             << m_statistics.m_knowledge << " (" << fixed << setprecision(1) 
             << m_statistics.m_knowledge * 100.0 / m_tree.Root().MoveCount()
             << "%)\n";
+    if (m_transpositionMode != SG_UCTTRANSPOSITION_NONE)
+        out << SgWriteLabel("Transpositions")
+            << m_statistics.m_transpositions << '\n';
     m_statistics.Write(out);
     m_mpiSynchronizer->WriteStatistics(out);
+    if (SG_UCTPROFILE_ENABLED)
+    {
+        SgUctProfile profile;
+        GetProfile(profile);
+        out << "Profile:\n";
+        profile.Write(out);
+    }
 }
 
 //----------------------------------------------------------------------------
@@ -19,6 +19,8 @@
 #include "SgBlackWhite.h"
 #include "SgBWArray.h"
 #include "SgTimer.h"
+#include "SgUctProfile.h"
+#include "SgUctTranspositionTable.h"
 #include "SgUctTree.h"
 #include "SgUctValue.h"
 #include "SgMpiSynchronizer.h"
@@ -119,6 +121,22 @@ non-zero. Updating a value requires first writing the new mean value, then the
 new count. The compiler is prevented from reordering the writes by declaring
 the counts and mean values as volatile.
 
+@section sguctsearchlockfreeatomic Atomic Updates of Values
+
+With many threads, the lost updates of the previous section become more
+frequent, especially at the root and other nodes close to the root, which
+are updated by all threads. If Fuego is configured with --enable-uct-atomic
+(macro SG_UCT_ATOMIC), the move and RAVE statistics, the position count and
+the virtual loss count of SgUctNode use C++11 atomic read-modify-write
+operations instead (see SgStatisticsAtomicBase). The statistics store the
+sum of the values instead of the mean value, such that an update consists of
+an atomic addition to the sum followed by an atomic addition to the count;
+no updates are lost. The rule that the mean value is valid if the count is
+non-zero still holds, because the sum is always written before the count.
+A reader can still see a sum that contains a value that is not yet counted.
+Atomic additions are more expensive than the plain writes used with volatile
+variables, so this mode is only useful with a large number of threads.
+
 @section sguctsearchlockfreeplatform Platform Requirements
 
 There are some requirements on the memory model of the platform to make the
@@ -226,9 +244,21 @@ struct SgUctGameInfo
         playout). */
     std::vector<bool> m_aborted;
 
+    /** Real time in seconds used by SgUctThreadState::StartPlayout() (stored
+        for each playout).
+        Negative, if StartPlayout() was not called, because the game ended in
+        a proven node. */
+    std::vector<double> m_playoutSetupTime;
+
     /** Nodes visited in the in-tree phase. */
     std::vector<const SgUctNode*> m_nodes;
 
+    /** Hash codes of the positions of the nodes in m_nodes.
+        Only used if a transposition mode is enabled (see
+        SgUctTranspositionMode). Empty, if the thread state does not
+        support hash codes (see SgUctThreadState::GetHashCode()). */
+    std::vector<SgHashCode> m_hashCodes;
+
     /** Flag to skip RAVE update for moves of the playout(s).
         For convenient usage, the index corresponds to the move number from
         the root position on, even if the flag is currently only used for
@@ -261,6 +291,105 @@ enum SgUctMoveSelect
 
 //----------------------------------------------------------------------------
 
+/** Handling of transpositions in SgUctSearch.
+    In the transposition modes, positions that are reached by different move
+    sequences share their children (see SgUctTree::ShareChildren()), so that
+    the subtree below a transposition is stored and searched only once.
+    The modes differ in how the value of the nodes corresponding to the same
+    position is updated (see Childs, Brodeur, Kocsis: Transpositions and Move
+    Groups in Monte Carlo Tree Search, CIG 2008).
+    Transpositions are detected with a SgUctTranspositionTable and require
+    that the thread state implements SgUctThreadState::GetHashCode().
+    Functions that copy the tree (SgUctTree::ExtractSubtree(),
+    SgUctTree::CopyPruneLowCount()) copy a shared subtree once for each
+    path to it.
+    @ingroup sguctgroup */
+enum SgUctTranspositionMode
+{
+    /** Do not detect transpositions (pure tree). */
+    SG_UCTTRANSPOSITION_NONE,
+
+    /** Share children, but keep the move statistics of each node (UCT1). */
+    SG_UCTTRANSPOSITION_UCT1,
+
+    /** Share children and use the statistics of the position accumulated
+        over all paths to it as move statistics of each node (UCT2). */
+    SG_UCTTRANSPOSITION_UCT2,
+
+    /** Share children and set the value of an expanded node to the
+        count-weighted mean of the values of its children (UCT3). */
+    SG_UCTTRANSPOSITION_UCT3
+};
+
+//----------------------------------------------------------------------------
+
+/** A node waiting for its knowledge in the knowledge pipeline.
+    See SgUctSearch::KnowledgeBatchSize()
+    @ingroup sguctgroup */
+struct SgUctPendingKnowledge
+{
+    /** The tree containing the node.
+        See SgUctSearch::RootParallel() */
+    SgUctTree* m_tree;
+
+    const SgUctNode* m_node;
+
+    /** Moves from the root to the node. */
+    std::vector<SgMove> m_sequence;
+};
+
+//----------------------------------------------------------------------------
+
+/** Statistics of a node of the root-parallel trees at the last merge.
+    See SgUctSearch::RootParallel()
+    @ingroup sguctgroup */
+struct SgUctMergedValue
+{
+    SgMove m_move;
+
+    SgUctValue m_count;
+
+    /** Sum of the game results (mean times count). */
+    SgUctValue m_sum;
+
+    SgUctValue m_raveCount;
+
+    /** Sum of the RAVE values (mean times count). */
+    SgUctValue m_raveSum;
+
+    SgUctMergedValue(SgMove move = SG_NULLMOVE);
+
+    /** Add the move and RAVE statistics of a node. */
+    void Add(const SgUctNode& node);
+
+    void Add(const SgUctMergedValue& value);
+
+    void Subtract(const SgUctMergedValue& value);
+
+    /** Set the move and RAVE statistics of a node to this value.
+        Statistics with a count that is not positive are not changed. */
+    void Write(SgUctTree& tree, const SgUctNode& node) const;
+
+    /** Find the value for a move.
+        @param values The values
+        @param move The move
+        @param index The index to try first (the children of a node are
+        usually in the same order in all trees)
+        @return The index of the value or values.size(), if not found */
+    static std::size_t Find(const std::vector<SgUctMergedValue>& values,
+                            SgMove move, std::size_t index);
+};
+
+inline SgUctMergedValue::SgUctMergedValue(SgMove move)
+    : m_move(move),
+      m_count(0),
+      m_sum(0),
+      m_raveCount(0),
+      m_raveSum(0)
+{ }
+
+//----------------------------------------------------------------------------
+
 /** Base class for the thread state.
     Subclasses must be thread-safe, it must be possible to use different
     instances of this class in different threads (after construction, the
@@ -302,12 +431,32 @@ public:
         Reused for efficiency. */
     std::vector<SgMove> m_excludeMoves;
 
+    /** Batch of nodes, for which the thread computes the knowledge after
+        the current game.
+        See SgUctSearch::KnowledgeBatchSize() */
+    std::vector<SgUctPendingKnowledge> m_knowledgeBatch;
+
+    /** Number of games since the thread merged the root-parallel trees.
+        See SgUctSearch::RootParallelMergeInterval() */
+    std::size_t m_rootParallelGames;
+
+    /** The root of the thread's tree was included in the last merge of the
+        root-parallel trees.
+        See SgUctSearch::RootParallel() */
+    bool m_isRootParallelMerged;
+
     /** Thread's counter for Randomized Rave in SgUctSearch::SelectChild(). */
     int m_randomizeRaveCounter;
 
     /** Thread's counter for Randomized Bias in SgUctSearch::PlayInTree(). */
     int m_randomizeBiasCounter;
 
+    /** Time profile of the phases of the thread's games in the current
+        search.
+        Only collected if compiled with SG_UCT_PROFILE.
+        See SgUctSearch::GetProfile() */
+    SgUctProfile m_profile;
+
     SgUctThreadState(unsigned int threadId, int moveRange = 0);
 
     virtual ~SgUctThreadState();
@@ -394,6 +543,28 @@ public:
         Default implementation does nothing. */
     virtual void EndPlayout();
 
+    /** Generate moves without expensive knowledge.
+        Used by SgUctSearch for expanding a node if a knowledge pipeline is
+        used (see SgUctSearch::KnowledgeBatchSize()). The knowledge is
+        computed later with GenerateAllMoves() and added to the children.
+        The moves should therefore have no prior values.
+        Default implementation calls GenerateAllMoves() and returns false.
+        @param[out] moves The generated moves or empty list at end of game
+        @param[out] provenType
+        @return @c true, if the knowledge was left out and GenerateAllMoves()
+        needs to be called later. */
+    virtual bool GenerateMovesWithoutKnowledge(
+                                          std::vector<SgUctMoveInfo>& moves,
+                                          SgUctProvenType& provenType);
+
+    /** Get the hash code of the current position in the in-tree phase.
+        The hash code must include the color to play. Used for detecting
+        transpositions (see SgUctTranspositionMode).
+        Default implementation returns false.
+        @param[out] hashCode
+        @return @c false, if hash codes are not supported. */
+    virtual bool GetHashCode(SgHashCode& hashCode) const;
+
     // @} // name
 };
 
@@ -423,6 +594,10 @@ struct SgUctSearchStat
     /** Number of nodes for which the knowledge threshold was exceeded. */ 
     SgUctValue m_knowledge;
 
+    /** Number of nodes that got the children of a transposition.
+        See SgUctTranspositionMode. */
+    SgUctValue m_transpositions;
+
     /** Games per second.
         Useful values only if search time is higher than resolution of
         SgTime::Get(). */
@@ -434,6 +609,10 @@ struct SgUctSearchStat
 
     SgUctStatistics m_aborted;
 
+    /** Time in microseconds for setting up the state of a playout.
+        See SgUctThreadState::StartPlayout(). */
+    SgStatisticsExt<SgUctValue,SgUctValue> m_playoutSetupTime;
+
     void Clear();
 
     void Write(std::ostream& out) const;
@@ -565,13 +744,34 @@ public:
         Initializes search for current position and clears statistics.
         @param rootFilter Moves to filter at the root node
         @param initTree The tree to initialize the search with. 0 for no
-        initialization. The trees are actually swapped, not copied. */
+        initialization (or for keeping the search tree, if ReRootTree() or
+        UseTree() was called since the last search). The trees are actually
+        swapped, not copied. */
     void StartSearch(const std::vector<SgMove>& rootFilter
                      = std::vector<SgMove>(),
                      SgUctTree* initTree = 0);
 
     void EndSearch();
 
+    /** Reuse a subtree of the current search tree in the next search.
+        Makes the node the root of the search tree in-place (see
+        SgUctTree::ReRoot()), which avoids copying the subtree with
+        SgUctTree::ExtractSubtree(). The next call of StartSearch() or
+        Search() with no initialization tree will keep the search tree
+        instead of clearing it.
+        @param node The new root (must be a node of Tree()) */
+    void ReRootTree(const SgUctNode& node);
+
+    /** Continue the next search with a given tree.
+        Swaps the search tree with the given tree (for example a tree loaded
+        with SgUctTreeUtil::LoadBinary()). Like after ReRootTree(), the next
+        call of StartSearch() or Search() with no initialization tree will
+        keep the search tree.
+        @param tree The tree (must have the same number of allocators and
+        maximum number of nodes as Tree(); contains the old search tree
+        after the call) */
+    void UseTree(SgUctTree& tree);
+
     /** Calls StartSearch() and then PlayGame() in a loop.
         @param maxGames The maximum number of games (greater or equal
         one). The number of games includes the ones already counted in
@@ -580,7 +780,9 @@ public:
         @param[out] sequence The move sequence with the best value.
         @param rootFilter Moves to filter at the root node
         @param initTree The tree to initialize the search with. 0 for no
-        initialization. The trees are actually swapped, not copied.
+        initialization (or for keeping the search tree, see ReRootTree()
+        and UseTree()).
+        The trees are actually swapped, not copied.
         @param earlyAbort See SgUctEarlyAbortParam. Null means not to do an
         early abort.
         @return The value of the root position. */
@@ -642,6 +844,12 @@ public:
 
     const SgUctTree& Tree() const;
 
+    /** Non-const access to the tree.
+        Used by synchronizers, which modify the statistics of the tree in
+        SgMpiSynchronizer::OnSearchIteration() and
+        SgMpiSynchronizer::OnEndSearch(). */
+    SgUctTree& Tree();
+
     /** Get temporary tree.
         Returns a tree that is compatible in size and number of allocators
         to the tree of the search. This tree is used by the search itself as
@@ -693,6 +901,24 @@ public:
 
     void SetMaxKnowledgeThreads(unsigned int threads);
 
+    /** Compute the knowledge of expanded nodes in batches.
+        If greater than zero, a thread expands a node with the moves from
+        SgUctThreadState::GenerateMovesWithoutKnowledge() and puts the node
+        into a queue, if the thread state left out the knowledge. A virtual
+        loss keeps the threads away from the node while it is in the queue.
+        When the queue contains the given number of nodes, the thread that
+        added the last node computes the knowledge for all nodes in the
+        queue after its current game with SgUctThreadState::GenerateAllMoves()
+        and adds it to the children with SgUctTree::AddKnowledge(). This
+        moves the computation of expensive knowledge out of the in-tree
+        phase of the other threads. The queue is emptied at the end of each
+        search.
+        Default is 0 (compute the knowledge when a node is expanded). */
+    std::size_t KnowledgeBatchSize() const;
+
+    /** See KnowledgeBatchSize() */
+    void SetKnowledgeBatchSize(std::size_t size);
+
     /** Maximum number of nodes in the tree.
         @note The search owns two trees, one of which is used as a temporary
         tree for some operations (see GetTempTree()). This functions sets
@@ -709,6 +935,23 @@ public:
     /** See SetNumberThreads() */
     void SetNumberThreads(unsigned int n);
 
+    /** Pin the search threads to processors.
+        Thread i is bound to processor i modulo the number of processors
+        (see SgPlatform::SetThreadAffinity()). At the start of a search, each
+        thread also writes to the unused memory of its node allocators in
+        the search tree and the temporary tree (see
+        SgUctAllocator::TouchMemory()). With the first-touch policy of the
+        operating system, the nodes of a thread are then allocated on the
+        NUMA node of its processor, even if they are created by the main
+        thread (e.g. when a subtree is reused). Note that this commits the
+        memory for the maximum number of nodes of both trees at the first
+        search. Changing the value recreates the threads and the trees.
+        Default is false. */
+    bool PinThreads() const;
+
+    /** See PinThreads() */
+    void SetPinThreads(bool enable);
+
     /** Interval in number of games in which to check time abort.
         Avoids that the potentially expensive SgTime::Get() is called after
         every game. The interval is updated dynamically according to the
@@ -728,6 +971,34 @@ public:
     /** See LockFree() */
     void SetLockFree(bool enable);
 
+    /** Search with a separate tree for each thread (root parallelization).
+        Thread 0 searches in Tree(), each other thread in its own tree,
+        which is cleared at the start of each search. The threads do not
+        share nodes and run without the global lock. The statistics of the
+        root and its children are merged into all trees every
+        RootParallelMergeInterval() games of a thread and at the end of the
+        search, so that Tree() contains the combined root statistics for the
+        move selection. Deeper nodes in Tree() contain only the games of
+        thread 0. Each thread can use MaxNodes() / NumberThreads() nodes,
+        like in the shared tree. Transpositions are only used in Tree().
+        The maximum number of games refers to the games of all threads.
+        Changing the value recreates the threads and the trees.
+        Default is false. */
+    bool RootParallel() const;
+
+    /** See RootParallel() */
+    void SetRootParallel(bool enable);
+
+    /** Number of games of a thread between merges of the root-parallel
+        trees.
+        0 means that the trees are merged only at the end of the search.
+        Default is 1000.
+        See RootParallel() */
+    std::size_t RootParallelMergeInterval() const;
+
+    /** See RootParallelMergeInterval() */
+    void SetRootParallelMergeInterval(std::size_t interval);
+
     /** See SetRandomizeRaveFrequency() */
     int RandomizeRaveFrequency() const;
 
@@ -806,6 +1077,13 @@ public:
     /** See SgUctMoveSelect */
     void SetMoveSelect(SgUctMoveSelect moveSelect);
 
+    /** See SgUctTranspositionMode.
+        Default is SG_UCTTRANSPOSITION_NONE. */
+    SgUctTranspositionMode TranspositionMode() const;
+
+    /** See TranspositionMode() */
+    void SetTranspositionMode(SgUctTranspositionMode mode);
+
     /** See @ref sguctsearchweights. */
     float RaveWeightInitial() const;
 
@@ -851,6 +1129,19 @@ public:
     /** See PruneFullTree() */
     void SetPruneFullTree(bool enable);
 
+    /** Prune a full tree in-place.
+        If true, PruneFullTree() removes the subtrees of low count nodes from
+        the search tree and reuses their nodes for new nodes (see
+        SgUctTree::PruneLowCount()), instead of creating a pruned copy in the
+        temporary tree. This avoids copying the nodes that are kept and does
+        not need the memory for the temporary tree. It also reclaims the
+        nodes discarded by ReRootTree().
+        Default is false. */
+    bool PruneInPlace() const;
+
+    /** See PruneInPlace() */
+    void SetPruneInPlace(bool enable);
+
     /** See PruneFullTree() */
     SgUctValue PruneMinCount() const;
 
@@ -877,9 +1168,18 @@ public:
     /** @name Statistics */
     // @{
 
+    /** Merge the time profiles of the phases of the games of all threads.
+        Can be called during a search. The profile is empty, if not compiled
+        with SG_UCT_PROFILE.
+        @param[out] profile The merged profile */
+    void GetProfile(SgUctProfile& profile) const;
+
     const SgUctSearchStat& Statistics() const;
 
-    void WriteStatistics(std::ostream& out) const;
+    /** Write the statistics of the last search.
+        Includes the time profile, if compiled with SG_UCT_PROFILE.
+        Subclasses can extend it to write their own statistics. */
+    virtual void WriteStatistics(std::ostream& out) const;
 
     // @} // name
 
@@ -976,6 +1276,16 @@ private:
     
     unsigned int m_maxKnowledgeThreads;
 
+    /** See KnowledgeBatchSize() */
+    std::size_t m_knowledgeBatchSize;
+
+    /** Nodes waiting for a thread to compute their knowledge.
+        See KnowledgeBatchSize() */
+    std::vector<SgUctPendingKnowledge> m_pendingKnowledge;
+
+    /** Mutex for m_pendingKnowledge. */
+    boost::mutex m_pendingKnowledgeMutex;
+
     /** Flag indicating that the search was terminated because the maximum
         time or number of games was reached. */
     volatile bool m_aborted;
@@ -994,6 +1304,13 @@ private:
     /** See SgUctMoveSelect */
     SgUctMoveSelect m_moveSelect;
 
+    /** See TranspositionMode() */
+    SgUctTranspositionMode m_transpositionMode;
+
+    /** Keep the search tree in the next search.
+        See ReRootTree() and UseTree() */
+    bool m_keepTree;
+
     /** See RaveCheckSame() */
     bool m_raveCheckSame;
 
@@ -1009,12 +1326,24 @@ private:
     /** See PruneFullTree() */
     bool m_pruneFullTree;
 
+    /** See PruneInPlace() */
+    bool m_pruneInPlace;
+
     /** See CheckFloatPrecision() */
     bool m_checkFloatPrecision;
 
     /** See NumberThreads() */
     unsigned int m_numberThreads;
 
+    /** See PinThreads() */
+    bool m_pinThreads;
+
+    /** See RootParallel() */
+    bool m_rootParallel;
+
+    /** See RootParallelMergeInterval() */
+    std::size_t m_rootParallelMergeInterval;
+
     /** See NumberPlayouts() */
     std::size_t m_numberPlayouts;
     
@@ -1091,6 +1420,29 @@ private:
     /** See GetTempTree() */
     SgUctTree m_tempTree;
 
+    /** Trees of the threads in root-parallel mode.
+        Element i is the tree of thread i, apart from element 0, which is
+        not used (thread 0 uses m_tree). Empty if the search does not run in
+        root-parallel mode or with only one thread.
+        See RootParallel() */
+    std::vector<boost::shared_ptr<SgUctTree> > m_rootParallelTrees;
+
+    /** Merged statistics of the root at the last merge.
+        See RootParallel() */
+    SgUctMergedValue m_mergedRoot;
+
+    /** Merged position count of the root at the last merge. */
+    SgUctValue m_mergedRootPosCount;
+
+    /** Merged statistics of the children of the root at the last merge. */
+    std::vector<SgUctMergedValue> m_mergedChildren;
+
+    /** Mutex for merging the root-parallel trees during the search. */
+    boost::mutex m_rootParallelMutex;
+
+    /** See TranspositionMode() */
+    SgUctTranspositionTable m_transpositionTable;
+
     /** See parameter rootFilter in function Search() */
     std::vector<SgMove> m_rootFilter;
 
@@ -1117,7 +1469,11 @@ private:
 
     void ApplyRootFilter(std::vector<SgUctMoveInfo>& moves);
 
-    void PropagateProvenStatus(const std::vector<const SgUctNode*>& nodes);
+    void PropagateProvenStatus(SgUctTree& tree,
+                               const std::vector<const SgUctNode*>& nodes);
+
+    /** Allocator used by a thread in ThreadTree(). */
+    std::size_t AllocatorId(const SgUctThreadState& state) const;
 
     bool CheckAbortSearch(SgUctThreadState& state);
 
@@ -1128,6 +1484,8 @@ private:
 
     void Debug(const SgUctThreadState& state, const std::string& textLine);
 
+    void CreateRootParallelTrees();
+
     void DeleteThreads();
 
     void ExpandNode(SgUctThreadState& state, const SgUctNode& node);
@@ -1145,7 +1503,33 @@ private:
 
     SgUctValue Log(SgUctValue x) const;
 
-    bool NeedToComputeKnowledge(const SgUctNode* current);
+    /** Merge the statistics of the root and its children of the
+        root-parallel trees and write them back to all trees.
+        The merged value of a node is its value at the last merge plus the
+        results that each tree added since then. A tree that was not part of
+        the last merge adds all its results. Trees with an unexpanded root
+        are skipped. Requires that m_rootParallelMutex is locked or that no
+        search thread is running.
+        See RootParallel() */
+    void MergeRootParallelTrees();
+
+    bool NeedToComputeKnowledge(SgUctTree& tree, const SgUctNode* current);
+
+    /** Add a node to the knowledge queue.
+        See KnowledgeBatchSize() */
+    void AddPendingKnowledge(SgUctThreadState& state, const SgUctNode& node);
+
+    /** Compute the knowledge for the nodes in the thread's batch.
+        Requires that the thread state is in the root position. */
+    void ComputeKnowledgeBatch(SgUctThreadState& state);
+
+    /** Compute the knowledge for all nodes in the queue.
+        Must only be called if no search thread is running. */
+    void FlushPendingKnowledge();
+
+    /** Pin the calling thread and touch the memory of its allocators.
+        See PinThreads() */
+    void PinThread(const SgUctThreadState& state);
 
     void PlayGame(SgUctThreadState& state, GlobalLock* lock);
 
@@ -1154,13 +1538,28 @@ private:
     bool PlayoutGame(SgUctThreadState& state, std::size_t playout);
 
     void PrintSearchProgress(double currTime) const;
+
+    /** Prune nodes with low count from a tree.
+        @return The number of nodes after pruning. */
+    std::size_t PruneTree(SgUctTree& tree, SgUctValue minCount,
+                          bool inPlace);
     
     void SearchLoop(SgUctThreadState& state, GlobalLock* lock);
 
-    const SgUctNode& SelectChild(int& randomizeCounter, bool useBiasTerm, const SgUctNode& node);
+    const SgUctNode& SelectChild(const SgUctTree& tree, int& randomizeCounter,
+                                 bool useBiasTerm, const SgUctNode& node);
 
     std::string SummaryLine(const SgUctGameInfo& info) const;
 
+    void ShareTransposition(SgUctThreadState& state, const SgUctNode& node);
+
+    /** The tree, in which a thread searches.
+        See RootParallel() */
+    SgUctTree& ThreadTree(const SgUctThreadState& state);
+
+    void UpdateTranspositionValues(SgUctTree& tree, const SgUctGameInfo& info,
+                                   SgUctValue eval, SgUctValue count);
+
     void UpdateCheckTimeInterval(double time);
 
     void UpdateDynRaveBias();
@@ -1176,7 +1575,7 @@ private:
 
     void UpdateStatistics(const SgUctGameInfo& info);
 
-    void UpdateTree(const SgUctGameInfo& info);
+    void UpdateTree(SgUctTree& tree, const SgUctGameInfo& info);
 };
 
 inline SgAdditiveKnowledge& SgUctSearch::AdditiveKnowledge()
@@ -1290,6 +1689,11 @@ inline std::size_t SgUctSearch::NumberPlayouts() const
     return m_numberPlayouts;
 }
 
+inline SgUctTranspositionMode SgUctSearch::TranspositionMode() const
+{
+    return m_transpositionMode;
+}
+
 inline bool SgUctSearch::UpdateMultiplePlayoutsAsSingle() const
 {
 	return m_updateMultiplePlayoutsAsSingle;
@@ -1305,6 +1709,24 @@ inline bool SgUctSearch::PruneFullTree() const
     return m_pruneFullTree;
 }
 
+inline bool SgUctSearch::PinThreads() const
+{
+    return m_pinThreads;
+}
+
+inline std::size_t SgUctSearch::AllocatorId(const SgUctThreadState& state)
+    const
+{
+    // A thread has its own allocator in the shared tree and uses the only
+    // allocator of its tree in root-parallel mode
+    return m_rootParallelTrees.empty() ? state.m_threadId : 0;
+}
+
+inline bool SgUctSearch::PruneInPlace() const
+{
+    return m_pruneInPlace;
+}
+
 inline SgUctValue SgUctSearch::PruneMinCount() const
 {
     return m_pruneMinCount;
@@ -1370,7 +1792,10 @@ inline void SgUctSearch::SetMaxNodes(std::size_t maxNodes)
 {
     m_maxNodes = maxNodes;
     if (m_threads.size() > 0) // Threads already created
+    {
         m_tree.SetMaxNodes(m_maxNodes);
+        CreateRootParallelTrees();
+    }
 }
 
 inline void SgUctSearch::SetMoveSelect(SgUctMoveSelect moveSelect)
@@ -1378,6 +1803,11 @@ inline void SgUctSearch::SetMoveSelect(SgUctMoveSelect moveSelect)
     m_moveSelect = moveSelect;
 }
 
+inline void SgUctSearch::SetTranspositionMode(SgUctTranspositionMode mode)
+{
+    m_transpositionMode = mode;
+}
+
 inline std::vector<SgUctValue> SgUctSearch::KnowledgeThreshold() const
 {
     return m_knowledgeThreshold;
@@ -1389,6 +1819,16 @@ SgUctSearch::SetKnowledgeThreshold(const std::vector<SgUctValue>& t)
     m_knowledgeThreshold = t;
 }
 
+inline std::size_t SgUctSearch::KnowledgeBatchSize() const
+{
+    return m_knowledgeBatchSize;
+}
+
+inline void SgUctSearch::SetKnowledgeBatchSize(std::size_t size)
+{
+    m_knowledgeBatchSize = size;
+}
+
 inline unsigned int SgUctSearch::MaxKnowledgeThreads() const
 {
     return m_maxKnowledgeThreads;
@@ -1416,6 +1856,11 @@ inline void SgUctSearch::SetPruneFullTree(bool enable)
     m_pruneFullTree = enable;
 }
 
+inline void SgUctSearch::SetPruneInPlace(bool enable)
+{
+    m_pruneInPlace = enable;
+}
+
 inline void SgUctSearch::SetPruneMinCount(SgUctValue n)
 {
     m_pruneMinCount = n;
@@ -1493,11 +1938,38 @@ inline SgUctThreadState& SgUctSearch::ThreadState(int i) const
     return *m_threads[i]->m_state;
 }
 
+inline bool SgUctSearch::RootParallel() const
+{
+    return m_rootParallel;
+}
+
+inline std::size_t SgUctSearch::RootParallelMergeInterval() const
+{
+    return m_rootParallelMergeInterval;
+}
+
+inline void SgUctSearch::SetRootParallelMergeInterval(std::size_t interval)
+{
+    m_rootParallelMergeInterval = interval;
+}
+
+inline SgUctTree& SgUctSearch::ThreadTree(const SgUctThreadState& state)
+{
+    if (m_rootParallelTrees.empty() || state.m_threadId == 0)
+        return m_tree;
+    return *m_rootParallelTrees[state.m_threadId];
+}
+
 inline const SgUctTree& SgUctSearch::Tree() const
 {
     return m_tree;
 }
 
+inline SgUctTree& SgUctSearch::Tree()
+{
+    return m_tree;
+}
+
 inline bool SgUctSearch::WasEarlyAbort() const
 {
     return m_wasEarlyAbort;
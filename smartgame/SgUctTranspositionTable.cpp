@@ -0,0 +1,90 @@
+//----------------------------------------------------------------------------
+/** @file SgUctTranspositionTable.cpp */
+//----------------------------------------------------------------------------
+
+#include "SgSystem.h"
+#include "SgUctTranspositionTable.h"
+
+#include "SgUctTree.h"
+
+using namespace std;
+
+//----------------------------------------------------------------------------
+
+SgUctTranspositionTable::SgUctTranspositionTable()
+    : m_mutexes(new boost::mutex[NU_MUTEXES])
+{ }
+
+void SgUctTranspositionTable::Clear()
+{
+    for (vector<Entry>::iterator it = m_entries.begin();
+         it != m_entries.end(); ++it)
+        it->m_node = 0;
+}
+
+bool SgUctTranspositionTable::AddGameResults(const SgHashCode& hashCode,
+                                             size_t depth, SgUctValue eval,
+                                             SgUctValue count,
+                                             SgUctStatistics& value)
+{
+    if (m_entries.empty())
+        return false;
+    const size_t index = Index(hashCode);
+    boost::mutex::scoped_lock lock(Mutex(index));
+    Entry& entry = m_entries[index];
+    if (  entry.m_node == 0
+       || entry.m_depth != depth
+       || entry.m_hashCode != hashCode
+       )
+        return false;
+    entry.m_value.Add(eval, count);
+    value = entry.m_value;
+    return true;
+}
+
+size_t SgUctTranspositionTable::Index(const SgHashCode& hashCode) const
+{
+    SG_ASSERT(! m_entries.empty());
+    return hashCode.Hash(static_cast<int>(m_entries.size()));
+}
+
+const SgUctNode* SgUctTranspositionTable::Lookup(const SgHashCode& hashCode,
+                                                 size_t depth,
+                                                 const SgUctNode& node)
+{
+    if (m_entries.empty())
+        return &node;
+    const size_t index = Index(hashCode);
+    boost::mutex::scoped_lock lock(Mutex(index));
+    Entry& entry = m_entries[index];
+    if (  entry.m_node != 0
+       && entry.m_depth == depth
+       && entry.m_hashCode == hashCode
+       )
+    {
+        if (! entry.m_node->HasChildren() && node.HasChildren())
+            entry.m_node = &node;
+        return entry.m_node;
+    }
+    entry.m_hashCode = hashCode;
+    entry.m_depth = depth;
+    entry.m_node = &node;
+    entry.m_value.Clear();
+    if (node.HasMean())
+        entry.m_value.Initialize(node.Mean(), node.MoveCount());
+    return &node;
+}
+
+boost::mutex& SgUctTranspositionTable::Mutex(size_t index)
+{
+    return m_mutexes[index % NU_MUTEXES];
+}
+
+void SgUctTranspositionTable::SetMaxEntries(size_t maxEntries)
+{
+    m_entries.clear();
+    m_entries.resize(maxEntries);
+    Clear();
+}
+
+//----------------------------------------------------------------------------
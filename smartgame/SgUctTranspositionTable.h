@@ -0,0 +1,111 @@
+//----------------------------------------------------------------------------
+/** @file SgUctTranspositionTable.h
+    Index of positions in SgUctTree for the transposition modes of
+    SgUctSearch. */
+//----------------------------------------------------------------------------
+
+#ifndef SG_UCTTRANSPOSITIONTABLE_H
+#define SG_UCTTRANSPOSITIONTABLE_H
+
+#include <cstddef>
+#include <vector>
+#include <boost/scoped_array.hpp>
+#include <boost/thread/mutex.hpp>
+#include "SgHash.h"
+#include "SgUctValue.h"
+
+class SgUctNode;
+
+//----------------------------------------------------------------------------
+
+/** Hash index from positions to nodes of a SgUctTree.
+    Used by SgUctSearch if a transposition mode is enabled (see
+    SgUctTranspositionMode). Each entry stores the representative node of a
+    position, i.e. a node whose children are shared with all other nodes
+    that correspond to the same position, and the statistics of the position
+    accumulated over all paths to it.
+    The key is the hash code of the position (including the color to play)
+    and the number of moves from the root. Only nodes with the same depth are
+    merged, this guarantees that the tree with shared children remains an
+    acyclic graph.
+    The table has a fixed size and always replaces an entry with a
+    different key. It is thread-safe; the entries are protected by a fixed
+    number of mutexes (lock striping), so that threads rarely block each
+    other.
+    @ingroup sguctgroup */
+class SgUctTranspositionTable
+{
+public:
+    SgUctTranspositionTable();
+
+    /** Remove all entries.
+        Must be called, if the nodes of the tree are no longer valid. */
+    void Clear();
+
+    std::size_t MaxEntries() const;
+
+    /** Resize the table.
+        Also clears the table. */
+    void SetMaxEntries(std::size_t maxEntries);
+
+    /** Look up the representative node of a position.
+        If the position is not in the table, @c node becomes its
+        representative node. If the stored representative node has no
+        children, but @c node has, @c node replaces it.
+        @param hashCode The hash code of the position.
+        @param depth The number of moves from the root.
+        @param node The node of the position in the current game.
+        @return The representative node. */
+    const SgUctNode* Lookup(const SgHashCode& hashCode, std::size_t depth,
+                            const SgUctNode& node);
+
+    /** Add a game result to the statistics of a position.
+        @param hashCode
+        @param depth
+        @param eval The game result from the view of the node.
+        @param count The number of times the result is added.
+        @param[out] value The statistics of the position after the update.
+        @return @c false, if the position is no longer in the table. */
+    bool AddGameResults(const SgHashCode& hashCode, std::size_t depth,
+                        SgUctValue eval, SgUctValue count,
+                        SgUctStatistics& value);
+
+private:
+    struct Entry
+    {
+        SgHashCode m_hashCode;
+
+        std::size_t m_depth;
+
+        /** Representative node or null, if the entry is not used. */
+        const SgUctNode* m_node;
+
+        /** Statistics of the position over all paths to it. */
+        SgUctStatistics m_value;
+    };
+
+    static const std::size_t NU_MUTEXES = 1024;
+
+    std::vector<Entry> m_entries;
+
+    boost::scoped_array<boost::mutex> m_mutexes;
+
+    std::size_t Index(const SgHashCode& hashCode) const;
+
+    boost::mutex& Mutex(std::size_t index);
+
+    /** Not implemented. */
+    SgUctTranspositionTable(const SgUctTranspositionTable&);
+
+    /** Not implemented. */
+    SgUctTranspositionTable& operator=(const SgUctTranspositionTable&);
+};
+
+inline std::size_t SgUctTranspositionTable::MaxEntries() const
+{
+    return m_entries.size();
+}
+
+//----------------------------------------------------------------------------
+
+#endif // SG_UCTTRANSPOSITIONTABLE_H
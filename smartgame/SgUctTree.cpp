@@ -6,6 +6,7 @@
 #include "SgSystem.h"
 #include "SgUctTree.h"
 
+#include <algorithm>
 #include <boost/format.hpp>
 #include "SgDebug.h"
 #include "SgTimer.h"
@@ -29,11 +30,57 @@ bool SgUctAllocator::Contains(const SgUctNode& node) const
     return (&node >= m_start && &node < m_finish);
 }
 
+void SgUctAllocator::Release(SgUctNode* node, std::size_t n)
+{
+    if (n == 0)
+        return;
+    SG_ASSERT(Contains(*node));
+    SG_ASSERT(Contains(node[n - 1]));
+    m_released.insert(std::make_pair(n, node));
+    m_nuReleased += n;
+}
+
+void SgUctAllocator::ReleaseUnused(const std::vector<std::pair<
+                                   const SgUctNode*,std::size_t> >& usedBlocks)
+{
+    m_released.clear();
+    m_nuReleased = 0;
+    SgUctNode* unused = m_start;
+    for (std::vector<std::pair<const SgUctNode*,size_t> >::const_iterator
+             it = usedBlocks.begin(); it != usedBlocks.end(); ++it)
+    {
+        SgUctNode* node = const_cast<SgUctNode*>(it->first);
+        SG_ASSERT(Contains(*node));
+        SG_ASSERT(node >= unused);
+        Release(unused, node - unused);
+        unused = node + it->second;
+    }
+    // Give unused nodes at the end back to the storage
+    for (SgUctNode* it = unused; it != m_finish; ++it)
+        it->~SgUctNode();
+    m_finish = unused;
+}
+
+void SgUctAllocator::TouchMemory()
+{
+    // Smallest page size of supported platforms
+    const std::size_t pageSize = 4096;
+    volatile char* begin =
+        reinterpret_cast<char*>(std::max(m_touched, m_finish));
+    volatile char* end = reinterpret_cast<char*>(m_endOfStorage);
+    for (volatile char* p = begin; p < end; p += pageSize)
+        *p = 0;
+    m_touched = m_endOfStorage;
+}
+
 void SgUctAllocator::Swap(SgUctAllocator& allocator)
 {
     std::swap(m_start, allocator.m_start);
     std::swap(m_finish, allocator.m_finish);
     std::swap(m_endOfStorage, allocator.m_endOfStorage);
+    std::swap(m_touched, allocator.m_touched);
+    m_released.swap(allocator.m_released);
+    std::swap(m_nuReleased, allocator.m_nuReleased);
 }
 
 void SgUctAllocator::SetMaxNodes(std::size_t maxNodes)
@@ -49,6 +96,9 @@ void SgUctAllocator::SetMaxNodes(std::size_t maxNodes)
     m_start = static_cast<SgUctNode*>(ptr);
     m_finish = m_start;
     m_endOfStorage = m_start + maxNodes;
+    m_touched = m_start;
+    m_released.clear();
+    m_nuReleased = 0;
 }
 
 //----------------------------------------------------------------------------
@@ -124,23 +174,27 @@ void SgUctTree::ApplyFilter(std::size_t allocatorId,
     if (! node.HasChildren())
         return;
 
+    int nuChildren = 0;
+    for (SgUctChildIterator it(*this, node); it; ++it)
+        if (find(rootFilter.begin(), rootFilter.end(), (*it).Move())
+            == rootFilter.end())
+            ++nuChildren;
     SgUctAllocator& allocator = Allocator(allocatorId);
-    const SgUctNode* firstChild = allocator.Finish();
+    SgUctNode* firstChild = allocator.CreateN(nuChildren);
 
-    int nuChildren = 0;
+    SgUctNode* child = firstChild;
     for (SgUctChildIterator it(*this, node); it; ++it)
     {
         SgMove move = (*it).Move();
         if (find(rootFilter.begin(), rootFilter.end(), move)
             == rootFilter.end())
         {
-            SgUctNode* child = allocator.CreateOne(move);
             child->CopyDataFrom(*it);
             int childNuChildren = (*it).NuChildren();
             child->SetNuChildren(childNuChildren);
             if (childNuChildren > 0)
                 child->SetFirstChild((*it).FirstChild());
-            ++nuChildren;
+            ++child;
         }
     }
 
@@ -161,11 +215,12 @@ void SgUctTree::SetChildren(std::size_t allocatorId, const SgUctNode& node,
     SG_ASSERT(node.HasChildren());
 
     SgUctAllocator& allocator = Allocator(allocatorId);
-    const SgUctNode* firstChild = allocator.Finish();
+    SgUctNode* firstChild = allocator.CreateN(moves.size());
 
     int nuChildren = 0;
     for (size_t i = 0; i < moves.size(); ++i)
     {
+        SgUctNode* child = firstChild + i;
         bool found = false;
         for (SgUctChildIterator it(*this, node); it; ++it)
         {
@@ -173,7 +228,6 @@ void SgUctTree::SetChildren(std::size_t allocatorId, const SgUctNode& node,
             if (move == moves[i])
             {
                 found = true;
-                SgUctNode* child = allocator.CreateOne(move);
                 child->CopyDataFrom(*it);
                 int childNuChildren = (*it).NuChildren();
                 child->SetNuChildren(childNuChildren);
@@ -185,7 +239,7 @@ void SgUctTree::SetChildren(std::size_t allocatorId, const SgUctNode& node,
         }
         if (! found)
         {
-            allocator.CreateOne(moves[i]);
+            child->CopyDataFrom(SgUctNode(moves[i]));
             ++nuChildren;
         }
     }
@@ -312,13 +366,11 @@ SgUctProvenType SgUctTree::CopySubtree(SgUctTree& target, SgUctNode& targetNode,
         return SG_NOT_PROVEN;
     }
 
-    SgUctNode* firstTargetChild = targetAllocator.Finish();
+    // Create target nodes first (must be contiguous in the target tree)
+    SgUctNode* firstTargetChild = targetAllocator.CreateN(nuChildren);
     targetNode.SetFirstChild(firstTargetChild);
     targetNode.SetNuChildren(nuChildren);
 
-    // Create target nodes first (must be contiguous in the target tree)
-    targetAllocator.CreateN(nuChildren);
-
     // Recurse
     SgUctProvenType childProvenType;
     SgUctProvenType parentProvenType = SG_PROVEN_LOSS;
@@ -380,6 +432,32 @@ void SgUctTree::ExtractSubtree(SgUctTree& target, const SgUctNode& node,
     SgSynchronizeThreadMemory();
 }
 
+void SgUctTree::AddKnowledge(const SgUctNode& node,
+                             const std::vector<SgUctMoveInfo>& moves)
+{
+    SG_ASSERT(Contains(node));
+    SgUctValue count = 0;
+    std::size_t i = 0;
+    for (SgUctChildIterator it(*this, node); it; ++it, ++i)
+    {
+        SgUctNode& child = const_cast<SgUctNode&>(*it);
+        // Moves are usually in the same order as the children
+        if (i >= moves.size() || moves[i].m_move != child.Move())
+            for (i = 0; i < moves.size(); ++i)
+                if (moves[i].m_move == child.Move())
+                    break;
+        if (i == moves.size())
+        {
+            i = 0;
+            continue;
+        }
+        child.MergeResults(SgUctNode(moves[i]));
+        child.SetPredictorValue(moves[i].m_predictorValue);
+        count += moves[i].m_count;
+    }
+    const_cast<SgUctNode&>(node).IncPosCount(count);
+}
+
 void SgUctTree::MergeChildren(std::size_t allocatorId, const SgUctNode& node,
                               const std::vector<SgUctMoveInfo>& moves,
                               bool deleteChildTrees)
@@ -403,8 +481,8 @@ void SgUctTree::MergeChildren(std::size_t allocatorId, const SgUctNode& node,
     SgUctAllocator& allocator = Allocator(allocatorId);
     SG_ASSERT(allocator.HasCapacity(nuNewChildren));
 
-    const SgUctNode* newFirstChild = allocator.Finish();
-    SgUctValue parentCount = allocator.Create(moves);
+    const SgUctNode* newFirstChild;
+    SgUctValue parentCount = allocator.Create(moves, newFirstChild);
     
     // Update new children with data in old children
     for (std::size_t i = 0; i < moves.size(); ++i) 
@@ -476,6 +554,76 @@ void SgUctTree::SetMaxNodes(std::size_t maxNodes)
         Allocator(i).SetMaxNodes(maxNodesPerAlloc);
 }
 
+std::size_t SgUctTree::PruneLowCount(SgUctValue minCount)
+{
+    typedef std::vector<std::pair<const SgUctNode*,size_t> > BlockList;
+    BlockList blocks;
+    PruneSubtree(m_root, minCount, blocks);
+    // Children can be shared between nodes (see ShareChildren())
+    std::sort(blocks.begin(), blocks.end());
+    blocks.erase(std::unique(blocks.begin(), blocks.end()), blocks.end());
+    BlockList allocatorBlocks;
+    for (size_t i = 0; i < NuAllocators(); ++i)
+    {
+        allocatorBlocks.clear();
+        for (BlockList::const_iterator it = blocks.begin();
+             it != blocks.end(); ++it)
+            if (Allocator(i).Contains(*it->first))
+                allocatorBlocks.push_back(*it);
+        Allocator(i).ReleaseUnused(allocatorBlocks);
+    }
+    SgSynchronizeThreadMemory();
+    return NuNodes();
+}
+
+/** Recursive function used by SgUctTree::PruneLowCount.
+    Updates the proven types like CopySubtree() with alwaysKeepProven false.
+    @param node The node to prune the children of.
+    @param minCount See PruneLowCount()
+    @param[out] blocks The children blocks that are kept
+    @return The proven type of the node */
+SgUctProvenType SgUctTree::PruneSubtree(const SgUctNode& node,
+                                        SgUctValue minCount,
+                                        std::vector<std::pair<const SgUctNode*,
+                                                     std::size_t> >& blocks)
+{
+    if (! node.HasChildren())
+        return node.ProvenType();
+    SgUctNode& nonConstNode = const_cast<SgUctNode&>(node);
+    if (node.MoveCount() < minCount)
+    {
+        nonConstNode.SetNuChildren(0);
+        nonConstNode.SetProvenType(SG_NOT_PROVEN);
+        return SG_NOT_PROVEN;
+    }
+    blocks.push_back(std::make_pair(node.FirstChild(),
+                                    size_t(node.NuChildren())));
+    SgUctProvenType parentProvenType = SG_PROVEN_LOSS;
+    for (SgUctChildIterator it(*this, node); it; ++it)
+    {
+        SgUctProvenType childProvenType = PruneSubtree(*it, minCount, blocks);
+        if (childProvenType == SG_PROVEN_LOSS)
+            parentProvenType = SG_PROVEN_WIN;
+        else if (  parentProvenType != SG_PROVEN_WIN
+                && childProvenType == SG_NOT_PROVEN)
+            parentProvenType = SG_NOT_PROVEN;
+    }
+    nonConstNode.SetProvenType(parentProvenType);
+    return parentProvenType;
+}
+
+void SgUctTree::ReRoot(const SgUctNode& node)
+{
+    SG_ASSERT(Contains(node));
+    if (&node == &m_root)
+        return;
+    const int nuChildren = node.NuChildren();
+    const SgUctNode* firstChild = (nuChildren > 0 ? node.FirstChild() : 0);
+    m_root.CopyDataFrom(node);
+    m_root.SetFirstChild(firstChild);
+    m_root.SetNuChildren(nuChildren);
+}
+
 void SgUctTree::Swap(SgUctTree& tree)
 {
     SG_ASSERT(MaxNodes() == tree.MaxNodes());
@@ -8,6 +8,7 @@
 
 #include <iostream>
 #include <limits>
+#include <map>
 #include <stack>
 #include <boost/shared_ptr.hpp>
 #include "SgMove.h"
@@ -135,6 +136,9 @@ std::ostream& operator<<(std::ostream& stream, const SgUctProvenType& type);
     relies on the fact that m_firstChild is valid, if m_nuChildren is greater
     zero or that the mean value of the move and RAVE value statistics is valid
     if the corresponding count is greater zero.
+    If SG_UCT_ATOMIC is defined, the move and RAVE statistics, the position
+    count and the virtual loss count use atomic updates instead (see
+    @ref sguctsearchlockfreeatomic).
     @ingroup sguctgroup */
 class SgUctNode
 {
@@ -254,6 +258,9 @@ public:
 
 	float PredictorValue() const;
 
+    /** See PredictorValue() */
+    void SetPredictorValue(float value);
+
     int VirtualLossCount() const;
 
     void AddVirtualLoss();
@@ -278,29 +285,59 @@ public:
     void SetProvenType(SgUctProvenType type);
 
 private:
-    SgUctStatisticsVolatile m_statistics;
+#ifdef SG_UCT_ATOMIC
+    typedef SgUctStatisticsAtomic Statistics;
 
-    const SgUctNode* volatile m_firstChild;
+    typedef SgAtomicValue<SgUctValue> Count;
 
-    volatile int m_nuChildren;
+    typedef SgAtomicValue<int> LossCount;
+#else
+    typedef SgUctStatisticsVolatile Statistics;
 
-    volatile SgMove m_move;
+    typedef volatile SgUctValue Count;
 
-    /* Value of additive predictor */
-    volatile float m_predictorValue;
+    typedef volatile int LossCount;
+#endif
+
+    /** @name Hot data
+        Members read by SgUctSearch::SelectChild() for every child. They are
+        stored in a contiguous block at the beginning of the node, so that
+        the loop over the children touches as few cache lines as possible.
+        Keep the order: the block ends after m_provenType. */
+    // @{
+
+    Statistics m_statistics;
 
     /** RAVE statistics.
         Uses double for count to allow adding fractional values if RAVE
         updates are weighted. */
-    SgUctStatisticsVolatile m_raveValue;
+    Statistics m_raveValue;
 
-    volatile SgUctValue m_posCount;
+    LossCount m_virtualLossCount;
 
-    volatile SgUctValue m_knowledgeCount;
+    /* Value of additive predictor */
+    volatile float m_predictorValue;
+
+    volatile SgMove m_move;
 
     volatile SgUctProvenType m_provenType;
 
-    volatile int m_virtualLossCount;
+    // @} // @name
+
+    /** @name Cold data
+        Members only used for the node that is expanded or updated, not for
+        each child during the selection. */
+    // @{
+
+    Count m_posCount;
+
+    volatile SgUctValue m_knowledgeCount;
+
+    const SgUctNode* volatile m_firstChild;
+
+    volatile int m_nuChildren;
+
+    // @} // @name
 };
 
 //----------------------------------------------------------------------------
@@ -310,14 +347,14 @@ std::ostream& operator<<(std::ostream& stream, const SgUctNode& node);
 //----------------------------------------------------------------------------
 inline SgUctNode::SgUctNode(const SgUctMoveInfo& info)
     : m_statistics(info.m_value, info.m_count),
-      m_nuChildren(0),
-      m_move(info.m_move),
-      m_predictorValue(info.m_predictorValue),
       m_raveValue(info.m_raveValue, info.m_raveCount),
+      m_virtualLossCount(0),
+      m_predictorValue(info.m_predictorValue),
+      m_move(info.m_move),
+      m_provenType(SG_NOT_PROVEN),
       m_posCount(0),
       m_knowledgeCount(0),
-      m_provenType(SG_NOT_PROVEN),
-      m_virtualLossCount(0)
+      m_nuChildren(0)
 {
     // m_firstChild is not initialized, only defined if m_nuChildren > 0
 }
@@ -505,6 +542,11 @@ inline float SgUctNode::PredictorValue() const
     return m_predictorValue;
 }
 
+inline void SgUctNode::SetPredictorValue(float value)
+{
+    m_predictorValue = value;
+}
+
 inline SgUctValue SgUctNode::RaveCount() const
 {
     return m_raveValue.Count();
@@ -581,11 +623,17 @@ public:
 
     void Clear();
 
-    /** Does the allocator have the capacity for n more nodes? */
+    /** Does the allocator have the capacity for n more nodes?
+        Released blocks (see ReleaseUnused()) with at least n nodes count as
+        capacity. */
     bool HasCapacity(std::size_t n) const;
 
+    /** Number of nodes in use (not counting released nodes). */
     std::size_t NuNodes() const;
 
+    /** Number of nodes in released blocks waiting for reuse. */
+    std::size_t NuReleasedNodes() const;
+
     std::size_t MaxNodes() const;
 
     void SetMaxNodes(std::size_t maxNodes);
@@ -604,41 +652,77 @@ public:
 
     const SgUctNode* Finish() const;
 
-    /** Create a new node at the end of the storage.
-        REQUIRES: HasCapacity(1)
-        @param move The constructor argument.
-        @return A pointer to new newly created node. */
-    SgUctNode* CreateOne(SgMove move);
-
-    /** Create a number of new nodes with a given list of moves at the end of
-        the storage. Returns the sum of counts of moves.
+    /** Create a number of contiguous new nodes with a given list of moves.
+        Returns the sum of counts of moves.
         REQUIRES: HasCapacity(moves.size())
-        @param moves The list of moves. */
-    SgUctValue Create(const std::vector<SgUctMoveInfo>& moves);
+        @param moves The list of moves.
+        @param[out] firstNode The first of the new nodes. */
+    SgUctValue Create(const std::vector<SgUctMoveInfo>& moves,
+                      const SgUctNode*& firstNode);
 
-    /** Create a number of new nodes at the end of the storage.
+    /** Create a number of contiguous new nodes.
         REQUIRES: HasCapacity(n)
-        @param n The number of nodes to create. */
-    void CreateN(std::size_t n);
+        @param n The number of nodes to create.
+        @return The first of the new nodes. */
+    SgUctNode* CreateN(std::size_t n);
+
+    /** Release all nodes that are not in a list of used blocks.
+        The released nodes are reused by later calls of Create() or CreateN()
+        if there is no space left at the end of the storage. They use the
+        smallest released block with enough nodes. Must only be called if no
+        thread can access the released nodes anymore.
+        @param usedBlocks The first node and number of nodes of the blocks
+        in this allocator that are still used, sorted by address. */
+    void ReleaseUnused(const std::vector<std::pair<const SgUctNode*,
+                                                   std::size_t> >& usedBlocks);
 
     void Swap(SgUctAllocator& allocator);
 
+    /** Write to the pages of the unused storage.
+        Operating systems with a first-touch policy place a memory page on
+        the NUMA node of the thread that writes to it first. Calling this
+        function from the thread that uses the allocator (see
+        SgUctSearch::PinThreads()) keeps the nodes in local memory, even if
+        they are later created by another thread (e.g. by
+        SgUctTree::CopySubtree()). Only pages that were not written by an
+        earlier call are written. */
+    void TouchMemory();
+
 private:
+    /** Released blocks by their number of nodes. */
+    std::multimap<std::size_t,SgUctNode*> m_released;
+
+    /** See NuReleasedNodes() */
+    std::size_t m_nuReleased;
+
     SgUctNode* m_start;
 
     SgUctNode* m_finish;
 
     SgUctNode* m_endOfStorage;
 
+    /** End of the storage written by TouchMemory(). */
+    SgUctNode* m_touched;
+
     /** Not implemented.
         Cannot be copied because array contains pointers to elements.
         Use Swap() instead. */
     SgUctAllocator& operator=(const SgUctAllocator& tree);
+
+    /** Get storage for n nodes.
+        Takes the nodes from the end of the storage, if possible, otherwise
+        from a released block. The caller must construct the nodes.
+        REQUIRES: HasCapacity(n) */
+    SgUctNode* Allocate(std::size_t n);
+
+    void Release(SgUctNode* node, std::size_t n);
 };
 
 inline SgUctAllocator::SgUctAllocator()
+    : m_nuReleased(0)
 {
     m_start = 0;
+    m_touched = 0;
 }
 
 inline void SgUctAllocator::Clear()
@@ -649,35 +733,58 @@ inline void SgUctAllocator::Clear()
             it->~SgUctNode();
         m_finish = m_start;
     }
+    m_released.clear();
+    m_nuReleased = 0;
 }
 
-inline SgUctNode* SgUctAllocator::CreateOne(SgMove move)
+inline SgUctNode* SgUctAllocator::Allocate(std::size_t n)
 {
-    SG_ASSERT(HasCapacity(1));
-    new(m_finish) SgUctNode(move);
-    return (m_finish++);
+    SG_ASSERT(HasCapacity(n));
+    SgUctNode* node = m_finish;
+    if (m_finish + n <= m_endOfStorage)
+        m_finish += n;
+    else
+    {
+        std::multimap<std::size_t,SgUctNode*>::iterator it =
+            m_released.lower_bound(n);
+        SG_ASSERT(it != m_released.end());
+        const std::size_t size = it->first;
+        node = it->second;
+        m_released.erase(it);
+        m_nuReleased -= size;
+        if (size > n)
+            Release(node + n, size - n);
+        // Nodes in released blocks are still constructed
+        for (std::size_t i = 0; i < n; ++i)
+            node[i].~SgUctNode();
+    }
+    return node;
 }
 
 inline SgUctValue SgUctAllocator::Create(
-                                         const std::vector<SgUctMoveInfo>& moves)
+                                         const std::vector<SgUctMoveInfo>& moves,
+                                         const SgUctNode*& firstNode)
 {
     SG_ASSERT(HasCapacity(moves.size()));
+    SgUctNode* node = Allocate(moves.size());
+    firstNode = node;
     SgUctValue count = 0;
     for (std::vector<SgUctMoveInfo>::const_iterator it = moves.begin();
-         it != moves.end(); ++it, ++m_finish)
+         it != moves.end(); ++it, ++node)
     {
-        new(m_finish) SgUctNode(*it);
+        new(node) SgUctNode(*it);
         count += it->m_count;
     }
     return count;
 }
 
-inline void SgUctAllocator::CreateN(std::size_t n)
+inline SgUctNode* SgUctAllocator::CreateN(std::size_t n)
 {
     SG_ASSERT(HasCapacity(n));
-    SgUctNode* newFinish = m_finish + n;
-    for ( ; m_finish != newFinish; ++m_finish)
-        new(m_finish) SgUctNode(SG_NULLMOVE);
+    SgUctNode* firstNode = Allocate(n);
+    for (std::size_t i = 0; i < n; ++i)
+        new(firstNode + i) SgUctNode(SG_NULLMOVE);
+    return firstNode;
 }
 
 inline SgUctNode* SgUctAllocator::Finish()
@@ -692,7 +799,9 @@ inline const SgUctNode* SgUctAllocator::Finish() const
 
 inline bool SgUctAllocator::HasCapacity(std::size_t n) const
 {
-    return (m_finish + n <= m_endOfStorage);
+    return (m_finish + n <= m_endOfStorage
+            || (m_nuReleased >= n && m_released.lower_bound(n)
+                                     != m_released.end()));
 }
 
 inline std::size_t SgUctAllocator::MaxNodes() const
@@ -702,7 +811,12 @@ inline std::size_t SgUctAllocator::MaxNodes() const
 
 inline std::size_t SgUctAllocator::NuNodes() const
 {
-    return m_finish - m_start;
+    return m_finish - m_start - m_nuReleased;
+}
+
+inline std::size_t SgUctAllocator::NuReleasedNodes() const
+{
+    return m_nuReleased;
 }
 
 inline const SgUctNode* SgUctAllocator::Start() const
@@ -793,6 +907,24 @@ public:
     void CreateChildren(std::size_t allocatorId, const SgUctNode& node,
                         const std::vector<SgUctMoveInfo>& moves);
 
+    /** Use the children of another node as children of a node.
+        After this call, both nodes share the same children (and the
+        subtrees below them), so the tree becomes a directed acyclic graph.
+        This is used by the transposition modes of SgUctSearch, if the two
+        nodes correspond to the same position. Like CreateChildren(), the
+        function can be used in lock-free mode.
+        Requires: ! node.HasChildren() && other.HasChildren() */
+    void ShareChildren(const SgUctNode& node, const SgUctNode& other);
+
+    /** Add prior knowledge to the existing children of a node.
+        The values and counts of the move infos are added to the children
+        with the same move, the predictor values are replaced. Unlike
+        MergeChildren(), no new nodes are created, so the function can be
+        used while other threads in lock-free mode access the children.
+        Moves that are not children of the node are ignored. */
+    void AddKnowledge(const SgUctNode& node,
+                      const std::vector<SgUctMoveInfo>& moves);
+
     /** Merge new children with old.
         Requires: Allocator(allocatorId).HasCapacity(moves.size()) */
     void MergeChildren(std::size_t allocatorId, const SgUctNode& node,
@@ -815,6 +947,30 @@ public:
                    double maxTime = std::numeric_limits<double>::max(),
                    SgUctValue minCount = 0) const;
 
+    /** Make a node the new root of the tree.
+        In-place alternative to ExtractSubtree(), which takes constant time
+        independent of the size of the subtree. The data of the node is
+        copied to the root and the children of the node become the children
+        of the root. The nodes that are no longer reachable from the root are
+        not reclaimed until the tree is cleared, copied or pruned (e.g. by
+        CopyPruneLowCount() or PruneLowCount() if the search prunes a full
+        tree), so NuNodes() still counts them.
+        Must not be called during a search.
+        @param node The new root (must be in the tree). */
+    void ReRoot(const SgUctNode& node);
+
+    /** Prune low count nodes in-place.
+        Alternative to CopyPruneLowCount(), which does not need a second tree
+        and does not copy the nodes that are kept. The children of nodes with
+        a count below minCount are removed from the tree. Then all nodes that
+        are no longer reachable from the root are released to the allocators
+        for reuse (see SgUctAllocator::ReleaseUnused()), including nodes that
+        became unreachable before (e.g. by ReRoot() or MergeChildren()).
+        Must not be called during a search.
+        @param minCount The minimum count (SgUctNode::MoveCount())
+        @return The number of nodes in the tree after pruning */
+    std::size_t PruneLowCount(SgUctValue minCount);
+
     /** Get a copy of the tree with low count nodes pruned.
         The tree will be truncated if one of the allocators overflows (can
         happen due to reassigning nodes to different allocators), the given
@@ -833,6 +989,9 @@ public:
 
     std::size_t NuAllocators() const;
 
+    /** See SgUctAllocator::TouchMemory() */
+    void TouchMemory(std::size_t allocatorId);
+
     /** Total number of nodes.
         Includes the sum of nodes in all allocators plus the root node. */
     std::size_t NuNodes() const;
@@ -924,6 +1083,10 @@ private:
                                 bool alwaysKeepProven) const;
 
     void ThrowConsistencyError(const std::string& message) const;
+
+    SgUctProvenType PruneSubtree(const SgUctNode& node, SgUctValue minCount,
+                                 std::vector<std::pair<const SgUctNode*,
+                                                     std::size_t> >& blocks);
 };
 
 inline void SgUctTree::AddGameResult(const SgUctNode& node,
@@ -969,9 +1132,8 @@ inline void SgUctTree::CreateChildren(std::size_t allocatorId,
     // thread)
     SG_ASSERT(NuAllocators() > 1 || ! node.HasChildren());
 
-    const SgUctNode* firstChild = allocator.Finish();
-    
-    SgUctValue parentCount = allocator.Create(moves);
+    const SgUctNode* firstChild;
+    SgUctValue parentCount = allocator.Create(moves, firstChild);
 
     // Write order dependency: SgUctSearch in lock-free mode assumes that
     // m_firstChild is valid if m_nuChildren is greater zero
@@ -982,6 +1144,29 @@ inline void SgUctTree::CreateChildren(std::size_t allocatorId,
     nonConstNode.SetNuChildren(nuChildren);
 }
 
+inline void SgUctTree::ShareChildren(const SgUctNode& node,
+                                     const SgUctNode& other)
+{
+    SG_ASSERT(Contains(node));
+    SG_ASSERT(Contains(other));
+    SG_ASSERT(&node != &other);
+    // Parameters are const-references, because only the tree is allowed
+    // to modify nodes
+    SgUctNode& nonConstNode = const_cast<SgUctNode&>(node);
+    const int nuChildren = other.NuChildren();
+    if (nuChildren == 0)
+        return;
+    const SgUctNode* firstChild = other.FirstChild();
+
+    // Write order dependency: see CreateChildren()
+    nonConstNode.SetPosCount(other.PosCount());
+    nonConstNode.SetKnowledgeCount(other.KnowledgeCount());
+    SgSynchronizeThreadMemory();
+    nonConstNode.SetFirstChild(firstChild);
+    SgSynchronizeThreadMemory();
+    nonConstNode.SetNuChildren(nuChildren);
+}
+
 inline void SgUctTree::RemoveGameResult(const SgUctNode& node,
                                         const SgUctNode* father, SgUctValue eval)
 {
@@ -1080,6 +1265,11 @@ inline std::size_t SgUctTree::NuAllocators() const
     return m_allocators.size();
 }
 
+inline void SgUctTree::TouchMemory(std::size_t allocatorId)
+{
+    Allocator(allocatorId).TouchMemory();
+}
+
 inline std::size_t SgUctTree::NuNodes(std::size_t allocatorId) const
 {
     return Allocator(allocatorId).NuNodes();
@@ -5,11 +5,21 @@
 #include "SgSystem.h"
 #include "SgUctTreeUtil.h"
 
+#include <cstring>
+#include <fstream>
 #include <iomanip>
+#include <boost/cstdint.hpp>
+#include <boost/format.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include "SgException.h"
 #include "SgUctSearch.h"
 #include "SgWrite.h"
 
 using namespace std;
+using boost::int32_t;
+using boost::uint32_t;
+using boost::uint64_t;
 
 //----------------------------------------------------------------------------
 
@@ -75,6 +85,229 @@ std::ostream& operator<<(ostream& out, const SgUctTreeStatistics& stat)
 }
 
 //----------------------------------------------------------------------------
+
+namespace {
+
+const char BINARY_MAGIC[8] = { 'S', 'g', 'U', 'c', 't', 'T', 'r', 'e' };
+
+/** File header of SgUctTreeUtil::SaveBinary.
+    Followed by the info string, padded to a multiple of 8 bytes, and the
+    node records. */
+struct BinaryHeader
+{
+    char m_magic[8];
+
+    uint32_t m_version;
+
+    uint32_t m_infoSize;
+
+    uint64_t m_nuNodes;
+};
+
+/** Node record of SgUctTreeUtil::SaveBinary.
+    Values are stored as double independent of the type of SgUctValue. */
+struct BinaryNode
+{
+    double m_count;
+
+    double m_mean;
+
+    double m_raveCount;
+
+    double m_raveValue;
+
+    double m_posCount;
+
+    double m_knowledgeCount;
+
+    /** Index of first child; only defined if m_nuChildren > 0. */
+    uint64_t m_firstChild;
+
+    int32_t m_move;
+
+    int32_t m_nuChildren;
+
+    float m_predictorValue;
+
+    int32_t m_provenType;
+};
+
+size_t BinaryInfoSize(size_t infoSize)
+{
+    return (infoSize + 7) / 8 * 8;
+}
+
+void WriteBinaryNode(ostream& out, const SgUctNode& node, uint64_t firstChild)
+{
+    BinaryNode record;
+    record.m_count = node.MoveCount();
+    record.m_mean = (node.HasMean() ? node.Mean() : 0);
+    record.m_raveCount = node.RaveCount();
+    record.m_raveValue = (node.HasRaveValue() ? node.RaveValue() : 0);
+    record.m_posCount = node.PosCount();
+    record.m_knowledgeCount = node.KnowledgeCount();
+    record.m_firstChild = firstChild;
+    record.m_move = node.HasMove() ? node.Move() : SG_NULLMOVE;
+    record.m_nuChildren = node.NuChildren();
+    record.m_predictorValue = node.PredictorValue();
+    record.m_provenType = node.ProvenType();
+    out.write(reinterpret_cast<const char*>(&record), sizeof(record));
+}
+
+/** Set the data of a node from a record that is not contained in
+    SgUctMoveInfo. */
+void SetBinaryNodeData(SgUctTree& tree, const SgUctNode& node,
+                       const BinaryNode& record)
+{
+    tree.SetPosCount(node, SgUctValue(record.m_posCount));
+    tree.SetKnowledgeCount(node, SgUctValue(record.m_knowledgeCount));
+    if (  record.m_provenType < SG_NOT_PROVEN
+       || record.m_provenType > SG_PROVEN_LOSS
+       )
+        throw SgException("invalid proven type");
+    tree.SetProvenType(node,
+                       static_cast<SgUctProvenType>(record.m_provenType));
+}
+
+void LoadBinaryNodes(SgUctTree& tree, const BinaryNode* records,
+                     size_t nuNodes)
+{
+    const SgUctNode& root = tree.Root();
+    const BinaryNode& rootRecord = records[0];
+    if (rootRecord.m_count > 0)
+        tree.InitializeValue(root, SgUctValue(rootRecord.m_mean),
+                             SgUctValue(rootRecord.m_count));
+    if (rootRecord.m_raveCount > 0)
+        tree.InitializeRaveValue(root, SgUctValue(rootRecord.m_raveValue),
+                                 SgUctValue(rootRecord.m_raveCount));
+    SetBinaryNodeData(tree, root, rootRecord);
+    vector<const SgUctNode*> nodes(nuNodes, static_cast<SgUctNode*>(0));
+    nodes[0] = &root;
+    size_t allocatorId = 0;
+    vector<SgUctMoveInfo> moves;
+    for (size_t i = 0; i < nuNodes; ++i)
+    {
+        const BinaryNode& record = records[i];
+        if (record.m_nuChildren <= 0)
+            continue;
+        const size_t nuChildren = record.m_nuChildren;
+        const uint64_t firstChild = record.m_firstChild;
+        if (  firstChild <= i
+           || firstChild >= nuNodes
+           || nuChildren > nuNodes - firstChild
+           )
+            throw SgException("invalid child index");
+        // Use allocators uniformly like SgUctTree::CopySubtree()
+        allocatorId = (allocatorId + 1) % tree.NuAllocators();
+        if (! tree.HasCapacity(allocatorId, nuChildren))
+            throw SgException("tree too large");
+        moves.clear();
+        for (size_t j = 0; j < nuChildren; ++j)
+        {
+            const BinaryNode& child = records[firstChild + j];
+            moves.push_back(SgUctMoveInfo(child.m_move,
+                                          SgUctValue(child.m_mean),
+                                          SgUctValue(child.m_count),
+                                          SgUctValue(child.m_raveValue),
+                                          SgUctValue(child.m_raveCount)));
+            moves.back().m_predictorValue = child.m_predictorValue;
+        }
+        tree.CreateChildren(allocatorId, *nodes[i], moves);
+        // CreateChildren() overwrites the position count of the parent
+        SetBinaryNodeData(tree, *nodes[i], record);
+        size_t j = firstChild;
+        for (SgUctChildIterator it(tree, *nodes[i]); it; ++it, ++j)
+        {
+            if (nodes[j] != 0)
+                throw SgException("invalid child index");
+            nodes[j] = &(*it);
+            SetBinaryNodeData(tree, *it, records[j]);
+        }
+    }
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------
+
+void SgUctTreeUtil::LoadBinary(SgUctTree& tree, const std::string& fileName,
+                               std::string& info)
+{
+    using namespace boost::interprocess;
+    tree.Clear();
+    try
+    {
+        file_mapping file(fileName.c_str(), read_only);
+        mapped_region region(file, read_only);
+        const char* data = static_cast<const char*>(region.get_address());
+        const size_t size = region.get_size();
+        BinaryHeader header;
+        if (size < sizeof(header))
+            throw SgException("file too short");
+        memcpy(&header, data, sizeof(header));
+        if (memcmp(header.m_magic, BINARY_MAGIC, sizeof(BINARY_MAGIC)) != 0)
+            throw SgException("not a tree file");
+        if (header.m_version != BINARY_VERSION)
+            throw SgException(str(boost::format("unsupported version %1%")
+                                  % header.m_version));
+        const size_t offset =
+            sizeof(header) + BinaryInfoSize(header.m_infoSize);
+        if (  header.m_nuNodes == 0
+           || offset > size
+           || header.m_nuNodes > (size - offset) / sizeof(BinaryNode)
+           )
+            throw SgException("file too short");
+        info.assign(data + sizeof(header), header.m_infoSize);
+        LoadBinaryNodes(tree,
+                        reinterpret_cast<const BinaryNode*>(data + offset),
+                        size_t(header.m_nuNodes));
+    }
+    catch (const interprocess_exception& e)
+    {
+        throw SgException(fileName + ": " + e.what());
+    }
+    catch (const SgException& e)
+    {
+        tree.Clear();
+        throw SgException(fileName + ": " + e.what());
+    }
+}
+
+void SgUctTreeUtil::SaveBinary(const SgUctTree& tree, const SgUctNode& node,
+                               const std::string& fileName,
+                               const std::string& info)
+{
+    // Breadth-first order; the children of each node are contiguous
+    vector<const SgUctNode*> nodes;
+    nodes.push_back(&node);
+    for (size_t i = 0; i < nodes.size(); ++i)
+        if (nodes[i]->HasChildren())
+            for (SgUctChildIterator it(tree, *nodes[i]); it; ++it)
+                nodes.push_back(&(*it));
+    ofstream out(fileName.c_str(), ios::binary);
+    if (! out)
+        throw SgException("could not create " + fileName);
+    BinaryHeader header;
+    memcpy(header.m_magic, BINARY_MAGIC, sizeof(BINARY_MAGIC));
+    header.m_version = BINARY_VERSION;
+    header.m_infoSize = static_cast<uint32_t>(info.size());
+    header.m_nuNodes = nodes.size();
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out << info;
+    for (size_t i = info.size(); i < BinaryInfoSize(info.size()); ++i)
+        out.put('\0');
+    uint64_t nextChild = 1;
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        WriteBinaryNode(out, *nodes[i], nextChild);
+        nextChild += nodes[i]->NuChildren();
+    }
+    if (! out)
+        throw SgException("error writing " + fileName);
+}
+
+//----------------------------------------------------------------------------
+
 const SgUctNode*
 SgUctTreeUtil::FindMatchingNode(const SgUctTree& tree,
                                 const std::vector<SgMove>& sequence)
@@ -8,6 +8,7 @@
 
 #include <cstddef>
 #include <iosfwd>
+#include <string>
 #include "SgUctValue.h"
 #include "SgStatistics.h"
 
@@ -77,6 +78,36 @@ namespace SgUctTreeUtil
         Return 0 if no node found at any stage */
     const SgUctNode* FindMatchingNode(const SgUctTree& tree,
                                       const std::vector<SgMove>& sequence);
+
+    /** Version of the file format written by SaveBinary(). */
+    const int BINARY_VERSION = 1;
+
+    /** Save a subtree to a file in a compact binary format.
+        The nodes are written in breadth-first order as fixed-size records,
+        so that LoadBinary() can read them from a memory-mapped file without
+        parsing. Children that are shared between nodes (see
+        SgUctTree::ShareChildren()) are written once for each parent.
+        The file uses the byte order of the machine.
+        @param tree The tree.
+        @param node The root of the subtree to save.
+        @param fileName
+        @param info Information about the position of the root, which is
+        written to the file header and returned by LoadBinary().
+        @throws SgException if the file cannot be written. */
+    void SaveBinary(const SgUctTree& tree, const SgUctNode& node,
+                    const std::string& fileName, const std::string& info);
+
+    /** Load a tree saved by SaveBinary().
+        The root of the tree gets the data of the saved root node except the
+        move.
+        @param[out] tree The tree (will be cleared before using it).
+        @param fileName
+        @param[out] info The information saved in the file header.
+        @throws SgException if the file cannot be read, is not a valid file
+        of the current format version, or has more nodes than the tree can
+        store. The tree is cleared in this case. */
+    void LoadBinary(SgUctTree& tree, const std::string& fileName,
+                    std::string& info);
 } // namespace SgUctTreeUtil
 
 //----------------------------------------------------------------------------
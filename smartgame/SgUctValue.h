@@ -11,6 +11,9 @@
 #include <boost/static_assert.hpp>
 #include "SgStatistics.h"
 #include "SgStatisticsVlt.h"
+#ifdef SG_UCT_ATOMIC
+#include "SgStatisticsAtomic.h"
+#endif
 
 //----------------------------------------------------------------------------
 
@@ -36,6 +39,10 @@ typedef SgStatisticsBase<SgUctValue,SgUctValue> SgUctStatistics;
 
 typedef SgStatisticsVltBase<SgUctValue,SgUctValue> SgUctStatisticsVolatile;
 
+#ifdef SG_UCT_ATOMIC
+typedef SgStatisticsAtomicBase<SgUctValue,SgUctValue> SgUctStatisticsAtomic;
+#endif
+
 //----------------------------------------------------------------------------
 
 namespace SgUctValueUtil
@@ -0,0 +1,92 @@
+//----------------------------------------------------------------------------
+/** @file SgMpiSharedMemorySynchronizerTest.cpp
+    Unit tests for SgMpiSharedMemorySynchronizer. */
+//----------------------------------------------------------------------------
+
+#include "SgSystem.h"
+
+#include <string>
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/thread/thread.hpp>
+#include "SgMpiSharedMemorySynchronizer.h"
+
+using std::string;
+
+//----------------------------------------------------------------------------
+
+namespace {
+
+const string CLUSTER_NAME = "SgMpiSharedMemorySynchronizerTest";
+
+/** Non-root process of a cluster with two processes, run in a thread. */
+struct TestProcess
+{
+    bool m_isRootProcess;
+
+    string m_filename;
+
+    SgMove m_move;
+
+    bool m_flag;
+
+    string m_line;
+
+    TestProcess()
+        : m_isRootProcess(true),
+          m_move(SG_NULLMOVE),
+          m_flag(false)
+    { }
+
+    void operator()()
+    {
+        SgMpiSharedMemorySynchronizer synchronizer(CLUSTER_NAME, 2, 1);
+        m_isRootProcess = synchronizer.IsRootProcess();
+        m_filename = synchronizer.ToNodeFilename("log.txt");
+        synchronizer.SynchronizeMove(m_move);
+        synchronizer.SynchronizePassWins(m_flag);
+        synchronizer.SynchronizeInputLine(m_line);
+    }
+};
+
+/** Test that the values of the root process are broadcast to the other
+    process. */
+BOOST_AUTO_TEST_CASE(SgMpiSharedMemorySynchronizerTest_Broadcast)
+{
+    TestProcess process;
+    boost::thread thread(boost::ref(process));
+    {
+        SgMpiSharedMemorySynchronizer synchronizer(CLUSTER_NAME, 2, 0);
+        BOOST_CHECK(synchronizer.IsRootProcess());
+        BOOST_CHECK_EQUAL(synchronizer.ToNodeFilename("log.txt"), "log.txt");
+        SgMove move = 42;
+        synchronizer.SynchronizeMove(move);
+        BOOST_CHECK_EQUAL(move, 42);
+        bool flag = true;
+        synchronizer.SynchronizePassWins(flag);
+        string line = "genmove b";
+        synchronizer.SynchronizeInputLine(line);
+        BOOST_CHECK_EQUAL(line, "genmove b");
+        thread.join();
+    }
+    BOOST_CHECK(! process.m_isRootProcess);
+    BOOST_CHECK_EQUAL(process.m_filename, "log.txt.1");
+    BOOST_CHECK_EQUAL(process.m_move, 42);
+    BOOST_CHECK(process.m_flag);
+    BOOST_CHECK_EQUAL(process.m_line, "genmove b");
+}
+
+/** Test that a cluster with a single process does not wait for other
+    processes. */
+BOOST_AUTO_TEST_CASE(SgMpiSharedMemorySynchronizerTest_SingleProcess)
+{
+    SgMpiSharedMemorySynchronizer synchronizer(CLUSTER_NAME, 1, 0);
+    BOOST_CHECK(synchronizer.IsRootProcess());
+    BOOST_CHECK(! synchronizer.CheckAbort());
+    SgMove move = 42;
+    synchronizer.SynchronizeMove(move);
+    BOOST_CHECK_EQUAL(move, 42);
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------
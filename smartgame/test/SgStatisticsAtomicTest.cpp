@@ -0,0 +1,95 @@
+//----------------------------------------------------------------------------
+/** @file SgStatisticsAtomicTest.cpp
+    Unit tests for SgStatisticsAtomic. */
+//----------------------------------------------------------------------------
+
+#include "SgSystem.h"
+
+#include <boost/bind.hpp>
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/thread/thread.hpp>
+#include "SgStatisticsAtomic.h"
+
+using namespace std;
+
+//----------------------------------------------------------------------------
+
+namespace {
+
+const int NU_THREADS = 8;
+
+const int NU_ADDS = 100000;
+
+/** Add NU_ADDS values alternating between 0 and 1. */
+void AddValues(SgStatisticsAtomicBase<double,double>* statistics,
+               SgAtomicValue<int>* counter)
+{
+    for (int i = 0; i < NU_ADDS; ++i)
+    {
+        statistics->Add(i % 2 == 0 ? 0. : 1.);
+        ++(*counter);
+    }
+}
+
+//----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(SgStatisticsAtomicBaseTest_AddRemove)
+{
+    SgStatisticsAtomicBase<double,double> statistics;
+    BOOST_CHECK(! statistics.IsDefined());
+    statistics.Add(2., 1.);
+    BOOST_CHECK_CLOSE(statistics.Mean(), 2., 0.1);
+    statistics.Add(5., 0.5);
+    BOOST_CHECK_CLOSE(statistics.Mean(), 3., 0.1);
+    statistics.Add(1., 1.5);
+    BOOST_CHECK_CLOSE(statistics.Mean(), 2., 0.1);
+    BOOST_CHECK_CLOSE(statistics.Count(), 3., 0.1);
+    statistics.Remove(0.5, 2.0);
+    BOOST_CHECK_CLOSE(statistics.Mean(), 5., 0.1);
+    statistics.Remove(5.);
+    BOOST_CHECK(! statistics.IsDefined());
+}
+
+BOOST_AUTO_TEST_CASE(SgStatisticsAtomicBaseTest_Copy)
+{
+    SgStatisticsAtomicBase<double,double> statistics(0.25, 4);
+    SgStatisticsAtomicBase<double,double> copy;
+    copy = statistics;
+    BOOST_CHECK_CLOSE(copy.Mean(), 0.25, 1e-4);
+    BOOST_CHECK_EQUAL(copy.Count(), 4.);
+    copy.Add(1.);
+    BOOST_CHECK_CLOSE(copy.Mean(), 0.4, 1e-4);
+    BOOST_CHECK_EQUAL(statistics.Count(), 4.);
+}
+
+BOOST_AUTO_TEST_CASE(SgStatisticsAtomicBaseTest_SaveLoad)
+{
+    SgStatisticsAtomicBase<double,double> statistics(0.5, 10);
+    ostringstream out;
+    statistics.SaveAsText(out);
+    SgStatisticsAtomicBase<double,double> loaded;
+    istringstream in(out.str());
+    loaded.LoadFromText(in);
+    BOOST_CHECK_EQUAL(loaded.Count(), 10.);
+    BOOST_CHECK_CLOSE(loaded.Mean(), 0.5, 1e-4);
+}
+
+/** Check that no updates are lost if several threads add values to the same
+    statistics at the same time. */
+BOOST_AUTO_TEST_CASE(SgStatisticsAtomicBaseTest_Concurrent)
+{
+    SgStatisticsAtomicBase<double,double> statistics;
+    SgAtomicValue<int> counter(0);
+    boost::thread_group threads;
+    for (int i = 0; i < NU_THREADS; ++i)
+        threads.create_thread(boost::bind(AddValues, &statistics, &counter));
+    threads.join_all();
+    BOOST_CHECK_EQUAL(int(counter), NU_THREADS * NU_ADDS);
+    BOOST_CHECK_EQUAL(statistics.Count(), double(NU_THREADS * NU_ADDS));
+    BOOST_CHECK_CLOSE(statistics.Mean(), 0.5, 1e-6);
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------
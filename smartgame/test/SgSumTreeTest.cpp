@@ -0,0 +1,68 @@
+//----------------------------------------------------------------------------
+/** @file SgSumTreeTest.cpp
+    Unit tests for SgSumTree. */
+//----------------------------------------------------------------------------
+
+#include "SgSystem.h"
+
+#include <boost/test/auto_unit_test.hpp>
+#include "SgSumTree.h"
+
+using namespace std;
+
+//----------------------------------------------------------------------------
+
+namespace {
+
+BOOST_AUTO_TEST_CASE(SgSumTreeTestCapacity)
+{
+    BOOST_CHECK_EQUAL(SgSumTree<1>::CAPACITY, 1);
+    BOOST_CHECK_EQUAL(SgSumTree<5>::CAPACITY, 8);
+    BOOST_CHECK_EQUAL(SgSumTree<8>::CAPACITY, 8);
+    BOOST_CHECK_EQUAL(SgSumTree<421>::CAPACITY, 512);
+}
+
+BOOST_AUTO_TEST_CASE(SgSumTreeTestSetGet)
+{
+    SgSumTree<5> t;
+    BOOST_CHECK_EQUAL(t.Total(), 0.f);
+    t.Set(1, 2.f);
+    t.Set(4, 3.f);
+    BOOST_CHECK_EQUAL(t.Get(0), 0.f);
+    BOOST_CHECK_EQUAL(t.Get(1), 2.f);
+    BOOST_CHECK_EQUAL(t.Get(4), 3.f);
+    BOOST_CHECK_EQUAL(t.Total(), 5.f);
+    t.Set(1, 0.5f);
+    BOOST_CHECK_EQUAL(t.Total(), 3.5f);
+    t.Clear();
+    BOOST_CHECK_EQUAL(t.Get(4), 0.f);
+    BOOST_CHECK_EQUAL(t.Total(), 0.f);
+}
+
+BOOST_AUTO_TEST_CASE(SgSumTreeTestSelect)
+{
+    SgSumTree<5> t;
+    t.Set(1, 2.f);
+    t.Set(4, 3.f);
+    BOOST_CHECK_EQUAL(t.Select(0.f), 1);
+    BOOST_CHECK_EQUAL(t.Select(1.9f), 1);
+    BOOST_CHECK_EQUAL(t.Select(2.f), 4);
+    BOOST_CHECK_EQUAL(t.Select(4.9f), 4);
+}
+
+/** Test that an index with weight zero is not selected for a value that is
+    not less than the total because of rounding. */
+BOOST_AUTO_TEST_CASE(SgSumTreeTestSelectNotZero)
+{
+    SgSumTree<5> t;
+    t.Set(0, 1.f);
+    t.Set(2, 1.f);
+    BOOST_CHECK_EQUAL(t.Select(2.f), 2);
+    BOOST_CHECK_EQUAL(t.Select(3.f), 2);
+    t.Set(2, 0.f);
+    BOOST_CHECK_EQUAL(t.Select(1.f), 0);
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------
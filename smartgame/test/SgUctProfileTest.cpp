@@ -0,0 +1,52 @@
+//----------------------------------------------------------------------------
+/** @file SgUctProfileTest.cpp
+    Unit tests for SgUctProfile. */
+//----------------------------------------------------------------------------
+
+#include "SgSystem.h"
+
+#include <boost/test/auto_unit_test.hpp>
+#include "SgUctProfile.h"
+
+using namespace std;
+
+//----------------------------------------------------------------------------
+
+namespace {
+
+BOOST_AUTO_TEST_CASE(SgUctProfileTestBucket)
+{
+    BOOST_CHECK_EQUAL(SgUctProfile::Bucket(0), 0);
+    BOOST_CHECK_EQUAL(SgUctProfile::Bucket(1), 0);
+    BOOST_CHECK_EQUAL(SgUctProfile::Bucket(2), 1);
+    BOOST_CHECK_EQUAL(SgUctProfile::Bucket(3), 1);
+    BOOST_CHECK_EQUAL(SgUctProfile::Bucket(4), 2);
+    BOOST_CHECK_EQUAL(SgUctProfile::Bucket(1000), 9);
+    BOOST_CHECK_EQUAL(SgUctProfile::Bucket(1024), 10);
+}
+
+BOOST_AUTO_TEST_CASE(SgUctProfileTestAddMerge)
+{
+    SgUctProfile profile;
+    profile.Add(SG_UCTPROFILE_PLAYOUT, 100);
+    profile.Add(SG_UCTPROFILE_PLAYOUT, 120);
+    profile.Add(SG_UCTPROFILE_UPDATE, 3);
+    BOOST_CHECK_EQUAL(profile.Count(SG_UCTPROFILE_PLAYOUT), 2u);
+    BOOST_CHECK_EQUAL(profile.Ticks(SG_UCTPROFILE_PLAYOUT), 220u);
+    BOOST_CHECK_EQUAL(profile.BucketCount(SG_UCTPROFILE_PLAYOUT, 6), 2u);
+    BOOST_CHECK_EQUAL(profile.Count(SG_UCTPROFILE_INTREE), 0u);
+    SgUctProfile other;
+    other.Add(SG_UCTPROFILE_UPDATE, 5);
+    profile.Merge(other);
+    BOOST_CHECK_EQUAL(profile.Count(SG_UCTPROFILE_UPDATE), 2u);
+    BOOST_CHECK_EQUAL(profile.Ticks(SG_UCTPROFILE_UPDATE), 8u);
+    BOOST_CHECK_EQUAL(profile.BucketCount(SG_UCTPROFILE_UPDATE, 1), 1u);
+    BOOST_CHECK_EQUAL(profile.BucketCount(SG_UCTPROFILE_UPDATE, 2), 1u);
+    profile.Clear();
+    BOOST_CHECK_EQUAL(profile.Count(SG_UCTPROFILE_UPDATE), 0u);
+    BOOST_CHECK_EQUAL(profile.Ticks(SG_UCTPROFILE_PLAYOUT), 0u);
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------
@@ -89,6 +89,9 @@ public:
     bool GenerateAllMoves(SgUctValue count, vector<SgUctMoveInfo>& moves,
                           SgUctProvenType& provenType);
 
+    bool GenerateMovesWithoutKnowledge(vector<SgUctMoveInfo>& moves,
+                                       SgUctProvenType& provenType);
+
     SgMove GeneratePlayoutMove(bool& skipRaveUpdate);
 
     void StartSearch();
@@ -196,6 +199,16 @@ bool TestThreadState::GenerateAllMoves(SgUctValue count,
     return false;
 }
 
+/** Pretends to leave out knowledge to test the knowledge pipeline.
+    The moves are the same as in GenerateAllMoves(). */
+bool TestThreadState::GenerateMovesWithoutKnowledge(
+                                                vector<SgUctMoveInfo>& moves,
+                                                SgUctProvenType& provenType)
+{
+    GenerateAllMoves(0, moves, provenType);
+    return true;
+}
+
 SgMove TestThreadState::GeneratePlayoutMove(bool& skipRaveUpdate)
 {
     SG_UNUSED(skipRaveUpdate);
@@ -636,6 +649,69 @@ BOOST_AUTO_TEST_CASE(SgUctSearchTest_Knowledge)
     }
 }
 
+/** Test that expanded nodes wait in the knowledge queue.
+    Uses the same test tree as SgUctSearchTest_Knowledge.
+    @see SgUctSearch::KnowledgeBatchSize() */
+BOOST_AUTO_TEST_CASE(SgUctSearchTest_KnowledgeBatch)
+{
+    TestUctSearch search;
+    search.SetExpandThreshold(1);
+    search.SetKnowledgeBatchSize(2);
+    search.AddNode(NO_NODE, SG_NULLMOVE);
+    search.AddLeafNode(0, 1, 1.f);
+    search.AddLeafNode(0, 2, 0.f);
+    search.AddLeafNode(0, 3, 0.f);
+
+    search.StartSearch();
+    search.PlayGame();
+    const SgUctTree& tree = search.Tree();
+    BOOST_CHECK_EQUAL(0, tree.Root().VirtualLossCount());
+    // Expands root, which stays in the queue until the batch is full
+    search.PlayGame();
+    BOOST_CHECK_EQUAL(4u, tree.NuNodes());
+    BOOST_CHECK_EQUAL(1, tree.Root().VirtualLossCount());
+    search.EndSearch();
+    BOOST_CHECK_EQUAL(4u, tree.NuNodes());
+    BOOST_CHECK_EQUAL(0, tree.Root().VirtualLossCount());
+    BOOST_CHECK_EQUAL(2u, tree.Root().MoveCount());
+}
+
+/** Test that the root statistics of all threads are merged in root-parallel
+    mode.
+    @verbatim
+    Numbers are node indices; L = Loss, W = Win for player at root
+    0--1  L
+    \--2  W
+    \--3  L
+    @endverbatim */
+BOOST_AUTO_TEST_CASE(SgUctSearchTest_RootParallel)
+{
+    TestUctSearch search;
+    search.SetExpandThreshold(1);
+    search.SetNumberThreads(2);
+    search.SetRootParallel(true);
+    search.SetRootParallelMergeInterval(10);
+    search.AddNode(NO_NODE, SG_NULLMOVE);
+    search.AddLeafNode(0, 1, 1.f);
+    search.AddLeafNode(0, 2, 0.f);
+    search.AddLeafNode(0, 3, 1.f);
+
+    vector<SgMove> sequence;
+    search.Search(1000, numeric_limits<double>::max(), sequence);
+    const SgUctTree& tree = search.Tree();
+    const SgUctNode& root = tree.Root();
+    // The search ends when the root of one of the trees is proven
+    BOOST_CHECK(root.MoveCount() > 0);
+    SgUctValue childCount = 0;
+    for (SgUctChildIterator it(tree, root); it; ++it)
+        childCount += (*it).MoveCount();
+    BOOST_CHECK_CLOSE(root.PosCount(), childCount, 1e-3f);
+    // Only the tree of thread 0
+    BOOST_CHECK_EQUAL(4u, tree.NuNodes());
+    BOOST_REQUIRE_EQUAL(1u, sequence.size());
+    BOOST_CHECK_EQUAL(2, sequence[0]);
+}
+
 //----------------------------------------------------------------------------
 
 } // namespace
@@ -0,0 +1,79 @@
+//----------------------------------------------------------------------------
+/** @file SgUctTranspositionTableTest.cpp
+    Unit tests for SgUctTranspositionTable. */
+//----------------------------------------------------------------------------
+
+#include "SgSystem.h"
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include "SgUctTranspositionTable.h"
+#include "SgUctTree.h"
+#include "SgUctTreeUtil.h"
+
+using std::vector;
+using SgUctTreeUtil::FindChildWithMove;
+
+//----------------------------------------------------------------------------
+
+namespace {
+
+/** Test that the first node of a position becomes its representative node
+    and that a node with children replaces a representative node without
+    children. */
+BOOST_AUTO_TEST_CASE(SgUctTranspositionTableTest_Lookup)
+{
+    SgUctTree tree;
+    tree.CreateAllocators(1);
+    tree.SetMaxNodes(10);
+    vector<SgUctMoveInfo> moves;
+    moves.push_back(SgUctMoveInfo(10));
+    moves.push_back(SgUctMoveInfo(20));
+    const SgUctNode& root = tree.Root();
+    tree.CreateChildren(0, root, moves);
+    const SgUctNode& node1 = *FindChildWithMove(tree, root, 10);
+    const SgUctNode& node2 = *FindChildWithMove(tree, root, 20);
+    SgUctTranspositionTable table;
+    table.SetMaxEntries(16);
+    const SgHashCode hashCode(12345);
+    BOOST_CHECK_EQUAL(table.Lookup(hashCode, 1, node1), &node1);
+    BOOST_CHECK_EQUAL(table.Lookup(hashCode, 1, node2), &node1);
+    // Different depth is a different key
+    BOOST_CHECK_EQUAL(table.Lookup(hashCode, 3, node2), &node2);
+    BOOST_CHECK_EQUAL(table.Lookup(hashCode, 1, node2), &node2);
+    moves.clear();
+    moves.push_back(SgUctMoveInfo(30));
+    tree.CreateChildren(0, node1, moves);
+    BOOST_CHECK_EQUAL(table.Lookup(hashCode, 1, node1), &node1);
+    BOOST_CHECK_EQUAL(table.Lookup(hashCode, 1, node2), &node1);
+    table.Clear();
+    BOOST_CHECK_EQUAL(table.Lookup(hashCode, 1, node2), &node2);
+}
+
+/** Test accumulating the statistics of a position. */
+BOOST_AUTO_TEST_CASE(SgUctTranspositionTableTest_AddGameResults)
+{
+    SgUctTree tree;
+    tree.CreateAllocators(1);
+    tree.SetMaxNodes(10);
+    vector<SgUctMoveInfo> moves;
+    moves.push_back(SgUctMoveInfo(10, 1.f, 2, 0.f, 0));
+    const SgUctNode& root = tree.Root();
+    tree.CreateChildren(0, root, moves);
+    const SgUctNode& node = *FindChildWithMove(tree, root, 10);
+    SgUctTranspositionTable table;
+    SgUctStatistics value;
+    const SgHashCode hashCode(12345);
+    BOOST_CHECK(! table.AddGameResults(hashCode, 1, 0.f, 1, value));
+    table.SetMaxEntries(16);
+    BOOST_CHECK(! table.AddGameResults(hashCode, 1, 0.f, 1, value));
+    table.Lookup(hashCode, 1, node);
+    BOOST_CHECK(table.AddGameResults(hashCode, 1, 0.f, 2, value));
+    BOOST_CHECK_EQUAL(value.Count(), 4);
+    BOOST_CHECK_CLOSE(value.Mean(), 0.5, 1e-4);
+    BOOST_CHECK(! table.AddGameResults(hashCode, 2, 0.f, 1, value));
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------
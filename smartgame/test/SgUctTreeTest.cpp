@@ -5,8 +5,10 @@
 
 #include "SgSystem.h"
 
+#include <boost/bind.hpp>
 #include <boost/test/auto_unit_test.hpp>
 #include <boost/test/floating_point_comparison.hpp>
+#include <boost/thread/thread.hpp>
 #include "SgUctTree.h"
 #include "SgUctTreeUtil.h"
 
@@ -140,6 +142,222 @@ BOOST_AUTO_TEST_CASE(SgUctTreeIteratorTest_ApplyFilter)
     BOOST_CHECK_CLOSE((*it).Mean(), SgUctValue(0.5), 1e-4);
 }
 
+/** Test SgUctTree::ShareChildren() */
+BOOST_AUTO_TEST_CASE(SgUctTreeTest_ShareChildren)
+{
+    SgUctTree tree;
+    tree.CreateAllocators(1);
+    tree.SetMaxNodes(100);
+    vector<SgUctMoveInfo> moves;
+    moves.push_back(SgUctMoveInfo(10));
+    moves.push_back(SgUctMoveInfo(20));
+    const SgUctNode& root = tree.Root();
+    tree.CreateChildren(0, root, moves);
+    const SgUctNode& node1 = *FindChildWithMove(tree, root, 10);
+    const SgUctNode& node2 = *FindChildWithMove(tree, root, 20);
+    moves.clear();
+    moves.push_back(SgUctMoveInfo(30, 1.f, 3, 0.f, 0));
+    tree.CreateChildren(0, node1, moves);
+    tree.ShareChildren(node2, node1);
+    BOOST_CHECK_EQUAL(node2.NuChildren(), 1);
+    BOOST_CHECK_EQUAL(node2.PosCount(), node1.PosCount());
+    const SgUctNode& child = *SgUctChildIterator(tree, node2);
+    BOOST_CHECK_EQUAL(&child, FindChildWithMove(tree, node1, 30));
+    tree.AddGameResult(child, &node2, 0.f);
+    BOOST_CHECK_EQUAL(FindChildWithMove(tree, node1, 30)->MoveCount(), 4u);
+    // Each shared subtree is visited once per path
+    size_t nuNodes = 0;
+    for (SgUctTreeIterator it(tree); it; ++it)
+        ++nuNodes;
+    BOOST_CHECK_EQUAL(nuNodes, 5u);
+}
+
+/** Test SgUctTree::ReRoot() */
+BOOST_AUTO_TEST_CASE(SgUctTreeTest_ReRoot)
+{
+    SgUctTree tree;
+    tree.CreateAllocators(1);
+    tree.SetMaxNodes(100);
+    vector<SgUctMoveInfo> moves;
+    moves.push_back(SgUctMoveInfo(10));
+    moves.push_back(SgUctMoveInfo(20, 1.f, 3, 0.f, 0));
+    const SgUctNode& root = tree.Root();
+    tree.CreateChildren(0, root, moves);
+    const SgUctNode& node2 = *FindChildWithMove(tree, root, 20);
+    moves.clear();
+    moves.push_back(SgUctMoveInfo(30));
+    moves.push_back(SgUctMoveInfo(40));
+    tree.CreateChildren(0, node2, moves);
+    const SgUctNode* node3 = FindChildWithMove(tree, node2, 30);
+    const SgUctNode* node4 = FindChildWithMove(tree, node2, 40);
+    tree.ReRoot(node2);
+    BOOST_CHECK_EQUAL(root.Move(), 20);
+    BOOST_CHECK_EQUAL(root.MoveCount(), 3u);
+    BOOST_CHECK_CLOSE(root.Mean(), SgUctValue(1.0), 1e-4);
+    BOOST_CHECK_EQUAL(root.NuChildren(), 2);
+    // Children are not copied
+    BOOST_CHECK_EQUAL(FindChildWithMove(tree, root, 30), node3);
+    BOOST_CHECK_EQUAL(FindChildWithMove(tree, root, 40), node4);
+    // Unreachable nodes are not reclaimed
+    BOOST_CHECK_EQUAL(tree.NuNodes(), 5u);
+    tree.ReRoot(*node3);
+    BOOST_CHECK_EQUAL(root.Move(), 30);
+    BOOST_CHECK(! root.HasChildren());
+}
+
+/** Test SgUctTree::AddKnowledge() */
+BOOST_AUTO_TEST_CASE(SgUctTreeTest_AddKnowledge)
+{
+    SgUctTree tree;
+    tree.CreateAllocators(1);
+    tree.SetMaxNodes(10);
+    vector<SgUctMoveInfo> moves;
+    moves.push_back(SgUctMoveInfo(10));
+    moves.push_back(SgUctMoveInfo(20));
+    const SgUctNode& root = tree.Root();
+    tree.CreateChildren(0, root, moves);
+    const SgUctNode& node1 = *FindChildWithMove(tree, root, 10);
+    const SgUctNode& node2 = *FindChildWithMove(tree, root, 20);
+    tree.AddGameResult(node2, &root, 1.f);
+
+    // Other order than children, includes a move that is not a child
+    moves.clear();
+    moves.push_back(SgUctMoveInfo(30, 1.f, 5, 0.f, 0));
+    moves.push_back(SgUctMoveInfo(20, 0.f, 3, 0.f, 0));
+    moves.push_back(SgUctMoveInfo(10, 0.5f, 2, 0.5f, 4));
+    moves.back().m_predictorValue = 0.25f;
+    tree.AddKnowledge(root, moves);
+    BOOST_CHECK_EQUAL(tree.NuNodes(), 3u);
+    BOOST_CHECK_EQUAL(node1.MoveCount(), 2u);
+    BOOST_CHECK_CLOSE(node1.Mean(), SgUctValue(0.5), 1e-4);
+    BOOST_CHECK_EQUAL(node1.RaveCount(), 4u);
+    BOOST_CHECK_CLOSE(node1.PredictorValue(), 0.25f, 1e-4);
+    BOOST_CHECK_EQUAL(node2.MoveCount(), 4u);
+    BOOST_CHECK_CLOSE(node2.Mean(), SgUctValue(0.25), 1e-4);
+    BOOST_CHECK_EQUAL(root.PosCount(), 6u);
+}
+
+/** Test that SgUctTree::TouchMemory() does not change existing nodes. */
+BOOST_AUTO_TEST_CASE(SgUctTreeTest_TouchMemory)
+{
+    SgUctTree tree;
+    tree.CreateAllocators(2);
+    tree.SetMaxNodes(2000);
+    vector<SgUctMoveInfo> moves;
+    moves.push_back(SgUctMoveInfo(10));
+    moves.push_back(SgUctMoveInfo(20, 1.f, 3, 0.f, 0));
+    const SgUctNode& root = tree.Root();
+    tree.CreateChildren(0, root, moves);
+    tree.TouchMemory(0);
+    tree.TouchMemory(1);
+    BOOST_CHECK_EQUAL(tree.NuNodes(), 3u);
+    const SgUctNode* node = FindChildWithMove(tree, root, 20);
+    BOOST_REQUIRE(node != 0);
+    BOOST_CHECK_EQUAL(node->MoveCount(), 3u);
+    moves.clear();
+    moves.push_back(SgUctMoveInfo(30));
+    tree.CreateChildren(1, *node, moves);
+    tree.TouchMemory(1);
+    BOOST_CHECK_EQUAL(tree.NuNodes(), 4u);
+    BOOST_CHECK(FindChildWithMove(tree, *node, 30) != 0);
+    BOOST_REQUIRE_NO_THROW(tree.CheckConsistency());
+}
+
+/** Test SgUctTree::PruneLowCount() */
+BOOST_AUTO_TEST_CASE(SgUctTreeTest_PruneLowCount)
+{
+    SgUctTree tree;
+    tree.CreateAllocators(1);
+    tree.SetMaxNodes(6);
+    vector<SgUctMoveInfo> moves;
+    moves.push_back(SgUctMoveInfo(10, 1.f, 1, 0.f, 0));
+    moves.push_back(SgUctMoveInfo(20, 1.f, 5, 0.f, 0));
+    const SgUctNode& root = tree.Root();
+    tree.CreateChildren(0, root, moves);
+    const SgUctNode& node1 = *FindChildWithMove(tree, root, 10);
+    const SgUctNode& node2 = *FindChildWithMove(tree, root, 20);
+    moves.clear();
+    moves.push_back(SgUctMoveInfo(30));
+    moves.push_back(SgUctMoveInfo(40));
+    tree.CreateChildren(0, node1, moves);
+    const SgUctNode* node3 = FindChildWithMove(tree, node1, 30);
+    moves.clear();
+    moves.push_back(SgUctMoveInfo(50));
+    tree.CreateChildren(0, node2, moves);
+    const SgUctNode* node5 = FindChildWithMove(tree, node2, 50);
+    tree.AddGameResults(root, 0, 1.f, 6);
+    BOOST_CHECK_EQUAL(tree.NuNodes(), 6u);
+    BOOST_CHECK(! tree.HasCapacity(0, 2));
+    BOOST_CHECK_EQUAL(tree.PruneLowCount(2), 4u);
+    BOOST_CHECK(! node1.HasChildren());
+    BOOST_CHECK_EQUAL(node2.NuChildren(), 1);
+    BOOST_CHECK_EQUAL(FindChildWithMove(tree, node2, 50), node5);
+    // Released nodes are reused
+    BOOST_CHECK(tree.HasCapacity(0, 2));
+    BOOST_CHECK(! tree.HasCapacity(0, 3));
+    moves.clear();
+    moves.push_back(SgUctMoveInfo(60));
+    moves.push_back(SgUctMoveInfo(70));
+    tree.CreateChildren(0, *node5, moves);
+    BOOST_CHECK_EQUAL(FindChildWithMove(tree, *node5, 60), node3);
+    BOOST_CHECK_EQUAL(tree.NuNodes(), 6u);
+    // Nodes discarded by ReRoot() are reclaimed
+    tree.ReRoot(node2);
+    BOOST_CHECK_EQUAL(tree.PruneLowCount(0), 4u);
+    BOOST_CHECK(tree.HasCapacity(0, 2));
+}
+
+#ifdef SG_UCT_ATOMIC
+
+const int NU_UPDATES = 50000;
+
+/** Update root and child like SgUctSearch::UpdateTree() and
+    SgUctSearch::UpdateRaveValues() do in lock-free mode. */
+void UpdateNodes(SgUctTree* tree, const SgUctNode* child)
+{
+    const SgUctNode& root = tree->Root();
+    for (int i = 0; i < NU_UPDATES; ++i)
+    {
+        tree->AddVirtualLoss(root);
+        tree->AddVirtualLoss(*child);
+        tree->AddGameResult(root, 0, 1);
+        tree->AddGameResult(*child, &root, 0);
+        tree->AddRaveValue(*child, 1, 1);
+        tree->RemoveVirtualLoss(root);
+        tree->RemoveVirtualLoss(*child);
+    }
+}
+
+/** Check that no count is lost if several threads update the same nodes
+    concurrently. */
+BOOST_AUTO_TEST_CASE(SgUctTreeTest_ConcurrentUpdates)
+{
+    const int nuThreads = 4;
+    SgUctTree tree;
+    tree.CreateAllocators(nuThreads);
+    tree.SetMaxNodes(10 * nuThreads);
+    vector<SgUctMoveInfo> moves;
+    moves.push_back(SgUctMoveInfo(10));
+    const SgUctNode& root = tree.Root();
+    tree.CreateChildren(0, root, moves);
+    const SgUctNode& child = *FindChildWithMove(tree, root, 10);
+    boost::thread_group threads;
+    for (int i = 0; i < nuThreads; ++i)
+        threads.create_thread(boost::bind(UpdateNodes, &tree, &child));
+    threads.join_all();
+    const SgUctValue total = SgUctValue(nuThreads * NU_UPDATES);
+    BOOST_CHECK_EQUAL(root.MoveCount(), total);
+    BOOST_CHECK_EQUAL(root.PosCount(), total);
+    BOOST_CHECK_CLOSE(root.Mean(), SgUctValue(1), 1e-4);
+    BOOST_CHECK_EQUAL(child.MoveCount(), total);
+    BOOST_CHECK_CLOSE(child.Mean(), SgUctValue(0), 1e-4);
+    BOOST_CHECK_EQUAL(child.RaveCount(), total);
+    BOOST_CHECK_EQUAL(root.VirtualLossCount(), 0);
+    BOOST_CHECK_EQUAL(child.VirtualLossCount(), 0);
+}
+
+#endif // SG_UCT_ATOMIC
+
 } // namespace
 
 //----------------------------------------------------------------------------
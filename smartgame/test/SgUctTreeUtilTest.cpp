@@ -5,8 +5,11 @@
 
 #include "SgSystem.h"
 
+#include <cstdio>
+#include <fstream>
 #include <boost/test/auto_unit_test.hpp>
 #include <boost/test/floating_point_comparison.hpp>
+#include "SgException.h"
 #include "SgUctSearch.h"
 #include "SgUctTreeUtil.h"
 
@@ -154,6 +157,83 @@ BOOST_AUTO_TEST_CASE(SgUctTreeUtilTest_ExtractSubtree_Overflow)
     BOOST_CHECK(target.NuNodes(1) <= 5);
 }
 
+
+/** Test that SaveBinary() and LoadBinary() restore the subtree. */
+BOOST_AUTO_TEST_CASE(SgUctTreeUtilTest_SaveLoadBinary)
+{
+    SgUctTree tree;
+    tree.CreateAllocators(1);
+    tree.SetMaxNodes(10);
+    vector<SgUctMoveInfo> moves;
+    moves.push_back(SgUctMoveInfo(10, 0.2f, 5, 0.3f, 8));
+    moves.push_back(SgUctMoveInfo(20, 0.6f, 3, 0.4f, 7));
+    moves.back().m_predictorValue = 0.5f;
+    const SgUctNode& root = tree.Root();
+    tree.CreateChildren(0, root, moves);
+    const SgUctNode* node = SgUctTreeUtil::FindChildWithMove(tree, root, 20);
+    moves.clear();
+    moves.push_back(SgUctMoveInfo(30, 0.9f, 2, 0.f, 0));
+    tree.CreateChildren(0, *node, moves);
+    tree.SetProvenType(*node, SG_PROVEN_WIN);
+    tree.InitializeValue(root, 0.5f, 10);
+
+    const string fileName = "SgUctTreeUtilTest_SaveLoadBinary.tmp";
+    SgUctTreeUtil::SaveBinary(tree, root, fileName, "info");
+
+    SgUctTree target;
+    target.CreateAllocators(1);
+    target.SetMaxNodes(10);
+    string info;
+    SgUctTreeUtil::LoadBinary(target, fileName, info);
+    remove(fileName.c_str());
+    BOOST_REQUIRE_NO_THROW(target.CheckConsistency());
+    BOOST_CHECK_EQUAL(info, "info");
+    BOOST_CHECK_EQUAL(target.NuNodes(), 4u);
+    const SgUctNode& targetRoot = target.Root();
+    BOOST_CHECK_EQUAL(targetRoot.MoveCount(), 10);
+    BOOST_CHECK_CLOSE(targetRoot.Mean(), 0.5f, 1e-4);
+    BOOST_CHECK_EQUAL(targetRoot.NuChildren(), 2);
+    BOOST_CHECK_EQUAL(targetRoot.PosCount(), root.PosCount());
+    node = SgUctTreeUtil::FindChildWithMove(target, targetRoot, 10);
+    BOOST_REQUIRE(node != 0);
+    BOOST_CHECK_EQUAL(node->MoveCount(), 5);
+    BOOST_CHECK_CLOSE(node->Mean(), 0.2f, 1e-4);
+    BOOST_CHECK_EQUAL(node->RaveCount(), 8);
+    BOOST_CHECK_CLOSE(node->RaveValue(), 0.3f, 1e-4);
+    BOOST_CHECK(! node->HasChildren());
+    node = SgUctTreeUtil::FindChildWithMove(target, targetRoot, 20);
+    BOOST_REQUIRE(node != 0);
+    BOOST_CHECK_CLOSE(node->PredictorValue(), 0.5f, 1e-4);
+    BOOST_CHECK(node->IsProvenWin());
+    BOOST_CHECK_EQUAL(node->NuChildren(), 1);
+    node = SgUctTreeUtil::FindChildWithMove(target, *node, 30);
+    BOOST_REQUIRE(node != 0);
+    BOOST_CHECK_EQUAL(node->MoveCount(), 2);
+    BOOST_CHECK(! node->HasRaveValue());
+}
+
+/** Test that LoadBinary() rejects files of another format version. */
+BOOST_AUTO_TEST_CASE(SgUctTreeUtilTest_LoadBinary_Version)
+{
+    SgUctTree tree;
+    tree.CreateAllocators(1);
+    tree.SetMaxNodes(10);
+    const string fileName = "SgUctTreeUtilTest_LoadBinary_Version.tmp";
+    SgUctTreeUtil::SaveBinary(tree, tree.Root(), fileName, "");
+    {
+        // Version follows the 8 byte magic string
+        fstream file(fileName.c_str(), ios::in | ios::out | ios::binary);
+        file.seekp(8);
+        file.put(SgUctTreeUtil::BINARY_VERSION + 1);
+    }
+    string info;
+    BOOST_CHECK_THROW(SgUctTreeUtil::LoadBinary(tree, fileName, info),
+                      SgException);
+    remove(fileName.c_str());
+    BOOST_CHECK_THROW(SgUctTreeUtil::LoadBinary(tree, fileName, info),
+                      SgException);
+}
+
 } // namespace
 
 //----------------------------------------------------------------------------
@@ -0,0 +1,71 @@
+# makeFeData.awk
+# Converts a model file of Wistuba's tool into the C++ arrays of FeData.h.
+# The model file starts with a line "size:n,k:k", followed by n lines
+# "id,w" and n lines "id,v_1,...,v_k".
+# Used by makeFeData.sh
+
+function literal(x)
+{
+    if (x !~ /[.eE]/)
+        x = x ".0"
+    return x "f"
+}
+
+BEGIN { FS = "," }
+
+NR == 1 {
+    split($1, a, ":")
+    size = a[2]
+    split($2, a, ":")
+    k = a[2]
+    next
+}
+
+NR <= size + 1 {
+    id[NR - 1] = $1
+    w[$1] = literal($2)
+    next
+}
+
+NR <= 2 * size + 1 {
+    if (NF != k + 1)
+    {
+        print "makeFeData.awk: wrong number of factors in line " NR \
+            > "/dev/stderr"
+        exit 1
+    }
+    s = literal($2)
+    for (i = 3; i <= NF; ++i)
+        s = s ", " literal($i)
+    v[$1] = s
+    next
+}
+
+END {
+    print "static const std::size_t gFeatureDataNuFeatures = " size ";"
+    print ""
+    print "static const std::size_t gFeatureDataK = " k ";"
+    print ""
+    print "static const unsigned short gFeatureDataID[" size "] = {"
+    for (i = 1; i <= size; ++i)
+        print id[i] ","
+    print "};"
+    print ""
+    print "static const float gFeatureDataW[" size "] = {"
+    for (i = 1; i <= size; ++i)
+        print w[id[i]] ","
+    print "};"
+    print ""
+    print "static const float gFeatureDataV[" size "][" k "] = {"
+    for (i = 1; i <= size; ++i)
+    {
+        if (! (id[i] in v))
+        {
+            print "makeFeData.awk: no factors for feature " id[i] \
+                > "/dev/stderr"
+            exit 1
+        }
+        print "{ " v[id[i]] " },"
+    }
+    print "};"
+}
@@ -6,9 +6,12 @@ if ($#argv == 1) then
     date >> FeData.h
     echo "From file" $argv[1] ". Do not edit. */" >> FeData.h
     echo >> FeData.h
-    echo "static const std::string gFeatureData = " >> FeData.h
-	sed 's/.*/"& "/' $argv[1] >> FeData.h
-	echo ";" >> FeData.h
+	awk -f `dirname $0`/makeFeData.awk $argv[1] >> FeData.h
+	if ($status != 0) then
+		echo makeFeData.sh: conversion of $argv[1] failed
+		rm -f FeData.h
+		exit 1
+	endif
 	echo To use these weights, copy FeData.h into fuego/features
 else
 	echo makeFeData.sh Needs one argument: name of model file